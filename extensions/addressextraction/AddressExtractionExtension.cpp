@@ -21,17 +21,26 @@
 **/
 
 #include "src/AddressExtractionBlockChangeSubscriber.h"
+#include "src/AddressExtractionConfiguration.h"
 #include "src/AddressExtractionPtChangeSubscriber.h"
 #include "src/AddressExtractionUtChangeSubscriber.h"
 #include "src/AddressExtractor.h"
 #include "bitxorcore/extensions/ProcessBootstrapper.h"
 #include "bitxorcore/extensions/RootedService.h"
+#include <thread>
 
 namespace bitxorcore { namespace addressextraction {
 
 	namespace {
 		void RegisterExtension(extensions::ProcessBootstrapper& bootstrapper) {
-			auto pAddressExtractor = std::make_shared<AddressExtractor>(bootstrapper.pluginManager().createNotificationPublisher());
+			auto config = AddressExtractionConfiguration::LoadFromPath(bootstrapper.resourcesPath());
+
+			// extract addresses from large blocks in parallel only when more than one thread is available
+			auto numWorkerThreads = std::min(std::thread::hardware_concurrency(), config.MaxWorkerThreads);
+			auto* pPool = numWorkerThreads > 1 ? bootstrapper.pool().pushIsolatedPool("address extractor", numWorkerThreads) : nullptr;
+			auto pAddressExtractor = std::make_shared<AddressExtractor>(
+					bootstrapper.pluginManager().createNotificationPublisher(),
+					pPool);
 
 			// add a dummy service for extending service lifetimes
 			bootstrapper.extensionManager().addServiceRegistrar(extensions::CreateRootedServiceRegistrar(
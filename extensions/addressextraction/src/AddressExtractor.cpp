@@ -23,11 +23,23 @@
 #include "AddressExtractor.h"
 #include "bitxorcore/model/Elements.h"
 #include "bitxorcore/model/TransactionUtils.h"
+#include "bitxorcore/thread/IoThreadPool.h"
+#include "bitxorcore/thread/ParallelFor.h"
 
 namespace bitxorcore { namespace addressextraction {
 
+	namespace {
+		// smaller blocks are processed on the calling thread because dispatching work would cost more than it saves
+		constexpr size_t Min_Parallel_Transactions = 100;
+	}
+
 	AddressExtractor::AddressExtractor(std::unique_ptr<const model::NotificationPublisher>&& pPublisher)
+			: AddressExtractor(std::move(pPublisher), nullptr)
+	{}
+
+	AddressExtractor::AddressExtractor(std::unique_ptr<const model::NotificationPublisher>&& pPublisher, thread::IoThreadPool* pPool)
 			: m_pPublisher(std::move(pPublisher))
+			, m_pPool(pPool)
 	{}
 
 	void AddressExtractor::extract(model::TransactionInfo& transactionInfo) const {
@@ -52,37 +64,45 @@ namespace bitxorcore { namespace addressextraction {
 	}
 
 	namespace {
-		void AddResolvedAddresses(
-				model::AddressSet& addresses,
-				uint32_t primaryId,
-				const model::AddressResolutionStatement& resolutionStatement) {
-			for (auto i = 0u; i < resolutionStatement.size(); ++i) {
-				const auto& resolutionEntry = resolutionStatement.entryAt(i);
-
-				// resolution statements are ordered
-				if (primaryId < resolutionEntry.Source.PrimaryId)
-					break;
-
-				if (primaryId > resolutionEntry.Source.PrimaryId)
-					continue;
-
-				addresses.insert(resolutionEntry.ResolvedValue);
+		using AddressResolutionStatements = decltype(model::BlockStatement::AddressResolutionStatements);
+
+		// index of address resolutions by (1-based) transaction primary id
+		class AddressResolutionIndex {
+		private:
+			using UnresolvedResolvedAddressPairs = std::vector<std::pair<UnresolvedAddress, Address>>;
+
+		public:
+			AddressResolutionIndex(const AddressResolutionStatements& addressResolutionStatements, size_t numTransactions)
+					: m_transactionResolutions(numTransactions) {
+				for (const auto& pair : addressResolutionStatements) {
+					const auto& resolutionStatement = pair.second;
+					for (auto i = 0u; i < resolutionStatement.size(); ++i) {
+						const auto& resolutionEntry = resolutionStatement.entryAt(i);
+
+						// skip resolutions that are not associated with a transaction
+						auto primaryId = resolutionEntry.Source.PrimaryId;
+						if (0 == primaryId || primaryId > numTransactions)
+							continue;
+
+						m_transactionResolutions[primaryId - 1].emplace_back(pair.first, resolutionEntry.ResolvedValue);
+					}
+				}
 			}
-		}
 
-		model::AddressSet FindResolvedAddresses(
-				const decltype(model::BlockStatement::AddressResolutionStatements)& addressResolutionStatements,
-				uint32_t primaryId,
-				const model::UnresolvedAddressSet& extractedAddresses) {
-			model::AddressSet resolvedAddresses;
-			for (const auto& address : extractedAddresses) {
-				auto resolutionStatementIter = addressResolutionStatements.find(address);
-				if (addressResolutionStatements.cend() != resolutionStatementIter)
-					AddResolvedAddresses(resolvedAddresses, primaryId, resolutionStatementIter->second);
+		public:
+			model::AddressSet find(uint32_t primaryId, const model::UnresolvedAddressSet& extractedAddresses) const {
+				model::AddressSet resolvedAddresses;
+				for (const auto& pair : m_transactionResolutions[primaryId - 1]) {
+					if (extractedAddresses.cend() != extractedAddresses.find(pair.first))
+						resolvedAddresses.insert(pair.second);
+				}
+
+				return resolvedAddresses;
 			}
 
-			return resolvedAddresses;
-		}
+		private:
+			std::vector<UnresolvedResolvedAddressPairs> m_transactionResolutions;
+		};
 
 		void UpdateExtractedAddresses(model::TransactionElement& transactionElement, const model::AddressSet& resolvedAddresses) {
 			if (resolvedAddresses.empty())
@@ -99,20 +119,39 @@ namespace bitxorcore { namespace addressextraction {
 	}
 
 	void AddressExtractor::extract(model::BlockElement& blockElement) const {
-		auto primaryId = 1u; // transaction primary identifiers are 1-based
+		auto& transactionElements = blockElement.Transactions;
 
-		for (auto& transactionElement : blockElement.Transactions) {
-			extract(transactionElement);
+		std::unique_ptr<AddressResolutionIndex> pResolutionIndex;
+		if (blockElement.OptionalStatement) {
+			const auto& addressResolutionStatements = blockElement.OptionalStatement->AddressResolutionStatements;
+			pResolutionIndex = std::make_unique<AddressResolutionIndex>(addressResolutionStatements, transactionElements.size());
+		}
 
-			if (blockElement.OptionalStatement) {
-				auto resolvedAddresses = FindResolvedAddresses(
-						blockElement.OptionalStatement->AddressResolutionStatements,
-						primaryId,
-						*transactionElement.OptionalExtractedAddresses);
-				UpdateExtractedAddresses(transactionElement, resolvedAddresses);
+		auto extractAll = [this, &resolutionIndex = pResolutionIndex](auto itBegin, auto itEnd, auto startIndex) {
+			auto primaryId = static_cast<uint32_t>(startIndex + 1); // transaction primary identifiers are 1-based
+			for (auto iter = itBegin; itEnd != iter; ++iter, ++primaryId) {
+				auto& transactionElement = *iter;
+				extract(transactionElement);
+
+				if (resolutionIndex) {
+					auto resolvedAddresses = resolutionIndex->find(primaryId, *transactionElement.OptionalExtractedAddresses);
+					UpdateExtractedAddresses(transactionElement, resolvedAddresses);
+				}
 			}
+		};
 
-			++primaryId;
+		if (!m_pPool || transactionElements.size() < Min_Parallel_Transactions) {
+			extractAll(transactionElements.begin(), transactionElements.end(), 0u);
+			return;
 		}
+
+		auto numPartitions = m_pPool->numWorkerThreads();
+		thread::ParallelForPartition(m_pPool->ioContext(), transactionElements, numPartitions, [&extractAll](
+				auto itBegin,
+				auto itEnd,
+				auto startIndex,
+				auto) {
+			extractAll(itBegin, itEnd, startIndex);
+		}).get();
 	}
 }}
@@ -29,6 +29,7 @@ namespace bitxorcore {
 		struct BlockElement;
 		struct TransactionElement;
 	}
+	namespace thread { class IoThreadPool; }
 }
 
 namespace bitxorcore { namespace addressextraction {
@@ -39,6 +40,9 @@ namespace bitxorcore { namespace addressextraction {
 		/// Creates an extractor around \a pPublisher.
 		explicit AddressExtractor(std::unique_ptr<const model::NotificationPublisher>&& pPublisher);
 
+		/// Creates an extractor around \a pPublisher that uses \a pPool (optional) for extracting addresses from large blocks.
+		AddressExtractor(std::unique_ptr<const model::NotificationPublisher>&& pPublisher, thread::IoThreadPool* pPool);
+
 	public:
 		/// Extracts transaction addresses into \a transactionInfo.
 		void extract(model::TransactionInfo& transactionInfo) const;
@@ -54,5 +58,6 @@ namespace bitxorcore { namespace addressextraction {
 
 	private:
 		std::unique_ptr<const model::NotificationPublisher> m_pPublisher;
+		thread::IoThreadPool* m_pPool;
 	};
 }}
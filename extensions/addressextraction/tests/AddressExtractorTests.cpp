@@ -22,6 +22,8 @@
 
 #include "addressextraction/src/AddressExtractor.h"
 #include "bitxorcore/model/Elements.h"
+#include "bitxorcore/thread/IoThreadPool.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/TransactionInfoTestUtils.h"
 #include "tests/test/core/TransactionTestUtils.h"
 #include "tests/test/core/mocks/MockNotificationPublisher.h"
@@ -37,10 +39,14 @@ namespace bitxorcore { namespace addressextraction {
 
 		class TestContext {
 		public:
-			TestContext()
-					: m_pNotificationPublisher(std::make_unique<mocks::MockNotificationPublisher>())
+			TestContext() : TestContext(0)
+			{}
+
+			explicit TestContext(uint32_t numWorkerThreads)
+					: m_pPool(0 == numWorkerThreads ? nullptr : test::CreateStartedIoThreadPool(numWorkerThreads))
+					, m_pNotificationPublisher(std::make_unique<mocks::MockNotificationPublisher>())
 					, m_notificationPublisher(*m_pNotificationPublisher)
-					, m_extractor(std::move(m_pNotificationPublisher))
+					, m_extractor(std::move(m_pNotificationPublisher), m_pPool.get())
 			{}
 
 		public:
@@ -53,6 +59,7 @@ namespace bitxorcore { namespace addressextraction {
 			}
 
 		private:
+			std::unique_ptr<thread::IoThreadPool> m_pPool;
 			std::unique_ptr<mocks::MockNotificationPublisher> m_pNotificationPublisher; // moved into m_extractor
 			mocks::MockNotificationPublisher& m_notificationPublisher;
 			AddressExtractor m_extractor;
@@ -322,5 +329,116 @@ namespace bitxorcore { namespace addressextraction {
 				*blockElement.Transactions[3].OptionalExtractedAddresses);
 	}
 
+	TEST(TEST_CLASS, ExtractIgnoresResolutionsNotAssociatedWithTransactions_BlockElement) {
+		// Arrange:
+		TestContext context;
+
+		// - create four transaction elements and associate two addresses with each transaction
+		model::Block block;
+		model::BlockElement blockElement(block);
+		auto seedAddresses = SeedTransactionsWithExtractedAddresses(blockElement, 4);
+
+		// - add resolutions with primary ids that do not correspond to any transaction
+		auto seedResolvedAddresses = test::GenerateRandomDataVector<Address>(2);
+		auto pBlockStatement = std::make_shared<model::BlockStatement>();
+		AddAddressResolutionStatement(*pBlockStatement, seedAddresses[2], {
+			{ { 0, 0 }, seedResolvedAddresses[0] },
+			{ { 5, 0 }, seedResolvedAddresses[1] }
+		});
+		blockElement.OptionalStatement = std::move(pBlockStatement);
+
+		// Act:
+		context.extractor().extract(blockElement);
+
+		// Assert: no resolved addresses were added
+		for (auto i = 0u; i < 4; ++i)
+			EXPECT_EQ(ToAddressSet(seedAddresses, { 2 * i, 2 * i + 1 }), *blockElement.Transactions[i].OptionalExtractedAddresses) << i;
+	}
+
+	// endregion
+
+	// region extract (BlockElement) - parallel
+
+	namespace {
+		constexpr auto Num_Worker_Threads = 4u;
+		constexpr auto Num_Large_Block_Transactions = 250u;
+	}
+
+	TEST(TEST_CLASS, ExtractDelegatesToPublisherOnlyWhenExtractionRequired_LargeBlockElement) {
+		// Arrange:
+		TestContext context(Num_Worker_Threads);
+		auto pAddresses = std::make_shared<model::UnresolvedAddressSet>();
+
+		// - create a block with every odd element having addresses
+		model::Block block;
+		model::BlockElement blockElement(block);
+		auto transactions = test::GenerateRandomTransactions(Num_Large_Block_Transactions);
+		for (const auto& pTransaction : transactions) {
+			blockElement.Transactions.push_back(model::TransactionElement(*pTransaction));
+			if (0 == blockElement.Transactions.size() % 2)
+				blockElement.Transactions.back().OptionalExtractedAddresses = pAddresses;
+		}
+
+		// Act:
+		context.extractor().extract(blockElement);
+
+		// Assert:
+		EXPECT_EQ(Num_Large_Block_Transactions / 2, context.publisher().numPublishCalls());
+
+		// - all have addresses and the previously existing addresses are unchanged
+		for (auto i = 0u; i < Num_Large_Block_Transactions; ++i) {
+			ASSERT_TRUE(!!blockElement.Transactions[i].OptionalExtractedAddresses) << i;
+
+			if (1 == i % 2) {
+				EXPECT_EQ(pAddresses, blockElement.Transactions[i].OptionalExtractedAddresses) << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, ExtractAddsTransactionResolvedAddressesWhenBlockStatementIsPresent_LargeBlockElement) {
+		// Arrange:
+		TestContext context(Num_Worker_Threads);
+
+		// - create transaction elements and associate two addresses with each transaction
+		model::Block block;
+		model::BlockElement blockElement(block);
+		auto seedAddresses = SeedTransactionsWithExtractedAddresses(blockElement, Num_Large_Block_Transactions);
+
+		// - add address resolution statements for transactions in different partitions
+		auto seedResolvedAddresses = test::GenerateRandomDataVector<Address>(4);
+		auto pBlockStatement = std::make_shared<model::BlockStatement>();
+		AddAddressResolutionStatement(*pBlockStatement, seedAddresses[2], {
+			{ { 2, 0 }, seedResolvedAddresses[0] },
+			{ { 200, 0 }, seedResolvedAddresses[1] }
+		});
+		AddAddressResolutionStatement(*pBlockStatement, seedAddresses[399], {
+			{ { 100, 0 }, seedResolvedAddresses[2] },
+			{ { 200, 0 }, seedResolvedAddresses[3] }
+		});
+		blockElement.OptionalStatement = std::move(pBlockStatement);
+
+		// Act:
+		context.extractor().extract(blockElement);
+
+		// Assert:
+		EXPECT_EQ(0u, context.publisher().numPublishCalls());
+
+		// - only transactions 2 and 200 (1-based) reference unresolved addresses with resolutions at their primary ids
+		const auto& transactionElements = blockElement.Transactions;
+		EXPECT_EQ(
+				ToAddressSet(seedAddresses, { 2, 3 }, seedResolvedAddresses, { 0 }),
+				*transactionElements[1].OptionalExtractedAddresses);
+		EXPECT_EQ(
+				ToAddressSet(seedAddresses, { 398, 399 }, seedResolvedAddresses, { 3 }),
+				*transactionElements[199].OptionalExtractedAddresses);
+
+		for (auto i = 0u; i < Num_Large_Block_Transactions; ++i) {
+			if (1 == i || 199 == i)
+				continue;
+
+			EXPECT_EQ(ToAddressSet(seedAddresses, { 2 * i, 2 * i + 1 }), *transactionElements[i].OptionalExtractedAddresses) << i;
+		}
+	}
+
 	// endregion
 }}
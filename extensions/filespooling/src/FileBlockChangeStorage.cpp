@@ -25,6 +25,7 @@
 #include "bitxorcore/io/BlockStatementSerializer.h"
 #include "bitxorcore/io/PodIoUtils.h"
 #include "bitxorcore/subscribers/SubscriberOperationTypes.h"
+#include "bitxorcore/utils/TraceRecorder.h"
 
 namespace bitxorcore { namespace filespooling {
 
@@ -36,6 +37,7 @@ namespace bitxorcore { namespace filespooling {
 
 		public:
 			void notifyBlock(const model::BlockElement& blockElement) override {
+				utils::TraceSpan span("spooling", "spool block", blockElement.Block.Height, utils::ToShortHash(blockElement.EntityHash));
 				io::Write8(*m_pOutputStream, utils::to_underlying_type(subscribers::BlockChangeOperationType::Block));
 				io::WriteBlockElement(blockElement, *m_pOutputStream);
 				if (blockElement.OptionalStatement) {
@@ -27,6 +27,7 @@
 #include "finalization/src/io/AggregateProofStorage.h"
 #include "finalization/src/io/FilePrevoteChainStorage.h"
 #include "finalization/src/io/ProofStorageCache.h"
+#include "bitxorcore/crypto_voting/BmVerificationCache.h"
 #include "bitxorcore/extensions/ConfigurationUtils.h"
 #include "bitxorcore/extensions/ServiceLocator.h"
 #include "bitxorcore/extensions/ServiceState.h"
@@ -40,14 +41,19 @@ namespace bitxorcore { namespace finalization {
 		constexpr auto Storage_Service_Name = "fin.proof.storage";
 		constexpr auto Aggregator_Service_Name = "fin.aggregator.multiround";
 		constexpr auto Subscriber_Adapter_Service_Name = "fin.subscriber.adapter";
+		constexpr auto Verification_Cache_Service_Name = "fin.verification.cache";
+
+		// bound signatures are cached per voter, so this is sized to easily accommodate all voters and some message history
+		constexpr size_t Max_Verification_Cache_Entries_Per_Epoch = 20'000;
 
 		// region CreateMultiRoundMessageAggregator
 
 		auto CreateMultiRoundMessageAggregator(
 				const FinalizationConfiguration& config,
 				const io::ProofStorageCache& proofStorage,
+				const std::shared_ptr<crypto::BmVerificationCache>& pVerificationCache,
 				extensions::ServiceState& state) {
-			FinalizationContextFactory finalizationContextFactory(config, state);
+			FinalizationContextFactory finalizationContextFactory(config, state, pVerificationCache);
 
 			auto proofStorageView = proofStorage.view();
 			auto finalizationStatistics = proofStorageView.statistics();
@@ -197,7 +203,14 @@ namespace bitxorcore { namespace finalization {
 
 				locator.registerRootedService(Storage_Service_Name, pProofStorageCache);
 
-				auto pMultiRoundMessageAggregator = CreateMultiRoundMessageAggregator(m_config, *pProofStorageCache, state);
+				auto pVerificationCache = std::make_shared<crypto::BmVerificationCache>(Max_Verification_Cache_Entries_Per_Epoch);
+				locator.registerRootedService(Verification_Cache_Service_Name, pVerificationCache);
+
+				auto pMultiRoundMessageAggregator = CreateMultiRoundMessageAggregator(
+						m_config,
+						*pProofStorageCache,
+						pVerificationCache,
+						state);
 				locator.registerRootedService(Aggregator_Service_Name, pMultiRoundMessageAggregator);
 			}
 
@@ -251,4 +264,8 @@ namespace bitxorcore { namespace finalization {
 	io::ProofStorageCache& GetProofStorageCache(const extensions::ServiceLocator& locator) {
 		return *locator.service<io::ProofStorageCache>(Storage_Service_Name);
 	}
+
+	std::shared_ptr<crypto::BmVerificationCache> GetVerificationCache(const extensions::ServiceLocator& locator) {
+		return locator.service<crypto::BmVerificationCache>(Verification_Cache_Service_Name);
+	}
 }}
@@ -29,6 +29,7 @@
 
 namespace bitxorcore {
 	namespace chain { class MultiRoundMessageAggregator; }
+	namespace crypto { class BmVerificationCache; }
 	namespace finalization { struct FinalizationConfiguration; }
 	namespace io { class ProofStorageCache; }
 }
@@ -75,4 +76,7 @@ namespace bitxorcore { namespace finalization {
 
 	/// Gets the proof storage cache stored in \a locator.
 	io::ProofStorageCache& GetProofStorageCache(const extensions::ServiceLocator& locator);
+
+	/// Gets the (shared) voting signature verification cache stored in \a locator.
+	std::shared_ptr<crypto::BmVerificationCache> GetVerificationCache(const extensions::ServiceLocator& locator);
 }}
@@ -30,9 +30,17 @@
 namespace bitxorcore { namespace finalization {
 
 	FinalizationContextFactory::FinalizationContextFactory(const FinalizationConfiguration& config, const extensions::ServiceState& state)
+			: FinalizationContextFactory(config, state, nullptr)
+	{}
+
+	FinalizationContextFactory::FinalizationContextFactory(
+			const FinalizationConfiguration& config,
+			const extensions::ServiceState& state,
+			const std::shared_ptr<crypto::BmVerificationCache>& pVerificationCache)
 			: m_config(config)
 			, m_accountStateCache(state.cache().sub<cache::AccountStateCache>())
 			, m_blockStorage(state.storage())
+			, m_pVerificationCache(pVerificationCache)
 	{}
 
 	model::FinalizationContext FinalizationContextFactory::create(FinalizationEpoch epoch) const {
@@ -46,6 +54,6 @@ namespace bitxorcore { namespace finalization {
 
 		// when constructing FinalizationContext, to prevent possible deadlock, only have a single lock (to AccountStateCache) outstanding
 		auto accountStateCacheView = m_accountStateCache.createView();
-		return model::FinalizationContext(epoch, votingSetHeight, generationHash, m_config, *accountStateCacheView);
+		return model::FinalizationContext(epoch, votingSetHeight, generationHash, m_config, *accountStateCacheView, m_pVerificationCache);
 	}
 }}
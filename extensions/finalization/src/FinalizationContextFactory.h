@@ -39,6 +39,13 @@ namespace bitxorcore { namespace finalization {
 		/// Creates a factory given \a config and \a state.
 		FinalizationContextFactory(const FinalizationConfiguration& config, const extensions::ServiceState& state);
 
+		/// Creates a factory given \a config, \a state and a signature verification cache (\a pVerificationCache)
+		/// that is shared by all created contexts.
+		FinalizationContextFactory(
+				const FinalizationConfiguration& config,
+				const extensions::ServiceState& state,
+				const std::shared_ptr<crypto::BmVerificationCache>& pVerificationCache);
+
 	public:
 		/// Creates a finalization context for \a epoch.
 		model::FinalizationContext create(FinalizationEpoch epoch) const;
@@ -47,5 +54,6 @@ namespace bitxorcore { namespace finalization {
 		FinalizationConfiguration m_config;
 		const cache::AccountStateCache& m_accountStateCache;
 		const io::BlockStorageCache& m_blockStorage;
+		std::shared_ptr<crypto::BmVerificationCache> m_pVerificationCache;
 	};
 }}
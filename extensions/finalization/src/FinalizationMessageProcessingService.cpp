@@ -27,6 +27,8 @@
 #include "finalization/src/ionet/FinalizationMessagePacketUtils.h"
 #include "finalization/src/model/FinalizationRoundRange.h"
 #include "bitxorcore/consumers/RecentHashCache.h"
+#include "bitxorcore/crypto/SecureRandomGenerator.h"
+#include "bitxorcore/crypto_voting/BmVerificationCache.h"
 #include "bitxorcore/extensions/DispatcherUtils.h"
 #include "bitxorcore/extensions/ServiceState.h"
 #include "bitxorcore/extensions/ServiceUtils.h"
@@ -37,6 +39,7 @@ namespace bitxorcore { namespace finalization {
 
 	namespace {
 		using MessagesSink = consumer<const ionet::FinalizationMessages&>;
+		using MutableFinalizationMessages = std::vector<std::shared_ptr<model::FinalizationMessage>>;
 
 		constexpr auto Writers_Service_Name = "fin.writers";
 
@@ -49,6 +52,87 @@ namespace bitxorcore { namespace finalization {
 			return model::FinalizationRoundRange(view.minFinalizationRound(), view.maxFinalizationRound());
 		}
 
+		// region MessageProcessor
+
+		class MessageProcessor {
+		public:
+			MessageProcessor(
+					chain::MultiRoundMessageAggregator& messageAggregator,
+					thread::IoThreadPool& pool,
+					crypto::BmVerificationCache& verificationCache)
+					: m_messageAggregator(messageAggregator)
+					, m_pool(pool)
+					, m_verificationCache(verificationCache)
+			{}
+
+		public:
+			void process(const MutableFinalizationMessages& messages) {
+				// messages with verified bindings are from eligible voters and can be safely batch verified
+				MutableFinalizationMessages batchMessages;
+				for (const auto& pMessage : messages) {
+					if (hasVerifiedBinding(*pMessage)) {
+						batchMessages.push_back(pMessage);
+						continue;
+					}
+
+					m_pool.ioContext().dispatch([&messageAggregator = m_messageAggregator, pMessage]() {
+						AddMessage(messageAggregator, pMessage);
+					});
+				}
+
+				if (!batchMessages.empty())
+					dispatchBatches(batchMessages);
+			}
+
+		private:
+			bool hasVerifiedBinding(const model::FinalizationMessage& message) const {
+				return m_verificationCache.containsBinding(
+						message.Signature.Root.ParentPublicKey,
+						message.Signature.Bottom.ParentPublicKey,
+						model::StepIdentifierToBmKeyIdentifier(message.StepIdentifier));
+			}
+
+			void dispatchBatches(const MutableFinalizationMessages& messages) {
+				// split messages into one batch per worker thread;
+				// verification results are stored in the cache and subsequently reused by the message aggregator
+				auto numBatches = std::min<size_t>(m_pool.numWorkerThreads(), messages.size());
+				auto batchSize = (messages.size() + numBatches - 1) / numBatches;
+				for (size_t i = 0; i < messages.size(); i += batchSize) {
+					auto batchBegin = messages.cbegin() + static_cast<std::ptrdiff_t>(i);
+					auto batchEnd = messages.cbegin() + static_cast<std::ptrdiff_t>(std::min(i + batchSize, messages.size()));
+					m_pool.ioContext().dispatch([
+							&messageAggregator = m_messageAggregator,
+							&verificationCache = m_verificationCache,
+							batchMessages = MutableFinalizationMessages(batchBegin, batchEnd)]() {
+						auto randomFiller = [](auto* pOut, auto count) {
+							crypto::SecureRandomGenerator().fill(pOut, count);
+						};
+						model::VerifyMessageSignatures(batchMessages.data(), batchMessages.size(), randomFiller, verificationCache);
+
+						for (const auto& pMessage : batchMessages)
+							AddMessage(messageAggregator, pMessage);
+					});
+				}
+			}
+
+			static void AddMessage(
+					chain::MultiRoundMessageAggregator& messageAggregator,
+					const std::shared_ptr<model::FinalizationMessage>& pMessage) {
+				auto addResult = messageAggregator.modifier().add(pMessage);
+				if (addResult < chain::RoundMessageAggregatorAddResult::Neutral_Redundant) {
+					BITXORCORE_LOG(warning)
+							<< "finalization message " << model::CalculateMessageHash(*pMessage) << " rejected due to " << addResult;
+				}
+			}
+
+		private:
+			chain::MultiRoundMessageAggregator& m_messageAggregator;
+			thread::IoThreadPool& m_pool;
+			crypto::BmVerificationCache& m_verificationCache;
+		};
+
+		// endregion
+
 		class FinalizationMessageProcessingServiceRegistrar : public extensions::ServiceRegistrar {
 		public:
 			explicit FinalizationMessageProcessingServiceRegistrar(const FinalizationConfiguration& config) : m_config(config)
@@ -66,6 +150,10 @@ namespace bitxorcore { namespace finalization {
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
 				auto& messageAggregator = GetMultiRoundMessageAggregator(locator);
 				auto& messageProcessingPool = *state.pool().pushIsolatedPool("messageProcessing");
+				auto pMessageProcessor = std::make_shared<MessageProcessor>(
+						messageAggregator,
+						messageProcessingPool,
+						*GetVerificationCache(locator));
 
 				// register hooks
 				auto pRecentHashCache = std::make_shared<consumers::SynchronizedRecentHashCache>(
@@ -74,12 +162,12 @@ namespace bitxorcore { namespace finalization {
 
 				auto messagesSink = CreateNewMessagesSink(locator);
 				auto& hooks = GetFinalizationServerHooks(locator);
-				hooks.setMessageRangeConsumer([&messageAggregator, &messageProcessingPool, pRecentHashCache, messagesSink](
-						auto&& messages) {
+				hooks.setMessageRangeConsumer([&messageAggregator, pMessageProcessor, pRecentHashCache, messagesSink](auto&& messages) {
 					auto newMessages = ionet::FinalizationMessages();
 					auto extractedMessages = model::FinalizationMessageRange::ExtractEntitiesFromRange(std::move(messages.Range));
 					BITXORCORE_LOG(trace) << "received " << extractedMessages.size() << " messages from peer " << messages.SourceIdentity;
 
+					auto acceptedMessages = MutableFinalizationMessages();
 					auto roundRange = CreateFinalizationRoundRange(messageAggregator);
 					for (const auto& pMessage : extractedMessages) {
 						// ignore messages associated with an out of range finalization round
@@ -95,14 +183,12 @@ namespace bitxorcore { namespace finalization {
 						if (!pRecentHashCache->add(messageHash))
 							continue;
 
-						messageProcessingPool.ioContext().dispatch([&messageAggregator, pMessage, messageHash]() {
-							auto addResult = messageAggregator.modifier().add(pMessage);
-							if (addResult < chain::RoundMessageAggregatorAddResult::Neutral_Redundant)
-								BITXORCORE_LOG(warning) << "finalization message " << messageHash << " rejected due to " << addResult;
-						});
+						acceptedMessages.push_back(pMessage);
 						newMessages.push_back(pMessage);
 					}
 
+					pMessageProcessor->process(acceptedMessages);
+
 					if (!newMessages.empty())
 						messagesSink(newMessages);
 				});
@@ -103,15 +103,17 @@ namespace bitxorcore { namespace finalization {
 				const FinalizationConfiguration& config,
 				extensions::ServiceLocator& locator,
 				const extensions::ServiceState& state,
-				net::PacketWriters& packetWriters) {
-			FinalizationContextFactory finalizationContextFactory(config, state);
+				net::PacketWriters& packetWriters,
+				thread::IoThreadPool& proofVerificationPool) {
+			FinalizationContextFactory finalizationContextFactory(config, state, GetVerificationCache(locator));
 			auto finalizationProofSynchronizer = chain::CreateFinalizationProofSynchronizer(
 					state.config().Blockchain.VotingSetGrouping,
 					config.UnfinalizedBlocksDuration.blocks(state.config().Blockchain.BlockGenerationTargetTime),
 					state.storage(),
 					GetProofStorageCache(locator),
-					[finalizationContextFactory](const auto& proof) {
-						auto result = chain::VerifyFinalizationProof(proof, finalizationContextFactory.create(proof.Round.Epoch));
+					[finalizationContextFactory, &proofVerificationPool](const auto& proof) {
+						auto finalizationContext = finalizationContextFactory.create(proof.Round.Epoch);
+						auto result = chain::VerifyFinalizationProof(proof, finalizationContext, proofVerificationPool);
 						if (chain::VerifyFinalizationProofResult::Success != result) {
 							BITXORCORE_LOG(warning)
 									<< "proof for round " << proof.Round << " at height " << proof.Height
@@ -164,7 +166,8 @@ namespace bitxorcore { namespace finalization {
 
 				// add tasks
 				state.tasks().push_back(CreateConnectPeersTask(state, *pWriters));
-				state.tasks().push_back(CreatePullProofTask(m_config, locator, state, *pWriters));
+				auto& proofVerificationPool = *state.pool().pushIsolatedPool("proofVerification");
+				state.tasks().push_back(CreatePullProofTask(m_config, locator, state, *pWriters, proofVerificationPool));
 
 				if (m_config.EnableVoting)
 					state.tasks().push_back(CreatePullMessagesTask(locator, state, *pWriters));
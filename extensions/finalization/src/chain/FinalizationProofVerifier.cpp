@@ -26,6 +26,9 @@
 #include "finalization/src/model/FinalizationContext.h"
 #include "finalization/src/model/FinalizationMessage.h"
 #include "finalization/src/model/FinalizationProof.h"
+#include "bitxorcore/crypto/SecureRandomGenerator.h"
+#include "bitxorcore/thread/IoThreadPool.h"
+#include "bitxorcore/thread/ParallelFor.h"
 #include "bitxorcore/utils/MacroBasedEnumIncludes.h"
 
 namespace bitxorcore { namespace chain {
@@ -37,6 +40,9 @@ namespace bitxorcore { namespace chain {
 #undef DEFINE_ENUM
 
 	namespace {
+		using FinalizationMessages = std::vector<std::shared_ptr<model::FinalizationMessage>>;
+		using MessagesVerifier = consumer<const FinalizationMessages&>;
+
 		std::shared_ptr<model::FinalizationMessage> CreateTemplateMessage(
 				const model::FinalizationRound& round,
 				const model::FinalizationMessageGroup& messageGroup) {
@@ -54,40 +60,97 @@ namespace bitxorcore { namespace chain {
 			std::memcpy(reinterpret_cast<void*>(pMessage->HashesPtr()), messageGroup.HashesPtr(), hashesPayloadSize);
 			return pMessage;
 		}
-	}
 
-	VerifyFinalizationProofResult VerifyFinalizationProof(
-			const model::FinalizationProof& proof,
-			const model::FinalizationContext& context) {
-		if (model::FinalizationProofHeader::Current_Version != proof.Version)
-			return VerifyFinalizationProofResult::Failure_Invalid_Version;
-
-		if (proof.Round.Epoch != context.epoch())
-			return VerifyFinalizationProofResult::Failure_Invalid_Epoch;
-
-		auto pMessageAggregator = CreateRoundMessageAggregator(context);
-		for (const auto& messageGroup : proof.MessageGroups()) {
-			auto pTemplateMessage = CreateTemplateMessage(proof.Round, messageGroup);
-			for (auto i = 0u; i < messageGroup.SignaturesCount; ++i) {
-				pTemplateMessage->Signature = messageGroup.SignaturesPtr()[i];
-				auto addResult = pMessageAggregator->add(pTemplateMessage);
+		FinalizationMessages ExtractMessages(const model::FinalizationProof& proof) {
+			FinalizationMessages messages;
+			for (const auto& messageGroup : proof.MessageGroups()) {
+				auto pTemplateMessage = CreateTemplateMessage(proof.Round, messageGroup);
+				for (auto i = 0u; i < messageGroup.SignaturesCount; ++i) {
+					auto pMessage = utils::MakeSharedWithSize<model::FinalizationMessage>(pTemplateMessage->Size);
+					std::memcpy(static_cast<void*>(pMessage.get()), pTemplateMessage.get(), pTemplateMessage->Size);
+					pMessage->Signature = messageGroup.SignaturesPtr()[i];
+					messages.push_back(pMessage);
+				}
+			}
+
+			return messages;
+		}
+
+		VerifyFinalizationProofResult VerifyFinalizationProof(
+				const model::FinalizationProof& proof,
+				const model::FinalizationContext& context,
+				const MessagesVerifier& messagesVerifier) {
+			if (model::FinalizationProofHeader::Current_Version != proof.Version)
+				return VerifyFinalizationProofResult::Failure_Invalid_Version;
+
+			if (proof.Round.Epoch != context.epoch())
+				return VerifyFinalizationProofResult::Failure_Invalid_Epoch;
+
+			auto messages = ExtractMessages(proof);
+			messagesVerifier(messages);
+
+			auto pMessageAggregator = CreateRoundMessageAggregator(context);
+			for (const auto& pMessage : messages) {
+				auto addResult = pMessageAggregator->add(pMessage);
 				if (addResult <= chain::RoundMessageAggregatorAddResult::Neutral_Redundant) {
 					BITXORCORE_LOG(warning) << "finalization message for proof " << proof.Hash << " rejected due to " << addResult;
 					return VerifyFinalizationProofResult::Failure_Invalid_Messsage;
 				}
 			}
+
+			auto bestPrecommitResultPair = pMessageAggregator->roundContext().tryFindBestPrecommit();
+			if (!bestPrecommitResultPair.second)
+				return VerifyFinalizationProofResult::Failure_No_Precommit;
+
+			if (bestPrecommitResultPair.first.Height != proof.Height)
+				return VerifyFinalizationProofResult::Failure_Invalid_Height;
+
+			if (bestPrecommitResultPair.first.Hash != proof.Hash)
+				return VerifyFinalizationProofResult::Failure_Invalid_Hash;
+
+			return VerifyFinalizationProofResult::Success;
 		}
 
-		auto bestPrecommitResultPair = pMessageAggregator->roundContext().tryFindBestPrecommit();
-		if (!bestPrecommitResultPair.second)
-			return VerifyFinalizationProofResult::Failure_No_Precommit;
+		void BatchVerifyMessageSignatures(
+				const FinalizationMessages& messages,
+				const model::FinalizationContext& context,
+				thread::IoThreadPool& pool) {
+			auto* pVerificationCache = context.verificationCache();
+			if (!pVerificationCache)
+				return;
 
-		if (bestPrecommitResultPair.first.Height != proof.Height)
-			return VerifyFinalizationProofResult::Failure_Invalid_Height;
+			// only verify messages from eligible voters because all verified bindings are cached
+			FinalizationMessages eligibleMessages;
+			for (const auto& pMessage : messages) {
+				if (context.isEligibleVoter(pMessage->Signature.Root.ParentPublicKey))
+					eligibleMessages.push_back(pMessage);
+			}
+
+			// verification results are stored in the cache and subsequently reused by the message aggregator
+			auto randomFiller = [](auto* pOut, auto count) {
+				crypto::SecureRandomGenerator().fill(pOut, count);
+			};
+			auto partitionCallback = [&randomFiller, &verificationCache = *pVerificationCache](auto itBegin, auto itEnd, auto, auto) {
+				auto count = static_cast<size_t>(std::distance(itBegin, itEnd));
+				model::VerifyMessageSignatures(&*itBegin, count, randomFiller, verificationCache);
+			};
+
+			thread::ParallelForPartition(pool.ioContext(), eligibleMessages, pool.numWorkerThreads(), partitionCallback).get();
+		}
+	}
 
-		if (bestPrecommitResultPair.first.Hash != proof.Hash)
-			return VerifyFinalizationProofResult::Failure_Invalid_Hash;
+	VerifyFinalizationProofResult VerifyFinalizationProof(
+			const model::FinalizationProof& proof,
+			const model::FinalizationContext& context) {
+		return VerifyFinalizationProof(proof, context, [](const auto&) {});
+	}
 
-		return VerifyFinalizationProofResult::Success;
+	VerifyFinalizationProofResult VerifyFinalizationProof(
+			const model::FinalizationProof& proof,
+			const model::FinalizationContext& context,
+			thread::IoThreadPool& pool) {
+		return VerifyFinalizationProof(proof, context, [&context, &pool](const auto& messages) {
+			BatchVerifyMessageSignatures(messages, context, pool);
+		});
 	}
 }}
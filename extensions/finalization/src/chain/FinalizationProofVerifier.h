@@ -28,6 +28,7 @@ namespace bitxorcore {
 		class FinalizationContext;
 		struct FinalizationProof;
 	}
+	namespace thread { class IoThreadPool; }
 }
 
 namespace bitxorcore { namespace chain {
@@ -72,4 +73,11 @@ namespace bitxorcore { namespace chain {
 	VerifyFinalizationProofResult VerifyFinalizationProof(
 			const model::FinalizationProof& proof,
 			const model::FinalizationContext& context);
+
+	/// Verifies \a proof given \a context using \a pool to batch verify all message signatures up front.
+	/// \note Batch verification is only performed when \a context has a verification cache.
+	VerifyFinalizationProofResult VerifyFinalizationProof(
+			const model::FinalizationProof& proof,
+			const model::FinalizationContext& context,
+			thread::IoThreadPool& pool);
 }}
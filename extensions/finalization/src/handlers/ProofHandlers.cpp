@@ -96,12 +96,14 @@ namespace bitxorcore { namespace handlers {
 	void RegisterFinalizationProofAtEpochHandler(ionet::ServerPacketHandlers& handlers, const io::ProofStorageCache& proofStorage) {
 		handlers.registerHandler(
 				ionet::PacketType::Finalization_Proof_At_Epoch,
-				CreateFinalizationProofHandler<ProofAtEpochTraits>(proofStorage));
+				CreateFinalizationProofHandler<ProofAtEpochTraits>(proofStorage),
+				ionet::PacketHandlerCost::Heavy);
 	}
 
 	void RegisterFinalizationProofAtHeightHandler(ionet::ServerPacketHandlers& handlers, const io::ProofStorageCache& proofStorage) {
 		handlers.registerHandler(
 				ionet::PacketType::Finalization_Proof_At_Height,
-				CreateFinalizationProofHandler<ProofAtHeightTraits>(proofStorage));
+				CreateFinalizationProofHandler<ProofAtHeightTraits>(proofStorage),
+				ionet::PacketHandlerCost::Heavy);
 	}
 }}
@@ -37,10 +37,21 @@ namespace bitxorcore { namespace model {
 			const GenerationHash& generationHash,
 			const finalization::FinalizationConfiguration& config,
 			const cache::AccountStateCacheView& accountStateCacheView)
+			: FinalizationContext(epoch, height, generationHash, config, accountStateCacheView, nullptr)
+	{}
+
+	FinalizationContext::FinalizationContext(
+			FinalizationEpoch epoch,
+			Height height,
+			const GenerationHash& generationHash,
+			const finalization::FinalizationConfiguration& config,
+			const cache::AccountStateCacheView& accountStateCacheView,
+			const std::shared_ptr<crypto::BmVerificationCache>& pVerificationCache)
 			: m_epoch(epoch)
 			, m_height(height)
 			, m_generationHash(generationHash)
-			, m_config(config) {
+			, m_config(config)
+			, m_pVerificationCache(pVerificationCache) {
 		const auto& highValueAccounts = accountStateCacheView.highValueAccounts();
 		for (const auto& accountHistoryPair : highValueAccounts.accountHistories()) {
 			const auto& accountHistory = accountHistoryPair.second;
@@ -96,4 +107,8 @@ namespace bitxorcore { namespace model {
 		auto iter = m_accounts.find(votingPublicKey);
 		return m_accounts.cend() == iter ? FinalizationAccountView() : iter->second;
 	}
+
+	crypto::BmVerificationCache* FinalizationContext::verificationCache() const {
+		return m_pVerificationCache.get();
+	}
 }}
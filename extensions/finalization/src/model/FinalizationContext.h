@@ -24,9 +24,13 @@
 #include "finalization/src/FinalizationConfiguration.h"
 #include "bitxorcore/utils/Hashers.h"
 #include "bitxorcore/types.h"
+#include <memory>
 #include <unordered_map>
 
-namespace bitxorcore { namespace cache { class AccountStateCacheView; } }
+namespace bitxorcore {
+	namespace cache { class AccountStateCacheView; }
+	namespace crypto { class BmVerificationCache; }
+}
 
 namespace bitxorcore { namespace model {
 
@@ -48,6 +52,17 @@ namespace bitxorcore { namespace model {
 				const finalization::FinalizationConfiguration& config,
 				const cache::AccountStateCacheView& accountStateCacheView);
 
+		/// Creates a finalization context from \a config, \a accountStateCacheView, information about the last finalized block
+		/// (\a height and \a generationHash), the finalization \a epoch that is currently being finalized
+		/// and a (shared) signature verification cache (\a pVerificationCache).
+		FinalizationContext(
+				FinalizationEpoch epoch,
+				Height height,
+				const GenerationHash& generationHash,
+				const finalization::FinalizationConfiguration& config,
+				const cache::AccountStateCacheView& accountStateCacheView,
+				const std::shared_ptr<crypto::BmVerificationCache>& pVerificationCache);
+
 	public:
 		/// Gets the finalization epoch.
 		FinalizationEpoch epoch() const;
@@ -70,6 +85,9 @@ namespace bitxorcore { namespace model {
 		/// Gets the finalization account view associated with \a votingPublicKey.
 		FinalizationAccountView lookup(const VotingKey& votingPublicKey) const;
 
+		/// Gets the signature verification cache, if any.
+		crypto::BmVerificationCache* verificationCache() const;
+
 	private:
 		FinalizationEpoch m_epoch;
 		Height m_height;
@@ -77,5 +95,6 @@ namespace bitxorcore { namespace model {
 		finalization::FinalizationConfiguration m_config;
 		Amount m_weight;
 		std::unordered_map<VotingKey, FinalizationAccountView, utils::ArrayHasher<VotingKey>> m_accounts;
+		std::shared_ptr<crypto::BmVerificationCache> m_pVerificationCache;
 	};
 }}
@@ -24,6 +24,7 @@
 #include "FinalizationContext.h"
 #include "bitxorcore/crypto/Hashes.h"
 #include "bitxorcore/crypto_voting/AggregateBmPrivateKeyTree.h"
+#include "bitxorcore/crypto_voting/BmPrivateKeyTree.h"
 #include "bitxorcore/utils/MacroBasedEnumIncludes.h"
 #include "bitxorcore/utils/MemoryUtils.h"
 
@@ -105,9 +106,28 @@ namespace bitxorcore { namespace model {
 			return std::make_pair(ProcessMessageResult::Failure_Version, 0);
 
 		auto keyIdentifier = StepIdentifierToBmKeyIdentifier(message.StepIdentifier);
-		if (!crypto::Verify(message.Signature, keyIdentifier, ToBuffer(message)))
+		auto* pVerificationCache = context.verificationCache();
+		auto isVerified = pVerificationCache
+				? crypto::Verify(message.Signature, keyIdentifier, ToBuffer(message), *pVerificationCache)
+				: crypto::Verify(message.Signature, keyIdentifier, ToBuffer(message));
+		if (!isVerified)
 			return std::make_pair(ProcessMessageResult::Failure_Signature, 0);
 
 		return std::make_pair(ProcessMessageResult::Success, accountView.Weight.unwrap());
 	}
+
+	std::vector<bool> VerifyMessageSignatures(
+			const std::shared_ptr<FinalizationMessage>* pMessages,
+			size_t count,
+			const crypto::RandomFiller& randomFiller,
+			crypto::BmVerificationCache& verificationCache) {
+		std::vector<crypto::BmTreeSignatureInput> signatureInputs;
+		signatureInputs.reserve(count);
+		for (auto i = 0u; i < count; ++i) {
+			const auto& message = *pMessages[i];
+			signatureInputs.push_back({ message.Signature, StepIdentifierToBmKeyIdentifier(message.StepIdentifier), ToBuffer(message) });
+		}
+
+		return crypto::VerifyMulti(randomFiller, signatureInputs.data(), signatureInputs.size(), verificationCache);
+	}
 }}
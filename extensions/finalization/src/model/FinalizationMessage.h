@@ -22,12 +22,16 @@
 
 #pragma once
 #include "StepIdentifier.h"
+#include "bitxorcore/crypto/Signer.h"
 #include "bitxorcore/crypto_voting/BmTreeSignature.h"
 #include "bitxorcore/model/RangeTypes.h"
 #include "bitxorcore/model/TrailingVariableDataLayout.h"
 
 namespace bitxorcore {
-	namespace crypto { class AggregateBmPrivateKeyTree; }
+	namespace crypto {
+		class AggregateBmPrivateKeyTree;
+		class BmVerificationCache;
+	}
 	namespace model { class FinalizationContext; }
 }
 
@@ -134,5 +138,15 @@ namespace bitxorcore { namespace model {
 	/// Processes a finalization \a message using \a context.
 	std::pair<ProcessMessageResult, size_t> ProcessMessage(const FinalizationMessage& message, const FinalizationContext& context);
 
+	/// Batch verifies the signatures of the \a count messages pointed to by \a pMessages using \a randomFiller
+	/// and adds all verified signature components to \a verificationCache.
+	/// Returns the verification result for each individual message.
+	/// \note None of the other ProcessMessage checks are performed, so callers are expected to only pass messages from eligible voters.
+	std::vector<bool> VerifyMessageSignatures(
+			const std::shared_ptr<FinalizationMessage>* pMessages,
+			size_t count,
+			const crypto::RandomFiller& randomFiller,
+			crypto::BmVerificationCache& verificationCache);
+
 	// endregion
 }}
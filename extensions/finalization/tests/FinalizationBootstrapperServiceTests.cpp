@@ -27,6 +27,7 @@
 #include "finalization/src/model/FinalizationProofUtils.h"
 #include "finalization/tests/test/FinalizationBootstrapperServiceTestUtils.h"
 #include "finalization/tests/test/mocks/MockProofStorage.h"
+#include "bitxorcore/crypto_voting/BmVerificationCache.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/local/ServiceTestUtils.h"
 #include "tests/test/nodeps/Filesystem.h"
@@ -224,6 +225,23 @@ namespace bitxorcore { namespace finalization {
 		GetProofStorageCache(context.locator());
 	}
 
+	TEST(TEST_CLASS, VerificationCacheServiceIsRegistered) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		context.boot();
+
+		// Assert:
+		EXPECT_EQ(Num_Services, context.locator().numServices());
+
+		// - service
+		auto pVerificationCache = GetVerificationCache(context.locator());
+		ASSERT_TRUE(!!pVerificationCache);
+		EXPECT_EQ(0u, pVerificationCache->numBindings());
+		EXPECT_EQ(0u, pVerificationCache->numSignatures());
+	}
+
 	// endregion
 
 	// region FinalizationBootstrapperService - hooks
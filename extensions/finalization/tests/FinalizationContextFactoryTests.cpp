@@ -22,6 +22,7 @@
 
 #include "finalization/src/FinalizationContextFactory.h"
 #include "bitxorcore/cache_core/AccountStateCache.h"
+#include "bitxorcore/crypto_voting/BmVerificationCache.h"
 #include "finalization/tests/test/FinalizationMessageTestUtils.h"
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/local/ServiceLocatorTestContext.h"
@@ -52,7 +53,10 @@ namespace bitxorcore { namespace finalization {
 			EXPECT_THROW(factory.create(epoch), bitxorcore_invalid_argument);
 		}
 
-		void AssertCanCreateFinalizationContext(FinalizationEpoch epoch, Height groupedHeight) {
+		void AssertCanCreateFinalizationContext(
+				FinalizationEpoch epoch,
+				Height groupedHeight,
+				const std::shared_ptr<crypto::BmVerificationCache>& pVerificationCache) {
 			// Arrange: setup config
 			auto config = finalization::FinalizationConfiguration::Uninitialized();
 			config.Size = 9876;
@@ -82,7 +86,7 @@ namespace bitxorcore { namespace finalization {
 			mocks::SeedStorageWithFixedSizeBlocks(testState.state().storage(), static_cast<uint32_t>(groupedHeight.unwrap()));
 
 			// Act:
-			FinalizationContextFactory factory(config, testState.state());
+			FinalizationContextFactory factory(config, testState.state(), pVerificationCache);
 			auto context = factory.create(epoch);
 
 			// Assert: context should be seeded with data from groupedHeight, not height
@@ -93,6 +97,11 @@ namespace bitxorcore { namespace finalization {
 			EXPECT_EQ(expectedGenerationHash, context.generationHash());
 			EXPECT_EQ(9876u, context.config().Size);
 			EXPECT_EQ(Amount(15'000'000), context.weight());
+			EXPECT_EQ(pVerificationCache.get(), context.verificationCache());
+		}
+
+		void AssertCanCreateFinalizationContext(FinalizationEpoch epoch, Height groupedHeight) {
+			AssertCanCreateFinalizationContext(epoch, groupedHeight, nullptr);
 		}
 	}
 
@@ -109,4 +118,8 @@ namespace bitxorcore { namespace finalization {
 		AssertCanCreateFinalizationContext(FinalizationEpoch(3), Height(50));
 		AssertCanCreateFinalizationContext(FinalizationEpoch(9), Height(350));
 	}
+
+	TEST(TEST_CLASS, CanCreateFinalizationContextWithVerificationCache) {
+		AssertCanCreateFinalizationContext(FinalizationEpoch(3), Height(50), std::make_shared<crypto::BmVerificationCache>(10));
+	}
 }}
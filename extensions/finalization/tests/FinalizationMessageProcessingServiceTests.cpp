@@ -27,6 +27,7 @@
 #include "bitxorcore/utils/MemoryUtils.h"
 #include "finalization/tests/test/FinalizationBootstrapperServiceTestUtils.h"
 #include "finalization/tests/test/mocks/MockProofStorage.h"
+#include "bitxorcore/crypto_voting/BmVerificationCache.h"
 #include "tests/test/core/PacketPayloadTestUtils.h"
 #include "tests/test/local/ServiceTestUtils.h"
 #include "tests/test/net/mocks/MockPacketWriters.h"
@@ -344,4 +345,87 @@ namespace bitxorcore { namespace finalization {
 	}
 
 	// endregion
+
+	// region message processing - verification cache
+
+	namespace {
+		template<typename TAction>
+		void RunVerifiedBindingTest(TAction action) {
+			// Arrange:
+			TestContext context(FinalizationPoint(8));
+			context.boot();
+
+			const auto& hooks = GetFinalizationServerHooks(context.locator());
+			auto& aggregator = GetMultiRoundMessageAggregator(context.locator());
+			aggregator.modifier().setMaxFinalizationRound({ Finalization_Epoch, FinalizationPoint(12) });
+			const auto& verificationCache = *GetVerificationCache(context.locator());
+
+			// - process a message so that the voter binding is verified and cached
+			const auto& hash = test::GenerateRandomByteArray<Hash256>();
+			auto pMessage = context.createMessage(VoterType::Large1, CreateStepIdentifier(8), Height(5), hash);
+			hooks.messageRangeConsumer()(CreateMessageRange({ pMessage }));
+			WAIT_FOR_ONE_EXPR(aggregator.view().size());
+
+			// Sanity:
+			EXPECT_EQ(1u, verificationCache.numBindings());
+			EXPECT_EQ(1u, verificationCache.numSignatures());
+
+			// Act + Assert:
+			action(context, hooks, aggregator, verificationCache, hash);
+		}
+	}
+
+	TEST(TEST_CLASS, MessagesFromVoterWithVerifiedBindingAreBatchVerifiedAndAddedToAggregator) {
+		// Arrange:
+		RunVerifiedBindingTest([](
+				auto& context,
+				const auto& hooks,
+				const auto& aggregator,
+				const auto& verificationCache,
+				const auto& hash) {
+			auto pMessage1 = context.createMessage(VoterType::Large1, CreateStepIdentifier(11), Height(8), hash);
+			auto pMessage2 = context.createMessage(VoterType::Large1, CreateStepIdentifier(10), Height(7), hash);
+			auto pMessage3 = context.createMessage(VoterType::Large1, CreateStepIdentifier(9), Height(6), hash);
+
+			// Act:
+			hooks.messageRangeConsumer()(CreateMessageRange({ pMessage1, pMessage2, pMessage3 }));
+
+			// - wait for the aggregator
+			WAIT_FOR_VALUE_EXPR(4u, aggregator.view().size());
+
+			// Assert: the cached binding was reused
+			EXPECT_EQ(4u, aggregator.view().size());
+			EXPECT_EQ(1u, verificationCache.numBindings());
+			EXPECT_EQ(4u, verificationCache.numSignatures());
+		});
+	}
+
+	TEST(TEST_CLASS, MessagesWithInvalidSignaturesFromVoterWithVerifiedBindingAreNotAddedToAggregator) {
+		// Arrange:
+		RunVerifiedBindingTest([](
+				auto& context,
+				const auto& hooks,
+				const auto& aggregator,
+				const auto& verificationCache,
+				const auto& hash) {
+			auto pMessage1 = context.createMessage(VoterType::Large1, CreateStepIdentifier(11), Height(8), hash);
+			auto pMessage2 = context.createMessage(VoterType::Large1, CreateStepIdentifier(10), Height(7), hash);
+			pMessage1->Height = Height(9);
+
+			// Act:
+			hooks.messageRangeConsumer()(CreateMessageRange({ pMessage1, pMessage2 }));
+
+			// - wait for the aggregator and the broadcast
+			WAIT_FOR_VALUE_EXPR(2u, aggregator.view().size());
+			WAIT_FOR_VALUE_EXPR(2u, context.numBroadcastCalls());
+			test::Pause();
+
+			// Assert: only the valid message was added
+			EXPECT_EQ(2u, aggregator.view().size());
+			EXPECT_EQ(1u, verificationCache.numBindings());
+			EXPECT_EQ(2u, verificationCache.numSignatures());
+		});
+	}
+
+	// endregion
 }}
@@ -23,6 +23,9 @@
 #include "finalization/src/chain/FinalizationProofVerifier.h"
 #include "finalization/src/model/FinalizationProofUtils.h"
 #include "finalization/tests/test/FinalizationMessageTestUtils.h"
+#include "bitxorcore/crypto_voting/BmVerificationCache.h"
+#include "bitxorcore/thread/IoThreadPool.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace bitxorcore { namespace chain {
@@ -34,11 +37,37 @@ namespace bitxorcore { namespace chain {
 		constexpr auto Finalization_Point = FinalizationPoint(3);
 		constexpr auto Last_Finalized_Height = Height(123);
 
+		// region traits
+
+		struct SerialTraits {
+			static std::shared_ptr<crypto::BmVerificationCache> CreateVerificationCache() {
+				return nullptr;
+			}
+
+			static auto Verify(const model::FinalizationProof& proof, const model::FinalizationContext& context) {
+				return VerifyFinalizationProof(proof, context);
+			}
+		};
+
+		struct BatchTraits {
+			static std::shared_ptr<crypto::BmVerificationCache> CreateVerificationCache() {
+				return std::make_shared<crypto::BmVerificationCache>(100);
+			}
+
+			static auto Verify(const model::FinalizationProof& proof, const model::FinalizationContext& context) {
+				auto pPool = test::CreateStartedIoThreadPool(2);
+				return VerifyFinalizationProof(proof, context, *pPool);
+			}
+		};
+
+		// endregion
+
 		// region TestContext
 
+		template<typename TTraits>
 		class TestContext {
 		public:
-			TestContext() {
+			TestContext() : m_pVerificationCache(TTraits::CreateVerificationCache()) {
 				auto config = finalization::FinalizationConfiguration::Uninitialized();
 				config.Size = 1000;
 				config.Threshold = 700;
@@ -49,7 +78,7 @@ namespace bitxorcore { namespace chain {
 				auto finalizationContextPair = test::CreateFinalizationContext(config, Finalization_Epoch, Last_Finalized_Height, {
 					Amount(4'000'000), Amount(2'000'000), Amount(1'000'000), Amount(2'000'000), Amount(3'000'000), Amount(4'000'000),
 					Amount(1'000'000), Amount(1'000'000), Amount(1'000'000), Amount(1'000'000)
-				});
+				}, m_pVerificationCache);
 
 				m_pFinalizationContext = std::make_unique<model::FinalizationContext>(std::move(finalizationContextPair.first));
 				m_keyPairDescriptors = std::move(finalizationContextPair.second);
@@ -57,7 +86,11 @@ namespace bitxorcore { namespace chain {
 
 		public:
 			auto verify(const model::FinalizationProof& proof) const {
-				return VerifyFinalizationProof(proof, *m_pFinalizationContext);
+				return TTraits::Verify(proof, *m_pFinalizationContext);
+			}
+
+			const auto& verificationCache() const {
+				return *m_pVerificationCache;
 			}
 
 		public:
@@ -69,6 +102,7 @@ namespace bitxorcore { namespace chain {
 			}
 
 		private:
+			std::shared_ptr<crypto::BmVerificationCache> m_pVerificationCache;
 			std::unique_ptr<model::FinalizationContext> m_pFinalizationContext;
 			std::vector<test::AccountKeyPairDescriptor> m_keyPairDescriptors;
 		};
@@ -108,7 +142,7 @@ namespace bitxorcore { namespace chain {
 
 		// region RunTest
 
-		template<typename TAction>
+		template<typename TTraits, typename TAction>
 		void RunTest(TAction action) {
 			// Arrange: only setup a prevote on the first 6/7 hashes
 			auto prevoteHashes = test::GenerateRandomDataVector<Hash256>(7);
@@ -123,7 +157,7 @@ namespace bitxorcore { namespace chain {
 
 			// - sign prevotes with weights { 4M, 2M, 3M, 4M } (13M) > 15M * 0.7 (10.5M)
 			// - sign precommits with weights { 2M, 2M, 4M, 3M } (11M) > 15M * 0.7 (10.5M)
-			TestContext context;
+			TestContext<TTraits> context;
 			context.signAllMessages(prevoteMessages, { 5, 1, 4, 0 });
 			context.signAllMessages(precommitMessages, { 3, 1, 0, 4 });
 
@@ -131,10 +165,10 @@ namespace bitxorcore { namespace chain {
 			action(context, prevoteHashes, prevoteMessages, precommitMessages);
 		}
 
-		template<typename TModifier>
+		template<typename TTraits, typename TModifier>
 		void RunModifiedStatisticsTest(VerifyFinalizationProofResult expectedResult, TModifier modifyStatistics) {
 			// Arrange:
-			RunTest([expectedResult, modifyStatistics](
+			RunTest<TTraits>([expectedResult, modifyStatistics](
 					const auto& context,
 					const auto& prevoteHashes,
 					const auto& prevoteMessages,
@@ -154,11 +188,17 @@ namespace bitxorcore { namespace chain {
 		// endregion
 	}
 
+#define VERIFIER_TRAITS_BASED_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Serial) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<SerialTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Batch) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BatchTraits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
 	// region failure
 
-	TEST(TEST_CLASS, VerifyFailsWhenProofHasUnsupportedVersion) {
+	VERIFIER_TRAITS_BASED_TEST(VerifyFailsWhenProofHasUnsupportedVersion) {
 		// Arrange:
-		RunTest([](const auto& context, const auto& prevoteHashes, const auto& prevoteMessages, const auto& precommitMessages) {
+		RunTest<TTraits>([](const auto& context, const auto& prevoteHashes, const auto& prevoteMessages, const auto& precommitMessages) {
 			auto statistics = CreateFinalizationStatistics(Height(3), prevoteHashes[2]);
 			auto pProof = model::CreateFinalizationProof(statistics, MergeMessages(prevoteMessages, precommitMessages));
 
@@ -173,27 +213,27 @@ namespace bitxorcore { namespace chain {
 		});
 	}
 
-	TEST(TEST_CLASS, VerifyFailsWhenProofEpochDoesNotMatchContextEpoch) {
-		RunModifiedStatisticsTest(VerifyFinalizationProofResult::Failure_Invalid_Epoch, [](auto& statistics) {
+	VERIFIER_TRAITS_BASED_TEST(VerifyFailsWhenProofEpochDoesNotMatchContextEpoch) {
+		RunModifiedStatisticsTest<TTraits>(VerifyFinalizationProofResult::Failure_Invalid_Epoch, [](auto& statistics) {
 			statistics.Round.Epoch = statistics.Round.Epoch + FinalizationEpoch(1);
 		});
 	}
 
-	TEST(TEST_CLASS, VerifyFailsWhenProofHeightDoesNotMatchCalculatedHeight) {
-		RunModifiedStatisticsTest(VerifyFinalizationProofResult::Failure_Invalid_Height, [](auto& statistics) {
+	VERIFIER_TRAITS_BASED_TEST(VerifyFailsWhenProofHeightDoesNotMatchCalculatedHeight) {
+		RunModifiedStatisticsTest<TTraits>(VerifyFinalizationProofResult::Failure_Invalid_Height, [](auto& statistics) {
 			statistics.Height = statistics.Height + Height(1);
 		});
 	}
 
-	TEST(TEST_CLASS, VerifyFailsWhenProofHashDoesNotMatchCalculatedHash) {
-		RunModifiedStatisticsTest(VerifyFinalizationProofResult::Failure_Invalid_Hash, [](auto& statistics) {
+	VERIFIER_TRAITS_BASED_TEST(VerifyFailsWhenProofHashDoesNotMatchCalculatedHash) {
+		RunModifiedStatisticsTest<TTraits>(VerifyFinalizationProofResult::Failure_Invalid_Hash, [](auto& statistics) {
 			test::FillWithRandomData(statistics.Hash);
 		});
 	}
 
-	TEST(TEST_CLASS, VerifyFailsWhenProofDoesNotProveAnything) {
+	VERIFIER_TRAITS_BASED_TEST(VerifyFailsWhenProofDoesNotProveAnything) {
 		// Arrange:
-		RunTest([](const auto& context, const auto& prevoteHashes, const auto& prevoteMessages, auto& precommitMessages) {
+		RunTest<TTraits>([](const auto& context, const auto& prevoteHashes, const auto& prevoteMessages, auto& precommitMessages) {
 			// - drop precommit message
 			precommitMessages.pop_back();
 
@@ -209,10 +249,10 @@ namespace bitxorcore { namespace chain {
 	}
 
 	namespace {
-		template<typename TModifier>
+		template<typename TTraits, typename TModifier>
 		void RunModifiedPrevoteMessagesTest(TModifier modifyPrevoteMessages) {
 			// Arrange:
-			RunTest([modifyPrevoteMessages](
+			RunTest<TTraits>([modifyPrevoteMessages](
 					const auto& context,
 					const auto& prevoteHashes,
 					auto& prevoteMessages,
@@ -231,17 +271,17 @@ namespace bitxorcore { namespace chain {
 		}
 	}
 
-	TEST(TEST_CLASS, VerifyFailsWhenProofContainsRedundantMessage) {
+	VERIFIER_TRAITS_BASED_TEST(VerifyFailsWhenProofContainsRedundantMessage) {
 		// Arrange:
-		RunModifiedPrevoteMessagesTest([](auto& prevoteMessages) {
+		RunModifiedPrevoteMessagesTest<TTraits>([](auto& prevoteMessages) {
 			// - duplicate prevote message
 			prevoteMessages.push_back(prevoteMessages.front());
 		});
 	}
 
-	TEST(TEST_CLASS, VerifyFailsWhenProofContainsMessageThatFailsProcessing) {
+	VERIFIER_TRAITS_BASED_TEST(VerifyFailsWhenProofContainsMessageThatFailsProcessing) {
 		// Arrange:
-		RunModifiedPrevoteMessagesTest([](auto& prevoteMessages) {
+		RunModifiedPrevoteMessagesTest<TTraits>([](auto& prevoteMessages) {
 			// - corrupt signature
 			prevoteMessages[prevoteMessages.size() / 2]->Signature.Root.ParentPublicKey[0] ^= 0xFF;
 		});
@@ -251,8 +291,53 @@ namespace bitxorcore { namespace chain {
 
 	// region success
 
-	TEST(TEST_CLASS, CanVerifyProofWithMultipleMessageGroupsWithMultipleMessages) {
-		RunModifiedStatisticsTest(VerifyFinalizationProofResult::Success, [](const auto&) {});
+	VERIFIER_TRAITS_BASED_TEST(CanVerifyProofWithMultipleMessageGroupsWithMultipleMessages) {
+		RunModifiedStatisticsTest<TTraits>(VerifyFinalizationProofResult::Success, [](const auto&) {});
+	}
+
+	// endregion
+
+	// region batch verification
+
+	TEST(TEST_CLASS, BatchVerificationCachesBindingsAndSignaturesOfAllVoters) {
+		// Arrange:
+		RunTest<BatchTraits>([](
+				const auto& context,
+				const auto& prevoteHashes,
+				const auto& prevoteMessages,
+				const auto& precommitMessages) {
+			auto statistics = CreateFinalizationStatistics(Height(3), prevoteHashes[2]);
+			auto pProof = model::CreateFinalizationProof(statistics, MergeMessages(prevoteMessages, precommitMessages));
+
+			// Act: verify it
+			auto result = context.verify(*pProof);
+
+			// Assert: (test messages are signed by independently created trees, so bindings are not shared)
+			EXPECT_EQ(VerifyFinalizationProofResult::Success, result);
+			EXPECT_EQ(8u, context.verificationCache().numBindings());
+			EXPECT_EQ(8u, context.verificationCache().numSignatures());
+		});
+	}
+
+	TEST(TEST_CLASS, BatchVerificationDoesNotCacheBindingsOfIneligibleVoters) {
+		// Arrange:
+		RunTest<BatchTraits>([](const auto& context, const auto& prevoteHashes, auto& prevoteMessages, const auto& precommitMessages) {
+			// - add a prevote from an ineligible voter (6)
+			auto ineligibleMessages = CreatePrevoteMessages(1, prevoteHashes.data(), prevoteHashes.size());
+			context.signAllMessages(ineligibleMessages, { 6 });
+			prevoteMessages.push_back(ineligibleMessages.back());
+
+			auto statistics = CreateFinalizationStatistics(Height(3), prevoteHashes[2]);
+			auto pProof = model::CreateFinalizationProof(statistics, MergeMessages(prevoteMessages, precommitMessages));
+
+			// Act: verify it
+			auto result = context.verify(*pProof);
+
+			// Assert: only eligible voter components are cached
+			EXPECT_EQ(VerifyFinalizationProofResult::Failure_Invalid_Messsage, result);
+			EXPECT_EQ(8u, context.verificationCache().numBindings());
+			EXPECT_EQ(8u, context.verificationCache().numSignatures());
+		});
 	}
 
 	// endregion
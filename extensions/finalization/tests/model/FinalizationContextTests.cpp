@@ -22,6 +22,7 @@
 
 #include "finalization/src/model/FinalizationContext.h"
 #include "bitxorcore/cache_core/AccountStateCache.h"
+#include "bitxorcore/crypto_voting/BmVerificationCache.h"
 #include "bitxorcore/model/Address.h"
 #include "tests/test/cache/AccountStateCacheTestUtils.h"
 #include "tests/test/core/AddressTestUtils.h"
@@ -155,6 +156,27 @@ namespace bitxorcore { namespace model {
 		EXPECT_EQ(generationHash, context.generationHash());
 		EXPECT_EQ(9876u, context.config().Size);
 		EXPECT_EQ(Amount(0), context.weight());
+		EXPECT_FALSE(!!context.verificationCache());
+	}
+
+	TEST(TEST_CLASS, CanCreateContextWithVerificationCache) {
+		// Arrange:
+		auto generationHash = test::GenerateRandomByteArray<GenerationHash>();
+		auto config = CreateConfigurationWithSize(9876);
+		auto pVerificationCache = std::make_shared<crypto::BmVerificationCache>(10);
+
+		cache::AccountStateCache cache(cache::CacheConfiguration(), CreateOptions());
+
+		// Act:
+		FinalizationContext context(Epoch(50), Height(123), generationHash, config, *cache.createView(), pVerificationCache);
+
+		// Assert:
+		EXPECT_EQ(Epoch(50), context.epoch());
+		EXPECT_EQ(Height(123), context.height());
+		EXPECT_EQ(generationHash, context.generationHash());
+		EXPECT_EQ(9876u, context.config().Size);
+		EXPECT_EQ(Amount(0), context.weight());
+		EXPECT_EQ(pVerificationCache.get(), context.verificationCache());
 	}
 
 	TEST(TEST_CLASS, CanCreateContextAroundHighValueAccounts) {
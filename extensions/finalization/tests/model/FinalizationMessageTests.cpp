@@ -22,6 +22,8 @@
 
 #include "finalization/src/model/FinalizationMessage.h"
 #include "bitxorcore/crypto_voting/AggregateBmPrivateKeyTree.h"
+#include "bitxorcore/crypto_voting/BmVerificationCache.h"
+#include "bitxorcore/utils/RandomGenerator.h"
 #include "finalization/tests/test/FinalizationMessageTestUtils.h"
 #include "tests/test/core/EntityTestUtils.h"
 #include "tests/test/core/HashTestUtils.h"
@@ -203,17 +205,22 @@ namespace bitxorcore { namespace model {
 		constexpr auto Expected_Large_Weight = 4'000'000u;
 
 		template<typename TAction>
-		void RunFinalizationContextTest(TAction action) {
+		void RunFinalizationContextTest(const std::shared_ptr<crypto::BmVerificationCache>& pVerificationCache, TAction action) {
 			// Arrange:
 			auto config = finalization::FinalizationConfiguration::Uninitialized();
 			auto finalizationContextPair = test::CreateFinalizationContext(config, FinalizationEpoch(50), Height(123), {
 				Amount(2'000'000), Amount(Expected_Large_Weight), Amount(1'000'000), Amount(6'000'000)
-			});
+			}, pVerificationCache);
 
 			// Act + Assert:
 			action(finalizationContextPair.first, finalizationContextPair.second);
 		}
 
+		template<typename TAction>
+		void RunFinalizationContextTest(TAction action) {
+			RunFinalizationContextTest(nullptr, action);
+		}
+
 		// endregion
 	}
 
@@ -347,6 +354,20 @@ namespace bitxorcore { namespace model {
 	// region ProcessMessage
 
 	namespace {
+		std::shared_ptr<FinalizationMessage> CreateSignedMessage(
+				uint32_t numHashes,
+				const consumer<FinalizationMessage&>& modifyMessage,
+				const test::AccountKeyPairDescriptor& keyPairDescriptor) {
+			auto pMessage = CreateMessage(numHashes);
+			pMessage->FinalizationMessage_Reserved1 = 0;
+			pMessage->Version = FinalizationMessage::Current_Version;
+			pMessage->StepIdentifier = DefaultStepIdentifier();
+			pMessage->Height = Height(987);
+			modifyMessage(*pMessage);
+			test::SignMessage(*pMessage, keyPairDescriptor.VotingKeyPair);
+			return pMessage;
+		}
+
 		template<typename TAction>
 		void RunProcessMessageTest(
 				VoterType voterType,
@@ -358,13 +379,7 @@ namespace bitxorcore { namespace model {
 				const auto& keyPairDescriptor = keyPairDescriptors[utils::to_underlying_type(voterType)];
 
 				// - create message
-				auto pMessage = CreateMessage(numHashes);
-				pMessage->FinalizationMessage_Reserved1 = 0;
-				pMessage->Version = FinalizationMessage::Current_Version;
-				pMessage->StepIdentifier = DefaultStepIdentifier();
-				pMessage->Height = Height(987);
-				modifyMessage(*pMessage);
-				test::SignMessage(*pMessage, keyPairDescriptor.VotingKeyPair);
+				auto pMessage = CreateSignedMessage(numHashes, modifyMessage, keyPairDescriptor);
 
 				// Act + Assert:
 				action(context, keyPairDescriptor, *pMessage);
@@ -461,4 +476,174 @@ namespace bitxorcore { namespace model {
 	}
 
 	// endregion
+
+	// region ProcessMessage - verification cache
+
+	namespace {
+		template<typename TAction>
+		void RunProcessMessageWithVerificationCacheTest(
+				VoterType voterType,
+				const consumer<FinalizationMessage&>& modifyMessage,
+				TAction action) {
+			// Arrange:
+			auto pVerificationCache = std::make_shared<crypto::BmVerificationCache>(100);
+			RunFinalizationContextTest(pVerificationCache, [voterType, modifyMessage, action, &verificationCache = *pVerificationCache](
+					const auto& context,
+					const auto& keyPairDescriptors) {
+				const auto& keyPairDescriptor = keyPairDescriptors[utils::to_underlying_type(voterType)];
+				auto pMessage = CreateSignedMessage(3, modifyMessage, keyPairDescriptor);
+
+				// Act + Assert:
+				action(context, verificationCache, *pMessage);
+			});
+		}
+	}
+
+	TEST(TEST_CLASS, ProcessMessage_CanProcessValidMessageWithVerificationCache) {
+		// Arrange:
+		RunProcessMessageWithVerificationCacheTest(VoterType::Large, [](const auto&) {}, [](
+				const auto& context,
+				const auto& verificationCache,
+				const auto& message) {
+			// Act: process the message twice
+			auto processResultPair1 = ProcessMessage(message, context);
+			auto processResultPair2 = ProcessMessage(message, context);
+
+			// Assert:
+			EXPECT_EQ(ProcessMessageResult::Success, processResultPair1.first);
+			EXPECT_EQ(Expected_Large_Weight, processResultPair1.second);
+			EXPECT_EQ(ProcessMessageResult::Success, processResultPair2.first);
+			EXPECT_EQ(Expected_Large_Weight, processResultPair2.second);
+
+			EXPECT_EQ(1u, verificationCache.numBindings());
+			EXPECT_EQ(1u, verificationCache.numSignatures());
+		});
+	}
+
+	TEST(TEST_CLASS, ProcessMessage_FailsWhenSignatureIsInvalidWithVerificationCache) {
+		// Arrange:
+		RunProcessMessageWithVerificationCacheTest(VoterType::Large, [](const auto&) {}, [](
+				const auto& context,
+				const auto& verificationCache,
+				auto& message) {
+			// - corrupt the signature after signing
+			test::FillWithRandomData(message.Signature.Bottom.Signature);
+
+			// Act:
+			auto processResultPair = ProcessMessage(message, context);
+
+			// Assert:
+			EXPECT_EQ(ProcessMessageResult::Failure_Signature, processResultPair.first);
+			EXPECT_EQ(0u, processResultPair.second);
+
+			EXPECT_EQ(0u, verificationCache.numBindings());
+			EXPECT_EQ(0u, verificationCache.numSignatures());
+		});
+	}
+
+	TEST(TEST_CLASS, ProcessMessage_FailsWhenAccountIsNotVotingEligibleWithVerificationCache) {
+		// Arrange:
+		RunProcessMessageWithVerificationCacheTest(VoterType::Ineligible, [](const auto&) {}, [](
+				const auto& context,
+				const auto& verificationCache,
+				const auto& message) {
+			// Act:
+			auto processResultPair = ProcessMessage(message, context);
+
+			// Assert:
+			EXPECT_EQ(ProcessMessageResult::Failure_Voter, processResultPair.first);
+			EXPECT_EQ(0u, processResultPair.second);
+
+			EXPECT_EQ(0u, verificationCache.numBindings());
+			EXPECT_EQ(0u, verificationCache.numSignatures());
+		});
+	}
+
+	// endregion
+
+	// region VerifyMessageSignatures
+
+	namespace {
+		crypto::RandomFiller CreateRandomFiller() {
+			return [](auto* pOut, auto count) {
+				// can use low entropy source for tests
+				utils::LowEntropyRandomGenerator().fill(pOut, count);
+			};
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMessageSignatures_VerifiesAllMessagesAndCachesValidSignatures) {
+		// Arrange:
+		RunFinalizationContextTest([](const auto&, const auto& keyPairDescriptors) {
+			std::vector<std::shared_ptr<FinalizationMessage>> messages;
+			for (auto voterType : { VoterType::Large, VoterType::Small, VoterType::Large, VoterType::Ineligible }) {
+				const auto& keyPairDescriptor = keyPairDescriptors[utils::to_underlying_type(voterType)];
+				messages.push_back(CreateSignedMessage(3, [](const auto&) {}, keyPairDescriptor));
+			}
+
+			// - corrupt a hash
+			test::FillWithRandomData(messages[1]->HashesPtr()[1]);
+
+			crypto::BmVerificationCache verificationCache(100);
+
+			// Act:
+			auto results = VerifyMessageSignatures(messages.data(), messages.size(), CreateRandomFiller(), verificationCache);
+
+			// Assert: eligibility is not checked
+			EXPECT_EQ(std::vector<bool>({ true, false, true, true }), results);
+			EXPECT_EQ(3u, verificationCache.numBindings());
+			EXPECT_EQ(3u, verificationCache.numSignatures());
+		});
+	}
+
+	TEST(TEST_CLASS, VerifyMessageSignatures_RejectsInvalidSignaturePastFirstBatch) {
+		// Arrange:
+		RunFinalizationContextTest([](const auto&, const auto& keyPairDescriptors) {
+			// - each message contributes a root and a bottom signature, so there are more than two full batches of 64 signatures
+			constexpr auto Num_Messages = 66u;
+			const auto& keyPairDescriptor = keyPairDescriptors[utils::to_underlying_type(VoterType::Large)];
+			std::vector<std::shared_ptr<FinalizationMessage>> messages;
+			for (auto i = 0u; i < Num_Messages; ++i)
+				messages.push_back(CreateSignedMessage(3, [](const auto&) {}, keyPairDescriptor));
+
+			// - corrupt the bottom signature of a message verified in the second batch
+			messages[40]->Signature.Bottom.Signature[5] ^= 0xFF;
+
+			crypto::BmVerificationCache verificationCache(100);
+
+			// Act:
+			auto results = VerifyMessageSignatures(messages.data(), messages.size(), CreateRandomFiller(), verificationCache);
+
+			// Assert: only the corrupted message failed and its signature was not cached
+			auto expectedResults = std::vector<bool>(Num_Messages, true);
+			expectedResults[40] = false;
+			EXPECT_EQ(expectedResults, results);
+			EXPECT_EQ(Num_Messages - 1, verificationCache.numSignatures());
+		});
+	}
+
+	TEST(TEST_CLASS, VerifyMessageSignatures_VerifiedSignaturesAreReusedByProcessMessage) {
+		// Arrange:
+		auto pVerificationCache = std::make_shared<crypto::BmVerificationCache>(100);
+		RunFinalizationContextTest(pVerificationCache, [&verificationCache = *pVerificationCache](
+				const auto& context,
+				const auto& keyPairDescriptors) {
+			const auto& keyPairDescriptor = keyPairDescriptors[utils::to_underlying_type(VoterType::Large)];
+			std::vector<std::shared_ptr<FinalizationMessage>> messages;
+			messages.push_back(CreateSignedMessage(3, [](const auto&) {}, keyPairDescriptor));
+			VerifyMessageSignatures(messages.data(), messages.size(), CreateRandomFiller(), verificationCache);
+
+			// - corrupt the root signature, which would fail verification if it were checked
+			messages[0]->Signature.Root.Signature[0] ^= 0xFF;
+
+			// Act:
+			auto processResultPair = ProcessMessage(*messages[0], context);
+
+			// Assert: the cached binding was used
+			EXPECT_EQ(ProcessMessageResult::Success, processResultPair.first);
+			EXPECT_EQ(Expected_Large_Weight, processResultPair.second);
+		});
+	}
+
+	// endregion
 }}
@@ -34,7 +34,7 @@ namespace bitxorcore { namespace test {
 	class FinalizationBootstrapperServiceTestUtils {
 	public:
 		/// Number of expected bootstrapper services.
-		static constexpr auto Num_Bootstrapper_Services = 4u;
+		static constexpr auto Num_Bootstrapper_Services = 5u;
 
 		/// Types of accounts registered by CreateCache.
 		enum class VoterType : uint32_t { Small, Large1, Ineligible, Large2 };
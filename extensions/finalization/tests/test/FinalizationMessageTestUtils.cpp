@@ -231,6 +231,15 @@ namespace bitxorcore { namespace test {
 			FinalizationEpoch epoch,
 			Height height,
 			const std::vector<Amount>& balances) {
+		return CreateFinalizationContext(config, epoch, height, balances, nullptr);
+	}
+
+	std::pair<model::FinalizationContext, std::vector<AccountKeyPairDescriptor>> CreateFinalizationContext(
+			const finalization::FinalizationConfiguration& config,
+			FinalizationEpoch epoch,
+			Height height,
+			const std::vector<Amount>& balances,
+			const std::shared_ptr<crypto::BmVerificationCache>& pVerificationCache) {
 		auto accountStateCacheOptions = CreateDefaultAccountStateCacheOptions(TokenId(1111), Harvesting_Token_Id);
 		accountStateCacheOptions.MinVoterBalance = Amount(2'000'000);
 
@@ -238,7 +247,14 @@ namespace bitxorcore { namespace test {
 		auto keyPairDescriptors = AddAccountsWithBalances(accountStateCache, height, balances);
 
 		auto generationHash = GenerateRandomByteArray<GenerationHash>();
-		auto finalizationContext = model::FinalizationContext(epoch, height, generationHash, config, *accountStateCache.createView());
+		auto accountStateCacheView = accountStateCache.createView();
+		auto finalizationContext = model::FinalizationContext(
+				epoch,
+				height,
+				generationHash,
+				config,
+				*accountStateCacheView,
+				pVerificationCache);
 
 		return std::make_pair(std::move(finalizationContext), std::move(keyPairDescriptors));
 	}
@@ -141,6 +141,15 @@ namespace bitxorcore { namespace test {
 			TokenId tokenId,
 			const std::vector<Amount>& balances);
 
+	/// Creates a finalization context for \a epoch at \a height with specified account \a balances given \a config
+	/// and signature verification cache (\a pVerificationCache).
+	std::pair<model::FinalizationContext, std::vector<AccountKeyPairDescriptor>> CreateFinalizationContext(
+			const finalization::FinalizationConfiguration& config,
+			FinalizationEpoch epoch,
+			Height height,
+			const std::vector<Amount>& balances,
+			const std::shared_ptr<crypto::BmVerificationCache>& pVerificationCache);
+
 	// endregion
 
 	// region finalization context utils
@@ -152,5 +161,14 @@ namespace bitxorcore { namespace test {
 			Height height,
 			const std::vector<Amount>& balances);
 
+	/// Creates a finalization context for \a epoch at \a height with specified account \a balances given \a config
+	/// and signature verification cache (\a pVerificationCache).
+	std::pair<model::FinalizationContext, std::vector<AccountKeyPairDescriptor>> CreateFinalizationContext(
+			const finalization::FinalizationConfiguration& config,
+			FinalizationEpoch epoch,
+			Height height,
+			const std::vector<Amount>& balances,
+			const std::shared_ptr<crypto::BmVerificationCache>& pVerificationCache);
+
 	// endregion
 }}
@@ -0,0 +1,156 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MetricsCollectors.h"
+#include "bitxorcore/cache_db/SharedRocksDatabase.h"
+#include "bitxorcore/disruptor/ConsumerDispatcher.h"
+#include "bitxorcore/extensions/ServiceLocator.h"
+#include "bitxorcore/ionet/PacketHandlerDispatcher.h"
+#include "bitxorcore/ionet/PacketHandlers.h"
+#include "bitxorcore/model/ResolutionCache.h"
+#include <sstream>
+#include <unordered_set>
+
+namespace bitxorcore { namespace metrics {
+
+	namespace {
+		constexpr auto Metric_Prefix = "bitxorcore_";
+
+		std::string PrefixedName(const std::string& name) {
+			return Metric_Prefix + name;
+		}
+
+		std::string PacketTypeToString(ionet::PacketType type) {
+			std::ostringstream out;
+			out << type;
+			return out.str();
+		}
+
+		void WriteSingleValue(
+				OpenMetricsWriter& writer,
+				const std::string& name,
+				MetricType type,
+				const std::string& help,
+				uint64_t value) {
+			writer.writeFamily(PrefixedName(name), type, help);
+			writer.writeValue({}, value);
+		}
+	}
+
+	void WriteCounterMetrics(OpenMetricsWriter& writer, const std::vector<utils::DiagnosticCounter>& counters) {
+		std::unordered_set<std::string> names;
+		for (const auto& counter : counters) {
+			auto value = counter.value();
+			if (extensions::ServiceLocator::Sentinel_Counter_Value == value)
+				continue;
+
+			auto counterName = counter.id().name();
+			auto name = PrefixedName(SanitizeMetricName(counterName));
+			if (!names.insert(name).second)
+				continue;
+
+			writer.writeFamily(name, MetricType::Gauge, "diagnostic counter " + counterName);
+			writer.writeValue({}, value);
+		}
+	}
+
+	void WriteDispatcherMetrics(OpenMetricsWriter& writer, const std::vector<NamedConsumerDispatcher>& dispatchers) {
+		writer.writeFamily(
+				PrefixedName("dispatcher_consumer_duration_seconds"),
+				MetricType::Histogram,
+				"time spent by dispatcher consumers processing elements");
+		for (const auto& pair : dispatchers) {
+			const auto& dispatcher = *pair.second;
+			for (auto i = 0u; i < dispatcher.size(); ++i) {
+				auto labels = MetricLabels{ { "dispatcher", pair.first }, { "consumer", std::to_string(i) } };
+				writer.writeHistogram(labels, dispatcher.consumerLatencies(i).snapshot());
+			}
+		}
+	}
+
+	void WritePacketHandlerMetrics(
+			OpenMetricsWriter& writer,
+			const std::vector<ionet::PacketHandlerStatistics>& statistics,
+			const ionet::PacketHandlerDispatcher* pHeavyDispatcher) {
+		auto createLabels = [](const auto& handlerStatistics) {
+			auto cost = ionet::PacketHandlerCost::Heavy == handlerStatistics.Cost ? "heavy" : "light";
+			return MetricLabels{ { "type", PacketTypeToString(handlerStatistics.Type) }, { "cost", cost } };
+		};
+
+		writer.writeFamily(PrefixedName("packet_handler_duration_seconds"), MetricType::Summary, "time spent handling packets");
+		for (const auto& handlerStatistics : statistics)
+			writer.writeSummary(createLabels(handlerStatistics), handlerStatistics.NumInvocations, handlerStatistics.TotalElapsedMicros);
+
+		writer.writeFamily(PrefixedName("packet_handler_max_duration_seconds"), MetricType::Gauge, "longest time spent handling a packet");
+		for (const auto& handlerStatistics : statistics)
+			writer.writeDuration(createLabels(handlerStatistics), handlerStatistics.MaxElapsedMicros);
+
+		if (!pHeavyDispatcher)
+			return;
+
+		writer.writeFamily(PrefixedName("packet_handler_pending_packets"), MetricType::Gauge, "heavy packets waiting to be handled");
+		for (const auto& handlerStatistics : statistics) {
+			if (ionet::PacketHandlerCost::Heavy != handlerStatistics.Cost)
+				continue;
+
+			auto labels = MetricLabels{ { "type", PacketTypeToString(handlerStatistics.Type) } };
+			writer.writeValue(labels, pHeavyDispatcher->numPendingPackets(handlerStatistics.Type));
+		}
+	}
+
+	void WriteResolutionCacheMetrics(OpenMetricsWriter& writer, const model::ResolutionCacheStatistics& statistics) {
+		WriteSingleValue(writer, "resolution_cache_hits", MetricType::Counter, "resolutions served from cache", statistics.NumHits);
+		WriteSingleValue(writer, "resolution_cache_misses", MetricType::Counter, "resolutions not found in cache", statistics.NumMisses);
+		WriteSingleValue(
+				writer,
+				"resolution_cache_invalidations",
+				MetricType::Counter,
+				"times resolution cache was cleared",
+				statistics.NumInvalidations);
+	}
+
+	void WriteCacheDatabaseMetrics(OpenMetricsWriter& writer, const cache::SharedRocksDatabaseStatistics& statistics) {
+		WriteSingleValue(writer, "cache_database_keys", MetricType::Gauge, "estimated number of keys", statistics.NumEstimatedKeys);
+		WriteSingleValue(writer, "cache_database_memtables_bytes", MetricType::Gauge, "size of all memtables", statistics.MemtablesSize);
+		WriteSingleValue(
+				writer,
+				"cache_database_live_sst_files_bytes",
+				MetricType::Gauge,
+				"size of all live sst files",
+				statistics.LiveSstFilesSize);
+		WriteSingleValue(
+				writer,
+				"cache_database_pending_compaction_bytes",
+				MetricType::Gauge,
+				"estimated bytes pending compaction",
+				statistics.PendingCompactionSize);
+		WriteSingleValue(writer, "cache_database_block_cache_hits", MetricType::Counter, "block cache hits", statistics.NumBlockCacheHits);
+		WriteSingleValue(
+				writer,
+				"cache_database_block_cache_misses",
+				MetricType::Counter,
+				"block cache misses",
+				statistics.NumBlockCacheMisses);
+		WriteSingleValue(writer, "cache_database_read_bytes", MetricType::Counter, "bytes read", statistics.NumBytesRead);
+		WriteSingleValue(writer, "cache_database_written_bytes", MetricType::Counter, "bytes written", statistics.NumBytesWritten);
+	}
+}}
@@ -0,0 +1,61 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "OpenMetricsWriter.h"
+#include "bitxorcore/utils/DiagnosticCounter.h"
+
+namespace bitxorcore {
+	namespace cache { struct SharedRocksDatabaseStatistics; }
+	namespace disruptor { class ConsumerDispatcher; }
+	namespace ionet {
+		class PacketHandlerDispatcher;
+		struct PacketHandlerStatistics;
+	}
+	namespace model { struct ResolutionCacheStatistics; }
+}
+
+namespace bitxorcore { namespace metrics {
+
+	/// Writes all diagnostic \a counters to \a writer as gauges.
+	/// \note Counters without values and counters with duplicate (sanitized) names are skipped.
+	void WriteCounterMetrics(OpenMetricsWriter& writer, const std::vector<utils::DiagnosticCounter>& counters);
+
+	/// Named consumer dispatcher.
+	using NamedConsumerDispatcher = std::pair<std::string, const disruptor::ConsumerDispatcher*>;
+
+	/// Writes per consumer latency histograms for all named \a dispatchers to \a writer.
+	void WriteDispatcherMetrics(OpenMetricsWriter& writer, const std::vector<NamedConsumerDispatcher>& dispatchers);
+
+	/// Writes packet handler \a statistics and pending packets of heavy handlers queued in \a pHeavyDispatcher to \a writer.
+	/// \note \a pHeavyDispatcher is optional.
+	void WritePacketHandlerMetrics(
+			OpenMetricsWriter& writer,
+			const std::vector<ionet::PacketHandlerStatistics>& statistics,
+			const ionet::PacketHandlerDispatcher* pHeavyDispatcher);
+
+	/// Writes resolution cache \a statistics to \a writer.
+	void WriteResolutionCacheMetrics(OpenMetricsWriter& writer, const model::ResolutionCacheStatistics& statistics);
+
+	/// Writes cache database \a statistics to \a writer.
+	void WriteCacheDatabaseMetrics(OpenMetricsWriter& writer, const cache::SharedRocksDatabaseStatistics& statistics);
+}}
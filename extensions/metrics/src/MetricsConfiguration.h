@@ -0,0 +1,57 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "bitxorcore/utils/TimeSpan.h"
+#include <filesystem>
+
+namespace bitxorcore { namespace utils { class ConfigurationBag; } }
+
+namespace bitxorcore { namespace metrics {
+
+	/// Metrics configuration settings.
+	struct MetricsConfiguration {
+	public:
+		/// Network interface on which to listen.
+		std::string ListenInterface;
+
+		/// Metrics (http) port.
+		unsigned short Port;
+
+		/// Maximum amount of time to wait for a complete request.
+		utils::TimeSpan RequestTimeout;
+
+	private:
+		MetricsConfiguration() = default;
+
+	public:
+		/// Creates an uninitialized metrics configuration.
+		static MetricsConfiguration Uninitialized();
+
+	public:
+		/// Loads a metrics configuration from \a bag.
+		static MetricsConfiguration LoadFromBag(const utils::ConfigurationBag& bag);
+
+		/// Loads a metrics configuration from \a resourcesPath.
+		static MetricsConfiguration LoadFromPath(const std::filesystem::path& resourcesPath);
+	};
+}}
@@ -0,0 +1,335 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MetricsServer.h"
+#include "bitxorcore/thread/IoThreadPool.h"
+#include "bitxorcore/utils/Logging.h"
+#include "bitxorcore/preprocessor.h"
+#include <algorithm>
+#include <atomic>
+#include <sstream>
+
+namespace bitxorcore { namespace metrics {
+
+	namespace {
+		constexpr auto Metrics_Path = "/metrics";
+		constexpr auto Metrics_Content_Type = "application/openmetrics-text; version=1.0.0; charset=utf-8";
+		constexpr auto Text_Content_Type = "text/plain; charset=utf-8";
+
+		std::string CreateResponse(const char* status, const char* contentType, const std::string& body) {
+			std::ostringstream out;
+			out
+					<< "HTTP/1.1 " << status << "\r\n"
+					<< "Content-Type: " << contentType << "\r\n"
+					<< "Content-Length: " << body.size() << "\r\n"
+					<< "Connection: close\r\n"
+					<< "\r\n"
+					<< body;
+			return out.str();
+		}
+
+		std::string CreateErrorResponse(const char* status) {
+			return CreateResponse(status, Text_Content_Type, std::string(status) + "\n");
+		}
+
+		// region MetricsConnection
+
+		/// Handles a request (method, target) and returns a response.
+		using RequestHandler = std::function<std::string (const std::string&, const std::string&)>;
+
+		class MetricsConnection : public std::enable_shared_from_this<MetricsConnection> {
+		public:
+			MetricsConnection(
+					boost::asio::io_context& ioContext,
+					boost::asio::ip::tcp::socket&& socket,
+					const MetricsServerSettings& settings,
+					const RequestHandler& requestHandler,
+					const action& rejectHandler)
+					: m_socket(std::move(socket))
+					, m_strand(ioContext)
+					, m_timer(ioContext)
+					, m_buffer(settings.MaxRequestSize)
+					, m_requestTimeout(settings.RequestTimeout)
+					, m_requestHandler(requestHandler)
+					, m_rejectHandler(rejectHandler)
+					, m_isRequestComplete(false)
+			{}
+
+		public:
+			void start() {
+				m_timer.expires_from_now(std::chrono::milliseconds(m_requestTimeout.millis()));
+				m_timer.async_wait(m_strand.wrap([pThis = shared_from_this()](const auto& ec) {
+					pThis->handleTimeout(ec);
+				}));
+
+				boost::asio::async_read_until(m_socket, m_buffer, "\r\n\r\n", m_strand.wrap([pThis = shared_from_this()](
+						const auto& ec,
+						auto) {
+					pThis->handleRead(ec);
+				}));
+			}
+
+		private:
+			void handleTimeout(const boost::system::error_code& ec) {
+				if (boost::asio::error::operation_aborted == ec || m_isRequestComplete)
+					return;
+
+				BITXORCORE_LOG(debug) << "closing metrics connection because request was not received in time";
+				m_isRequestComplete = true;
+				m_rejectHandler();
+				close();
+			}
+
+			void handleRead(const boost::system::error_code& ec) {
+				if (m_isRequestComplete)
+					return;
+
+				m_isRequestComplete = true;
+				m_timer.cancel();
+
+				// request is too large when the buffer is exhausted before the end of the request headers is found
+				if (boost::asio::error::not_found == ec) {
+					reject();
+					return;
+				}
+
+				if (ec) {
+					close();
+					return;
+				}
+
+				std::istream input(&m_buffer);
+				std::string method;
+				std::string target;
+				std::string version;
+				input >> method >> target >> version;
+				if (0 != version.rfind("HTTP/", 0)) {
+					reject();
+					return;
+				}
+
+				write(m_requestHandler(method, target));
+			}
+
+			void reject() {
+				m_rejectHandler();
+				write(CreateErrorResponse("400 Bad Request"));
+			}
+
+			void write(std::string&& response) {
+				m_response = std::move(response);
+				boost::asio::async_write(m_socket, boost::asio::buffer(m_response), m_strand.wrap([pThis = shared_from_this()](
+						const auto&,
+						auto) {
+					pThis->close();
+				}));
+			}
+
+			void close() {
+				boost::system::error_code ignoredEc;
+				m_socket.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ignoredEc);
+				m_socket.close(ignoredEc);
+			}
+
+		private:
+			boost::asio::ip::tcp::socket m_socket;
+			boost::asio::io_context::strand m_strand;
+			boost::asio::steady_timer m_timer;
+			boost::asio::streambuf m_buffer;
+			utils::TimeSpan m_requestTimeout;
+			RequestHandler m_requestHandler;
+			action m_rejectHandler;
+
+			bool m_isRequestComplete;
+			std::string m_response;
+		};
+
+		// endregion
+
+		// region DefaultMetricsServer
+
+		class DefaultMetricsServer
+				: public MetricsServer
+				, public std::enable_shared_from_this<DefaultMetricsServer> {
+		public:
+			DefaultMetricsServer(
+					thread::IoThreadPool& pool,
+					const boost::asio::ip::tcp::endpoint& endpoint,
+					const MetricsServerSettings& settings,
+					const supplier<std::string>& metricsSupplier,
+					const std::vector<MetricsResource>& resources)
+					: m_ioContext(pool.ioContext())
+					, m_acceptorStrand(m_ioContext)
+					, m_acceptor(m_ioContext)
+					, m_settings(settings)
+					, m_metricsSupplier(metricsSupplier)
+					, m_resources(resources)
+					, m_isStopped(false)
+					, m_hasPendingAccept(false)
+					, m_numScrapes(0)
+					, m_numRejectedRequests(0) {
+				m_acceptor.open(endpoint.protocol());
+				m_acceptor.set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
+				m_acceptor.bind(endpoint);
+				m_localEndpoint = m_acceptor.local_endpoint();
+				BITXORCORE_LOG(info) << "MetricsServer created around " << m_localEndpoint;
+			}
+
+			~DefaultMetricsServer() override {
+				shutdown();
+			}
+
+		public:
+			boost::asio::ip::tcp::endpoint localEndpoint() const override {
+				return m_localEndpoint;
+			}
+
+			uint64_t numScrapes() const override {
+				return m_numScrapes;
+			}
+
+			uint64_t numRejectedRequests() const override {
+				return m_numRejectedRequests;
+			}
+
+		public:
+			void start() {
+				m_acceptor.listen();
+				m_hasPendingAccept = true;
+				startAccept();
+			}
+
+			void shutdown() override {
+				bool expectedIsStopped = false;
+				if (!m_isStopped.compare_exchange_strong(expectedIsStopped, true))
+					return;
+
+				// close the acceptor to prevent new connections and block until the close actually happens
+				BITXORCORE_LOG(info) << "MetricsServer stopping";
+				boost::asio::dispatch(m_acceptorStrand, [pThis = shared_from_this()]() {
+					boost::system::error_code ignoredEc;
+					pThis->m_acceptor.close(ignoredEc);
+				});
+
+				while (m_hasPendingAccept) {}
+				BITXORCORE_LOG(info) << "MetricsServer stopped";
+			}
+
+		private:
+			void startAccept() {
+				if (m_isStopped) {
+					m_hasPendingAccept = false;
+					return;
+				}
+
+				auto pSocket = std::make_shared<boost::asio::ip::tcp::socket>(m_ioContext);
+				m_acceptor.async_accept(*pSocket, m_acceptorStrand.wrap([pThis = shared_from_this(), pSocket](const auto& ec) {
+					pThis->handleAccept(ec, std::move(*pSocket));
+				}));
+			}
+
+			void handleAccept(const boost::system::error_code& ec, boost::asio::ip::tcp::socket&& socket) {
+				if (boost::asio::error::operation_aborted == ec) {
+					m_hasPendingAccept = false;
+					return;
+				}
+
+				if (ec) {
+					BITXORCORE_LOG(warning) << "MetricsServer failed to accept connection: " << ec.message();
+				} else {
+					auto pConnection = std::make_shared<MetricsConnection>(
+							m_ioContext,
+							std::move(socket),
+							m_settings,
+							[pThis = shared_from_this()](const auto& method, const auto& target) {
+								return pThis->handleRequest(method, target);
+							},
+							[pThis = shared_from_this()]() {
+								++pThis->m_numRejectedRequests;
+							});
+					pConnection->start();
+				}
+
+				startAccept();
+			}
+
+			std::string handleRequest(const std::string& method, const std::string& target) {
+				auto path = target.substr(0, target.find('?'));
+				const auto* pResource = findResource(path);
+				if (Metrics_Path != path && !pResource)
+					return CreateErrorResponse("404 Not Found");
+
+				if ("GET" != method)
+					return CreateErrorResponse("405 Method Not Allowed");
+
+				// additional resources are not scrapes
+				if (Metrics_Path != path)
+					return CreateResponse("200 OK", pResource->ContentType.c_str(), pResource->ContentSupplier());
+
+				++m_numScrapes;
+				return CreateResponse("200 OK", Metrics_Content_Type, m_metricsSupplier());
+			}
+
+			const MetricsResource* findResource(const std::string& path) const {
+				auto iter = std::find_if(m_resources.cbegin(), m_resources.cend(), [&path](const auto& resource) {
+					return path == resource.Path;
+				});
+				return m_resources.cend() == iter ? nullptr : &*iter;
+			}
+
+		private:
+			boost::asio::io_context& m_ioContext;
+			boost::asio::io_context::strand m_acceptorStrand;
+			boost::asio::ip::tcp::acceptor m_acceptor;
+			boost::asio::ip::tcp::endpoint m_localEndpoint;
+
+			const MetricsServerSettings m_settings;
+			supplier<std::string> m_metricsSupplier;
+			std::vector<MetricsResource> m_resources;
+			std::atomic_bool m_isStopped;
+			std::atomic_bool m_hasPendingAccept;
+			std::atomic<uint64_t> m_numScrapes;
+			std::atomic<uint64_t> m_numRejectedRequests;
+		};
+
+		// endregion
+	}
+
+	std::shared_ptr<MetricsServer> CreateMetricsServer(
+			thread::IoThreadPool& pool,
+			const boost::asio::ip::tcp::endpoint& endpoint,
+			const MetricsServerSettings& settings,
+			const supplier<std::string>& metricsSupplier) {
+		return CreateMetricsServer(pool, endpoint, settings, metricsSupplier, {});
+	}
+
+	std::shared_ptr<MetricsServer> CreateMetricsServer(
+			thread::IoThreadPool& pool,
+			const boost::asio::ip::tcp::endpoint& endpoint,
+			const MetricsServerSettings& settings,
+			const supplier<std::string>& metricsSupplier,
+			const std::vector<MetricsResource>& resources) {
+		auto pServer = std::make_shared<DefaultMetricsServer>(pool, endpoint, settings, metricsSupplier, resources);
+		pServer->start();
+		return PORTABLE_MOVE(pServer);
+	}
+}}
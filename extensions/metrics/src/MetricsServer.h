@@ -0,0 +1,93 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "bitxorcore/utils/TimeSpan.h"
+#include "bitxorcore/functions.h"
+#include <boost/asio.hpp>
+#include <memory>
+#include <vector>
+
+namespace bitxorcore { namespace thread { class IoThreadPool; } }
+
+namespace bitxorcore { namespace metrics {
+
+	/// Settings used to configure MetricsServer behavior.
+	struct MetricsServerSettings {
+		/// Maximum amount of time to wait for a complete request.
+		utils::TimeSpan RequestTimeout = utils::TimeSpan::FromSeconds(5);
+
+		/// Maximum size of a request (in bytes).
+		size_t MaxRequestSize = 8 * 1024;
+	};
+
+	/// Additional resource exposed by a metrics server.
+	struct MetricsResource {
+		/// Path of the resource.
+		std::string Path;
+
+		/// Content type of the resource.
+		std::string ContentType;
+
+		/// Supplies the resource content.
+		supplier<std::string> ContentSupplier;
+	};
+
+	/// Minimal http server that exposes metrics on the "/metrics" path.
+	/// \note Metrics are only collected when they are requested.
+	class MetricsServer {
+	public:
+		virtual ~MetricsServer() = default;
+
+	public:
+		/// Gets the endpoint on which the server is listening.
+		virtual boost::asio::ip::tcp::endpoint localEndpoint() const = 0;
+
+		/// Gets the number of metrics requests that have been served.
+		virtual uint64_t numScrapes() const = 0;
+
+		/// Gets the number of requests that have been rejected.
+		virtual uint64_t numRejectedRequests() const = 0;
+
+	public:
+		/// Shuts down the server.
+		virtual void shutdown() = 0;
+	};
+
+	/// Creates a metrics server listening on \a endpoint with the specified \a settings using the specified thread \a pool.
+	/// Each metrics request is answered with the exposition returned by \a metricsSupplier.
+	std::shared_ptr<MetricsServer> CreateMetricsServer(
+			thread::IoThreadPool& pool,
+			const boost::asio::ip::tcp::endpoint& endpoint,
+			const MetricsServerSettings& settings,
+			const supplier<std::string>& metricsSupplier);
+
+	/// Creates a metrics server listening on \a endpoint with the specified \a settings using the specified thread \a pool.
+	/// Each metrics request is answered with the exposition returned by \a metricsSupplier.
+	/// Requests for any of the additional \a resources are answered with the content returned by the matching resource supplier.
+	std::shared_ptr<MetricsServer> CreateMetricsServer(
+			thread::IoThreadPool& pool,
+			const boost::asio::ip::tcp::endpoint& endpoint,
+			const MetricsServerSettings& settings,
+			const supplier<std::string>& metricsSupplier,
+			const std::vector<MetricsResource>& resources);
+}}
@@ -0,0 +1,145 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MetricsService.h"
+#include "MetricsCollectors.h"
+#include "MetricsServer.h"
+#include "bitxorcore/cache_db/SharedRocksDatabase.h"
+#include "bitxorcore/disruptor/ConsumerDispatcher.h"
+#include "bitxorcore/extensions/ServiceLocator.h"
+#include "bitxorcore/extensions/ServiceState.h"
+#include "bitxorcore/ionet/PacketHandlerDispatcher.h"
+#include "bitxorcore/plugins/PluginManager.h"
+#include "bitxorcore/thread/MultiServicePool.h"
+#include "bitxorcore/utils/TraceRecorder.h"
+#include <sstream>
+
+namespace bitxorcore { namespace metrics {
+
+	namespace {
+		constexpr auto Service_Name = "metrics.server";
+
+		std::vector<NamedConsumerDispatcher> FindDispatchers(const extensions::ServiceLocator& locator) {
+			std::vector<NamedConsumerDispatcher> dispatchers;
+			for (const auto* serviceName : { "dispatcher.block", "dispatcher.transaction", "pt.dispatcher" }) {
+				auto pDispatcher = locator.tryService<disruptor::ConsumerDispatcher>(serviceName);
+				if (pDispatcher)
+					dispatchers.emplace_back(serviceName, pDispatcher.get());
+			}
+
+			return dispatchers;
+		}
+
+		supplier<std::string> CreateMetricsSupplier(const extensions::ServiceLocator& locator, extensions::ServiceState& state) {
+			// merge all counters
+			auto counters = state.counters();
+			counters.insert(counters.end(), locator.counters().cbegin(), locator.counters().cend());
+
+			// all other services have been registered, so resolve them once instead of on every scrape;
+			// raw pointers are safe because the metrics server is shut down before any services are destroyed
+			auto dispatchers = FindDispatchers(locator);
+			auto pHeavyDispatcher = locator.tryService<ionet::PacketHandlerDispatcher>("readers.heavy");
+
+			return [counters, dispatchers, pHeavyDispatcher = pHeavyDispatcher.get(), &state]() {
+				std::ostringstream out;
+				OpenMetricsWriter writer(out);
+				WriteCounterMetrics(writer, counters);
+				WriteDispatcherMetrics(writer, dispatchers);
+				WritePacketHandlerMetrics(writer, state.packetHandlers().statistics(), pHeavyDispatcher);
+
+				const auto& pluginManager = state.pluginManager();
+				WriteResolutionCacheMetrics(writer, pluginManager.resolutionCacheStatistics());
+
+				auto pSharedCacheDatabase = pluginManager.sharedCacheDatabase();
+				if (pSharedCacheDatabase)
+					WriteCacheDatabaseMetrics(writer, pSharedCacheDatabase->statistics());
+
+				writer.writeEof();
+				return out.str();
+			};
+		}
+
+		std::vector<MetricsResource> CreateResources(const extensions::ServiceLocator& locator) {
+			std::vector<MetricsResource> resources;
+
+			// expose the dispatcher traces on demand when dispatcher tracing is enabled
+			auto pTraceRecorder = locator.tryService<utils::TraceRecorder>("dispatcher.tracer");
+			if (pTraceRecorder) {
+				resources.push_back({ "/trace", "application/json", [pTraceRecorder]() {
+					std::ostringstream out;
+					utils::WriteChromeTrace(out, pTraceRecorder->snapshot());
+					return out.str();
+				} });
+			}
+
+			return resources;
+		}
+
+		class MetricsServiceRegistrar : public extensions::ServiceRegistrar {
+		public:
+			explicit MetricsServiceRegistrar(const MetricsConfiguration& config) : m_config(config)
+			{}
+
+		public:
+			extensions::ServiceRegistrarInfo info() const override {
+				return { "Metrics", extensions::ServiceRegistrarPhase::Post_Tasks };
+			}
+
+			void registerServiceCounters(extensions::ServiceLocator& locator) override {
+				locator.registerServiceCounter<MetricsServer>(Service_Name, "METRICS SCRP", [](const auto& server) {
+					return server.numScrapes();
+				});
+				locator.registerServiceCounter<MetricsServer>(Service_Name, "METRICS REJ", [](const auto& server) {
+					return server.numRejectedRequests();
+				});
+			}
+
+			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
+				MetricsServerSettings settings;
+				settings.RequestTimeout = m_config.RequestTimeout;
+
+				auto endpoint = boost::asio::ip::tcp::endpoint(
+						boost::asio::ip::address::from_string(m_config.ListenInterface),
+						m_config.Port);
+
+				auto* pPool = state.pool().pushIsolatedPool("metrics", 1);
+				auto pServiceGroup = state.pool().pushServiceGroup("metrics");
+				auto pServer = pServiceGroup->registerService(CreateMetricsServer(
+						*pPool,
+						endpoint,
+						settings,
+						CreateMetricsSupplier(locator, state),
+						CreateResources(locator)));
+				locator.registerService(Service_Name, pServer);
+
+				BITXORCORE_LOG(info) << "metrics server listening on " << pServer->localEndpoint();
+			}
+
+		private:
+			MetricsConfiguration m_config;
+		};
+	}
+
+	DECLARE_SERVICE_REGISTRAR(Metrics)(const MetricsConfiguration& config) {
+		return std::make_unique<MetricsServiceRegistrar>(config);
+	}
+}}
@@ -0,0 +1,194 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "OpenMetricsWriter.h"
+#include "bitxorcore/exceptions.h"
+#include <iomanip>
+#include <sstream>
+
+namespace bitxorcore { namespace metrics {
+
+	namespace {
+		constexpr uint64_t Micros_Per_Second = 1'000'000;
+
+		bool IsValidMetricNameChar(char ch, bool isFirst) {
+			if (('a' <= ch && ch <= 'z') || ('A' <= ch && ch <= 'Z') || '_' == ch || ':' == ch)
+				return true;
+
+			return !isFirst && '0' <= ch && ch <= '9';
+		}
+
+		bool IsValidMetricName(const std::string& name) {
+			if (name.empty())
+				return false;
+
+			for (auto i = 0u; i < name.size(); ++i) {
+				if (!IsValidMetricNameChar(name[i], 0 == i))
+					return false;
+			}
+
+			return true;
+		}
+
+		const char* GetTypeName(MetricType type) {
+			switch (type) {
+			case MetricType::Counter:
+				return "counter";
+			case MetricType::Gauge:
+				return "gauge";
+			case MetricType::Histogram:
+				return "histogram";
+			case MetricType::Summary:
+				return "summary";
+			}
+
+			return "unknown";
+		}
+
+		std::string EscapeLabelValue(const std::string& value) {
+			std::string escapedValue;
+			for (auto ch : value) {
+				switch (ch) {
+				case '\\':
+					escapedValue += "\\\\";
+					break;
+				case '"':
+					escapedValue += "\\\"";
+					break;
+				case '\n':
+					escapedValue += "\\n";
+					break;
+				default:
+					escapedValue.push_back(ch);
+					break;
+				}
+			}
+
+			return escapedValue;
+		}
+
+		std::string FormatSeconds(uint64_t micros) {
+			std::ostringstream out;
+			out << micros / Micros_Per_Second;
+
+			auto fractionalMicros = micros % Micros_Per_Second;
+			if (0 == fractionalMicros)
+				return out.str();
+
+			std::ostringstream fractionalOut;
+			fractionalOut << std::setw(6) << std::setfill('0') << fractionalMicros;
+			auto fraction = fractionalOut.str();
+			out << "." << fraction.substr(0, fraction.find_last_not_of('0') + 1);
+			return out.str();
+		}
+	}
+
+	std::string SanitizeMetricName(const std::string& name) {
+		std::string sanitizedName;
+		for (auto ch : name) {
+			if (!IsValidMetricNameChar(ch, sanitizedName.empty())) {
+				if (!sanitizedName.empty() && '_' != sanitizedName.back())
+					sanitizedName.push_back('_');
+
+				continue;
+			}
+
+			sanitizedName.push_back('A' <= ch && ch <= 'Z' ? static_cast<char>(ch - 'A' + 'a') : ch);
+		}
+
+		while (!sanitizedName.empty() && '_' == sanitizedName.back())
+			sanitizedName.pop_back();
+
+		return sanitizedName;
+	}
+
+	OpenMetricsWriter::OpenMetricsWriter(std::ostream& output)
+			: m_output(output)
+			, m_familyType(MetricType::Gauge)
+	{}
+
+	void OpenMetricsWriter::writeFamily(const std::string& name, MetricType type, const std::string& help) {
+		if (!IsValidMetricName(name))
+			BITXORCORE_THROW_INVALID_ARGUMENT_1("metric name is invalid", name);
+
+		m_familyName = name;
+		m_familyType = type;
+		m_output
+				<< "# TYPE " << name << " " << GetTypeName(type) << "\n"
+				<< "# HELP " << name << " " << help << "\n";
+	}
+
+	void OpenMetricsWriter::writeValue(const MetricLabels& labels, uint64_t value) {
+		requireFamily(MetricType::Counter, MetricType::Gauge);
+		writeLine(MetricType::Counter == m_familyType ? "_total" : "", labels, std::to_string(value));
+	}
+
+	void OpenMetricsWriter::writeDuration(const MetricLabels& labels, uint64_t micros) {
+		requireFamily(MetricType::Counter, MetricType::Gauge);
+		writeLine(MetricType::Counter == m_familyType ? "_total" : "", labels, FormatSeconds(micros));
+	}
+
+	void OpenMetricsWriter::writeHistogram(const MetricLabels& labels, const utils::LatencyHistogramSnapshot& histogram) {
+		requireFamily(MetricType::Histogram, MetricType::Histogram);
+
+		uint64_t cumulativeCount = 0;
+		for (auto i = 0u; i < histogram.BucketCounts.size(); ++i) {
+			cumulativeCount += histogram.BucketCounts[i];
+
+			auto bucketLabels = labels;
+			auto isBounded = i < utils::LatencyHistogram::Num_Bounded_Buckets;
+			bucketLabels.emplace_back("le", isBounded ? FormatSeconds(utils::LatencyHistogram::BucketUpperBound(i)) : "+Inf");
+			writeLine("_bucket", bucketLabels, std::to_string(cumulativeCount));
+		}
+
+		writeLine("_count", labels, std::to_string(histogram.Count));
+		writeLine("_sum", labels, FormatSeconds(histogram.SumMicros));
+	}
+
+	void OpenMetricsWriter::writeSummary(const MetricLabels& labels, uint64_t count, uint64_t sumMicros) {
+		requireFamily(MetricType::Summary, MetricType::Summary);
+		writeLine("_count", labels, std::to_string(count));
+		writeLine("_sum", labels, FormatSeconds(sumMicros));
+	}
+
+	void OpenMetricsWriter::writeEof() {
+		m_output << "# EOF\n";
+	}
+
+	void OpenMetricsWriter::requireFamily(MetricType type1, MetricType type2) const {
+		if (m_familyName.empty() || (type1 != m_familyType && type2 != m_familyType))
+			BITXORCORE_THROW_INVALID_ARGUMENT_1("sample is incompatible with current metric family", m_familyName);
+	}
+
+	void OpenMetricsWriter::writeLine(const std::string& suffix, const MetricLabels& labels, const std::string& value) {
+		m_output << m_familyName << suffix;
+		if (!labels.empty()) {
+			m_output << "{";
+			for (auto i = 0u; i < labels.size(); ++i)
+				m_output << (0 == i ? "" : ",") << labels[i].first << "=\"" << EscapeLabelValue(labels[i].second) << "\"";
+
+			m_output << "}";
+		}
+
+		m_output << " " << value << "\n";
+	}
+}}
@@ -0,0 +1,89 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "bitxorcore/utils/LatencyHistogram.h"
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bitxorcore { namespace metrics {
+
+	/// Metric (family) types.
+	enum class MetricType {
+		/// Monotonically increasing value.
+		Counter,
+
+		/// Value that can go up and down.
+		Gauge,
+
+		/// Distribution of latencies in buckets.
+		Histogram,
+
+		/// Count and sum of latencies.
+		Summary
+	};
+
+	/// Metric labels (name and value pairs).
+	using MetricLabels = std::vector<std::pair<std::string, std::string>>;
+
+	/// Converts \a name into a valid metric name by lowercasing it and replacing all runs of invalid characters with underscores.
+	std::string SanitizeMetricName(const std::string& name);
+
+	/// Writes metrics in OpenMetrics text format.
+	/// \note All durations are written in seconds.
+	class OpenMetricsWriter {
+	public:
+		/// Creates a writer around \a output.
+		explicit OpenMetricsWriter(std::ostream& output);
+
+	public:
+		/// Starts a metric family with \a name, \a type and \a help text.
+		void writeFamily(const std::string& name, MetricType type, const std::string& help);
+
+		/// Writes a sample with \a labels and \a value to the current counter or gauge family.
+		void writeValue(const MetricLabels& labels, uint64_t value);
+
+		/// Writes a sample with \a labels and duration \a micros to the current counter or gauge family.
+		void writeDuration(const MetricLabels& labels, uint64_t micros);
+
+		/// Writes a sample with \a labels and \a histogram to the current histogram family.
+		void writeHistogram(const MetricLabels& labels, const utils::LatencyHistogramSnapshot& histogram);
+
+		/// Writes a sample with \a labels, \a count and sum of durations (\a sumMicros) to the current summary family.
+		void writeSummary(const MetricLabels& labels, uint64_t count, uint64_t sumMicros);
+
+		/// Terminates the exposition.
+		void writeEof();
+
+	private:
+		void requireFamily(MetricType type1, MetricType type2) const;
+
+		void writeLine(const std::string& suffix, const MetricLabels& labels, const std::string& value);
+
+	private:
+		std::ostream& m_output;
+		std::string m_familyName;
+		MetricType m_familyType;
+	};
+}}
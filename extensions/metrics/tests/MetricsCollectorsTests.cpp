@@ -0,0 +1,300 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "metrics/src/MetricsCollectors.h"
+#include "bitxorcore/cache_db/SharedRocksDatabase.h"
+#include "bitxorcore/disruptor/ConsumerDispatcher.h"
+#include "bitxorcore/extensions/ServiceLocator.h"
+#include "bitxorcore/ionet/PacketHandlerDispatcher.h"
+#include "bitxorcore/ionet/PacketHandlers.h"
+#include "bitxorcore/model/ResolutionCache.h"
+#include "tests/TestHarness.h"
+#include <sstream>
+
+namespace bitxorcore { namespace metrics {
+
+#define TEST_CLASS MetricsCollectorsTests
+
+	namespace {
+		constexpr auto Ut_Cache_Counter_Metrics =
+				"# TYPE bitxorcore_ut_cache gauge\n# HELP bitxorcore_ut_cache diagnostic counter UT CACHE\nbitxorcore_ut_cache 123\n";
+
+		template<typename TAction>
+		std::string Collect(TAction action) {
+			std::ostringstream out;
+			OpenMetricsWriter writer(out);
+			action(writer);
+			return out.str();
+		}
+
+		utils::DiagnosticCounter CreateCounter(const std::string& name, uint64_t value) {
+			return utils::DiagnosticCounter(utils::DiagnosticCounterId(name), [value]() { return value; });
+		}
+
+		bool Contains(const std::string& output, const std::string& line) {
+			return std::string::npos != output.find(line);
+		}
+	}
+
+	// region WriteCounterMetrics
+
+	TEST(TEST_CLASS, WriteCounterMetricsWritesNothingWhenThereAreNoCounters) {
+		// Act:
+		auto output = Collect([](auto& writer) { WriteCounterMetrics(writer, {}); });
+
+		// Assert:
+		EXPECT_EQ("", output);
+	}
+
+	TEST(TEST_CLASS, WriteCounterMetricsWritesAllCountersAsGauges) {
+		// Arrange:
+		auto counters = std::vector<utils::DiagnosticCounter>{ CreateCounter("ACNTST C", 7), CreateCounter("UT CACHE", 123) };
+
+		// Act:
+		auto output = Collect([&counters](auto& writer) { WriteCounterMetrics(writer, counters); });
+
+		// Assert:
+		EXPECT_EQ(
+				"# TYPE bitxorcore_acntst_c gauge\n# HELP bitxorcore_acntst_c diagnostic counter ACNTST C\n"
+				"bitxorcore_acntst_c 7\n"
+				"# TYPE bitxorcore_ut_cache gauge\n# HELP bitxorcore_ut_cache diagnostic counter UT CACHE\n"
+				"bitxorcore_ut_cache 123\n",
+				output);
+	}
+
+	TEST(TEST_CLASS, WriteCounterMetricsSkipsCountersWithoutValues) {
+		// Arrange:
+		auto counters = std::vector<utils::DiagnosticCounter>{
+			CreateCounter("ACNTST C", extensions::ServiceLocator::Sentinel_Counter_Value),
+			CreateCounter("UT CACHE", 123)
+		};
+
+		// Act:
+		auto output = Collect([&counters](auto& writer) { WriteCounterMetrics(writer, counters); });
+
+		// Assert:
+		EXPECT_EQ(Ut_Cache_Counter_Metrics, output);
+	}
+
+	TEST(TEST_CLASS, WriteCounterMetricsSkipsCountersWithDuplicateSanitizedNames) {
+		// Arrange:
+		auto counters = std::vector<utils::DiagnosticCounter>{ CreateCounter("UT CACHE", 123), CreateCounter("UT  CACHE", 456) };
+
+		// Act:
+		auto output = Collect([&counters](auto& writer) { WriteCounterMetrics(writer, counters); });
+
+		// Assert: only the first counter is written
+		EXPECT_EQ(Ut_Cache_Counter_Metrics, output);
+	}
+
+	// endregion
+
+	// region WriteDispatcherMetrics
+
+	namespace {
+		constexpr auto Dispatcher_Family_Header =
+				"# TYPE bitxorcore_dispatcher_consumer_duration_seconds histogram\n"
+				"# HELP bitxorcore_dispatcher_consumer_duration_seconds time spent by dispatcher consumers processing elements\n";
+
+		disruptor::DisruptorConsumer CreateNoOpConsumer() {
+			return [](const auto&) { return disruptor::ConsumerResult::Continue(); };
+		}
+	}
+
+	TEST(TEST_CLASS, WriteDispatcherMetricsWritesOnlyFamilyWhenThereAreNoDispatchers) {
+		// Act:
+		auto output = Collect([](auto& writer) { WriteDispatcherMetrics(writer, {}); });
+
+		// Assert:
+		EXPECT_EQ(Dispatcher_Family_Header, output);
+	}
+
+	TEST(TEST_CLASS, WriteDispatcherMetricsWritesHistogramForEachConsumerOfEachDispatcher) {
+		// Arrange:
+		auto options = disruptor::ConsumerDispatcherOptions("foo", 16);
+		disruptor::ConsumerDispatcher dispatcher1(options, { CreateNoOpConsumer(), CreateNoOpConsumer() });
+		disruptor::ConsumerDispatcher dispatcher2(options, { CreateNoOpConsumer() });
+		auto dispatchers = std::vector<NamedConsumerDispatcher>{ { "alpha", &dispatcher1 }, { "beta", &dispatcher2 } };
+
+		// Act:
+		auto output = Collect([&dispatchers](auto& writer) { WriteDispatcherMetrics(writer, dispatchers); });
+
+		// Assert:
+		EXPECT_EQ(0u, output.find(Dispatcher_Family_Header));
+		auto allLabels = {
+			"dispatcher=\"alpha\",consumer=\"0\"",
+			"dispatcher=\"alpha\",consumer=\"1\"",
+			"dispatcher=\"beta\",consumer=\"0\""
+		};
+		for (const auto* labels : allLabels) {
+			auto prefix = std::string("bitxorcore_dispatcher_consumer_duration_seconds");
+			EXPECT_TRUE(Contains(output, prefix + "_bucket{" + labels + ",le=\"+Inf\"} 0\n")) << labels;
+			EXPECT_TRUE(Contains(output, prefix + "_count{" + labels + "} 0\n")) << labels;
+			EXPECT_TRUE(Contains(output, prefix + "_sum{" + labels + "} 0\n")) << labels;
+		}
+
+		EXPECT_FALSE(Contains(output, "dispatcher=\"beta\",consumer=\"1\""));
+	}
+
+	// endregion
+
+	// region WritePacketHandlerMetrics
+
+	namespace {
+		class MockPacketHandlerDispatcher : public ionet::PacketHandlerDispatcher {
+		public:
+			size_t numPendingPackets() const override {
+				return 0;
+			}
+
+			size_t numPendingPackets(ionet::PacketType type) const override {
+				return 10 * utils::to_underlying_type(type);
+			}
+
+			size_t numActivePeers() const override {
+				return 0;
+			}
+
+			size_t numRejectedPackets() const override {
+				return 0;
+			}
+
+			bool dispatch(const Key&, ionet::PacketType, const action&) override {
+				return false;
+			}
+		};
+
+		std::vector<ionet::PacketHandlerStatistics> CreatePacketHandlerStatistics() {
+			return {
+				{ ionet::PacketType::Push_Block, ionet::PacketHandlerCost::Light, 3, 1'500'000, 750'000 },
+				{ ionet::PacketType::Pull_Blocks, ionet::PacketHandlerCost::Heavy, 2, 250, 200 }
+			};
+		}
+
+		constexpr auto Packet_Handler_Duration_Metrics =
+				"# TYPE bitxorcore_packet_handler_duration_seconds summary\n"
+				"# HELP bitxorcore_packet_handler_duration_seconds time spent handling packets\n"
+				"bitxorcore_packet_handler_duration_seconds_count{type=\"Push_Block\",cost=\"light\"} 3\n"
+				"bitxorcore_packet_handler_duration_seconds_sum{type=\"Push_Block\",cost=\"light\"} 1.5\n"
+				"bitxorcore_packet_handler_duration_seconds_count{type=\"Pull_Blocks\",cost=\"heavy\"} 2\n"
+				"bitxorcore_packet_handler_duration_seconds_sum{type=\"Pull_Blocks\",cost=\"heavy\"} 0.00025\n"
+				"# TYPE bitxorcore_packet_handler_max_duration_seconds gauge\n"
+				"# HELP bitxorcore_packet_handler_max_duration_seconds longest time spent handling a packet\n"
+				"bitxorcore_packet_handler_max_duration_seconds{type=\"Push_Block\",cost=\"light\"} 0.75\n"
+				"bitxorcore_packet_handler_max_duration_seconds{type=\"Pull_Blocks\",cost=\"heavy\"} 0.0002\n";
+	}
+
+	TEST(TEST_CLASS, WritePacketHandlerMetricsWritesStatisticsWithoutHeavyDispatcher) {
+		// Arrange:
+		auto statistics = CreatePacketHandlerStatistics();
+
+		// Act:
+		auto output = Collect([&statistics](auto& writer) { WritePacketHandlerMetrics(writer, statistics, nullptr); });
+
+		// Assert:
+		EXPECT_EQ(Packet_Handler_Duration_Metrics, output);
+	}
+
+	TEST(TEST_CLASS, WritePacketHandlerMetricsWritesStatisticsAndPendingHeavyPacketsWithHeavyDispatcher) {
+		// Arrange:
+		auto statistics = CreatePacketHandlerStatistics();
+		MockPacketHandlerDispatcher heavyDispatcher;
+
+		// Act:
+		auto output = Collect([&statistics, &heavyDispatcher](auto& writer) {
+			WritePacketHandlerMetrics(writer, statistics, &heavyDispatcher);
+		});
+
+		// Assert: only pending packets for heavy handlers are written
+		auto expectedNumPendingPackets = 10 * utils::to_underlying_type(ionet::PacketType::Pull_Blocks);
+		EXPECT_EQ(
+				std::string(Packet_Handler_Duration_Metrics)
+						+ "# TYPE bitxorcore_packet_handler_pending_packets gauge\n"
+						+ "# HELP bitxorcore_packet_handler_pending_packets heavy packets waiting to be handled\n"
+						+ "bitxorcore_packet_handler_pending_packets{type=\"Pull_Blocks\"} "
+						+ std::to_string(expectedNumPendingPackets) + "\n",
+				output);
+	}
+
+	// endregion
+
+	// region WriteResolutionCacheMetrics
+
+	TEST(TEST_CLASS, WriteResolutionCacheMetricsWritesAllStatistics) {
+		// Arrange:
+		model::ResolutionCacheStatistics statistics;
+		statistics.NumHits = 11;
+		statistics.NumMisses = 4;
+		statistics.NumInvalidations = 2;
+
+		// Act:
+		auto output = Collect([&statistics](auto& writer) { WriteResolutionCacheMetrics(writer, statistics); });
+
+		// Assert:
+		EXPECT_EQ(
+				"# TYPE bitxorcore_resolution_cache_hits counter\n"
+				"# HELP bitxorcore_resolution_cache_hits resolutions served from cache\n"
+				"bitxorcore_resolution_cache_hits_total 11\n"
+				"# TYPE bitxorcore_resolution_cache_misses counter\n"
+				"# HELP bitxorcore_resolution_cache_misses resolutions not found in cache\n"
+				"bitxorcore_resolution_cache_misses_total 4\n"
+				"# TYPE bitxorcore_resolution_cache_invalidations counter\n"
+				"# HELP bitxorcore_resolution_cache_invalidations times resolution cache was cleared\n"
+				"bitxorcore_resolution_cache_invalidations_total 2\n",
+				output);
+	}
+
+	// endregion
+
+	// region WriteCacheDatabaseMetrics
+
+	TEST(TEST_CLASS, WriteCacheDatabaseMetricsWritesAllStatistics) {
+		// Arrange:
+		cache::SharedRocksDatabaseStatistics statistics;
+		statistics.NumEstimatedKeys = 1;
+		statistics.MemtablesSize = 2;
+		statistics.LiveSstFilesSize = 3;
+		statistics.PendingCompactionSize = 4;
+		statistics.NumBlockCacheHits = 5;
+		statistics.NumBlockCacheMisses = 6;
+		statistics.NumBytesRead = 7;
+		statistics.NumBytesWritten = 8;
+
+		// Act:
+		auto output = Collect([&statistics](auto& writer) { WriteCacheDatabaseMetrics(writer, statistics); });
+
+		// Assert:
+		EXPECT_TRUE(Contains(output, "# TYPE bitxorcore_cache_database_keys gauge\n"));
+		EXPECT_TRUE(Contains(output, "\nbitxorcore_cache_database_keys 1\n"));
+		EXPECT_TRUE(Contains(output, "\nbitxorcore_cache_database_memtables_bytes 2\n"));
+		EXPECT_TRUE(Contains(output, "\nbitxorcore_cache_database_live_sst_files_bytes 3\n"));
+		EXPECT_TRUE(Contains(output, "\nbitxorcore_cache_database_pending_compaction_bytes 4\n"));
+
+		EXPECT_TRUE(Contains(output, "# TYPE bitxorcore_cache_database_block_cache_hits counter\n"));
+		EXPECT_TRUE(Contains(output, "\nbitxorcore_cache_database_block_cache_hits_total 5\n"));
+		EXPECT_TRUE(Contains(output, "\nbitxorcore_cache_database_block_cache_misses_total 6\n"));
+		EXPECT_TRUE(Contains(output, "\nbitxorcore_cache_database_read_bytes_total 7\n"));
+		EXPECT_TRUE(Contains(output, "\nbitxorcore_cache_database_written_bytes_total 8\n"));
+	}
+
+	// endregion
+}}
@@ -0,0 +1,88 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "metrics/src/MetricsConfiguration.h"
+#include "tests/test/nodeps/ConfigurationTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace bitxorcore { namespace metrics {
+
+#define TEST_CLASS MetricsConfigurationTests
+
+	namespace {
+		struct MetricsConfigurationTraits {
+			using ConfigurationType = MetricsConfiguration;
+
+			static utils::ConfigurationBag::ValuesContainer CreateProperties() {
+				return {
+					{
+						"metrics",
+						{
+							{ "listenInterface", "2.4.8.16" },
+							{ "port", "9753" },
+							{ "requestTimeout", "7s" }
+						}
+					}
+				};
+			}
+
+			static bool IsSectionOptional(const std::string&) {
+				return false;
+			}
+
+			static void AssertZero(const MetricsConfiguration& config) {
+				// Assert:
+				EXPECT_EQ("", config.ListenInterface);
+				EXPECT_EQ(0u, config.Port);
+				EXPECT_EQ(utils::TimeSpan(), config.RequestTimeout);
+			}
+
+			static void AssertCustom(const MetricsConfiguration& config) {
+				// Assert:
+				EXPECT_EQ("2.4.8.16", config.ListenInterface);
+				EXPECT_EQ(9753u, config.Port);
+				EXPECT_EQ(utils::TimeSpan::FromSeconds(7), config.RequestTimeout);
+			}
+		};
+	}
+
+	DEFINE_CONFIGURATION_TESTS(TEST_CLASS, Metrics)
+
+	// region file io
+
+	TEST(TEST_CLASS, LoadFromPathFailsWhenFileDoesNotExist) {
+		// Act + Assert: attempt to load the config
+		EXPECT_THROW(MetricsConfiguration::LoadFromPath("../no-resources"), bitxorcore_runtime_error);
+	}
+
+	TEST(TEST_CLASS, CanLoadConfigFromResourcesDirectory) {
+		// Act: attempt to load from the "real" resources directory
+		auto config = MetricsConfiguration::LoadFromPath("../resources");
+
+		// Assert:
+		EXPECT_EQ("127.0.0.1", config.ListenInterface);
+		EXPECT_EQ(7903u, config.Port);
+		EXPECT_EQ(utils::TimeSpan::FromSeconds(5), config.RequestTimeout);
+	}
+
+	// endregion
+}}
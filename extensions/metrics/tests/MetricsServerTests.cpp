@@ -0,0 +1,308 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "metrics/src/MetricsServer.h"
+#include "bitxorcore/thread/IoThreadPool.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/core/WaitFunctions.h"
+#include "tests/test/net/SocketTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace bitxorcore { namespace metrics {
+
+#define TEST_CLASS MetricsServerTests
+
+	namespace {
+		constexpr auto Metrics_Request = "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n";
+
+		// region TestContext
+
+		class TestContext {
+		public:
+			TestContext() : TestContext(MetricsServerSettings())
+			{}
+
+			explicit TestContext(const MetricsServerSettings& settings)
+					: m_pPool(test::CreateStartedIoThreadPool())
+					, m_numSupplierCalls(0)
+					, m_numResourceSupplierCalls(0) {
+				auto resourceSupplier = [this]() {
+					++m_numResourceSupplierCalls;
+					return std::string("{\"resource\":") + std::to_string(m_numResourceSupplierCalls) + "}";
+				};
+				m_pServer = CreateMetricsServer(*m_pPool, test::CreateLocalHostEndpoint(), settings, [this]() {
+					++m_numSupplierCalls;
+					return "metrics " + std::to_string(m_numSupplierCalls) + "\n# EOF\n";
+				}, { { "/resource", "application/json", resourceSupplier } });
+			}
+
+			~TestContext() {
+				shutdown();
+			}
+
+		public:
+			MetricsServer& server() {
+				return *m_pServer;
+			}
+
+			size_t numSupplierCalls() const {
+				return m_numSupplierCalls;
+			}
+
+			size_t numResourceSupplierCalls() const {
+				return m_numResourceSupplierCalls;
+			}
+
+		public:
+			std::string sendRequest(const std::string& request) {
+				boost::asio::io_context ioContext;
+				boost::asio::ip::tcp::socket socket(ioContext);
+				socket.connect(test::CreateLocalHostEndpoint());
+				boost::asio::write(socket, boost::asio::buffer(request));
+
+				boost::system::error_code ec;
+				std::string response;
+				boost::asio::read(socket, boost::asio::dynamic_buffer(response), ec);
+				return response;
+			}
+
+			void shutdown() {
+				if (!m_pServer)
+					return;
+
+				m_pServer->shutdown();
+				test::WaitForUnique(m_pServer, "m_pServer");
+				m_pPool->join();
+				m_pServer.reset();
+			}
+
+		private:
+			std::unique_ptr<thread::IoThreadPool> m_pPool;
+			std::shared_ptr<MetricsServer> m_pServer;
+			std::atomic<size_t> m_numSupplierCalls;
+			std::atomic<size_t> m_numResourceSupplierCalls;
+		};
+
+		// endregion
+
+		std::string GetStatusLine(const std::string& response) {
+			return response.substr(0, response.find("\r\n"));
+		}
+
+		std::string GetBody(const std::string& response) {
+			auto separatorIndex = response.find("\r\n\r\n");
+			return std::string::npos == separatorIndex ? std::string() : response.substr(separatorIndex + 4);
+		}
+
+		void AssertErrorResponse(const std::string& request, const std::string& expectedStatus, uint64_t expectedNumRejectedRequests) {
+			// Arrange:
+			TestContext context;
+
+			// Act:
+			auto response = context.sendRequest(request);
+
+			// Assert:
+			EXPECT_EQ("HTTP/1.1 " + expectedStatus, GetStatusLine(response));
+			EXPECT_EQ(expectedStatus + "\n", GetBody(response));
+			EXPECT_EQ(0u, context.numSupplierCalls());
+			EXPECT_EQ(0u, context.numResourceSupplierCalls());
+			EXPECT_EQ(0u, context.server().numScrapes());
+			EXPECT_EQ(expectedNumRejectedRequests, context.server().numRejectedRequests());
+		}
+	}
+
+	// region basic
+
+	TEST(TEST_CLASS, CanCreateServer) {
+		// Act:
+		TestContext context;
+
+		// Assert:
+		EXPECT_EQ(test::CreateLocalHostEndpoint(), context.server().localEndpoint());
+		EXPECT_EQ(0u, context.server().numScrapes());
+		EXPECT_EQ(0u, context.server().numRejectedRequests());
+
+		// - metrics are not collected until they are requested
+		EXPECT_EQ(0u, context.numSupplierCalls());
+	}
+
+	TEST(TEST_CLASS, ServerStopsAcceptingConnectionsAfterShutdown) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		context.shutdown();
+
+		// Assert:
+		boost::asio::io_context ioContext;
+		boost::asio::ip::tcp::socket socket(ioContext);
+		boost::system::error_code ec;
+		socket.connect(test::CreateLocalHostEndpoint(), ec);
+		EXPECT_TRUE(!!ec);
+	}
+
+	// endregion
+
+	// region metrics requests
+
+	TEST(TEST_CLASS, CanServeMetrics) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		auto response = context.sendRequest(Metrics_Request);
+
+		// Assert:
+		EXPECT_EQ("HTTP/1.1 200 OK", GetStatusLine(response));
+		EXPECT_NE(std::string::npos, response.find("\r\nContent-Type: application/openmetrics-text; version=1.0.0; charset=utf-8\r\n"));
+		EXPECT_NE(std::string::npos, response.find("\r\nContent-Length: 16\r\n"));
+		EXPECT_EQ("metrics 1\n# EOF\n", GetBody(response));
+
+		EXPECT_EQ(1u, context.numSupplierCalls());
+		EXPECT_EQ(1u, context.server().numScrapes());
+		EXPECT_EQ(0u, context.server().numRejectedRequests());
+	}
+
+	TEST(TEST_CLASS, MetricsAreCollectedForEachRequest) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		auto response1 = context.sendRequest(Metrics_Request);
+		auto response2 = context.sendRequest(Metrics_Request);
+		auto response3 = context.sendRequest(Metrics_Request);
+
+		// Assert:
+		EXPECT_EQ("metrics 1\n# EOF\n", GetBody(response1));
+		EXPECT_EQ("metrics 2\n# EOF\n", GetBody(response2));
+		EXPECT_EQ("metrics 3\n# EOF\n", GetBody(response3));
+
+		EXPECT_EQ(3u, context.numSupplierCalls());
+		EXPECT_EQ(3u, context.server().numScrapes());
+	}
+
+	TEST(TEST_CLASS, QueryStringIsIgnored) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		auto response = context.sendRequest("GET /metrics?name=foo HTTP/1.0\r\n\r\n");
+
+		// Assert:
+		EXPECT_EQ("HTTP/1.1 200 OK", GetStatusLine(response));
+		EXPECT_EQ("metrics 1\n# EOF\n", GetBody(response));
+		EXPECT_EQ(1u, context.server().numScrapes());
+	}
+
+	// endregion
+
+	// region resource requests
+
+	TEST(TEST_CLASS, CanServeResource) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		auto response = context.sendRequest("GET /resource HTTP/1.1\r\n\r\n");
+
+		// Assert:
+		EXPECT_EQ("HTTP/1.1 200 OK", GetStatusLine(response));
+		EXPECT_NE(std::string::npos, response.find("\r\nContent-Type: application/json\r\n"));
+		EXPECT_NE(std::string::npos, response.find("\r\nContent-Length: 14\r\n"));
+		EXPECT_EQ("{\"resource\":1}", GetBody(response));
+
+		// - resource requests are not scrapes
+		EXPECT_EQ(0u, context.numSupplierCalls());
+		EXPECT_EQ(1u, context.numResourceSupplierCalls());
+		EXPECT_EQ(0u, context.server().numScrapes());
+		EXPECT_EQ(0u, context.server().numRejectedRequests());
+	}
+
+	TEST(TEST_CLASS, ResourceIsCollectedForEachRequest) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		auto response1 = context.sendRequest("GET /resource HTTP/1.1\r\n\r\n");
+		auto response2 = context.sendRequest("GET /resource?name=foo HTTP/1.1\r\n\r\n");
+
+		// Assert:
+		EXPECT_EQ("{\"resource\":1}", GetBody(response1));
+		EXPECT_EQ("{\"resource\":2}", GetBody(response2));
+		EXPECT_EQ(2u, context.numResourceSupplierCalls());
+	}
+
+	// endregion
+
+	// region error requests
+
+	TEST(TEST_CLASS, UnknownPathIsNotFound) {
+		AssertErrorResponse("GET /foo HTTP/1.1\r\n\r\n", "404 Not Found", 0);
+		AssertErrorResponse("GET /metrics/foo HTTP/1.1\r\n\r\n", "404 Not Found", 0);
+		AssertErrorResponse("GET /resource/foo HTTP/1.1\r\n\r\n", "404 Not Found", 0);
+	}
+
+	TEST(TEST_CLASS, UnsupportedMethodIsNotAllowed) {
+		AssertErrorResponse("POST /metrics HTTP/1.1\r\n\r\n", "405 Method Not Allowed", 0);
+		AssertErrorResponse("DELETE /metrics HTTP/1.1\r\n\r\n", "405 Method Not Allowed", 0);
+		AssertErrorResponse("POST /resource HTTP/1.1\r\n\r\n", "405 Method Not Allowed", 0);
+	}
+
+	TEST(TEST_CLASS, MalformedRequestIsRejected) {
+		AssertErrorResponse("hello\r\n\r\n", "400 Bad Request", 1);
+		AssertErrorResponse("GET /metrics\r\n\r\n", "400 Bad Request", 1);
+	}
+
+	TEST(TEST_CLASS, OversizedRequestIsRejected) {
+		// Arrange:
+		auto settings = MetricsServerSettings();
+		settings.MaxRequestSize = 100;
+		TestContext context(settings);
+
+		// Act:
+		auto response = context.sendRequest("GET /metrics HTTP/1.1\r\nX-Padding: " + std::string(200, 'x') + "\r\n\r\n");
+
+		// Assert:
+		EXPECT_EQ("HTTP/1.1 400 Bad Request", GetStatusLine(response));
+		EXPECT_EQ(0u, context.numSupplierCalls());
+		EXPECT_EQ(0u, context.server().numScrapes());
+		EXPECT_EQ(1u, context.server().numRejectedRequests());
+	}
+
+	TEST(TEST_CLASS, IncompleteRequestTimesOut) {
+		// Arrange:
+		auto settings = MetricsServerSettings();
+		settings.RequestTimeout = utils::TimeSpan::FromMilliseconds(50);
+		TestContext context(settings);
+
+		// Act: send a request without a terminating empty line
+		auto response = context.sendRequest("GET /metrics HTTP/1.1\r\n");
+
+		// Assert: connection was closed without a response
+		EXPECT_EQ("", response);
+		EXPECT_EQ(0u, context.numSupplierCalls());
+		EXPECT_EQ(0u, context.server().numScrapes());
+		EXPECT_EQ(1u, context.server().numRejectedRequests());
+	}
+
+	// endregion
+}}
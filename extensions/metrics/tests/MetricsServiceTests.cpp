@@ -0,0 +1,195 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "metrics/src/MetricsService.h"
+#include "metrics/src/MetricsServer.h"
+#include "bitxorcore/disruptor/ConsumerDispatcher.h"
+#include "bitxorcore/utils/TraceRecorder.h"
+#include "tests/test/local/ServiceLocatorTestContext.h"
+#include "tests/test/local/ServiceTestUtils.h"
+#include "tests/test/net/SocketTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace bitxorcore { namespace metrics {
+
+#define TEST_CLASS MetricsServiceTests
+
+	namespace {
+		constexpr auto Service_Name = "metrics.server";
+		constexpr auto Num_Scrapes_Counter_Name = "METRICS SCRP";
+		constexpr auto Num_Rejected_Requests_Counter_Name = "METRICS REJ";
+
+		struct MetricsServiceTraits {
+			static auto CreateRegistrar() {
+				auto config = MetricsConfiguration::Uninitialized();
+				config.ListenInterface = "127.0.0.1";
+				config.Port = test::CreateLocalHostEndpoint().port();
+				config.RequestTimeout = utils::TimeSpan::FromSeconds(5);
+				return CreateMetricsServiceRegistrar(config);
+			}
+		};
+
+		using TestContext = test::ServiceLocatorTestContext<MetricsServiceTraits>;
+
+		std::string Get(const std::string& path) {
+			boost::asio::io_context ioContext;
+			boost::asio::ip::tcp::socket socket(ioContext);
+			socket.connect(test::CreateLocalHostEndpoint());
+			boost::asio::write(socket, boost::asio::buffer("GET " + path + " HTTP/1.1\r\nHost: localhost\r\n\r\n"));
+
+			boost::system::error_code ec;
+			std::string response;
+			boost::asio::read(socket, boost::asio::dynamic_buffer(response), ec);
+			return response;
+		}
+
+		std::string Scrape() {
+			return Get("/metrics");
+		}
+
+		bool Contains(const std::string& response, const std::string& text) {
+			return std::string::npos != response.find(text);
+		}
+	}
+
+	// region basic
+
+	ADD_SERVICE_REGISTRAR_INFO_TEST(Metrics, Post_Tasks)
+
+	TEST(TEST_CLASS, CanBootService) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		context.boot();
+
+		// Assert:
+		EXPECT_EQ(1u, context.locator().numServices());
+		EXPECT_EQ(2u, context.locator().counters().size());
+
+		EXPECT_TRUE(!!context.locator().service<MetricsServer>(Service_Name));
+
+		EXPECT_EQ(0u, context.counter(Num_Scrapes_Counter_Name));
+		EXPECT_EQ(0u, context.counter(Num_Rejected_Requests_Counter_Name));
+	}
+
+	TEST(TEST_CLASS, CanShutdownService) {
+		// Arrange:
+		TestContext context;
+		context.boot();
+
+		// Act:
+		context.shutdown();
+
+		// Assert:
+		EXPECT_EQ(1u, context.locator().numServices());
+		EXPECT_EQ(2u, context.locator().counters().size());
+
+		EXPECT_FALSE(!!context.locator().service<MetricsServer>(Service_Name));
+
+		EXPECT_EQ(extensions::ServiceLocator::Sentinel_Counter_Value, context.counter(Num_Scrapes_Counter_Name));
+		EXPECT_EQ(extensions::ServiceLocator::Sentinel_Counter_Value, context.counter(Num_Rejected_Requests_Counter_Name));
+	}
+
+	// endregion
+
+	// region scrape
+
+	TEST(TEST_CLASS, CanScrapeNodeMetrics) {
+		// Arrange:
+		TestContext context;
+		context.boot();
+
+		// Act:
+		auto response = Scrape();
+
+		// Assert: spot check families from all sources
+		EXPECT_EQ(0u, response.find("HTTP/1.1 200 OK\r\n"));
+		EXPECT_TRUE(Contains(response, "# TYPE bitxorcore_metrics_scrp gauge\n"));
+		EXPECT_TRUE(Contains(response, "# TYPE bitxorcore_dispatcher_consumer_duration_seconds histogram\n"));
+		EXPECT_TRUE(Contains(response, "# TYPE bitxorcore_packet_handler_duration_seconds summary\n"));
+		EXPECT_TRUE(Contains(response, "\nbitxorcore_resolution_cache_hits_total 0\n"));
+		EXPECT_FALSE(Contains(response, "bitxorcore_cache_database_"));
+		EXPECT_TRUE(Contains(response, "\n# EOF\n"));
+
+		EXPECT_EQ(1u, context.counter(Num_Scrapes_Counter_Name));
+		EXPECT_EQ(0u, context.counter(Num_Rejected_Requests_Counter_Name));
+	}
+
+	TEST(TEST_CLASS, CanScrapeLatenciesOfRegisteredDispatchers) {
+		// Arrange: register a dispatcher before booting the service
+		TestContext context;
+		auto options = disruptor::ConsumerDispatcherOptions("block dispatcher", 16);
+		auto consumer = [](const auto&) { return disruptor::ConsumerResult::Continue(); };
+		auto pDispatcher = std::make_shared<disruptor::ConsumerDispatcher>(options, std::vector<disruptor::DisruptorConsumer>{ consumer });
+		context.locator().registerRootedService("dispatcher.block", pDispatcher);
+		context.boot();
+
+		// Act:
+		auto response = Scrape();
+
+		// Assert:
+		EXPECT_TRUE(Contains(
+				response,
+				"\nbitxorcore_dispatcher_consumer_duration_seconds_count{dispatcher=\"dispatcher.block\",consumer=\"0\"} 0\n"));
+		EXPECT_FALSE(Contains(response, "dispatcher=\"dispatcher.transaction\""));
+	}
+
+	// endregion
+
+	// region trace
+
+	TEST(TEST_CLASS, TraceIsNotAvailableWhenTraceRecorderIsNotRegistered) {
+		// Arrange:
+		TestContext context;
+		context.boot();
+
+		// Act:
+		auto response = Get("/trace");
+
+		// Assert:
+		EXPECT_EQ(0u, response.find("HTTP/1.1 404 Not Found\r\n"));
+	}
+
+	TEST(TEST_CLASS, TraceIsAvailableWhenTraceRecorderIsRegistered) {
+		// Arrange: register a trace recorder before booting the service
+		TestContext context;
+		auto pTraceRecorder = std::make_shared<utils::TraceRecorder>(10, []() { return std::string("tracer"); });
+		pTraceRecorder->record({ "dispatcher", "alpha", 100, 25, Height(), utils::ShortHash(), 0 });
+		context.locator().registerRootedService("dispatcher.tracer", pTraceRecorder);
+		context.boot();
+
+		// Act:
+		auto response = Get("/trace");
+
+		// Assert:
+		EXPECT_EQ(0u, response.find("HTTP/1.1 200 OK\r\n"));
+		EXPECT_TRUE(Contains(response, "\r\nContent-Type: application/json\r\n"));
+		EXPECT_TRUE(Contains(response, "\r\n\r\n{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+		EXPECT_TRUE(Contains(response, "\"name\":\"alpha\",\"ts\":100,\"dur\":25}"));
+
+		// - trace requests are not scrapes
+		EXPECT_EQ(0u, context.counter(Num_Scrapes_Counter_Name));
+	}
+
+	// endregion
+}}
@@ -0,0 +1,256 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "metrics/src/OpenMetricsWriter.h"
+#include "tests/TestHarness.h"
+#include <sstream>
+
+namespace bitxorcore { namespace metrics {
+
+#define TEST_CLASS OpenMetricsWriterTests
+
+	// region SanitizeMetricName
+
+	TEST(TEST_CLASS, SanitizeMetricNameLowercasesValidNames) {
+		EXPECT_EQ("foo", SanitizeMetricName("foo"));
+		EXPECT_EQ("foo_bar:baz9", SanitizeMetricName("Foo_BAR:baz9"));
+	}
+
+	TEST(TEST_CLASS, SanitizeMetricNameReplacesRunsOfInvalidCharactersWithUnderscore) {
+		EXPECT_EQ("ut_cache_mem", SanitizeMetricName("UT CACHE MEM"));
+		EXPECT_EQ("acntst_c_hvy", SanitizeMetricName("ACNTST C  HVY"));
+		EXPECT_EQ("a_b", SanitizeMetricName("a - b"));
+	}
+
+	TEST(TEST_CLASS, SanitizeMetricNameDropsLeadingAndTrailingInvalidCharacters) {
+		EXPECT_EQ("foo", SanitizeMetricName("  foo  "));
+		EXPECT_EQ("x9", SanitizeMetricName("9 x9"));
+		EXPECT_EQ("", SanitizeMetricName(" - "));
+	}
+
+	// endregion
+
+	// region writeFamily
+
+	TEST(TEST_CLASS, CanWriteFamily) {
+		// Arrange:
+		std::ostringstream out;
+		OpenMetricsWriter writer(out);
+
+		// Act:
+		writer.writeFamily("bxr_alpha", MetricType::Counter, "alpha help");
+		writer.writeFamily("bxr_beta", MetricType::Gauge, "beta help");
+		writer.writeFamily("bxr_gamma", MetricType::Histogram, "gamma help");
+		writer.writeFamily("bxr_delta", MetricType::Summary, "delta help");
+
+		// Assert:
+		EXPECT_EQ(
+				"# TYPE bxr_alpha counter\n# HELP bxr_alpha alpha help\n"
+				"# TYPE bxr_beta gauge\n# HELP bxr_beta beta help\n"
+				"# TYPE bxr_gamma histogram\n# HELP bxr_gamma gamma help\n"
+				"# TYPE bxr_delta summary\n# HELP bxr_delta delta help\n",
+				out.str());
+	}
+
+	TEST(TEST_CLASS, CannotWriteFamilyWithInvalidName) {
+		// Arrange:
+		std::ostringstream out;
+		OpenMetricsWriter writer(out);
+
+		// Act + Assert:
+		for (const auto& name : { "", "9lives", "foo bar", "foo-bar" })
+			EXPECT_THROW(writer.writeFamily(name, MetricType::Gauge, "help"), bitxorcore_invalid_argument) << name;
+	}
+
+	// endregion
+
+	// region writeValue / writeDuration
+
+	TEST(TEST_CLASS, CanWriteGaugeValues) {
+		// Arrange:
+		std::ostringstream out;
+		OpenMetricsWriter writer(out);
+		writer.writeFamily("bxr_size", MetricType::Gauge, "size");
+
+		// Act:
+		writer.writeValue({}, 12);
+		writer.writeValue({ { "cache", "account" } }, 0);
+		writer.writeValue({ { "cache", "token" }, { "kind", "delta" } }, 98765);
+
+		// Assert:
+		EXPECT_EQ(
+				"# TYPE bxr_size gauge\n# HELP bxr_size size\n"
+				"bxr_size 12\n"
+				"bxr_size{cache=\"account\"} 0\n"
+				"bxr_size{cache=\"token\",kind=\"delta\"} 98765\n",
+				out.str());
+	}
+
+	TEST(TEST_CLASS, CanWriteCounterValues) {
+		// Arrange:
+		std::ostringstream out;
+		OpenMetricsWriter writer(out);
+		writer.writeFamily("bxr_packets", MetricType::Counter, "packets");
+
+		// Act:
+		writer.writeValue({ { "type", "Push_Block" } }, 7);
+
+		// Assert: counter samples have a total suffix
+		EXPECT_EQ("# TYPE bxr_packets counter\n# HELP bxr_packets packets\nbxr_packets_total{type=\"Push_Block\"} 7\n", out.str());
+	}
+
+	TEST(TEST_CLASS, CanWriteDurations) {
+		// Arrange:
+		std::ostringstream out;
+		OpenMetricsWriter writer(out);
+		writer.writeFamily("bxr_max_seconds", MetricType::Gauge, "max");
+
+		// Act:
+		for (auto micros : { 0ull, 1ull, 250'000ull, 1'000'000ull, 12'345'678ull })
+			writer.writeDuration({}, micros);
+
+		// Assert: durations are written in seconds
+		EXPECT_EQ(
+				"# TYPE bxr_max_seconds gauge\n# HELP bxr_max_seconds max\n"
+				"bxr_max_seconds 0\n"
+				"bxr_max_seconds 0.000001\n"
+				"bxr_max_seconds 0.25\n"
+				"bxr_max_seconds 1\n"
+				"bxr_max_seconds 12.345678\n",
+				out.str());
+	}
+
+	TEST(TEST_CLASS, LabelValuesAreEscaped) {
+		// Arrange:
+		std::ostringstream out;
+		OpenMetricsWriter writer(out);
+		writer.writeFamily("bxr_info", MetricType::Gauge, "info");
+
+		// Act:
+		writer.writeValue({ { "name", "a\"b\\c\nd" } }, 1);
+
+		// Assert:
+		EXPECT_EQ("# TYPE bxr_info gauge\n# HELP bxr_info info\nbxr_info{name=\"a\\\"b\\\\c\\nd\"} 1\n", out.str());
+	}
+
+	// endregion
+
+	// region writeHistogram / writeSummary
+
+	TEST(TEST_CLASS, CanWriteHistogram) {
+		// Arrange:
+		utils::LatencyHistogram histogram;
+		for (auto micros : { 1u, 3u, 3u, 1000u, 100'000'000u })
+			histogram.record(micros);
+
+		std::ostringstream out;
+		OpenMetricsWriter writer(out);
+		writer.writeFamily("bxr_latency_seconds", MetricType::Histogram, "latency");
+
+		// Act:
+		writer.writeHistogram({ { "consumer", "0" } }, histogram.snapshot());
+
+		// Assert: buckets are cumulative
+		std::ostringstream expected;
+		expected << "# TYPE bxr_latency_seconds histogram\n# HELP bxr_latency_seconds latency\n";
+		for (const auto& pair : std::vector<std::pair<std::string, uint64_t>>{
+			{ "0.000001", 1 }, { "0.000004", 3 }, { "0.000016", 3 }, { "0.000064", 3 }, { "0.000256", 3 },
+			{ "0.001024", 4 }, { "0.004096", 4 }, { "0.016384", 4 }, { "0.065536", 4 }, { "0.262144", 4 },
+			{ "1.048576", 4 }, { "4.194304", 4 }, { "16.777216", 4 }, { "+Inf", 5 }
+		}) {
+			expected << "bxr_latency_seconds_bucket{consumer=\"0\",le=\"" << pair.first << "\"} " << pair.second << "\n";
+		}
+
+		expected << "bxr_latency_seconds_count{consumer=\"0\"} 5\n" << "bxr_latency_seconds_sum{consumer=\"0\"} 100.001007\n";
+		EXPECT_EQ(expected.str(), out.str());
+	}
+
+	TEST(TEST_CLASS, CanWriteSummary) {
+		// Arrange:
+		std::ostringstream out;
+		OpenMetricsWriter writer(out);
+		writer.writeFamily("bxr_handler_seconds", MetricType::Summary, "handler");
+
+		// Act:
+		writer.writeSummary({ { "type", "Pull_Blocks" } }, 3, 1'500'000);
+
+		// Assert:
+		EXPECT_EQ(
+				"# TYPE bxr_handler_seconds summary\n# HELP bxr_handler_seconds handler\n"
+				"bxr_handler_seconds_count{type=\"Pull_Blocks\"} 3\n"
+				"bxr_handler_seconds_sum{type=\"Pull_Blocks\"} 1.5\n",
+				out.str());
+	}
+
+	// endregion
+
+	// region family type checks
+
+	TEST(TEST_CLASS, CannotWriteSampleWithoutFamily) {
+		// Arrange:
+		std::ostringstream out;
+		OpenMetricsWriter writer(out);
+
+		// Act + Assert:
+		EXPECT_THROW(writer.writeValue({}, 1), bitxorcore_invalid_argument);
+		EXPECT_THROW(writer.writeDuration({}, 1), bitxorcore_invalid_argument);
+		EXPECT_THROW(writer.writeHistogram({}, utils::LatencyHistogramSnapshot()), bitxorcore_invalid_argument);
+		EXPECT_THROW(writer.writeSummary({}, 1, 1), bitxorcore_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CannotWriteSampleIncompatibleWithFamily) {
+		// Arrange:
+		std::ostringstream out;
+		OpenMetricsWriter writer(out);
+
+		// Act + Assert:
+		writer.writeFamily("bxr_gauge", MetricType::Gauge, "gauge");
+		EXPECT_THROW(writer.writeHistogram({}, utils::LatencyHistogramSnapshot()), bitxorcore_invalid_argument);
+		EXPECT_THROW(writer.writeSummary({}, 1, 1), bitxorcore_invalid_argument);
+
+		writer.writeFamily("bxr_histogram", MetricType::Histogram, "histogram");
+		EXPECT_THROW(writer.writeValue({}, 1), bitxorcore_invalid_argument);
+		EXPECT_THROW(writer.writeSummary({}, 1, 1), bitxorcore_invalid_argument);
+
+		writer.writeFamily("bxr_summary", MetricType::Summary, "summary");
+		EXPECT_THROW(writer.writeDuration({}, 1), bitxorcore_invalid_argument);
+		EXPECT_THROW(writer.writeHistogram({}, utils::LatencyHistogramSnapshot()), bitxorcore_invalid_argument);
+	}
+
+	// endregion
+
+	// region writeEof
+
+	TEST(TEST_CLASS, CanWriteEof) {
+		// Arrange:
+		std::ostringstream out;
+		OpenMetricsWriter writer(out);
+
+		// Act:
+		writer.writeEof();
+
+		// Assert:
+		EXPECT_EQ("# EOF\n", out.str());
+	}
+
+	// endregion
+}}
@@ -27,12 +27,14 @@
 #include "bitxorcore/extensions/ServiceLocator.h"
 #include "bitxorcore/extensions/ServiceState.h"
 #include "bitxorcore/extensions/ServiceUtils.h"
+#include "bitxorcore/ionet/PacketHandlerDispatcher.h"
 #include "bitxorcore/thread/MultiServicePool.h"
 
 namespace bitxorcore { namespace packetserver {
 
 	namespace {
 		constexpr auto Service_Name = "readers";
+		constexpr auto Dispatcher_Service_Name = "readers.heavy";
 		constexpr auto Service_Id = ionet::ServiceIdentifier(0x52454144);
 
 		thread::Task CreateAgePeersTask(extensions::ServiceState& state, net::ConnectionContainer& connectionContainer) {
@@ -52,17 +54,37 @@ namespace bitxorcore { namespace packetserver {
 				locator.registerServiceCounter<net::PacketReaders>(Service_Name, "READERS", [](const auto& writers) {
 					return writers.numActiveReaders();
 				});
+
+				using DispatcherType = ionet::PacketHandlerDispatcher;
+				locator.registerServiceCounter<DispatcherType>(Dispatcher_Service_Name, "HEAVY QUEUE", [](const auto& dispatcher) {
+					return dispatcher.numPendingPackets();
+				});
+				locator.registerServiceCounter<DispatcherType>(Dispatcher_Service_Name, "HEAVY PEERS", [](const auto& dispatcher) {
+					return dispatcher.numActivePeers();
+				});
+				locator.registerServiceCounter<DispatcherType>(Dispatcher_Service_Name, "HEAVY REJECT", [](const auto& dispatcher) {
+					return dispatcher.numRejectedPackets();
+				});
 			}
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
 				const auto& config = state.config();
+
+				// heavy handlers are executed by a dedicated pool so that they don't block socket reads
+				auto pHeavyHandlerPool = state.pool().pushComputePool("heavy", { config.Node.HeavyPacketHandlerPoolSize, {} });
+				auto pHeavyHandlerDispatcher = ionet::CreatePacketHandlerDispatcher(pHeavyHandlerPool, {
+					pHeavyHandlerPool->numWorkerThreads(),
+					config.Node.MaxPendingHeavyPacketsPerPeer
+				});
+
 				auto pServiceGroup = state.pool().pushServiceGroup(Service_Name);
 				auto pReaders = pServiceGroup->pushService(
 						net::CreatePacketReaders,
 						state.packetHandlers(),
 						locator.keys().caPublicKey(),
 						extensions::GetConnectionSettings(config),
-						config.Node.MaxIncomingConnectionsPerIdentity);
+						config.Node.MaxIncomingConnectionsPerIdentity,
+						pHeavyHandlerDispatcher);
 				extensions::BootServer(
 						*pServiceGroup,
 						config.Node.Port,
@@ -73,6 +95,7 @@ namespace bitxorcore { namespace packetserver {
 						*pReaders);
 
 				locator.registerService(Service_Name, pReaders);
+				locator.registerService(Dispatcher_Service_Name, pHeavyHandlerDispatcher);
 
 				// add sinks
 				state.hooks().addBannedNodeIdentitySink(extensions::CreateCloseConnectionSink(*pReaders));
@@ -23,6 +23,7 @@
 #include "packetserver/src/NetworkPacketReadersService.h"
 #include "bitxorcore/handlers/BasicProducer.h"
 #include "bitxorcore/handlers/HandlerFactory.h"
+#include "bitxorcore/ionet/PacketHandlerDispatcher.h"
 #include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/local/NetworkTestUtils.h"
 #include "tests/test/local/ServiceLocatorTestContext.h"
@@ -36,6 +37,7 @@ namespace bitxorcore { namespace packetserver {
 	namespace {
 		constexpr auto Counter_Name = "READERS";
 		constexpr auto Service_Name = "readers";
+		constexpr auto Dispatcher_Service_Name = "readers.heavy";
 
 		struct NetworkPacketReadersServiceTraits {
 			static constexpr auto CreateRegistrar = CreateNetworkPacketReadersServiceRegistrar;
@@ -56,11 +58,16 @@ namespace bitxorcore { namespace packetserver {
 		context.boot();
 
 		// Assert:
-		EXPECT_EQ(1u, context.locator().numServices());
-		EXPECT_EQ(1u, context.locator().counters().size());
+		EXPECT_EQ(2u, context.locator().numServices());
+		EXPECT_EQ(4u, context.locator().counters().size());
 
 		EXPECT_TRUE(!!context.locator().service<net::PacketReaders>(Service_Name));
 		EXPECT_EQ(0u, context.counter(Counter_Name));
+
+		EXPECT_TRUE(!!context.locator().service<ionet::PacketHandlerDispatcher>(Dispatcher_Service_Name));
+		EXPECT_EQ(0u, context.counter("HEAVY QUEUE"));
+		EXPECT_EQ(0u, context.counter("HEAVY PEERS"));
+		EXPECT_EQ(0u, context.counter("HEAVY REJECT"));
 	}
 
 	TEST(TEST_CLASS, CanShutdownService) {
@@ -72,11 +79,14 @@ namespace bitxorcore { namespace packetserver {
 		context.shutdown();
 
 		// Assert:
-		EXPECT_EQ(1u, context.locator().numServices());
-		EXPECT_EQ(1u, context.locator().counters().size());
+		EXPECT_EQ(2u, context.locator().numServices());
+		EXPECT_EQ(4u, context.locator().counters().size());
 
 		EXPECT_FALSE(!!context.locator().service<net::PacketReaders>(Service_Name));
 		EXPECT_EQ(static_cast<uint64_t>(extensions::ServiceLocator::Sentinel_Counter_Value), context.counter(Counter_Name));
+
+		EXPECT_FALSE(!!context.locator().service<ionet::PacketHandlerDispatcher>(Dispatcher_Service_Name));
+		EXPECT_EQ(static_cast<uint64_t>(extensions::ServiceLocator::Sentinel_Counter_Value), context.counter("HEAVY QUEUE"));
 	}
 
 	// endregion
@@ -32,6 +32,7 @@
 #include "bitxorcore/consumers/RecentHashCache.h"
 #include "bitxorcore/consumers/ReclaimMemoryInspector.h"
 #include "bitxorcore/consumers/TransactionConsumers.h"
+#include "bitxorcore/crypto/SecureRandomGenerator.h"
 #include "bitxorcore/disruptor/ConsumerDispatcher.h"
 #include "bitxorcore/extensions/DispatcherUtils.h"
 #include "bitxorcore/extensions/ServiceLocator.h"
@@ -192,15 +193,15 @@ namespace bitxorcore { namespace partialtransaction {
 						[&batchRangeDispatcher](auto&& transactionRange) {
 							batchRangeDispatcher.queue(std::move(transactionRange), InputSource::Remote_Pull);
 						},
-						[&ptUpdater, &newCosignatures, pRecentHashCache](auto&& cosignature) {
-							if (pRecentHashCache->add(ToHash(cosignature))) {
-								ptUpdater.update(cosignature);
+						[&newCosignatures, pRecentHashCache](auto&& cosignature) {
+							if (pRecentHashCache->add(ToHash(cosignature)))
 								newCosignatures.push_back(cosignature);
-							}
 						});
 
-				if (!newCosignatures.empty())
+				if (!newCosignatures.empty()) {
+					ptUpdater.update(newCosignatures);
 					cosignaturesSink(newCosignatures);
+				}
 			});
 
 			auto shouldProcessTransactions = extensions::CreateShouldProcessTransactionsPredicate(state);
@@ -216,14 +217,14 @@ namespace bitxorcore { namespace partialtransaction {
 			hooks.setCosignatureRangeConsumer([&ptUpdater, pRecentHashCache, cosignaturesSink](auto&& cosignatureRange) {
 				std::vector<model::DetachedCosignature> newCosignatures;
 				for (const auto& cosignature : cosignatureRange.Range) {
-					if (pRecentHashCache->add(ToHash(cosignature))) {
-						ptUpdater.update(cosignature);
+					if (pRecentHashCache->add(ToHash(cosignature)))
 						newCosignatures.push_back(cosignature);
-					}
 				}
 
-				if (!newCosignatures.empty())
+				if (!newCosignatures.empty()) {
+					ptUpdater.update(newCosignatures);
 					cosignaturesSink(newCosignatures);
+				}
 			});
 
 			state.tasks().push_back(extensions::CreateBatchTransactionTask(batchRangeDispatcher, "partial transaction"));
@@ -244,6 +245,9 @@ namespace bitxorcore { namespace partialtransaction {
 						consumer(model::TransactionRange::FromEntity(std::move(pTransaction)));
 					},
 					extensions::SubscriberToSink(state.transactionStatusSubscriber()),
+					[](auto* pOut, auto count) {
+						crypto::SecureRandomGenerator().fill(pOut, count);
+					},
 					*pUpdaterPool);
 		}
 
@@ -28,6 +28,7 @@
 #include "bitxorcore/crypto/Signer.h"
 #include "bitxorcore/thread/FutureUtils.h"
 #include "bitxorcore/thread/IoThreadPool.h"
+#include "bitxorcore/thread/ParallelFor.h"
 #include "bitxorcore/utils/ArraySet.h"
 #include "bitxorcore/utils/HexFormatter.h"
 #include "bitxorcore/utils/MemoryUtils.h"
@@ -72,6 +73,72 @@ namespace bitxorcore { namespace chain {
 
 			return cosignatures;
 		}
+
+		// owns cosignatures so that signature inputs can reference them
+		class CosignatureVerificationBatch {
+		public:
+			explicit CosignatureVerificationBatch(const DetachedCosignatures& cosignatures)
+					: m_cosignatures(cosignatures)
+					, m_results(cosignatures.size(), CosignatureUpdateResult::Unverifiable)
+					, m_isPending(cosignatures.size(), false)
+					, m_signatureInputIndexes(cosignatures.size(), 0)
+			{}
+
+		public:
+			size_t size() const {
+				return m_cosignatures.size();
+			}
+
+			const model::DetachedCosignature& cosignature(size_t index) const {
+				return m_cosignatures[index];
+			}
+
+			bool isPending(size_t index) const {
+				return m_isPending[index];
+			}
+
+			bool isVerified(size_t index) const {
+				return 0 != m_verificationFlags[m_signatureInputIndexes[index]];
+			}
+
+			const std::vector<CosignatureUpdateResult>& results() const {
+				return m_results;
+			}
+
+			auto& signatureInputs() {
+				return m_signatureInputs;
+			}
+
+		public:
+			void setResult(size_t index, CosignatureUpdateResult result) {
+				m_results[index] = result;
+			}
+
+			void addPending(size_t index) {
+				const auto& cosignature = m_cosignatures[index];
+				m_isPending[index] = true;
+				m_signatureInputIndexes[index] = m_signatureInputs.size();
+				m_signatureInputs.push_back({ cosignature.SignerPublicKey, { cosignature.ParentHash }, cosignature.Signature });
+			}
+
+			void prepareVerification() {
+				m_verificationFlags.resize(m_signatureInputs.size(), 0);
+			}
+
+			void verify(const crypto::RandomFiller& randomFiller, size_t startIndex, size_t count) {
+				auto resultsPair = crypto::VerifyMulti(randomFiller, &m_signatureInputs[startIndex], count);
+				for (auto i = 0u; i < count; ++i)
+					m_verificationFlags[startIndex + i] = resultsPair.second || resultsPair.first[i] ? 1 : 0;
+			}
+
+		private:
+			DetachedCosignatures m_cosignatures;
+			std::vector<CosignatureUpdateResult> m_results;
+			std::vector<bool> m_isPending;
+			std::vector<size_t> m_signatureInputIndexes;
+			std::vector<crypto::SignatureInput> m_signatureInputs;
+			std::vector<uint8_t> m_verificationFlags; // not vector<bool> because partitions are written by different threads
+		};
 	}
 
 	struct StaleTransactionInfo {
@@ -131,12 +198,15 @@ namespace bitxorcore { namespace chain {
 				std::unique_ptr<const PtValidator>&& pValidator,
 				const CompletedTransactionSink& completedTransactionSink,
 				const FailedTransactionSink& failedTransactionSink,
+				const crypto::RandomFiller& randomFiller,
 				thread::IoThreadPool& pool)
 				: m_transactionsCache(transactionsCache)
 				, m_pValidator(std::move(pValidator))
 				, m_completedTransactionSink(completedTransactionSink)
 				, m_failedTransactionSink(failedTransactionSink)
+				, m_randomFiller(randomFiller)
 				, m_ioContext(pool.ioContext())
+				, m_numVerificationPartitions(pool.numWorkerThreads())
 		{}
 
 	private:
@@ -208,50 +278,136 @@ namespace bitxorcore { namespace chain {
 			auto updateFuture = pPromise->get_future();
 
 			boost::asio::post(m_ioContext, [pThis = shared_from_this(), cosignature, pPromise{std::move(pPromise)}]() {
-				auto result = pThis->updateImpl(cosignature);
+				auto result = pThis->updateImpl(cosignature, [&cosignature]() {
+					return crypto::Verify(cosignature.SignerPublicKey, cosignature.ParentHash, cosignature.Signature);
+				});
 				pPromise->set_value(std::move(result));
 			});
 
 			return updateFuture;
 		}
 
+		thread::future<std::vector<CosignatureUpdateResult>> update(const DetachedCosignatures& cosignatures) {
+			if (cosignatures.empty())
+				return thread::make_ready_future(std::vector<CosignatureUpdateResult>());
+
+			auto pPromise = std::make_shared<thread::promise<std::vector<CosignatureUpdateResult>>>();
+			auto updateFuture = pPromise->get_future();
+
+			auto pBatch = std::make_shared<CosignatureVerificationBatch>(cosignatures);
+			boost::asio::post(m_ioContext, [pThis = shared_from_this(), pBatch, pPromise{std::move(pPromise)}]() {
+				pThis->updateAllImpl(pBatch, pPromise);
+			});
+
+			return updateFuture;
+		}
+
 	private:
-		CosignatureUpdateResult updateImpl(const model::DetachedCosignature& cosignature) {
+		void updateAllImpl(
+				const std::shared_ptr<CosignatureVerificationBatch>& pBatch,
+				const std::shared_ptr<thread::promise<std::vector<CosignatureUpdateResult>>>& pPromise) {
+			// reject cosignatures without matching transactions and ineligible cosignatures before verifying any signatures
+			auto& batch = *pBatch;
+			for (auto i = 0u; i < batch.size(); ++i) {
+				CosignatureUpdateResult result;
+				if (tryRejectUnverified(batch.cosignature(i), result))
+					batch.setResult(i, result);
+				else
+					batch.addPending(i);
+			}
+
+			auto& signatureInputs = batch.signatureInputs();
+			if (signatureInputs.empty()) {
+				pPromise->set_value(std::vector<CosignatureUpdateResult>(batch.results()));
+				return;
+			}
+
+			// verify the signatures of the remaining cosignatures in parallel
+			batch.prepareVerification();
+			auto partitionCallback = [pThis = shared_from_this(), pBatch](auto itBegin, auto itEnd, auto startIndex, auto) {
+				pBatch->verify(pThis->m_randomFiller, startIndex, static_cast<size_t>(std::distance(itBegin, itEnd)));
+			};
+			auto verifyFuture = thread::ParallelForPartition(m_ioContext, signatureInputs, m_numVerificationPartitions, partitionCallback);
+
+			// continuation can run on the calling thread when verification is already complete, so always post the (ordered) apply
+			verifyFuture.then([pThis = shared_from_this(), pBatch, pPromise](auto&&) {
+				boost::asio::post(pThis->m_ioContext, [pThis, pBatch, pPromise]() {
+					pPromise->set_value(pThis->applyVerified(*pBatch));
+				});
+			});
+		}
+
+		std::vector<CosignatureUpdateResult> applyVerified(CosignatureVerificationBatch& batch) {
+			for (auto i = 0u; i < batch.size(); ++i) {
+				if (batch.isPending(i))
+					batch.setResult(i, applyVerified(batch.cosignature(i), batch.isVerified(i)));
+			}
+
+			return batch.results();
+		}
+
+		CosignatureUpdateResult applyVerified(const model::DetachedCosignature& cosignature, bool isVerified) {
+			// preceding cosignatures in the same batch might have completed the transaction or added the same cosignatory
+			{
+				auto view = m_transactionsCache.view();
+				auto transactionInfoFromCache = view.find(cosignature.ParentHash);
+				if (!transactionInfoFromCache)
+					return CosignatureUpdateResult::Ineligible;
+
+				if (transactionInfoFromCache.hasCosignatory(cosignature.SignerPublicKey))
+					return CosignatureUpdateResult::Redundant;
+			}
+
+			if (!isVerified)
+				return logUnverifiable(cosignature);
+
+			return addCosignature(cosignature);
+		}
+
+	private:
+		template<typename TIsVerifiedPredicate>
+		CosignatureUpdateResult updateImpl(const model::DetachedCosignature& cosignature, TIsVerifiedPredicate isVerified) {
+			CosignatureUpdateResult result;
+			if (tryRejectUnverified(cosignature, result))
+				return result;
+
+			if (!isVerified())
+				return logUnverifiable(cosignature);
+
+			return addCosignature(cosignature);
+		}
+
+		bool tryRejectUnverified(const model::DetachedCosignature& cosignature, CosignatureUpdateResult& result) {
 			auto eligiblityResult = checkEligibility(cosignature);
 
 			// proactively refresh the cache even if the new cosignature is invalid
 			if (eligiblityResult.isCacheStale() && !eligiblityResult.isPurgeRequired())
 				refreshStaleCacheEntry(eligiblityResult.staleTransactionInfo());
 
-			if (!eligiblityResult.isEligibile()) {
-				if (eligiblityResult.isPurgeRequired())
-					remove(cosignature.ParentHash);
+			if (eligiblityResult.isEligibile())
+				return false;
 
-				return eligiblityResult.updateResult();
-			}
+			if (eligiblityResult.isPurgeRequired())
+				remove(cosignature.ParentHash);
 
-			if (!crypto::Verify(cosignature.SignerPublicKey, cosignature.ParentHash, cosignature.Signature)) {
-				BITXORCORE_LOG(debug)
-						<< "ignoring unverifiable cosignature (signer = " << cosignature.SignerPublicKey
-						<< ", parentHash = " << cosignature.ParentHash << ")";
-				return CosignatureUpdateResult::Unverifiable;
-			}
+			result = eligiblityResult.updateResult();
+			return true;
+		}
 
-			return addCosignature(cosignature);
+		CosignatureUpdateResult logUnverifiable(const model::DetachedCosignature& cosignature) {
+			BITXORCORE_LOG(debug)
+					<< "ignoring unverifiable cosignature (signer = " << cosignature.SignerPublicKey
+					<< ", parentHash = " << cosignature.ParentHash << ")";
+			return CosignatureUpdateResult::Unverifiable;
 		}
 
 		thread::future<PtUpdateResult> update(const DetachedCosignatures& cosignatures, PtUpdateResult::UpdateType updateType) {
 			if (cosignatures.empty())
 				return thread::make_ready_future(PtUpdateResult{ updateType, 0u });
 
-			std::vector<thread::future<CosignatureUpdateResult>> futures;
-			for (const auto& cosignature : cosignatures)
-				futures.emplace_back(update(cosignature));
-
-			return thread::when_all(std::move(futures)).then([updateType](auto&& resultsFuture) {
+			return update(cosignatures).then([updateType](auto&& resultsFuture) {
 				auto results = resultsFuture.get();
-				auto numCosignaturesAdded = std::count_if(results.begin(), results.end(), [](auto& resultFuture) {
-					auto result = resultFuture.get();
+				auto numCosignaturesAdded = std::count_if(results.begin(), results.end(), [](auto result) {
 					return CosignatureUpdateResult::Added_Incomplete == result || CosignatureUpdateResult::Added_Complete == result;
 				});
 
@@ -395,7 +551,9 @@ namespace bitxorcore { namespace chain {
 		std::unique_ptr<const PtValidator> m_pValidator;
 		CompletedTransactionSink m_completedTransactionSink;
 		FailedTransactionSink m_failedTransactionSink;
+		crypto::RandomFiller m_randomFiller;
 		boost::asio::io_context& m_ioContext;
+		size_t m_numVerificationPartitions;
 	};
 
 	PtUpdater::PtUpdater(
@@ -403,12 +561,14 @@ namespace bitxorcore { namespace chain {
 			std::unique_ptr<const PtValidator>&& pValidator,
 			const CompletedTransactionSink& completedTransactionSink,
 			const FailedTransactionSink& failedTransactionSink,
+			const crypto::RandomFiller& randomFiller,
 			thread::IoThreadPool& pool)
 			: m_pImpl(std::make_shared<Impl>(
 					transactionsCache,
 					std::move(pValidator),
 					completedTransactionSink,
 					failedTransactionSink,
+					randomFiller,
 					pool))
 	{}
 
@@ -421,4 +581,8 @@ namespace bitxorcore { namespace chain {
 	thread::future<CosignatureUpdateResult> PtUpdater::update(const model::DetachedCosignature& cosignature) {
 		return m_pImpl->update(cosignature);
 	}
+
+	thread::future<std::vector<CosignatureUpdateResult>> PtUpdater::update(const std::vector<model::DetachedCosignature>& cosignatures) {
+		return m_pImpl->update(cosignatures);
+	}
 }}
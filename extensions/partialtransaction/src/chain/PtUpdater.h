@@ -22,6 +22,7 @@
 
 #pragma once
 #include "bitxorcore/chain/ChainFunctions.h"
+#include "bitxorcore/crypto/Signer.h"
 #include "bitxorcore/thread/Future.h"
 #include <memory>
 
@@ -95,12 +96,13 @@ namespace bitxorcore { namespace chain {
 
 	public:
 		/// Creates an updater around \a transactionsCache, \a pValidator, \a completedTransactionSink and \a failedTransactionSink
-		/// using \a pool for parallelization.
+		/// using \a randomFiller for batch signature verification and \a pool for parallelization.
 		PtUpdater(
 				cache::MemoryPtCacheProxy& transactionsCache,
 				std::unique_ptr<const PtValidator>&& pValidator,
 				const CompletedTransactionSink& completedTransactionSink,
 				const FailedTransactionSink& failedTransactionSink,
+				const crypto::RandomFiller& randomFiller,
 				thread::IoThreadPool& pool);
 
 		/// Destroys the updater.
@@ -113,6 +115,10 @@ namespace bitxorcore { namespace chain {
 		/// Updates this cache by adding a new \a cosignature.
 		thread::future<CosignatureUpdateResult> update(const model::DetachedCosignature& cosignature);
 
+		/// Updates this cache by adding new \a cosignatures.
+		/// \note All signatures are verified in parallel before any cosignature is added (in order) to the cache.
+		thread::future<std::vector<CosignatureUpdateResult>> update(const std::vector<model::DetachedCosignature>& cosignatures);
+
 	private:
 		class Impl;
 		std::shared_ptr<Impl> m_pImpl; // shared_ptr to allow use of enable_shared_from_this
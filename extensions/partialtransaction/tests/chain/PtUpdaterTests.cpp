@@ -27,6 +27,7 @@
 #include "bitxorcore/model/TransactionStatus.h"
 #include "bitxorcore/thread/FutureUtils.h"
 #include "bitxorcore/utils/MemoryUtils.h"
+#include "bitxorcore/utils/RandomGenerator.h"
 #include "bitxorcore/utils/SpinLock.h"
 #include "partialtransaction/tests/test/AggregateTransactionTestUtils.h"
 #include "tests/test/core/AddressTestUtils.h"
@@ -338,6 +339,7 @@ namespace bitxorcore { namespace chain {
 					, m_pUniqueValidator(std::make_unique<MockPtValidator>())
 					, m_pValidator(m_pUniqueValidator.get())
 					, m_pPool(test::CreateStartedIoThreadPool())
+					, m_numRandomFillerCalls(0)
 					, m_pUpdater(std::make_unique<PtUpdater>(
 							m_transactionsCache,
 							std::move(m_pUniqueValidator),
@@ -348,6 +350,11 @@ namespace bitxorcore { namespace chain {
 								// notice that transaction.Deadline is used as transaction marker
 								m_failedTransactionStatuses.emplace_back(hash, transaction.Deadline, utils::to_underlying_type(result));
 							},
+							[this](auto* pOut, auto count) {
+								// can use low entropy source for tests
+								++m_numRandomFillerCalls;
+								utils::LowEntropyRandomGenerator().fill(pOut, count);
+							},
 							*m_pPool))
 			{}
 
@@ -385,6 +392,10 @@ namespace bitxorcore { namespace chain {
 				return m_pPool->numWorkerThreads();
 			}
 
+			size_t numRandomFillerCalls() const {
+				return m_numRandomFillerCalls;
+			}
+
 		public:
 			// asserts that the pt cache contains a \em single \a aggregateTransaction with \a aggregateHash and \a cosignatures
 			void assertSingleTransactionInCache(
@@ -466,6 +477,7 @@ namespace bitxorcore { namespace chain {
 			std::vector<std::unique_ptr<model::Transaction>> m_completedTransactions;
 
 			std::unique_ptr<thread::IoThreadPool> m_pPool;
+			std::atomic<size_t> m_numRandomFillerCalls; // accessed by verification threads
 			std::unique_ptr<PtUpdater> m_pUpdater; // unique_ptr for destroyUpdater
 
 			std::vector<model::TransactionStatus> m_failedTransactionStatuses;
@@ -1032,6 +1044,166 @@ namespace bitxorcore { namespace chain {
 
 	// endregion
 
+	// region update cosignatures
+
+	TEST(TEST_CLASS, AddingZeroCosignaturesHasNoEffect) {
+		// Arrange:
+		RunTestWithTransactionInCache(3, [](auto& context, const auto& transactionInfo, const auto& transaction) {
+			// Act:
+			auto results = context.updater().update(std::vector<model::DetachedCosignature>()).get();
+
+			// Assert:
+			EXPECT_TRUE(results.empty());
+
+			const auto* pCosignatures = transaction.CosignaturesPtr();
+			context.assertSingleTransactionInCache(transactionInfo.EntityHash, transaction, {
+				pCosignatures[0], pCosignatures[1], pCosignatures[2]
+			});
+			context.validator().assertCalls(transaction, { 0, 0, 0 });
+		});
+	}
+
+	TEST(TEST_CLASS, AddingCosignaturesWithMatchingTransactionAddsAllVerifiableCosignaturesInOrder) {
+		// Arrange:
+		RunTestWithTransactionInCache(3, [](auto& context, const auto& transactionInfo, const auto& transaction) {
+			// - create compatible cosignatures and make the second one unverifiable
+			std::vector<model::DetachedCosignature> cosignatures;
+			for (auto i = 0u; i < 3; ++i)
+				cosignatures.push_back(test::GenerateValidCosignature(transactionInfo.EntityHash));
+
+			cosignatures[1].Signature[0] ^= 0xFF;
+
+			// Act:
+			auto results = context.updater().update(cosignatures).get();
+
+			// Assert: results are ordered like the cosignatures
+			std::vector<CosignatureUpdateResult> expectedResults{
+				CosignatureUpdateResult::Added_Incomplete,
+				CosignatureUpdateResult::Unverifiable,
+				CosignatureUpdateResult::Added_Incomplete
+			};
+			EXPECT_EQ(expectedResults, results);
+
+			const auto* pCosignatures = transaction.CosignaturesPtr();
+			context.assertSingleTransactionInCache(transactionInfo.EntityHash, transaction, {
+				pCosignatures[0], pCosignatures[1], pCosignatures[2],
+				cosignatures[0], cosignatures[2]
+			});
+
+			EXPECT_TRUE(context.completedTransactions().empty());
+			EXPECT_TRUE(context.failedTransactionStatuses().empty());
+		});
+	}
+
+	TEST(TEST_CLASS, AddingCosignaturesSpanningMultiplePartitionsAddsAllCosignatures) {
+		// Arrange:
+		RunTestWithTransactionInCache(3, [](auto& context, const auto& transactionInfo, const auto& transaction) {
+			// - create more compatible cosignatures than worker threads
+			auto numCosignatures = 3 * context.numWorkerThreads() + 1;
+			std::vector<model::DetachedCosignature> cosignatures;
+			for (auto i = 0u; i < numCosignatures; ++i)
+				cosignatures.push_back(test::GenerateValidCosignature(transactionInfo.EntityHash));
+
+			// Act:
+			auto results = context.updater().update(cosignatures).get();
+
+			// Assert:
+			ASSERT_EQ(numCosignatures, results.size());
+			for (auto result : results)
+				EXPECT_EQ(CosignatureUpdateResult::Added_Incomplete, result);
+
+			std::vector<model::Cosignature> expectedCosignatures(transaction.CosignaturesPtr(), transaction.CosignaturesPtr() + 3);
+			expectedCosignatures.insert(expectedCosignatures.end(), cosignatures.cbegin(), cosignatures.cend());
+			context.assertSingleTransactionInCache(transactionInfo.EntityHash, transaction, expectedCosignatures);
+		});
+	}
+
+	TEST(TEST_CLASS, AddingCosignaturesWithoutMatchingTransactionDoesNotVerifySignatures) {
+		// Arrange:
+		RunTestWithTransactionInCache(3, [](auto& context, const auto&, const auto&) {
+			// - create more cosignatures (with invalid signatures) than are verified individually
+			std::vector<model::DetachedCosignature> cosignatures;
+			for (auto i = 0u; i < 10; ++i)
+				cosignatures.push_back(test::CreateRandomDetachedCosignature());
+
+			// Act:
+			auto results = context.updater().update(cosignatures).get();
+
+			// Assert: all cosignatures were rejected without batch verification
+			EXPECT_EQ(std::vector<CosignatureUpdateResult>(10, CosignatureUpdateResult::Ineligible), results);
+			EXPECT_EQ(0u, context.numRandomFillerCalls());
+		});
+	}
+
+	TEST(TEST_CLASS, AddingCosignaturesRejectsUnverifiableCosignaturesPastFirstVerificationBatch) {
+		// Arrange:
+		RunTestWithTransactionInCache(3, [](auto& context, const auto& transactionInfo, const auto& transaction) {
+			// - create enough cosignatures so that every partition spans more than one verification batch (64 signatures)
+			auto numCosignatures = 70 * context.numWorkerThreads();
+			std::vector<model::DetachedCosignature> cosignatures;
+			for (auto i = 0u; i < numCosignatures; ++i)
+				cosignatures.push_back(test::GenerateValidCosignature(transactionInfo.EntityHash));
+
+			// - make cosignatures past the first batch of the first and last partitions unverifiable
+			std::vector<size_t> unverifiableIndexes{ 66, numCosignatures - 1 };
+			for (auto index : unverifiableIndexes)
+				cosignatures[index].Signature[0] ^= 0xFF;
+
+			// Act:
+			auto results = context.updater().update(cosignatures).get();
+
+			// Assert:
+			std::vector<CosignatureUpdateResult> expectedResults(numCosignatures, CosignatureUpdateResult::Added_Incomplete);
+			for (auto index : unverifiableIndexes)
+				expectedResults[index] = CosignatureUpdateResult::Unverifiable;
+
+			EXPECT_EQ(expectedResults, results);
+
+			std::vector<model::Cosignature> expectedCosignatures(transaction.CosignaturesPtr(), transaction.CosignaturesPtr() + 3);
+			for (auto i = 0u; i < numCosignatures; ++i) {
+				if (unverifiableIndexes.cend() == std::find(unverifiableIndexes.cbegin(), unverifiableIndexes.cend(), i))
+					expectedCosignatures.push_back(cosignatures[i]);
+			}
+
+			context.assertSingleTransactionInCache(transactionInfo.EntityHash, transaction, expectedCosignatures);
+		});
+	}
+
+	TEST(TEST_CLASS, AddingCosignaturesCanCompleteTransaction) {
+		// Arrange:
+		RunTestWithTransactionInCache(3, [](auto& context, const auto& transactionInfo, const auto& transaction) {
+			// - create compatible cosignatures
+			std::vector<model::DetachedCosignature> cosignatures;
+			for (auto i = 0u; i < 2; ++i)
+				cosignatures.push_back(test::GenerateValidCosignature(transactionInfo.EntityHash));
+
+			// - mark the transaction as complete after the first cosignature is added
+			//   (eligibility of both cosignatures is checked before any signature is verified and any cosignature is added)
+			context.validator().setValidateCosignatoriesResult(CosignatoriesValidationResult::Success, 3);
+
+			// Act:
+			auto results = context.updater().update(cosignatures).get();
+
+			// Assert: the second cosignature has no matching transaction because the first one completed it
+			std::vector<CosignatureUpdateResult> expectedResults{
+				CosignatureUpdateResult::Added_Complete,
+				CosignatureUpdateResult::Ineligible
+			};
+			EXPECT_EQ(expectedResults, results);
+
+			EXPECT_EQ(0u, context.transactionsCache().view().size());
+
+			const auto* pCosignatures = transaction.CosignaturesPtr();
+			ASSERT_EQ(1u, context.completedTransactions().size());
+			test::AssertStitchedTransaction(*context.completedTransactions()[0], transaction, {
+				pCosignatures[0], pCosignatures[1], pCosignatures[2],
+				cosignatures[0]
+			});
+		});
+	}
+
+	// endregion
+
 	// region update cosignature - stale cosignature detected
 
 	TEST(TEST_CLASS, StaleCosignatureIsPurgedWhenNewValidCosignatureIsAdded) {
@@ -24,6 +24,7 @@
 #include "DispatcherSyncHandlers.h"
 #include "PredicateUtils.h"
 #include "RollbackInfo.h"
+#include "TransactionSpamThrottle.h"
 #include "bitxorcore/cache/ReadOnlyBitxorCoreCache.h"
 #include "bitxorcore/cache_core/AccountStateCache.h"
 #include "bitxorcore/cache_core/BlockStatisticCache.h"
@@ -39,6 +40,8 @@
 #include "bitxorcore/consumers/BlockConsumers.h"
 #include "bitxorcore/consumers/ConsumerUtils.h"
 #include "bitxorcore/consumers/ReclaimMemoryInspector.h"
+#include "bitxorcore/consumers/ShardedRecentHashCache.h"
+#include "bitxorcore/consumers/TracingConsumers.h"
 #include "bitxorcore/consumers/TransactionConsumers.h"
 #include "bitxorcore/consumers/UndoBlock.h"
 #include "bitxorcore/crypto/SecureRandomGenerator.h"
@@ -59,6 +62,10 @@
 #include "bitxorcore/subscribers/StateChangeSubscriber.h"
 #include "bitxorcore/subscribers/TransactionStatusSubscriber.h"
 #include "bitxorcore/thread/MultiServicePool.h"
+#include "bitxorcore/thread/ThreadInfo.h"
+#include "bitxorcore/utils/ConfigurationValueParsers.h"
+#include "bitxorcore/utils/TraceRecorder.h"
+#include <algorithm>
 #include <filesystem>
 
 using namespace bitxorcore::consumers;
@@ -75,11 +82,25 @@ namespace bitxorcore { namespace sync {
 			};
 		}
 
+		thread::ComputeThreadPoolOptions CreateComputeThreadPoolOptions(const config::NodeConfiguration& config) {
+			auto options = thread::ComputeThreadPoolOptions{ config.ComputeThreadPoolSize, {} };
+			for (const auto& cpuIdString : config.ComputeThreadPoolCpuAffinity) {
+				uint32_t cpuId;
+				if (!utils::TryParseValue(cpuIdString, cpuId))
+					BITXORCORE_THROW_INVALID_ARGUMENT_1("compute thread pool cpu affinity contains invalid cpu id", cpuIdString);
+
+				options.CpuIds.push_back(cpuId);
+			}
+
+			std::sort(options.CpuIds.begin(), options.CpuIds.end());
+			return options;
+		}
+
 		std::shared_ptr<const validators::ParallelValidationPolicy> CreateParallelValidationPolicy(
-				thread::IoThreadPool& validatorPool,
+				thread::ComputeThreadPool& computePool,
 				const plugins::PluginManager& pluginManager) {
 			return validators::CreateParallelValidationPolicy(
-					validatorPool,
+					computePool,
 					extensions::CreateStatelessEntityValidator(pluginManager, model::SignatureNotification::Notification_Type));
 		}
 
@@ -102,14 +123,17 @@ namespace bitxorcore { namespace sync {
 		std::unique_ptr<ConsumerDispatcher> CreateConsumerDispatcher(
 				extensions::ServiceState& state,
 				const ConsumerDispatcherOptions& options,
-				std::vector<DisruptorConsumer>&& disruptorConsumers) {
+				std::vector<DisruptorConsumer>&& disruptorConsumers,
+				const std::shared_ptr<SlowBlockTraceDumper>& pTraceDumper = nullptr) {
 			auto& nodeSubscriber = state.nodeSubscriber();
 			auto& statusSubscriber = state.transactionStatusSubscriber();
 			auto reclaimMemoryInspector = CreateReclaimMemoryInspector();
 			const auto& localNetworks = state.config().Node.LocalNetworks;
-			auto inspector = [&nodeSubscriber, &statusSubscriber, &nodes = state.nodes(), &localNetworks, reclaimMemoryInspector](
-					auto& input,
-					const auto& completionResult) {
+			auto inspector = [&nodeSubscriber, &statusSubscriber, &nodes = state.nodes(), &localNetworks, reclaimMemoryInspector,
+					pTraceDumper](auto& input, const auto& completionResult) {
+				if (pTraceDumper)
+					pTraceDumper->complete(input);
+
 				statusSubscriber.flush();
 				auto interactionResult = consumers::ToNodeInteractionResult(input.sourceIdentity(), completionResult);
 				extensions::IncrementNodeInteraction(nodes, interactionResult);
@@ -138,6 +162,14 @@ namespace bitxorcore { namespace sync {
 				disruptorConsumers.insert(disruptorConsumers.begin(), CreateAuditConsumer(auditPath.generic_string()));
 			}
 
+			// if enabled, mark the start of processing before all other consumers
+			if (pTraceDumper) {
+				disruptorConsumers.insert(disruptorConsumers.begin(), [pTraceDumper](const auto&) {
+					pTraceDumper->start();
+					return ConsumerResult::Continue();
+				});
+			}
+
 			return std::make_unique<ConsumerDispatcher>(options, disruptorConsumers, inspector);
 		}
 
@@ -206,8 +238,9 @@ namespace bitxorcore { namespace sync {
 			syncHandlers.TransactionsChange = state.hooks().transactionsChangeHandler();
 			syncHandlers.CommitStep = extensions::CreateCommitStepHandler(dataDirectory);
 
-			if (state.config().Node.EnableCacheDatabaseStorage)
-				AddSupplementalDataResiliency(syncHandlers, dataDirectory, state.cache(), state.score());
+			const auto& nodeConfig = state.config().Node;
+			if (nodeConfig.EnableCacheDatabaseStorage)
+				AddSupplementalDataResiliency(syncHandlers, dataDirectory, nodeConfig.StateFileChunkSize, state.cache(), state.score());
 
 			return syncHandlers;
 		}
@@ -221,49 +254,69 @@ namespace bitxorcore { namespace sync {
 
 		public:
 			void addHashConsumers() {
-				m_consumers.push_back(CreateBlockHashCalculatorConsumer(
+				addConsumer("hash calculator", CreateBlockHashCalculatorConsumer(
 						m_state.config().Blockchain.Network.GenerationHashSeed,
 						m_state.pluginManager().transactionRegistry()));
-				m_consumers.push_back(CreateBlockHashCheckConsumer(
+				addConsumer("hash check", CreateBlockHashCheckConsumer(
 						m_state.timeSupplier(),
 						extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheBlockDuration, m_nodeConfig)));
 			}
 
-			std::shared_ptr<ConsumerDispatcher> build(thread::IoThreadPool& validatorPool, RollbackInfo& rollbackInfo) {
+			std::shared_ptr<ConsumerDispatcher> build(
+					thread::ComputeThreadPool& computePool,
+					RollbackInfo& rollbackInfo,
+					const std::shared_ptr<SlowBlockTraceDumper>& pTraceDumper) {
 				const auto& utCache = const_cast<const extensions::ServiceState&>(m_state).utCache();
 				auto requiresValidationPredicate = ToRequiresValidationPredicate(m_state.hooks().knownHashPredicate(utCache));
-				m_consumers.push_back(CreateBlockchainCheckConsumer(
+				addConsumer("blockchain check", CreateBlockchainCheckConsumer(
 						m_state.config().Blockchain.MaxBlockFutureTime,
 						m_state.timeSupplier()));
-				m_consumers.push_back(CreateBlockStatelessValidationConsumer(
-						CreateParallelValidationPolicy(validatorPool, m_state.pluginManager()),
+				addConsumer("stateless validation", CreateBlockStatelessValidationConsumer(
+						CreateParallelValidationPolicy(computePool, m_state.pluginManager()),
 						requiresValidationPredicate));
-				m_consumers.push_back(CreateBlockBatchSignatureConsumer(
+				addConsumer("batch signature", CreateBlockBatchSignatureConsumer(
 						m_state.config().Blockchain.Network.GenerationHashSeed,
 						CreateRandomFiller(),
 						m_state.pluginManager().createNotificationPublisher(),
-						validatorPool,
+						computePool,
 						requiresValidationPredicate));
 
 				auto disruptorConsumers = DisruptorConsumersFromBlockConsumers(m_consumers);
-				disruptorConsumers.push_back(CreateBlockchainSyncConsumer(
+				addConsumer(disruptorConsumers, "blockchain sync", CreateBlockchainSyncConsumer(
 						m_state.config().Blockchain.ImportanceGrouping,
 						m_state.cache(),
 						m_state.storage(),
 						CreateBlockchainSyncHandlers(m_state, rollbackInfo)));
 
-				if (m_state.config().Node.EnableAutoSyncCleanup)
-					disruptorConsumers.push_back(CreateBlockchainSyncCleanupConsumer(m_state.config().User.DataDirectory));
+				if (m_state.config().Node.EnableAutoSyncCleanup) {
+					const auto& dataDirectory = m_state.config().User.DataDirectory;
+					addConsumer(disruptorConsumers, "sync cleanup", CreateBlockchainSyncCleanupConsumer(dataDirectory));
+				}
 
 				// forward locally harvested blocks and blocks pushed by partners
 				auto newBlockSinkSourceMask = static_cast<InputSource>(
 						utils::to_underlying_type(InputSource::Local)
 						| utils::to_underlying_type(InputSource::Remote_Push));
-				disruptorConsumers.push_back(CreateNewBlockConsumer(m_state.hooks().newBlockSink(), newBlockSinkSourceMask));
+				auto newBlockSink = m_state.hooks().newBlockSink();
+				addConsumer(disruptorConsumers, "new block", CreateNewBlockConsumer(newBlockSink, newBlockSinkSourceMask));
 				return CreateConsumerDispatcher(
 						m_state,
 						CreateBlockConsumerDispatcherOptions(m_nodeConfig),
-						std::move(disruptorConsumers));
+						std::move(disruptorConsumers),
+						pTraceDumper);
+			}
+
+		private:
+			void addConsumer(const char* name, BlockConsumer&& consumer) {
+				m_consumers.push_back(m_nodeConfig.EnableDispatcherTracing
+						? CreateTracingBlockConsumer(name, consumer)
+						: std::move(consumer));
+			}
+
+			void addConsumer(std::vector<DisruptorConsumer>& disruptorConsumers, const char* name, DisruptorConsumer&& consumer) {
+				disruptorConsumers.push_back(m_nodeConfig.EnableDispatcherTracing
+						? CreateTracingDisruptorConsumer(name, consumer)
+						: std::move(consumer));
 			}
 
 		private:
@@ -300,6 +353,8 @@ namespace bitxorcore { namespace sync {
 
 		// region transaction
 
+		constexpr size_t Num_Recent_Hash_Cache_Shards = 16;
+
 		class TransactionDispatcherBuilder {
 		public:
 			explicit TransactionDispatcherBuilder(extensions::ServiceState& state)
@@ -308,27 +363,31 @@ namespace bitxorcore { namespace sync {
 			{}
 
 		public:
-			void addHashConsumers() {
+			void addHashConsumers(extensions::ServiceLocator& locator) {
+				// many peers push the same transactions, so use a sharded cache that can be shared with concurrent callers
+				auto pRecentHashCache = std::make_shared<ShardedRecentHashCache>(
+						m_state.timeSupplier(),
+						extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheTransactionDuration, m_nodeConfig),
+						Num_Recent_Hash_Cache_Shards);
+				locator.registerRootedService("dispatcher.transaction.hashCache", pRecentHashCache);
+
 				const auto& utCache = const_cast<const extensions::ServiceState&>(m_state).utCache();
 				m_consumers.push_back(CreateTransactionHashCalculatorConsumer(
 						m_state.config().Blockchain.Network.GenerationHashSeed,
 						m_state.pluginManager().transactionRegistry()));
-				m_consumers.push_back(CreateTransactionHashCheckConsumer(
-						m_state.timeSupplier(),
-						extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheTransactionDuration, m_nodeConfig),
-						m_state.hooks().knownHashPredicate(utCache)));
+				m_consumers.push_back(CreateTransactionHashCheckConsumer(pRecentHashCache, m_state.hooks().knownHashPredicate(utCache)));
 			}
 
-			std::shared_ptr<ConsumerDispatcher> build(thread::IoThreadPool& validatorPool, chain::UtUpdater& utUpdater) {
+			std::shared_ptr<ConsumerDispatcher> build(thread::ComputeThreadPool& computePool, chain::UtUpdater& utUpdater) {
 				auto failedTransactionSink = extensions::SubscriberToSink(m_state.transactionStatusSubscriber());
 				m_consumers.push_back(CreateTransactionStatelessValidationConsumer(
-						CreateParallelValidationPolicy(validatorPool, m_state.pluginManager()),
+						CreateParallelValidationPolicy(computePool, m_state.pluginManager()),
 						failedTransactionSink));
 				m_consumers.push_back(CreateTransactionBatchSignatureConsumer(
 						m_state.config().Blockchain.Network.GenerationHashSeed,
 						CreateRandomFiller(),
 						m_state.pluginManager().createNotificationPublisher(),
-						validatorPool,
+						computePool,
 						failedTransactionSink));
 
 				const auto& banningConfig = m_nodeConfig.Banning;
@@ -392,7 +451,13 @@ namespace bitxorcore { namespace sync {
 
 		// endregion
 
-		chain::UtUpdater& CreateAndRegisterUtUpdater(extensions::ServiceLocator& locator, extensions::ServiceState& state) {
+		chain::UtUpdater& CreateAndRegisterUtUpdater(
+				extensions::ServiceLocator& locator,
+				extensions::ServiceState& state,
+				thread::IoThreadPool& validatorPool) {
+			auto pThrottleStatistics = std::make_shared<SpamThrottleStatistics>();
+			locator.registerRootedService("dispatcher.utThrottle", pThrottleStatistics);
+
 			auto pUtUpdater = std::make_shared<chain::UtUpdater>(
 					state.utCache(),
 					state.cache(),
@@ -400,17 +465,68 @@ namespace bitxorcore { namespace sync {
 					extensions::CreateExecutionConfiguration(state.pluginManager()),
 					state.timeSupplier(),
 					extensions::SubscriberToSink(state.transactionStatusSubscriber()),
-					CreateUtUpdaterThrottle(state.config()));
+					CreateUtUpdaterThrottle(state.config(), *pThrottleStatistics),
+					validatorPool);
 			locator.registerRootedService("dispatcher.utUpdater", pUtUpdater);
 
 			auto& utUpdater = *pUtUpdater;
-			state.hooks().addTransactionsChangeHandler([&utUpdater](const auto& changeInfo) {
+			auto enableIncrementalUtRevalidation = state.config().Node.EnableIncrementalUtRevalidation;
+			state.hooks().addTransactionsChangeHandler([&utUpdater, enableIncrementalUtRevalidation](const auto& changeInfo) {
+				if (enableIncrementalUtRevalidation && changeInfo.OptionalAffectedAddresses) {
+					const auto& affectedAddresses = *changeInfo.OptionalAffectedAddresses;
+					utUpdater.update(changeInfo.AddedTransactionHashes, changeInfo.RevertedTransactionInfos, affectedAddresses);
+					return;
+				}
+
 				utUpdater.update(changeInfo.AddedTransactionHashes, changeInfo.RevertedTransactionInfos);
 			});
 
 			return utUpdater;
 		}
 
+		class TraceRecorderInstallation {
+		public:
+			explicit TraceRecorderInstallation(const std::shared_ptr<const utils::TraceRecorder>& pRecorder) : m_pRecorder(pRecorder)
+			{}
+
+		public:
+			void shutdown() {
+				utils::UninstallTraceRecorder(*m_pRecorder);
+			}
+
+		private:
+			std::shared_ptr<const utils::TraceRecorder> m_pRecorder;
+		};
+
+		std::shared_ptr<SlowBlockTraceDumper> CreateAndRegisterTraceServices(
+				extensions::ServiceLocator& locator,
+				thread::MultiServicePool::ServiceGroup& serviceGroup,
+				const config::BitxorCoreConfiguration& config) {
+			if (!config.Node.EnableDispatcherTracing)
+				return nullptr;
+
+			auto pTraceRecorder = std::make_shared<utils::TraceRecorder>(
+					config.Node.DispatcherTraceMaxEventsPerThread,
+					thread::GetThreadName);
+			locator.registerRootedService("dispatcher.tracer", pTraceRecorder);
+
+			// uninstall the recorder when the service group is shut down (after the dispatchers registered later)
+			utils::InstallTraceRecorder(pTraceRecorder);
+			serviceGroup.registerService(std::make_shared<TraceRecorderInstallation>(pTraceRecorder));
+
+			auto traceDirectory = config::BitxorCoreDataDirectory(config.User.DataDirectory).dir("traces");
+			traceDirectory.createAll();
+			BITXORCORE_LOG(info) << "enabling dispatcher tracing with slow block traces written to " << traceDirectory.str();
+
+			auto pTraceDumper = std::make_shared<SlowBlockTraceDumper>(
+					pTraceRecorder,
+					traceDirectory.str(),
+					config.Node.DispatcherTraceSlowBlockThreshold,
+					config.Node.DispatcherTraceMaxFiles);
+			locator.registerRootedService("dispatcher.traceDumper", pTraceDumper);
+			return pTraceDumper;
+		}
+
 		auto CreateAndRegisterRollbackService(
 				extensions::ServiceLocator& locator,
 				const chain::TimeSupplier& timeSupplier,
@@ -433,6 +549,26 @@ namespace bitxorcore { namespace sync {
 			});
 		}
 
+		void AddThrottleCounter(
+				extensions::ServiceLocator& locator,
+				const std::string& counterName,
+				std::atomic<uint64_t> SpamThrottleStatistics::* pCounter) {
+			locator.registerServiceCounter<SpamThrottleStatistics>("dispatcher.utThrottle", counterName, [pCounter](
+					const auto& statistics) {
+				return (statistics.*pCounter).load();
+			});
+		}
+
+		void AddHashCacheCounter(
+				extensions::ServiceLocator& locator,
+				const std::string& counterName,
+				std::atomic<uint64_t> RecentHashCacheStatistics::* pCounter) {
+			locator.registerServiceCounter<ShardedRecentHashCache>("dispatcher.transaction.hashCache", counterName, [pCounter](
+					const auto& recentHashCache) {
+				return (recentHashCache.statistics().*pCounter).load();
+			});
+		}
+
 		class DispatcherServiceRegistrar : public extensions::ServiceRegistrar {
 		public:
 			extensions::ServiceRegistrarInfo info() const override {
@@ -447,28 +583,47 @@ namespace bitxorcore { namespace sync {
 				AddRollbackCounter(locator, "RB COMMIT RCT", RollbackResult::Committed, RollbackCounterType::Recent);
 				AddRollbackCounter(locator, "RB IGNORE ALL", RollbackResult::Ignored, RollbackCounterType::All);
 				AddRollbackCounter(locator, "RB IGNORE RCT", RollbackResult::Ignored, RollbackCounterType::Recent);
+
+				using Statistics = SpamThrottleStatistics;
+				AddThrottleCounter(locator, "UT THR ACCEPT", &Statistics::NumAccepted);
+				AddThrottleCounter(locator, "UT THR FULL", &Statistics::NumRejectedCacheFull);
+				AddThrottleCounter(locator, "UT THR SPAM", &Statistics::NumThrottled);
+				AddThrottleCounter(locator, "UT THR BYPASS", &Statistics::NumBypassed);
+				AddThrottleCounter(locator, "UT THR HIT", &Statistics::NumImportanceCacheHits);
+				AddThrottleCounter(locator, "UT THR MISS", &Statistics::NumImportanceCacheMisses);
+				AddThrottleCounter(locator, "UT THR TIME", &Statistics::TotalDecisionMicros);
+
+				AddHashCacheCounter(locator, "TX HASH HIT", &RecentHashCacheStatistics::NumHits);
+				AddHashCacheCounter(locator, "TX HASH MISS", &RecentHashCacheStatistics::NumMisses);
+				AddHashCacheCounter(locator, "TX HASH PRUNE", &RecentHashCacheStatistics::NumPruned);
 			}
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
 				// create shared services
 				auto* pValidatorPool = state.pool().pushIsolatedPool("validator");
-				auto& utUpdater = CreateAndRegisterUtUpdater(locator, state);
+				auto& utUpdater = CreateAndRegisterUtUpdater(locator, state, *pValidatorPool);
+
+				// cpu-bound stateless and signature validation runs on a separate compute pool so that it cannot starve io work
+				auto pComputePool = state.pool().pushComputePool("compute", CreateComputeThreadPoolOptions(state.config().Node));
+				locator.registerService("dispatcher.compute", pComputePool);
 
 				// create the block and transaction dispatchers and related services
-				// (notice that the dispatcher service group must be after the validator isolated pool in order to allow proper shutdown)
+				// (notice that the dispatcher service group must be after the validator and compute pools
+				//  in order to allow proper shutdown)
 				auto pServiceGroup = state.pool().pushServiceGroup("dispatcher service");
 
 				BlockDispatcherBuilder blockDispatcherBuilder(state);
 				blockDispatcherBuilder.addHashConsumers();
 
 				TransactionDispatcherBuilder transactionDispatcherBuilder(state);
-				transactionDispatcherBuilder.addHashConsumers();
+				transactionDispatcherBuilder.addHashConsumers(locator);
 
 				auto pRollbackInfo = CreateAndRegisterRollbackService(locator, state.timeSupplier(), state.config().Blockchain);
-				auto pBlockDispatcher = blockDispatcherBuilder.build(*pValidatorPool, *pRollbackInfo);
+				auto pTraceDumper = CreateAndRegisterTraceServices(locator, *pServiceGroup, state.config());
+				auto pBlockDispatcher = blockDispatcherBuilder.build(*pComputePool, *pRollbackInfo, pTraceDumper);
 				RegisterBlockDispatcherService(pBlockDispatcher, *pServiceGroup, locator, state);
 
-				auto pTransactionDispatcher = transactionDispatcherBuilder.build(*pValidatorPool, utUpdater);
+				auto pTransactionDispatcher = transactionDispatcherBuilder.build(*pComputePool, utUpdater);
 				RegisterTransactionDispatcherService(pTransactionDispatcher, *pServiceGroup, locator, state);
 			}
 		};
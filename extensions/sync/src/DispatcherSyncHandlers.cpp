@@ -32,23 +32,26 @@ namespace bitxorcore { namespace sync {
 	void AddSupplementalDataResiliency(
 			consumers::BlockchainSyncHandlers& syncHandlers,
 			const config::BitxorCoreDataDirectory& dataDirectory,
+			const utils::FileSize& stateFileChunkSize,
 			const cache::BitxorCoreCache& cache,
 			const extensions::LocalNodeChainScore& score) {
 		auto preStateWrittenHandler = syncHandlers.PreStateWritten;
 
 		// can't create any views (or storages) in PreStateWritten handler because cache lock is held by calling code
 		auto pStorages = std::make_shared<decltype(cache.storages())>(cache.storages());
-		syncHandlers.PreStateWritten = [preStateWrittenHandler, pStorages, dataDirectory, &score](const auto& cacheDelta, auto height) {
-			extensions::LocalNodeStateSerializer serializer(dataDirectory.dir("state.tmp"));
+		syncHandlers.PreStateWritten = [preStateWrittenHandler, pStorages, dataDirectory, stateFileChunkSize, &score](
+				const auto& cacheDelta,
+				auto height) {
+			extensions::LocalNodeStateSerializer serializer(dataDirectory.dir("state.tmp"), stateFileChunkSize);
 			serializer.save(cacheDelta, *pStorages, score.get(), height);
 
 			preStateWrittenHandler(cacheDelta, height);
 		};
 
 		auto commitStepHandler = syncHandlers.CommitStep;
-		syncHandlers.CommitStep = [commitStepHandler, dataDirectory](auto step) {
+		syncHandlers.CommitStep = [commitStepHandler, dataDirectory, stateFileChunkSize](auto step) {
 			if (consumers::CommitOperationStep::All_Updated == step) {
-				extensions::LocalNodeStateSerializer serializer(dataDirectory.dir("state.tmp"));
+				extensions::LocalNodeStateSerializer serializer(dataDirectory.dir("state.tmp"), stateFileChunkSize);
 				serializer.moveTo(dataDirectory.dir("state"));
 			}
 
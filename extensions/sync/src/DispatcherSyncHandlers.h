@@ -31,9 +31,11 @@ namespace bitxorcore {
 namespace bitxorcore { namespace sync {
 
 	/// Updates \a syncHandlers to support supplemental data resiliency given \a dataDirectory, \a cache and \a score.
+	/// State files are saved in checksummed chunks of \a stateFileChunkSize (unless it is zero).
 	void AddSupplementalDataResiliency(
 			consumers::BlockchainSyncHandlers& syncHandlers,
 			const config::BitxorCoreDataDirectory& dataDirectory,
+			const utils::FileSize& stateFileChunkSize,
 			const cache::BitxorCoreCache& cache,
 			const extensions::LocalNodeChainScore& score);
 }}
@@ -22,11 +22,13 @@
 
 #include "NetworkPacketWritersService.h"
 #include "bitxorcore/api/RemoteChainApi.h"
+#include "bitxorcore/cache_tx/MemoryUtCache.h"
 #include "bitxorcore/config/BitxorCoreKeys.h"
 #include "bitxorcore/extensions/NetworkUtils.h"
 #include "bitxorcore/extensions/ServiceLocator.h"
 #include "bitxorcore/extensions/ServiceState.h"
 #include "bitxorcore/extensions/ServiceUtils.h"
+#include "bitxorcore/handlers/TransactionHandlers.h"
 #include "bitxorcore/ionet/BroadcastUtils.h"
 #include "bitxorcore/thread/FutureUtils.h"
 #include "bitxorcore/thread/MultiServicePool.h"
@@ -35,6 +37,7 @@ namespace bitxorcore { namespace sync {
 
 	namespace {
 		constexpr auto Service_Name = "writers";
+		constexpr auto Inventory_Service_Name = "writers.inventory";
 		using BlockSink = extensions::NewBlockSink;
 		using TransactionsSink = extensions::SharedNewTransactionsSink;
 
@@ -63,6 +66,42 @@ namespace bitxorcore { namespace sync {
 			};
 		}
 
+		TransactionsSink CreateTransactionInventorySink(const extensions::ServiceLocator& locator, TransactionInventory& inventory) {
+			return [&locator, &inventory](const auto& transactionInfos) {
+				if (transactionInfos.empty())
+					return;
+
+				auto pWriters = locator.service<net::PacketWriters>(Service_Name);
+				pWriters->broadcast(inventory.announce(transactionInfos, pWriters->numActiveWriters()));
+			};
+		}
+
+		handlers::AnnouncedTransactionsRetriever CreateAnnouncedTransactionsRetriever(
+				TransactionInventory& inventory,
+				const cache::ReadWriteUtCache& utCache) {
+			return [&inventory, &utCache](const auto& shortHashes) {
+				auto transactions = utCache.view().findTransactions(shortHashes);
+
+				// account for the request and response packets
+				uint64_t numServedBytes = 2 * sizeof(ionet::PacketHeader) + shortHashes.size() * sizeof(utils::ShortHash);
+				for (const auto& pTransaction : transactions)
+					numServedBytes += pTransaction->Size;
+
+				inventory.recordServedPull(numServedBytes);
+				return transactions;
+			};
+		}
+
+		void AddInventoryCounter(
+				extensions::ServiceLocator& locator,
+				const std::string& counterName,
+				std::atomic<uint64_t> TransactionInventoryStatistics::* pCounter) {
+			locator.registerServiceCounter<TransactionInventory>(Inventory_Service_Name, counterName, [pCounter](
+					const auto& inventory) {
+				return (inventory.statistics().*pCounter).load();
+			});
+		}
+
 		class NetworkPacketWritersServiceRegistrar : public extensions::ServiceRegistrar {
 		public:
 			extensions::ServiceRegistrarInfo info() const override {
@@ -73,19 +112,46 @@ namespace bitxorcore { namespace sync {
 				locator.registerServiceCounter<net::PacketWriters>(Service_Name, "WRITERS", [](const auto& writers) {
 					return writers.numActiveWriters();
 				});
+
+				using Statistics = TransactionInventoryStatistics;
+				AddInventoryCounter(locator, "TX INV ANN", &Statistics::NumAnnounced);
+				AddInventoryCounter(locator, "TX INV SAVED", &Statistics::NumWithheldBytes);
+				AddInventoryCounter(locator, "TX INV RECV", &Statistics::NumReceived);
+				AddInventoryCounter(locator, "TX INV DUP", &Statistics::NumDuplicates);
+				AddInventoryCounter(locator, "TX INV DUP B", &Statistics::NumDuplicateBytes);
+				AddInventoryCounter(locator, "TX INV PULL", &Statistics::NumPullRequests);
+				AddInventoryCounter(locator, "TX INV PULL B", &Statistics::NumPullBytes);
 			}
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
-				auto connectionSettings = extensions::GetConnectionSettings(state.config());
+				const auto& config = state.config();
+				auto connectionSettings = extensions::GetConnectionSettings(config);
 				auto pServiceGroup = state.pool().pushServiceGroup(Service_Name);
 				auto pWriters = pServiceGroup->pushService(net::CreatePacketWriters, locator.keys().caPublicKey(), connectionSettings);
 
 				locator.registerService(Service_Name, pWriters);
 				state.packetIoPickers().insert(*pWriters, ionet::NodeRoles::Peer);
 
+				auto pInventory = std::make_shared<TransactionInventory>(config.Node.TransactionInventoryMaxSize);
+				locator.registerRootedService(Inventory_Service_Name, pInventory);
+
 				// add sinks
 				state.hooks().addNewBlockSink(extensions::CreatePushEntitySink<BlockSink>(locator, Service_Name));
-				state.hooks().addNewTransactionsSink(extensions::CreatePushEntitySink<TransactionsSink>(locator, Service_Name));
+				if (config.Node.EnableTransactionInventoryGossip) {
+					// announce short hashes of new transactions and let peers pull the ones they do not know
+					state.hooks().addNewTransactionsSink(CreateTransactionInventorySink(locator, *pInventory));
+					handlers::RegisterPushTransactionInventoryHandler(state.packetHandlers(), [&inventory = *pInventory](auto&& range) {
+						inventory.receive(range.Range, range.SourceIdentity.PublicKey);
+					});
+
+					const auto& utCache = const_cast<const extensions::ServiceState&>(state).utCache();
+					handlers::RegisterPullAnnouncedTransactionsHandler(
+							state.packetHandlers(),
+							CreateAnnouncedTransactionsRetriever(*pInventory, utCache));
+				} else {
+					state.hooks().addNewTransactionsSink(extensions::CreatePushEntitySink<TransactionsSink>(locator, Service_Name));
+				}
+
 				state.hooks().addPacketPayloadSink([&writers = *pWriters](const auto& payload) { writers.broadcast(payload); });
 				state.hooks().addBannedNodeIdentitySink(extensions::CreateCloseConnectionSink(*pWriters));
 
@@ -99,6 +165,10 @@ namespace bitxorcore { namespace sync {
 		return locator.service<net::PacketWriters>(Service_Name);
 	}
 
+	std::shared_ptr<TransactionInventory> GetTransactionInventory(const extensions::ServiceLocator& locator) {
+		return locator.service<TransactionInventory>(Inventory_Service_Name);
+	}
+
 	DECLARE_SERVICE_REGISTRAR(NetworkPacketWriters)() {
 		return std::make_unique<NetworkPacketWritersServiceRegistrar>();
 	}
@@ -21,6 +21,7 @@
 **/
 
 #pragma once
+#include "TransactionInventory.h"
 #include "bitxorcore/extensions/ServiceRegistrar.h"
 #include "bitxorcore/net/PacketWriters.h"
 
@@ -29,6 +30,9 @@ namespace bitxorcore { namespace sync {
 	/// Gets the packet writers service from \a locator.
 	std::shared_ptr<net::PacketWriters> GetPacketWriters(const extensions::ServiceLocator& locator);
 
+	/// Gets the transaction inventory used for gossiping transactions from \a locator.
+	std::shared_ptr<TransactionInventory> GetTransactionInventory(const extensions::ServiceLocator& locator);
+
 	/// Creates a registrar for a packet writers service.
 	/// \note This service is responsible for sending data to peers.
 	DECLARE_SERVICE_REGISTRAR(NetworkPacketWriters)();
@@ -44,17 +44,41 @@ namespace bitxorcore { namespace sync {
 				return context.TransactionsCache.memorySize() >= maxCacheSize;
 			};
 		}
+
+		chain::UtUpdater::Throttle CreateDefaultUtUpdaterThrottle(utils::FileSize maxCacheSize, SpamThrottleStatistics& statistics) {
+			return [maxCacheSize, &statistics](const auto&, const auto& context) {
+				auto isFull = context.TransactionsCache.memorySize() >= maxCacheSize;
+				if (isFull)
+					++statistics.NumRejectedCacheFull;
+				else
+					++statistics.NumAccepted;
+
+				return isFull;
+			};
+		}
+
+		SpamThrottleConfiguration CreateSpamThrottleConfiguration(const config::BitxorCoreConfiguration& config) {
+			return SpamThrottleConfiguration(
+					config.Node.TransactionSpamThrottlingMaxBoostFee,
+					config.Blockchain.TotalChainImportance,
+					config.Node.UnconfirmedTransactionsCacheMaxSize,
+					config.Blockchain.MaxTransactionsPerBlock);
+		}
 	}
 
 	chain::UtUpdater::Throttle CreateUtUpdaterThrottle(const config::BitxorCoreConfiguration& config) {
-		SpamThrottleConfiguration throttleConfig(
-				config.Node.TransactionSpamThrottlingMaxBoostFee,
-				config.Blockchain.TotalChainImportance,
-				config.Node.UnconfirmedTransactionsCacheMaxSize,
-				config.Blockchain.MaxTransactionsPerBlock);
-
+		auto throttleConfig = CreateSpamThrottleConfiguration(config);
 		return config.Node.EnableTransactionSpamThrottling
 				? CreateTransactionSpamThrottle(throttleConfig, IsBondedTransaction)
 				: CreateDefaultUtUpdaterThrottle(throttleConfig.MaxCacheSize);
 	}
+
+	chain::UtUpdater::Throttle CreateUtUpdaterThrottle(
+			const config::BitxorCoreConfiguration& config,
+			SpamThrottleStatistics& statistics) {
+		auto throttleConfig = CreateSpamThrottleConfiguration(config);
+		return config.Node.EnableTransactionSpamThrottling
+				? CreateTransactionSpamThrottle(throttleConfig, IsBondedTransaction, statistics)
+				: CreateDefaultUtUpdaterThrottle(throttleConfig.MaxCacheSize, statistics);
+	}
 }}
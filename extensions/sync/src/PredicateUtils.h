@@ -29,9 +29,16 @@ namespace bitxorcore { namespace config { class BitxorCoreConfiguration; } }
 
 namespace bitxorcore { namespace sync {
 
+	struct SpamThrottleStatistics;
+
 	/// Converts a known hash predicate (\a knownHashPredicate) to a requires validation predicate.
 	model::MatchingEntityPredicate ToRequiresValidationPredicate(const chain::KnownHashPredicate& knownHashPredicate);
 
 	/// Creates a ut updater throttle based on \a config.
 	chain::UtUpdater::Throttle CreateUtUpdaterThrottle(const config::BitxorCoreConfiguration& config);
+
+	/// Creates a ut updater throttle based on \a config that records all decisions in \a statistics.
+	chain::UtUpdater::Throttle CreateUtUpdaterThrottle(
+			const config::BitxorCoreConfiguration& config,
+			SpamThrottleStatistics& statistics);
 }}
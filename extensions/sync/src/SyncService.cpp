@@ -23,14 +23,17 @@
 #include "SyncService.h"
 #include "NetworkPacketWritersService.h"
 #include "bitxorcore/api/LocalChainApi.h"
+#include "bitxorcore/api/MultiPeerRemoteChainApi.h"
 #include "bitxorcore/api/RemoteChainApi.h"
 #include "bitxorcore/api/RemoteTransactionApi.h"
 #include "bitxorcore/cache_tx/MemoryUtCache.h"
 #include "bitxorcore/chain/UtSynchronizer.h"
 #include "bitxorcore/config/BitxorCoreConfiguration.h"
 #include "bitxorcore/extensions/LocalNodeChainScore.h"
+#include "bitxorcore/extensions/NodeInteractionUtils.h"
 #include "bitxorcore/extensions/PeersConnectionTasks.h"
 #include "bitxorcore/extensions/SynchronizerTaskCallbacks.h"
+#include "bitxorcore/model/EntityHasher.h"
 #include "bitxorcore/thread/FutureUtils.h"
 #include "bitxorcore/utils/MemoryUtils.h"
 
@@ -67,18 +70,51 @@ namespace bitxorcore { namespace sync {
 					extensions::CreateLocalFinalizedHeightSupplier(state),
 					state.hooks().completionAwareBlockRangeConsumerFactory()(Sync_Source));
 
+			// measure all remote requests so that the fastest peers can be preferred
+			auto requestObserver = [&nodes = state.nodes()](const auto& identity, const auto& measurement) {
+				extensions::RecordTransferMeasurement(nodes, identity, measurement);
+			};
+
 			thread::Task task;
 			task.Name = "synchronizer task";
-			task.Callback = CreateSynchronizerTaskCallback(
-					std::move(chainSynchronizer),
-					api::CreateRemoteChainApi,
-					packetWriters,
-					state,
-					task.Name);
+			if (1 < config.Node.MaxParallelSyncPeers) {
+				task.Callback = CreateMultiPeerSynchronizerTaskCallback(
+						std::move(chainSynchronizer),
+						[requestObserver, &nodes = state.nodes()](const auto& packetIoPairs, const auto& registry) {
+							std::vector<std::unique_ptr<api::RemoteChainApi>> remoteApis;
+							for (const auto& packetIoPair : packetIoPairs) {
+								auto& io = *packetIoPair.io();
+								const auto& identity = packetIoPair.node().identity();
+								remoteApis.push_back(api::CreateMeasuredRemoteChainApi(io, identity, registry, requestObserver));
+							}
+
+							// interactions with the primary peer are recorded by the task callback
+							return api::CreateMultiPeerRemoteChainApi(std::move(remoteApis), [&nodes](const auto& result) {
+								extensions::IncrementNodeInteraction(nodes, result);
+							});
+						},
+						packetWriters,
+						state,
+						task.Name,
+						config.Node.MaxParallelSyncPeers);
+			} else {
+				task.Callback = CreateSynchronizerTaskCallback(
+						std::move(chainSynchronizer),
+						[requestObserver](auto& io, const auto& identity, const auto& registry) {
+							return api::CreateMeasuredRemoteChainApi(io, identity, registry, requestObserver);
+						},
+						packetWriters,
+						state,
+						task.Name);
+			}
+
 			return task;
 		}
 
-		thread::Task CreatePullUtTask(const extensions::ServiceState& state, net::PacketWriters& packetWriters) {
+		thread::TaskCallback CreatePullUtTaskCallback(
+				const extensions::ServiceState& state,
+				net::PacketWriters& packetWriters,
+				const std::string& taskName) {
 			auto utSynchronizer = chain::CreateUtSynchronizer(
 					state.config().Node.MinFeeMultiplier,
 					state.timeSupplier(),
@@ -86,14 +122,125 @@ namespace bitxorcore { namespace sync {
 					state.hooks().transactionRangeConsumerFactory()(Sync_Source),
 					extensions::CreateShouldProcessTransactionsPredicate(state));
 
-			thread::Task task;
-			task.Name = "pull unconfirmed transactions task";
-			task.Callback = CreateChainSyncAwareSynchronizerTaskCallback(
+			return CreateChainSyncAwareSynchronizerTaskCallback(
 					std::move(utSynchronizer),
 					api::CreateRemoteTransactionApi,
 					packetWriters,
 					state,
-					task.Name);
+					taskName);
+		}
+
+		thread::Task CreatePullUtTask(const extensions::ServiceState& state, net::PacketWriters& packetWriters) {
+			thread::Task task;
+			task.Name = "pull unconfirmed transactions task";
+			task.Callback = CreatePullUtTaskCallback(state, packetWriters, task.Name);
+			return task;
+		}
+
+		std::vector<utils::ShortHash> FindMissingShortHashes(
+				const std::vector<utils::ShortHash>& requestedShortHashes,
+				const model::TransactionRange& range,
+				const model::TransactionRegistry& registry,
+				const GenerationHashSeed& generationHashSeed) {
+			utils::ShortHashesSet receivedShortHashes;
+			for (const auto& transaction : range) {
+				const auto* pPlugin = registry.findPlugin(transaction.Type);
+				if (!pPlugin)
+					continue;
+
+				auto transactionHash = model::CalculateHash(transaction, generationHashSeed, pPlugin->dataBuffer(transaction));
+				receivedShortHashes.insert(utils::ToShortHash(transactionHash));
+			}
+
+			std::vector<utils::ShortHash> missingShortHashes;
+			for (auto shortHash : requestedShortHashes) {
+				if (receivedShortHashes.cend() == receivedShortHashes.find(shortHash))
+					missingShortHashes.push_back(shortHash);
+			}
+
+			return missingShortHashes;
+		}
+
+		thread::future<bool> PullAnnouncedTransactions(
+				const ionet::NodePacketIoPair& packetIoPair,
+				AnnouncedShortHashes&& request,
+				TransactionInventory& inventory,
+				const extensions::ServiceState& state) {
+			const auto& registry = state.pluginManager().transactionRegistry();
+			auto pApi = std::shared_ptr<api::RemoteTransactionApi>(
+					api::CreateRemoteTransactionApi(*packetIoPair.io(), packetIoPair.node().identity(), registry));
+
+			const auto& shortHashes = request.ShortHashes;
+			auto shortHashesRange = model::ShortHashRange::CopyFixed(
+					reinterpret_cast<const uint8_t*>(shortHashes.data()),
+					shortHashes.size());
+			auto pRequest = std::make_shared<AnnouncedShortHashes>(std::move(request));
+			auto rangeConsumer = state.hooks().transactionRangeConsumerFactory()(Sync_Source);
+			auto generationHashSeed = state.config().Blockchain.Network.GenerationHashSeed;
+			return pApi->announcedTransactions(std::move(shortHashesRange)).then([packetIoPair, pApi, pRequest, &inventory, &state,
+					&registry, rangeConsumer, generationHashSeed](auto&& rangeFuture) {
+				const auto& identity = packetIoPair.node().identity();
+				auto interactionCode = ionet::NodeInteractionResultCode::Success;
+				try {
+					auto range = rangeFuture.get();
+
+					// only the actual request and response packet sizes are accounted for
+					uint64_t numPullBytes = 2 * sizeof(ionet::PacketHeader) + pRequest->ShortHashes.size() * sizeof(utils::ShortHash);
+					for (const auto& transaction : range)
+						numPullBytes += transaction.Size;
+
+					inventory.recordPull(numPullBytes);
+					inventory.release(FindMissingShortHashes(pRequest->ShortHashes, range, registry, generationHashSeed));
+					if (!range.empty())
+						rangeConsumer(model::AnnotatedTransactionRange(std::move(range), identity));
+				} catch (const bitxorcore_runtime_error& e) {
+					BITXORCORE_LOG(warning) << "pulling announced transactions from " << identity << " failed: " << e.what();
+					inventory.release(pRequest->ShortHashes);
+					interactionCode = ionet::NodeInteractionResultCode::Failure;
+				}
+
+				extensions::IncrementNodeInteraction(state.nodes(), ionet::NodeInteractionResult(identity, interactionCode));
+				return ionet::NodeInteractionResultCode::Success == interactionCode;
+			});
+		}
+
+		thread::Task CreatePullAnnouncedUtTask(
+				const extensions::ServiceState& state,
+				net::PacketWriters& packetWriters,
+				TransactionInventory& inventory) {
+			thread::Task task;
+			task.Name = "pull announced transactions task";
+
+			// announced transactions are pulled from the announcing peers; whenever an announcing peer cannot be reached,
+			// the corresponding short hashes are released and the transactions are retrieved by the regular pull task
+			const auto& chainSynced = state.hooks().chainSyncedPredicate();
+			auto shouldProcessTransactions = extensions::CreateShouldProcessTransactionsPredicate(state);
+			task.Callback = [&state, &packetWriters, &inventory, chainSynced, shouldProcessTransactions]() {
+				auto requests = inventory.takePendingRequests();
+				if (requests.empty())
+					return thread::make_ready_future(thread::TaskResult::Continue);
+
+				auto canPull = chainSynced() && shouldProcessTransactions();
+				std::vector<thread::future<bool>> pullFutures;
+				for (auto& request : requests) {
+					auto packetIoPair = canPull
+							? packetWriters.pickOneByKey(request.AnnouncerKey, state.config().Node.SyncTimeout)
+							: ionet::NodePacketIoPair();
+					if (!packetIoPair) {
+						inventory.release(request.ShortHashes);
+						continue;
+					}
+
+					pullFutures.push_back(PullAnnouncedTransactions(packetIoPair, std::move(request), inventory, state));
+				}
+
+				if (pullFutures.empty())
+					return thread::make_ready_future(thread::TaskResult::Continue);
+
+				return thread::when_all(std::move(pullFutures)).then([](auto&&) {
+					return thread::TaskResult::Continue;
+				});
+			};
 			return task;
 		}
 
@@ -114,6 +261,9 @@ namespace bitxorcore { namespace sync {
 				state.tasks().push_back(CreateConnectPeersTask(state, packetWriters));
 				state.tasks().push_back(CreateSynchronizerTask(state, packetWriters));
 				state.tasks().push_back(CreatePullUtTask(state, packetWriters));
+
+				if (state.config().Node.EnableTransactionInventoryGossip)
+					state.tasks().push_back(CreatePullAnnouncedUtTask(state, packetWriters, *GetTransactionInventory(locator)));
 			}
 		};
 	}
@@ -0,0 +1,190 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "TransactionInventory.h"
+#include "bitxorcore/ionet/BroadcastUtils.h"
+#include <algorithm>
+
+namespace bitxorcore { namespace sync {
+
+	namespace {
+		constexpr auto Entry_Size = sizeof(model::TransactionInventoryEntry);
+	}
+
+	TransactionInventory::TransactionInventory(size_t maxKnownHashes)
+			: m_maxKnownHashes(maxKnownHashes)
+			, m_numKnownHashes(0)
+	{}
+
+	const TransactionInventoryStatistics& TransactionInventory::statistics() const {
+		return m_statistics;
+	}
+
+	size_t TransactionInventory::numKnownHashes() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_numKnownHashes;
+	}
+
+	bool TransactionInventory::contains(utils::ShortHash shortHash) const {
+		utils::SpinLockGuard guard(m_lock);
+		auto iter = m_transactions.find(shortHash);
+		return m_transactions.cend() != iter && iter->second.IsKnown;
+	}
+
+	void TransactionInventory::addKnown(const std::vector<model::TransactionInfo>& transactionInfos) {
+		utils::SpinLockGuard guard(m_lock);
+		for (const auto& transactionInfo : transactionInfos)
+			addKnownUnlocked(utils::ToShortHash(transactionInfo.EntityHash), transactionInfo.pEntity->Size);
+	}
+
+	ionet::PacketPayload TransactionInventory::announce(const std::vector<model::TransactionInfo>& transactionInfos, size_t numPeers) {
+		addKnown(transactionInfos);
+
+		uint64_t numPushPacketBytes = sizeof(ionet::PacketHeader);
+		for (const auto& transactionInfo : transactionInfos)
+			numPushPacketBytes += transactionInfo.pEntity->Size;
+
+		auto payload = ionet::CreateTransactionInventoryPayload(transactionInfos);
+		uint64_t numInventoryPacketBytes = payload.header().Size;
+		if (numPushPacketBytes > numInventoryPacketBytes)
+			m_statistics.NumWithheldBytes += (numPushPacketBytes - numInventoryPacketBytes) * numPeers;
+
+		m_statistics.NumAnnounced += transactionInfos.size();
+		return payload;
+	}
+
+	size_t TransactionInventory::receive(const model::TransactionInventoryRange& entries, const Key& announcerKey) {
+		size_t numUnknown = 0;
+		uint64_t numDuplicateBytes = 0;
+		{
+			utils::SpinLockGuard guard(m_lock);
+			for (const auto& entry : entries) {
+				if (addRequestedUnlocked(entry.ShortHash)) {
+					m_pendingRequests[announcerKey].push_back(entry.ShortHash);
+					++numUnknown;
+					continue;
+				}
+
+				// bodies of requested transactions have not been received yet, so only known transactions have a reliable size
+				const auto& trackedTransaction = m_transactions.find(entry.ShortHash)->second;
+				if (trackedTransaction.IsKnown && trackedTransaction.Size > Entry_Size)
+					numDuplicateBytes += trackedTransaction.Size - Entry_Size;
+			}
+		}
+
+		m_statistics.NumReceived += entries.size();
+		m_statistics.NumDuplicates += entries.size() - numUnknown;
+		m_statistics.NumDuplicateBytes += numDuplicateBytes;
+		return numUnknown;
+	}
+
+	std::vector<AnnouncedShortHashes> TransactionInventory::takePendingRequests() {
+		std::vector<AnnouncedShortHashes> requests;
+		{
+			utils::SpinLockGuard guard(m_lock);
+			for (auto& pair : m_pendingRequests)
+				requests.push_back({ pair.first, std::move(pair.second) });
+
+			m_pendingRequests.clear();
+		}
+
+		m_statistics.NumPullRequests += requests.size();
+		return requests;
+	}
+
+	void TransactionInventory::release(const std::vector<utils::ShortHash>& shortHashes) {
+		utils::SpinLockGuard guard(m_lock);
+		utils::ShortHashesSet releasedShortHashes;
+		for (auto shortHash : shortHashes) {
+			auto iter = m_transactions.find(shortHash);
+			if (m_transactions.cend() == iter || iter->second.IsKnown)
+				continue;
+
+			m_transactions.erase(iter);
+			releasedShortHashes.insert(shortHash);
+		}
+
+		if (releasedShortHashes.empty())
+			return;
+
+		m_transactionsQueue.erase(std::remove_if(m_transactionsQueue.begin(), m_transactionsQueue.end(), [&releasedShortHashes](
+				auto shortHash) {
+			return releasedShortHashes.cend() != releasedShortHashes.find(shortHash);
+		}), m_transactionsQueue.end());
+	}
+
+	void TransactionInventory::recordPull(uint64_t numBytes) {
+		m_statistics.NumPullBytes += numBytes;
+	}
+
+	void TransactionInventory::recordServedPull(uint64_t numBytes) {
+		// bytes served to pulling peers offset the bytes withheld by announcing
+		auto& numWithheldBytes = m_statistics.NumWithheldBytes;
+		auto currentValue = numWithheldBytes.load();
+		while (!numWithheldBytes.compare_exchange_weak(currentValue, currentValue > numBytes ? currentValue - numBytes : 0))
+		{}
+	}
+
+	void TransactionInventory::addKnownUnlocked(utils::ShortHash shortHash, uint32_t size) {
+		// when nothing can be remembered, every announced transaction needs to be treated as unknown
+		if (0 == m_maxKnownHashes)
+			return;
+
+		auto iter = m_transactions.find(shortHash);
+		if (m_transactions.cend() != iter) {
+			if (!iter->second.IsKnown) {
+				iter->second = { true, size };
+				++m_numKnownHashes;
+			}
+
+			return;
+		}
+
+		m_transactions.emplace(shortHash, TrackedTransaction{ true, size });
+		m_transactionsQueue.push_back(shortHash);
+		++m_numKnownHashes;
+		pruneUnlocked();
+	}
+
+	bool TransactionInventory::addRequestedUnlocked(utils::ShortHash shortHash) {
+		if (0 == m_maxKnownHashes)
+			return true;
+
+		if (!m_transactions.emplace(shortHash, TrackedTransaction{ false, 0 }).second)
+			return false;
+
+		m_transactionsQueue.push_back(shortHash);
+		pruneUnlocked();
+		return true;
+	}
+
+	void TransactionInventory::pruneUnlocked() {
+		while (m_transactionsQueue.size() > m_maxKnownHashes) {
+			auto iter = m_transactions.find(m_transactionsQueue.front());
+			if (iter->second.IsKnown)
+				--m_numKnownHashes;
+
+			m_transactions.erase(iter);
+			m_transactionsQueue.pop_front();
+		}
+	}
+}}
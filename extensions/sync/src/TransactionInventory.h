@@ -0,0 +1,146 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "bitxorcore/ionet/PacketPayload.h"
+#include "bitxorcore/model/EntityInfo.h"
+#include "bitxorcore/model/TransactionInventoryEntry.h"
+#include "bitxorcore/utils/Hashers.h"
+#include "bitxorcore/utils/ShortHash.h"
+#include "bitxorcore/utils/SpinLock.h"
+#include <atomic>
+#include <deque>
+#include <unordered_map>
+
+namespace bitxorcore { namespace sync {
+
+	/// Transaction inventory statistics.
+	struct TransactionInventoryStatistics {
+	public:
+		/// Creates zeroed statistics.
+		TransactionInventoryStatistics()
+				: NumAnnounced(0)
+				, NumWithheldBytes(0)
+				, NumReceived(0)
+				, NumDuplicates(0)
+				, NumDuplicateBytes(0)
+				, NumPullRequests(0)
+				, NumPullBytes(0)
+		{}
+
+	public:
+		/// Number of transactions announced to peers.
+		std::atomic<uint64_t> NumAnnounced;
+
+		/// Number of bytes saved (across all peers) by announcing transactions instead of pushing them.
+		/// \note This is the difference between the push and inventory packet sizes less all bytes served to pulling peers.
+		std::atomic<uint64_t> NumWithheldBytes;
+
+		/// Number of transaction announcements received from peers.
+		std::atomic<uint64_t> NumReceived;
+
+		/// Number of received announcements of already known or already requested transactions.
+		std::atomic<uint64_t> NumDuplicates;
+
+		/// Number of duplicate transaction bytes that were not received because only an announcement was sent.
+		/// \note This is based on the sizes of the locally known transactions.
+		std::atomic<uint64_t> NumDuplicateBytes;
+
+		/// Number of pulls requested from announcing peers.
+		std::atomic<uint64_t> NumPullRequests;
+
+		/// Number of bytes transferred by pull requests and responses.
+		std::atomic<uint64_t> NumPullBytes;
+	};
+
+	/// Short hashes of unknown transactions announced by a single peer.
+	struct AnnouncedShortHashes {
+		/// Identity key of the announcing peer.
+		Key AnnouncerKey;
+
+		/// Announced short hashes.
+		std::vector<utils::ShortHash> ShortHashes;
+	};
+
+	/// Tracks the short hashes of recently seen unconfirmed transactions so that new transactions can be gossiped by
+	/// announcing short hashes instead of pushing full transactions to every peer.
+	/// \note Short hashes of announced unknown transactions are requested from the announcing peers and are only marked as
+	///        known once the corresponding transactions are received.
+	class TransactionInventory {
+	public:
+		/// Creates an inventory that remembers at most \a maxKnownHashes short hashes.
+		explicit TransactionInventory(size_t maxKnownHashes);
+
+	public:
+		/// Gets the inventory statistics.
+		const TransactionInventoryStatistics& statistics() const;
+
+		/// Gets the number of known short hashes.
+		size_t numKnownHashes() const;
+
+		/// Returns \c true if \a shortHash is known.
+		bool contains(utils::ShortHash shortHash) const;
+
+	public:
+		/// Marks all transactions in \a transactionInfos as known.
+		void addKnown(const std::vector<model::TransactionInfo>& transactionInfos);
+
+		/// Marks all transactions in \a transactionInfos as known and creates a payload announcing them to \a numPeers peers.
+		ionet::PacketPayload announce(const std::vector<model::TransactionInfo>& transactionInfos, size_t numPeers);
+
+		/// Processes \a entries announced by the peer with identity \a announcerKey and returns the number of previously
+		/// unknown transactions.
+		/// \note Unknown transactions are marked as requested so that they are only pulled once.
+		size_t receive(const model::TransactionInventoryRange& entries, const Key& announcerKey);
+
+		/// Takes all short hashes that need to be requested grouped by announcing peer.
+		std::vector<AnnouncedShortHashes> takePendingRequests();
+
+		/// Forgets requested \a shortHashes that were not received so that they can be requested again.
+		void release(const std::vector<utils::ShortHash>& shortHashes);
+
+		/// Records \a numBytes transferred while pulling announced transactions from a peer.
+		void recordPull(uint64_t numBytes);
+
+		/// Records \a numBytes transferred while serving announced transactions to a pulling peer.
+		void recordServedPull(uint64_t numBytes);
+
+	private:
+		struct TrackedTransaction {
+			bool IsKnown;
+			uint32_t Size;
+		};
+
+		void addKnownUnlocked(utils::ShortHash shortHash, uint32_t size);
+		bool addRequestedUnlocked(utils::ShortHash shortHash);
+		void pruneUnlocked();
+
+	private:
+		size_t m_maxKnownHashes;
+		std::unordered_map<utils::ShortHash, TrackedTransaction, utils::ShortHashHasher> m_transactions;
+		std::deque<utils::ShortHash> m_transactionsQueue;
+		size_t m_numKnownHashes;
+		std::unordered_map<Key, std::vector<utils::ShortHash>, utils::ArrayHasher<Key>> m_pendingRequests;
+		TransactionInventoryStatistics m_statistics;
+		mutable utils::SpinLock m_lock;
+	};
+}}
@@ -25,8 +25,12 @@
 #include "bitxorcore/cache_core/AccountStateCache.h"
 #include "bitxorcore/cache_core/ImportanceView.h"
 #include "bitxorcore/cache_tx/MemoryUtCache.h"
+#include "bitxorcore/model/HeightGrouping.h"
 #include "bitxorcore/model/Transaction.h"
+#include "bitxorcore/utils/Hashers.h"
+#include "bitxorcore/utils/StackTimer.h"
 #include <cmath>
+#include <unordered_map>
 
 namespace bitxorcore { namespace sync {
 
@@ -52,36 +56,111 @@ namespace bitxorcore { namespace sync {
 			return static_cast<size_t>(scaleFactor * importancePercentage * 100.0 * slotsLeft);
 		}
 
+		// region ImportanceTable
+
+		/// Signer importances memoized for a single cache generation.
+		/// \note Throttle calls are serialized by the ut updater (under the ut cache modifier lock), so no locking is needed.
+		class ImportanceTable {
+		public:
+			explicit ImportanceTable(size_t maxSize)
+					: m_maxSize(maxSize)
+					, m_cacheGeneration(0)
+			{}
+
+		public:
+			Importance get(
+					const Key& signer,
+					const chain::UtUpdater::ThrottleContext& context,
+					SpamThrottleStatistics& statistics) {
+				auto readOnlyAccountStateCache = context.UnconfirmedBitxorCoreCache.sub<cache::AccountStateCache>();
+				auto importanceGrouping = readOnlyAccountStateCache.importanceGrouping();
+				auto importanceHeight = model::ConvertToImportanceHeight(context.CacheHeight, importanceGrouping);
+
+				// confirmed state (importances and key links) can only change when the cache is rebased after a commit or rollback,
+				// even when the importance height is unchanged (e.g. after a rollback within the same importance grouping)
+				if (context.CacheGeneration != m_cacheGeneration
+						|| importanceHeight != m_importanceHeight
+						|| m_importances.size() >= m_maxSize) {
+					m_importances.clear();
+					m_cacheGeneration = context.CacheGeneration;
+					m_importanceHeight = importanceHeight;
+				}
+
+				auto iter = m_importances.find(signer);
+				if (m_importances.cend() != iter) {
+					++statistics.NumImportanceCacheHits;
+					return iter->second;
+				}
+
+				++statistics.NumImportanceCacheMisses;
+				cache::ImportanceView importanceView(readOnlyAccountStateCache);
+				auto importance = importanceView.getAccountImportanceOrDefault(signer, context.CacheHeight);
+				m_importances.emplace(signer, importance);
+				return importance;
+			}
+
+		private:
+			size_t m_maxSize;
+			uint64_t m_cacheGeneration;
+			model::ImportanceHeight m_importanceHeight;
+			std::unordered_map<Key, Importance, utils::ArrayHasher<Key>> m_importances;
+		};
+
+		// endregion
+
+		// region TransactionSpamThrottle
+
+		constexpr size_t Max_Memoized_Importances = 100'000;
+
 		class TransactionSpamThrottle {
 		private:
 			using TransactionSource = chain::UtUpdater::TransactionSource;
 
 		public:
-			TransactionSpamThrottle(const SpamThrottleConfiguration& config, const predicate<const model::Transaction&>& isBonded)
+			TransactionSpamThrottle(
+					const SpamThrottleConfiguration& config,
+					const predicate<const model::Transaction&>& isBonded,
+					SpamThrottleStatistics& statistics,
+					const std::shared_ptr<SpamThrottleStatistics>& pOwnedStatistics = nullptr)
 					: m_config(config)
 					, m_isBonded(isBonded)
+					, m_statistics(statistics)
+					, m_pOwnedStatistics(pOwnedStatistics)
+					, m_pImportanceTable(std::make_shared<ImportanceTable>(Max_Memoized_Importances))
 			{}
 
 		public:
 			bool operator()(const model::TransactionInfo& transactionInfo, const chain::UtUpdater::ThrottleContext& context) const {
+				utils::StackTimer stopwatch;
+				auto result = isThrottled(transactionInfo, context);
+				m_statistics.TotalDecisionMicros += stopwatch.micros();
+				return result;
+			}
+
+		private:
+			bool isThrottled(const model::TransactionInfo& transactionInfo, const chain::UtUpdater::ThrottleContext& context) const {
 				// always reject if cache is completely full
 				auto cacheMemorySize = context.TransactionsCache.memorySize();
-				if (cacheMemorySize >= m_config.MaxCacheSize)
+				if (cacheMemorySize >= m_config.MaxCacheSize) {
+					++m_statistics.NumRejectedCacheFull;
 					return true;
+				}
 
 				// do not apply throttle unless cache contains more transactions than can fit in a single block
 				auto cacheSize = context.TransactionsCache.size();
-				if (m_config.MaxTransactionsPerBlock > cacheSize)
+				if (m_config.MaxTransactionsPerBlock > cacheSize) {
+					++m_statistics.NumAccepted;
 					return false;
+				}
 
 				// bonded transactions and transactions originating from reverted blocks do not get rejected
-				if (m_isBonded(*transactionInfo.pEntity) || TransactionSource::Reverted == context.TransactionSource)
+				if (m_isBonded(*transactionInfo.pEntity) || TransactionSource::Reverted == context.TransactionSource) {
+					++m_statistics.NumBypassed;
 					return false;
+				}
 
 				const auto& signer = transactionInfo.pEntity->SignerPublicKey;
-				auto readOnlyAccountStateCache = context.UnconfirmedBitxorCoreCache.sub<cache::AccountStateCache>();
-				cache::ImportanceView importanceView(readOnlyAccountStateCache);
-				auto importance = importanceView.getAccountImportanceOrDefault(signer, context.CacheHeight);
+				auto importance = m_pImportanceTable->get(signer, context, m_statistics);
 				auto effectiveImportance = GetEffectiveImportance(transactionInfo.pEntity->MaxFee, importance, m_config);
 				auto maxTransactionsWeight = GetMaxTransactionsWeight(
 						cacheMemorySize.bytes(),
@@ -89,18 +168,39 @@ namespace bitxorcore { namespace sync {
 						effectiveImportance,
 						m_config.TotalImportance);
 				auto usedWeight = context.TransactionsCache.memorySizeForAccount(signer).bytes();
-				return usedWeight + transactionInfo.pEntity->Size >= maxTransactionsWeight;
+				if (usedWeight + transactionInfo.pEntity->Size >= maxTransactionsWeight) {
+					++m_statistics.NumThrottled;
+					return true;
+				}
+
+				++m_statistics.NumAccepted;
+				return false;
 			}
 
 		private:
 			SpamThrottleConfiguration m_config;
 			predicate<const model::Transaction&> m_isBonded;
+			SpamThrottleStatistics& m_statistics;
+			std::shared_ptr<SpamThrottleStatistics> m_pOwnedStatistics;
+
+			// shared because the throttle is copied into a std::function
+			std::shared_ptr<ImportanceTable> m_pImportanceTable;
 		};
+
+		// endregion
 	}
 
 	chain::UtUpdater::Throttle CreateTransactionSpamThrottle(
 			const SpamThrottleConfiguration& config,
 			const predicate<const model::Transaction&>& isBonded) {
-		return TransactionSpamThrottle(config, isBonded);
+		auto pStatistics = std::make_shared<SpamThrottleStatistics>();
+		return TransactionSpamThrottle(config, isBonded, *pStatistics, pStatistics);
+	}
+
+	chain::UtUpdater::Throttle CreateTransactionSpamThrottle(
+			const SpamThrottleConfiguration& config,
+			const predicate<const model::Transaction&>& isBonded,
+			SpamThrottleStatistics& statistics) {
+		return TransactionSpamThrottle(config, isBonded, statistics);
 	}
 }}
@@ -23,6 +23,7 @@
 #pragma once
 #include "bitxorcore/chain/UtUpdater.h"
 #include "bitxorcore/utils/FileSize.h"
+#include <atomic>
 
 namespace bitxorcore { namespace sync {
 
@@ -62,9 +63,55 @@ namespace bitxorcore { namespace sync {
 		uint32_t MaxTransactionsPerBlock;
 	};
 
+	/// Spam throttle statistics.
+	struct SpamThrottleStatistics {
+	public:
+		/// Creates zeroed statistics.
+		SpamThrottleStatistics()
+				: NumAccepted(0)
+				, NumRejectedCacheFull(0)
+				, NumThrottled(0)
+				, NumBypassed(0)
+				, NumImportanceCacheHits(0)
+				, NumImportanceCacheMisses(0)
+				, TotalDecisionMicros(0)
+		{}
+
+	public:
+		/// Number of transactions accepted by the throttle.
+		std::atomic<uint64_t> NumAccepted;
+
+		/// Number of transactions rejected because the cache is full.
+		std::atomic<uint64_t> NumRejectedCacheFull;
+
+		/// Number of transactions rejected because the signer exceeded its weighted share of the cache.
+		std::atomic<uint64_t> NumThrottled;
+
+		/// Number of bonded or reverted transactions accepted without an importance check.
+		std::atomic<uint64_t> NumBypassed;
+
+		/// Number of signer importance lookups served from the memoized importance table.
+		std::atomic<uint64_t> NumImportanceCacheHits;
+
+		/// Number of signer importance lookups that required an account state cache lookup.
+		std::atomic<uint64_t> NumImportanceCacheMisses;
+
+		/// Total time spent making throttle decisions (in microseconds).
+		std::atomic<uint64_t> TotalDecisionMicros;
+	};
+
 	/// Creates a throttle using \a config to filter out transactions that are considered to be spam.
 	/// \a isBonded indicates whether a transaction is bonded or not.
 	chain::UtUpdater::Throttle CreateTransactionSpamThrottle(
 			const SpamThrottleConfiguration& config,
 			const predicate<const model::Transaction&>& isBonded);
+
+	/// Creates a throttle using \a config to filter out transactions that are considered to be spam and
+	/// records all decisions in \a statistics.
+	/// \a isBonded indicates whether a transaction is bonded or not.
+	/// \note \a statistics must outlive the returned throttle.
+	chain::UtUpdater::Throttle CreateTransactionSpamThrottle(
+			const SpamThrottleConfiguration& config,
+			const predicate<const model::Transaction&>& isBonded,
+			SpamThrottleStatistics& statistics);
 }}
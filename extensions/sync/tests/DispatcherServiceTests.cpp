@@ -22,6 +22,7 @@
 
 #include "sync/src/DispatcherService.h"
 #include "sdk/src/extensions/TransactionExtensions.h"
+#include "bitxorcore/consumers/TracingConsumers.h"
 #include "bitxorcore/cache_core/AccountStateCache.h"
 #include "bitxorcore/cache_core/BlockStatisticCache.h"
 #include "bitxorcore/disruptor/ConsumerDispatcher.h"
@@ -29,6 +30,8 @@
 #include "bitxorcore/model/BlockUtils.h"
 #include "bitxorcore/plugins/PluginLoader.h"
 #include "bitxorcore/preprocessor.h"
+#include "bitxorcore/thread/ComputeThreadPool.h"
+#include "bitxorcore/utils/TraceRecorder.h"
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/mocks/MockTransaction.h"
@@ -40,6 +43,7 @@
 #include "tests/test/other/mocks/MockNotificationValidator.h"
 #include "tests/TestHarness.h"
 #include <filesystem>
+#include <set>
 
 using ValidationResult = bitxorcore::validators::ValidationResult;
 
@@ -48,8 +52,8 @@ namespace bitxorcore { namespace sync {
 #define TEST_CLASS DispatcherServiceTests
 
 	namespace {
-		constexpr auto Num_Expected_Services = 5u;
-		constexpr auto Num_Expected_Counters = 10u;
+		constexpr auto Num_Expected_Services = 8u;
+		constexpr auto Num_Expected_Counters = 20u;
 		constexpr auto Num_Expected_Tasks = 1u;
 
 		constexpr auto Block_Elements_Counter_Name = "BLK ELEM TOT";
@@ -60,6 +64,10 @@ namespace bitxorcore { namespace sync {
 		constexpr auto Rollback_Elements_Committed_Recent = "RB COMMIT RCT";
 		constexpr auto Rollback_Elements_Ignored_All = "RB IGNORE ALL";
 		constexpr auto Rollback_Elements_Ignored_Recent = "RB IGNORE RCT";
+		constexpr auto Throttle_Counter_Names = {
+			"UT THR ACCEPT", "UT THR FULL", "UT THR SPAM", "UT THR BYPASS", "UT THR HIT", "UT THR MISS", "UT THR TIME"
+		};
+		constexpr auto Hash_Cache_Counter_Names = { "TX HASH HIT", "TX HASH MISS", "TX HASH PRUNE" };
 		constexpr auto Sentinel_Counter_Value = extensions::ServiceLocator::Sentinel_Counter_Value;
 
 		// region utils
@@ -351,8 +359,11 @@ namespace bitxorcore { namespace sync {
 		// - all services should exist
 		EXPECT_TRUE(!!context.locator().service<disruptor::ConsumerDispatcher>("dispatcher.block"));
 		EXPECT_TRUE(!!context.locator().service<disruptor::ConsumerDispatcher>("dispatcher.transaction"));
+		EXPECT_TRUE(!!context.locator().service<thread::ComputeThreadPool>("dispatcher.compute"));
 		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.transaction.batch"));
 		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.utUpdater"));
+		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.utThrottle"));
+		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.transaction.hashCache"));
 		EXPECT_TRUE(!!context.locator().service<void>("rollbacks"));
 
 		// - all counters should be zero
@@ -364,6 +375,11 @@ namespace bitxorcore { namespace sync {
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Committed_Recent));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_All));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_Recent));
+		for (const auto* counterName : Throttle_Counter_Names)
+			EXPECT_EQ(0u, context.counter(counterName)) << counterName;
+
+		for (const auto* counterName : Hash_Cache_Counter_Names)
+			EXPECT_EQ(0u, context.counter(counterName)) << counterName;
 
 		// - block dispatcher should be initialized
 		auto blockDispatcherStatus = GetBlockDispatcherStatus(context.locator());
@@ -417,6 +433,55 @@ namespace bitxorcore { namespace sync {
 		EXPECT_EQ(5u, GetTransactionDispatcherStatus(context.locator()).Size);
 	}
 
+	namespace {
+		void EnableTracing(const config::NodeConfiguration& config) {
+			const_cast<bool&>(config.EnableDispatcherTracing) = true;
+			const_cast<uint32_t&>(config.DispatcherTraceMaxEventsPerThread) = 100;
+			const_cast<utils::TimeSpan&>(config.DispatcherTraceSlowBlockThreshold) = utils::TimeSpan::FromHours(1);
+			const_cast<uint32_t&>(config.DispatcherTraceMaxFiles) = 10;
+		}
+	}
+
+	TEST(TEST_CLASS, CanBootServiceWithTracingEnabled) {
+		// Arrange: enable tracing
+		TestContext context;
+		EnableTracing(context.testState().config().Node);
+
+		// Act:
+		context.boot();
+
+		// Assert: tracing services are registered
+		EXPECT_EQ(Num_Expected_Services + 2, context.locator().numServices());
+		EXPECT_EQ(Num_Expected_Counters, context.locator().counters().size());
+		EXPECT_EQ(Num_Expected_Tasks, context.testState().state().tasks().size());
+
+		auto pTraceRecorder = context.locator().service<utils::TraceRecorder>("dispatcher.tracer");
+		ASSERT_TRUE(!!pTraceRecorder);
+		EXPECT_EQ(pTraceRecorder, utils::GetInstalledTraceRecorder());
+		EXPECT_TRUE(!!context.locator().service<consumers::SlowBlockTraceDumper>("dispatcher.traceDumper"));
+
+		// - only the block dispatcher has an additional consumer
+		EXPECT_EQ(8u, GetBlockDispatcherStatus(context.locator()).Size);
+		EXPECT_EQ(5u, GetTransactionDispatcherStatus(context.locator()).Size);
+
+		// - traces directory was created
+		EXPECT_TRUE(std::filesystem::is_directory(context.tempPath() / "traces"));
+	}
+
+	TEST(TEST_CLASS, CanShutdownServiceWithTracingEnabled) {
+		// Arrange: enable tracing
+		TestContext context;
+		EnableTracing(context.testState().config().Node);
+
+		// Act:
+		context.boot();
+		context.shutdown();
+
+		// Assert: trace recorder is rooted but no longer installed
+		EXPECT_TRUE(!!context.locator().service<utils::TraceRecorder>("dispatcher.tracer"));
+		EXPECT_FALSE(!!utils::GetInstalledTraceRecorder());
+	}
+
 	TEST(TEST_CLASS, CanShutdownService) {
 		// Arrange:
 		TestContext context;
@@ -433,8 +498,11 @@ namespace bitxorcore { namespace sync {
 		// - only rooted services exist
 		EXPECT_FALSE(!!context.locator().service<disruptor::ConsumerDispatcher>("dispatcher.block"));
 		EXPECT_FALSE(!!context.locator().service<disruptor::ConsumerDispatcher>("dispatcher.transaction"));
+		EXPECT_FALSE(!!context.locator().service<thread::ComputeThreadPool>("dispatcher.compute"));
 		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.transaction.batch"));
 		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.utUpdater"));
+		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.utThrottle"));
+		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.transaction.hashCache"));
 		EXPECT_TRUE(!!context.locator().service<void>("rollbacks"));
 
 		// - all counters should indicate shutdown
@@ -446,6 +514,39 @@ namespace bitxorcore { namespace sync {
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Committed_Recent));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_All));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_Recent));
+		for (const auto* counterName : Throttle_Counter_Names)
+			EXPECT_EQ(0u, context.counter(counterName)) << counterName;
+
+		for (const auto* counterName : Hash_Cache_Counter_Names)
+			EXPECT_EQ(0u, context.counter(counterName)) << counterName;
+	}
+
+	TEST(TEST_CLASS, CanBootServiceWithCustomComputeThreadPool) {
+		// Arrange: customize compute pool (pin all workers to first cpu)
+		TestContext context;
+		auto& nodeConfig = const_cast<config::NodeConfiguration&>(context.testState().config().Node);
+		nodeConfig.ComputeThreadPoolSize = 3;
+		nodeConfig.ComputeThreadPoolCpuAffinity = { "0" };
+
+		// Act:
+		context.boot();
+
+		// Assert:
+		EXPECT_EQ(Num_Expected_Services, context.locator().numServices());
+
+		auto pComputePool = context.locator().service<thread::ComputeThreadPool>("dispatcher.compute");
+		EXPECT_EQ(3u, pComputePool->numWorkerThreads());
+		EXPECT_EQ("compute", pComputePool->name());
+	}
+
+	TEST(TEST_CLASS, CannotBootServiceWithInvalidComputeThreadPoolCpuAffinity) {
+		// Arrange:
+		TestContext context;
+		auto& nodeConfig = const_cast<config::NodeConfiguration&>(context.testState().config().Node);
+		nodeConfig.ComputeThreadPoolCpuAffinity = { "0", "first" };
+
+		// Act + Assert:
+		EXPECT_THROW(context.boot(), bitxorcore_invalid_argument);
 	}
 
 	TEST(TEST_CLASS, TasksAreRegistered) {
@@ -545,6 +646,33 @@ namespace bitxorcore { namespace sync {
 		});
 	}
 
+	TEST(TEST_CLASS, CanConsumeBlockRange_ValidElement_WithTracingEnabled) {
+		// Arrange:
+		TestContext context;
+		EnableTracing(context.testState().config().Node);
+		context.boot();
+
+		auto pNextBlock = CreateValidBlockForDispatcherTests(GetBlockSignerKeyPair());
+		auto factory = context.testState().state().hooks().blockRangeConsumerFactory()(disruptor::InputSource::Local);
+
+		// Act:
+		factory(test::CreateEntityRange({ pNextBlock.get() }));
+		WAIT_FOR_ONE_EXPR(context.numNewBlockSinkCalls());
+		WAIT_FOR_ZERO_EXPR(context.counter(Block_Elements_Active_Counter_Name));
+
+		// Assert: spans were recorded for block consumers and cache commit
+		std::set<std::string> names;
+		for (const auto& event : context.locator().service<utils::TraceRecorder>("dispatcher.tracer")->snapshot().Events) {
+			names.emplace(event.Name);
+			if (std::string("dispatcher") == event.Category) {
+				EXPECT_EQ(pNextBlock->Height, event.Height) << event.Name;
+			}
+		}
+
+		for (const auto* name : { "hash calculator", "stateless validation", "blockchain sync", "new block", "commit all", "commit" })
+			EXPECT_CONTAINS(names, name);
+	}
+
 	TEST(TEST_CLASS, CanConsumeBlockRange_InvalidElement_WithVerifiableReceipts) {
 		// Arrange: block does not contain correct block receipts hash, so should get rejected
 		auto pNextBlock = CreateValidBlockForDispatcherTests(GetBlockSignerKeyPair());
@@ -721,6 +849,8 @@ namespace bitxorcore { namespace sync {
 		EXPECT_EQ(1u, context.counter(Rollback_Elements_Committed_Recent));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_All));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_Recent));
+		for (const auto* counterName : Throttle_Counter_Names)
+			EXPECT_EQ(0u, context.counter(counterName)) << counterName;
 	}
 
 	TEST(TEST_CLASS, FailedRollbackChangesIgnoredCounters) {
@@ -1193,6 +1323,11 @@ namespace bitxorcore { namespace sync {
 			EXPECT_EQ(0u, context.numNewBlockSinkCalls());
 			EXPECT_EQ(1u, context.numNewTransactionsSinkCalls());
 			EXPECT_EQ(0u, context.numTransactionStatuses());
+
+			// - the transaction hash was added to the recent hash cache
+			EXPECT_EQ(0u, context.counter("TX HASH HIT"));
+			EXPECT_EQ(1u, context.counter("TX HASH MISS"));
+			EXPECT_EQ(0u, context.counter("TX HASH PRUNE"));
 		});
 	}
 
@@ -53,7 +53,7 @@ namespace bitxorcore { namespace sync {
 					++counters.NumCommitStepCalls;
 				};
 
-				AddSupplementalDataResiliency(m_syncHandlers, m_dataDirectory, m_cache, m_score);
+				AddSupplementalDataResiliency(m_syncHandlers, m_dataDirectory, utils::FileSize(), m_cache, m_score);
 			}
 
 		public:
@@ -23,6 +23,7 @@
 #include "sync/src/NetworkPacketWritersService.h"
 #include "bitxorcore/api/ChainPackets.h"
 #include "bitxorcore/ionet/PacketPayloadFactory.h"
+#include "tests/test/core/TransactionInfoTestUtils.h"
 #include "tests/test/local/PacketWritersServiceTestUtils.h"
 #include "tests/test/local/ServiceTestUtils.h"
 #include "tests/TestHarness.h"
@@ -34,7 +35,8 @@ namespace bitxorcore { namespace sync {
 	namespace {
 		struct NetworkPacketWritersServiceTraits {
 			static constexpr auto Counter_Name = "WRITERS";
-			static constexpr auto Num_Expected_Services = 1u;
+			static constexpr auto Num_Expected_Services = 2u; // writers (1) + transaction inventory (1)
+			static constexpr auto Num_Expected_Counters = 8u; // writers (1) + transaction inventory (7)
 
 			static constexpr auto GetWriters = GetPacketWriters;
 			static constexpr auto CreateRegistrar = CreateNetworkPacketWritersServiceRegistrar;
@@ -110,6 +112,116 @@ namespace bitxorcore { namespace sync {
 
 	// endregion
 
+	// region transaction inventory gossip
+
+	namespace {
+		void EnableTransactionInventoryGossip(TestContext& context) {
+			auto& nodeConfig = const_cast<config::NodeConfiguration&>(context.testState().config().Node);
+			nodeConfig.EnableTransactionInventoryGossip = true;
+			nodeConfig.TransactionInventoryMaxSize = 100;
+		}
+	}
+
+	TEST(TEST_CLASS, TransactionInventoryHandlerIsNotRegisteredWhenGossipIsDisabled) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		context.boot();
+
+		// Assert:
+		EXPECT_FALSE(context.testState().state().packetHandlers().canProcess(ionet::PacketType::Push_Transaction_Inventory));
+		EXPECT_FALSE(context.testState().state().packetHandlers().canProcess(ionet::PacketType::Pull_Announced_Transactions));
+		EXPECT_TRUE(!!GetTransactionInventory(context.locator()));
+	}
+
+	TEST(TEST_CLASS, TransactionInventoryHandlerIsRegisteredWhenGossipIsEnabled) {
+		// Arrange:
+		TestContext context;
+		EnableTransactionInventoryGossip(context);
+
+		// Act:
+		context.boot();
+
+		// Assert:
+		EXPECT_TRUE(context.testState().state().packetHandlers().canProcess(ionet::PacketType::Push_Transaction_Inventory));
+		EXPECT_TRUE(context.testState().state().packetHandlers().canProcess(ionet::PacketType::Pull_Announced_Transactions));
+		EXPECT_TRUE(!!GetTransactionInventory(context.locator()));
+	}
+
+	TEST(TEST_CLASS, NewTransactionsAreAnnouncedWhenGossipIsEnabled) {
+		// Arrange: create a (tcp) server
+		test::RemoteAcceptServer server;
+		ionet::ByteBuffer packetBuffer;
+		server.start([&ioContext = server.ioContext(), &packetBuffer](const auto& pServerSocket) {
+			// read the packet and copy it into packetBuffer
+			test::AsyncReadIntoBuffer(ioContext, *pServerSocket, packetBuffer);
+		});
+
+		// - create and boot the service
+		TestContext context;
+		EnableTransactionInventoryGossip(context);
+		context.boot();
+		auto sink = context.testState().state().hooks().newTransactionsSink();
+
+		// - get the packet writers and attempt to connect to the server
+		test::ConnectToLocalHost(*GetPacketWriters(context.locator()), server.caPublicKey());
+
+		// Act: broadcast a transaction to the server
+		std::vector<model::TransactionInfo> transactionInfos;
+		transactionInfos.push_back(model::TransactionInfo(test::GenerateRandomTransaction(), test::GenerateRandomByteArray<Hash256>()));
+		sink(transactionInfos);
+
+		// - wait for the test to complete
+		server.join();
+
+		// Assert: the server received an announcement instead of the transaction
+		ASSERT_EQ(sizeof(ionet::PacketHeader) + sizeof(model::TransactionInventoryEntry), packetBuffer.size());
+		EXPECT_EQ(ionet::PacketType::Push_Transaction_Inventory, reinterpret_cast<const ionet::PacketHeader&>(packetBuffer[0]).Type);
+
+		const auto& entry = test::CoercePacketToEntity<model::TransactionInventoryEntry>(packetBuffer);
+		EXPECT_EQ(utils::ToShortHash(transactionInfos[0].EntityHash), entry.ShortHash);
+		EXPECT_EQ(transactionInfos[0].pEntity->Size, entry.Size);
+
+		// - the announced transaction is known and counted
+		EXPECT_TRUE(GetTransactionInventory(context.locator())->contains(entry.ShortHash));
+		EXPECT_EQ(1u, context.counter("TX INV ANN"));
+		EXPECT_EQ((transactionInfos[0].pEntity->Size - sizeof(model::TransactionInventoryEntry)), context.counter("TX INV SAVED"));
+	}
+
+	TEST(TEST_CLASS, AnnouncedTransactionsCanBePulledWhenGossipIsEnabled) {
+		// Arrange:
+		TestContext context;
+		EnableTransactionInventoryGossip(context);
+		context.boot();
+
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		{
+			auto modifier = context.testState().state().utCache().modifier();
+			for (const auto& transactionInfo : transactionInfos)
+				modifier.add(transactionInfo);
+		}
+
+		// - request the second transaction and an unknown one
+		auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(2 * sizeof(utils::ShortHash));
+		pPacket->Type = ionet::PacketType::Pull_Announced_Transactions;
+		auto* pShortHashes = reinterpret_cast<utils::ShortHash*>(pPacket->Data());
+		pShortHashes[0] = utils::ToShortHash(transactionInfos[1].EntityHash);
+		pShortHashes[1] = utils::ToShortHash(test::GenerateRandomByteArray<Hash256>());
+
+		// Act:
+		ionet::ServerPacketHandlerContext handlerContext;
+		EXPECT_TRUE(context.testState().state().packetHandlers().process(*pPacket, handlerContext));
+
+		// Assert: only the requested transaction is returned
+		const auto& buffers = handlerContext.response().buffers();
+		ASSERT_EQ(1u, buffers.size());
+		EXPECT_EQ(ionet::PacketType::Pull_Announced_Transactions, handlerContext.response().header().Type);
+		EXPECT_EQ(*transactionInfos[1].pEntity, reinterpret_cast<const model::Transaction&>(*buffers[0].pData));
+	}
+
+	// endregion
+
 	// region remoteChainHeightsRetriever
 
 	namespace {
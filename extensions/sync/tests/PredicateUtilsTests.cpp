@@ -113,7 +113,7 @@ namespace bitxorcore { namespace sync {
 		chain::UtUpdater::ThrottleContext CreateThrottleContext(
 				const cache::ReadOnlyBitxorCoreCache& readOnlyBitxorCoreCache,
 				const cache::UtCacheModifierProxy& utCacheModifier) {
-			return { chain::UtUpdater::TransactionSource::New, Height(), readOnlyBitxorCoreCache, utCacheModifier };
+			return { chain::UtUpdater::TransactionSource::New, Height(), 0, readOnlyBitxorCoreCache, utCacheModifier };
 		}
 
 		void AssertUtUpdaterThrottleResult(
@@ -21,8 +21,12 @@
 **/
 
 #include "sync/src/SyncService.h"
+#include "sync/src/TransactionInventory.h"
 #include "bitxorcore/extensions/ServerHooks.h"
+#include "bitxorcore/model/EntityHasher.h"
 #include "tests/test/core/TransactionInfoTestUtils.h"
+#include "tests/test/core/mocks/MockPacketIo.h"
+#include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/local/ServiceLocatorTestContext.h"
 #include "tests/test/local/ServiceTestUtils.h"
 #include "tests/test/net/mocks/MockPacketWriters.h"
@@ -39,18 +43,36 @@ namespace bitxorcore { namespace sync {
 
 		class TestContext : public test::ServiceLocatorTestContext<SyncServiceTraits> {
 		public:
-			TestContext() {
+			explicit TestContext(const std::shared_ptr<net::PacketWriters>& pWriters = std::make_shared<mocks::MockPacketWriters>())
+					: m_pInventory(std::make_shared<TransactionInventory>(100))
+					, m_pTransactionRanges(std::make_shared<std::vector<model::AnnotatedTransactionRange>>()) {
 				// register dependent service
-				locator().registerRootedService("writers", std::make_shared<mocks::MockPacketWriters>());
+				locator().registerRootedService("writers", pWriters);
+				locator().registerRootedService("writers.inventory", m_pInventory);
 
 				// set up hooks
 				auto& hooks = testState().state().hooks();
 				hooks.setCompletionAwareBlockRangeConsumerFactory([](auto) {
 					return [](auto&&, auto) { return disruptor::DisruptorElementId(); };
 				});
-				hooks.setTransactionRangeConsumerFactory([](auto) { return [](auto&&) {}; });
+				hooks.setTransactionRangeConsumerFactory([pTransactionRanges = m_pTransactionRanges](auto) {
+					return [pTransactionRanges](auto&& range) { pTransactionRanges->push_back(std::move(range)); };
+				});
 				hooks.setLocalFinalizedHeightHashPairSupplier([]() { return model::HeightHashPair{ Height(1), Hash256() }; });
 			}
+
+		public:
+			auto& inventory() {
+				return *m_pInventory;
+			}
+
+			const auto& transactionRanges() const {
+				return *m_pTransactionRanges;
+			}
+
+		private:
+			std::shared_ptr<TransactionInventory> m_pInventory;
+			std::shared_ptr<std::vector<model::AnnotatedTransactionRange>> m_pTransactionRanges;
 		};
 	}
 
@@ -66,5 +88,161 @@ namespace bitxorcore { namespace sync {
 		});
 	}
 
+	TEST(TEST_CLASS, TasksAreRegisteredWhenParallelSyncIsEnabled) {
+		// Arrange:
+		TestContext context;
+		const_cast<config::NodeConfiguration&>(context.testState().config().Node).MaxParallelSyncPeers = 3;
+
+		// Act + Assert:
+		test::AssertRegisteredTasks(std::move(context), {
+			"connect peers task for service Sync",
+			"synchronizer task",
+			"pull unconfirmed transactions task"
+		});
+	}
+
+	TEST(TEST_CLASS, TasksAreRegisteredWhenTransactionInventoryGossipIsEnabled) {
+		// Arrange:
+		TestContext context;
+		const_cast<config::NodeConfiguration&>(context.testState().config().Node).EnableTransactionInventoryGossip = true;
+
+		// Act + Assert:
+		test::AssertRegisteredTasks(std::move(context), {
+			"connect peers task for service Sync",
+			"synchronizer task",
+			"pull unconfirmed transactions task",
+			"pull announced transactions task"
+		});
+	}
+
+	// endregion
+
+	// region pull announced transactions task
+
+	namespace {
+		constexpr auto Pull_Announced_Task_Name = "pull announced transactions task";
+		constexpr auto Num_Gossip_Tasks = 4u;
+
+		model::TransactionInventoryRange CreateEntries(const std::vector<utils::ShortHash>& shortHashes) {
+			uint8_t* pData;
+			auto range = model::TransactionInventoryRange::PrepareFixed(shortHashes.size(), &pData);
+			auto* pEntry = reinterpret_cast<model::TransactionInventoryEntry*>(pData);
+			for (auto shortHash : shortHashes)
+				*pEntry++ = { shortHash, 100 };
+
+			return range;
+		}
+
+		void EnableTransactionInventoryGossip(TestContext& context) {
+			const_cast<config::NodeConfiguration&>(context.testState().config().Node).EnableTransactionInventoryGossip = true;
+			context.testState().pluginManager().addTransactionSupport(mocks::CreateMockTransactionPlugin());
+		}
+
+		utils::ShortHash CalculateShortHash(const model::Transaction& transaction, const TestContext& context) {
+			auto pPlugin = mocks::CreateMockTransactionPlugin();
+			const auto& generationHashSeed = context.testState().config().Blockchain.Network.GenerationHashSeed;
+			return utils::ToShortHash(model::CalculateHash(transaction, generationHashSeed, pPlugin->dataBuffer(transaction)));
+		}
+	}
+
+	TEST(TEST_CLASS, PullAnnouncedUtTaskDoesNotPickPeersWhenNothingWasAnnounced) {
+		// Arrange:
+		auto pWriters = std::make_shared<mocks::PickOneAwareMockPacketWriters>();
+		TestContext context(pWriters);
+		EnableTransactionInventoryGossip(context);
+
+		// Act:
+		test::RunTaskTest(context, Num_Gossip_Tasks, Pull_Announced_Task_Name, [&context, &pWriters](const auto& task) {
+			auto result = task.Callback().get();
+
+			// Assert:
+			EXPECT_EQ(thread::TaskResult::Continue, result);
+			EXPECT_EQ(0u, pWriters->numPickOneCalls());
+			EXPECT_EQ(0u, context.inventory().statistics().NumPullRequests);
+		});
+	}
+
+	TEST(TEST_CLASS, PullAnnouncedUtTaskReleasesShortHashesAnnouncedByDisconnectedPeers) {
+		// Arrange: only a different node is connected
+		auto pWriters = std::make_shared<mocks::PickOneAwareMockPacketWriters>();
+		pWriters->setNodeIdentity({ test::GenerateRandomByteArray<Key>(), "11.22.33.44" });
+		TestContext context(pWriters);
+		EnableTransactionInventoryGossip(context);
+
+		auto announcerKey = test::GenerateRandomByteArray<Key>();
+		context.inventory().receive(CreateEntries({ utils::ShortHash(1), utils::ShortHash(2) }), announcerKey);
+
+		// Act:
+		test::RunTaskTest(context, Num_Gossip_Tasks, Pull_Announced_Task_Name, [&context, &pWriters, &announcerKey](const auto& task) {
+			auto result = task.Callback().get();
+
+			// Assert: no transactions were pulled
+			EXPECT_EQ(thread::TaskResult::Continue, result);
+			EXPECT_EQ(0u, pWriters->numPickOneCalls());
+			EXPECT_TRUE(context.transactionRanges().empty());
+
+			// - all short hashes were released and can be requested again
+			EXPECT_EQ(2u, context.inventory().receive(CreateEntries({ utils::ShortHash(1), utils::ShortHash(2) }), announcerKey));
+		});
+	}
+
+	TEST(TEST_CLASS, PullAnnouncedUtTaskPullsAnnouncedTransactionsFromAnnouncingPeer) {
+		// Arrange:
+		auto pWriters = std::make_shared<mocks::PickOneAwareMockPacketWriters>();
+		auto announcerIdentity = model::NodeIdentity{ test::GenerateRandomByteArray<Key>(), "11.22.33.44" };
+		pWriters->setNodeIdentity(announcerIdentity);
+		TestContext context(pWriters);
+		EnableTransactionInventoryGossip(context);
+
+		// - the announcing peer only returns the first of two announced transactions
+		auto pTransaction = std::shared_ptr<model::Transaction>(mocks::CreateMockTransaction(12));
+		auto receivedShortHash = CalculateShortHash(*pTransaction, context);
+		auto missingShortHash = utils::ShortHash(receivedShortHash.unwrap() + 1);
+		context.inventory().receive(CreateEntries({ receivedShortHash, missingShortHash }), announcerIdentity.PublicKey);
+
+		auto pPacketIo = std::make_shared<mocks::MockPacketIo>();
+		pPacketIo->queueWrite(ionet::SocketOperationCode::Success);
+		pPacketIo->queueRead(ionet::SocketOperationCode::Success, [pTransaction](const auto*) {
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(pTransaction->Size);
+			pPacket->Type = ionet::PacketType::Pull_Announced_Transactions;
+			std::memcpy(pPacket->Data(), pTransaction.get(), pTransaction->Size);
+			return pPacket;
+		});
+		pWriters->setPacketIo(pPacketIo);
+
+		// Act:
+		test::RunTaskTest(context, Num_Gossip_Tasks, Pull_Announced_Task_Name, [&](const auto& task) {
+			auto result = task.Callback().get();
+
+			// Assert: announced short hashes were requested from the announcing peer
+			EXPECT_EQ(thread::TaskResult::Continue, result);
+			EXPECT_EQ(1u, pWriters->numPickOneCalls());
+			ASSERT_EQ(1u, pPacketIo->numWrites());
+
+			const auto& requestPacket = pPacketIo->writtenPacketAt<ionet::Packet>(0);
+			EXPECT_EQ(ionet::PacketType::Pull_Announced_Transactions, requestPacket.Type);
+			ASSERT_EQ(sizeof(ionet::PacketHeader) + 2 * sizeof(utils::ShortHash), requestPacket.Size);
+			const auto* pRequestShortHashes = reinterpret_cast<const utils::ShortHash*>(requestPacket.Data());
+			EXPECT_EQ(receivedShortHash, pRequestShortHashes[0]);
+			EXPECT_EQ(missingShortHash, pRequestShortHashes[1]);
+
+			// - received transaction was forwarded
+			ASSERT_EQ(1u, context.transactionRanges().size());
+			const auto& range = context.transactionRanges()[0];
+			EXPECT_EQ(announcerIdentity.PublicKey, range.SourceIdentity.PublicKey);
+			ASSERT_EQ(1u, range.Range.size());
+			EXPECT_EQ(*pTransaction, *range.Range.cbegin());
+
+			// - only the missing short hash was released
+			auto& inventory = context.inventory();
+			EXPECT_EQ(1u, inventory.receive(CreateEntries({ receivedShortHash, missingShortHash }), announcerIdentity.PublicKey));
+
+			// - pull statistics were updated with actual packet sizes
+			EXPECT_EQ(1u, inventory.statistics().NumPullRequests);
+			EXPECT_EQ(2 * sizeof(ionet::PacketHeader) + 2 * sizeof(utils::ShortHash) + pTransaction->Size,
+					inventory.statistics().NumPullBytes);
+		});
+	}
+
 	// endregion
 }}
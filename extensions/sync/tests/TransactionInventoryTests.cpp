@@ -0,0 +1,638 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "sync/src/TransactionInventory.h"
+#include "bitxorcore/ionet/PacketPayloadBuilder.h"
+#include "tests/test/core/TransactionInfoTestUtils.h"
+#include "tests/TestHarness.h"
+#include <queue>
+#include <set>
+#include <unordered_map>
+
+namespace bitxorcore { namespace sync {
+
+#define TEST_CLASS TransactionInventoryTests
+
+	namespace {
+		constexpr auto Entry_Size = sizeof(model::TransactionInventoryEntry);
+
+		void AssertStatistics(const TransactionInventory& inventory, const std::vector<uint64_t>& expectedValues) {
+			const auto& statistics = inventory.statistics();
+			EXPECT_EQ(expectedValues[0], statistics.NumAnnounced.load());
+			EXPECT_EQ(expectedValues[1], statistics.NumWithheldBytes.load());
+			EXPECT_EQ(expectedValues[2], statistics.NumReceived.load());
+			EXPECT_EQ(expectedValues[3], statistics.NumDuplicates.load());
+			EXPECT_EQ(expectedValues[4], statistics.NumDuplicateBytes.load());
+			EXPECT_EQ(expectedValues[5], statistics.NumPullRequests.load());
+			EXPECT_EQ(expectedValues[6], statistics.NumPullBytes.load());
+		}
+
+		model::TransactionInventoryRange ExtractEntries(const ionet::PacketPayload& payload) {
+			if (payload.buffers().empty())
+				return model::TransactionInventoryRange();
+
+			const auto& buffer = payload.buffers()[0];
+			return model::TransactionInventoryRange::CopyFixed(buffer.pData, buffer.Size / Entry_Size);
+		}
+
+		model::TransactionInventoryRange CreateEntries(const std::vector<std::pair<utils::ShortHash, uint32_t>>& shortHashSizePairs) {
+			uint8_t* pData;
+			auto range = model::TransactionInventoryRange::PrepareFixed(shortHashSizePairs.size(), &pData);
+			auto* pEntry = reinterpret_cast<model::TransactionInventoryEntry*>(pData);
+			for (const auto& pair : shortHashSizePairs)
+				*pEntry++ = { pair.first, pair.second };
+
+			return range;
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyInventory) {
+		// Act:
+		TransactionInventory inventory(10);
+
+		// Assert:
+		EXPECT_EQ(0u, inventory.numKnownHashes());
+		EXPECT_TRUE(inventory.takePendingRequests().empty());
+		AssertStatistics(inventory, { 0, 0, 0, 0, 0, 0, 0 });
+	}
+
+	// endregion
+
+	// region addKnown
+
+	TEST(TEST_CLASS, AddKnownMarksAllTransactionsAsKnown) {
+		// Arrange:
+		TransactionInventory inventory(10);
+		auto transactionInfos = test::CreateTransactionInfos(3);
+
+		// Act:
+		inventory.addKnown(transactionInfos);
+
+		// Assert:
+		EXPECT_EQ(3u, inventory.numKnownHashes());
+		for (const auto& transactionInfo : transactionInfos)
+			EXPECT_TRUE(inventory.contains(utils::ToShortHash(transactionInfo.EntityHash)));
+
+		EXPECT_FALSE(inventory.contains(utils::ShortHash(123)));
+		AssertStatistics(inventory, { 0, 0, 0, 0, 0, 0, 0 });
+	}
+
+	TEST(TEST_CLASS, AddKnownIgnoresKnownTransactions) {
+		// Arrange:
+		TransactionInventory inventory(10);
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		inventory.addKnown(transactionInfos);
+
+		// Act:
+		inventory.addKnown(transactionInfos);
+
+		// Assert:
+		EXPECT_EQ(3u, inventory.numKnownHashes());
+	}
+
+	TEST(TEST_CLASS, AddKnownForgetsOldestTransactionsWhenFull) {
+		// Arrange:
+		TransactionInventory inventory(3);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+
+		// Act:
+		inventory.addKnown(transactionInfos);
+
+		// Assert:
+		EXPECT_EQ(3u, inventory.numKnownHashes());
+		for (auto i = 0u; i < transactionInfos.size(); ++i)
+			EXPECT_EQ(i >= 2, inventory.contains(utils::ToShortHash(transactionInfos[i].EntityHash))) << i;
+	}
+
+	// endregion
+
+	// region announce
+
+	TEST(TEST_CLASS, AnnounceCreatesInventoryPayloadAndMarksTransactionsAsKnown) {
+		// Arrange:
+		TransactionInventory inventory(10);
+		auto transactionInfos = test::CreateTransactionInfos(3);
+
+		// Act:
+		auto payload = inventory.announce(transactionInfos, 4);
+
+		// Assert:
+		EXPECT_EQ(ionet::PacketType::Push_Transaction_Inventory, payload.header().Type);
+		auto entries = ExtractEntries(payload);
+		ASSERT_EQ(3u, entries.size());
+
+		auto i = 0u;
+		for (const auto& entry : entries) {
+			EXPECT_EQ(utils::ToShortHash(transactionInfos[i].EntityHash), entry.ShortHash) << i;
+			EXPECT_EQ(transactionInfos[i].pEntity->Size, entry.Size) << i;
+			EXPECT_TRUE(inventory.contains(entry.ShortHash)) << i;
+			++i;
+		}
+	}
+
+	TEST(TEST_CLASS, AnnounceUpdatesStatistics) {
+		// Arrange:
+		TransactionInventory inventory(10);
+		std::vector<model::TransactionInfo> transactionInfos;
+		transactionInfos.push_back(test::CreateRandomTransactionInfoWithSize(200));
+		transactionInfos.push_back(test::CreateRandomTransactionInfoWithSize(300));
+
+		// Act:
+		inventory.announce(transactionInfos, 4);
+
+		transactionInfos.clear();
+		transactionInfos.push_back(test::CreateRandomTransactionInfoWithSize(150));
+		inventory.announce(transactionInfos, 2);
+
+		// Assert: withheld bytes are the differences between push and inventory packet sizes across all peers
+		auto expectedWithheldBytes = (500 - 2 * Entry_Size) * 4 + (150 - Entry_Size) * 2;
+		AssertStatistics(inventory, { 3, expectedWithheldBytes, 0, 0, 0, 0, 0 });
+		EXPECT_TRUE(inventory.takePendingRequests().empty());
+	}
+
+	// endregion
+
+	// region receive
+
+	namespace {
+		void AssertPendingRequest(
+				const AnnouncedShortHashes& request,
+				const Key& expectedAnnouncerKey,
+				const std::vector<utils::ShortHash>& expectedShortHashes) {
+			EXPECT_EQ(expectedAnnouncerKey, request.AnnouncerKey);
+			EXPECT_EQ(expectedShortHashes, request.ShortHashes);
+		}
+	}
+
+	TEST(TEST_CLASS, ReceiveReturnsNumberOfUnknownTransactionsAndMarksThemAsRequested) {
+		// Arrange:
+		TransactionInventory inventory(10);
+		auto announcerKey = test::GenerateRandomByteArray<Key>();
+
+		// Act:
+		auto numUnknown = inventory.receive(CreateEntries({ { utils::ShortHash(1), 100 }, { utils::ShortHash(2), 200 } }), announcerKey);
+
+		// Assert: requested transactions are not known until they are received
+		EXPECT_EQ(2u, numUnknown);
+		EXPECT_EQ(0u, inventory.numKnownHashes());
+		EXPECT_FALSE(inventory.contains(utils::ShortHash(1)));
+		EXPECT_FALSE(inventory.contains(utils::ShortHash(2)));
+		AssertStatistics(inventory, { 0, 0, 2, 0, 0, 0, 0 });
+	}
+
+	TEST(TEST_CLASS, ReceiveCountsAnnouncementsOfRequestedTransactionsAsDuplicatesWithoutBytes) {
+		// Arrange:
+		TransactionInventory inventory(10);
+		inventory.receive(CreateEntries({ { utils::ShortHash(1), 100 }, { utils::ShortHash(2), 200 } }), test::GenerateRandomByteArray<Key>());
+
+		// Act:
+		auto numUnknown = inventory.receive(CreateEntries({
+			{ utils::ShortHash(2), 200 }, { utils::ShortHash(3), 300 }, { utils::ShortHash(1), 100 }
+		}), test::GenerateRandomByteArray<Key>());
+
+		// Assert: announced sizes are not trusted
+		EXPECT_EQ(1u, numUnknown);
+		AssertStatistics(inventory, { 0, 0, 5, 2, 0, 0, 0 });
+	}
+
+	TEST(TEST_CLASS, ReceiveCountsAnnouncementsOfKnownTransactionsAsDuplicatesWithLocalSizes) {
+		// Arrange:
+		TransactionInventory inventory(10);
+		std::vector<model::TransactionInfo> transactionInfos;
+		transactionInfos.push_back(test::CreateRandomTransactionInfoWithSize(200));
+		transactionInfos.push_back(test::CreateRandomTransactionInfoWithSize(300));
+		inventory.addKnown(transactionInfos);
+
+		// Act: announce known transactions with bogus sizes
+		auto numUnknown = inventory.receive(CreateEntries({
+			{ utils::ToShortHash(transactionInfos[0].EntityHash), 1000 },
+			{ utils::ShortHash(3), 300 },
+			{ utils::ToShortHash(transactionInfos[1].EntityHash), 1 }
+		}), test::GenerateRandomByteArray<Key>());
+
+		// Assert: duplicate bytes are the local transaction bytes that were replaced by announcement entries
+		EXPECT_EQ(1u, numUnknown);
+		AssertStatistics(inventory, { 0, 0, 3, 2, 500 - 2 * Entry_Size, 0, 0 });
+	}
+
+	TEST(TEST_CLASS, ReceiveTreatsAllTransactionsAsUnknownWhenNothingCanBeRemembered) {
+		// Arrange:
+		TransactionInventory inventory(0);
+		auto announcerKey = test::GenerateRandomByteArray<Key>();
+		inventory.receive(CreateEntries({ { utils::ShortHash(1), 100 } }), announcerKey);
+
+		// Act:
+		auto numUnknown = inventory.receive(CreateEntries({ { utils::ShortHash(1), 100 } }), announcerKey);
+
+		// Assert:
+		EXPECT_EQ(1u, numUnknown);
+		EXPECT_EQ(0u, inventory.numKnownHashes());
+		AssertStatistics(inventory, { 0, 0, 2, 0, 0, 0, 0 });
+	}
+
+	TEST(TEST_CLASS, ReceivedTransactionsBecomeKnownWhenAdded) {
+		// Arrange:
+		TransactionInventory inventory(10);
+		auto transactionInfos = test::CreateTransactionInfos(1);
+		auto shortHash = utils::ToShortHash(transactionInfos[0].EntityHash);
+		inventory.receive(CreateEntries({ { shortHash, 100 } }), test::GenerateRandomByteArray<Key>());
+
+		// Act:
+		inventory.addKnown(transactionInfos);
+
+		// Assert:
+		EXPECT_EQ(1u, inventory.numKnownHashes());
+		EXPECT_TRUE(inventory.contains(shortHash));
+	}
+
+	TEST(TEST_CLASS, ReceiveForgetsOldestTransactionsWhenFull) {
+		// Arrange:
+		TransactionInventory inventory(3);
+		auto transactionInfos = test::CreateTransactionInfos(2);
+		inventory.addKnown(transactionInfos);
+
+		// Act:
+		inventory.receive(CreateEntries({ { utils::ShortHash(1), 100 }, { utils::ShortHash(2), 100 } }), Key());
+
+		// Assert: the first known transaction was forgotten
+		EXPECT_EQ(1u, inventory.numKnownHashes());
+		EXPECT_FALSE(inventory.contains(utils::ToShortHash(transactionInfos[0].EntityHash)));
+		EXPECT_TRUE(inventory.contains(utils::ToShortHash(transactionInfos[1].EntityHash)));
+	}
+
+	// endregion
+
+	// region takePendingRequests
+
+	TEST(TEST_CLASS, TakePendingRequestsGroupsUnknownShortHashesByAnnouncer) {
+		// Arrange:
+		TransactionInventory inventory(10);
+		auto announcerKey1 = test::GenerateRandomByteArray<Key>();
+		auto announcerKey2 = test::GenerateRandomByteArray<Key>();
+		inventory.receive(CreateEntries({ { utils::ShortHash(1), 100 }, { utils::ShortHash(2), 100 } }), announcerKey1);
+		inventory.receive(CreateEntries({ { utils::ShortHash(2), 100 }, { utils::ShortHash(3), 100 } }), announcerKey2);
+		inventory.receive(CreateEntries({ { utils::ShortHash(4), 100 } }), announcerKey1);
+
+		// Act:
+		auto requests = inventory.takePendingRequests();
+
+		// Assert: each short hash is only requested from the first announcer
+		ASSERT_EQ(2u, requests.size());
+		if (announcerKey1 != requests[0].AnnouncerKey)
+			std::swap(requests[0], requests[1]);
+
+		AssertPendingRequest(requests[0], announcerKey1, { utils::ShortHash(1), utils::ShortHash(2), utils::ShortHash(4) });
+		AssertPendingRequest(requests[1], announcerKey2, { utils::ShortHash(3) });
+		AssertStatistics(inventory, { 0, 0, 5, 1, 0, 2, 0 });
+	}
+
+	TEST(TEST_CLASS, TakePendingRequestsReturnsRequestsOnlyOnce) {
+		// Arrange:
+		TransactionInventory inventory(10);
+		inventory.receive(CreateEntries({ { utils::ShortHash(1), 100 } }), test::GenerateRandomByteArray<Key>());
+
+		// Act:
+		auto requests1 = inventory.takePendingRequests();
+		auto requests2 = inventory.takePendingRequests();
+
+		// Assert:
+		EXPECT_EQ(1u, requests1.size());
+		EXPECT_TRUE(requests2.empty());
+		AssertStatistics(inventory, { 0, 0, 1, 0, 0, 1, 0 });
+	}
+
+	TEST(TEST_CLASS, TakePendingRequestsReturnsNothingWhenOnlyKnownTransactionsAreAnnounced) {
+		// Arrange:
+		TransactionInventory inventory(10);
+		auto transactionInfos = test::CreateTransactionInfos(1);
+		inventory.addKnown(transactionInfos);
+		inventory.receive(CreateEntries({ { utils::ToShortHash(transactionInfos[0].EntityHash), 100 } }), Key());
+
+		// Act:
+		auto requests = inventory.takePendingRequests();
+
+		// Assert:
+		EXPECT_TRUE(requests.empty());
+		EXPECT_EQ(1u, inventory.statistics().NumDuplicates);
+	}
+
+	// endregion
+
+	// region release
+
+	TEST(TEST_CLASS, ReleaseAllowsRequestedShortHashesToBeRequestedAgain) {
+		// Arrange:
+		TransactionInventory inventory(10);
+		auto announcerKey = test::GenerateRandomByteArray<Key>();
+		inventory.receive(CreateEntries({ { utils::ShortHash(1), 100 }, { utils::ShortHash(2), 100 } }), announcerKey);
+		inventory.takePendingRequests();
+
+		// Act:
+		inventory.release({ utils::ShortHash(2), utils::ShortHash(3) });
+		auto numUnknown = inventory.receive(CreateEntries({ { utils::ShortHash(1), 100 }, { utils::ShortHash(2), 100 } }), announcerKey);
+
+		// Assert:
+		EXPECT_EQ(1u, numUnknown);
+
+		auto requests = inventory.takePendingRequests();
+		ASSERT_EQ(1u, requests.size());
+		AssertPendingRequest(requests[0], announcerKey, { utils::ShortHash(2) });
+	}
+
+	TEST(TEST_CLASS, ReleaseDoesNotForgetKnownTransactions) {
+		// Arrange:
+		TransactionInventory inventory(10);
+		auto transactionInfos = test::CreateTransactionInfos(1);
+		auto shortHash = utils::ToShortHash(transactionInfos[0].EntityHash);
+		inventory.addKnown(transactionInfos);
+
+		// Act:
+		inventory.release({ shortHash });
+
+		// Assert:
+		EXPECT_EQ(1u, inventory.numKnownHashes());
+		EXPECT_TRUE(inventory.contains(shortHash));
+	}
+
+	TEST(TEST_CLASS, ReleasedShortHashesDoNotCauseKnownTransactionsToBeForgotten) {
+		// Arrange:
+		TransactionInventory inventory(3);
+		inventory.receive(CreateEntries({ { utils::ShortHash(1), 100 }, { utils::ShortHash(2), 100 } }), Key());
+		inventory.release({ utils::ShortHash(1), utils::ShortHash(2) });
+
+		// Act:
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		inventory.addKnown(transactionInfos);
+
+		// Assert:
+		EXPECT_EQ(3u, inventory.numKnownHashes());
+		for (const auto& transactionInfo : transactionInfos)
+			EXPECT_TRUE(inventory.contains(utils::ToShortHash(transactionInfo.EntityHash)));
+	}
+
+	// endregion
+
+	// region recordPull / recordServedPull
+
+	TEST(TEST_CLASS, RecordPullAccumulatesPullBytes) {
+		// Arrange:
+		TransactionInventory inventory(10);
+
+		// Act:
+		inventory.recordPull(123);
+		inventory.recordPull(200);
+
+		// Assert:
+		AssertStatistics(inventory, { 0, 0, 0, 0, 0, 0, 323 });
+	}
+
+	TEST(TEST_CLASS, RecordServedPullReducesWithheldBytes) {
+		// Arrange:
+		TransactionInventory inventory(10);
+		std::vector<model::TransactionInfo> transactionInfos;
+		transactionInfos.push_back(test::CreateRandomTransactionInfoWithSize(500));
+		inventory.announce(transactionInfos, 4);
+
+		// Act:
+		inventory.recordServedPull(300);
+
+		// Assert:
+		AssertStatistics(inventory, { 1, (500 - Entry_Size) * 4 - 300, 0, 0, 0, 0, 0 });
+	}
+
+	TEST(TEST_CLASS, RecordServedPullDoesNotReduceWithheldBytesBelowZero) {
+		// Arrange:
+		TransactionInventory inventory(10);
+		std::vector<model::TransactionInfo> transactionInfos;
+		transactionInfos.push_back(test::CreateRandomTransactionInfoWithSize(500));
+		inventory.announce(transactionInfos, 1);
+
+		// Act:
+		inventory.recordServedPull(10'000);
+
+		// Assert:
+		AssertStatistics(inventory, { 1, 0, 0, 0, 0, 0, 0 });
+	}
+
+	// endregion
+
+	// region simulation
+
+	namespace {
+		constexpr auto Num_Simulated_Nodes = 8u;
+		constexpr auto Num_Simulated_Transactions = 20u;
+
+		struct SimulatedNode {
+		public:
+			SimulatedNode() : Inventory(1000)
+			{}
+
+		public:
+			TransactionInventory Inventory;
+			std::vector<size_t> Peers;
+			std::set<size_t> TransactionIds;
+		};
+
+		struct SimulationResult {
+			uint64_t NumTransferredBytes = 0;
+			uint64_t NumDuplicates = 0;
+			uint64_t NumDuplicateBytes = 0;
+		};
+
+		// simulates a local network in which every node is connected to its two closest neighbors on each side
+		// and each transaction is fully propagated before the next one is submitted
+		class NetworkSimulator {
+		private:
+			using AnnouncementQueue = std::queue<std::tuple<size_t, size_t, model::TransactionInventoryRange>>;
+
+		public:
+			explicit NetworkSimulator(const std::vector<model::TransactionInfo>& transactionInfos)
+					: m_transactionInfos(transactionInfos)
+					, m_nodes(Num_Simulated_Nodes) {
+				for (auto i = 0u; i < Num_Simulated_Nodes; ++i) {
+					for (auto offset : { 1u, 2u, Num_Simulated_Nodes - 2, Num_Simulated_Nodes - 1 })
+						m_nodes[i].Peers.push_back((i + offset) % Num_Simulated_Nodes);
+
+					m_nodeKeys.push_back(test::GenerateRandomByteArray<Key>());
+					m_nodeIds.emplace(m_nodeKeys.back(), i);
+				}
+
+				for (auto i = 0u; i < m_transactionInfos.size(); ++i)
+					m_transactionIds.emplace(utils::ToShortHash(m_transactionInfos[i].EntityHash), i);
+			}
+
+		public:
+			const std::vector<SimulatedNode>& nodes() const {
+				return m_nodes;
+			}
+
+		public:
+			SimulationResult pushAll() {
+				SimulationResult result;
+				for (auto i = 0u; i < m_transactionInfos.size(); ++i) {
+					// every node pushes every new transaction to all of its peers
+					std::queue<size_t> receivingNodeIds;
+					receivingNodeIds.push(i % Num_Simulated_Nodes);
+					auto transactionSize = size(i);
+					while (!receivingNodeIds.empty()) {
+						auto& node = m_nodes[receivingNodeIds.front()];
+						receivingNodeIds.pop();
+
+						if (!node.TransactionIds.insert(i).second) {
+							++result.NumDuplicates;
+							result.NumDuplicateBytes += transactionSize;
+							continue;
+						}
+
+						for (auto peerId : node.Peers) {
+							result.NumTransferredBytes += sizeof(ionet::PacketHeader) + transactionSize;
+							receivingNodeIds.push(peerId);
+						}
+					}
+				}
+
+				return result;
+			}
+
+			SimulationResult gossipAll() {
+				SimulationResult result;
+				for (auto i = 0u; i < m_transactionInfos.size(); ++i) {
+					// every node announces every new transaction to all of its peers, which pull unknown transactions
+					AnnouncementQueue announcements;
+					accept(i % Num_Simulated_Nodes, i, announcements, result);
+					while (!announcements.empty()) {
+						auto nodeId = std::get<0>(announcements.front());
+						auto sourceNodeId = std::get<1>(announcements.front());
+						auto entries = std::move(std::get<2>(announcements.front()));
+						announcements.pop();
+
+						auto& node = m_nodes[nodeId];
+						node.Inventory.receive(entries, m_nodeKeys[sourceNodeId]);
+						for (const auto& request : node.Inventory.takePendingRequests()) {
+							// pull all requested transactions from the announcing node
+							auto& announcingNode = m_nodes[m_nodeIds.find(request.AnnouncerKey)->second];
+							auto numPullBytes = 2 * sizeof(ionet::PacketHeader) + request.ShortHashes.size() * sizeof(utils::ShortHash);
+							std::vector<size_t> transactionIds;
+							for (auto shortHash : request.ShortHashes) {
+								auto transactionId = m_transactionIds.find(shortHash)->second;
+								if (announcingNode.TransactionIds.cend() == announcingNode.TransactionIds.find(transactionId))
+									continue;
+
+								numPullBytes += size(transactionId);
+								transactionIds.push_back(transactionId);
+							}
+
+							node.Inventory.recordPull(numPullBytes);
+							announcingNode.Inventory.recordServedPull(numPullBytes);
+							result.NumTransferredBytes += numPullBytes;
+							for (auto transactionId : transactionIds)
+								accept(nodeId, transactionId, announcements, result);
+						}
+					}
+				}
+
+				for (const auto& node : m_nodes) {
+					result.NumDuplicates += node.Inventory.statistics().NumDuplicates;
+					result.NumDuplicateBytes += node.Inventory.statistics().NumDuplicateBytes;
+				}
+
+				return result;
+			}
+
+		private:
+			uint32_t size(size_t transactionId) const {
+				return m_transactionInfos[transactionId].pEntity->Size;
+			}
+
+			void accept(size_t nodeId, size_t transactionId, AnnouncementQueue& announcements, SimulationResult& result) {
+				auto& node = m_nodes[nodeId];
+				node.TransactionIds.insert(transactionId);
+
+				std::vector<model::TransactionInfo> transactionInfos;
+				transactionInfos.push_back(m_transactionInfos[transactionId].copy());
+				auto payload = node.Inventory.announce(transactionInfos, node.Peers.size());
+				for (auto peerId : node.Peers) {
+					result.NumTransferredBytes += payload.header().Size;
+					announcements.emplace(peerId, nodeId, ExtractEntries(payload));
+				}
+			}
+
+		private:
+			const std::vector<model::TransactionInfo>& m_transactionInfos;
+			std::vector<SimulatedNode> m_nodes;
+			std::vector<Key> m_nodeKeys;
+			std::unordered_map<Key, size_t, utils::ArrayHasher<Key>> m_nodeIds;
+			std::unordered_map<utils::ShortHash, size_t, utils::ShortHashHasher> m_transactionIds;
+		};
+
+		void AssertAllNodesHaveAllTransactions(const std::vector<SimulatedNode>& nodes) {
+			for (auto i = 0u; i < nodes.size(); ++i)
+				EXPECT_EQ(Num_Simulated_Transactions, nodes[i].TransactionIds.size()) << "node " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, SimulatedGossipPropagatesAllTransactionsWithLessBandwidthThanPushing) {
+		// Arrange:
+		std::vector<model::TransactionInfo> transactionInfos;
+		for (auto i = 0u; i < Num_Simulated_Transactions; ++i)
+			transactionInfos.push_back(test::CreateRandomTransactionInfoWithSize(200 + 10 * i));
+
+		NetworkSimulator pushSimulator(transactionInfos);
+		NetworkSimulator gossipSimulator(transactionInfos);
+
+		// Act:
+		auto pushResult = pushSimulator.pushAll();
+		auto gossipResult = gossipSimulator.gossipAll();
+
+		// Assert: all transactions reach all nodes in both modes
+		AssertAllNodesHaveAllTransactions(pushSimulator.nodes());
+		AssertAllNodesHaveAllTransactions(gossipSimulator.nodes());
+
+		// - every duplicate push is replaced by a duplicate announcement, which saves all but the entry bytes
+		EXPECT_LT(0u, pushResult.NumDuplicateBytes);
+		EXPECT_EQ(pushResult.NumDuplicates, gossipResult.NumDuplicates);
+		EXPECT_EQ(pushResult.NumDuplicateBytes - pushResult.NumDuplicates * Entry_Size, gossipResult.NumDuplicateBytes);
+
+		// - gossip transfers fewer bytes
+		BITXORCORE_LOG(debug)
+				<< "push: " << pushResult.NumTransferredBytes << " bytes, gossip: " << gossipResult.NumTransferredBytes << " bytes";
+		EXPECT_GT(pushResult.NumTransferredBytes, gossipResult.NumTransferredBytes);
+
+		// - each transaction is pulled exactly once by every node other than its origin
+		uint64_t numPullRequests = 0;
+		for (const auto& node : gossipSimulator.nodes())
+			numPullRequests += node.Inventory.statistics().NumPullRequests;
+
+		EXPECT_EQ(Num_Simulated_Transactions * (Num_Simulated_Nodes - 1), numPullRequests);
+
+		// - pull bytes are accounted for
+		uint64_t numPullBytes = 0;
+		for (const auto& node : gossipSimulator.nodes())
+			numPullBytes += node.Inventory.statistics().NumPullBytes;
+
+		EXPECT_LT(0u, numPullBytes);
+	}
+
+	// endregion
+}}
@@ -71,11 +71,12 @@ namespace bitxorcore { namespace sync {
 
 		class TestContext {
 		public:
-			TestContext(cache::BitxorCoreCache&& bitxorcoreCache, Height height)
+			TestContext(cache::BitxorCoreCache&& bitxorcoreCache, Height height, uint64_t cacheGeneration = 0)
 					: m_bitxorcoreCache(std::move(bitxorcoreCache))
 					, m_bitxorcoreCacheView(m_bitxorcoreCache.createView())
 					, m_readOnlyBitxorCoreCache(m_bitxorcoreCacheView.toReadOnly())
 					, m_height(height)
+					, m_cacheGeneration(cacheGeneration)
 					, m_transactionsCache(cache::MemoryCacheOptions(utils::FileSize(), utils::FileSize::FromMegabytes(1)))
 					, m_transactionsCacheModifier(m_transactionsCache.modifier())
 			{}
@@ -86,7 +87,11 @@ namespace bitxorcore { namespace sync {
 			}
 
 			chain::UtUpdater::ThrottleContext throttleContext(TransactionSource source = TransactionSource::New) const {
-				return { source, m_height, m_readOnlyBitxorCoreCache, m_transactionsCacheModifier };
+				return throttleContext(source, m_height);
+			}
+
+			chain::UtUpdater::ThrottleContext throttleContext(TransactionSource source, Height height) const {
+				return { source, height, m_cacheGeneration, m_readOnlyBitxorCoreCache, m_transactionsCacheModifier };
 			}
 
 			void addTransactions(const std::vector<Key>& publicKeys) {
@@ -99,6 +104,7 @@ namespace bitxorcore { namespace sync {
 			cache::BitxorCoreCacheView m_bitxorcoreCacheView;
 			cache::ReadOnlyBitxorCoreCache m_readOnlyBitxorCoreCache;
 			Height m_height;
+			uint64_t m_cacheGeneration;
 			cache::MemoryUtCacheProxy m_transactionsCache;
 			cache::UtCacheModifierProxy m_transactionsCacheModifier;
 		};
@@ -443,4 +449,195 @@ namespace bitxorcore { namespace sync {
 	}
 
 	// endregion
+
+	// region memoization + statistics
+
+	namespace {
+		struct StatisticsValues {
+			uint64_t NumAccepted;
+			uint64_t NumRejectedCacheFull;
+			uint64_t NumThrottled;
+			uint64_t NumBypassed;
+			uint64_t NumImportanceCacheHits;
+			uint64_t NumImportanceCacheMisses;
+		};
+
+		void AssertStatistics(const StatisticsValues& expected, const SpamThrottleStatistics& statistics) {
+			EXPECT_EQ(expected.NumAccepted, statistics.NumAccepted);
+			EXPECT_EQ(expected.NumRejectedCacheFull, statistics.NumRejectedCacheFull);
+			EXPECT_EQ(expected.NumThrottled, statistics.NumThrottled);
+			EXPECT_EQ(expected.NumBypassed, statistics.NumBypassed);
+			EXPECT_EQ(expected.NumImportanceCacheHits, statistics.NumImportanceCacheHits);
+			EXPECT_EQ(expected.NumImportanceCacheMisses, statistics.NumImportanceCacheMisses);
+		}
+
+		chain::UtUpdater::Throttle CreateStatisticsThrottle(bool isBonded, SpamThrottleStatistics& statistics) {
+			return CreateTransactionSpamThrottle(ThrottleTestSettings().ThrottleConfig, [isBonded](const auto&) {
+				return isBonded;
+			}, statistics);
+		}
+
+		template<typename TAction>
+		void RunStatisticsTest(Importance signerImportance, uint32_t cacheSeedCount, TAction action) {
+			// Arrange: prepare account state cache with importance grouping 100
+			auto bitxorcoreCache = CreateBitxorCoreCacheWithImportanceGrouping(100);
+			std::vector<Key> publicKeys;
+			std::vector<Key> signerPublicKeys;
+			{
+				auto delta = bitxorcoreCache.createDelta();
+				auto& accountStateCacheDelta = delta.sub<cache::AccountStateCache>();
+				publicKeys = SeedAccountStateCache(accountStateCacheDelta, cacheSeedCount, Importance(1'000));
+				signerPublicKeys = SeedAccountStateCache(accountStateCacheDelta, 2, signerImportance);
+				bitxorcoreCache.commit(Height(1));
+			}
+
+			TestContext context(std::move(bitxorcoreCache), Height(1));
+			context.addTransactions(publicKeys);
+
+			// Act + Assert:
+			action(context, signerPublicKeys);
+		}
+	}
+
+	TEST(TEST_CLASS, SignerImportanceIsMemoizedWithinImportanceHeight) {
+		// Arrange:
+		RunStatisticsTest(Importance(1'000), 120, [](const auto& context, const auto& signers) {
+			SpamThrottleStatistics statistics;
+			auto filter = CreateStatisticsThrottle(false, statistics);
+			auto throttleContext = context.throttleContext();
+
+			// Act: check three transactions from first signer and one from second signer
+			std::vector<bool> results;
+			for (auto i = 0u; i < 3; ++i)
+				results.push_back(filter(CreateTransactionInfo(signers[0]), throttleContext));
+
+			results.push_back(filter(CreateTransactionInfo(signers[1]), throttleContext));
+
+			// Assert: importance of each signer was only looked up once
+			EXPECT_EQ(std::vector<bool>(4, false), results);
+			AssertStatistics({ 4, 0, 0, 0, 2, 2 }, statistics);
+		});
+	}
+
+	TEST(TEST_CLASS, SignerImportanceIsMemoizedAcrossThrottleCopies) {
+		// Arrange:
+		RunStatisticsTest(Importance(1'000), 120, [](const auto& context, const auto& signers) {
+			SpamThrottleStatistics statistics;
+			auto filter = CreateStatisticsThrottle(false, statistics);
+			auto filterCopy = filter;
+			auto throttleContext = context.throttleContext();
+
+			// Act:
+			filter(CreateTransactionInfo(signers[0]), throttleContext);
+			filterCopy(CreateTransactionInfo(signers[0]), throttleContext);
+
+			// Assert:
+			AssertStatistics({ 2, 0, 0, 0, 1, 1 }, statistics);
+		});
+	}
+
+	TEST(TEST_CLASS, MemoizedSignerImportanceIsRefreshedWhenImportanceHeightChanges) {
+		// Arrange:
+		RunStatisticsTest(Importance(1'000), 120, [](const auto& context, const auto& signers) {
+			SpamThrottleStatistics statistics;
+			auto filter = CreateStatisticsThrottle(false, statistics);
+
+			auto runAtHeight = [&filter, &context, &signer = signers[0]](Height height) {
+				return filter(CreateTransactionInfo(signer), context.throttleContext(TransactionSource::New, height));
+			};
+
+			// Act: importance was calculated at importance height 1, so it is zero at importance height 100
+			auto result1 = runAtHeight(Height(99));
+			auto result2 = runAtHeight(Height(101));
+			auto result3 = runAtHeight(Height(150));
+
+			// Assert:
+			EXPECT_FALSE(result1);
+			EXPECT_TRUE(result2);
+			EXPECT_TRUE(result3);
+			AssertStatistics({ 1, 0, 2, 0, 1, 2 }, statistics);
+		});
+	}
+
+	TEST(TEST_CLASS, MemoizedSignerImportanceIsRefreshedWhenCacheIsRolledBackWithinImportanceHeight) {
+		// Arrange: create two forks at the same height with different signer importances
+		auto signer = test::GenerateRandomByteArray<Key>();
+		auto createForkContext = [&signer](Importance signerImportance, uint64_t cacheGeneration) {
+			auto bitxorcoreCache = CreateBitxorCoreCacheWithImportanceGrouping(100);
+			std::vector<Key> publicKeys;
+			{
+				auto delta = bitxorcoreCache.createDelta();
+				auto& accountStateCacheDelta = delta.sub<cache::AccountStateCache>();
+				publicKeys = SeedAccountStateCache(accountStateCacheDelta, 120, Importance(1'000));
+
+				accountStateCacheDelta.addAccount(signer, Height(1));
+				auto& accountState = accountStateCacheDelta.find(signer).get();
+				accountState.ImportanceSnapshots.set(signerImportance, model::ImportanceHeight(1));
+				bitxorcoreCache.commit(Height(1));
+			}
+
+			auto pContext = std::make_unique<TestContext>(std::move(bitxorcoreCache), Height(50), cacheGeneration);
+			pContext->addTransactions(publicKeys);
+			return pContext;
+		};
+
+		auto pOriginalForkContext = createForkContext(Importance(1'000), 7);
+		auto pRollbackForkContext = createForkContext(Importance(), 8);
+
+		SpamThrottleStatistics statistics;
+		auto filter = CreateStatisticsThrottle(false, statistics);
+
+		// Act: signer has importance in original fork but not after rollback (to the same height)
+		auto result1 = filter(CreateTransactionInfo(signer), pOriginalForkContext->throttleContext());
+		auto result2 = filter(CreateTransactionInfo(signer), pRollbackForkContext->throttleContext());
+
+		// Assert: importance was looked up again after rollback
+		EXPECT_FALSE(result1);
+		EXPECT_TRUE(result2);
+		AssertStatistics({ 1, 0, 1, 0, 0, 2 }, statistics);
+	}
+
+	TEST(TEST_CLASS, StatisticsTrackEarlyDecisionsWithoutImportanceLookups) {
+		// Arrange: max cache size is 1200 transactions
+		RunStatisticsTest(Importance(1'000), 1200, [](const auto& context, const auto& signers) {
+			SpamThrottleStatistics statistics;
+			auto filter = CreateStatisticsThrottle(true, statistics);
+
+			// Act: cache is full
+			auto result = filter(CreateTransactionInfo(signers[0]), context.throttleContext());
+
+			// Assert:
+			EXPECT_TRUE(result);
+			AssertStatistics({ 0, 1, 0, 0, 0, 0 }, statistics);
+		});
+
+		RunStatisticsTest(Importance(1'000), 120, [](const auto& context, const auto& signers) {
+			SpamThrottleStatistics statistics;
+			auto filter = CreateStatisticsThrottle(true, statistics);
+
+			// Act: transaction is bonded
+			auto result = filter(CreateTransactionInfo(signers[0]), context.throttleContext());
+
+			// Assert:
+			EXPECT_FALSE(result);
+			AssertStatistics({ 0, 0, 0, 1, 0, 0 }, statistics);
+		});
+	}
+
+	TEST(TEST_CLASS, StatisticsTrackThrottledTransactions) {
+		// Arrange:
+		RunStatisticsTest(Importance(), 120, [](const auto& context, const auto& signers) {
+			SpamThrottleStatistics statistics;
+			auto filter = CreateStatisticsThrottle(false, statistics);
+
+			// Act: signer has no importance
+			auto result = filter(CreateTransactionInfo(signers[0]), context.throttleContext());
+
+			// Assert:
+			EXPECT_TRUE(result);
+			AssertStatistics({ 0, 0, 1, 0, 0, 1 }, statistics);
+		});
+	}
+
+	// endregion
 }}
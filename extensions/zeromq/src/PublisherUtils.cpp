@@ -30,4 +30,20 @@ namespace bitxorcore { namespace zeromq {
 		std::memcpy(topic.data() + sizeof(TransactionMarker), address.data(), address.size());
 		return topic;
 	}
+
+	namespace {
+		using SharedData = std::shared_ptr<const void>;
+
+		void ReleaseSharedFrame(void*, void* pHint) {
+			delete static_cast<SharedData*>(pHint);
+		}
+	}
+
+	zmq::message_t CreateSharedFrame(const std::shared_ptr<const void>& pData, size_t size) {
+		// hint owns a reference to the data until zeromq is done with the frame (possibly on one of its io threads)
+		auto pHint = std::make_unique<SharedData>(pData);
+		zmq::message_t message(const_cast<void*>(pData.get()), size, ReleaseSharedFrame, pHint.get());
+		pHint.release();
+		return message;
+	}
 }}
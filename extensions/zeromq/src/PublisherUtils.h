@@ -23,10 +23,15 @@
 #pragma once
 #include "ZeroMqEntityPublisher.h"
 #include "bitxorcore/types.h"
+#include <memory>
 #include <vector>
 
 namespace bitxorcore { namespace zeromq {
 
 	/// Creates a topic around \a marker and \a address.
 	std::vector<uint8_t> CreateTopic(TransactionMarker marker, const UnresolvedAddress& address);
+
+	/// Creates a zero-copy message frame around the first \a size bytes of \a pData.
+	/// \note The frame shares ownership of \a pData until zeromq releases it, so a single buffer can back many frames.
+	zmq::message_t CreateSharedFrame(const std::shared_ptr<const void>& pData, size_t size);
 }}
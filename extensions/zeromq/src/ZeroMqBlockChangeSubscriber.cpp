@@ -39,9 +39,7 @@ namespace bitxorcore { namespace zeromq {
 				m_publisher.publishBlockHeader(blockElement);
 
 				// transactions
-				auto height = blockElement.Block.Height;
-				for (const auto& transactionElement : blockElement.Transactions)
-					m_publisher.publishTransaction(TransactionMarker::Transaction_Marker, transactionElement, height);
+				m_publisher.publishBlockTransactions(TransactionMarker::Transaction_Marker, blockElement);
 			}
 
 			void notifyDropBlocksAfter(Height height) override {
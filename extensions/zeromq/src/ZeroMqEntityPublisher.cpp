@@ -30,6 +30,7 @@
 #include "bitxorcore/model/TransactionStatus.h"
 #include "bitxorcore/model/TransactionUtils.h"
 #include "bitxorcore/thread/IoThreadPool.h"
+#include "bitxorcore/utils/MemoryUtils.h"
 #include <boost/asio.hpp>
 #include <set>
 
@@ -102,6 +103,7 @@ namespace bitxorcore { namespace zeromq {
 	public:
 		explicit WeakTransactionInfo(const model::TransactionInfo& transactionInfo)
 				: Transaction(*transactionInfo.pEntity)
+				, pSharedTransaction(transactionInfo.pEntity)
 				, EntityHash(transactionInfo.EntityHash)
 				, MerkleComponentHash(transactionInfo.MerkleComponentHash)
 				, OptionalAddresses(transactionInfo.OptionalExtractedAddresses.get())
@@ -109,6 +111,7 @@ namespace bitxorcore { namespace zeromq {
 
 		explicit WeakTransactionInfo(const model::TransactionElement& element)
 				: Transaction(element.Transaction)
+				, pSharedTransaction(nullptr)
 				, EntityHash(element.EntityHash)
 				, MerkleComponentHash(element.MerkleComponentHash)
 				, OptionalAddresses(element.OptionalExtractedAddresses.get())
@@ -116,6 +119,7 @@ namespace bitxorcore { namespace zeromq {
 
 		WeakTransactionInfo(const model::Transaction& transaction, const Hash256& hash)
 				: Transaction(transaction)
+				, pSharedTransaction(nullptr)
 				, EntityHash(hash)
 				, MerkleComponentHash(hash)
 				, OptionalAddresses(nullptr)
@@ -123,6 +127,7 @@ namespace bitxorcore { namespace zeromq {
 
 	public:
 		const model::Transaction& Transaction;
+		const std::shared_ptr<const model::Transaction> pSharedTransaction;
 		const Hash256& EntityHash;
 		const Hash256& MerkleComponentHash;
 		const model::UnresolvedAddressSet* OptionalAddresses;
@@ -207,6 +212,18 @@ namespace bitxorcore { namespace zeromq {
 		publishTransaction(topicMarker, WeakTransactionInfo(transactionInfo), height);
 	}
 
+	void ZeroMqEntityPublisher::publishBlockTransactions(TransactionMarker topicMarker, const model::BlockElement& blockElement) {
+		if (blockElement.Transactions.empty())
+			return;
+
+		auto height = blockElement.Block.Height;
+		auto pMessageGroup = std::make_unique<MessageGroup>(CreateHeightMessageGenerator("block transactions", height));
+		for (const auto& transactionElement : blockElement.Transactions)
+			addTransactionMessages(*pMessageGroup, topicMarker, WeakTransactionInfo(transactionElement), height);
+
+		m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
+	}
+
 	void ZeroMqEntityPublisher::publishTransactionHash(TransactionMarker topicMarker, const model::TransactionInfo& transactionInfo) {
 		const auto& hash = transactionInfo.EntityHash;
 		publish("transaction hash", topicMarker, WeakTransactionInfo(transactionInfo), [&hash](auto& multipart) {
@@ -214,13 +231,35 @@ namespace bitxorcore { namespace zeromq {
 		});
 	}
 
+	namespace {
+		std::shared_ptr<const model::Transaction> ShareTransaction(const model::Transaction& transaction) {
+			auto pTransaction = utils::MakeSharedWithSize<model::Transaction>(transaction.Size);
+			std::memcpy(static_cast<void*>(pTransaction.get()), &transaction, transaction.Size);
+			return pTransaction;
+		}
+	}
+
 	void ZeroMqEntityPublisher::publishTransaction(
 			TransactionMarker topicMarker,
 			const WeakTransactionInfo& transactionInfo,
 			Height height) {
-		publish("transaction", topicMarker, transactionInfo, [&transactionInfo, height](auto& multipart) {
-			const auto& transaction = transactionInfo.Transaction;
-			multipart.addmem(static_cast<const void*>(&transaction), transaction.Size);
+		auto pMessageGroup = std::make_unique<MessageGroup>(CreateHashMessageGenerator("transaction", transactionInfo.EntityHash));
+		addTransactionMessages(*pMessageGroup, topicMarker, transactionInfo, height);
+		m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
+	}
+
+	void ZeroMqEntityPublisher::addTransactionMessages(
+			MessageGroup& messageGroup,
+			TransactionMarker topicMarker,
+			const WeakTransactionInfo& transactionInfo,
+			Height height) {
+		// every message references the same (shared) transaction buffer instead of copying the transaction per address;
+		// transactions that are not already owned by a shared pointer (e.g. block transactions) are copied once
+		auto pTransaction = transactionInfo.pSharedTransaction
+				? transactionInfo.pSharedTransaction
+				: ShareTransaction(transactionInfo.Transaction);
+		addMessages(messageGroup, topicMarker, transactionInfo, [&transactionInfo, &pTransaction, height](auto& multipart) {
+			multipart.add(CreateSharedFrame(pTransaction, pTransaction->Size));
 			multipart.addmem(static_cast<const void*>(&transactionInfo.EntityHash), Hash256::Size);
 			multipart.addmem(static_cast<const void*>(&transactionInfo.MerkleComponentHash), Hash256::Size);
 			multipart.addtyp(height);
@@ -251,7 +290,15 @@ namespace bitxorcore { namespace zeromq {
 			const WeakTransactionInfo& transactionInfo,
 			const MessagePayloadBuilder& payloadBuilder) {
 		auto pMessageGroup = std::make_unique<MessageGroup>(CreateHashMessageGenerator(topicName, transactionInfo.EntityHash));
+		addMessages(*pMessageGroup, topicMarker, transactionInfo, payloadBuilder);
+		m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
+	}
 
+	void ZeroMqEntityPublisher::addMessages(
+			MessageGroup& messageGroup,
+			TransactionMarker topicMarker,
+			const WeakTransactionInfo& transactionInfo,
+			const MessagePayloadBuilder& payloadBuilder) {
 		const auto& addresses = transactionInfo.OptionalAddresses
 				? *transactionInfo.OptionalAddresses
 				: model::ExtractAddresses(transactionInfo.Transaction, *m_pNotificationPublisher);
@@ -264,9 +311,7 @@ namespace bitxorcore { namespace zeromq {
 			auto topic = CreateTopic(topicMarker, address);
 			multipart.addmem(topic.data(), topic.size());
 			payloadBuilder(multipart);
-			pMessageGroup->add(std::move(multipart));
+			messageGroup.add(std::move(multipart));
 		}
-
-		m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
 	}
 }}
@@ -44,7 +44,10 @@ namespace bitxorcore {
 		class TransactionRegistry;
 		struct TransactionStatus;
 	}
-	namespace zeromq { struct PackedFinalizedBlockHeader; }
+	namespace zeromq {
+		class MessageGroup;
+		struct PackedFinalizedBlockHeader;
+	}
 }
 
 namespace bitxorcore { namespace zeromq {
@@ -112,6 +115,9 @@ namespace bitxorcore { namespace zeromq {
 		/// Publishes a transaction using \a topicMarker, \a transactionInfo and \a height.
 		void publishTransaction(TransactionMarker topicMarker, const model::TransactionInfo& transactionInfo, Height height);
 
+		/// Publishes all transactions in \a blockElement using \a topicMarker as a single batch.
+		void publishBlockTransactions(TransactionMarker topicMarker, const model::BlockElement& blockElement);
+
 		/// Publishes a transaction hash using \a topicMarker and \a transactionInfo.
 		void publishTransactionHash(TransactionMarker topicMarker, const model::TransactionInfo& transactionInfo);
 
@@ -126,11 +132,22 @@ namespace bitxorcore { namespace zeromq {
 		using MessagePayloadBuilder = consumer<zmq::multipart_t&>;
 
 		void publishTransaction(TransactionMarker topicMarker, const WeakTransactionInfo& transactionInfo, Height height);
+		void addTransactionMessages(
+				MessageGroup& messageGroup,
+				TransactionMarker topicMarker,
+				const WeakTransactionInfo& transactionInfo,
+				Height height);
+
 		void publish(
 				const std::string& topicName,
 				TransactionMarker topicMarker,
 				const WeakTransactionInfo& transactionInfo,
 				const MessagePayloadBuilder& payloadBuilder);
+		void addMessages(
+				MessageGroup& messageGroup,
+				TransactionMarker topicMarker,
+				const WeakTransactionInfo& transactionInfo,
+				const MessagePayloadBuilder& payloadBuilder);
 
 	private:
 		class SynchronizedPublisher;
@@ -41,4 +41,35 @@ namespace bitxorcore { namespace zeromq {
 		EXPECT_EQ(marker, TransactionMarker(topic[0]));
 		EXPECT_EQ_MEMORY(address.data(), topic.data() + 1, Address::Size);
 	}
+
+	TEST(TEST_CLASS, CanCreateSharedFrame) {
+		// Arrange:
+		auto pData = std::make_shared<std::vector<uint8_t>>(test::GenerateRandomVector(100));
+		auto pBuffer = std::shared_ptr<const void>(pData, pData->data());
+
+		// Act:
+		auto frame = CreateSharedFrame(pBuffer, 75);
+
+		// Assert: frame references (and does not copy) data
+		ASSERT_EQ(75u, frame.size());
+		EXPECT_EQ(pData->data(), frame.data());
+		EXPECT_EQ(3, pData.use_count());
+	}
+
+	TEST(TEST_CLASS, SharedFrameReleasesDataWhenDestroyed) {
+		// Arrange:
+		auto pData = std::make_shared<std::vector<uint8_t>>(test::GenerateRandomVector(100));
+		auto pBuffer = std::shared_ptr<const void>(pData, pData->data());
+
+		{
+			auto frame1 = CreateSharedFrame(pBuffer, 75);
+			auto frame2 = CreateSharedFrame(pBuffer, 100);
+
+			// Sanity:
+			EXPECT_EQ(4, pData.use_count());
+		}
+
+		// Assert: only local references remain
+		EXPECT_EQ(2, pData.use_count());
+	}
 }}
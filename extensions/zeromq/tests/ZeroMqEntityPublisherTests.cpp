@@ -79,6 +79,10 @@ namespace bitxorcore { namespace zeromq {
 				publisher().publishTransaction(topicMarker, transactionElement, height);
 			}
 
+			void publishBlockTransactions(TransactionMarker topicMarker, const model::BlockElement& blockElement) {
+				publisher().publishBlockTransactions(topicMarker, blockElement);
+			}
+
 			void publishTransactionHash(TransactionMarker topicMarker, const model::TransactionInfo& transactionInfo) {
 				publisher().publishTransactionHash(topicMarker, transactionInfo);
 			}
@@ -327,6 +331,51 @@ namespace bitxorcore { namespace zeromq {
 
 	// endregion
 
+	// region publishBlockTransactions
+
+	TEST(TEST_CLASS, CanPublishBlockTransactions) {
+		// Arrange:
+		EntityPublisherContext context;
+		auto pBlock = test::GenerateBlockWithTransactions(3, Height(123));
+		auto blockElement = test::BlockToBlockElement(*pBlock);
+		for (auto& transactionElement : blockElement.Transactions) {
+			transactionElement.OptionalExtractedAddresses = GenerateRandomExtractedAddresses();
+			context.subscribeAll(Marker, *transactionElement.OptionalExtractedAddresses);
+		}
+
+		// Act:
+		context.publishBlockTransactions(Marker, blockElement);
+
+		// Assert: messages are delivered in transaction order
+		auto& zmqSocket = context.zmqSocket();
+		for (const auto& transactionElement : blockElement.Transactions) {
+			const auto& addresses = *transactionElement.OptionalExtractedAddresses;
+			test::AssertMessages(zmqSocket, Marker, addresses, [&transactionElement](const auto& message, const auto& topic) {
+				test::AssertTransactionElementMessage(message, topic, transactionElement, Height(123));
+			});
+		}
+
+		test::AssertNoPendingMessages(zmqSocket);
+	}
+
+	TEST(TEST_CLASS, PublishBlockTransactionsDeliversNoMessagesWhenBlockHasNoTransactions) {
+		// Arrange:
+		EntityPublisherContext context;
+		auto pBlock = test::GenerateEmptyRandomBlock();
+		auto blockElement = test::BlockToBlockElement(*pBlock);
+
+		// - subscribe to all messages with marker
+		context.subscribe(Marker);
+
+		// Act:
+		context.publishBlockTransactions(Marker, blockElement);
+
+		// Assert: no messages are pending
+		test::AssertNoPendingMessages(context.zmqSocket());
+	}
+
+	// endregion
+
 	// region publishTransactionHash
 
 	namespace {
@@ -50,7 +50,7 @@ namespace bitxorcore { namespace plugins {
 			}
 
 			static std::vector<ionet::PacketType> GetNonDiagnosticPacketTypes() {
-				return { ionet::PacketType::Account_State_Path };
+				return { ionet::PacketType::Account_State_Path, ionet::PacketType::Account_State_Paths };
 			}
 
 			static std::vector<ionet::PacketType> GetDiagnosticPacketTypes() {
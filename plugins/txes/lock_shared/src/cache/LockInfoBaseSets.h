@@ -52,7 +52,7 @@ namespace bitxorcore { namespace cache {
 				: CacheDatabaseMixin(config, { "default", "height_grouping" })
 				, Primary(GetContainerMode(config), database(), 0)
 				, HeightGrouping(GetContainerMode(config), database(), 1)
-				, PatriciaTree(hasPatriciaTreeSupport(), database(), 2)
+				, PatriciaTree(hasPatriciaTreeSupport(), database(), 2, patriciaTreeNodeCacheSize())
 		{}
 
 	public:
@@ -59,7 +59,7 @@ namespace bitxorcore { namespace plugins {
 			}
 
 			static std::vector<ionet::PacketType> GetNonDiagnosticPacketTypes() {
-				return { ionet::PacketType::Metadata_State_Path };
+				return { ionet::PacketType::Metadata_State_Path, ionet::PacketType::Metadata_State_Paths };
 			}
 
 			static std::vector<ionet::PacketType> GetDiagnosticPacketTypes() {
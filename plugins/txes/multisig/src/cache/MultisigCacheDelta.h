@@ -22,8 +22,9 @@
 
 #pragma once
 #include "MultisigBaseSets.h"
+#include "MultisigGraphCache.h"
+#include "ReadOnlyMultisigCache.h"
 #include "bitxorcore/cache/CacheMixinAliases.h"
-#include "bitxorcore/cache/ReadOnlyArtifactCache.h"
 #include "bitxorcore/cache/ReadOnlyViewSupplier.h"
 #include "bitxorcore/deltaset/BaseSetDelta.h"
 
@@ -56,14 +57,40 @@ namespace bitxorcore { namespace cache {
 				, MultisigCacheDeltaMixins::BasicInsertRemove(*multisigSets.pPrimary)
 				, MultisigCacheDeltaMixins::DeltaElements(*multisigSets.pPrimary)
 				, m_pMultisigEntries(multisigSets.pPrimary)
+				, m_pGraphCache(std::make_unique<MultisigGraphCache>())
 		{}
 
 	public:
 		using MultisigCacheDeltaMixins::ConstAccessor::find;
-		using MultisigCacheDeltaMixins::MutableAccessor::find;
+
+		/// Finds the (mutable) multisig entry associated with \a address.
+		/// \note Any memoized multisig closures are invalidated because the entry can be modified.
+		MultisigCacheDeltaMixins::MutableAccessor::iterator find(const Address& address) {
+			m_pGraphCache->clear();
+			return MultisigCacheDeltaMixins::MutableAccessor::find(address);
+		}
+
+		/// Inserts \a entry into the cache.
+		void insert(const state::MultisigEntry& entry) {
+			m_pGraphCache->clear();
+			MultisigCacheDeltaMixins::BasicInsertRemove::insert(entry);
+		}
+
+		/// Removes the entry associated with \a address from the cache.
+		void remove(const Address& address) {
+			m_pGraphCache->clear();
+			MultisigCacheDeltaMixins::BasicInsertRemove::remove(address);
+		}
+
+	public:
+		/// Gets the graph cache memoizing multisig closures calculated against this delta.
+		MultisigGraphCache& graphCache() const {
+			return *m_pGraphCache;
+		}
 
 	private:
 		MultisigCacheTypes::PrimaryTypes::BaseSetDeltaPointerType m_pMultisigEntries;
+		std::unique_ptr<MultisigGraphCache> m_pGraphCache;
 	};
 
 	/// Delta on top of the multisig cache.
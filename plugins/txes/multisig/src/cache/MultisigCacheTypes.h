@@ -36,9 +36,7 @@ namespace bitxorcore {
 		class MultisigCacheView;
 		struct MultisigEntryPrimarySerializer;
 		class MultisigPatriciaTree;
-
-		template<typename TCache, typename TCacheDelta, typename TCacheKey, typename TGetResult>
-		class ReadOnlyArtifactCache;
+		class ReadOnlyMultisigCache;
 	}
 }
 
@@ -73,7 +71,7 @@ namespace bitxorcore { namespace cache {
 	struct MultisigCacheTypes {
 		using PrimaryTypes = MutableUnorderedMapAdapter<MultisigCacheDescriptor, utils::ArrayHasher<Address>>;
 
-		using CacheReadOnlyType = ReadOnlyArtifactCache<BasicMultisigCacheView, BasicMultisigCacheDelta, Address, state::MultisigEntry>;
+		using CacheReadOnlyType = ReadOnlyMultisigCache;
 
 		using BaseSetDeltaPointers = MultisigBaseSetDeltaPointers;
 		using BaseSets = MultisigBaseSets;
@@ -22,6 +22,7 @@
 
 #include "MultisigCacheUtils.h"
 #include "MultisigCache.h"
+#include <algorithm>
 
 namespace bitxorcore { namespace cache {
 
@@ -30,36 +31,105 @@ namespace bitxorcore { namespace cache {
 			static const auto& GetAddresses(const state::MultisigEntry& multisigEntry) {
 				return multisigEntry.multisigAddresses();
 			}
+
+			static auto TryFind(const MultisigGraphCache& graphCache, const Address& address) {
+				return graphCache.tryFindAncestors(address);
+			}
+
+			static void Insert(MultisigGraphCache& graphCache, const Address& address, const MultisigGraphCache::ClosurePointer& pClosure) {
+				graphCache.insertAncestors(address, pClosure);
+			}
 		};
 
 		struct DescendantTraits {
 			static const auto& GetAddresses(const state::MultisigEntry& multisigEntry) {
 				return multisigEntry.cosignatoryAddresses();
 			}
+
+			static auto TryFind(const MultisigGraphCache& graphCache, const Address& address) {
+				return graphCache.tryFindDescendants(address);
+			}
+
+			static void Insert(MultisigGraphCache& graphCache, const Address& address, const MultisigGraphCache::ClosurePointer& pClosure) {
+				graphCache.insertDescendants(address, pClosure);
+			}
 		};
 
+		void SortUnique(std::vector<Address>& addresses) {
+			std::sort(addresses.begin(), addresses.end());
+			addresses.erase(std::unique(addresses.begin(), addresses.end()), addresses.end());
+		}
+
 		template<typename TTraits>
-		size_t FindAll(const MultisigCacheTypes::CacheReadOnlyType& multisigCache, const Address& address, model::AddressSet& addresses) {
-			auto multisigIter = multisigCache.find(address);
-			if (!multisigIter.tryGet())
-				return 0;
-
-			size_t numLevels = 0;
-			const auto& multisigEntry = multisigIter.get();
-			for (const auto& linkedAddress : TTraits::GetAddresses(multisigEntry)) {
-				addresses.insert(linkedAddress);
-				numLevels = std::max(numLevels, FindAll<TTraits>(multisigCache, linkedAddress, addresses) + 1);
+		MultisigGraphClosure CalculateClosure(const MultisigCacheTypes::CacheReadOnlyType& multisigCache, const Address& address) {
+			// walk the graph level by level so that the number of levels is the length of the longest path
+			MultisigGraphClosure closure;
+			std::vector<Address> currentLevel{ address };
+			std::vector<Address> nextLevel;
+			while (true) {
+				for (const auto& currentAddress : currentLevel) {
+					auto multisigIter = multisigCache.find(currentAddress);
+					if (!multisigIter.tryGet())
+						continue;
+
+					const auto& linkedAddresses = TTraits::GetAddresses(multisigIter.get());
+					nextLevel.insert(nextLevel.end(), linkedAddresses.cbegin(), linkedAddresses.cend());
+				}
+
+				if (nextLevel.empty())
+					break;
+
+				SortUnique(nextLevel);
+				closure.Addresses.insert(closure.Addresses.end(), nextLevel.cbegin(), nextLevel.cend());
+				SortUnique(closure.Addresses);
+				++closure.NumLevels;
+
+				// the longest path in a loop free graph cannot be longer than the number of reachable addresses
+				if (closure.NumLevels > closure.Addresses.size())
+					break;
+
+				currentLevel.swap(nextLevel);
+				nextLevel.clear();
 			}
 
-			return numLevels;
+			return closure;
+		}
+
+		template<typename TTraits>
+		MultisigGraphCache::ClosurePointer FindClosure(const MultisigCacheTypes::CacheReadOnlyType& multisigCache, const Address& address) {
+			auto* pGraphCache = multisigCache.graphCache();
+			if (pGraphCache) {
+				auto pClosure = TTraits::TryFind(*pGraphCache, address);
+				if (pClosure)
+					return pClosure;
+			}
+
+			auto pClosure = std::make_shared<const MultisigGraphClosure>(CalculateClosure<TTraits>(multisigCache, address));
+			if (pGraphCache)
+				TTraits::Insert(*pGraphCache, address, pClosure);
+
+			return pClosure;
 		}
+
+		size_t CopyClosure(const MultisigGraphClosure& closure, model::AddressSet& addresses) {
+			addresses.insert(closure.Addresses.cbegin(), closure.Addresses.cend());
+			return closure.NumLevels;
+		}
+	}
+
+	MultisigGraphCache::ClosurePointer FindAncestorClosure(const MultisigCacheTypes::CacheReadOnlyType& cache, const Address& address) {
+		return FindClosure<AncestorTraits>(cache, address);
+	}
+
+	MultisigGraphCache::ClosurePointer FindDescendantClosure(const MultisigCacheTypes::CacheReadOnlyType& cache, const Address& address) {
+		return FindClosure<DescendantTraits>(cache, address);
 	}
 
 	size_t FindAncestors(const MultisigCacheTypes::CacheReadOnlyType& cache, const Address& address, model::AddressSet& ancestors) {
-		return FindAll<AncestorTraits>(cache, address, ancestors);
+		return CopyClosure(*FindAncestorClosure(cache, address), ancestors);
 	}
 
 	size_t FindDescendants(const MultisigCacheTypes::CacheReadOnlyType& cache, const Address& address, model::AddressSet& descendants) {
-		return FindAll<DescendantTraits>(cache, address, descendants);
+		return CopyClosure(*FindDescendantClosure(cache, address), descendants);
 	}
 }}
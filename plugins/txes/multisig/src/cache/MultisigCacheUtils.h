@@ -22,10 +22,19 @@
 
 #pragma once
 #include "MultisigCacheTypes.h"
+#include "MultisigGraphCache.h"
 #include "bitxorcore/model/ContainerTypes.h"
 
 namespace bitxorcore { namespace cache {
 
+	/// Gets the ancestor closure of \a address in \a cache.
+	/// \note Closures are memoized in the graph cache of \a cache when one is available.
+	MultisigGraphCache::ClosurePointer FindAncestorClosure(const MultisigCacheTypes::CacheReadOnlyType& cache, const Address& address);
+
+	/// Gets the descendant closure of \a address in \a cache.
+	/// \note Closures are memoized in the graph cache of \a cache when one is available.
+	MultisigGraphCache::ClosurePointer FindDescendantClosure(const MultisigCacheTypes::CacheReadOnlyType& cache, const Address& address);
+
 	/// Finds all ancestors of \a address in \a cache, adds them to \a ancestors and returns the maximum distance between
 	/// \a address and any ancestor.
 	size_t FindAncestors(const MultisigCacheTypes::CacheReadOnlyType& cache, const Address& address, model::AddressSet& ancestors);
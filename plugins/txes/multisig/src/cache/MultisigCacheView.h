@@ -23,8 +23,8 @@
 #pragma once
 #include "MultisigBaseSets.h"
 #include "MultisigCacheSerializers.h"
+#include "ReadOnlyMultisigCache.h"
 #include "bitxorcore/cache/CacheMixinAliases.h"
-#include "bitxorcore/cache/ReadOnlyArtifactCache.h"
 #include "bitxorcore/cache/ReadOnlyViewSupplier.h"
 
 namespace bitxorcore { namespace cache {
@@ -0,0 +1,80 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MultisigGraphCache.h"
+
+namespace bitxorcore { namespace cache {
+
+	size_t MultisigGraphCache::size() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_ancestors.size() + m_descendants.size();
+	}
+
+	const MultisigGraphCacheStatistics& MultisigGraphCache::statistics() const {
+		return m_statistics;
+	}
+
+	MultisigGraphCache::ClosurePointer MultisigGraphCache::tryFindAncestors(const Address& address) const {
+		return tryFind(m_ancestors, address);
+	}
+
+	MultisigGraphCache::ClosurePointer MultisigGraphCache::tryFindDescendants(const Address& address) const {
+		return tryFind(m_descendants, address);
+	}
+
+	void MultisigGraphCache::insertAncestors(const Address& address, const ClosurePointer& pClosure) {
+		utils::SpinLockGuard guard(m_lock);
+		m_ancestors.emplace(address, pClosure);
+	}
+
+	void MultisigGraphCache::insertDescendants(const Address& address, const ClosurePointer& pClosure) {
+		utils::SpinLockGuard guard(m_lock);
+		m_descendants.emplace(address, pClosure);
+	}
+
+	void MultisigGraphCache::clear() {
+		{
+			utils::SpinLockGuard guard(m_lock);
+			if (m_ancestors.empty() && m_descendants.empty())
+				return;
+
+			m_ancestors.clear();
+			m_descendants.clear();
+		}
+
+		++m_statistics.NumInvalidations;
+	}
+
+	MultisigGraphCache::ClosurePointer MultisigGraphCache::tryFind(const ClosureMap& closures, const Address& address) const {
+		{
+			utils::SpinLockGuard guard(m_lock);
+			auto iter = closures.find(address);
+			if (closures.cend() != iter) {
+				++m_statistics.NumHits;
+				return iter->second;
+			}
+		}
+
+		++m_statistics.NumMisses;
+		return nullptr;
+	}
+}}
@@ -0,0 +1,105 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "bitxorcore/utils/Hashers.h"
+#include "bitxorcore/utils/SpinLock.h"
+#include "bitxorcore/types.h"
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace bitxorcore { namespace cache {
+
+	/// Ancestor or descendant closure of a multisig account.
+	struct MultisigGraphClosure {
+		/// Sorted unique addresses reachable from the account (excluding the account itself).
+		std::vector<Address> Addresses;
+
+		/// Maximum distance between the account and any reachable address.
+		size_t NumLevels = 0;
+	};
+
+	/// Multisig graph cache statistics.
+	struct MultisigGraphCacheStatistics {
+	public:
+		/// Creates zeroed statistics.
+		MultisigGraphCacheStatistics()
+				: NumHits(0)
+				, NumMisses(0)
+				, NumInvalidations(0)
+		{}
+
+	public:
+		/// Number of closures served from the cache.
+		std::atomic<uint64_t> NumHits;
+
+		/// Number of closures that were not found in the cache.
+		std::atomic<uint64_t> NumMisses;
+
+		/// Number of times the cache was cleared.
+		std::atomic<uint64_t> NumInvalidations;
+	};
+
+	/// Thread safe memo of multisig ancestor and descendant closures.
+	/// \note Cached closures are only valid as long as the underlying multisig state does not change,
+	///       so the cache must be cleared whenever it does.
+	class MultisigGraphCache {
+	public:
+		using ClosurePointer = std::shared_ptr<const MultisigGraphClosure>;
+
+	public:
+		/// Gets the number of cached closures.
+		size_t size() const;
+
+		/// Gets the cache statistics.
+		const MultisigGraphCacheStatistics& statistics() const;
+
+	public:
+		/// Tries to find the cached ancestor closure of \a address.
+		ClosurePointer tryFindAncestors(const Address& address) const;
+
+		/// Tries to find the cached descendant closure of \a address.
+		ClosurePointer tryFindDescendants(const Address& address) const;
+
+		/// Caches the ancestor closure (\a pClosure) of \a address.
+		void insertAncestors(const Address& address, const ClosurePointer& pClosure);
+
+		/// Caches the descendant closure (\a pClosure) of \a address.
+		void insertDescendants(const Address& address, const ClosurePointer& pClosure);
+
+		/// Removes all cached closures.
+		void clear();
+
+	private:
+		using ClosureMap = std::unordered_map<Address, ClosurePointer, utils::ArrayHasher<Address>>;
+
+		ClosurePointer tryFind(const ClosureMap& closures, const Address& address) const;
+
+	private:
+		ClosureMap m_ancestors;
+		ClosureMap m_descendants;
+		mutable MultisigGraphCacheStatistics m_statistics;
+		mutable utils::SpinLock m_lock;
+	};
+}}
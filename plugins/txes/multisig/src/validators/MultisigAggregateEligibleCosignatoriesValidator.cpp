@@ -22,6 +22,7 @@
 
 #include "Validators.h"
 #include "src/cache/MultisigCache.h"
+#include "src/cache/MultisigCacheUtils.h"
 #include "bitxorcore/model/Address.h"
 #include "bitxorcore/model/TransactionPlugin.h"
 #include "bitxorcore/validators/ValidatorContext.h"
@@ -78,22 +79,23 @@ namespace bitxorcore { namespace validators {
 
 			void findEligibleCosignatories(const Address& address) {
 				// if the account is unknown or not multisig, only the address itself is eligible
-				if (!m_multisigCache.contains(address)) {
+				if (!isMultisig(address)) {
 					markEligible(address);
 					return;
 				}
 
-				// if the account is a cosignatory only, treat it as non-multisig
-				auto multisigIter = m_multisigCache.find(address);
-				const auto& multisigEntry = multisigIter.get();
-				if (multisigEntry.cosignatoryAddresses().empty()) {
-					markEligible(address);
-					return;
+				// if the account is multisig, only its (transitive) cosignatories that are not multisig themselves are eligible
+				auto pDescendants = cache::FindDescendantClosure(m_multisigCache, address);
+				for (const auto& descendantAddress : pDescendants->Addresses) {
+					if (!isMultisig(descendantAddress))
+						markEligible(descendantAddress);
 				}
+			}
 
-				// if the account is multisig, only its cosignatories are eligible
-				for (const auto& cosignatoryAddress : multisigEntry.cosignatoryAddresses())
-					findEligibleCosignatories(cosignatoryAddress);
+			bool isMultisig(const Address& address) const {
+				// an account that is a cosignatory only is treated as non-multisig
+				auto multisigIter = m_multisigCache.find(address);
+				return multisigIter.tryGet() && !multisigIter.get().cosignatoryAddresses().empty();
 			}
 
 			void markEligible(const Address& address) {
@@ -24,6 +24,7 @@
 #include "src/cache/MultisigCache.h"
 #include "src/cache/MultisigCacheUtils.h"
 #include "bitxorcore/validators/ValidatorContext.h"
+#include <algorithm>
 
 namespace bitxorcore { namespace validators {
 
@@ -39,23 +40,38 @@ namespace bitxorcore { namespace validators {
 
 		public:
 			ValidationResult validate(const Address& top, const Address& bottom) {
-				model::AddressSet ancestors;
-				ancestors.insert(top);
-				auto numTopLevels = FindAncestors(m_multisigCache, top, ancestors);
+				auto pAncestors = FindAncestorClosure(m_multisigCache, top);
+				auto pDescendants = FindDescendantClosure(m_multisigCache, bottom);
 
-				model::AddressSet descendants;
-				descendants.insert(bottom);
-				auto numBottomLevels = FindDescendants(m_multisigCache, bottom, descendants);
-
-				if (numTopLevels + numBottomLevels + 1 > m_maxMultisigDepth)
+				if (pAncestors->NumLevels + pDescendants->NumLevels + 1 > m_maxMultisigDepth)
 					return Failure_Multisig_Max_Multisig_Depth;
 
-				auto hasLoop = std::any_of(ancestors.cbegin(), ancestors.cend(), [&descendants](const auto& address) {
-					return descendants.cend() != descendants.find(address);
-				});
+				// closures do not include the accounts themselves, so {top} U ancestors and {bottom} U descendants need to be checked
+				const auto& ancestors = pAncestors->Addresses;
+				const auto& descendants = pDescendants->Addresses;
+				auto hasLoop = top == bottom
+						|| std::binary_search(descendants.cbegin(), descendants.cend(), top)
+						|| std::binary_search(ancestors.cbegin(), ancestors.cend(), bottom)
+						|| HasIntersection(ancestors, descendants);
 				return hasLoop ? Failure_Multisig_Loop : ValidationResult::Success;
 			}
 
+		private:
+			static bool HasIntersection(const std::vector<Address>& lhs, const std::vector<Address>& rhs) {
+				auto lhsIter = lhs.cbegin();
+				auto rhsIter = rhs.cbegin();
+				while (lhs.cend() != lhsIter && rhs.cend() != rhsIter) {
+					if (*lhsIter < *rhsIter)
+						++lhsIter;
+					else if (*rhsIter < *lhsIter)
+						++rhsIter;
+					else
+						return true;
+				}
+
+				return false;
+			}
+
 		private:
 			const cache::MultisigCache::CacheReadOnlyType& m_multisigCache;
 			uint8_t m_maxMultisigDepth;
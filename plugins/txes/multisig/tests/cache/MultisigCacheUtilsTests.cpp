@@ -57,14 +57,20 @@ namespace bitxorcore { namespace cache {
 			return cache;
 		}
 
-		template<typename TAction>
-		void RunMultisigTreeTest(TAction action) {
-			// Arrange: generate random addresses but change the second byte of each to its index (for easier diagnosing of failures)
+		auto GenerateTreeAddresses() {
+			// generate random addresses but change the second byte of each to its index (for easier diagnosing of failures)
 			auto addresses = test::GenerateRandomDataVector<Address>(Num_Tree_Accounts);
 			uint8_t id = 0;
 			for (auto& address : addresses)
 				address[1] = id++;
 
+			return addresses;
+		}
+
+		template<typename TAction>
+		void RunMultisigTreeTest(TAction action) {
+			// Arrange:
+			auto addresses = GenerateTreeAddresses();
 			auto cache = CreateCacheMultisigTree(addresses);
 			auto cacheView = cache.createView();
 			auto readOnlyCache = cacheView.toReadOnly();
@@ -80,6 +86,13 @@ namespace bitxorcore { namespace cache {
 
 			return pickedAddresses;
 		}
+
+		std::vector<Address> PickSorted(const std::vector<Address>& addresses, std::initializer_list<size_t> indexes) {
+			auto pickedAddresses = Pick(addresses, indexes);
+			std::vector<Address> sortedAddresses(pickedAddresses.cbegin(), pickedAddresses.cend());
+			std::sort(sortedAddresses.begin(), sortedAddresses.end());
+			return sortedAddresses;
+		}
 	}
 
 	// region FindDescendants
@@ -167,4 +180,97 @@ namespace bitxorcore { namespace cache {
 	}
 
 	// endregion
+
+	// region FindAncestorClosure / FindDescendantClosure
+
+	TEST(TEST_CLASS, CanFindSortedDescendantClosure) {
+		// Arrange:
+		RunMultisigTreeTest([](const auto& cache, const auto& addresses) {
+			// Act:
+			auto pClosure = FindDescendantClosure(cache, addresses[4]);
+
+			// Assert:
+			EXPECT_EQ(4u, pClosure->NumLevels);
+			EXPECT_EQ(PickSorted(addresses, { 6, 7, 8, 9, 10, 11, 12 }), pClosure->Addresses);
+		});
+	}
+
+	TEST(TEST_CLASS, CanFindSortedAncestorClosure) {
+		// Arrange:
+		RunMultisigTreeTest([](const auto& cache, const auto& addresses) {
+			// Act:
+			auto pClosure = FindAncestorClosure(cache, addresses[10]);
+
+			// Assert:
+			EXPECT_EQ(4u, pClosure->NumLevels);
+			EXPECT_EQ(PickSorted(addresses, { 7, 6, 2, 3, 4, 1, 13 }), pClosure->Addresses);
+		});
+	}
+
+	TEST(TEST_CLASS, ClosuresAreNotMemoizedByView) {
+		// Arrange:
+		RunMultisigTreeTest([](const auto& cache, const auto& addresses) {
+			// Act:
+			auto pClosure1 = FindDescendantClosure(cache, addresses[4]);
+			auto pClosure2 = FindDescendantClosure(cache, addresses[4]);
+
+			// Assert:
+			EXPECT_FALSE(!!cache.graphCache());
+			EXPECT_NE(pClosure1, pClosure2);
+			EXPECT_EQ(pClosure1->Addresses, pClosure2->Addresses);
+		});
+	}
+
+	TEST(TEST_CLASS, ClosuresAreMemoizedByDelta) {
+		// Arrange:
+		auto addresses = GenerateTreeAddresses();
+		auto cache = CreateCacheMultisigTree(addresses);
+		auto cacheDelta = cache.createDelta();
+		auto readOnlyCache = cacheDelta.toReadOnly();
+		const auto& multisigCache = readOnlyCache.sub<MultisigCache>();
+
+		// Act:
+		auto pDescendants1 = FindDescendantClosure(multisigCache, addresses[4]);
+		auto pAncestors1 = FindAncestorClosure(multisigCache, addresses[4]);
+		auto pDescendants2 = FindDescendantClosure(multisigCache, addresses[4]);
+		auto pAncestors2 = FindAncestorClosure(multisigCache, addresses[4]);
+
+		// Assert:
+		const auto* pGraphCache = multisigCache.graphCache();
+		ASSERT_TRUE(!!pGraphCache);
+		EXPECT_EQ(2u, pGraphCache->size());
+		EXPECT_EQ(2u, pGraphCache->statistics().NumHits);
+		EXPECT_EQ(2u, pGraphCache->statistics().NumMisses);
+
+		EXPECT_EQ(pDescendants1, pDescendants2);
+		EXPECT_EQ(pAncestors1, pAncestors2);
+		EXPECT_EQ(PickSorted(addresses, { 6, 7, 8, 9, 10, 11, 12 }), pDescendants2->Addresses);
+		EXPECT_EQ(PickSorted(addresses, { 1, 13 }), pAncestors2->Addresses);
+	}
+
+	TEST(TEST_CLASS, MemoizedClosuresAreInvalidatedByDeltaModification) {
+		// Arrange:
+		auto addresses = GenerateTreeAddresses();
+		auto cache = CreateCacheMultisigTree(addresses);
+		auto cacheDelta = cache.createDelta();
+		auto readOnlyCache = cacheDelta.toReadOnly();
+		const auto& multisigCache = readOnlyCache.sub<MultisigCache>();
+		auto pDescendants1 = FindDescendantClosure(multisigCache, addresses[4]);
+
+		// Act: make 9 a multisig account with cosignatory 5
+		test::MakeMultisig(cacheDelta, addresses[9], { addresses[5] });
+		auto pDescendants2 = FindDescendantClosure(multisigCache, addresses[4]);
+
+		// Assert:
+		const auto* pGraphCache = multisigCache.graphCache();
+		EXPECT_LE(1u, pGraphCache->statistics().NumInvalidations);
+		EXPECT_EQ(0u, pGraphCache->statistics().NumHits);
+
+		EXPECT_EQ(4u, pDescendants1->NumLevels);
+		EXPECT_EQ(PickSorted(addresses, { 6, 7, 8, 9, 10, 11, 12 }), pDescendants1->Addresses);
+		EXPECT_EQ(4u, pDescendants2->NumLevels);
+		EXPECT_EQ(PickSorted(addresses, { 5, 6, 7, 8, 9, 10, 11, 12 }), pDescendants2->Addresses);
+	}
+
+	// endregion
 }}
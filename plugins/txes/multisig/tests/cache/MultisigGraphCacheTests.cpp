@@ -0,0 +1,155 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/cache/MultisigGraphCache.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace bitxorcore { namespace cache {
+
+#define TEST_CLASS MultisigGraphCacheTests
+
+	namespace {
+		void AssertStatistics(const MultisigGraphCache& cache, uint64_t numHits, uint64_t numMisses, uint64_t numInvalidations) {
+			const auto& statistics = cache.statistics();
+			EXPECT_EQ(numHits, statistics.NumHits);
+			EXPECT_EQ(numMisses, statistics.NumMisses);
+			EXPECT_EQ(numInvalidations, statistics.NumInvalidations);
+		}
+
+		auto CreateClosure(size_t numLevels) {
+			auto pClosure = std::make_shared<MultisigGraphClosure>();
+			pClosure->Addresses = test::GenerateRandomDataVector<Address>(3);
+			pClosure->NumLevels = numLevels;
+			return std::shared_ptr<const MultisigGraphClosure>(std::move(pClosure));
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreateEmptyCache) {
+		// Act:
+		MultisigGraphCache cache;
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		AssertStatistics(cache, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, TryFindFailsWhenClosureIsNotCached) {
+		// Arrange:
+		MultisigGraphCache cache;
+		cache.insertAncestors(test::GenerateRandomByteArray<Address>(), CreateClosure(1));
+
+		// Act:
+		auto pClosure = cache.tryFindAncestors(test::GenerateRandomByteArray<Address>());
+
+		// Assert:
+		EXPECT_FALSE(!!pClosure);
+		AssertStatistics(cache, 0, 1, 0);
+	}
+
+	TEST(TEST_CLASS, TryFindSucceedsWhenAncestorClosureIsCached) {
+		// Arrange:
+		auto address = test::GenerateRandomByteArray<Address>();
+		auto pExpectedClosure = CreateClosure(2);
+
+		MultisigGraphCache cache;
+		cache.insertAncestors(address, pExpectedClosure);
+
+		// Act:
+		auto pClosure = cache.tryFindAncestors(address);
+
+		// Assert:
+		EXPECT_EQ(pExpectedClosure, pClosure);
+		EXPECT_EQ(1u, cache.size());
+		AssertStatistics(cache, 1, 0, 0);
+	}
+
+	TEST(TEST_CLASS, TryFindSucceedsWhenDescendantClosureIsCached) {
+		// Arrange:
+		auto address = test::GenerateRandomByteArray<Address>();
+		auto pExpectedClosure = CreateClosure(2);
+
+		MultisigGraphCache cache;
+		cache.insertDescendants(address, pExpectedClosure);
+
+		// Act:
+		auto pClosure = cache.tryFindDescendants(address);
+
+		// Assert:
+		EXPECT_EQ(pExpectedClosure, pClosure);
+		EXPECT_EQ(1u, cache.size());
+		AssertStatistics(cache, 1, 0, 0);
+	}
+
+	TEST(TEST_CLASS, AncestorAndDescendantClosuresAreCachedIndependently) {
+		// Arrange:
+		auto address = test::GenerateRandomByteArray<Address>();
+		auto pAncestors = CreateClosure(1);
+		auto pDescendants = CreateClosure(2);
+
+		MultisigGraphCache cache;
+		cache.insertAncestors(address, pAncestors);
+
+		// Act:
+		auto pClosure1 = cache.tryFindDescendants(address);
+		cache.insertDescendants(address, pDescendants);
+		auto pClosure2 = cache.tryFindDescendants(address);
+		auto pClosure3 = cache.tryFindAncestors(address);
+
+		// Assert:
+		EXPECT_FALSE(!!pClosure1);
+		EXPECT_EQ(pDescendants, pClosure2);
+		EXPECT_EQ(pAncestors, pClosure3);
+		EXPECT_EQ(2u, cache.size());
+		AssertStatistics(cache, 2, 1, 0);
+	}
+
+	TEST(TEST_CLASS, ClearRemovesAllClosures) {
+		// Arrange:
+		auto address = test::GenerateRandomByteArray<Address>();
+
+		MultisigGraphCache cache;
+		cache.insertAncestors(address, CreateClosure(1));
+		cache.insertDescendants(address, CreateClosure(1));
+
+		// Act:
+		cache.clear();
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_FALSE(!!cache.tryFindAncestors(address));
+		EXPECT_FALSE(!!cache.tryFindDescendants(address));
+		AssertStatistics(cache, 0, 2, 1);
+	}
+
+	TEST(TEST_CLASS, ClearOfEmptyCacheIsNotCountedAsInvalidation) {
+		// Arrange:
+		MultisigGraphCache cache;
+
+		// Act:
+		cache.clear();
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		AssertStatistics(cache, 0, 0, 0);
+	}
+}}
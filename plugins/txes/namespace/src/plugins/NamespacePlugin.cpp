@@ -77,7 +77,9 @@ namespace bitxorcore { namespace plugins {
 			manager.addObserverHook([](auto& builder) {
 				builder
 					.add(observers::CreateAliasedAddressObserver())
-					.add(observers::CreateAliasedTokenIdObserver());
+					.add(observers::CreateAliasedTokenIdObserver())
+					.add(observers::CreateResolutionCacheInvalidationObserver<model::AliasedAddressNotification>("AliasedAddress"))
+					.add(observers::CreateResolutionCacheInvalidationObserver<model::AliasedTokenIdNotification>("AliasedTokenId"));
 			});
 		}
 
@@ -185,6 +187,14 @@ namespace bitxorcore { namespace plugins {
 				counters.emplace_back(utils::DiagnosticCounterId("NS C DS"), [&cache]() { return GetNamespaceView(cache)->deepSize(); });
 			});
 
+			manager.addDiagnosticCounterHook([&statistics = manager.resolutionCacheStatistics()](auto& counters, const auto&) {
+				counters.emplace_back(utils::DiagnosticCounterId("NS RES HIT"), [&statistics]() { return statistics.NumHits.load(); });
+				counters.emplace_back(utils::DiagnosticCounterId("NS RES MISS"), [&statistics]() { return statistics.NumMisses.load(); });
+				counters.emplace_back(utils::DiagnosticCounterId("NS RES INV"), [&statistics]() {
+					return statistics.NumInvalidations.load();
+				});
+			});
+
 			manager.addStatelessValidatorHook([config, minDuration, maxDuration](auto& builder) {
 				builder
 					.add(validators::CreateNamespaceRegistrationTypeValidator())
@@ -215,7 +225,11 @@ namespace bitxorcore { namespace plugins {
 							"NamespaceGracePeriod",
 							model::Receipt_Type_Namespace_Expired,
 							gracePeriodDuration))
-					.add(observers::CreateCacheBlockTouchObserver<cache::NamespaceCache>("Namespace", expiryReceiptType));
+					.add(observers::CreateCacheBlockTouchObserver<cache::NamespaceCache>("Namespace", expiryReceiptType))
+					// note that these need to run after all namespace state changing observers
+					.add(observers::CreateResolutionCacheInvalidationObserver<model::RootNamespaceNotification>("RootNamespace"))
+					.add(observers::CreateResolutionCacheInvalidationObserver<model::ChildNamespaceNotification>("ChildNamespace"))
+					.add(observers::CreateResolutionCacheInvalidationObserver<model::BlockNotification>("NamespaceTouch"));
 			});
 		}
 
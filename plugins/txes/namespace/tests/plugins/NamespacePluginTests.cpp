@@ -87,7 +87,7 @@ namespace bitxorcore { namespace plugins {
 			}
 
 			static std::vector<ionet::PacketType> GetNonDiagnosticPacketTypes() {
-				return { ionet::PacketType::Namespace_State_Path };
+				return { ionet::PacketType::Namespace_State_Path, ionet::PacketType::Namespace_State_Paths };
 			}
 
 			static std::vector<ionet::PacketType> GetDiagnosticPacketTypes() {
@@ -95,7 +95,7 @@ namespace bitxorcore { namespace plugins {
 			}
 
 			static std::vector<std::string> GetDiagnosticCounterNames() {
-				return { "NS C", "NS C AS", "NS C DS" };
+				return { "NS C", "NS C AS", "NS C DS", "NS RES HIT", "NS RES MISS", "NS RES INV" };
 			}
 
 			static std::vector<std::string> GetStatelessValidatorNames() {
@@ -129,8 +129,13 @@ namespace bitxorcore { namespace plugins {
 					"NamespaceRentalFeeObserver",
 					"NamespaceGracePeriodTouchObserver",
 					"NamespaceTouchObserver",
+					"RootNamespaceResolutionCacheInvalidationObserver",
+					"ChildNamespaceResolutionCacheInvalidationObserver",
+					"NamespaceTouchResolutionCacheInvalidationObserver",
 					"AliasedAddressObserver",
-					"AliasedTokenIdObserver"
+					"AliasedTokenIdObserver",
+					"AliasedAddressResolutionCacheInvalidationObserver",
+					"AliasedTokenIdResolutionCacheInvalidationObserver"
 				};
 			}
 
@@ -62,7 +62,7 @@ namespace bitxorcore { namespace plugins {
 			}
 
 			static std::vector<ionet::PacketType> GetNonDiagnosticPacketTypes() {
-				return { ionet::PacketType::Token_Restrictions_State_Path };
+				return { ionet::PacketType::Token_Restrictions_State_Path, ionet::PacketType::Token_Restrictions_State_Paths };
 			}
 
 			static std::vector<ionet::PacketType> GetDiagnosticPacketTypes() {
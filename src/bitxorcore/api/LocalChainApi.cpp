@@ -44,7 +44,7 @@ namespace bitxorcore { namespace api {
 		public:
 			thread::future<ChainStatistics> chainStatistics() const override {
 				auto chainStatistics = ChainStatistics();
-				chainStatistics.Height = m_storage.view().chainHeight();
+				chainStatistics.Height = m_storage.chainHeight();
 				chainStatistics.FinalizedHeight = m_finalizedHeightSupplier();
 				chainStatistics.Score = m_chainScoreSupplier();
 				return thread::make_ready_future(std::move(chainStatistics));
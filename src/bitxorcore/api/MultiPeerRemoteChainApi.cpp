@@ -0,0 +1,246 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MultiPeerRemoteChainApi.h"
+#include "bitxorcore/model/EntityHasher.h"
+#include "bitxorcore/thread/FutureUtils.h"
+#include "bitxorcore/utils/Logging.h"
+#include <atomic>
+
+namespace bitxorcore { namespace api {
+
+	namespace {
+		struct ChainTip {
+			bitxorcore::Height Height;
+			Hash256 Hash;
+		};
+
+		bool TryExtend(ChainTip& tip, const model::BlockRange& range, const model::HashRange& expectedHashes) {
+			// every block must be vouched for by the primary api
+			if (range.size() > expectedHashes.size())
+				return false;
+
+			auto newTip = tip;
+			auto expectedHashIter = expectedHashes.cbegin();
+			for (const auto& block : range) {
+				if (newTip.Height + Height(1) != block.Height || newTip.Hash != block.PreviousBlockHash)
+					return false;
+
+				newTip = { block.Height, model::CalculateHash(block) };
+				if (*expectedHashIter++ != newTip.Hash)
+					return false;
+			}
+
+			tip = newTip;
+			return true;
+		}
+
+		// region BlockRangeReassembler
+
+		// holds all state accessed by blocks-from continuations, which can outlive the owning api
+		class BlockRangeReassembler {
+		public:
+			BlockRangeReassembler(
+					std::vector<model::NodeIdentity>&& identities,
+					const consumer<const ionet::NodeInteractionResult&>& secondaryInteractionConsumer)
+					: m_identities(std::move(identities))
+					, m_secondaryInteractionConsumer(secondaryInteractionConsumer)
+					, m_numBlocksPerPeer(0)
+			{}
+
+		public:
+			uint32_t numBlocksPerPeer(uint32_t maxNumBlocks) const {
+				// every peer is asked for the same number of blocks, which is adjusted to the size of the last primary response
+				// so that the ranges requested from the other peers start where the preceding range is expected to end
+				auto numBlocksPerPeer = m_numBlocksPerPeer.load();
+				return 0 == numBlocksPerPeer || numBlocksPerPeer > maxNumBlocks ? maxNumBlocks : numBlocksPerPeer;
+			}
+
+			model::BlockRange reassemble(
+					std::vector<thread::future<model::BlockRange>>&& rangeFutures,
+					std::vector<thread::future<model::HashRange>>&& hashRangeFutures,
+					Height height,
+					uint32_t numBlocksPerPeer,
+					uint32_t maxNumBlocks) {
+				// propagate primary failures, which are attributed to the remote node
+				auto primaryRange = rangeFutures[0].get();
+				if (primaryRange.empty())
+					return primaryRange;
+
+				// grow back to the requested number of blocks after a full response, otherwise follow the primary response size
+				auto numPrimaryBlocks = static_cast<uint32_t>(primaryRange.size());
+				m_numBlocksPerPeer = numBlocksPerPeer == numPrimaryBlocks ? maxNumBlocks : numPrimaryBlocks;
+
+				auto lastPrimaryBlockIter = --primaryRange.cend();
+				auto tip = ChainTip{ lastPrimaryBlockIter->Height, model::CalculateHash(*lastPrimaryBlockIter) };
+
+				std::vector<model::BlockRange> ranges;
+				ranges.push_back(std::move(primaryRange));
+				auto isLinked = true;
+				for (auto i = 1u; i < rangeFutures.size(); ++i) {
+					auto code = ionet::NodeInteractionResultCode::Neutral;
+					try {
+						auto range = rangeFutures[i].get();
+						if (isLinked && tryExtend(tip, range, hashRangeFutures[i - 1], i)) {
+							ranges.push_back(std::move(range));
+							code = ionet::NodeInteractionResultCode::Success;
+						}
+					} catch (const bitxorcore_runtime_error& e) {
+						BITXORCORE_LOG(warning) << "exception thrown while requesting blocks from " << m_identities[i] << ": " << e.what();
+						code = ionet::NodeInteractionResultCode::Failure;
+					}
+
+					// blocks following a discarded range can't be linked
+					isLinked = ionet::NodeInteractionResultCode::Success == code;
+					m_secondaryInteractionConsumer(ionet::NodeInteractionResult(m_identities[i], code));
+				}
+
+				BITXORCORE_LOG(debug)
+						<< "downloaded blocks (heights " << height << " - " << tip.Height << ") from "
+						<< ranges.size() << " of " << rangeFutures.size() << " peers";
+				return model::BlockRange::MergeRanges(std::move(ranges));
+			}
+
+		private:
+			bool tryExtend(ChainTip& tip, const model::BlockRange& range, thread::future<model::HashRange>& hashRangeFuture, size_t index) {
+				model::HashRange expectedHashes;
+				try {
+					expectedHashes = hashRangeFuture.get();
+				} catch (const bitxorcore_runtime_error& e) {
+					BITXORCORE_LOG(warning) << "exception thrown while requesting hashes from " << m_identities[0] << ": " << e.what();
+					return false;
+				}
+
+				// blocks that are not vouched for by the primary might be from another fork, so they are discarded without blame
+				if (range.empty() || !TryExtend(tip, range, expectedHashes)) {
+					BITXORCORE_LOG(debug)
+							<< "discarding blocks from " << m_identities[index] << " that do not extend height " << tip.Height;
+					return false;
+				}
+
+				return true;
+			}
+
+		private:
+			std::vector<model::NodeIdentity> m_identities;
+			consumer<const ionet::NodeInteractionResult&> m_secondaryInteractionConsumer;
+			std::atomic<uint32_t> m_numBlocksPerPeer;
+		};
+
+		// endregion
+
+		// region MultiPeerRemoteChainApi
+
+		std::vector<model::NodeIdentity> GetIdentities(const std::vector<std::unique_ptr<RemoteChainApi>>& remoteApis) {
+			std::vector<model::NodeIdentity> identities;
+			for (const auto& pRemoteApi : remoteApis)
+				identities.push_back(pRemoteApi->remoteIdentity());
+
+			return identities;
+		}
+
+		class MultiPeerRemoteChainApi : public RemoteChainApi {
+		public:
+			MultiPeerRemoteChainApi(
+					std::vector<std::unique_ptr<RemoteChainApi>>&& remoteApis,
+					const consumer<const ionet::NodeInteractionResult&>& secondaryInteractionConsumer)
+					: RemoteChainApi(remoteApis[0]->remoteIdentity())
+					, m_remoteApis(std::move(remoteApis))
+					, m_pReassembler(std::make_shared<BlockRangeReassembler>(GetIdentities(m_remoteApis), secondaryInteractionConsumer))
+			{}
+
+		public:
+			thread::future<ChainStatistics> chainStatistics() const override {
+				return primary().chainStatistics();
+			}
+
+			thread::future<model::HashRange> hashesFrom(Height height, uint32_t maxHashes) const override {
+				return primary().hashesFrom(height, maxHashes);
+			}
+
+			thread::future<std::shared_ptr<const model::Block>> blockLast() const override {
+				return primary().blockLast();
+			}
+
+			thread::future<std::shared_ptr<const model::Block>> blockAt(Height height) const override {
+				return primary().blockAt(height);
+			}
+
+			thread::future<model::BlockRange> blocksFrom(Height height, const BlocksFromOptions& options) const override {
+				if (1 == m_remoteApis.size())
+					return primary().blocksFrom(height, options);
+
+				auto numBlocksPerPeer = m_pReassembler->numBlocksPerPeer(options.NumBlocks);
+				auto numPeers = static_cast<uint32_t>(m_remoteApis.size());
+				auto peerOptions = BlocksFromOptions(numBlocksPerPeer, std::max<uint32_t>(1, options.NumBytes / numPeers));
+
+				// the primary is additionally asked for the hashes of all blocks requested from the other peers
+				std::vector<thread::future<model::BlockRange>> rangeFutures;
+				auto pHashRangeFutures = std::make_shared<std::vector<thread::future<model::HashRange>>>();
+				for (auto i = 0u; i < numPeers; ++i) {
+					auto peerHeight = height + Height(i * numBlocksPerPeer);
+					rangeFutures.push_back(m_remoteApis[i]->blocksFrom(peerHeight, peerOptions));
+					if (0 != i)
+						pHashRangeFutures->push_back(primary().hashesFrom(peerHeight, numBlocksPerPeer));
+				}
+
+				auto pReassembler = m_pReassembler;
+				auto maxNumBlocks = options.NumBlocks;
+				auto reassemble = [pReassembler, height, numBlocksPerPeer, maxNumBlocks](auto&& completedFutures, auto&& hashFutures) {
+					return pReassembler->reassemble(
+							std::move(completedFutures),
+							std::move(hashFutures),
+							height,
+							numBlocksPerPeer,
+							maxNumBlocks);
+				};
+
+				return thread::compose(thread::when_all(std::move(rangeFutures)), [pHashRangeFutures, reassemble](auto&& rangesFuture) {
+					auto pRangeFutures = std::make_shared<std::vector<thread::future<model::BlockRange>>>(rangesFuture.get());
+					return thread::when_all(std::move(*pHashRangeFutures)).then([pRangeFutures, reassemble](auto&& hashRangesFuture) {
+						return reassemble(std::move(*pRangeFutures), hashRangesFuture.get());
+					});
+				});
+			}
+
+		private:
+			const RemoteChainApi& primary() const {
+				return *m_remoteApis[0];
+			}
+
+		private:
+			std::vector<std::unique_ptr<RemoteChainApi>> m_remoteApis;
+			std::shared_ptr<BlockRangeReassembler> m_pReassembler;
+		};
+
+		// endregion
+	}
+
+	std::unique_ptr<RemoteChainApi> CreateMultiPeerRemoteChainApi(
+			std::vector<std::unique_ptr<RemoteChainApi>>&& remoteApis,
+			const consumer<const ionet::NodeInteractionResult&>& secondaryInteractionConsumer) {
+		if (remoteApis.empty())
+			BITXORCORE_THROW_INVALID_ARGUMENT("at least one remote chain api is required");
+
+		return std::make_unique<MultiPeerRemoteChainApi>(std::move(remoteApis), secondaryInteractionConsumer);
+	}
+}}
@@ -0,0 +1,38 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "RemoteChainApi.h"
+#include "bitxorcore/ionet/NodeInteractionResult.h"
+#include <vector>
+
+namespace bitxorcore { namespace api {
+
+	/// Creates a chain api around multiple remote chain apis (\a remoteApis) that downloads disjoint block ranges from all of them
+	/// in parallel. The first api is the primary api that is used for all other requests and identifies the remote node.
+	/// Interaction results with all other (secondary) apis are forwarded to \a secondaryInteractionConsumer.
+	/// \note Blocks returned by secondary apis are only kept when they extend the preceding range (by height and hash linkage)
+	///       and their hashes match the hashes returned by the primary api, so that the primary api vouches for all blocks.
+	std::unique_ptr<RemoteChainApi> CreateMultiPeerRemoteChainApi(
+			std::vector<std::unique_ptr<RemoteChainApi>>&& remoteApis,
+			const consumer<const ionet::NodeInteractionResult&>& secondaryInteractionConsumer);
+}}
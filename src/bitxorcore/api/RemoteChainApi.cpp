@@ -25,6 +25,7 @@
 #include "RemoteApiUtils.h"
 #include "RemoteRequestDispatcher.h"
 #include "bitxorcore/ionet/PacketEntityUtils.h"
+#include <chrono>
 
 namespace bitxorcore { namespace api {
 
@@ -120,6 +121,19 @@ namespace bitxorcore { namespace api {
 
 		// endregion
 
+		// region response sizes
+
+		template<typename TResult>
+		uint64_t GetResponseSize(const TResult&) {
+			return 0;
+		}
+
+		uint64_t GetResponseSize(const model::BlockRange& range) {
+			return range.totalSize();
+		}
+
+		// endregion
+
 		class DefaultRemoteChainApi : public RemoteChainApi {
 		private:
 			template<typename TTraits>
@@ -129,48 +143,77 @@ namespace bitxorcore { namespace api {
 			DefaultRemoteChainApi(
 					ionet::PacketIo& io,
 					const model::NodeIdentity& remoteIdentity,
-					const model::TransactionRegistry* pRegistry)
+					const model::TransactionRegistry* pRegistry,
+					const RemoteRequestObserver& requestObserver)
 					: RemoteChainApi(remoteIdentity)
 					, m_pRegistry(pRegistry)
+					, m_requestObserver(requestObserver)
 					, m_impl(io)
 			{}
 
 		public:
 			FutureType<ChainStatisticsTraits> chainStatistics() const override {
-				return m_impl.dispatch(ChainStatisticsTraits());
+				return dispatch(ChainStatisticsTraits());
 			}
 
 			FutureType<HashesFromTraits> hashesFrom(Height height, uint32_t maxHashes) const override {
-				return m_impl.dispatch(HashesFromTraits(), height, maxHashes);
+				return dispatch(HashesFromTraits(), height, maxHashes);
 			}
 
 			FutureType<BlockAtTraits> blockLast() const override {
-				return m_impl.dispatch(BlockAtTraits(*m_pRegistry), Height(0));
+				return dispatch(BlockAtTraits(*m_pRegistry), Height(0));
 			}
 
 			FutureType<BlockAtTraits> blockAt(Height height) const override {
-				return m_impl.dispatch(BlockAtTraits(*m_pRegistry), height);
+				return dispatch(BlockAtTraits(*m_pRegistry), height);
 			}
 
 			FutureType<BlocksFromTraits> blocksFrom(Height height, const BlocksFromOptions& options) const override {
-				return m_impl.dispatch(BlocksFromTraits(*m_pRegistry), height, options);
+				return dispatch(BlocksFromTraits(*m_pRegistry), height, options);
+			}
+
+		private:
+			template<typename TTraits, typename... TArgs>
+			FutureType<TTraits> dispatch(const TTraits& traits, TArgs&&... args) const {
+				if (!m_requestObserver)
+					return m_impl.dispatch(traits, std::forward<TArgs>(args)...);
+
+				auto startTime = std::chrono::steady_clock::now();
+				auto future = m_impl.dispatch(traits, std::forward<TArgs>(args)...);
+				return future.then([requestObserver = m_requestObserver, remoteIdentity = remoteIdentity(), startTime](
+						auto&& resultFuture) {
+					auto result = resultFuture.get();
+					auto elapsedTime = std::chrono::steady_clock::now() - startTime;
+					auto elapsedMicros = std::chrono::duration_cast<std::chrono::microseconds>(elapsedTime).count();
+					requestObserver(remoteIdentity, { static_cast<uint64_t>(elapsedMicros), GetResponseSize(result) });
+					return result;
+				});
 			}
 
 		private:
 			const model::TransactionRegistry* m_pRegistry;
+			RemoteRequestObserver m_requestObserver;
 			mutable RemoteRequestDispatcher m_impl;
 		};
 	}
 
 	std::unique_ptr<ChainApi> CreateRemoteChainApiWithoutRegistry(ionet::PacketIo& io) {
 		// since the returned interface is only chain-api, the remote identity and the registry are unused
-		return std::make_unique<DefaultRemoteChainApi>(io, model::NodeIdentity(), nullptr);
+		return std::make_unique<DefaultRemoteChainApi>(io, model::NodeIdentity(), nullptr, RemoteRequestObserver());
 	}
 
 	std::unique_ptr<RemoteChainApi> CreateRemoteChainApi(
 			ionet::PacketIo& io,
 			const model::NodeIdentity& remoteIdentity,
 			const model::TransactionRegistry& registry) {
-		return std::make_unique<DefaultRemoteChainApi>(io, remoteIdentity, &registry);
+		return std::make_unique<DefaultRemoteChainApi>(io, remoteIdentity, &registry, RemoteRequestObserver());
+	}
+
+	std::unique_ptr<RemoteChainApi> CreateMeasuredRemoteChainApi(
+			ionet::PacketIo& io,
+			const model::NodeIdentity& remoteIdentity,
+			const model::TransactionRegistry& registry,
+			const RemoteRequestObserver& requestObserver) {
+		return std::make_unique<DefaultRemoteChainApi>(io, remoteIdentity, &registry, requestObserver);
 	}
 }}
@@ -23,6 +23,7 @@
 #pragma once
 #include "ChainApi.h"
 #include "RemoteApi.h"
+#include "bitxorcore/functions.h"
 
 namespace bitxorcore {
 	namespace ionet { class PacketIo; }
@@ -51,6 +52,18 @@ namespace bitxorcore { namespace api {
 		uint32_t NumBytes;
 	};
 
+	/// Measurement of a successfully completed remote request.
+	struct RemoteRequestMeasurement {
+		/// Time elapsed between issuing the request and parsing the response (in microseconds).
+		uint64_t ElapsedMicros;
+
+		/// Size of the response entities (in bytes) or \c 0 when the response is small and latency dominated.
+		uint64_t NumBytes;
+	};
+
+	/// Observer that is notified about each remote request measurement and the identity of the node that was measured.
+	using RemoteRequestObserver = consumer<const model::NodeIdentity&, const RemoteRequestMeasurement&>;
+
 	/// Api for retrieving chain statistics from a remote node.
 	class RemoteChainApi : public RemoteApi, public ChainApi {
 	protected:
@@ -79,4 +92,13 @@ namespace bitxorcore { namespace api {
 			ionet::PacketIo& io,
 			const model::NodeIdentity& remoteIdentity,
 			const model::TransactionRegistry& registry);
+
+	/// Creates a chain api for interacting with a remote node with the specified \a io and \a remoteIdentity
+	/// given transaction \a registry composed of supported transactions and an observer (\a requestObserver)
+	/// that is notified about the measurements of all successful requests.
+	std::unique_ptr<RemoteChainApi> CreateMeasuredRemoteChainApi(
+			ionet::PacketIo& io,
+			const model::NodeIdentity& remoteIdentity,
+			const model::TransactionRegistry& registry,
+			const RemoteRequestObserver& requestObserver);
 }}
@@ -57,6 +57,27 @@ namespace bitxorcore { namespace api {
 			}
 		};
 
+		struct AnnouncedUtTraits : public RegistryDependentTraits<model::Transaction> {
+		public:
+			using ResultType = model::TransactionRange;
+			static constexpr auto Packet_Type = ionet::PacketType::Pull_Announced_Transactions;
+			static constexpr auto Friendly_Name = "pull announced transactions";
+
+			static auto CreateRequestPacketPayload(model::ShortHashRange&& announcedShortHashes) {
+				ionet::PacketPayloadBuilder builder(Packet_Type);
+				builder.appendRange(std::move(announcedShortHashes));
+				return builder.build();
+			}
+
+		public:
+			using RegistryDependentTraits::RegistryDependentTraits;
+
+			bool tryParseResult(const ionet::Packet& packet, ResultType& result) const {
+				result = ionet::ExtractEntitiesFromPacket<model::Transaction>(packet, *this);
+				return !result.empty() || sizeof(ionet::PacketHeader) == packet.Size;
+			}
+		};
+
 		// endregion
 
 		class DefaultRemoteTransactionApi : public RemoteTransactionApi {
@@ -82,6 +103,10 @@ namespace bitxorcore { namespace api {
 				return m_impl.dispatch(UtTraits(m_registry), minDeadline, minFeeMultiplier, std::move(knownShortHashes));
 			}
 
+			FutureType<AnnouncedUtTraits> announcedTransactions(model::ShortHashRange&& announcedShortHashes) const override {
+				return m_impl.dispatch(AnnouncedUtTraits(m_registry), std::move(announcedShortHashes));
+			}
+
 		private:
 			const model::TransactionRegistry& m_registry;
 			mutable RemoteRequestDispatcher m_impl;
@@ -43,6 +43,9 @@ namespace bitxorcore { namespace api {
 				Timestamp minDeadline,
 				BlockFeeMultiplier minFeeMultiplier,
 				model::ShortHashRange&& knownShortHashes) const = 0;
+
+		/// Gets the unconfirmed transactions from the remote that have a short hash in \a announcedShortHashes.
+		virtual thread::future<model::TransactionRange> announcedTransactions(model::ShortHashRange&& announcedShortHashes) const = 0;
 	};
 
 	/// Creates a transaction api for interacting with a remote node with the specified \a io and \a remoteIdentity
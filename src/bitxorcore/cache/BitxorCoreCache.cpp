@@ -25,15 +25,21 @@
 #include "BitxorCoreCacheDetachedDelta.h"
 #include "ReadOnlyBitxorCoreCache.h"
 #include "SubCachePluginAdapter.h"
+#include "bitxorcore/cache_db/SharedRocksDatabase.h"
 #include "bitxorcore/crypto/Hashes.h"
 #include "bitxorcore/model/BlockchainConfiguration.h"
 #include "bitxorcore/model/NetworkIdentifier.h"
 #include "bitxorcore/state/BitxorCoreState.h"
+#include "bitxorcore/thread/IoThreadPool.h"
+#include "bitxorcore/thread/ParallelFor.h"
 #include "bitxorcore/utils/StackLogger.h"
+#include "bitxorcore/utils/TraceRecorder.h"
 
 namespace bitxorcore { namespace cache {
 
 	namespace {
+		constexpr auto Trace_Category = "cache";
+
 		template<typename TSubCacheViews>
 		std::vector<const void*> ExtractReadOnlyViews(const TSubCacheViews& subViews) {
 			std::vector<const void*> readOnlyViews;
@@ -156,6 +162,7 @@ namespace bitxorcore { namespace cache {
 	}
 
 	StateHashInfo BitxorCoreCacheDelta::calculateStateHash(Height height) const {
+		utils::TraceSpan span(Trace_Category, "calculate state hash", height, utils::ShortHash());
 		return CalculateStateHashInfo(m_subViews, [height](auto& subView) { subView.updateMerkleRoot(height); });
 	}
 
@@ -180,6 +187,10 @@ namespace bitxorcore { namespace cache {
 		}
 	}
 
+	bool BitxorCoreCacheDelta::hasChanges(size_t cacheId) const {
+		return cacheId < m_subViews.size() && m_subViews[cacheId] && m_subViews[cacheId]->hasChanges();
+	}
+
 	void BitxorCoreCacheDelta::prune(Height height) {
 		for (const auto& pSubView : m_subViews) {
 			if (!pSubView)
@@ -282,12 +293,71 @@ namespace bitxorcore { namespace cache {
 		}
 	}
 
-	BitxorCoreCache::BitxorCoreCache(std::vector<std::unique_ptr<SubCachePlugin>>&& subCaches)
+	namespace {
+		void CommitSubCachesSequential(const std::vector<std::unique_ptr<SubCachePlugin>>& subCaches) {
+			for (const auto& pSubCache : subCaches) {
+				if (pSubCache)
+					pSubCache->commit();
+			}
+		}
+
+		std::vector<SubCachePlugin*> GetSubCaches(const std::vector<std::unique_ptr<SubCachePlugin>>& subCaches) {
+			std::vector<SubCachePlugin*> nonNullSubCaches;
+			for (const auto& pSubCache : subCaches) {
+				if (pSubCache)
+					nonNullSubCaches.push_back(pSubCache.get());
+			}
+
+			return nonNullSubCaches;
+		}
+
+		std::unique_ptr<thread::IoThreadPool> CreateCommitPool(const std::vector<std::unique_ptr<SubCachePlugin>>& subCaches) {
+			// create one (long-lived) worker per sub cache so that all sub caches can be committed concurrently
+			auto numWorkerThreads = std::max<size_t>(1, GetSubCaches(subCaches).size());
+			auto pPool = thread::CreateIoThreadPool(numWorkerThreads, "cache commit");
+			pPool->start();
+			return pPool;
+		}
+
+		void CommitSubCachesParallel(thread::IoThreadPool& pool, const std::vector<std::unique_ptr<SubCachePlugin>>& subCaches) {
+			// sub caches are independent, so the time spent holding the height lock is bounded by the slowest sub cache commit
+			auto nonNullSubCaches = GetSubCaches(subCaches);
+			if (nonNullSubCaches.empty())
+				return;
+
+			std::vector<std::exception_ptr> exceptions(nonNullSubCaches.size());
+			auto numPartitions = nonNullSubCaches.size();
+			thread::ParallelFor(pool.ioContext(), nonNullSubCaches, numPartitions, [&exceptions](auto* pSubCache, auto i) {
+				try {
+					utils::TraceSpan span(Trace_Category, "commit sub cache");
+					pSubCache->commit();
+				} catch (...) {
+					exceptions[i] = std::current_exception();
+				}
+
+				return true;
+			}).get();
+
+			for (const auto& pException : exceptions) {
+				if (pException)
+					std::rethrow_exception(pException);
+			}
+		}
+	}
+
+	BitxorCoreCache::BitxorCoreCache(
+			std::vector<std::unique_ptr<SubCachePlugin>>&& subCaches,
+			SubCacheCommitMode commitMode,
+			const std::shared_ptr<SharedRocksDatabase>& pSharedDatabase)
 			: m_pCacheHeight(std::make_unique<CacheHeight>())
 			, m_pDependentState(std::make_unique<state::BitxorCoreState>())
 			, m_pDependentStateDelta(std::make_unique<state::BitxorCoreState>())
 			, m_subCaches(std::move(subCaches))
-	{}
+			, m_commitMode(commitMode)
+			, m_pSharedDatabase(pSharedDatabase) {
+		if (SubCacheCommitMode::Parallel == m_commitMode)
+			m_pCommitPool = CreateCommitPool(m_subCaches);
+	}
 
 	BitxorCoreCache::~BitxorCoreCache() = default;
 
@@ -322,12 +392,27 @@ namespace bitxorcore { namespace cache {
 	}
 
 	void BitxorCoreCache::commit(Height height) {
+		utils::TraceSpan span(Trace_Category, "commit", height, utils::ShortHash());
+
 		// use the height writer lock to lock the entire cache during commit
-		auto cacheHeightModifier = m_pCacheHeight->modifier();
+		// (sub caches are committed under the lock because views read committed sub cache state directly)
+		auto cacheHeightModifier = [this]() {
+			utils::TraceSpan lockSpan(Trace_Category, "acquire height lock");
+			return m_pCacheHeight->modifier();
+		}();
+
+		{
+			utils::TraceSpan subCachesSpan(Trace_Category, "commit sub caches");
+			if (SubCacheCommitMode::Parallel == m_commitMode)
+				CommitSubCachesParallel(*m_pCommitPool, m_subCaches);
+			else
+				CommitSubCachesSequential(m_subCaches);
+		}
 
-		for (const auto& pSubCache : m_subCaches) {
-			if (pSubCache)
-				pSubCache->commit();
+		// sub caches hosted by a shared database only stage their changes, so write all of them atomically
+		if (m_pSharedDatabase) {
+			utils::TraceSpan databaseSpan(Trace_Category, "commit shared database");
+			m_pSharedDatabase->commit();
 		}
 
 		// finally, update the dependent state and cache height
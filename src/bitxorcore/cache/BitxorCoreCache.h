@@ -31,18 +31,33 @@ namespace bitxorcore {
 		class CacheChangesStorage;
 		class CacheHeight;
 		class CacheStorage;
+		class SharedRocksDatabase;
 		class SubCachePlugin;
 	}
 	namespace model { struct BlockchainConfiguration; }
+	namespace thread { class IoThreadPool; }
 }
 
 namespace bitxorcore { namespace cache {
 
+	/// Modes for committing sub caches.
+	enum class SubCacheCommitMode {
+		/// Sub caches are committed one after another on the calling thread.
+		Sequential,
+
+		/// Sub caches are committed concurrently on dedicated threads owned by the cache.
+		Parallel
+	};
+
 	/// Central cache holding all sub caches.
 	class BitxorCoreCache {
 	public:
-		/// Creates a bitxorcore cache around \a subCaches.
-		explicit BitxorCoreCache(std::vector<std::unique_ptr<SubCachePlugin>>&& subCaches);
+		/// Creates a bitxorcore cache around \a subCaches using \a commitMode when committing.
+		/// When specified, \a pSharedDatabase is committed after all sub caches are committed.
+		explicit BitxorCoreCache(
+				std::vector<std::unique_ptr<SubCachePlugin>>&& subCaches,
+				SubCacheCommitMode commitMode = SubCacheCommitMode::Sequential,
+				const std::shared_ptr<SharedRocksDatabase>& pSharedDatabase = nullptr);
 
 		/// Destroys the cache.
 		~BitxorCoreCache();
@@ -72,6 +87,7 @@ namespace bitxorcore { namespace cache {
 		BitxorCoreCacheDetachableDelta createDetachableDelta() const;
 
 		/// Commits all pending changes to the underlying storage and sets the cache height to \a height.
+		/// \note In parallel mode, all sub caches are committed (even if some fail) before the first failure is rethrown.
 		void commit(Height height);
 
 	public:
@@ -89,5 +105,8 @@ namespace bitxorcore { namespace cache {
 		std::unique_ptr<state::BitxorCoreState> m_pDependentState; // use a unique_ptr to allow fwd declare
 		std::unique_ptr<state::BitxorCoreState> m_pDependentStateDelta; // backing for (single) outstanding delta
 		std::vector<std::unique_ptr<SubCachePlugin>> m_subCaches;
+		SubCacheCommitMode m_commitMode;
+		std::shared_ptr<SharedRocksDatabase> m_pSharedDatabase;
+		std::unique_ptr<thread::IoThreadPool> m_pCommitPool; // only created in parallel commit mode
 	};
 }}
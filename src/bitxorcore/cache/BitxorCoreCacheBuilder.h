@@ -47,10 +47,15 @@ namespace bitxorcore { namespace cache {
 		}
 
 	public:
-		/// Builds a bitxorcore cache.
-		BitxorCoreCache build() {
-			BITXORCORE_LOG(debug) << "creating BitxorCoreCache with " << m_subCaches.size() << " sub caches";
-			return BitxorCoreCache(std::move(m_subCaches));
+		/// Builds a bitxorcore cache that commits sub caches using \a commitMode and optional shared database (\a pSharedDatabase).
+		BitxorCoreCache build(
+				SubCacheCommitMode commitMode = SubCacheCommitMode::Sequential,
+				const std::shared_ptr<SharedRocksDatabase>& pSharedDatabase = nullptr) {
+			BITXORCORE_LOG(debug)
+					<< "creating BitxorCoreCache with " << m_subCaches.size() << " sub caches ("
+					<< (SubCacheCommitMode::Parallel == commitMode ? "parallel" : "sequential") << " commit"
+					<< (pSharedDatabase ? ", shared database" : "") << ")";
+			return BitxorCoreCache(std::move(m_subCaches), commitMode, pSharedDatabase);
 		}
 
 	private:
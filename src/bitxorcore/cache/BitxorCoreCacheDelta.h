@@ -88,6 +88,9 @@ namespace bitxorcore { namespace cache {
 		/// Sets the merkle roots for all sub caches (\a subCacheMerkleRoots).
 		void setSubCacheMerkleRoots(const std::vector<Hash256>& subCacheMerkleRoots);
 
+		/// Returns \c true if the sub cache with id \a cacheId is registered and might contain uncommitted changes.
+		bool hasChanges(size_t cacheId) const;
+
 		/// Prunes the cache at \a height.
 		void prune(Height height);
 
@@ -23,8 +23,11 @@
 #pragma once
 #include "bitxorcore/config/NodeConfiguration.h"
 #include "bitxorcore/utils/FileSize.h"
+#include <memory>
 #include <string>
 
+namespace bitxorcore { namespace cache { class SharedRocksDatabase; } }
+
 namespace bitxorcore { namespace cache {
 
 	/// Possible patricia tree storage modes.
@@ -73,5 +76,8 @@ namespace bitxorcore { namespace cache {
 
 		/// \c true if patricia trees should be stored, \c false otherwise.
 		bool ShouldStorePatriciaTrees;
+
+		/// Shared database that should host the cache database (optional).
+		std::shared_ptr<SharedRocksDatabase> SharedDatabase;
 	};
 }}
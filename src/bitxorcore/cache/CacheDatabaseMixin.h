@@ -41,10 +41,12 @@ namespace bitxorcore { namespace cache {
 								config.CacheDatabaseDirectory,
 								config.CacheDatabaseConfig,
 								GetAdjustedColumnFamilyNames(config, columnFamilyNames),
-								pruningMode))
+								pruningMode,
+								config.SharedDatabase))
 						: std::make_unique<CacheDatabase>())
 				, m_containerMode(GetContainerMode(config))
 				, m_hasPatriciaTreeSupport(config.ShouldStorePatriciaTrees)
+				, m_patriciaTreeNodeCacheSize(config.ShouldStorePatriciaTrees ? config.CacheDatabaseConfig.PatriciaTreeNodeCacheSize : 0)
 		{}
 
 	protected:
@@ -53,6 +55,11 @@ namespace bitxorcore { namespace cache {
 			return m_hasPatriciaTreeSupport;
 		}
 
+		/// Gets the maximum number of decoded patricia tree branch nodes that should be cached.
+		size_t patriciaTreeNodeCacheSize() const {
+			return m_patriciaTreeNodeCacheSize;
+		}
+
 		/// Gets the database.
 		CacheDatabase& database() {
 			return *m_pDatabase;
@@ -87,5 +94,6 @@ namespace bitxorcore { namespace cache {
 		std::unique_ptr<CacheDatabase> m_pDatabase;
 		const deltaset::ConditionalContainerMode m_containerMode;
 		const bool m_hasPatriciaTreeSupport;
+		const size_t m_patriciaTreeNodeCacheSize;
 	};
 }}
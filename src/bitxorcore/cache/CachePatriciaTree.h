@@ -33,7 +33,13 @@ namespace bitxorcore { namespace cache {
 	public:
 		/// Creates a tree around \a database and \a columnId if \a enable is \c true.
 		CachePatriciaTree(bool enable, CacheDatabase& database, size_t columnId)
-				: m_pImpl(enable ? std::make_unique<Impl>(database, columnId) : nullptr)
+				: CachePatriciaTree(enable, database, columnId, 0)
+		{}
+
+		/// Creates a tree around \a database and \a columnId if \a enable is \c true
+		/// that caches at most \a maxCachedNodes decoded branch nodes (in addition to pinned top level nodes).
+		CachePatriciaTree(bool enable, CacheDatabase& database, size_t columnId, size_t maxCachedNodes)
+				: m_pImpl(enable ? std::make_unique<Impl>(database, columnId, maxCachedNodes) : nullptr)
 		{}
 
 	public:
@@ -42,6 +48,11 @@ namespace bitxorcore { namespace cache {
 			return m_pImpl ? &m_pImpl->tree() : nullptr;
 		}
 
+		/// Gets a pointer to the decoded node cache if enabled.
+		const PatriciaTreeNodeCache* nodeCache() const {
+			return m_pImpl ? m_pImpl->nodeCache() : nullptr;
+		}
+
 	public:
 		/// Gets a delta based on the same data source as this tree.
 		auto rebase() {
@@ -62,10 +73,14 @@ namespace bitxorcore { namespace cache {
 
 	private:
 		class Impl {
+		private:
+			// root, its children and grandchildren (at most 273 branch nodes) are pinned
+			static constexpr size_t Num_Pinned_Levels = 3;
+
 		public:
-			Impl(CacheDatabase& database, size_t columnId)
+			Impl(CacheDatabase& database, size_t columnId, size_t maxCachedNodes)
 					: m_container(database, columnId)
-					, m_dataSource(m_container)
+					, m_dataSource(m_container, maxCachedNodes, Num_Pinned_Levels)
 					, m_pTree(std::make_unique<TTree>(m_dataSource)) {
 				Hash256 rootHash;
 				if (!m_container.prop("root", rootHash))
@@ -75,6 +90,7 @@ namespace bitxorcore { namespace cache {
 					return;
 
 				m_pTree = std::make_unique<TTree>(m_dataSource, rootHash);
+				m_dataSource.pin(rootHash);
 			}
 
 		public:
@@ -86,15 +102,20 @@ namespace bitxorcore { namespace cache {
 				return *m_pTree;
 			}
 
+			const auto* nodeCache() const {
+				return m_dataSource.nodeCache();
+			}
+
 		public:
 			void commit() {
 				m_pTree->commit();
 
-				// skip setProp if hash did not change
+				// skip pin and setProp if hash did not change
 				Hash256 rootHash;
 				if (m_container.prop("root", rootHash) && rootHash == m_pTree->root())
 					return;
 
+				m_dataSource.pin(m_pTree->root());
 				m_container.setProp("root", m_pTree->root());
 			}
 
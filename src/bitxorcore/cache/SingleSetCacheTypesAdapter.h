@@ -103,7 +103,7 @@ namespace bitxorcore { namespace cache {
 			explicit BaseSets(const CacheConfiguration& config)
 					: CacheDatabaseMixin(config, { "default" })
 					, Primary(GetContainerMode(config), database(), 0)
-					, PatriciaTree(hasPatriciaTreeSupport(), database(), 1)
+					, PatriciaTree(hasPatriciaTreeSupport(), database(), 1, patriciaTreeNodeCacheSize())
 			{}
 
 		public:
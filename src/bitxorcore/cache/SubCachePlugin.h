@@ -102,6 +102,9 @@ namespace bitxorcore { namespace cache {
 
 		/// Gets a read-only view of this view.
 		virtual const void* asReadOnly() const = 0;
+
+		/// Returns \c true if this view might contain uncommitted changes.
+		virtual bool hasChanges() const = 0;
 	};
 
 	/// Detached sub cache view.
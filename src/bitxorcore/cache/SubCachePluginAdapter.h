@@ -132,6 +132,12 @@ namespace bitxorcore { namespace cache {
 				return MerkleRootMutator<UnderlyingViewType>();
 			}
 
+			auto deltaElementsAccessor() const {
+				// need to dereference to get underlying view type from LockedCacheView
+				using UnderlyingViewType = std::remove_reference_t<decltype(*m_view)>;
+				return DeltaElementsAccessor<UnderlyingViewType>();
+			}
+
 			template<typename TPruneValue>
 			auto pruneMutator() {
 				// need to dereference to get underlying view type from LockedCacheView
@@ -180,6 +186,10 @@ namespace bitxorcore { namespace cache {
 				return &m_view->asReadOnly();
 			}
 
+			bool hasChanges() const override {
+				return HasChanges(m_view, m_id.ViewType, deltaElementsAccessor());
+			}
+
 		private:
 			enum class FeatureType { Unsupported, Supported };
 			using UnsupportedFeatureFlag = std::integral_constant<FeatureType, FeatureType::Unsupported>;
@@ -205,6 +215,16 @@ namespace bitxorcore { namespace cache {
 					: public SupportedFeatureFlag
 			{};
 
+			template<typename T, typename = void>
+			struct DeltaElementsAccessor : public UnsupportedFeatureFlag {};
+
+			template<typename T>
+			struct DeltaElementsAccessor<
+					T,
+					utils::traits::is_type_expression_t<decltype(reinterpret_cast<const T*>(1)->addedElements())>>
+					: public SupportedFeatureFlag
+			{};
+
 			template<typename TPruneValue, typename T, typename = void>
 			struct PruneMutator : public UnsupportedFeatureFlag {};
 
@@ -253,6 +273,15 @@ namespace bitxorcore { namespace cache {
 				view->updateMerkleRoot(height);
 			}
 
+			static bool HasChanges(const TView&, SubCacheViewType viewType, UnsupportedFeatureFlag) {
+				// deltas that do not track their changes are conservatively assumed to have changes
+				return SubCacheViewType::View != viewType;
+			}
+
+			static bool HasChanges(const TView& view, SubCacheViewType, SupportedFeatureFlag) {
+				return !view->addedElements().empty() || !view->modifiedElements().empty() || !view->removedElements().empty();
+			}
+
 			template<typename TPruneValue>
 			static void Prune(TView&, TPruneValue, UnsupportedFeatureFlag)
 			{}
@@ -56,7 +56,7 @@ namespace bitxorcore { namespace cache {
 				: CacheDatabaseMixin(config, { "default", "key_lookup" })
 				, Primary(GetContainerMode(config), database(), 0)
 				, KeyLookupMap(GetContainerMode(config), database(), 1)
-				, PatriciaTree(hasPatriciaTreeSupport(), database(), 2)
+				, PatriciaTree(hasPatriciaTreeSupport(), database(), 2, patriciaTreeNodeCacheSize())
 		{}
 
 	public:
@@ -0,0 +1,166 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PatriciaTreeNodeCache.h"
+
+namespace bitxorcore { namespace cache {
+
+	PatriciaTreeNodeCache::PatriciaTreeNodeCache(size_t maxNodes, size_t numPinnedLevels)
+			: m_maxNodes(maxNodes)
+			, m_numPinnedLevels(numPinnedLevels)
+			, m_generation(0)
+	{}
+
+	size_t PatriciaTreeNodeCache::size() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_entries.size();
+	}
+
+	size_t PatriciaTreeNodeCache::numPinnedNodes() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_pinnedHashes.size();
+	}
+
+	uint64_t PatriciaTreeNodeCache::generation() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_generation;
+	}
+
+	const PatriciaTreeNodeCacheStatistics& PatriciaTreeNodeCache::statistics() const {
+		return m_statistics;
+	}
+
+	tree::TreeNode PatriciaTreeNodeCache::find(const Hash256& hash) {
+		{
+			utils::SpinLockGuard guard(m_lock);
+			auto iter = m_entries.find(hash);
+			if (m_entries.end() != iter) {
+				touch(iter->second);
+				++m_statistics.NumHits;
+				return iter->second.Node.copy();
+			}
+		}
+
+		++m_statistics.NumMisses;
+		return tree::TreeNode();
+	}
+
+	void PatriciaTreeNodeCache::insert(const tree::BranchTreeNode& node) {
+		auto hash = node.hash();
+		auto cachedNode = tree::TreeNode(node);
+
+		utils::SpinLockGuard guard(m_lock);
+		auto iter = m_entries.find(hash);
+		if (m_entries.end() != iter) {
+			touch(iter->second);
+			return;
+		}
+
+		insertUnpinned(hash, std::move(cachedNode));
+		evict();
+	}
+
+	void PatriciaTreeNodeCache::pin(const Hash256& rootHash, const NodeLoader& nodeLoader) {
+		// collect all branch nodes in the top levels without holding the lock because uncached nodes need to be loaded
+		std::vector<tree::TreeNode> pinnedNodes;
+		std::vector<Hash256> levelHashes;
+		if (Hash256() != rootHash)
+			levelHashes.push_back(rootHash);
+
+		for (auto level = 0u; level < m_numPinnedLevels && !levelHashes.empty(); ++level) {
+			std::vector<Hash256> nextLevelHashes;
+			for (const auto& hash : levelHashes) {
+				tree::TreeNode node;
+				{
+					utils::SpinLockGuard guard(m_lock);
+					auto iter = m_entries.find(hash);
+					if (m_entries.end() != iter)
+						node = iter->second.Node.copy();
+				}
+
+				if (node.empty())
+					node = nodeLoader(hash);
+
+				if (!node.isBranch())
+					continue;
+
+				const auto& branchNode = node.asBranchNode();
+				for (auto i = 0u; i < tree::BranchTreeNode::Max_Links; ++i) {
+					if (branchNode.hasLink(i))
+						nextLevelHashes.push_back(branchNode.link(i));
+				}
+
+				pinnedNodes.push_back(std::move(node));
+			}
+
+			levelHashes = std::move(nextLevelHashes);
+		}
+
+		utils::SpinLockGuard guard(m_lock);
+
+		// nodes pinned by the previous generation that are not pinned again have been superseded, so evict them first
+		for (const auto& hash : m_pinnedHashes) {
+			auto& entry = m_entries.find(hash)->second;
+			entry.IsPinned = false;
+			entry.LruIter = m_lruHashes.insert(m_lruHashes.end(), hash);
+		}
+
+		m_pinnedHashes.clear();
+		for (auto& node : pinnedNodes) {
+			auto hash = node.hash();
+			auto iter = m_entries.find(hash);
+			if (m_entries.end() == iter) {
+				m_entries.emplace(hash, Entry{ std::move(node), true, m_lruHashes.end() });
+			} else {
+				if (iter->second.IsPinned)
+					continue;
+
+				m_lruHashes.erase(iter->second.LruIter);
+				iter->second.IsPinned = true;
+				iter->second.LruIter = m_lruHashes.end();
+			}
+
+			m_pinnedHashes.push_back(hash);
+		}
+
+		evict();
+		++m_generation;
+	}
+
+	void PatriciaTreeNodeCache::touch(Entry& entry) {
+		if (!entry.IsPinned)
+			m_lruHashes.splice(m_lruHashes.begin(), m_lruHashes, entry.LruIter);
+	}
+
+	void PatriciaTreeNodeCache::insertUnpinned(const Hash256& hash, tree::TreeNode&& node) {
+		m_lruHashes.push_front(hash);
+		m_entries.emplace(hash, Entry{ std::move(node), false, m_lruHashes.begin() });
+	}
+
+	void PatriciaTreeNodeCache::evict() {
+		while (m_lruHashes.size() > m_maxNodes) {
+			m_entries.erase(m_lruHashes.back());
+			m_lruHashes.pop_back();
+			++m_statistics.NumEvictions;
+		}
+	}
+}}
@@ -0,0 +1,118 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "bitxorcore/tree/TreeNode.h"
+#include "bitxorcore/utils/Hashers.h"
+#include "bitxorcore/utils/SpinLock.h"
+#include <atomic>
+#include <functional>
+#include <list>
+#include <unordered_map>
+
+namespace bitxorcore { namespace cache {
+
+	/// Patricia tree node cache statistics.
+	struct PatriciaTreeNodeCacheStatistics {
+	public:
+		/// Creates zeroed statistics.
+		PatriciaTreeNodeCacheStatistics()
+				: NumHits(0)
+				, NumMisses(0)
+				, NumEvictions(0)
+		{}
+
+	public:
+		/// Number of nodes served from the cache.
+		std::atomic<uint64_t> NumHits;
+
+		/// Number of nodes that were not found in the cache.
+		std::atomic<uint64_t> NumMisses;
+
+		/// Number of (unpinned) nodes evicted from the cache.
+		std::atomic<uint64_t> NumEvictions;
+	};
+
+	/// Thread safe, bounded cache of decoded patricia tree branch nodes.
+	/// \note Nodes are keyed by hash and immutable, so cached nodes never become stale.
+	///       Each generation pins the top levels of the tree with the generation's root, which are never evicted;
+	///       all other nodes, including nodes pinned in a previous generation, are evicted in least recently used order.
+	class PatriciaTreeNodeCache {
+	public:
+		/// Function used to load nodes that are not cached.
+		using NodeLoader = std::function<tree::TreeNode (const Hash256&)>;
+
+	public:
+		/// Creates a cache holding at most \a maxNodes unpinned nodes that pins \a numPinnedLevels levels of branch nodes.
+		PatriciaTreeNodeCache(size_t maxNodes, size_t numPinnedLevels);
+
+	public:
+		/// Gets the number of cached nodes.
+		size_t size() const;
+
+		/// Gets the number of pinned nodes.
+		size_t numPinnedNodes() const;
+
+		/// Gets the current generation.
+		uint64_t generation() const;
+
+		/// Gets the cache statistics.
+		const PatriciaTreeNodeCacheStatistics& statistics() const;
+
+	public:
+		/// Tries to find the node with \a hash.
+		/// \note An empty node is returned when the node is not cached.
+		tree::TreeNode find(const Hash256& hash);
+
+		/// Caches branch \a node.
+		void insert(const tree::BranchTreeNode& node);
+
+		/// Starts a new generation by pinning the top levels of the tree with root \a rootHash.
+		/// \note Uncached nodes in the top levels are loaded with \a nodeLoader.
+		void pin(const Hash256& rootHash, const NodeLoader& nodeLoader);
+
+	private:
+		struct Entry {
+			tree::TreeNode Node;
+			bool IsPinned;
+			std::list<Hash256>::iterator LruIter;
+		};
+
+		using EntryMap = std::unordered_map<Hash256, Entry, utils::ArrayHasher<Hash256>>;
+
+	private:
+		void touch(Entry& entry);
+		void insertUnpinned(const Hash256& hash, tree::TreeNode&& node);
+		void evict();
+
+	private:
+		size_t m_maxNodes;
+		size_t m_numPinnedLevels;
+		uint64_t m_generation;
+		PatriciaTreeNodeCacheStatistics m_statistics;
+
+		EntryMap m_entries;
+		std::list<Hash256> m_lruHashes; // most recently used first
+		std::vector<Hash256> m_pinnedHashes;
+		mutable utils::SpinLock m_lock;
+	};
+}}
@@ -22,7 +22,9 @@
 
 #pragma once
 #include "PatriciaTreeContainer.h"
+#include "PatriciaTreeNodeCache.h"
 #include "bitxorcore/types.h"
+#include <memory>
 
 namespace bitxorcore { namespace cache {
 
@@ -33,20 +35,39 @@ namespace bitxorcore { namespace cache {
 		explicit PatriciaTreeRdbDataSource(PatriciaTreeContainer& container) : m_container(container)
 		{}
 
+		/// Creates data source around \a container that caches at most \a maxCachedNodes decoded branch nodes
+		/// in addition to \a numPinnedLevels pinned levels of branch nodes.
+		/// \note Decoded nodes are not cached when \a maxCachedNodes is zero.
+		PatriciaTreeRdbDataSource(PatriciaTreeContainer& container, size_t maxCachedNodes, size_t numPinnedLevels)
+				: m_container(container)
+				, m_pNodeCache(0 == maxCachedNodes ? nullptr : std::make_unique<PatriciaTreeNodeCache>(maxCachedNodes, numPinnedLevels))
+		{}
+
 	public:
 		/// Gets the number of saved nodes.
 		size_t size() {
 			return m_container.size();
 		}
 
+		/// Gets the decoded node cache (optional).
+		const PatriciaTreeNodeCache* nodeCache() const {
+			return m_pNodeCache.get();
+		}
+
 		/// Gets the tree node associated with \a hash.
 		tree::TreeNode get(const Hash256& hash) const {
-			auto iter = m_container.find(hash);
-			if (m_container.cend() == iter)
-				return tree::TreeNode();
+			if (!m_pNodeCache)
+				return load(hash);
 
-			const auto& pair = *iter;
-			return pair.second.copy();
+			auto node = m_pNodeCache->find(hash);
+			if (!node.empty())
+				return node;
+
+			node = load(hash);
+			if (node.isBranch())
+				m_pNodeCache->insert(node.asBranchNode());
+
+			return node;
 		}
 
 	public:
@@ -58,14 +79,34 @@ namespace bitxorcore { namespace cache {
 		/// Saves a branch tree \a node.
 		void set(const tree::BranchTreeNode& node) {
 			set(tree::TreeNode(node));
+
+			// cache new branch nodes because the top levels of a tree are rewritten by every change
+			if (m_pNodeCache)
+				m_pNodeCache->insert(node);
+		}
+
+		/// Pins the top levels of the tree with root \a rootHash in the decoded node cache.
+		void pin(const Hash256& rootHash) {
+			if (m_pNodeCache)
+				m_pNodeCache->pin(rootHash, [this](const auto& hash) { return load(hash); });
 		}
 
 	private:
+		tree::TreeNode load(const Hash256& hash) const {
+			auto iter = m_container.find(hash);
+			if (m_container.cend() == iter)
+				return tree::TreeNode();
+
+			const auto& pair = *iter;
+			return pair.second.copy();
+		}
+
 		void set(const tree::TreeNode& node) {
 			m_container.insert(std::make_pair(node.hash(), node.copy()));
 		}
 
 	private:
 		PatriciaTreeContainer& m_container;
+		std::unique_ptr<PatriciaTreeNodeCache> m_pNodeCache;
 	};
 }}
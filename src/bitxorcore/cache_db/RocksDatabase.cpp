@@ -23,11 +23,13 @@
 #include "RocksDatabase.h"
 #include "RocksInclude.h"
 #include "RocksPruningFilter.h"
+#include "SharedRocksDatabase.h"
 #include "bitxorcore/config/BitxorCoreDataDirectory.h"
 #include "bitxorcore/utils/HexFormatter.h"
 #include "bitxorcore/utils/PathUtils.h"
 #include "bitxorcore/utils/StackLogger.h"
 #include "bitxorcore/exceptions.h"
+#include <filesystem>
 
 namespace bitxorcore { namespace cache {
 
@@ -99,17 +101,27 @@ namespace bitxorcore { namespace cache {
 			const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig,
 			const std::vector<std::string>& columnFamilyNames,
 			FilterPruningMode pruningMode)
+			: RocksDatabaseSettings(databaseDirectory, databaseConfig, columnFamilyNames, pruningMode, nullptr)
+	{}
+
+	RocksDatabaseSettings::RocksDatabaseSettings(
+			const std::string& databaseDirectory,
+			const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig,
+			const std::vector<std::string>& columnFamilyNames,
+			FilterPruningMode pruningMode,
+			const std::shared_ptr<SharedRocksDatabase>& pSharedDatabase)
 			: DatabaseDirectory(databaseDirectory)
 			, DatabaseConfig(databaseConfig)
 			, ColumnFamilyNames(columnFamilyNames)
 			, PruningMode(pruningMode)
+			, SharedDatabase(pSharedDatabase)
 	{}
 
 	// endregion
 
 	// region RocksDatabase
 
-	namespace {
+	namespace detail {
 		rocksdb::Options CreateDatabaseOptions(const config::NodeConfiguration::CacheDatabaseSubConfiguration& config) {
 			rocksdb::Options dbOptions;
 			dbOptions.create_if_missing = true;
@@ -150,20 +162,27 @@ namespace bitxorcore { namespace cache {
 
 	RocksDatabase::RocksDatabase(const RocksDatabaseSettings& settings)
 			: m_settings(settings)
-			, m_pruningFilter(m_settings.PruningMode)
-			, m_pWriteBatch(std::make_unique<rocksdb::WriteBatch>()) {
+			, m_pruningFilter(m_settings.SharedDatabase ? FilterPruningMode::Disabled : m_settings.PruningMode)
+			, m_pWriteBatch(m_settings.SharedDatabase ? nullptr : std::make_unique<rocksdb::WriteBatch>()) {
 		if (m_settings.ColumnFamilyNames.empty())
 			BITXORCORE_THROW_INVALID_ARGUMENT("missing column family names");
 
+		if (m_settings.SharedDatabase) {
+			// shared database owns all handles and pruning filters
+			auto prefix = std::filesystem::path(m_settings.DatabaseDirectory).filename().generic_string();
+			m_handles = m_settings.SharedDatabase->acquireColumnFamilies(prefix, m_settings.ColumnFamilyNames, m_settings.PruningMode);
+			return;
+		}
+
 		config::BitxorCoreDirectory(m_settings.DatabaseDirectory).createAll();
 
-		auto columnFamilyOptions = CreateColumnFamilyOptions(m_settings.DatabaseConfig, m_pruningFilter.compactionFilter());
+		auto columnFamilyOptions = detail::CreateColumnFamilyOptions(m_settings.DatabaseConfig, m_pruningFilter.compactionFilter());
 		std::vector<rocksdb::ColumnFamilyDescriptor> columnFamilies;
 		for (const auto& columnFamilyName : m_settings.ColumnFamilyNames)
 			columnFamilies.push_back(rocksdb::ColumnFamilyDescriptor(columnFamilyName, columnFamilyOptions));
 
 		rocksdb::DB* pDb;
-		auto dbOptions = CreateDatabaseOptions(m_settings.DatabaseConfig);
+		auto dbOptions = detail::CreateDatabaseOptions(m_settings.DatabaseConfig);
 		auto status = rocksdb::DB::Open(dbOptions, m_settings.DatabaseDirectory, columnFamilies, &m_handles, &pDb);
 		m_pDb.reset(pDb);
 		if (!status.ok())
@@ -171,6 +190,11 @@ namespace bitxorcore { namespace cache {
 	}
 
 	RocksDatabase::~RocksDatabase() {
+		if (m_settings.SharedDatabase) {
+			m_settings.SharedDatabase->releaseColumnFamilies(m_handles);
+			return;
+		}
+
 		for (auto* pHandle : m_handles)
 			m_pDb->DestroyColumnFamilyHandle(pHandle);
 	}
@@ -194,10 +218,12 @@ namespace bitxorcore { namespace cache {
 	ThrowError(std::string(message) + " " + status.ToString() + " (column, key)", m_settings.ColumnFamilyNames[columnId], key)
 
 	void RocksDatabase::get(size_t columnId, const rocksdb::Slice& key, RdbDataIterator& result) {
-		if (!m_pDb)
+		if (!isInitialized())
 			BITXORCORE_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
 
-		auto status = m_pDb->Get(rocksdb::ReadOptions(), m_handles[columnId], key, &result.storage());
+		auto status = m_settings.SharedDatabase
+				? m_settings.SharedDatabase->get(m_handles[columnId], key, result.storage())
+				: m_pDb->Get(rocksdb::ReadOptions(), m_handles[columnId], key, &result.storage());
 		result.setFound(status.ok());
 
 		if (status.ok())
@@ -209,10 +235,12 @@ namespace bitxorcore { namespace cache {
 	}
 
 	void RocksDatabase::put(size_t columnId, const rocksdb::Slice& key, const std::string& value) {
-		if (!m_pDb)
+		if (!isInitialized())
 			BITXORCORE_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
 
-		auto status = m_pWriteBatch->Put(m_handles[columnId], key, value);
+		auto status = m_settings.SharedDatabase
+				? m_settings.SharedDatabase->put(m_handles[columnId], key, value)
+				: m_pWriteBatch->Put(m_handles[columnId], key, value);
 		if (!status.ok())
 			BITXORCORE_THROW_DB_KEY_ERROR("could not add put operation to batch");
 
@@ -220,12 +248,14 @@ namespace bitxorcore { namespace cache {
 	}
 
 	void RocksDatabase::del(size_t columnId, const rocksdb::Slice& key) {
-		if (!m_pDb)
+		if (!isInitialized())
 			BITXORCORE_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
 
 		// note: using SingleDelete can result in undefined result if value has ever been overwritten
 		// that can't be guaranteed, so Delete is used instead
-		auto status = m_pWriteBatch->Delete(m_handles[columnId], key);
+		auto status = m_settings.SharedDatabase
+				? m_settings.SharedDatabase->del(m_handles[columnId], key)
+				: m_pWriteBatch->Delete(m_handles[columnId], key);
 		if (!status.ok())
 			BITXORCORE_THROW_DB_KEY_ERROR("could not add delete operation to batch");
 
@@ -233,6 +263,9 @@ namespace bitxorcore { namespace cache {
 	}
 
 	size_t RocksDatabase::prune(size_t columnId, uint64_t boundary) {
+		if (m_settings.SharedDatabase)
+			return canPrune() ? m_settings.SharedDatabase->prune(m_handles[columnId], boundary) : 0;
+
 		if (!m_pruningFilter.compactionFilter())
 			return 0;
 
@@ -242,6 +275,9 @@ namespace bitxorcore { namespace cache {
 	}
 
 	void RocksDatabase::flush() {
+		if (m_settings.SharedDatabase)
+			return;
+
 		if (0 == m_pWriteBatch->GetDataSize())
 			return;
 
@@ -257,7 +293,15 @@ namespace bitxorcore { namespace cache {
 		m_pWriteBatch->Clear();
 	}
 
+	bool RocksDatabase::isInitialized() const {
+		return m_pDb || m_settings.SharedDatabase;
+	}
+
 	void RocksDatabase::saveIfBatchFull() {
+		// shared database batches are never partially written in order to keep commits atomic
+		if (m_settings.SharedDatabase)
+			return;
+
 		if (m_pWriteBatch->GetDataSize() < m_settings.DatabaseConfig.MaxWriteBatchSize.bytes())
 			return;
 
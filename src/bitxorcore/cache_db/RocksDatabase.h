@@ -39,6 +39,8 @@ namespace rocksdb {
 
 namespace bitxorcore { namespace cache {
 
+	class SharedRocksDatabase;
+
 	// region RdbDataIterator
 
 	/// Iterator adapter, allowing existence check on keys and data retrieval.
@@ -113,6 +115,16 @@ namespace bitxorcore { namespace cache {
 				const std::vector<std::string>& columnFamilyNames,
 				FilterPruningMode pruningMode);
 
+		/// Creates database settings around \a databaseDirectory, \a databaseConfig, column family names (\a columnFamilyNames),
+		/// \a pruningMode and shared database (\a pSharedDatabase) that should host all columns.
+		/// \note When a shared database is used, the last component of \a databaseDirectory prefixes all column family names.
+		RocksDatabaseSettings(
+				const std::string& databaseDirectory,
+				const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig,
+				const std::vector<std::string>& columnFamilyNames,
+				FilterPruningMode pruningMode,
+				const std::shared_ptr<SharedRocksDatabase>& pSharedDatabase);
+
 	public:
 		/// Database directory.
 		const std::string DatabaseDirectory;
@@ -125,6 +137,9 @@ namespace bitxorcore { namespace cache {
 
 		/// Database pruning mode.
 		const FilterPruningMode PruningMode;
+
+		/// Shared database hosting all columns (optional).
+		const std::shared_ptr<SharedRocksDatabase> SharedDatabase;
 	};
 
 	// endregion
@@ -164,9 +179,12 @@ namespace bitxorcore { namespace cache {
 		size_t prune(size_t columnId, uint64_t boundary);
 
 		/// Finalize batched operations.
+		/// \note When a shared database is used, batched operations are finalized by committing the shared database instead.
 		void flush();
 
 	private:
+		bool isInitialized() const;
+
 		void saveIfBatchFull();
 
 	private:
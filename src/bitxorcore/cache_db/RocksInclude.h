@@ -21,6 +21,7 @@
 **/
 
 #pragma once
+#include "bitxorcore/config/NodeConfiguration.h"
 #include <rocksdb/compaction_filter.h>
 #include <rocksdb/db.h>
 #include <rocksdb/write_batch.h>
@@ -30,4 +31,14 @@ namespace bitxorcore { namespace cache {
 	/// Maximum length of special keys that should not be pruned.
 	/// \note Value should be <= sizeof(uint64_t)
 	constexpr size_t Special_Key_Max_Length = 8;
+
+	namespace detail {
+		/// Creates database options from \a config.
+		rocksdb::Options CreateDatabaseOptions(const config::NodeConfiguration::CacheDatabaseSubConfiguration& config);
+
+		/// Creates column family options from \a config with optional \a pCompactionFilter.
+		rocksdb::ColumnFamilyOptions CreateColumnFamilyOptions(
+				const config::NodeConfiguration::CacheDatabaseSubConfiguration& config,
+				rocksdb::CompactionFilter* pCompactionFilter);
+	}
 }}
@@ -0,0 +1,455 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "SharedRocksDatabase.h"
+#include "RocksInclude.h"
+#include "bitxorcore/config/BitxorCoreDataDirectory.h"
+#include "bitxorcore/utils/SpinLock.h"
+#include "bitxorcore/utils/SpinReaderWriterLock.h"
+#include "bitxorcore/utils/StackLogger.h"
+#include "bitxorcore/exceptions.h"
+#include <rocksdb/statistics.h>
+#include <rocksdb/utilities/write_batch_with_index.h>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace bitxorcore { namespace cache {
+
+	namespace {
+		// region PruningCompactionFilterFactory
+
+		class ForwardingCompactionFilter : public rocksdb::CompactionFilter {
+		public:
+			explicit ForwardingCompactionFilter(const rocksdb::CompactionFilter& filter) : m_filter(filter)
+			{}
+
+		public:
+			const char* Name() const override {
+				return m_filter.Name();
+			}
+
+			bool Filter(
+					int level,
+					const rocksdb::Slice& key,
+					const rocksdb::Slice& existingValue,
+					std::string* pNewValue,
+					bool* pValueChanged) const override {
+				return m_filter.Filter(level, key, existingValue, pNewValue, pValueChanged);
+			}
+
+			bool IgnoreSnapshots() const override {
+				return m_filter.IgnoreSnapshots();
+			}
+
+		private:
+			const rocksdb::CompactionFilter& m_filter;
+		};
+
+		// all column families share options, so compaction filters are dispatched based on the owning cache database
+		class PruningCompactionFilterFactory : public rocksdb::CompactionFilterFactory {
+		public:
+			void setFilter(uint32_t columnFamilyId, const rocksdb::CompactionFilter* pFilter) {
+				utils::SpinLockGuard guard(m_lock);
+				m_filters[columnFamilyId] = pFilter;
+			}
+
+		public:
+			const char* Name() const override {
+				return "pruning compaction filter factory";
+			}
+
+			std::unique_ptr<rocksdb::CompactionFilter> CreateCompactionFilter(const rocksdb::CompactionFilter::Context& context) override {
+				utils::SpinLockGuard guard(m_lock);
+				auto iter = m_filters.find(context.column_family_id);
+				if (m_filters.cend() == iter || !iter->second)
+					return nullptr;
+
+				return std::make_unique<ForwardingCompactionFilter>(*iter->second);
+			}
+
+		private:
+			utils::SpinLock m_lock;
+			std::unordered_map<uint32_t, const rocksdb::CompactionFilter*> m_filters;
+		};
+
+		// endregion
+
+		// region ColumnFamilyWriteBatch / WriteBatchCombiner
+
+		// pending writes are staged per column family so that sub caches committed in parallel do not contend for a single batch
+		struct ColumnFamilyWriteBatch {
+		public:
+			ColumnFamilyWriteBatch() : WriteBatch(rocksdb::BytewiseComparator(), 0, true)
+			{}
+
+		public:
+			std::mutex Mutex;
+			rocksdb::WriteBatchWithIndex WriteBatch; // overwrites keys so that lookups always find most recent pending write
+		};
+
+		// copies the pending writes of multiple column families into a single batch that can be written atomically
+		class WriteBatchCombiner : public rocksdb::WriteBatch::Handler {
+		public:
+			WriteBatchCombiner(
+					const std::unordered_map<uint32_t, rocksdb::ColumnFamilyHandle*>& handles,
+					rocksdb::WriteBatch& writeBatch)
+					: m_handles(handles)
+					, m_writeBatch(writeBatch)
+			{}
+
+		public:
+			rocksdb::Status PutCF(uint32_t columnFamilyId, const rocksdb::Slice& key, const rocksdb::Slice& value) override {
+				return m_writeBatch.Put(m_handles.at(columnFamilyId), key, value);
+			}
+
+			rocksdb::Status DeleteCF(uint32_t columnFamilyId, const rocksdb::Slice& key) override {
+				return m_writeBatch.Delete(m_handles.at(columnFamilyId), key);
+			}
+
+		private:
+			const std::unordered_map<uint32_t, rocksdb::ColumnFamilyHandle*>& m_handles;
+			rocksdb::WriteBatch& m_writeBatch;
+		};
+
+		// endregion
+	}
+
+	// region SharedRocksDatabase::Impl
+
+	class SharedRocksDatabase::Impl {
+	public:
+		Impl(const std::string& databaseDirectory, const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig)
+				: m_databaseDirectory(databaseDirectory)
+				, m_pFilterFactory(std::make_shared<PruningCompactionFilterFactory>())
+				, m_columnFamilyOptions(detail::CreateColumnFamilyOptions(databaseConfig, nullptr)) {
+			m_columnFamilyOptions.compaction_filter_factory = m_pFilterFactory;
+
+			config::BitxorCoreDirectory(m_databaseDirectory).createAll();
+
+			// all existing column families must be opened
+			auto dbOptions = detail::CreateDatabaseOptions(databaseConfig);
+			m_pStatistics = dbOptions.statistics;
+
+			std::vector<std::string> columnFamilyNames;
+			if (!rocksdb::DB::ListColumnFamilies(dbOptions, m_databaseDirectory, &columnFamilyNames).ok())
+				columnFamilyNames = { rocksdb::kDefaultColumnFamilyName };
+
+			std::vector<rocksdb::ColumnFamilyDescriptor> columnFamilies;
+			for (const auto& columnFamilyName : columnFamilyNames)
+				columnFamilies.push_back(rocksdb::ColumnFamilyDescriptor(columnFamilyName, m_columnFamilyOptions));
+
+			rocksdb::DB* pDb;
+			std::vector<rocksdb::ColumnFamilyHandle*> handles;
+			auto status = rocksdb::DB::Open(dbOptions, m_databaseDirectory, columnFamilies, &handles, &pDb);
+			m_pDb.reset(pDb);
+			if (!status.ok())
+				BITXORCORE_THROW_RUNTIME_ERROR_2("couldn't open shared database", m_databaseDirectory, status.ToString());
+
+			for (auto i = 0u; i < columnFamilyNames.size(); ++i)
+				addHandle(columnFamilyNames[i], handles[i]);
+		}
+
+		~Impl() {
+			for (const auto& pair : m_handles)
+				m_pDb->DestroyColumnFamilyHandle(pair.second);
+		}
+
+	public:
+		const std::string& databaseDirectory() const {
+			return m_databaseDirectory;
+		}
+
+		std::vector<std::string> columnFamilyNames() const {
+			auto readLock = m_lock.acquireReader();
+			std::vector<std::string> columnFamilyNames;
+			for (const auto& pair : m_handles)
+				columnFamilyNames.push_back(pair.first);
+
+			return columnFamilyNames;
+		}
+
+		size_t numPendingWrites() const {
+			auto readLock = m_lock.acquireReader();
+			size_t numPendingWrites = 0;
+			for (const auto& pair : m_writeBatches) {
+				std::lock_guard<std::mutex> guard(pair.second->Mutex);
+				numPendingWrites += pair.second->WriteBatch.GetWriteBatch()->Count();
+			}
+
+			return numPendingWrites;
+		}
+
+		SharedRocksDatabaseStatistics statistics() const {
+			SharedRocksDatabaseStatistics statistics;
+			m_pDb->GetAggregatedIntProperty(rocksdb::DB::Properties::kEstimateNumKeys, &statistics.NumEstimatedKeys);
+			m_pDb->GetAggregatedIntProperty(rocksdb::DB::Properties::kCurSizeAllMemTables, &statistics.MemtablesSize);
+			m_pDb->GetAggregatedIntProperty(rocksdb::DB::Properties::kLiveSstFilesSize, &statistics.LiveSstFilesSize);
+			m_pDb->GetAggregatedIntProperty(
+					rocksdb::DB::Properties::kEstimatePendingCompactionBytes,
+					&statistics.PendingCompactionSize);
+
+			if (m_pStatistics) {
+				statistics.NumBlockCacheHits = m_pStatistics->getTickerCount(rocksdb::BLOCK_CACHE_HIT);
+				statistics.NumBlockCacheMisses = m_pStatistics->getTickerCount(rocksdb::BLOCK_CACHE_MISS);
+				statistics.NumBytesRead = m_pStatistics->getTickerCount(rocksdb::BYTES_READ);
+				statistics.NumBytesWritten = m_pStatistics->getTickerCount(rocksdb::BYTES_WRITTEN);
+			}
+
+			return statistics;
+		}
+
+	public:
+		std::vector<rocksdb::ColumnFamilyHandle*> acquireColumnFamilies(
+				const std::string& prefix,
+				const std::vector<std::string>& columnFamilyNames,
+				FilterPruningMode pruningMode) {
+			auto writeLock = m_lock.acquireWriter();
+
+			std::vector<std::string> sharedColumnFamilyNames;
+			for (const auto& columnFamilyName : columnFamilyNames) {
+				sharedColumnFamilyNames.push_back(ColumnFamilyName(prefix, columnFamilyName));
+				if (m_acquiredColumnFamilyNames.cend() != m_acquiredColumnFamilyNames.find(sharedColumnFamilyNames.back()))
+					BITXORCORE_THROW_INVALID_ARGUMENT_1("column family has already been acquired", sharedColumnFamilyNames.back());
+			}
+
+			// pruning filters are never destroyed before the database because compactions might still be running
+			m_pruningFilters.push_back(std::make_unique<RocksPruningFilter>(pruningMode));
+			auto& pruningFilter = *m_pruningFilters.back();
+
+			std::vector<rocksdb::ColumnFamilyHandle*> handles;
+			for (const auto& sharedColumnFamilyName : sharedColumnFamilyNames) {
+				auto* pHandle = findOrCreateColumnFamily(sharedColumnFamilyName);
+				m_pFilterFactory->setFilter(pHandle->GetID(), pruningFilter.compactionFilter());
+				m_columnFamilyPruningFilters[pHandle->GetID()] = &pruningFilter;
+				m_acquiredColumnFamilyNames.insert(sharedColumnFamilyName);
+				handles.push_back(pHandle);
+			}
+
+			return handles;
+		}
+
+		void releaseColumnFamilies(const std::vector<rocksdb::ColumnFamilyHandle*>& handles) {
+			auto writeLock = m_lock.acquireWriter();
+			for (auto* pHandle : handles) {
+				m_pFilterFactory->setFilter(pHandle->GetID(), nullptr);
+				m_columnFamilyPruningFilters.erase(pHandle->GetID());
+				m_acquiredColumnFamilyNames.erase(pHandle->GetName());
+			}
+		}
+
+	public:
+		// note: the (shared) reader lock only protects the column family map, so operations on different column families
+		//       never block each other; operations on the same column family are serialized by its own mutex
+
+		rocksdb::Status get(rocksdb::ColumnFamilyHandle* pHandle, const rocksdb::Slice& key, rocksdb::PinnableSlice& result) {
+			auto readLock = m_lock.acquireReader();
+			auto& columnFamilyWriteBatch = getWriteBatch(pHandle);
+			std::lock_guard<std::mutex> guard(columnFamilyWriteBatch.Mutex);
+			return columnFamilyWriteBatch.WriteBatch.GetFromBatchAndDB(m_pDb.get(), rocksdb::ReadOptions(), pHandle, key, &result);
+		}
+
+		rocksdb::Status put(rocksdb::ColumnFamilyHandle* pHandle, const rocksdb::Slice& key, const std::string& value) {
+			auto readLock = m_lock.acquireReader();
+			auto& columnFamilyWriteBatch = getWriteBatch(pHandle);
+			std::lock_guard<std::mutex> guard(columnFamilyWriteBatch.Mutex);
+			return columnFamilyWriteBatch.WriteBatch.Put(pHandle, key, value);
+		}
+
+		rocksdb::Status del(rocksdb::ColumnFamilyHandle* pHandle, const rocksdb::Slice& key) {
+			auto readLock = m_lock.acquireReader();
+			auto& columnFamilyWriteBatch = getWriteBatch(pHandle);
+			std::lock_guard<std::mutex> guard(columnFamilyWriteBatch.Mutex);
+			return columnFamilyWriteBatch.WriteBatch.Delete(pHandle, key);
+		}
+
+		size_t prune(rocksdb::ColumnFamilyHandle* pHandle, uint64_t boundary) {
+			RocksPruningFilter* pPruningFilter;
+			{
+				auto readLock = m_lock.acquireReader();
+				auto iter = m_columnFamilyPruningFilters.find(pHandle->GetID());
+				if (m_columnFamilyPruningFilters.cend() == iter || !iter->second->compactionFilter())
+					return 0;
+
+				pPruningFilter = iter->second;
+			}
+
+			pPruningFilter->setPruningBoundary(boundary);
+			m_pDb->CompactRange({}, pHandle, nullptr, nullptr);
+			return pPruningFilter->numRemoved();
+		}
+
+		void commit() {
+			// writer lock excludes all column family operations, so column family mutexes don't need to be acquired
+			auto writeLock = m_lock.acquireWriter();
+
+			utils::SlowOperationLogger logger("shared cache database commit", utils::LogLevel::warning);
+			rocksdb::WriteBatch writeBatch;
+			WriteBatchCombiner combiner(m_idToHandles, writeBatch);
+			for (const auto& pair : m_writeBatches) {
+				auto status = pair.second->WriteBatch.GetWriteBatch()->Iterate(&combiner);
+				if (!status.ok())
+					BITXORCORE_THROW_RUNTIME_ERROR_1("could not combine batches in shared db", status.ToString());
+			}
+
+			if (0 == writeBatch.Count())
+				return;
+
+			rocksdb::WriteOptions writeOptions;
+			writeOptions.sync = true;
+
+			auto status = m_pDb->Write(writeOptions, &writeBatch);
+			if (!status.ok())
+				BITXORCORE_THROW_RUNTIME_ERROR_1("could not store batch in shared db", status.ToString());
+
+			for (const auto& pair : m_writeBatches)
+				pair.second->WriteBatch.Clear();
+		}
+
+	private:
+		ColumnFamilyWriteBatch& getWriteBatch(rocksdb::ColumnFamilyHandle* pHandle) const {
+			auto iter = m_writeBatches.find(pHandle->GetID());
+			if (m_writeBatches.cend() == iter)
+				BITXORCORE_THROW_INVALID_ARGUMENT_1("column family is not part of shared database", pHandle->GetName());
+
+			return *iter->second;
+		}
+
+		void addHandle(const std::string& columnFamilyName, rocksdb::ColumnFamilyHandle* pHandle) {
+			m_handles.emplace(columnFamilyName, pHandle);
+			m_idToHandles.emplace(pHandle->GetID(), pHandle);
+			m_writeBatches.emplace(pHandle->GetID(), std::make_unique<ColumnFamilyWriteBatch>());
+		}
+
+		rocksdb::ColumnFamilyHandle* findOrCreateColumnFamily(const std::string& columnFamilyName) {
+			auto iter = m_handles.find(columnFamilyName);
+			if (m_handles.cend() != iter)
+				return iter->second;
+
+			rocksdb::ColumnFamilyHandle* pHandle;
+			auto status = m_pDb->CreateColumnFamily(m_columnFamilyOptions, columnFamilyName, &pHandle);
+			if (!status.ok())
+				BITXORCORE_THROW_RUNTIME_ERROR_2("couldn't create column family", columnFamilyName, status.ToString());
+
+			addHandle(columnFamilyName, pHandle);
+			return pHandle;
+		}
+
+	private:
+		std::string m_databaseDirectory;
+		std::shared_ptr<PruningCompactionFilterFactory> m_pFilterFactory;
+		rocksdb::ColumnFamilyOptions m_columnFamilyOptions;
+		std::shared_ptr<rocksdb::Statistics> m_pStatistics;
+		std::vector<std::unique_ptr<RocksPruningFilter>> m_pruningFilters;
+		std::unordered_map<uint32_t, RocksPruningFilter*> m_columnFamilyPruningFilters;
+		std::unordered_set<std::string> m_acquiredColumnFamilyNames;
+
+		std::unordered_map<uint32_t, std::unique_ptr<ColumnFamilyWriteBatch>> m_writeBatches;
+		std::unique_ptr<rocksdb::DB> m_pDb;
+		std::unordered_map<std::string, rocksdb::ColumnFamilyHandle*> m_handles;
+		std::unordered_map<uint32_t, rocksdb::ColumnFamilyHandle*> m_idToHandles;
+		mutable utils::SpinReaderWriterLock m_lock;
+	};
+
+	// endregion
+
+	// region SharedRocksDatabase
+
+	SharedRocksDatabase::SharedRocksDatabase(
+			const std::string& databaseDirectory,
+			const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig)
+			: m_pImpl(std::make_unique<Impl>(databaseDirectory, databaseConfig))
+	{}
+
+	SharedRocksDatabase::~SharedRocksDatabase() {
+		// pending writes are only present when sub caches were committed outside of a bitxorcore cache commit
+		auto numPendingWrites = m_pImpl->numPendingWrites();
+		if (0 == numPendingWrites)
+			return;
+
+		BITXORCORE_LOG(warning) << "committing " << numPendingWrites << " pending writes to shared database on shutdown";
+		try {
+			m_pImpl->commit();
+		} catch (const std::exception& ex) {
+			BITXORCORE_LOG(error) << "failed to commit pending writes to shared database: " << ex.what();
+		}
+	}
+
+	const std::string& SharedRocksDatabase::databaseDirectory() const {
+		return m_pImpl->databaseDirectory();
+	}
+
+	std::vector<std::string> SharedRocksDatabase::columnFamilyNames() const {
+		return m_pImpl->columnFamilyNames();
+	}
+
+	size_t SharedRocksDatabase::numPendingWrites() const {
+		return m_pImpl->numPendingWrites();
+	}
+
+	SharedRocksDatabaseStatistics SharedRocksDatabase::statistics() const {
+		return m_pImpl->statistics();
+	}
+
+	std::string SharedRocksDatabase::ColumnFamilyName(const std::string& prefix, const std::string& columnFamilyName) {
+		return prefix + "." + columnFamilyName;
+	}
+
+	std::vector<rocksdb::ColumnFamilyHandle*> SharedRocksDatabase::acquireColumnFamilies(
+			const std::string& prefix,
+			const std::vector<std::string>& columnFamilyNames,
+			FilterPruningMode pruningMode) {
+		if (columnFamilyNames.empty())
+			BITXORCORE_THROW_INVALID_ARGUMENT("missing column family names");
+
+		return m_pImpl->acquireColumnFamilies(prefix, columnFamilyNames, pruningMode);
+	}
+
+	void SharedRocksDatabase::releaseColumnFamilies(const std::vector<rocksdb::ColumnFamilyHandle*>& handles) {
+		m_pImpl->releaseColumnFamilies(handles);
+	}
+
+	rocksdb::Status SharedRocksDatabase::get(
+			rocksdb::ColumnFamilyHandle* pHandle,
+			const rocksdb::Slice& key,
+			rocksdb::PinnableSlice& result) {
+		return m_pImpl->get(pHandle, key, result);
+	}
+
+	rocksdb::Status SharedRocksDatabase::put(rocksdb::ColumnFamilyHandle* pHandle, const rocksdb::Slice& key, const std::string& value) {
+		return m_pImpl->put(pHandle, key, value);
+	}
+
+	rocksdb::Status SharedRocksDatabase::del(rocksdb::ColumnFamilyHandle* pHandle, const rocksdb::Slice& key) {
+		return m_pImpl->del(pHandle, key);
+	}
+
+	size_t SharedRocksDatabase::prune(rocksdb::ColumnFamilyHandle* pHandle, uint64_t boundary) {
+		return m_pImpl->prune(pHandle, boundary);
+	}
+
+	void SharedRocksDatabase::commit() {
+		m_pImpl->commit();
+	}
+
+	// endregion
+}}
@@ -0,0 +1,131 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "RocksPruningFilter.h"
+#include "bitxorcore/config/NodeConfiguration.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace rocksdb {
+	class ColumnFamilyHandle;
+	class PinnableSlice;
+	class Slice;
+	class Status;
+}
+
+namespace bitxorcore { namespace cache {
+
+	/// Shared database statistics.
+	struct SharedRocksDatabaseStatistics {
+		/// Estimated number of keys across all column families.
+		uint64_t NumEstimatedKeys = 0;
+
+		/// Size of all memtables (in bytes).
+		uint64_t MemtablesSize = 0;
+
+		/// Size of all live sst files (in bytes).
+		uint64_t LiveSstFilesSize = 0;
+
+		/// Estimated number of bytes that need to be rewritten by pending compactions.
+		uint64_t PendingCompactionSize = 0;
+
+		/// Number of block cache hits.
+		/// \note This and all following statistics are only collected when database statistics are enabled.
+		uint64_t NumBlockCacheHits = 0;
+
+		/// Number of block cache misses.
+		uint64_t NumBlockCacheMisses = 0;
+
+		/// Number of bytes read.
+		uint64_t NumBytesRead = 0;
+
+		/// Number of bytes written.
+		uint64_t NumBytesWritten = 0;
+	};
+
+	/// RocksDb database hosting the column families of multiple cache databases.
+	/// \note Writes are staged in per column family batches that are visible to reads immediately
+	///       but are only written to disk (atomically and with a single sync) by commit.
+	///       MaxWriteBatchSize is ignored so that a partially staged block is never persisted.
+	class SharedRocksDatabase {
+	public:
+		/// Creates a shared database around \a databaseDirectory and \a databaseConfig.
+		SharedRocksDatabase(
+				const std::string& databaseDirectory,
+				const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig);
+
+		/// Destroys the shared database.
+		/// \note Any pending writes are committed.
+		~SharedRocksDatabase();
+
+	public:
+		/// Gets the database directory.
+		const std::string& databaseDirectory() const;
+
+		/// Gets the names of all column families in the database.
+		std::vector<std::string> columnFamilyNames() const;
+
+		/// Gets the number of pending (uncommitted) writes.
+		size_t numPendingWrites() const;
+
+		/// Gets the database statistics.
+		SharedRocksDatabaseStatistics statistics() const;
+
+	public:
+		/// Gets the name of the shared column family corresponding to \a columnFamilyName of the cache database with \a prefix.
+		static std::string ColumnFamilyName(const std::string& prefix, const std::string& columnFamilyName);
+
+	public:
+		/// Acquires the column families \a columnFamilyNames of the cache database with \a prefix and \a pruningMode,
+		/// creating any that do not exist.
+		std::vector<rocksdb::ColumnFamilyHandle*> acquireColumnFamilies(
+				const std::string& prefix,
+				const std::vector<std::string>& columnFamilyNames,
+				FilterPruningMode pruningMode);
+
+		/// Releases the column families \a handles previously acquired by a cache database.
+		void releaseColumnFamilies(const std::vector<rocksdb::ColumnFamilyHandle*>& handles);
+
+	public:
+		/// Gets the value associated with \a key from \a pHandle and sets \a result.
+		/// \note Pending writes are taken into account.
+		rocksdb::Status get(rocksdb::ColumnFamilyHandle* pHandle, const rocksdb::Slice& key, rocksdb::PinnableSlice& result);
+
+		/// Stages a put of \a value associated with \a key in \a pHandle.
+		rocksdb::Status put(rocksdb::ColumnFamilyHandle* pHandle, const rocksdb::Slice& key, const std::string& value);
+
+		/// Stages a delete of the value associated with \a key from \a pHandle.
+		rocksdb::Status del(rocksdb::ColumnFamilyHandle* pHandle, const rocksdb::Slice& key);
+
+		/// Prunes elements from \a pHandle below \a boundary. Returns number of pruned elements.
+		size_t prune(rocksdb::ColumnFamilyHandle* pHandle, uint64_t boundary);
+
+		/// Atomically writes all pending writes with a single sync.
+		void commit();
+
+	private:
+		class Impl;
+		std::unique_ptr<Impl> m_pImpl;
+	};
+}}
@@ -120,6 +120,24 @@ namespace bitxorcore { namespace cache {
 		return transactions;
 	}
 
+	MemoryUtCacheView::UnknownTransactions MemoryUtCacheView::findTransactions(const utils::ShortHashesSet& shortHashes) const {
+		uint64_t totalSize = 0;
+		UnknownTransactions transactions;
+		for (const auto& data : m_transactionDataContainer) {
+			if (shortHashes.cend() == shortHashes.find(utils::ToShortHash(data.EntityHash)))
+				continue;
+
+			auto pTransaction = data.pEntity;
+			totalSize += pTransaction->Size;
+			if (totalSize > m_maxResponseSize.bytes())
+				break;
+
+			transactions.push_back(pTransaction);
+		}
+
+		return transactions;
+	}
+
 	// endregion
 
 	// region MemoryUtCacheModifier
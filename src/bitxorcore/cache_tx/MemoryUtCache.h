@@ -79,6 +79,9 @@ namespace bitxorcore { namespace cache {
 				BlockFeeMultiplier minFeeMultiplier,
 				const utils::ShortHashesSet& knownShortHashes) const;
 
+		/// Gets a vector of all transactions in the cache that have a short hash in \a shortHashes.
+		UnknownTransactions findTransactions(const utils::ShortHashesSet& shortHashes) const;
+
 	private:
 		utils::FileSize m_maxResponseSize;
 		utils::FileSize m_cacheSize;
@@ -44,11 +44,13 @@ namespace bitxorcore { namespace chain {
 	void ProcessContextsBuilder::setCache(const cache::BitxorCoreCacheView& view) {
 		m_pCacheView = &view;
 		m_pReadOnlyCache = std::make_unique<cache::ReadOnlyBitxorCoreCache>(view.toReadOnly());
+		m_pResolverContext.reset();
 	}
 
 	void ProcessContextsBuilder::setCache(cache::BitxorCoreCacheDelta& delta) {
 		m_pCacheDelta = &delta;
 		m_pReadOnlyCache = std::make_unique<cache::ReadOnlyBitxorCoreCache>(delta.toReadOnly());
+		m_pResolverContext.reset();
 	}
 
 	void ProcessContextsBuilder::setBlockStatementBuilder(model::BlockStatementBuilder& blockStatementBuilder) {
@@ -78,7 +80,13 @@ namespace bitxorcore { namespace chain {
 	}
 
 	model::NotificationContext ProcessContextsBuilder::buildNotificationContext() {
-		auto resolverContext = m_executionContextConfig.ResolverContextFactory(*m_pReadOnlyCache);
-		return model::NotificationContext(m_height, resolverContext);
+		// share resolver context between validator and observer contexts so that alias changes made by observers
+		// invalidate resolutions memoized by validators
+		if (!m_pResolverContext) {
+			auto resolverContext = m_executionContextConfig.ResolverContextFactory(*m_pReadOnlyCache);
+			m_pResolverContext = std::make_unique<model::ResolverContext>(resolverContext);
+		}
+
+		return model::NotificationContext(m_height, *m_pResolverContext);
 	}
 }}
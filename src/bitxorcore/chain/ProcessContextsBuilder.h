@@ -39,6 +39,7 @@ namespace bitxorcore {
 namespace bitxorcore { namespace chain {
 
 	/// Builder for creating process (observer and validator) contexts.
+	/// \note All contexts built for the same cache share a single resolver context (and its memoized resolutions).
 	class ProcessContextsBuilder {
 	public:
 		/// Creates a builder around \a height, \a blockTime and \a executionContextConfig.
@@ -75,6 +76,7 @@ namespace bitxorcore { namespace chain {
 		const cache::BitxorCoreCacheView* m_pCacheView;
 		cache::BitxorCoreCacheDelta* m_pCacheDelta;
 		std::unique_ptr<cache::ReadOnlyBitxorCoreCache> m_pReadOnlyCache;
+		std::unique_ptr<model::ResolverContext> m_pResolverContext;
 
 		model::BlockStatementBuilder* m_pBlockStatementBuilder;
 	};
@@ -37,6 +37,7 @@ namespace bitxorcore { namespace chain {
 			, m_undoNotificationSubscriber(m_observer, m_observerContext)
 			, m_aggregateResult(validators::ValidationResult::Success)
 			, m_isUndoEnabled(false)
+			, m_isValidationEnabled(true)
 	{}
 
 	validators::ValidationResult ProcessingNotificationSubscriber::result() const {
@@ -54,6 +55,10 @@ namespace bitxorcore { namespace chain {
 		m_undoNotificationSubscriber.undo();
 	}
 
+	void ProcessingNotificationSubscriber::disableValidation() {
+		m_isValidationEnabled = false;
+	}
+
 	void ProcessingNotificationSubscriber::notify(const model::Notification& notification) {
 		if (notification.Size < sizeof(model::Notification))
 			BITXORCORE_THROW_INVALID_ARGUMENT("cannot process notification with incorrect size");
@@ -69,7 +74,7 @@ namespace bitxorcore { namespace chain {
 	}
 
 	void ProcessingNotificationSubscriber::validate(const model::Notification& notification) {
-		if (!IsSet(notification.Type, model::NotificationChannel::Validator))
+		if (!m_isValidationEnabled || !IsSet(notification.Type, model::NotificationChannel::Validator))
 			return;
 
 		auto result = m_validator.validate(notification, m_validatorContext);
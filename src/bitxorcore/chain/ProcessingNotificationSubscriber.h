@@ -48,6 +48,9 @@ namespace bitxorcore { namespace chain {
 		/// Undoes all executions since enableUndo was first called.
 		void undo();
 
+		/// Disables validation so that subsequent notifications are only observed.
+		void disableValidation();
+
 	public:
 		void notify(const model::Notification& notification) override;
 
@@ -64,5 +67,6 @@ namespace bitxorcore { namespace chain {
 		ProcessingUndoNotificationSubscriber m_undoNotificationSubscriber;
 		validators::ValidationResult m_aggregateResult;
 		bool m_isUndoEnabled;
+		bool m_isValidationEnabled;
 	};
 }}
@@ -29,6 +29,7 @@
 #include "bitxorcore/utils/MemoryUtils.h"
 #include "bitxorcore/utils/ThrottleLogger.h"
 #include "bitxorcore/utils/TimeSpan.h"
+#include <algorithm>
 
 namespace bitxorcore { namespace chain {
 
@@ -73,6 +74,52 @@ namespace bitxorcore { namespace chain {
 			});
 		}
 
+		/// Picks up to \a maxPeers peers (preferring the ones with the highest \a peerScorer scores) and wraps a single api around
+		/// all of them using \a apiFactory. Finally, passes the api to \a action.
+		/// \note The interaction result is attributed to the peer with the highest score.
+		template<typename TRemoteApiAction, typename TRemoteApiFactory, typename TPeerScorer>
+		thread::future<ionet::NodeInteractionResult> processSync(
+				TRemoteApiAction action,
+				TRemoteApiFactory apiFactory,
+				size_t maxPeers,
+				TPeerScorer peerScorer) const {
+			// pick more peers than needed so that the fastest ones can be chosen
+			auto packetIoPairs = net::PickMultiple(m_packetIoPicker, 2 * maxPeers, m_timeout);
+			if (packetIoPairs.empty()) {
+				BITXORCORE_LOG_THROTTLE(warning, utils::TimeSpan::FromMinutes(1).millis())
+						<< "no packet io available for operation '" << m_operationName << "'";
+				return thread::make_ready_future(ionet::NodeInteractionResult());
+			}
+
+			std::vector<std::pair<uint64_t, ionet::NodePacketIoPair>> scoredPairs;
+			for (const auto& packetIoPair : packetIoPairs)
+				scoredPairs.emplace_back(peerScorer(packetIoPair.node()), packetIoPair);
+
+			std::stable_sort(scoredPairs.begin(), scoredPairs.end(), [](const auto& lhs, const auto& rhs) {
+				return lhs.first > rhs.first;
+			});
+
+			// keep the highest scoring peers and release all other peers by destroying their packet io pairs
+			packetIoPairs.clear();
+			for (auto i = 0u; i < std::min(maxPeers, scoredPairs.size()); ++i)
+				packetIoPairs.push_back(scoredPairs[i].second);
+
+			scoredPairs.clear();
+
+			auto pRemoteApiUnique = apiFactory(packetIoPairs, m_transactionRegistry);
+			auto pRemoteApi = utils::UniqueToShared(std::move(pRemoteApiUnique));
+
+			// extend the lifetimes of pRemoteApi and packetIoPairs until the completion of the action
+			return action(*pRemoteApi).then([pRemoteApi, packetIoPairs, operationName = m_operationName](auto&& resultFuture) {
+				auto result = resultFuture.get();
+				const auto& primaryNode = packetIoPairs[0].node();
+				BITXORCORE_LOG_LEVEL(ionet::NodeInteractionResultCode::Neutral == result ? utils::LogLevel::trace : utils::LogLevel::info)
+						<< "completed '" << operationName << "' (" << primaryNode << " and "
+						<< packetIoPairs.size() - 1 << " other peers) with result " << result;
+				return ionet::NodeInteractionResult(primaryNode.identity(), result);
+			});
+		}
+
 	private:
 		net::PacketIoPicker& m_packetIoPicker;
 		const model::TransactionRegistry& m_transactionRegistry;
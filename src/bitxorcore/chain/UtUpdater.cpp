@@ -29,11 +29,21 @@
 #include "bitxorcore/cache/RelockableDetachedBitxorCoreCache.h"
 #include "bitxorcore/cache_tx/UtCache.h"
 #include "bitxorcore/model/FeeUtils.h"
+#include "bitxorcore/thread/IoThreadPool.h"
+#include "bitxorcore/thread/ParallelFor.h"
 #include "bitxorcore/utils/HexFormatter.h"
 
 namespace bitxorcore { namespace chain {
 
 	namespace {
+		// smaller batches are prefiltered on the calling thread because the overhead of dispatching work would dominate
+		constexpr size_t Min_Parallel_Prefilter_Batch_Size = 1024;
+
+		struct PrefilterResult {
+			std::vector<model::TransactionInfo> CandidateInfos;
+			std::vector<size_t> CandidateIndexes;
+		};
+
 		struct ApplyState {
 			constexpr ApplyState(cache::UtCacheModifierProxy& modifier, cache::BitxorCoreCacheDelta& unconfirmedBitxorCoreCache)
 					: Modifier(modifier)
@@ -64,6 +74,64 @@ namespace bitxorcore { namespace chain {
 		private:
 			const model::TransactionInfo& m_transactionInfo;
 		};
+
+		class RevalidationFilter {
+		public:
+			explicit RevalidationFilter(const AffectedAddresses& affectedAddresses)
+					: m_affectedAddresses(affectedAddresses)
+					, m_areAllAddressesDirty(false)
+					, m_numReappliedTransactions(0)
+			{}
+
+		public:
+			size_t numReappliedTransactions() const {
+				return m_numReappliedTransactions;
+			}
+
+		public:
+			bool requiresValidation(const model::TransactionInfo& utInfo, const validators::ValidatorContext& validatorContext) const {
+				if (m_areAllAddressesDirty || !utInfo.OptionalExtractedAddresses || utInfo.pEntity->Deadline < validatorContext.BlockTime)
+					return true;
+
+				for (const auto& unresolvedAddress : *utInfo.OptionalExtractedAddresses) {
+					if (m_affectedAddresses.Transactions.cend() != m_affectedAddresses.Transactions.find(unresolvedAddress))
+						return true;
+
+					// an alias might resolve differently after the chain change, so always revalidate transactions using aliases
+					auto address = validatorContext.Resolvers.resolve(unresolvedAddress);
+					if (unresolvedAddress.copyTo<Address>() != address || isDirty(address))
+						return true;
+				}
+
+				return false;
+			}
+
+			void markReapplied() {
+				++m_numReappliedTransactions;
+			}
+
+			void markDirty(const model::TransactionInfo& utInfo, const model::ResolverContext& resolvers) {
+				if (!utInfo.OptionalExtractedAddresses) {
+					m_areAllAddressesDirty = true;
+					return;
+				}
+
+				for (const auto& unresolvedAddress : *utInfo.OptionalExtractedAddresses)
+					m_dirtyAddresses.insert(resolvers.resolve(unresolvedAddress));
+			}
+
+		private:
+			bool isDirty(const Address& address) const {
+				return m_affectedAddresses.Accounts.cend() != m_affectedAddresses.Accounts.find(address)
+						|| m_dirtyAddresses.cend() != m_dirtyAddresses.find(address);
+			}
+
+		private:
+			const AffectedAddresses& m_affectedAddresses;
+			model::AddressSet m_dirtyAddresses;
+			bool m_areAllAddressesDirty;
+			size_t m_numReappliedTransactions;
+		};
 	}
 
 	class UtUpdater::Impl final {
@@ -75,7 +143,8 @@ namespace bitxorcore { namespace chain {
 				const ExecutionConfiguration& executionConfig,
 				const TimeSupplier& timeSupplier,
 				const FailedTransactionSink& failedTransactionSink,
-				const Throttle& throttle)
+				const Throttle& throttle,
+				thread::IoThreadPool* pPrefilterPool)
 				: m_transactionsCache(transactionsCache)
 				, m_detachedBitxorCoreCache(confirmedBitxorCoreCache)
 				, m_minFeeMultiplier(minFeeMultiplier)
@@ -83,31 +152,40 @@ namespace bitxorcore { namespace chain {
 				, m_timeSupplier(timeSupplier)
 				, m_failedTransactionSink(failedTransactionSink)
 				, m_throttle(throttle)
+				, m_pPrefilterPool(pPrefilterPool)
+				, m_cacheGeneration(0)
 		{}
 
 	public:
 		std::vector<UtUpdateResult> update(const std::vector<model::TransactionInfo>& utInfos) {
-			// 1. lock the UT cache and lock the unconfirmed copy
+			// 1. prefilter transactions that can be rejected without holding any locks
+			auto prefilterResult = prefilter(utInfos);
+			const auto& candidateInfos = prefilterResult.CandidateInfos;
+			std::vector<UtUpdateResult> updateResults(utInfos.size(), UtUpdateResult{ UtUpdateResult::UpdateType::Neutral });
+
+			// 2. lock the UT cache and lock the unconfirmed copy
 			auto modifier = m_transactionsCache.modifier();
 			auto pUnconfirmedBitxorCoreCache = m_detachedBitxorCoreCache.getAndTryLock();
 			if (!pUnconfirmedBitxorCoreCache) {
 				// if there is no unconfirmed cache state, it means that a block update is forthcoming
 				// just add all to the cache and they will be validated later
-				addAll(modifier, utInfos);
-
-				std::vector<UtUpdateResult> updateResults;
-				updateResults.reserve(utInfos.size());
-				for (auto i = 0u; i < utInfos.size(); ++i)
-					updateResults.push_back({ UtUpdateResult::UpdateType::Neutral });
-
+				addAll(modifier, candidateInfos);
 				return updateResults;
 			}
 
+			// 3. apply all candidates and map their results back to the original transactions
 			auto applyState = ApplyState(modifier, *pUnconfirmedBitxorCoreCache);
-			return apply(applyState, utInfos, TransactionSource::New);
+			auto candidateResults = apply(applyState, candidateInfos, TransactionSource::New);
+			for (auto i = 0u; i < candidateResults.size(); ++i)
+				updateResults[prefilterResult.CandidateIndexes[i]] = candidateResults[i];
+
+			return updateResults;
 		}
 
-		void update(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos) {
+		void update(
+				const utils::HashPointerSet& confirmedTransactionHashes,
+				const std::vector<model::TransactionInfo>& utInfos,
+				RevalidationFilter* pRevalidationFilter) {
 			if (!confirmedTransactionHashes.empty() || !utInfos.empty()) {
 				BITXORCORE_LOG(debug)
 						<< "confirmed " << confirmedTransactionHashes.size() << " transactions, "
@@ -121,30 +199,69 @@ namespace bitxorcore { namespace chain {
 
 			// 2. lock the bitxorcore cache and rebase the unconfirmed bitxorcore cache
 			auto pUnconfirmedBitxorCoreCache = m_detachedBitxorCoreCache.rebaseAndLock();
+			++m_cacheGeneration;
 
 			// 3. add back reverted txes
 			auto applyState = ApplyState(modifier, *pUnconfirmedBitxorCoreCache);
-			apply(applyState, utInfos, TransactionSource::Reverted);
+			apply(applyState, utInfos, TransactionSource::Reverted, pRevalidationFilter);
 
 			// 4. add back original txes that have not been confirmed
-			apply(applyState, originalTransactionInfos, TransactionSource::Existing, [&confirmedTransactionHashes](const auto& info) {
+			auto filter = [&confirmedTransactionHashes](const auto& info) {
 				return confirmedTransactionHashes.cend() == confirmedTransactionHashes.find(&info.EntityHash);
-			});
+			};
+			apply(applyState, originalTransactionInfos, TransactionSource::Existing, filter, pRevalidationFilter);
+
+			if (pRevalidationFilter && pRevalidationFilter->numReappliedTransactions() > 0) {
+				BITXORCORE_LOG(debug)
+						<< "reapplied " << pRevalidationFilter->numReappliedTransactions() << " of "
+						<< originalTransactionInfos.size() << " existing transactions without revalidation";
+			}
 		}
 
 	private:
+		PrefilterResult prefilter(const std::vector<model::TransactionInfo>& utInfos) const {
+			std::vector<uint8_t> feeCheckResults(utInfos.size(), 0);
+			auto checkFees = [this, &feeCheckResults](auto itBegin, auto itEnd, size_t startIndex, auto) {
+				auto index = startIndex;
+				for (auto iter = itBegin; itEnd != iter; ++iter, ++index)
+					feeCheckResults[index] = isFeeSufficient(*iter, TransactionSource::New) ? 1 : 0;
+			};
+
+			if (m_pPrefilterPool && utInfos.size() >= Min_Parallel_Prefilter_Batch_Size) {
+				auto numPartitions = m_pPrefilterPool->numWorkerThreads();
+				thread::ParallelForPartition(m_pPrefilterPool->ioContext(), utInfos, numPartitions, checkFees).get();
+			} else {
+				checkFees(utInfos.cbegin(), utInfos.cend(), 0, 0);
+			}
+
+			// drop duplicates within the batch before any cache lookups are needed
+			PrefilterResult result;
+			utils::HashPointerSet candidateHashes;
+			for (auto i = 0u; i < utInfos.size(); ++i) {
+				if (!feeCheckResults[i] || !candidateHashes.insert(&utInfos[i].EntityHash).second)
+					continue;
+
+				result.CandidateInfos.push_back(utInfos[i].copy());
+				result.CandidateIndexes.push_back(i);
+			}
+
+			return result;
+		}
+
 		std::vector<UtUpdateResult> apply(
 				const ApplyState& applyState,
 				const std::vector<model::TransactionInfo>& utInfos,
-				TransactionSource transactionSource) {
-			return apply(applyState, utInfos, transactionSource, [](const auto&) { return true; });
+				TransactionSource transactionSource,
+				RevalidationFilter* pRevalidationFilter = nullptr) {
+			return apply(applyState, utInfos, transactionSource, [](const auto&) { return true; }, pRevalidationFilter);
 		}
 
 		std::vector<UtUpdateResult> apply(
 				const ApplyState& applyState,
 				const std::vector<model::TransactionInfo>& utInfos,
 				TransactionSource transactionSource,
-				const predicate<const model::TransactionInfo&>& filter) {
+				const predicate<const model::TransactionInfo&>& filter,
+				RevalidationFilter* pRevalidationFilter) {
 			std::vector<UtUpdateResult> updateResults;
 			updateResults.reserve(utInfos.size());
 
@@ -156,25 +273,26 @@ namespace bitxorcore { namespace chain {
 			auto validatorContext = contextBuilder.buildValidatorContext();
 			auto observerContext = contextBuilder.buildObserverContext();
 
+			// any transaction that is not reapplied unchanged can affect the validity of subsequent transactions
+			auto markDirty = [pRevalidationFilter, &validatorContext](const auto& utInfo) {
+				if (pRevalidationFilter)
+					pRevalidationFilter->markDirty(utInfo, validatorContext.Resolvers);
+			};
+
 			size_t numRejectedTransactions = 0;
 			for (const auto& utInfo : utInfos) {
 				const auto& entity = *utInfo.pEntity;
 				const auto& entityHash = utInfo.EntityHash;
 
 				if (!filter(utInfo)) {
+					markDirty(utInfo);
 					updateResults.push_back({ UtUpdateResult::UpdateType::Neutral });
 					continue;
 				}
 
-				auto minTransactionFee = model::CalculateTransactionFee(m_minFeeMultiplier, entity);
-				if (entity.MaxFee < minTransactionFee) {
-					// don't log reverted transactions that could have been included by harvester with lower min fee multiplier
-					if (TransactionSource::New == transactionSource) {
-						BITXORCORE_LOG(debug)
-								<< "dropping transaction " << TransactionInfoFormatter(utInfo) << " with max fee " << entity.MaxFee
-								<< " because min fee is " << minTransactionFee;
-					}
-
+				// new transactions are fee checked once by prefilter
+				if (TransactionSource::New != transactionSource && !isFeeSufficient(utInfo, transactionSource)) {
+					markDirty(utInfo);
 					updateResults.push_back({ UtUpdateResult::UpdateType::Neutral });
 					continue;
 				}
@@ -182,11 +300,13 @@ namespace bitxorcore { namespace chain {
 				if (throttle(utInfo, transactionSource, applyState, validatorContext.Cache)) {
 					BITXORCORE_LOG(warning) << "dropping transaction " << TransactionInfoFormatter(utInfo) << " due to throttle";
 					m_failedTransactionSink(entity, entityHash, Failure_Chain_Unconfirmed_Cache_Too_Full);
+					markDirty(utInfo);
 					updateResults.push_back({ UtUpdateResult::UpdateType::Neutral });
 					continue;
 				}
 
 				if (!applyState.Modifier.add(utInfo)) {
+					markDirty(utInfo);
 					updateResults.push_back({ UtUpdateResult::UpdateType::Neutral });
 					continue;
 				}
@@ -196,6 +316,18 @@ namespace bitxorcore { namespace chain {
 				const auto& observer = *m_executionConfig.pObserver;
 				ProcessingNotificationSubscriber sub(validator, validatorContext, observer, observerContext);
 				sub.enableUndo();
+
+				// existing transactions that are unrelated to the chain change only need to be observed
+				auto requiresValidation = !pRevalidationFilter
+						|| TransactionSource::Existing != transactionSource
+						|| pRevalidationFilter->requiresValidation(utInfo, validatorContext);
+				if (requiresValidation) {
+					markDirty(utInfo);
+				} else {
+					sub.disableValidation();
+					pRevalidationFilter->markReapplied();
+				}
+
 				auto entityInfo = model::WeakEntityInfo(entity, entityHash);
 				m_executionConfig.pNotificationPublisher->publish(entityInfo, sub);
 				if (!IsValidationResultSuccess(sub.result())) {
@@ -221,12 +353,34 @@ namespace bitxorcore { namespace chain {
 			return updateResults;
 		}
 
+		bool isFeeSufficient(const model::TransactionInfo& utInfo, TransactionSource transactionSource) const {
+			const auto& entity = *utInfo.pEntity;
+			auto minTransactionFee = model::CalculateTransactionFee(m_minFeeMultiplier, entity);
+			if (entity.MaxFee >= minTransactionFee)
+				return true;
+
+			// don't log reverted transactions that could have been included by harvester with lower min fee multiplier
+			if (TransactionSource::New == transactionSource) {
+				BITXORCORE_LOG(debug)
+						<< "dropping transaction " << TransactionInfoFormatter(utInfo) << " with max fee " << entity.MaxFee
+						<< " because min fee is " << minTransactionFee;
+			}
+
+			return false;
+		}
+
 		bool throttle(
 				const model::TransactionInfo& utInfo,
 				TransactionSource transactionSource,
 				const ApplyState& applyState,
 				const cache::ReadOnlyBitxorCoreCache& cache) const {
-			return m_throttle(utInfo, { transactionSource, m_detachedBitxorCoreCache.height(), cache, applyState.Modifier });
+			return m_throttle(utInfo, {
+				transactionSource,
+				m_detachedBitxorCoreCache.height(),
+				m_cacheGeneration,
+				cache,
+				applyState.Modifier
+			});
 		}
 
 		void addAll(cache::UtCacheModifierProxy& modifier, const std::vector<model::TransactionInfo>& utInfos) {
@@ -242,6 +396,8 @@ namespace bitxorcore { namespace chain {
 		TimeSupplier m_timeSupplier;
 		FailedTransactionSink m_failedTransactionSink;
 		UtUpdater::Throttle m_throttle;
+		thread::IoThreadPool* m_pPrefilterPool;
+		uint64_t m_cacheGeneration;
 	};
 
 	UtUpdater::UtUpdater(
@@ -259,7 +415,28 @@ namespace bitxorcore { namespace chain {
 					executionConfig,
 					timeSupplier,
 					failedTransactionSink,
-					throttle))
+					throttle,
+					nullptr))
+	{}
+
+	UtUpdater::UtUpdater(
+			cache::UtCache& transactionsCache,
+			const cache::BitxorCoreCache& confirmedBitxorCoreCache,
+			BlockFeeMultiplier minFeeMultiplier,
+			const ExecutionConfiguration& executionConfig,
+			const TimeSupplier& timeSupplier,
+			const FailedTransactionSink& failedTransactionSink,
+			const Throttle& throttle,
+			thread::IoThreadPool& prefilterPool)
+			: m_pImpl(std::make_unique<Impl>(
+					transactionsCache,
+					confirmedBitxorCoreCache,
+					minFeeMultiplier,
+					executionConfig,
+					timeSupplier,
+					failedTransactionSink,
+					throttle,
+					&prefilterPool))
 	{}
 
 	UtUpdater::~UtUpdater() = default;
@@ -269,6 +446,14 @@ namespace bitxorcore { namespace chain {
 	}
 
 	void UtUpdater::update(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos) {
-		m_pImpl->update(confirmedTransactionHashes, utInfos);
+		m_pImpl->update(confirmedTransactionHashes, utInfos, nullptr);
+	}
+
+	void UtUpdater::update(
+			const utils::HashPointerSet& confirmedTransactionHashes,
+			const std::vector<model::TransactionInfo>& utInfos,
+			const AffectedAddresses& affectedAddresses) {
+		RevalidationFilter revalidationFilter(affectedAddresses);
+		m_pImpl->update(confirmedTransactionHashes, utInfos, &revalidationFilter);
 	}
 }}
@@ -23,6 +23,7 @@
 #pragma once
 #include "ChainFunctions.h"
 #include "ExecutionConfiguration.h"
+#include "bitxorcore/model/ContainerTypes.h"
 #include "bitxorcore/model/EntityInfo.h"
 #include "bitxorcore/observers/ObserverTypes.h"
 #include "bitxorcore/utils/ArraySet.h"
@@ -33,6 +34,7 @@ namespace bitxorcore {
 		class UtCache;
 		class UtCacheModifierProxy;
 	}
+	namespace thread { class IoThreadPool; }
 }
 
 namespace bitxorcore { namespace chain {
@@ -59,6 +61,17 @@ namespace bitxorcore { namespace chain {
 
 	// endregion
 
+	/// Addresses affected by a change of the confirmed chain.
+	/// \note State that is not keyed by account (e.g. tokens, namespaces and aliases) is not indexed, so these must only be
+	///       supplied for chain changes that did not modify such state.
+	struct AffectedAddresses {
+		/// Addresses of all accounts that were added, modified or removed.
+		model::AddressSet Accounts;
+
+		/// Addresses extracted from all confirmed transactions.
+		model::UnresolvedAddressSet Transactions;
+	};
+
 	/// Provides batch updating of an unconfirmed transactions cache.
 	class UtUpdater {
 	public:
@@ -82,6 +95,10 @@ namespace bitxorcore { namespace chain {
 			/// Cache height.
 			Height CacheHeight;
 
+			/// Cache generation, which changes every time the unconfirmed cache is rebased onto the confirmed cache
+			/// (after a block commit or rollback).
+			uint64_t CacheGeneration;
+
 			/// Unconfirmed bitxorcore cache.
 			const cache::ReadOnlyBitxorCoreCache& UnconfirmedBitxorCoreCache;
 
@@ -107,6 +124,22 @@ namespace bitxorcore { namespace chain {
 				const FailedTransactionSink& failedTransactionSink,
 				const Throttle& throttle);
 
+		/// Creates an updater around \a transactionsCache with execution configuration (\a executionConfig),
+		/// current time supplier (\a timeSupplier) and failed transaction sink (\a failedTransactionSink).
+		/// \a confirmedBitxorCoreCache is the real (confirmed) bitxorcore cache.
+		/// \a throttle allows throttling (rejection) of transactions.
+		/// \a minFeeMultiplier is the minimum fee multiplier of transactions allowed in the cache.
+		/// \a prefilterPool is used to prefilter large batches of new transactions in parallel.
+		UtUpdater(
+				cache::UtCache& transactionsCache,
+				const cache::BitxorCoreCache& confirmedBitxorCoreCache,
+				BlockFeeMultiplier minFeeMultiplier,
+				const ExecutionConfiguration& executionConfig,
+				const TimeSupplier& timeSupplier,
+				const FailedTransactionSink& failedTransactionSink,
+				const Throttle& throttle,
+				thread::IoThreadPool& prefilterPool);
+
 		/// Destroys the updater.
 		~UtUpdater();
 
@@ -118,6 +151,14 @@ namespace bitxorcore { namespace chain {
 		/// removing transactions with hashes in \a confirmedTransactionHashes.
 		void update(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos);
 
+		/// Updates this cache by applying new transaction infos in \a utInfos and
+		/// removing transactions with hashes in \a confirmedTransactionHashes.
+		/// Existing transactions that are unrelated to \a affectedAddresses are reapplied without being revalidated.
+		void update(
+				const utils::HashPointerSet& confirmedTransactionHashes,
+				const std::vector<model::TransactionInfo>& utInfos,
+				const AffectedAddresses& affectedAddresses);
+
 	private:
 		class Impl;
 		std::unique_ptr<Impl> m_pImpl;
@@ -42,10 +42,15 @@ namespace bitxorcore { namespace config {
 
 		LOAD_NODE_PROPERTY(EnableAddressReuse);
 		LOAD_NODE_PROPERTY(EnableSingleThreadPool);
+		LOAD_NODE_PROPERTY(ComputeThreadPoolSize);
+		LOAD_NODE_PROPERTY(ComputeThreadPoolCpuAffinity);
+		LOAD_NODE_PROPERTY(HeavyPacketHandlerPoolSize);
+		LOAD_NODE_PROPERTY(MaxPendingHeavyPacketsPerPeer);
 		LOAD_NODE_PROPERTY(EnableCacheDatabaseStorage);
 		LOAD_NODE_PROPERTY(EnableAutoSyncCleanup);
 
 		LOAD_NODE_PROPERTY(FileDatabaseBatchSize);
+		LOAD_NODE_PROPERTY(StateFileChunkSize);
 
 		LOAD_NODE_PROPERTY(EnableTransactionSpamThrottling);
 		LOAD_NODE_PROPERTY(TransactionSpamThrottlingMaxBoostFee);
@@ -53,6 +58,7 @@ namespace bitxorcore { namespace config {
 		LOAD_NODE_PROPERTY(MaxHashesPerSyncAttempt);
 		LOAD_NODE_PROPERTY(MaxBlocksPerSyncAttempt);
 		LOAD_NODE_PROPERTY(MaxChainBytesPerSyncAttempt);
+		LOAD_NODE_PROPERTY(MaxParallelSyncPeers);
 
 		LOAD_NODE_PROPERTY(ShortLivedCacheTransactionDuration);
 		LOAD_NODE_PROPERTY(ShortLivedCacheBlockDuration);
@@ -64,6 +70,9 @@ namespace bitxorcore { namespace config {
 		LOAD_NODE_PROPERTY(TransactionSelectionStrategy);
 		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheMaxResponseSize);
 		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheMaxSize);
+		LOAD_NODE_PROPERTY(EnableIncrementalUtRevalidation);
+		LOAD_NODE_PROPERTY(EnableTransactionInventoryGossip);
+		LOAD_NODE_PROPERTY(TransactionInventoryMaxSize);
 
 		LOAD_NODE_PROPERTY(ConnectTimeout);
 		LOAD_NODE_PROPERTY(SyncTimeout);
@@ -71,6 +80,7 @@ namespace bitxorcore { namespace config {
 		LOAD_NODE_PROPERTY(SocketWorkingBufferSize);
 		LOAD_NODE_PROPERTY(SocketWorkingBufferSensitivity);
 		LOAD_NODE_PROPERTY(MaxPacketDataSize);
+		LOAD_NODE_PROPERTY(MaxStatePathKeysPerRequest);
 
 		LOAD_NODE_PROPERTY(BlockDisruptorSlotCount);
 		LOAD_NODE_PROPERTY(BlockDisruptorMaxMemorySize);
@@ -83,6 +93,11 @@ namespace bitxorcore { namespace config {
 		LOAD_NODE_PROPERTY(EnableDispatcherAbortWhenFull);
 		LOAD_NODE_PROPERTY(EnableDispatcherInputAuditing);
 
+		LOAD_NODE_PROPERTY(EnableDispatcherTracing);
+		LOAD_NODE_PROPERTY(DispatcherTraceMaxEventsPerThread);
+		LOAD_NODE_PROPERTY(DispatcherTraceSlowBlockThreshold);
+		LOAD_NODE_PROPERTY(DispatcherTraceMaxFiles);
+
 		LOAD_NODE_PROPERTY(MaxTrackedNodes);
 
 		LOAD_NODE_PROPERTY(MinPartnerNodeVersion);
@@ -97,6 +112,7 @@ namespace bitxorcore { namespace config {
 #define LOAD_CACHE_DATABASE_PROPERTY(NAME) utils::LoadIniProperty(bag, "cache_database", #NAME, config.CacheDatabase.NAME)
 
 		LOAD_CACHE_DATABASE_PROPERTY(EnableStatistics);
+		LOAD_CACHE_DATABASE_PROPERTY(EnableSharedDatabase);
 		LOAD_CACHE_DATABASE_PROPERTY(MaxOpenFiles);
 		LOAD_CACHE_DATABASE_PROPERTY(MaxBackgroundThreads);
 		LOAD_CACHE_DATABASE_PROPERTY(MaxSubcompactionThreads);
@@ -104,6 +120,7 @@ namespace bitxorcore { namespace config {
 		LOAD_CACHE_DATABASE_PROPERTY(MemtableMemoryBudget);
 
 		LOAD_CACHE_DATABASE_PROPERTY(MaxWriteBatchSize);
+		LOAD_CACHE_DATABASE_PROPERTY(PatriciaTreeNodeCacheSize);
 
 #undef LOAD_CACHE_DATABASE_PROPERTY
 
@@ -151,7 +168,7 @@ namespace bitxorcore { namespace config {
 
 #undef LOAD_BANNING_PROPERTY
 
-		utils::VerifyBagSizeExact(bag, 40 + 7 + 4 + 4 + 5 + 9);
+		utils::VerifyBagSizeExact(bag, 54 + 9 + 4 + 4 + 5 + 9);
 		return config;
 	}
 
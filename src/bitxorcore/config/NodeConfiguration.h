@@ -47,6 +47,18 @@ namespace bitxorcore { namespace config {
 		/// \c true if a single thread pool should be used, \c false if multiple thread pools should be used.
 		bool EnableSingleThreadPool;
 
+		/// Number of worker threads in the compute pool used for cpu-bound validation (\c 0 to use the number of hardware threads).
+		uint32_t ComputeThreadPoolSize;
+
+		/// Cpu ids that compute pool worker threads should be pinned to (empty to disable pinning).
+		std::unordered_set<std::string> ComputeThreadPoolCpuAffinity;
+
+		/// Number of worker threads used for executing heavy packet handlers (\c 0 to use the number of hardware threads).
+		uint32_t HeavyPacketHandlerPoolSize;
+
+		/// Maximum number of heavy packets that can be queued for a single peer.
+		uint32_t MaxPendingHeavyPacketsPerPeer;
+
 		/// \c true if cache data should be saved in a database.
 		bool EnableCacheDatabaseStorage;
 
@@ -58,6 +70,10 @@ namespace bitxorcore { namespace config {
 		/// \note This is recommended to be a factor of 10000.
 		uint32_t FileDatabaseBatchSize;
 
+		/// Size of checksummed chunks used when saving state files.
+		/// \note \c 0 will save state files without chunks or checksums.
+		utils::FileSize StateFileChunkSize;
+
 		/// \c true if transaction spam throttling should be enabled.
 		bool EnableTransactionSpamThrottling;
 
@@ -73,6 +89,10 @@ namespace bitxorcore { namespace config {
 		/// Maximum chain bytes per sync attempt.
 		utils::FileSize MaxChainBytesPerSyncAttempt;
 
+		/// Maximum number of peers from which disjoint block ranges are downloaded in parallel during a sync attempt.
+		/// \note A value of \c 1 disables parallel downloads.
+		uint32_t MaxParallelSyncPeers;
+
 		/// Duration of a transaction in the short lived cache.
 		utils::TimeSpan ShortLivedCacheTransactionDuration;
 
@@ -101,6 +121,19 @@ namespace bitxorcore { namespace config {
 		/// Maximum size of the unconfirmed transactions cache.
 		utils::FileSize UnconfirmedTransactionsCacheMaxSize;
 
+		/// \c true if unconfirmed transactions unaffected by a block commit should be reapplied without revalidation.
+		/// \note All unconfirmed transactions are revalidated after rollbacks, after blocks without statements
+		///       (receipts are not enabled), after blocks in which any artifact expires and after blocks that change
+		///       token, namespace or alias state.
+		bool EnableIncrementalUtRevalidation;
+
+		/// \c true if new transactions should be gossiped by announcing short hashes instead of pushing full transactions.
+		/// \note All peers need to enable this because announcements are not understood by nodes that have it disabled.
+		bool EnableTransactionInventoryGossip;
+
+		/// Maximum number of transaction short hashes remembered by the transaction inventory.
+		uint32_t TransactionInventoryMaxSize;
+
 		/// Timeout for connecting to a peer.
 		utils::TimeSpan ConnectTimeout;
 
@@ -117,6 +150,9 @@ namespace bitxorcore { namespace config {
 		/// Maximum packet data size.
 		utils::FileSize MaxPacketDataSize;
 
+		/// Maximum number of keys in a single state paths request.
+		uint32_t MaxStatePathKeysPerRequest;
+
 		/// Number of slots in the block disruptor circular buffer.
 		uint32_t BlockDisruptorSlotCount;
 
@@ -141,6 +177,18 @@ namespace bitxorcore { namespace config {
 		/// \c true if all dispatcher inputs should be audited.
 		bool EnableDispatcherInputAuditing;
 
+		/// \c true if block dispatcher processing should be traced.
+		bool EnableDispatcherTracing;
+
+		/// Maximum number of trace events retained per thread.
+		uint32_t DispatcherTraceMaxEventsPerThread;
+
+		/// Minimum block dispatcher processing time that triggers a trace dump.
+		utils::TimeSpan DispatcherTraceSlowBlockThreshold;
+
+		/// Maximum number of slow block trace files to keep (oldest files are deleted first).
+		uint32_t DispatcherTraceMaxFiles;
+
 		/// Maximum number of nodes to track in memory.
 		uint32_t MaxTrackedNodes;
 
@@ -165,6 +213,9 @@ namespace bitxorcore { namespace config {
 			/// \c true if operational statistics should be captured and logged.
 			bool EnableStatistics;
 
+			/// \c true if all cache databases should be hosted by a single shared database that is committed atomically.
+			bool EnableSharedDatabase;
+
 			/// Maximum number of open files.
 			uint32_t MaxOpenFiles;
 
@@ -183,7 +234,12 @@ namespace bitxorcore { namespace config {
 			utils::FileSize MemtableMemoryBudget;
 
 			/// Maximum write batch size.
+			/// \note This is ignored by the shared database, which always writes a whole block in one batch.
 			utils::FileSize MaxWriteBatchSize;
+
+			/// Maximum number of decoded patricia tree branch nodes cached per tree (in addition to pinned top level nodes).
+			/// \note Decoded node caching is disabled when zero.
+			uint32_t PatriciaTreeNodeCacheSize;
 		};
 
 	public:
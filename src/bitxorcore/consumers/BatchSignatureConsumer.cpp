@@ -25,7 +25,7 @@
 #include "TransactionConsumers.h"
 #include "ValidationConsumerUtils.h"
 #include "bitxorcore/model/NotificationSubscriber.h"
-#include "bitxorcore/thread/IoThreadPool.h"
+#include "bitxorcore/thread/ComputeThreadPool.h"
 #include "bitxorcore/thread/ParallelFor.h"
 #include "bitxorcore/validators/AggregateValidationResult.h"
 
@@ -111,7 +111,7 @@ namespace bitxorcore { namespace consumers {
 			const GenerationHashSeed& generationHashSeed,
 			const crypto::RandomFiller& randomFiller,
 			const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
-			thread::IoThreadPool& pool,
+			thread::ComputeThreadPool& pool,
 			const RequiresValidationPredicate& requiresValidationPredicate) {
 		return MakeBlockValidationConsumer(requiresValidationPredicate, [&pool, generationHashSeed, randomFiller, pPublisher](
 				const auto& entityInfos) {
@@ -126,7 +126,7 @@ namespace bitxorcore { namespace consumers {
 					validators::AggregateValidationResult(aggregateResult, Failure_Consumer_Batch_Signature_Not_Verifiable);
 			};
 
-			thread::ParallelForPartition(pool.ioContext(), inputs, pool.numWorkerThreads(), partitionCallback).get();
+			thread::ParallelForPartition(pool, inputs, partitionCallback).get();
 			return aggregateResult.load();
 		});
 	}
@@ -135,7 +135,7 @@ namespace bitxorcore { namespace consumers {
 			const GenerationHashSeed& generationHashSeed,
 			const crypto::RandomFiller& randomFiller,
 			const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
-			thread::IoThreadPool& pool,
+			thread::ComputeThreadPool& pool,
 			const chain::FailedTransactionSink& failedTransactionSink) {
 		return MakeTransactionValidationConsumer(failedTransactionSink, [&pool, generationHashSeed, randomFiller, pPublisher](
 				const auto& entityInfos) {
@@ -143,7 +143,7 @@ namespace bitxorcore { namespace consumers {
 			auto pSub = ExtractAllSignatureNotifications(generationHashSeed, *pPublisher, entityInfos);
 
 			// process signatures in batches
-			// note: store notification (not entity) results because it's possible for an entity to be split across partitions,
+			// note: store notification (not entity) results because it's possible for an entity to be split across chunks,
 			//       which would lead to a write data race (of same data) from multiple threads
 			std::vector<validators::ValidationResult> notificationResults(pSub->inputs().size(), validators::ValidationResult::Success);
 			auto partitionCallback = [&randomFiller, &notificationResults](auto itBegin, auto itEnd, auto startIndex, auto) {
@@ -161,7 +161,7 @@ namespace bitxorcore { namespace consumers {
 				}
 			};
 
-			thread::ParallelForPartition(pool.ioContext(), pSub->inputs(), pool.numWorkerThreads(), partitionCallback).get();
+			thread::ParallelForPartition(pool, pSub->inputs(), partitionCallback).get();
 
 			return MapNotificationResultsToEntityResults(entityInfos.size(), pSub->notificationToEntityIndexMap(), notificationResults);
 		});
@@ -72,7 +72,7 @@ namespace bitxorcore { namespace consumers {
 			const GenerationHashSeed& generationHashSeed,
 			const crypto::RandomFiller& randomFiller,
 			const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
-			thread::IoThreadPool& pool,
+			thread::ComputeThreadPool& pool,
 			const RequiresValidationPredicate& requiresValidationPredicate);
 
 	/// Creates a consumer that attempts to synchronize a remote chain with the local chain, which is composed of
@@ -24,12 +24,18 @@
 #include "ConsumerResultFactory.h"
 #include "InputUtils.h"
 #include "bitxorcore/cache/BitxorCoreCache.h"
+#include "bitxorcore/cache/CacheConstants.h"
+#include "bitxorcore/cache_core/AccountStateCache.h"
 #include "bitxorcore/chain/BlockScorer.h"
 #include "bitxorcore/chain/ChainUtils.h"
+#include "bitxorcore/chain/UtUpdater.h"
 #include "bitxorcore/io/BlockStorageCache.h"
+#include "bitxorcore/model/BlockStatement.h"
 #include "bitxorcore/model/BlockUtils.h"
+#include "bitxorcore/model/ReceiptType.h"
 #include "bitxorcore/utils/Casting.h"
 #include "bitxorcore/utils/StackLogger.h"
+#include "bitxorcore/utils/TraceRecorder.h"
 
 namespace bitxorcore { namespace consumers {
 
@@ -62,6 +68,74 @@ namespace bitxorcore { namespace consumers {
 			}
 		};
 
+		bool IsArtifactExpiryReceipt(model::ReceiptType receiptType) {
+			auto basicReceiptType = static_cast<model::BasicReceiptType>((utils::to_underlying_type(receiptType) >> 12) & 0x0F);
+			return model::BasicReceiptType::ArtifactExpiry == basicReceiptType;
+		}
+
+		bool HasArtifactExpiry(const model::BlockStatement& blockStatement) {
+			for (const auto& pair : blockStatement.TransactionStatements) {
+				const auto& transactionStatement = pair.second;
+				for (auto i = 0u; i < transactionStatement.size(); ++i) {
+					if (IsArtifactExpiryReceipt(transactionStatement.receiptAt(i).Type))
+						return true;
+				}
+			}
+
+			return false;
+		}
+
+		bool HasUnindexedStateChanges(const cache::BitxorCoreCacheDelta& cacheDelta) {
+			// token, namespace and alias state is not keyed by account, so changes to it cannot be mapped to affected addresses
+			for (auto cacheId : { cache::CacheId::Namespace, cache::CacheId::Token, cache::CacheId::TokenRestriction }) {
+				if (cacheDelta.hasChanges(utils::to_underlying_type(cacheId)))
+					return true;
+			}
+
+			return false;
+		}
+
+		std::unique_ptr<chain::AffectedAddresses> CollectAffectedAddresses(
+				const BlockElements& elements,
+				const cache::BitxorCoreCacheDelta& cacheDelta,
+				bool hasRolledBackBlocks) {
+			// expiries (and undone expiries) can invalidate transactions of accounts that are not otherwise affected
+			// (e.g. transfers of an expired token), so affected addresses are unknown if any block:
+			// - was rolled back (undone blocks can revert expiries)
+			// - is missing a statement (expiries cannot be detected)
+			// - contains an artifact expiry receipt
+			// token, namespace or alias changes (e.g. token restrictions or alias links) can similarly invalidate transactions of
+			// unaffected accounts
+			if (hasRolledBackBlocks || HasUnindexedStateChanges(cacheDelta))
+				return nullptr;
+
+			auto pAffectedAddresses = std::make_unique<chain::AffectedAddresses>();
+			for (const auto& element : elements) {
+				if (!element.OptionalStatement || HasArtifactExpiry(*element.OptionalStatement))
+					return nullptr;
+
+				for (const auto& transactionElement : element.Transactions) {
+					// affected addresses are unknown if any transaction is missing extracted addresses
+					if (!transactionElement.OptionalExtractedAddresses)
+						return nullptr;
+
+					const auto& addresses = *transactionElement.OptionalExtractedAddresses;
+					pAffectedAddresses->Transactions.insert(addresses.cbegin(), addresses.cend());
+				}
+			}
+
+			auto addAccounts = [&accounts = pAffectedAddresses->Accounts](const auto& accountStatePointers) {
+				for (const auto* pAccountState : accountStatePointers)
+					accounts.insert(pAccountState->Address);
+			};
+
+			const auto& accountStateCacheDelta = cacheDelta.sub<cache::AccountStateCache>();
+			addAccounts(accountStateCacheDelta.addedElements());
+			addAccounts(accountStateCacheDelta.modifiedElements());
+			addAccounts(accountStateCacheDelta.removedElements());
+			return pAffectedAddresses;
+		}
+
 		struct SyncState {
 		public:
 			SyncState() = default;
@@ -296,43 +370,54 @@ namespace bitxorcore { namespace consumers {
 			void commitAll(const BlockElements& elements, SyncState& syncState) const {
 				utils::SlowOperationLogger logger("BlockchainSyncConsumer::commitAll", utils::LogLevel::warning);
 
+				const auto& lastElement = elements.back();
+				utils::TraceSteps traceSteps("sync", "commit all", lastElement.Block.Height, utils::ToShortHash(lastElement.EntityHash));
+				auto addSubOperation = [&logger, &traceSteps](const char* name) {
+					logger.addSubOperation(name);
+					traceSteps.step(name);
+				};
+
 				// 1. save the peer chain into storage
-				logger.addSubOperation("save the peer chain into storage");
+				addSubOperation("save the peer chain into storage");
+				auto hasRolledBackBlocks = m_storage.view().chainHeight() > syncState.commonBlockHeight();
 				auto storageModifier = m_storage.modifier();
 				storageModifier.dropBlocksAfter(syncState.commonBlockHeight());
 				storageModifier.saveBlocks(elements);
 				m_handlers.CommitStep(CommitOperationStep::Blocks_Written);
 
 				// 2. prune the cache
-				logger.addSubOperation("prune delta cache");
+				addSubOperation("prune delta cache");
 				syncState.prune();
 
 				// 3. indicate a state change
-				logger.addSubOperation("indicate a state change");
+				addSubOperation("indicate a state change");
 				auto newHeight = elements.back().Block.Height;
 				m_handlers.StateChange({ cache::CacheChanges(syncState.cacheDelta()), syncState.scoreDelta(), newHeight });
 				m_handlers.PreStateWritten(syncState.cacheDelta(), newHeight);
 				m_handlers.CommitStep(CommitOperationStep::State_Written);
 
+				// - collect affected addresses before the cache delta is released
+				auto pAffectedAddresses = CollectAffectedAddresses(elements, syncState.cacheDelta(), hasRolledBackBlocks);
+
 				// *** checkpoint ***
 				// - both blocks and state have been written out to disk and can be fully restored
 				// - broker process is not yet able to consume changes (all changes are consumable after step 3)
 
 				// 4. commit changes to the in-memory cache and primary blockchain storage
-				logger.addSubOperation("commit changes to the in-memory cache");
+				addSubOperation("commit changes to the in-memory cache");
 				syncState.commit(newHeight);
 
-				logger.addSubOperation("commit changes to the primary blockchain storage");
+				addSubOperation("commit changes to the primary blockchain storage");
 				storageModifier.commit();
 				m_handlers.CommitStep(CommitOperationStep::All_Updated);
 
 				// 5. update the unconfirmed transactions
-				logger.addSubOperation("update the unconfirmed transactions");
+				addSubOperation("update the unconfirmed transactions");
 				auto peerTransactionHashes = ExtractTransactionHashes(elements);
 				auto revertedTransactionInfos = CollectRevertedTransactionInfos(
 						peerTransactionHashes,
 						syncState.detachRemovedTransactionInfos());
-				m_handlers.TransactionsChange({ peerTransactionHashes, revertedTransactionInfos });
+				m_handlers.TransactionsChange({ peerTransactionHashes, revertedTransactionInfos, pAffectedAddresses.get() });
 			}
 
 		private:
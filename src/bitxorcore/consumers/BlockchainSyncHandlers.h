@@ -28,7 +28,10 @@
 
 namespace bitxorcore {
 	namespace cache { class BitxorCoreCache; }
-	namespace chain { struct ObserverState; }
+	namespace chain {
+		struct AffectedAddresses;
+		struct ObserverState;
+	}
 }
 
 namespace bitxorcore { namespace consumers {
@@ -40,8 +43,18 @@ namespace bitxorcore { namespace consumers {
 		TransactionsChangeInfo(
 				const utils::HashPointerSet& addedTransactionHashes,
 				const std::vector<model::TransactionInfo>& revertedTransactionInfos)
+				: TransactionsChangeInfo(addedTransactionHashes, revertedTransactionInfos, nullptr)
+		{}
+
+		/// Creates a new transactions change info around \a addedTransactionHashes, \a revertedTransactionInfos
+		/// and \a pAffectedAddresses.
+		TransactionsChangeInfo(
+				const utils::HashPointerSet& addedTransactionHashes,
+				const std::vector<model::TransactionInfo>& revertedTransactionInfos,
+				const chain::AffectedAddresses* pAffectedAddresses)
 				: AddedTransactionHashes(addedTransactionHashes)
 				, RevertedTransactionInfos(revertedTransactionInfos)
+				, OptionalAffectedAddresses(pAffectedAddresses)
 		{}
 
 	public:
@@ -50,6 +63,10 @@ namespace bitxorcore { namespace consumers {
 
 		/// Infos of the transactions that were reverted (previously confirmed).
 		const std::vector<model::TransactionInfo>& RevertedTransactionInfos;
+
+		/// Addresses affected by the change (optional).
+		/// \note This is \c nullptr when the affected addresses are unknown.
+		const chain::AffectedAddresses* OptionalAffectedAddresses;
 	};
 
 	/// Type of block passed to undo block handler.
@@ -23,6 +23,7 @@
 #include "BlockConsumers.h"
 #include "ConsumerResultFactory.h"
 #include "RecentHashCache.h"
+#include "ShardedRecentHashCache.h"
 #include "TransactionConsumers.h"
 #include "bitxorcore/utils/Hashers.h"
 #include <unordered_map>
@@ -60,13 +61,13 @@ namespace bitxorcore { namespace consumers {
 	}
 
 	namespace {
+		template<typename TRecentHashCache>
 		class TransactionHashCheckConsumer {
 		public:
 			TransactionHashCheckConsumer(
-					const chain::TimeSupplier& timeSupplier,
-					const HashCheckOptions& options,
+					const std::shared_ptr<TRecentHashCache>& pRecentHashCache,
 					const chain::KnownHashPredicate& knownHashPredicate)
-					: m_recentHashCache(timeSupplier, options)
+					: m_pRecentHashCache(pRecentHashCache)
 					, m_knownHashPredicate(knownHashPredicate)
 			{}
 
@@ -94,14 +95,14 @@ namespace bitxorcore { namespace consumers {
 
 		private:
 			bool shouldSkip(const model::TransactionElement& element) {
-				if (!m_recentHashCache.add(element.MerkleComponentHash))
+				if (!m_pRecentHashCache->add(element.MerkleComponentHash))
 					return true;
 
 				return m_knownHashPredicate(element.Transaction.Deadline, element.EntityHash);
 			}
 
 		private:
-			RecentHashCache m_recentHashCache;
+			std::shared_ptr<TRecentHashCache> m_pRecentHashCache;
 			chain::KnownHashPredicate m_knownHashPredicate;
 		};
 	}
@@ -110,6 +111,13 @@ namespace bitxorcore { namespace consumers {
 			const chain::TimeSupplier& timeSupplier,
 			const HashCheckOptions& options,
 			const chain::KnownHashPredicate& knownHashPredicate) {
-		return TransactionHashCheckConsumer(timeSupplier, options, knownHashPredicate);
+		auto pRecentHashCache = std::make_shared<RecentHashCache>(timeSupplier, options);
+		return TransactionHashCheckConsumer<RecentHashCache>(pRecentHashCache, knownHashPredicate);
+	}
+
+	disruptor::TransactionConsumer CreateTransactionHashCheckConsumer(
+			const std::shared_ptr<ShardedRecentHashCache>& pRecentHashCache,
+			const chain::KnownHashPredicate& knownHashPredicate) {
+		return TransactionHashCheckConsumer<ShardedRecentHashCache>(pRecentHashCache, knownHashPredicate);
 	}
 }}
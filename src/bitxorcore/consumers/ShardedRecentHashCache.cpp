@@ -0,0 +1,150 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ShardedRecentHashCache.h"
+#include "bitxorcore/utils/Logging.h"
+#include <cstring>
+
+namespace bitxorcore { namespace consumers {
+
+	struct ShardedRecentHashCache::Shard {
+	public:
+		struct Bucket {
+			uint64_t Id;
+			std::vector<Hash256> Hashes;
+		};
+
+	public:
+		// maps each hash to the id of the bucket in which it was last added
+		std::unordered_map<Hash256, uint64_t, utils::ArrayHasher<Hash256>> Hashes;
+		std::deque<Bucket> Buckets;
+		mutable utils::SpinLock Lock;
+	};
+
+	ShardedRecentHashCache::ShardedRecentHashCache(
+			const chain::TimeSupplier& timeSupplier,
+			const HashCheckOptions& options,
+			size_t numShards)
+			: m_timeSupplier(timeSupplier)
+			, m_options(options)
+			, m_bucketDuration(std::max<uint64_t>(1, options.PruneInterval)) {
+		numShards = std::max<size_t>(1, numShards);
+		m_maxShardSize = (options.MaxCacheSize + numShards - 1) / numShards;
+		for (auto i = 0u; i < numShards; ++i)
+			m_shards.push_back(std::make_unique<Shard>());
+	}
+
+	ShardedRecentHashCache::~ShardedRecentHashCache() = default;
+
+	size_t ShardedRecentHashCache::size() const {
+		size_t size = 0;
+		for (const auto& pShard : m_shards) {
+			utils::SpinLockGuard guard(pShard->Lock);
+			size += pShard->Hashes.size();
+		}
+
+		return size;
+	}
+
+	const RecentHashCacheStatistics& ShardedRecentHashCache::statistics() const {
+		return m_statistics;
+	}
+
+	bool ShardedRecentHashCache::add(const Hash256& hash) {
+		auto currentTime = m_timeSupplier();
+		auto& shard = this->shard(hash);
+
+		utils::SpinLockGuard guard(shard.Lock);
+		prune(shard, currentTime);
+
+		// buckets are kept ordered even if time goes backwards
+		auto bucketId = currentTime.unwrap() / m_bucketDuration;
+		if (!shard.Buckets.empty())
+			bucketId = std::max(bucketId, shard.Buckets.back().Id);
+
+		auto iter = shard.Hashes.find(hash);
+		auto isHashKnown = shard.Hashes.end() != iter;
+		if (isHashKnown) {
+			++m_statistics.NumHits;
+
+			// extend the lifetime of a known hash by moving it into the current bucket
+			if (bucketId == iter->second)
+				return false;
+
+			iter->second = bucketId;
+		} else {
+			++m_statistics.NumMisses;
+
+			// only add the hash if the shard is not full
+			if (m_maxShardSize <= shard.Hashes.size())
+				return true;
+
+			shard.Hashes.emplace(hash, bucketId);
+			if (m_maxShardSize == shard.Hashes.size())
+				BITXORCORE_LOG(warning) << "short lived hash check cache shard is full";
+		}
+
+		if (shard.Buckets.empty() || bucketId != shard.Buckets.back().Id)
+			shard.Buckets.push_back({ bucketId, {} });
+
+		shard.Buckets.back().Hashes.push_back(hash);
+		return !isHashKnown;
+	}
+
+	bool ShardedRecentHashCache::contains(const Hash256& hash) const {
+		const auto& shard = this->shard(hash);
+
+		utils::SpinLockGuard guard(shard.Lock);
+		return shard.Hashes.cend() != shard.Hashes.find(hash);
+	}
+
+	ShardedRecentHashCache::Shard& ShardedRecentHashCache::shard(const Hash256& hash) const {
+		// use bytes that are not used by the shard hash maps in order to keep shards and map buckets uncorrelated
+		uint64_t shardSeed;
+		std::memcpy(&shardSeed, &hash[Hash256::Size - sizeof(uint64_t)], sizeof(uint64_t));
+		return *m_shards[shardSeed % m_shards.size()];
+	}
+
+	void ShardedRecentHashCache::prune(Shard& shard, Timestamp time) {
+		// a bucket is expired when even its most recent hash is older than the cache duration
+		uint64_t numPruned = 0;
+		while (!shard.Buckets.empty()) {
+			const auto& bucket = shard.Buckets.front();
+			if ((bucket.Id + 1) * m_bucketDuration - 1 + m_options.CacheDuration >= time.unwrap())
+				break;
+
+			// skip hashes that were moved into a more recent bucket
+			for (const auto& hash : bucket.Hashes) {
+				auto iter = shard.Hashes.find(hash);
+				if (shard.Hashes.end() != iter && bucket.Id == iter->second) {
+					shard.Hashes.erase(iter);
+					++numPruned;
+				}
+			}
+
+			shard.Buckets.pop_front();
+		}
+
+		if (0 != numPruned)
+			m_statistics.NumPruned += numPruned;
+	}
+}}
@@ -0,0 +1,101 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "HashCheckOptions.h"
+#include "bitxorcore/chain/ChainFunctions.h"
+#include "bitxorcore/utils/Hashers.h"
+#include "bitxorcore/utils/SpinLock.h"
+#include "bitxorcore/types.h"
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace bitxorcore { namespace consumers {
+
+	/// Recent hash cache statistics.
+	struct RecentHashCacheStatistics {
+	public:
+		/// Creates zeroed statistics.
+		RecentHashCacheStatistics()
+				: NumHits(0)
+				, NumMisses(0)
+				, NumPruned(0)
+		{}
+
+	public:
+		/// Number of added hashes that were already known.
+		std::atomic<uint64_t> NumHits;
+
+		/// Number of added hashes that were unknown.
+		std::atomic<uint64_t> NumMisses;
+
+		/// Number of hashes that expired and were pruned.
+		std::atomic<uint64_t> NumPruned;
+	};
+
+	/// Hash cache that holds recently seen hashes and can be accessed concurrently.
+	/// \note Hashes are distributed across independently locked shards. Within each shard, hashes are grouped into time buckets
+	///       spanning the prune interval so that expired hashes are removed bucket by bucket instead of by full cache scans.
+	///       A hash expires between cache duration and cache duration plus prune interval after it was last added.
+	class ShardedRecentHashCache {
+	public:
+		/// Creates a recent hash cache around \a timeSupplier and \a options with \a numShards shards.
+		/// \note The maximum cache size is evenly split across all shards.
+		ShardedRecentHashCache(const chain::TimeSupplier& timeSupplier, const HashCheckOptions& options, size_t numShards);
+
+		/// Destroys the cache.
+		~ShardedRecentHashCache();
+
+	public:
+		/// Gets the size of the cache.
+		size_t size() const;
+
+		/// Gets the cache statistics.
+		const RecentHashCacheStatistics& statistics() const;
+
+	public:
+		/// Checks if \a hash is already in the cache and adds it to the cache if it is unknown.
+		/// \note This also prunes expired hashes from the shard containing \a hash.
+		bool add(const Hash256& hash);
+
+		/// Returns \c true if the cache contains \a hash, \c false otherwise.
+		bool contains(const Hash256& hash) const;
+
+	private:
+		struct Shard;
+
+		Shard& shard(const Hash256& hash) const;
+
+		void prune(Shard& shard, Timestamp time);
+
+	private:
+		chain::TimeSupplier m_timeSupplier;
+		HashCheckOptions m_options;
+		uint64_t m_bucketDuration;
+		uint64_t m_maxShardSize;
+		std::vector<std::unique_ptr<Shard>> m_shards;
+		RecentHashCacheStatistics m_statistics;
+	};
+}}
@@ -0,0 +1,160 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "TracingConsumers.h"
+#include "bitxorcore/io/RawFile.h"
+#include "bitxorcore/utils/Logging.h"
+#include "bitxorcore/utils/TraceRecorder.h"
+#include <algorithm>
+#include <sstream>
+
+namespace bitxorcore { namespace consumers {
+
+	namespace {
+		constexpr auto Trace_Category = "dispatcher";
+
+		void SetBlock(utils::TraceSpan& span, const model::BlockElement& element) {
+			span.setBlock(element.Block.Height, utils::ToShortHash(element.EntityHash));
+		}
+
+		void SetBlock(utils::TraceSpan& span, const disruptor::BlockElements& elements) {
+			if (!elements.empty())
+				SetBlock(span, elements.back());
+		}
+
+		void SetBlock(utils::TraceSpan& span, const disruptor::ConsumerInput& input) {
+			if (input.hasBlocks())
+				SetBlock(span, input.blocks());
+		}
+
+		std::deque<std::filesystem::path> FindTraceFiles(const std::filesystem::path& traceDirectory) {
+			std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::path>> timestampedFiles;
+			for (const auto& entry : std::filesystem::directory_iterator(traceDirectory)) {
+				if (entry.is_regular_file() && ".json" == entry.path().extension())
+					timestampedFiles.emplace_back(entry.last_write_time(), entry.path());
+			}
+
+			std::sort(timestampedFiles.begin(), timestampedFiles.end());
+
+			std::deque<std::filesystem::path> traceFiles;
+			for (const auto& pair : timestampedFiles)
+				traceFiles.push_back(pair.second);
+
+			return traceFiles;
+		}
+
+		template<typename TInput>
+		auto CreateTracingConsumer(const char* name, const disruptor::DisruptorConsumerT<TInput>& consumer) {
+			return [name, consumer](auto& input) {
+				utils::TraceSpan span(Trace_Category, name);
+				auto result = consumer(input);
+
+				// associate the span with the input after it has been processed because some consumers (e.g. hash calculator)
+				// calculate the block hashes used for identification
+				if (span.isRecording())
+					SetBlock(span, input);
+
+				return result;
+			};
+		}
+	}
+
+	disruptor::BlockConsumer CreateTracingBlockConsumer(const char* name, const disruptor::BlockConsumer& consumer) {
+		return CreateTracingConsumer(name, consumer);
+	}
+
+	disruptor::DisruptorConsumer CreateTracingDisruptorConsumer(const char* name, const disruptor::DisruptorConsumer& consumer) {
+		return CreateTracingConsumer(name, consumer);
+	}
+
+	SlowBlockTraceDumper::SlowBlockTraceDumper(
+			const std::shared_ptr<const utils::TraceRecorder>& pRecorder,
+			const std::string& traceDirectory,
+			const utils::TimeSpan& threshold,
+			size_t maxFiles)
+			: m_pRecorder(pRecorder)
+			, m_traceDirectory(traceDirectory)
+			, m_thresholdMicros(threshold.millis() * 1000)
+			, m_maxFiles(maxFiles)
+			, m_traceFiles(FindTraceFiles(m_traceDirectory))
+			, m_numDumps(0)
+	{}
+
+	size_t SlowBlockTraceDumper::numDumps() const {
+		return m_numDumps;
+	}
+
+	void SlowBlockTraceDumper::start() {
+		auto startMicros = m_pRecorder->nowMicros();
+
+		std::lock_guard<utils::SpinLock> guard(m_lock);
+		m_startMicros.push_back(startMicros);
+	}
+
+	void SlowBlockTraceDumper::complete(const disruptor::ConsumerInput& input) {
+		auto endMicros = m_pRecorder->nowMicros();
+
+		uint64_t startMicros;
+		{
+			std::lock_guard<utils::SpinLock> guard(m_lock);
+			if (m_startMicros.empty())
+				return;
+
+			startMicros = m_startMicros.front();
+			m_startMicros.pop_front();
+		}
+
+		if (0 == m_maxFiles || endMicros - startMicros <= m_thresholdMicros || !input.hasBlocks() || input.blocks().empty())
+			return;
+
+		std::ostringstream out;
+		utils::WriteChromeTrace(out, m_pRecorder->snapshot(startMicros, endMicros));
+		auto trace = out.str();
+
+		auto height = input.blocks().back().Block.Height;
+		auto filename = m_traceDirectory / (std::to_string(height.unwrap()) + "_" + std::to_string(startMicros) + ".json");
+		write(filename, trace);
+		++m_numDumps;
+
+		BITXORCORE_LOG(warning)
+				<< "slow block element ending at height " << height << " (" << (endMicros - startMicros) / 1000
+				<< "ms), trace written to " << filename.generic_string();
+	}
+
+	void SlowBlockTraceDumper::write(const std::filesystem::path& filename, const std::string& trace) {
+		{
+			io::RawFile file(filename.generic_string(), io::OpenMode::Read_Write, io::LockMode::None);
+			file.write({ reinterpret_cast<const uint8_t*>(trace.data()), trace.size() });
+		}
+
+		// delete the oldest trace files so that the trace directory does not grow without bound
+		m_traceFiles.push_back(filename);
+		while (m_traceFiles.size() > m_maxFiles) {
+			std::error_code ec;
+			std::filesystem::remove(m_traceFiles.front(), ec);
+			if (ec)
+				BITXORCORE_LOG(warning) << "unable to delete trace file " << m_traceFiles.front().generic_string() << ": " << ec.message();
+
+			m_traceFiles.pop_front();
+		}
+	}
+}}
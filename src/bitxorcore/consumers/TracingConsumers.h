@@ -0,0 +1,84 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "bitxorcore/disruptor/DisruptorConsumer.h"
+#include "bitxorcore/utils/SpinLock.h"
+#include "bitxorcore/utils/TimeSpan.h"
+#include <atomic>
+#include <deque>
+#include <filesystem>
+#include <memory>
+
+namespace bitxorcore { namespace utils { class TraceRecorder; } }
+
+namespace bitxorcore { namespace consumers {
+
+	/// Creates a consumer that records each invocation of \a consumer as a trace span with \a name.
+	/// \note \a name must point to a string with static storage duration.
+	disruptor::BlockConsumer CreateTracingBlockConsumer(const char* name, const disruptor::BlockConsumer& consumer);
+
+	/// Creates a consumer that records each invocation of \a consumer as a trace span with \a name.
+	/// \note \a name must point to a string with static storage duration.
+	disruptor::DisruptorConsumer CreateTracingDisruptorConsumer(const char* name, const disruptor::DisruptorConsumer& consumer);
+
+	/// Dumps the traces of block dispatcher inputs that take too long to process.
+	/// \note Inputs must be started and completed in the same order, which is guaranteed when start is called
+	///       by the first dispatcher consumer and complete is called by the dispatcher inspector.
+	class SlowBlockTraceDumper {
+	public:
+		/// Creates a dumper that writes traces recorded by \a pRecorder into \a traceDirectory
+		/// for all inputs that take longer than \a threshold to process.
+		/// \note At most \a maxFiles trace files are kept in \a traceDirectory (the oldest files are deleted first),
+		///       so no traces are written when \a maxFiles is zero.
+		SlowBlockTraceDumper(
+				const std::shared_ptr<const utils::TraceRecorder>& pRecorder,
+				const std::string& traceDirectory,
+				const utils::TimeSpan& threshold,
+				size_t maxFiles);
+
+	public:
+		/// Gets the number of dumped traces.
+		size_t numDumps() const;
+
+	public:
+		/// Marks the start of processing the next input.
+		void start();
+
+		/// Marks the completion of processing \a input and dumps its trace if it was too slow.
+		void complete(const disruptor::ConsumerInput& input);
+
+	private:
+		void write(const std::filesystem::path& filename, const std::string& trace);
+
+	private:
+		std::shared_ptr<const utils::TraceRecorder> m_pRecorder;
+		std::filesystem::path m_traceDirectory;
+		uint64_t m_thresholdMicros;
+		size_t m_maxFiles;
+		std::deque<std::filesystem::path> m_traceFiles; // ordered from oldest to newest
+
+		utils::SpinLock m_lock;
+		std::deque<uint64_t> m_startMicros;
+		std::atomic<size_t> m_numDumps;
+	};
+}}
@@ -30,7 +30,10 @@
 #include "bitxorcore/model/EntityInfo.h"
 #include "bitxorcore/validators/ParallelValidationPolicy.h"
 
-namespace bitxorcore { namespace model { class NotificationPublisher; } }
+namespace bitxorcore {
+	namespace consumers { class ShardedRecentHashCache; }
+	namespace model { class NotificationPublisher; }
+}
 
 namespace bitxorcore { namespace consumers {
 
@@ -48,6 +51,12 @@ namespace bitxorcore { namespace consumers {
 			const HashCheckOptions& options,
 			const chain::KnownHashPredicate& knownHashPredicate);
 
+	/// Creates a consumer that checks entities for previous processing based on their hash.
+	/// \a pRecentHashCache is the (shared) cache of recently seen hashes and \a knownHashPredicate returns \c true for known hashes.
+	disruptor::TransactionConsumer CreateTransactionHashCheckConsumer(
+			const std::shared_ptr<ShardedRecentHashCache>& pRecentHashCache,
+			const chain::KnownHashPredicate& knownHashPredicate);
+
 	/// Creates a consumer that runs stateless validation using \a pValidationPolicy and calls \a failedTransactionSink for each failure.
 	disruptor::TransactionConsumer CreateTransactionStatelessValidationConsumer(
 			const std::shared_ptr<const validators::ParallelValidationPolicy>& pValidationPolicy,
@@ -60,7 +69,7 @@ namespace bitxorcore { namespace consumers {
 			const GenerationHashSeed& generationHashSeed,
 			const crypto::RandomFiller& randomFiller,
 			const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
-			thread::IoThreadPool& pool,
+			thread::ComputeThreadPool& pool,
 			const chain::FailedTransactionSink& failedTransactionSink);
 
 	/// Prototype for a function that is called with new transactions.
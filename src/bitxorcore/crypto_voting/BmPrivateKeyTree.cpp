@@ -22,6 +22,7 @@
 
 #include "BmPrivateKeyTree.h"
 #include "VotingSigner.h"
+#include "bitxorcore/crypto/Hashes.h"
 #include "bitxorcore/crypto/SecureRandomGenerator.h"
 #include "bitxorcore/io/PodIoUtils.h"
 #include "bitxorcore/exceptions.h"
@@ -392,5 +393,123 @@ namespace bitxorcore { namespace crypto {
 		return true;
 	}
 
+	namespace {
+		Hash256 CalculateSignatureHash(const BmTreeSignature& signature, const BmKeyIdentifier& keyIdentifier, const RawBuffer& buffer) {
+			Hash256 signatureHash;
+			Sha3_256_Builder builder;
+			builder.update({
+				{ reinterpret_cast<const uint8_t*>(&signature), sizeof(BmTreeSignature) },
+				ToBuffer(keyIdentifier.KeyId),
+				buffer
+			});
+			builder.final(signatureHash);
+			return signatureHash;
+		}
+
+		bool ContainsBinding(
+				const BmVerificationCache& verificationCache,
+				const BmTreeSignature& signature,
+				const BmKeyIdentifier& keyIdentifier) {
+			return verificationCache.containsBinding(signature.Root.ParentPublicKey, signature.Bottom.ParentPublicKey, keyIdentifier);
+		}
+
+		void AddVerified(
+				BmVerificationCache& verificationCache,
+				const BmTreeSignature& signature,
+				const BmKeyIdentifier& keyIdentifier,
+				const Hash256& signatureHash) {
+			verificationCache.addBinding(signature.Root.ParentPublicKey, signature.Bottom.ParentPublicKey, keyIdentifier);
+			verificationCache.addSignature(signatureHash, keyIdentifier);
+		}
+	}
+
+	bool Verify(
+			const BmTreeSignature& signature,
+			const BmKeyIdentifier& keyIdentifier,
+			const RawBuffer& buffer,
+			BmVerificationCache& verificationCache) {
+		auto signatureHash = CalculateSignatureHash(signature, keyIdentifier, buffer);
+		if (verificationCache.containsSignature(signatureHash, keyIdentifier))
+			return true;
+
+		if (!ContainsBinding(verificationCache, signature, keyIdentifier)) {
+			if (!VerifyBoundSignature(signature.Root, signature.Bottom.ParentPublicKey, keyIdentifier.KeyId))
+				return false;
+		}
+
+		if (!crypto::Verify(signature.Bottom.ParentPublicKey, buffer, signature.Bottom.Signature))
+			return false;
+
+		AddVerified(verificationCache, signature, keyIdentifier, signatureHash);
+		return true;
+	}
+
+	namespace {
+		struct PendingSignature {
+			Key PublicKey;
+			bitxorcore::Signature Signature;
+			std::vector<RawBuffer> Buffers;
+		};
+
+		PendingSignature ToPendingSignature(const BmTreeSignature::ParentPublicKeySignaturePair& pair, std::vector<RawBuffer>&& buffers) {
+			return { pair.ParentPublicKey.copyTo<Key>(), pair.Signature.copyTo<Signature>(), std::move(buffers) };
+		}
+	}
+
+	std::vector<bool> VerifyMulti(
+			const RandomFiller& randomFiller,
+			const BmTreeSignatureInput* pSignatureInputs,
+			size_t count,
+			BmVerificationCache& verificationCache) {
+		std::vector<bool> results(count, true);
+		std::vector<Hash256> signatureHashes(count);
+
+		// keyIds need stable addresses because bound signature buffers point to them
+		std::vector<uint64_t> keyIds(count);
+		std::vector<PendingSignature> pendingSignatures;
+		std::vector<std::pair<size_t, bool>> pendingIndexes; // (input index, is bound signature)
+		pendingSignatures.reserve(2 * count);
+		for (auto i = 0u; i < count; ++i) {
+			const auto& input = pSignatureInputs[i];
+			signatureHashes[i] = CalculateSignatureHash(input.Signature, input.KeyIdentifier, input.Buffer);
+			if (verificationCache.containsSignature(signatureHashes[i], input.KeyIdentifier))
+				continue;
+
+			keyIds[i] = input.KeyIdentifier.KeyId;
+			if (!ContainsBinding(verificationCache, input.Signature, input.KeyIdentifier)) {
+				const auto& bottomPublicKey = input.Signature.Bottom.ParentPublicKey;
+				pendingSignatures.push_back(ToPendingSignature(input.Signature.Root, { bottomPublicKey, ToBuffer(keyIds[i]) }));
+				pendingIndexes.emplace_back(i, true);
+			}
+
+			pendingSignatures.push_back(ToPendingSignature(input.Signature.Bottom, { input.Buffer }));
+			pendingIndexes.emplace_back(i, false);
+		}
+
+		if (pendingSignatures.empty())
+			return results;
+
+		std::vector<SignatureInput> signatureInputs;
+		signatureInputs.reserve(pendingSignatures.size());
+		for (const auto& pendingSignature : pendingSignatures)
+			signatureInputs.push_back({ pendingSignature.PublicKey, pendingSignature.Buffers, pendingSignature.Signature });
+
+		auto pendingResults = crypto::VerifyMulti(randomFiller, signatureInputs.data(), signatureInputs.size()).first;
+		std::vector<bool> hasPending(count, false);
+		for (auto i = 0u; i < pendingIndexes.size(); ++i) {
+			auto index = pendingIndexes[i].first;
+			hasPending[index] = true;
+			if (!pendingResults[i])
+				results[index] = false;
+		}
+
+		for (auto i = 0u; i < count; ++i) {
+			if (hasPending[i] && results[i])
+				AddVerified(verificationCache, pSignatureInputs[i].Signature, pSignatureInputs[i].KeyIdentifier, signatureHashes[i]);
+		}
+
+		return results;
+	}
+
 	// endregion
 }}
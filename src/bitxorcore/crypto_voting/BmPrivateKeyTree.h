@@ -23,7 +23,9 @@
 #pragma once
 #include "BmOptions.h"
 #include "BmTreeSignature.h"
+#include "BmVerificationCache.h"
 #include "bitxorcore/crypto/KeyPair.h"
+#include "bitxorcore/crypto/Signer.h"
 #include "bitxorcore/io/SeekableStream.h"
 #include <memory>
 
@@ -89,4 +91,33 @@ namespace bitxorcore { namespace crypto {
 
 	/// Verifies \a signature of \a buffer at \a keyIdentifier.
 	bool Verify(const BmTreeSignature& signature, const BmKeyIdentifier& keyIdentifier, const RawBuffer& buffer);
+
+	/// Verifies \a signature of \a buffer at \a keyIdentifier using and updating \a verificationCache.
+	bool Verify(
+			const BmTreeSignature& signature,
+			const BmKeyIdentifier& keyIdentifier,
+			const RawBuffer& buffer,
+			BmVerificationCache& verificationCache);
+
+	/// Input for batch verification of a two-layer Bellare-Miner signature.
+	struct BmTreeSignatureInput {
+		/// Signature.
+		const BmTreeSignature& Signature;
+
+		/// Key identifier.
+		BmKeyIdentifier KeyIdentifier;
+
+		/// Signed buffer.
+		RawBuffer Buffer;
+	};
+
+	/// Verifies all \a count signatures pointed to by \a pSignatureInputs using \a randomFiller for batch verification.
+	/// Verified components are added to \a verificationCache and already verified components are not reverified.
+	/// Returns the verification result for each individual signature.
+	/// \note Callers are expected to filter out signatures from unknown signers because every valid binding is cached.
+	std::vector<bool> VerifyMulti(
+			const RandomFiller& randomFiller,
+			const BmTreeSignatureInput* pSignatureInputs,
+			size_t count,
+			BmVerificationCache& verificationCache);
 }}
@@ -0,0 +1,122 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "BmVerificationCache.h"
+#include "bitxorcore/utils/Hashers.h"
+#include <algorithm>
+
+namespace bitxorcore { namespace crypto {
+
+	namespace {
+		using BindingKey = std::pair<VotingKey, VotingKey>;
+
+		struct BindingKeyHasher {
+			size_t operator()(const BindingKey& key) const {
+				utils::ArrayHasher<VotingKey> hasher;
+				return hasher(key.first) ^ hasher(key.second);
+			}
+		};
+	}
+
+	struct BmVerificationCache::KeyIdentifierEntries {
+		std::unordered_set<BindingKey, BindingKeyHasher> Bindings;
+		std::unordered_set<Hash256, utils::ArrayHasher<Hash256>> Signatures;
+		uint64_t LastUpdate = 0;
+	};
+
+	BmVerificationCache::BmVerificationCache(size_t maxEntriesPerKeyIdentifier)
+			: m_maxEntriesPerKeyIdentifier(maxEntriesPerKeyIdentifier)
+			, m_numUpdates(0)
+	{}
+
+	size_t BmVerificationCache::numBindings() const {
+		utils::SpinLockGuard guard(m_lock);
+		size_t count = 0;
+		for (const auto& pair : m_entries)
+			count += pair.second->Bindings.size();
+
+		return count;
+	}
+
+	size_t BmVerificationCache::numSignatures() const {
+		utils::SpinLockGuard guard(m_lock);
+		size_t count = 0;
+		for (const auto& pair : m_entries)
+			count += pair.second->Signatures.size();
+
+		return count;
+	}
+
+	bool BmVerificationCache::containsBinding(
+			const VotingKey& rootPublicKey,
+			const VotingKey& bottomPublicKey,
+			const BmKeyIdentifier& keyIdentifier) const {
+		utils::SpinLockGuard guard(m_lock);
+		auto iter = m_entries.find(keyIdentifier.KeyId);
+		return m_entries.cend() != iter && iter->second->Bindings.count(std::make_pair(rootPublicKey, bottomPublicKey));
+	}
+
+	bool BmVerificationCache::containsSignature(const Hash256& signatureHash, const BmKeyIdentifier& keyIdentifier) const {
+		utils::SpinLockGuard guard(m_lock);
+		auto iter = m_entries.find(keyIdentifier.KeyId);
+		return m_entries.cend() != iter && iter->second->Signatures.count(signatureHash);
+	}
+
+	void BmVerificationCache::addBinding(
+			const VotingKey& rootPublicKey,
+			const VotingKey& bottomPublicKey,
+			const BmKeyIdentifier& keyIdentifier) {
+		utils::SpinLockGuard guard(m_lock);
+		auto& entries = getOrCreateEntries(keyIdentifier);
+		if (entries.Bindings.size() >= m_maxEntriesPerKeyIdentifier)
+			return;
+
+		entries.Bindings.emplace(rootPublicKey, bottomPublicKey);
+	}
+
+	void BmVerificationCache::addSignature(const Hash256& signatureHash, const BmKeyIdentifier& keyIdentifier) {
+		utils::SpinLockGuard guard(m_lock);
+		auto& entries = getOrCreateEntries(keyIdentifier);
+		if (entries.Signatures.size() >= m_maxEntriesPerKeyIdentifier)
+			entries.Signatures.clear();
+
+		entries.Signatures.insert(signatureHash);
+	}
+
+	BmVerificationCache::KeyIdentifierEntries& BmVerificationCache::getOrCreateEntries(const BmKeyIdentifier& keyIdentifier) {
+		auto iter = m_entries.find(keyIdentifier.KeyId);
+		if (m_entries.cend() == iter) {
+			// evict the least recently updated key identifier, irrespective of its value, to make room for the new one
+			if (Num_Retained_Key_Identifiers == m_entries.size()) {
+				auto evictIter = std::min_element(m_entries.cbegin(), m_entries.cend(), [](const auto& lhs, const auto& rhs) {
+					return lhs.second->LastUpdate < rhs.second->LastUpdate;
+				});
+				m_entries.erase(evictIter);
+			}
+
+			iter = m_entries.emplace(keyIdentifier.KeyId, std::make_shared<KeyIdentifierEntries>()).first;
+		}
+
+		iter->second->LastUpdate = ++m_numUpdates;
+		return *iter->second;
+	}
+}}
@@ -0,0 +1,78 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "BmKeyIdentifier.h"
+#include "bitxorcore/utils/SpinLock.h"
+#include "bitxorcore/types.h"
+#include <map>
+#include <memory>
+#include <unordered_set>
+
+namespace bitxorcore { namespace crypto {
+
+	/// Thread safe cache of verified two-layer Bellare-Miner signature components.
+	/// \note Root to bottom key bindings are identical for all signatures created by the same tree at the same key identifier,
+	///       so they only need to be verified once per key identifier.
+	/// \note Only components associated with the most recently updated key identifiers are retained.
+	class BmVerificationCache {
+	public:
+		/// Number of (most recently updated) key identifiers for which components are retained.
+		static constexpr size_t Num_Retained_Key_Identifiers = 2;
+
+	public:
+		/// Creates a cache that retains at most \a maxEntriesPerKeyIdentifier bindings and signatures per key identifier.
+		explicit BmVerificationCache(size_t maxEntriesPerKeyIdentifier);
+
+	public:
+		/// Gets the number of cached bindings.
+		size_t numBindings() const;
+
+		/// Gets the number of cached signatures.
+		size_t numSignatures() const;
+
+	public:
+		/// Returns \c true if the binding of \a bottomPublicKey to \a rootPublicKey at \a keyIdentifier has been verified.
+		bool containsBinding(const VotingKey& rootPublicKey, const VotingKey& bottomPublicKey, const BmKeyIdentifier& keyIdentifier) const;
+
+		/// Returns \c true if the signature with \a signatureHash at \a keyIdentifier has been verified.
+		bool containsSignature(const Hash256& signatureHash, const BmKeyIdentifier& keyIdentifier) const;
+
+		/// Adds the verified binding of \a bottomPublicKey to \a rootPublicKey at \a keyIdentifier.
+		void addBinding(const VotingKey& rootPublicKey, const VotingKey& bottomPublicKey, const BmKeyIdentifier& keyIdentifier);
+
+		/// Adds the verified signature with \a signatureHash at \a keyIdentifier.
+		/// \note Signatures are typically only looked up once, so all signatures are dropped when the limit is reached.
+		void addSignature(const Hash256& signatureHash, const BmKeyIdentifier& keyIdentifier);
+
+	private:
+		struct KeyIdentifierEntries;
+
+		KeyIdentifierEntries& getOrCreateEntries(const BmKeyIdentifier& keyIdentifier);
+
+	private:
+		size_t m_maxEntriesPerKeyIdentifier;
+		uint64_t m_numUpdates;
+		std::map<uint64_t, std::shared_ptr<KeyIdentifierEntries>> m_entries;
+		mutable utils::SpinLock m_lock;
+	};
+}}
@@ -118,7 +118,8 @@ namespace bitxorcore { namespace deltaset {
 			if (!pDelta)
 				BITXORCORE_THROW_RUNTIME_ERROR("attempting to commit changes to a set without any outstanding attached deltas");
 
-			auto deltas = pDelta->deltas();
+			// elements are moved out of the delta because it is reset immediately after commit
+			auto deltas = pDelta->movableDeltas();
 			TCommitPolicy::Update(m_elements, deltas, std::forward<TArgs>(args)...);
 			pDelta->reset();
 		}
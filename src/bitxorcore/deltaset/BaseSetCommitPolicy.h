@@ -22,10 +22,22 @@
 
 #pragma once
 #include "DeltaElements.h"
+#include "bitxorcore/utils/traits/StlTraits.h"
 #include "bitxorcore/exceptions.h"
+#include <iterator>
+#include <type_traits>
 
 namespace bitxorcore { namespace deltaset {
 
+	namespace detail {
+		/// If TSet is a map with move assignable values, this struct will provide the member constant value equal to \c true.
+		template<typename TSet, bool IsMap = utils::traits::is_map_v<TSet>>
+		struct SupportsInPlaceValueUpdate : std::false_type {};
+
+		template<typename TSet>
+		struct SupportsInPlaceValueUpdate<TSet, true> : std::is_move_assignable<typename TSet::mapped_type> {};
+	}
+
 	/// Applies all changes in \a deltas to \a elements.
 	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet>
 	void UpdateSet(TStorageSet& elements, const DeltaElements<TMemorySet>& deltas) {
@@ -45,6 +57,44 @@ namespace bitxorcore { namespace deltaset {
 			elements.erase(TKeyTraits::ToKey(element));
 	}
 
+	/// Applies all changes in \a deltas to \a elements by moving added and copied elements out of \a deltas.
+	/// \note When \a elements and \a deltas have the same set type, nodes are spliced instead of being reallocated.
+	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet>
+	void UpdateSet(TStorageSet& elements, const MovableDeltaElements<TMemorySet>& deltas) {
+		constexpr auto Is_Same_Set_Type = std::is_same_v<TStorageSet, TMemorySet>;
+
+		if (!deltas.Added.empty()) {
+			if constexpr (Is_Same_Set_Type)
+				elements.merge(deltas.Added);
+			else
+				elements.insert(std::make_move_iterator(deltas.Added.begin()), std::make_move_iterator(deltas.Added.end()));
+		}
+
+		for (auto copiedIter = deltas.Copied.begin(); deltas.Copied.end() != copiedIter;) {
+			auto iter = elements.find(TKeyTraits::ToKey(*copiedIter));
+			if (elements.end() == iter)
+				BITXORCORE_THROW_INVALID_ARGUMENT("element not found, cannot update");
+
+			if constexpr (detail::SupportsInPlaceValueUpdate<TStorageSet>::value) {
+				// map values can be replaced in place, which leaves the original node untouched
+				iter->second = std::move(copiedIter->second);
+				++copiedIter;
+			} else if constexpr (Is_Same_Set_Type) {
+				iter = elements.erase(iter);
+				auto nextCopiedIter = std::next(copiedIter);
+				elements.insert(iter, deltas.Copied.extract(copiedIter));
+				copiedIter = nextCopiedIter;
+			} else {
+				iter = elements.erase(iter);
+				elements.insert(iter, std::move(*copiedIter));
+				++copiedIter;
+			}
+		}
+
+		for (const auto& element : deltas.Removed)
+			elements.erase(TKeyTraits::ToKey(element));
+	}
+
 	/// Default policy for committing changes to a base set.
 	template<typename TSetTraits>
 	struct BaseSetCommitPolicy {
@@ -52,5 +102,10 @@ namespace bitxorcore { namespace deltaset {
 		static void Update(typename TSetTraits::SetType& elements, const DeltaElements<typename TSetTraits::MemorySetType>& deltas) {
 			UpdateSet<typename TSetTraits::KeyTraits>(elements, deltas);
 		}
+
+		/// Applies all changes in \a deltas to \a elements by moving them out of \a deltas.
+		static void Update(typename TSetTraits::SetType& elements, const MovableDeltaElements<typename TSetTraits::MemorySetType>& deltas) {
+			UpdateSet<typename TSetTraits::KeyTraits>(elements, deltas);
+		}
 	};
 }}
@@ -307,6 +307,12 @@ namespace bitxorcore { namespace deltaset {
 			return DeltaElements<MemorySetType>(m_addedElements, m_removedElements, m_copiedElements);
 		}
 
+		/// Gets a structure containing mutable references to the pending modifications.
+		/// \note This is intended for commits that consume all pending modifications before calling reset.
+		MovableDeltaElements<MemorySetType> movableDeltas() {
+			return MovableDeltaElements<MemorySetType>(m_addedElements, m_removedElements, m_copiedElements);
+		}
+
 		/// Resets all pending modifications.
 		void reset() {
 			m_addedElements.clear();
@@ -165,6 +165,14 @@ namespace bitxorcore { namespace deltaset {
 				UpdateSet<TKeyTraits>(*m_pContainer2, deltas);
 		}
 
+		/// Applies all changes in \a deltas to the underlying container, moving elements out of \a deltas when it is memory-based.
+		void update(const MovableDeltaElements<MemorySetType>& deltas) {
+			if (m_pContainer1)
+				UpdateSet<TKeyTraits>(*m_pContainer1, deltas.asConst());
+			else
+				UpdateSet<TKeyTraits>(*m_pContainer2, deltas);
+		}
+
 		/// Optionally prunes underlying container using \a pruningBoundary.
 		template<typename TPruningBoundary>
 		void prune(const TPruningBoundary& pruningBoundary) {
@@ -211,6 +219,13 @@ namespace bitxorcore { namespace deltaset {
 		container.update(deltas);
 	}
 
+	/// Applies all changes in \a deltas to \a container by moving elements out of \a deltas.
+	/// \note Specialization for ConditionalContainer.
+	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet>
+	void UpdateSet(ConditionalContainer<TKeyTraits, TStorageSet, TMemorySet>& container, const MovableDeltaElements<TMemorySet>& deltas) {
+		container.update(deltas);
+	}
+
 	/// Optionally prunes \a elements using \a pruningBoundary, which indicates the upper bound of elements to remove.
 	/// \note Specialization for ConditionalContainer.
 	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet, typename TPruningBoundary>
@@ -51,4 +51,38 @@ namespace bitxorcore { namespace deltaset {
 		/// Copied elements.
 		const TSet& Copied;
 	};
+
+	/// Slim wrapper around changed elements that allows them to be moved out when committing.
+	/// \note All sets are left in a valid but unspecified state after being consumed and must be cleared before reuse.
+	template<typename TSet>
+	struct MovableDeltaElements {
+	public:
+		/// Creates new movable delta elements from \a addedElements, \a removedElements and \a copiedElements.
+		constexpr MovableDeltaElements(TSet& addedElements, TSet& removedElements, TSet& copiedElements)
+				: Added(addedElements)
+				, Removed(removedElements)
+				, Copied(copiedElements)
+		{}
+
+	public:
+		/// Returns \c true if there are any pending changes.
+		bool HasChanges() const {
+			return !(Added.empty() && Copied.empty() && Removed.empty());
+		}
+
+		/// Gets a const view of the pending changes.
+		DeltaElements<TSet> asConst() const {
+			return DeltaElements<TSet>(Added, Removed, Copied);
+		}
+
+	public:
+		/// Added elements.
+		TSet& Added;
+
+		/// Removed elements.
+		TSet& Removed;
+
+		/// Copied elements.
+		TSet& Copied;
+	};
 }}
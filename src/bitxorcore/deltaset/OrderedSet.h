@@ -41,10 +41,10 @@ namespace bitxorcore { namespace deltaset {
 		/// Policy for committing changes to an ordered set.
 		template<typename TSetTraits>
 		struct OrderedSetCommitPolicy {
-			template<typename TPruningBoundary>
+			template<typename TDeltaElements, typename TPruningBoundary>
 			static void Update(
 					typename TSetTraits::SetType& elements,
-					const DeltaElements<typename TSetTraits::MemorySetType>& deltas,
+					const TDeltaElements& deltas,
 					const TPruningBoundary& pruningBoundary) {
 				UpdateSet<typename TSetTraits::KeyTraits>(elements, deltas);
 
@@ -24,6 +24,7 @@
 #include "ConsumerEntry.h"
 #include "bitxorcore/thread/ThreadInfo.h"
 #include "bitxorcore/utils/Functional.h"
+#include "bitxorcore/utils/StackTimer.h"
 #include <thread>
 
 namespace bitxorcore { namespace disruptor {
@@ -67,7 +68,8 @@ namespace bitxorcore { namespace disruptor {
 		auto currentLevel = 0u;
 		for (const auto& consumer : consumers) {
 			ConsumerEntry consumerEntry(currentLevel++);
-			m_threads.spawn([pThis = this, consumerEntry, consumer]() mutable {
+			m_consumerLatencies.push_back(std::make_unique<utils::LatencyHistogram>());
+			m_threads.spawn([pThis = this, consumerEntry, consumer, pLatencies = m_consumerLatencies.back().get()]() mutable {
 				thread::SetThreadName(std::to_string(consumerEntry.level()) + " " + pThis->name());
 				while (pThis->m_keepRunning) {
 					auto* pDisruptorElement = pThis->tryNext(consumerEntry);
@@ -76,7 +78,9 @@ namespace bitxorcore { namespace disruptor {
 						continue;
 					}
 
+					utils::StackTimer stopwatch;
 					auto result = consumer(pDisruptorElement->input());
+					pLatencies->record(stopwatch.micros());
 					if (CompletionStatus::Aborted == result.CompletionStatus)
 						pThis->m_disruptor.markSkipped(consumerEntry.position(), result);
 
@@ -117,6 +121,10 @@ namespace bitxorcore { namespace disruptor {
 		return utils::FileSize::FromBytes(m_memorySize.load());
 	}
 
+	const utils::LatencyHistogram& ConsumerDispatcher::consumerLatencies(size_t index) const {
+		return *m_consumerLatencies[index];
+	}
+
 	DisruptorElement* ConsumerDispatcher::tryNext(ConsumerEntry& consumerEntry) {
 		while (true) {
 			auto consumerBarrierPosition = m_barriers[consumerEntry.level()].position();
@@ -26,6 +26,7 @@
 #include "DisruptorConsumer.h"
 #include "DisruptorInspector.h"
 #include "bitxorcore/thread/ThreadGroup.h"
+#include "bitxorcore/utils/LatencyHistogram.h"
 #include "bitxorcore/utils/NamedObject.h"
 #include <atomic>
 
@@ -75,6 +76,9 @@ namespace bitxorcore { namespace disruptor {
 		/// Gets the cumulative size of all elements currently in the disruptor.
 		utils::FileSize memorySize() const;
 
+		/// Gets the processing latencies of the consumer at \a index.
+		const utils::LatencyHistogram& consumerLatencies(size_t index) const;
+
 	private:
 		DisruptorElement* tryNext(ConsumerEntry& consumerEntry);
 
@@ -93,6 +97,7 @@ namespace bitxorcore { namespace disruptor {
 		thread::ThreadGroup m_threads;
 		std::atomic<size_t> m_numActiveElements;
 		std::atomic<uint64_t> m_memorySize;
+		std::vector<std::unique_ptr<utils::LatencyHistogram>> m_consumerLatencies;
 
 		utils::SpinLock m_addSpinLock; // lock to serialize access to Disruptor::add
 	};
@@ -22,51 +22,57 @@
 
 #pragma once
 #include "bitxorcore/model/ChainScore.h"
-#include "bitxorcore/utils/SpinReaderWriterLock.h"
+#include "bitxorcore/utils/EpochSnapshot.h"
+#include <mutex>
 
 namespace bitxorcore { namespace extensions {
 
 	/// Chain score stored by the local node.
-	/// \note This score is synchronized by a reader writer lock.
+	/// \note This score is published as an epoch snapshot, so readers never contend with each other or block on a lock.
 	class LocalNodeChainScore {
 	public:
 		/// Creates a default local node chain score.
 		LocalNodeChainScore() = default;
 
 		/// Creates a local node chain score around \a score.
-		explicit LocalNodeChainScore(const model::ChainScore& score) : m_score (score)
+		explicit LocalNodeChainScore(const model::ChainScore& score) : m_score(model::ChainScore(score))
 		{}
 
 	public:
 		/// Gets the current chain score.
 		model::ChainScore get() const {
-			auto readLock = m_lock.acquireReader();
-			return m_score;
+			return m_score.get();
 		}
 
 		/// Sets the current chain score to \a score.
 		void set(const model::ChainScore& score) {
-			auto writeLock = m_lock.acquireWriter();
-			m_score = score;
+			std::lock_guard<std::mutex> guard(m_writeMutex);
+			m_score.publish(model::ChainScore(score));
 		}
 
 	public:
 		/// Adds \a rhs to this chain score.
 		LocalNodeChainScore& operator+=(const model::ChainScore& rhs) {
-			auto writeLock = m_lock.acquireWriter();
-			m_score += rhs;
-			return *this;
+			return update([&rhs](auto& score) { score += rhs; });
 		}
 
 		/// Adds \a rhs to this chain score.
 		LocalNodeChainScore& operator+=(model::ChainScore::Delta rhs) {
-			auto writeLock = m_lock.acquireWriter();
-			m_score += rhs;
+			return update([rhs](auto& score) { score += rhs; });
+		}
+
+	private:
+		template<typename TModifier>
+		LocalNodeChainScore& update(TModifier modifier) {
+			std::lock_guard<std::mutex> guard(m_writeMutex);
+			auto score = m_score.get();
+			modifier(score);
+			m_score.publish(std::move(score));
 			return *this;
 		}
 
 	private:
-		model::ChainScore m_score;
-		mutable utils::SpinReaderWriterLock m_lock;
+		utils::EpochSnapshot<model::ChainScore> m_score;
+		std::mutex m_writeMutex;
 	};
 }}
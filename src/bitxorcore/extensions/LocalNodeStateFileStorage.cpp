@@ -32,8 +32,10 @@
 #include "bitxorcore/consumers/BlockchainSyncHandlers.h"
 #include "bitxorcore/io/BlockStorageCache.h"
 #include "bitxorcore/io/BufferedFileStream.h"
+#include "bitxorcore/io/ChecksummedChunkStream.h"
 #include "bitxorcore/io/FilesystemUtils.h"
 #include "bitxorcore/io/IndexFile.h"
+#include "bitxorcore/io/PodIoUtils.h"
 #include "bitxorcore/plugins/PluginManager.h"
 #include "bitxorcore/utils/StackLogger.h"
 
@@ -67,6 +69,30 @@ namespace bitxorcore { namespace extensions {
 			return io::BufferedInputFileStream(io::RawFile(directory.file(filename), io::OpenMode::Read_Only));
 		}
 
+		bool IsChecksummedChunkFile(io::RawFile& rawFile) {
+			if (rawFile.size() < sizeof(uint64_t))
+				return false;
+
+			auto magic = io::Read64(rawFile);
+			rawFile.seek(0);
+			return io::Checksummed_Chunk_Stream_Magic == magic;
+		}
+
+		void LoadStorageFromDirectory(const config::BitxorCoreDirectory& directory, cache::CacheStorage& storage) {
+			// detect format by header so that state saved with any chunk size (or none) can be loaded
+			io::RawFile rawFile(directory.file(GetStorageFilename(storage)), io::OpenMode::Read_Only);
+			auto isChunked = IsChecksummedChunkFile(rawFile);
+
+			io::BufferedInputFileStream inputStream(std::move(rawFile));
+			if (!isChunked) {
+				storage.loadAll(inputStream, Default_Loader_Batch_Size);
+				return;
+			}
+
+			io::ChecksummedChunkInputStream chunkedInputStream(inputStream);
+			storage.loadAll(chunkedInputStream, Default_Loader_Batch_Size);
+		}
+
 		void LoadDependentStateFromDirectory(
 				const config::BitxorCoreDirectory& directory,
 				cache::BitxorCoreCache& cache,
@@ -104,10 +130,8 @@ namespace bitxorcore { namespace extensions {
 
 			// 1. load cache data
 			utils::StackLogger stopwatch("load state", utils::LogLevel::important);
-			for (const auto& pStorage : cache.storages()) {
-				auto inputStream = OpenInputStream(directory, GetStorageFilename(*pStorage));
-				pStorage->loadAll(inputStream, Default_Loader_Batch_Size);
-			}
+			for (const auto& pStorage : cache.storages())
+				LoadStorageFromDirectory(directory, *pStorage);
 
 			// 2. load supplemental data
 			LoadDependentStateFromDirectory(directory, cache, supplementalData);
@@ -146,6 +170,7 @@ namespace bitxorcore { namespace extensions {
 
 		void SaveStateToDirectory(
 				const config::BitxorCoreDirectory& directory,
+				const utils::FileSize& chunkSize,
 				const std::vector<std::unique_ptr<const cache::CacheStorage>>& cacheStorages,
 				const state::BitxorCoreState& state,
 				const model::ChainScore& score,
@@ -157,7 +182,14 @@ namespace bitxorcore { namespace extensions {
 			// 2. save cache data
 			for (const auto& pStorage : cacheStorages) {
 				auto outputStream = OpenOutputStream(directory, GetStorageFilename(*pStorage));
-				save(*pStorage, outputStream);
+				if (utils::FileSize() == chunkSize) {
+					save(*pStorage, outputStream);
+					continue;
+				}
+
+				io::ChecksummedChunkOutputStream chunkedOutputStream(outputStream, chunkSize.bytes32());
+				save(*pStorage, chunkedOutputStream);
+				chunkedOutputStream.flush();
 			}
 
 			// 3. save supplemental data
@@ -167,7 +199,9 @@ namespace bitxorcore { namespace extensions {
 		}
 	}
 
-	LocalNodeStateSerializer::LocalNodeStateSerializer(const config::BitxorCoreDirectory& directory) : m_directory(directory)
+	LocalNodeStateSerializer::LocalNodeStateSerializer(const config::BitxorCoreDirectory& directory, const utils::FileSize& chunkSize)
+			: m_directory(directory)
+			, m_chunkSize(chunkSize)
 	{}
 
 	void LocalNodeStateSerializer::save(const cache::BitxorCoreCache& cache, const model::ChainScore& score) const {
@@ -175,9 +209,10 @@ namespace bitxorcore { namespace extensions {
 		auto cacheView = cache.createView();
 		const auto& state = cacheView.dependentState();
 		auto height = cacheView.height();
-		SaveStateToDirectory(m_directory, cacheStorages, state, score, height, [&cacheView](const auto& storage, auto& outputStream) {
+		auto save = [&cacheView](const auto& storage, auto& outputStream) {
 			storage.saveAll(cacheView, outputStream);
-		});
+		};
+		SaveStateToDirectory(m_directory, m_chunkSize, cacheStorages, state, score, height, save);
 	}
 
 	void LocalNodeStateSerializer::save(
@@ -186,9 +221,10 @@ namespace bitxorcore { namespace extensions {
 			const model::ChainScore& score,
 			Height height) const {
 		const auto& state = cacheDelta.dependentState();
-		SaveStateToDirectory(m_directory, cacheStorages, state, score, height, [&cacheDelta](const auto& storage, auto& outputStream) {
+		auto save = [&cacheDelta](const auto& storage, auto& outputStream) {
 			storage.saveSummary(cacheDelta, outputStream);
-		});
+		};
+		SaveStateToDirectory(m_directory, m_chunkSize, cacheStorages, state, score, height, save);
 	}
 
 	void LocalNodeStateSerializer::moveTo(const config::BitxorCoreDirectory& destinationDirectory) {
@@ -214,7 +250,7 @@ namespace bitxorcore { namespace extensions {
 			const model::ChainScore& score) {
 		SetCommitStep(dataDirectory, consumers::CommitOperationStep::Blocks_Written);
 
-		LocalNodeStateSerializer serializer(dataDirectory.dir("state.tmp"));
+		LocalNodeStateSerializer serializer(dataDirectory.dir("state.tmp"), nodeConfig.StateFileChunkSize);
 
 		if (nodeConfig.EnableCacheDatabaseStorage) {
 			auto storages = const_cast<const cache::BitxorCoreCache&>(cache).storages();
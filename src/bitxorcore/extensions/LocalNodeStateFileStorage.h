@@ -22,6 +22,7 @@
 
 #pragma once
 #include "bitxorcore/config/BitxorCoreDataDirectory.h"
+#include "bitxorcore/utils/FileSize.h"
 #include "bitxorcore/types.h"
 
 namespace bitxorcore {
@@ -63,8 +64,9 @@ namespace bitxorcore { namespace extensions {
 	/// Serializes local node state.
 	class LocalNodeStateSerializer {
 	public:
-		/// Creates a serializer around specified \a directory.
-		explicit LocalNodeStateSerializer(const config::BitxorCoreDirectory& directory);
+		/// Creates a serializer around specified \a directory that saves cache data in checksummed chunks of \a chunkSize.
+		/// \note Cache data is saved without chunks when \a chunkSize is zero.
+		LocalNodeStateSerializer(const config::BitxorCoreDirectory& directory, const utils::FileSize& chunkSize);
 
 	public:
 		/// Saves state composed of \a cache and \a score.
@@ -82,6 +84,7 @@ namespace bitxorcore { namespace extensions {
 
 	private:
 		config::BitxorCoreDirectory m_directory;
+		utils::FileSize m_chunkSize;
 	};
 
 	/// Serializes state composed of \a cache and \a score with checkpointing to \a dataDirectory given \a nodeConfig.
@@ -21,6 +21,8 @@
 **/
 
 #include "NodeInteractionUtils.h"
+#include "NodeSelector.h"
+#include "bitxorcore/api/RemoteChainApi.h"
 #include "bitxorcore/ionet/NodeContainer.h"
 #include "bitxorcore/ionet/NodeInteractionResult.h"
 
@@ -32,4 +34,22 @@ namespace bitxorcore { namespace extensions {
 		else if (ionet::NodeInteractionResultCode::Failure == result.Code)
 			nodes.modifier().incrementFailures(result.Identity);
 	}
+
+	void RecordTransferMeasurement(
+			ionet::NodeContainer& nodes,
+			const model::NodeIdentity& identity,
+			const api::RemoteRequestMeasurement& measurement) {
+		// responses without a size are dominated by latency
+		if (0 == measurement.NumBytes)
+			nodes.modifier().recordRoundTrip(identity, measurement.ElapsedMicros);
+		else
+			nodes.modifier().recordThroughput(identity, measurement.NumBytes, measurement.ElapsedMicros);
+	}
+
+	uint32_t GetNodeTransferWeight(const ionet::NodeContainer& nodes, const ionet::Node& node) {
+		auto view = nodes.view();
+		return view.contains(node.identity())
+				? CalculateTransferWeight(view.getNodeInfo(node.identity()).transferStatistics())
+				: CalculateTransferWeight(ionet::NodeTransferStatistics());
+	}
 }}
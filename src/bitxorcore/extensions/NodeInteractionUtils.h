@@ -21,16 +21,29 @@
 **/
 
 #pragma once
+#include <stdint.h>
 
 namespace bitxorcore {
+	namespace api { struct RemoteRequestMeasurement; }
 	namespace ionet {
+		class Node;
 		class NodeContainer;
 		struct NodeInteractionResult;
 	}
+	namespace model { struct NodeIdentity; }
 }
 
 namespace bitxorcore { namespace extensions {
 
 	/// Increments the interaction counter indicated by \a result in the node container (\a nodes).
 	void IncrementNodeInteraction(ionet::NodeContainer& nodes, const ionet::NodeInteractionResult& result);
+
+	/// Records the \a measurement of a request sent to the node identified by \a identity in the node container (\a nodes).
+	void RecordTransferMeasurement(
+			ionet::NodeContainer& nodes,
+			const model::NodeIdentity& identity,
+			const api::RemoteRequestMeasurement& measurement);
+
+	/// Gets the transfer weight of \a node based on the transfer statistics in the node container (\a nodes).
+	uint32_t GetNodeTransferWeight(const ionet::NodeContainer& nodes, const ionet::Node& node);
 }}
@@ -39,6 +39,8 @@ namespace bitxorcore { namespace extensions {
 			}
 		}
 
+		constexpr uint32_t Neutral_Transfer_Weight = 5'000;
+
 		using NodeScorePairs = std::vector<std::pair<ionet::Node, uint32_t>>;
 
 		struct ServiceNodesInfo {
@@ -80,9 +82,12 @@ namespace bitxorcore { namespace extensions {
 					nodesInfo.Actives.emplace_back(node, pConnectionState->Age);
 				} else {
 					auto interactions = nodeInfo.interactions(timestamp);
-					auto weight = CalculateWeight(interactions, generator(), [importanceRetriever, &node]() {
+					uint64_t weight = CalculateWeight(interactions, generator(), [importanceRetriever, &node]() {
 						return importanceRetriever(node.identity().PublicKey);
 					});
+
+					// scale the weight by the measured transfer speed relative to an unmeasured node (0.1x - 2x)
+					weight = weight * CalculateTransferWeight(nodeInfo.transferStatistics()) / Neutral_Transfer_Weight;
 					nodesInfo.Candidates.emplace_back(node, weight * weightMultiplier);
 					nodesInfo.TotalCandidateWeight += nodesInfo.Candidates.back().Weight;
 				}
@@ -149,6 +154,22 @@ namespace bitxorcore { namespace extensions {
 		}
 	}
 
+	uint32_t CalculateTransferWeight(const ionet::NodeTransferStatistics& transferStatistics) {
+		// return a weight in range of 500..10'000
+		uint64_t rawWeight;
+		if (0 != transferStatistics.NumThroughputSamples) {
+			// a node transferring 500 KB/s has neutral weight
+			rawWeight = transferStatistics.BytesPerSecond / 100;
+		} else if (0 != transferStatistics.NumRoundTripSamples) {
+			// a node responding in 100ms has neutral weight
+			rawWeight = Neutral_Transfer_Weight * 100'000 / std::max<uint64_t>(1, transferStatistics.RoundTripMicros);
+		} else {
+			return Neutral_Transfer_Weight;
+		}
+
+		return static_cast<uint32_t>(std::max<uint64_t>({ 500, std::min<uint64_t>({ 10'000, rawWeight }) }));
+	}
+
 	ionet::NodeSet SelectCandidatesBasedOnWeight(
 			const WeightedCandidates& candidates,
 			uint64_t totalCandidateWeight,
@@ -160,6 +160,10 @@ namespace bitxorcore { namespace extensions {
 			WeightPolicy weightPolicy,
 			const supplier<ImportanceDescriptor>& importanceSupplier);
 
+	/// Calculates the weight from measured \a transferStatistics.
+	/// \note Unmeasured nodes are assigned the neutral weight \c 5'000; faster nodes have higher weights.
+	uint32_t CalculateTransferWeight(const ionet::NodeTransferStatistics& transferStatistics);
+
 	/// Finds at most \a maxCandidates add candidates from container \a candidates given a
 	/// total candidate weight (\a totalCandidateWeight).
 	ionet::NodeSet SelectCandidatesBasedOnWeight(
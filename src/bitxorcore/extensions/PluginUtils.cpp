@@ -34,6 +34,7 @@ namespace bitxorcore { namespace extensions {
 		storageConfig.PreferCacheDatabase = config.Node.EnableCacheDatabaseStorage;
 		storageConfig.CacheDatabaseDirectory = (std::filesystem::path(config.User.DataDirectory) / "statedb").generic_string();
 		storageConfig.CacheDatabaseConfig = config.Node.CacheDatabase;
+		storageConfig.MaxStatePathKeysPerRequest = config.Node.MaxStatePathKeysPerRequest;
 		return storageConfig;
 	}
 
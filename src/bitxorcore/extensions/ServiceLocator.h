@@ -81,6 +81,14 @@ namespace bitxorcore { namespace extensions {
 			return pService;
 		}
 
+		/// Gets the service with \a serviceName or \c nullptr if it is not registered.
+		template<typename TService>
+		std::shared_ptr<TService> tryService(const std::string& serviceName) const {
+			std::shared_ptr<TService> pService;
+			tryGetService(serviceName, pService);
+			return pService;
+		}
+
 	public:
 		/// Adds a service (\a pService) with \a serviceName.
 		void registerService(const std::string& serviceName, const std::shared_ptr<void>& pService) {
@@ -53,6 +53,36 @@ namespace bitxorcore { namespace extensions {
 		};
 	}
 
+	/// Creates a synchronizer task callback for \a synchronizer named \a taskName that does not require the local chain to be synced
+	/// and interacts with up to \a maxPeers peers at once.
+	/// \a packetIoPicker is used to select peers, which are ranked by their measured transfer speed, and \a remoteApiFactory wraps
+	/// a single api around all selected peers. \a state provides additional service information.
+	template<typename TRemoteApi, typename TRemoteApiFactory>
+	thread::TaskCallback CreateMultiPeerSynchronizerTaskCallback(
+			chain::RemoteNodeSynchronizer<TRemoteApi>&& synchronizer,
+			TRemoteApiFactory remoteApiFactory,
+			net::PacketIoPicker& packetIoPicker,
+			const extensions::ServiceState& state,
+			const std::string& taskName,
+			size_t maxPeers) {
+		auto syncTimeout = state.config().Node.SyncTimeout;
+		chain::RemoteApiForwarder forwarder(packetIoPicker, state.pluginManager().transactionRegistry(), syncTimeout, taskName);
+
+		auto syncHandler = [&nodes = state.nodes()](auto&& future) {
+			auto result = future.get();
+			IncrementNodeInteraction(nodes, result);
+			return thread::TaskResult::Continue;
+		};
+
+		auto peerScorer = [&nodes = state.nodes()](const auto& node) {
+			return GetNodeTransferWeight(nodes, node);
+		};
+
+		return [forwarder, syncHandler, synchronizer, remoteApiFactory, maxPeers, peerScorer]() {
+			return forwarder.processSync(synchronizer, remoteApiFactory, maxPeers, peerScorer).then(syncHandler);
+		};
+	}
+
 	/// Creates a synchronizer task callback for \a synchronizer named \a taskName that requires the local chain to be synced.
 	/// \a packetIoPicker is used to select peers and \a remoteApiFactory wraps an api around peers.
 	/// \a state provides additional service information.
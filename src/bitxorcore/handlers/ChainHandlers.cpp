@@ -71,7 +71,7 @@ namespace bitxorcore { namespace handlers {
 					return;
 
 				auto pResponsePacket = ionet::CreateSharedPacket<RequestType>();
-				pResponsePacket->Height = storage.view().chainHeight();
+				pResponsePacket->Height = storage.chainHeight();
 				pResponsePacket->FinalizedHeight = finalizedHeightSupplier();
 
 				auto scoreArray = chainScoreSupplier().toArray();
@@ -163,6 +163,6 @@ namespace bitxorcore { namespace handlers {
 			ionet::ServerPacketHandlers& handlers,
 			const io::BlockStorageCache& storage,
 			const PullBlocksHandlerConfiguration& config) {
-		handlers.registerHandler(ionet::PacketType::Pull_Blocks, CreatePullBlocksHandler(storage, config));
+		handlers.registerHandler(ionet::PacketType::Pull_Blocks, CreatePullBlocksHandler(storage, config), ionet::PacketHandlerCost::Heavy);
 	}
 }}
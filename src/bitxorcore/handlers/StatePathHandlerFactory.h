@@ -22,12 +22,42 @@
 
 #pragma once
 #include "bitxorcore/ionet/Packet.h"
+#include "bitxorcore/ionet/PacketEntityUtils.h"
 #include "bitxorcore/ionet/PacketHandlers.h"
 #include "bitxorcore/tree/PatriciaTreeSerializer.h"
 #include "bitxorcore/utils/Casting.h"
+#include "bitxorcore/utils/Logging.h"
 
 namespace bitxorcore { namespace handlers {
 
+	namespace detail {
+		/// Serializes all \a nodes into a single buffer.
+		inline std::vector<uint8_t> SerializeNodes(const std::vector<tree::TreeNode>& nodes) {
+			std::vector<uint8_t> serializedNodes;
+			for (const auto& node : nodes) {
+				auto serializedNode = tree::PatriciaTreeSerializer::SerializeValue(node);
+				const auto* pData = reinterpret_cast<const uint8_t*>(serializedNode.data());
+				serializedNodes.insert(serializedNodes.end(), pData, pData + serializedNode.size());
+			}
+
+			return serializedNodes;
+		}
+
+		/// Creates a response packet of type \a type containing \a serializedNodes.
+		inline ionet::PacketPayload CreateStatePathResponse(ionet::PacketType type, const std::vector<uint8_t>& serializedNodes) {
+			auto payloadSize = utils::checked_cast<size_t, uint32_t>(serializedNodes.size());
+			auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+			pResponsePacket->Type = type;
+			utils::memcpy_cond(pResponsePacket->Data(), serializedNodes.data(), serializedNodes.size());
+			return ionet::PacketPayload(pResponsePacket);
+		}
+
+		/// Creates a response packet of type \a type containing serialized \a nodes.
+		inline ionet::PacketPayload CreateStatePathResponse(ionet::PacketType type, const std::vector<tree::TreeNode>& nodes) {
+			return CreateStatePathResponse(type, SerializeNodes(nodes));
+		}
+	}
+
 	/// Registers a handler in \a handlers that responds with serialized state path produced by querying \a cache.
 	template<typename TPacket, typename TCache>
 	void RegisterStatePathHandler(ionet::ServerPacketHandlers& handlers, const TCache& cache) {
@@ -41,18 +71,64 @@ namespace bitxorcore { namespace handlers {
 			view->tryLookup(pRequest->Key, path);
 
 			// serialize path even if lookup failed (to provide proof that key does not exist in state)
-			std::vector<uint8_t> serializedPath;
-			for (const auto& node : path) {
-				auto serializedNode = tree::PatriciaTreeSerializer::SerializeValue(node);
-				const auto* pData = reinterpret_cast<const uint8_t*>(serializedNode.data());
-				serializedPath.insert(serializedPath.end(), pData, pData + serializedNode.size());
+			context.response(detail::CreateStatePathResponse(TPacket::Packet_Type, path));
+		}, ionet::PacketHandlerCost::Heavy);
+	}
+
+	/// Registers a handler in \a handlers that responds with serialized state paths of all requested keys produced by querying \a cache.
+	/// Requests with more than \a maxKeys keys are rejected.
+	/// \note Response contains each node at most once, so paths of keys sharing a prefix share the nodes along that prefix.
+	///       When the nodes of all paths do not fit into a single packet, the response only contains the paths of the longest
+	///       prefix of the requested keys that fits.
+	template<typename TRequestTraits, typename TCache>
+	void RegisterBatchStatePathHandler(ionet::ServerPacketHandlers& handlers, const TCache& cache, uint32_t maxKeys) {
+		auto maxResponseSize = handlers.maxPacketDataSize();
+		handlers.registerHandler(TRequestTraits::Packet_Type, [&cache, maxKeys, maxResponseSize](const auto& packet, auto& context) {
+			using RequestStructureType = typename TRequestTraits::RequestStructureType;
+
+			if (TRequestTraits::Packet_Type != packet.Type)
+				return;
+
+			auto keysRange = ionet::ExtractFixedSizeStructuresFromPacket<RequestStructureType>(packet);
+			if (keysRange.empty())
+				return;
+
+			if (keysRange.size() > maxKeys) {
+				BITXORCORE_LOG(warning) << "rejecting state paths request with " << keysRange.size() << " keys (max " << maxKeys << ")";
+				return;
 			}
 
-			auto payloadSize = utils::checked_cast<size_t, uint32_t>(serializedPath.size());
-			auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
-			pResponsePacket->Type = TPacket::Packet_Type;
-			utils::memcpy_cond(pResponsePacket->Data(), serializedPath.data(), serializedPath.size());
-			context.response(ionet::PacketPayload(pResponsePacket));
-		});
+			std::vector<RequestStructureType> keys(keysRange.cbegin(), keysRange.cend());
+			auto view = cache.createView();
+			auto lookupSerializedNodes = [&keys, &view](size_t numKeys) {
+				std::vector<RequestStructureType> keysPrefix(keys.cbegin(), keys.cbegin() + static_cast<std::ptrdiff_t>(numKeys));
+				std::vector<tree::TreeNode> nodes;
+				view->tryLookupAll(keysPrefix, nodes);
+				return detail::SerializeNodes(nodes);
+			};
+
+			// serialize nodes even if some lookups failed (to provide proofs that keys do not exist in state)
+			auto serializedNodes = lookupSerializedNodes(keys.size());
+			if (serializedNodes.size() > maxResponseSize) {
+				// nodes of a prefix are a subset of the nodes of any longer prefix, so the longest fitting prefix can be bisected
+				size_t numFittingKeys = 0;
+				size_t numOverflowingKeys = keys.size();
+				serializedNodes.clear();
+				while (numOverflowingKeys - numFittingKeys > 1) {
+					auto numKeys = numFittingKeys + (numOverflowingKeys - numFittingKeys) / 2;
+					auto candidateSerializedNodes = lookupSerializedNodes(numKeys);
+					if (candidateSerializedNodes.size() > maxResponseSize) {
+						numOverflowingKeys = numKeys;
+					} else {
+						numFittingKeys = numKeys;
+						serializedNodes = std::move(candidateSerializedNodes);
+					}
+				}
+
+				BITXORCORE_LOG(debug) << "responding with state paths of " << numFittingKeys << " / " << keys.size() << " keys";
+			}
+
+			context.response(detail::CreateStatePathResponse(TRequestTraits::Packet_Type, serializedNodes));
+		}, ionet::PacketHandlerCost::Heavy);
 	}
 }}
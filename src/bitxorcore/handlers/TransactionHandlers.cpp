@@ -51,6 +51,44 @@ namespace bitxorcore { namespace handlers {
 				const auto& filter,
 				const auto& shortHashes) {
 			return utRetriever(filter.Deadline, filter.FeeMultiplier, shortHashes);
-		}));
+		}), ionet::PacketHandlerCost::Heavy);
+	}
+
+	void RegisterPushTransactionInventoryHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const TransactionInventoryRangeHandler& inventoryRangeHandler) {
+		handlers.registerHandler(ionet::PacketType::Push_Transaction_Inventory, [inventoryRangeHandler](
+				const auto& packet,
+				const auto& context) {
+			auto range = ionet::ExtractFixedSizeStructuresFromPacket<model::TransactionInventoryEntry>(packet);
+			if (range.empty()) {
+				BITXORCORE_LOG(warning) << "rejecting empty range: " << packet;
+				return;
+			}
+
+			BITXORCORE_LOG(trace) << "received valid " << packet;
+			inventoryRangeHandler({ std::move(range), { context.key(), context.host() } });
+		});
+	}
+
+	void RegisterPullAnnouncedTransactionsHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const AnnouncedTransactionsRetriever& announcedTransactionsRetriever) {
+		constexpr auto Packet_Type = ionet::PacketType::Pull_Announced_Transactions;
+		handlers.registerHandler(Packet_Type, [announcedTransactionsRetriever](const auto& packet, auto& context) {
+			auto range = ionet::ExtractFixedSizeStructuresFromPacket<utils::ShortHash>(packet);
+			if (range.empty()) {
+				BITXORCORE_LOG(warning) << "rejecting empty range: " << packet;
+				return;
+			}
+
+			utils::ShortHashesSet shortHashes;
+			shortHashes.reserve(range.size());
+			for (const auto& shortHash : range)
+				shortHashes.insert(shortHash);
+
+			auto transactions = announcedTransactionsRetriever(shortHashes);
+			context.response(ionet::PacketPayloadFactory::FromEntities(Packet_Type, transactions));
+		}, ionet::PacketHandlerCost::Heavy);
 	}
 }}
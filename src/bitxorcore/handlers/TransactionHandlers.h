@@ -25,6 +25,7 @@
 #include "bitxorcore/ionet/PacketHandlers.h"
 #include "bitxorcore/model/RangeTypes.h"
 #include "bitxorcore/model/Transaction.h"
+#include "bitxorcore/model/TransactionInventoryEntry.h"
 #include "bitxorcore/utils/ShortHash.h"
 #include <unordered_set>
 
@@ -36,6 +37,12 @@ namespace bitxorcore { namespace handlers {
 	/// Prototype for a function that retrieves unconfirmed transactions given a filter and a set of short hashes.
 	using UtRetriever = std::function<UnconfirmedTransactions (Timestamp, BlockFeeMultiplier, const utils::ShortHashesSet&)>;
 
+	/// Prototype for a function that retrieves unconfirmed transactions matching a set of announced short hashes.
+	using AnnouncedTransactionsRetriever = std::function<UnconfirmedTransactions (const utils::ShortHashesSet&)>;
+
+	/// Prototype for a function that processes a range of announced transaction inventory entries.
+	using TransactionInventoryRangeHandler = RangeHandler<model::TransactionInventoryEntry>;
+
 	/// Registers a push transactions handler in \a handlers that forwards transactions to \a transactionRangeHandler
 	/// given a transaction \a registry composed of known transactions.
 	void RegisterPushTransactionsHandler(
@@ -46,4 +53,16 @@ namespace bitxorcore { namespace handlers {
 	/// Registers a pull transactions handler in \a handlers that responds with unconfirmed transactions
 	/// returned by the retriever (\a utRetriever).
 	void RegisterPullTransactionsHandler(ionet::ServerPacketHandlers& handlers, const UtRetriever& utRetriever);
+
+	/// Registers a push transaction inventory handler in \a handlers that forwards announced transaction short hashes
+	/// to \a inventoryRangeHandler.
+	void RegisterPushTransactionInventoryHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const TransactionInventoryRangeHandler& inventoryRangeHandler);
+
+	/// Registers a pull announced transactions handler in \a handlers that responds with the unconfirmed transactions
+	/// matching the requested short hashes returned by the retriever (\a announcedTransactionsRetriever).
+	void RegisterPullAnnouncedTransactionsHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const AnnouncedTransactionsRetriever& announcedTransactionsRetriever);
 }}
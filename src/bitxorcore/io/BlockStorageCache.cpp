@@ -23,6 +23,7 @@
 #include "BlockStorageCache.h"
 #include "MoveBlockFiles.h"
 #include "bitxorcore/model/Elements.h"
+#include "bitxorcore/utils/EpochSnapshot.h"
 #include "bitxorcore/utils/MemoryUtils.h"
 
 namespace bitxorcore { namespace io {
@@ -35,36 +36,38 @@ namespace bitxorcore { namespace io {
 
 	// region CachedData
 
+	/// Most recent block element, which is published as an epoch snapshot so that it can be read without the storage lock.
 	struct CachedData {
 	public:
 		Height height() const {
-			return m_pBlockElement ? m_pBlockElement->Block.Height : Height(0);
+			auto pBlockElementGuard = m_blockElementSnapshot.read();
+			return *pBlockElementGuard ? (*pBlockElementGuard)->Block.Height : Height(0);
 		}
 
 		std::shared_ptr<const model::Block> block(Height) const {
-			return BlockElementAsSharedBlock(m_pBlockElement);
+			return BlockElementAsSharedBlock(m_blockElementSnapshot.get());
 		}
 
 		std::shared_ptr<const model::BlockElement> blockElement(Height) const {
-			return m_pBlockElement;
+			return m_blockElementSnapshot.get();
 		}
 
 	public:
 		bool contains(Height height) const {
-			return height == m_pBlockElement->Block.Height;
+			return height == this->height();
 		}
 
 	public:
 		void update(const std::shared_ptr<const model::BlockElement>& pBlockElement) {
-			m_pBlockElement = pBlockElement;
+			m_blockElementSnapshot.publish(std::shared_ptr<const model::BlockElement>(pBlockElement));
 		}
 
 		void reset() {
-			m_pBlockElement.reset();
+			m_blockElementSnapshot.publish(nullptr);
 		}
 
 	private:
-		std::shared_ptr<const model::BlockElement> m_pBlockElement;
+		utils::EpochSnapshot<std::shared_ptr<const model::BlockElement>> m_blockElementSnapshot;
 	};
 
 	// endregion
@@ -179,6 +182,14 @@ namespace bitxorcore { namespace io {
 		return BlockStorageView(*m_pStorage, std::move(readLock), *m_pCachedData);
 	}
 
+	Height BlockStorageCache::chainHeight() const {
+		return m_pCachedData->height();
+	}
+
+	std::shared_ptr<const model::BlockElement> BlockStorageCache::lastBlockElement() const {
+		return m_pCachedData->blockElement(Height());
+	}
+
 	BlockStorageModifier BlockStorageCache::modifier() {
 		auto writeLock = m_lock.acquireWriter();
 		return BlockStorageModifier(*m_pStorage, *m_pStagingStorage, std::move(writeLock), *m_pCachedData);
@@ -107,6 +107,13 @@ namespace bitxorcore { namespace io {
 		/// Gets a read only view of the storage.
 		BlockStorageView view() const;
 
+		/// Gets the chain height without acquiring the storage lock.
+		/// \note The height can be stale relative to a subsequently acquired view.
+		Height chainHeight() const;
+
+		/// Gets the most recent block element (or \c nullptr when storage is empty) without acquiring the storage lock.
+		std::shared_ptr<const model::BlockElement> lastBlockElement() const;
+
 		/// Gets a write only view of the storage.
 		BlockStorageModifier modifier();
 
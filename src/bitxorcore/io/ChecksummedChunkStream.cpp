@@ -0,0 +1,138 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "ChecksummedChunkStream.h"
+#include "PodIoUtils.h"
+#include "bitxorcore/crypto/Hashes.h"
+#include "bitxorcore/utils/Casting.h"
+#include "bitxorcore/exceptions.h"
+
+namespace bitxorcore { namespace io {
+
+	namespace {
+		Hash256 CalculateChunkChecksum(const RawBuffer& buffer) {
+			Hash256 checksum;
+			crypto::Sha3_256(buffer, checksum);
+			return checksum;
+		}
+	}
+
+	// region ChecksummedChunkOutputStream
+
+	ChecksummedChunkOutputStream::ChecksummedChunkOutputStream(OutputStream& output, uint32_t chunkSize)
+			: m_output(output)
+			, m_buffer(chunkSize)
+			, m_bufferPosition(0)
+			, m_numChunks(0) {
+		if (0 == chunkSize)
+			BITXORCORE_THROW_INVALID_ARGUMENT("chunk size must be nonzero");
+
+		Write64(m_output, Checksummed_Chunk_Stream_Magic);
+	}
+
+	size_t ChecksummedChunkOutputStream::numChunks() const {
+		return m_numChunks;
+	}
+
+	void ChecksummedChunkOutputStream::write(const RawBuffer& buffer) {
+		size_t inputPosition = 0;
+		while (inputPosition < buffer.Size) {
+			auto bytesToCopy = std::min(buffer.Size - inputPosition, m_buffer.size() - m_bufferPosition);
+			std::memcpy(m_buffer.data() + m_bufferPosition, buffer.pData + inputPosition, bytesToCopy);
+			m_bufferPosition += bytesToCopy;
+			inputPosition += bytesToCopy;
+
+			if (m_buffer.size() == m_bufferPosition)
+				writeChunk();
+		}
+	}
+
+	void ChecksummedChunkOutputStream::flush() {
+		writeChunk();
+		m_output.flush();
+	}
+
+	void ChecksummedChunkOutputStream::writeChunk() {
+		if (0 == m_bufferPosition)
+			return;
+
+		RawBuffer chunk(m_buffer.data(), m_bufferPosition);
+		Write32(m_output, static_cast<uint32_t>(chunk.Size));
+		Write8(m_output, utils::to_underlying_type(ChunkCompression::None));
+		m_output.write(CalculateChunkChecksum(chunk));
+		m_output.write(chunk);
+
+		m_bufferPosition = 0;
+		++m_numChunks;
+	}
+
+	// endregion
+
+	// region ChecksummedChunkInputStream
+
+	ChecksummedChunkInputStream::ChecksummedChunkInputStream(InputStream& input)
+			: m_input(input)
+			, m_bufferPosition(0) {
+		if (Checksummed_Chunk_Stream_Magic != Read64(m_input))
+			BITXORCORE_THROW_FILE_IO_ERROR("input is not a checksummed chunk stream");
+	}
+
+	bool ChecksummedChunkInputStream::eof() const {
+		return m_buffer.size() == m_bufferPosition && m_input.eof();
+	}
+
+	void ChecksummedChunkInputStream::read(const MutableRawBuffer& buffer) {
+		size_t outputPosition = 0;
+		while (outputPosition < buffer.Size) {
+			if (m_buffer.size() == m_bufferPosition)
+				readChunk();
+
+			auto bytesToCopy = std::min(buffer.Size - outputPosition, m_buffer.size() - m_bufferPosition);
+			std::memcpy(buffer.pData + outputPosition, m_buffer.data() + m_bufferPosition, bytesToCopy);
+			m_bufferPosition += bytesToCopy;
+			outputPosition += bytesToCopy;
+		}
+	}
+
+	void ChecksummedChunkInputStream::readChunk() {
+		if (m_input.eof())
+			BITXORCORE_THROW_FILE_IO_ERROR("checksummed chunk stream is truncated");
+
+		auto chunkSize = Read32(m_input);
+		auto compression = static_cast<ChunkCompression>(Read8(m_input));
+		if (0 == chunkSize || ChunkCompression::None != compression)
+			BITXORCORE_THROW_AND_LOG_2(bitxorcore_file_io_error, "unsupported chunk", chunkSize, static_cast<uint16_t>(compression));
+
+		Hash256 checksum;
+		m_input.read(checksum);
+
+		m_buffer.resize(chunkSize);
+		m_input.read(m_buffer);
+		m_bufferPosition = 0;
+
+		if (checksum != CalculateChunkChecksum(m_buffer))
+			BITXORCORE_THROW_FILE_IO_ERROR("checksummed chunk stream contains corrupt chunk");
+	}
+
+	// endregion
+}}
@@ -0,0 +1,96 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#pragma once
+#include "Stream.h"
+#include <vector>
+
+namespace bitxorcore { namespace io {
+
+	/// Magic value written at the start of every checksummed chunk stream ("BXCSNAP" followed by version 1).
+	/// \note Last byte is nonzero so that it can't be confused with the (64-bit) entry count prefixing unchunked state data.
+	constexpr uint64_t Checksummed_Chunk_Stream_Magic = 0x01'50'41'4E'53'43'58'42;
+
+	/// Default (uncompressed) chunk size.
+	constexpr uint32_t Default_Checksummed_Chunk_Size = 1024 * 1024;
+
+	/// Compression applied to chunk data.
+	enum class ChunkCompression : uint8_t {
+		/// Chunk data is stored uncompressed.
+		None
+	};
+
+	// region ChecksummedChunkOutputStream
+
+	/// Output stream decorator that groups written data into independently checksummed chunks.
+	/// \note Each chunk is prefixed with its size, compression and the sha3 hash of its data.
+	class ChecksummedChunkOutputStream final : public OutputStream {
+	public:
+		/// Creates a stream that writes chunks of at most \a chunkSize bytes to \a output.
+		ChecksummedChunkOutputStream(OutputStream& output, uint32_t chunkSize = Default_Checksummed_Chunk_Size);
+
+	public:
+		/// Gets the number of chunks written.
+		size_t numChunks() const;
+
+	public:
+		void write(const RawBuffer& buffer) override;
+		void flush() override;
+
+	private:
+		void writeChunk();
+
+	private:
+		OutputStream& m_output;
+		std::vector<uint8_t> m_buffer;
+		size_t m_bufferPosition;
+		size_t m_numChunks;
+	};
+
+	// endregion
+
+	// region ChecksummedChunkInputStream
+
+	/// Input stream decorator that reads and verifies data written by ChecksummedChunkOutputStream.
+	/// \note Chunks are decoded as they are consumed, so corruption and truncation are detected before partial data is used.
+	class ChecksummedChunkInputStream final : public InputStream {
+	public:
+		/// Creates a stream that reads chunks from \a input.
+		/// \throws bitxorcore_file_io_error if \a input does not start with a valid stream header.
+		explicit ChecksummedChunkInputStream(InputStream& input);
+
+	public:
+		bool eof() const override;
+		void read(const MutableRawBuffer& buffer) override;
+
+	private:
+		void readChunk();
+
+	private:
+		InputStream& m_input;
+		std::vector<uint8_t> m_buffer;
+		size_t m_bufferPosition;
+	};
+
+	// endregion
+}}
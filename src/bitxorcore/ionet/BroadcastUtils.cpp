@@ -24,6 +24,7 @@
 #include "PacketPayloadFactory.h"
 #include "bitxorcore/model/Block.h"
 #include "bitxorcore/model/BlockUtils.h"
+#include "bitxorcore/model/TransactionInventoryEntry.h"
 
 namespace bitxorcore { namespace ionet {
 
@@ -48,4 +49,15 @@ namespace bitxorcore { namespace ionet {
 		builder.appendValues(cosignatures);
 		return builder.build();
 	}
+
+	PacketPayload CreateTransactionInventoryPayload(const std::vector<model::TransactionInfo>& transactionInfos) {
+		std::vector<model::TransactionInventoryEntry> entries;
+		entries.reserve(transactionInfos.size());
+		for (const auto& transactionInfo : transactionInfos)
+			entries.push_back({ utils::ToShortHash(transactionInfo.EntityHash), transactionInfo.pEntity->Size });
+
+		PacketPayloadBuilder builder(PacketType::Push_Transaction_Inventory);
+		builder.appendValues(entries);
+		return builder.build();
+	}
 }}
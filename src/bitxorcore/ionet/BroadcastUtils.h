@@ -39,4 +39,7 @@ namespace bitxorcore { namespace ionet {
 
 	/// Creates a payload around \a cosignatures for broadcasting.
 	PacketPayload CreateBroadcastPayload(const std::vector<model::DetachedCosignature>& cosignatures);
+
+	/// Creates a payload announcing the short hashes and sizes of \a transactionInfos for broadcasting.
+	PacketPayload CreateTransactionInventoryPayload(const std::vector<model::TransactionInfo>& transactionInfos);
 }}
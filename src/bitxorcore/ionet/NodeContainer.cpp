@@ -223,6 +223,16 @@ namespace bitxorcore { namespace ionet {
 		incrementInteraction(identity, [timestamp](auto& nodeInfo) { nodeInfo.incrementFailures(timestamp); });
 	}
 
+	void NodeContainerModifier::recordRoundTrip(const model::NodeIdentity& identity, uint64_t roundTripMicros) {
+		incrementInteraction(identity, [roundTripMicros](auto& nodeInfo) { nodeInfo.recordRoundTrip(roundTripMicros); });
+	}
+
+	void NodeContainerModifier::recordThroughput(const model::NodeIdentity& identity, uint64_t numBytes, uint64_t elapsedMicros) {
+		incrementInteraction(identity, [numBytes, elapsedMicros](auto& nodeInfo) {
+			nodeInfo.recordThroughput(numBytes, elapsedMicros);
+		});
+	}
+
 	void NodeContainerModifier::ban(const model::NodeIdentity& identity, uint32_t reason) {
 		m_bannedNodes.add(identity, reason);
 	}
@@ -111,6 +111,12 @@ namespace bitxorcore { namespace ionet {
 		/// Increments the number of failed interactions for the node identified by \a identity.
 		void incrementFailures(const model::NodeIdentity& identity);
 
+		/// Records a request round trip of \a roundTripMicros microseconds for the node identified by \a identity.
+		void recordRoundTrip(const model::NodeIdentity& identity, uint64_t roundTripMicros);
+
+		/// Records a transfer of \a numBytes bytes in \a elapsedMicros microseconds for the node identified by \a identity.
+		void recordThroughput(const model::NodeIdentity& identity, uint64_t numBytes, uint64_t elapsedMicros);
+
 		/// Bans \a identity due to \a reason.
 		void ban(const model::NodeIdentity& identity, uint32_t reason);
 
@@ -23,6 +23,7 @@
 #include "NodeInfo.h"
 #include "bitxorcore/utils/MacroBasedEnumIncludes.h"
 #include <algorithm>
+#include <limits>
 
 namespace bitxorcore { namespace ionet {
 
@@ -41,6 +42,13 @@ namespace bitxorcore { namespace ionet {
 
 			return end == iter ? nullptr : &iter->second;
 		}
+
+		void AddSample(uint32_t& numSamples, uint64_t& value, uint64_t sample) {
+			// use the first sample as is and afterwards weight new samples by 1/4 so that transient spikes are smoothed
+			value = 0 == numSamples ? sample : (3 * value + sample) / 4;
+			if (std::numeric_limits<uint32_t>::max() != numSamples)
+				++numSamples;
+		}
 	}
 
 	NodeInfo::NodeInfo(NodeSource source) : m_source(source)
@@ -76,6 +84,10 @@ namespace bitxorcore { namespace ionet {
 		return FindByIdentifier(m_connectionStates.cbegin(), m_connectionStates.cend(), serviceId);
 	}
 
+	const NodeTransferStatistics& NodeInfo::transferStatistics() const {
+		return m_transferStatistics;
+	}
+
 	void NodeInfo::source(NodeSource source) {
 		m_source = source;
 	}
@@ -123,4 +135,13 @@ namespace bitxorcore { namespace ionet {
 		else
 			pConnectionState->BanAge = 0;
 	}
+
+	void NodeInfo::recordRoundTrip(uint64_t roundTripMicros) {
+		AddSample(m_transferStatistics.NumRoundTripSamples, m_transferStatistics.RoundTripMicros, roundTripMicros);
+	}
+
+	void NodeInfo::recordThroughput(uint64_t numBytes, uint64_t elapsedMicros) {
+		auto bytesPerSecond = numBytes * 1'000'000 / std::max<uint64_t>(1, elapsedMicros);
+		AddSample(m_transferStatistics.NumThroughputSamples, m_transferStatistics.BytesPerSecond, bytesPerSecond);
+	}
 }}
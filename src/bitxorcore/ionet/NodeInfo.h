@@ -80,6 +80,31 @@ namespace bitxorcore { namespace ionet {
 		uint32_t BanAge;
 	};
 
+	/// Smoothed transfer statistics measured during interactions with a node.
+	struct NodeTransferStatistics {
+	public:
+		/// Creates zeroed statistics.
+		NodeTransferStatistics()
+				: NumRoundTripSamples(0)
+				, RoundTripMicros(0)
+				, NumThroughputSamples(0)
+				, BytesPerSecond(0)
+		{}
+
+	public:
+		/// Number of round trip samples.
+		uint32_t NumRoundTripSamples;
+
+		/// Smoothed request round trip time (in microseconds).
+		uint64_t RoundTripMicros;
+
+		/// Number of throughput samples.
+		uint32_t NumThroughputSamples;
+
+		/// Smoothed response throughput (in bytes per second).
+		uint64_t BytesPerSecond;
+	};
+
 	/// Information about a node and its interactions.
 	struct NodeInfo {
 	public:
@@ -109,6 +134,9 @@ namespace bitxorcore { namespace ionet {
 		/// Gets the connection state for the service identified by \a serviceId or \c nullptr if no state exists.
 		const ConnectionState* getConnectionState(ServiceIdentifier serviceId) const;
 
+		/// Gets the measured transfer statistics.
+		const NodeTransferStatistics& transferStatistics() const;
+
 	public:
 		/// Sets the node source to \a source.
 		void source(NodeSource source);
@@ -129,9 +157,16 @@ namespace bitxorcore { namespace ionet {
 		/// \a maxConnectionBanAge and \a numConsecutiveFailuresBeforeBanning.
 		void updateBan(ServiceIdentifier serviceId, uint32_t maxConnectionBanAge, uint32_t numConsecutiveFailuresBeforeBanning);
 
+		/// Adds a request round trip sample of \a roundTripMicros microseconds.
+		void recordRoundTrip(uint64_t roundTripMicros);
+
+		/// Adds a throughput sample of \a numBytes bytes transferred in \a elapsedMicros microseconds.
+		void recordThroughput(uint64_t numBytes, uint64_t elapsedMicros);
+
 	private:
 		NodeSource m_source;
 		NodeInteractionsContainer m_interactions;
 		std::vector<std::pair<ServiceIdentifier, ConnectionState>> m_connectionStates;
+		NodeTransferStatistics m_transferStatistics;
 	};
 }}
@@ -0,0 +1,177 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PacketHandlerDispatcher.h"
+#include "bitxorcore/thread/ComputeThreadPool.h"
+#include "bitxorcore/utils/Hashers.h"
+#include "bitxorcore/exceptions.h"
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace bitxorcore { namespace ionet {
+
+	namespace {
+		class DefaultPacketHandlerDispatcher
+				: public PacketHandlerDispatcher
+				, public std::enable_shared_from_this<DefaultPacketHandlerDispatcher> {
+		private:
+			struct PendingPacket {
+				PacketType Type;
+				action Handler;
+			};
+
+			struct PeerQueue {
+				std::deque<PendingPacket> Packets;
+				bool IsExecuting = false;
+			};
+
+		public:
+			DefaultPacketHandlerDispatcher(
+					const std::shared_ptr<thread::ComputeThreadPool>& pPool,
+					const PacketHandlerDispatcherOptions& options)
+					: m_pPool(pPool)
+					, m_options(options)
+					, m_numPendingPackets(0)
+					, m_numRejectedPackets(0)
+					, m_numActiveWorkers(0)
+			{}
+
+		public:
+			size_t numPendingPackets() const override {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				return m_numPendingPackets;
+			}
+
+			size_t numPendingPackets(PacketType type) const override {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				auto iter = m_numPendingPacketsByType.find(type);
+				return m_numPendingPacketsByType.cend() == iter ? 0 : iter->second;
+			}
+
+			size_t numActivePeers() const override {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				return m_peerQueues.size();
+			}
+
+			size_t numRejectedPackets() const override {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				return m_numRejectedPackets;
+			}
+
+		public:
+			bool dispatch(const Key& peerKey, PacketType type, const action& handler) override {
+				{
+					std::lock_guard<std::mutex> guard(m_mutex);
+					auto& peerQueue = m_peerQueues[peerKey];
+					if (peerQueue.Packets.size() >= m_options.MaxPendingPacketsPerPeer) {
+						++m_numRejectedPackets;
+						return false;
+					}
+
+					peerQueue.Packets.push_back({ type, handler });
+					++m_numPendingPackets;
+					++m_numPendingPacketsByType[type];
+
+					// a peer is ready when it has pending packets and none are executing
+					if (!peerQueue.IsExecuting && 1 == peerQueue.Packets.size())
+						m_readyPeers.push_back(peerKey);
+
+					if (m_numActiveWorkers >= m_options.MaxConcurrency)
+						return true;
+
+					++m_numActiveWorkers;
+				}
+
+				m_pPool->post([pThis = shared_from_this()]() {
+					pThis->drain();
+				});
+				return true;
+			}
+
+		private:
+			void drain() {
+				for (;;) {
+					Key peerKey;
+					PendingPacket packet;
+					if (!tryPopReadyPacket(peerKey, packet))
+						return;
+
+					packet.Handler();
+
+					std::lock_guard<std::mutex> guard(m_mutex);
+					auto peerQueueIter = m_peerQueues.find(peerKey);
+					peerQueueIter->second.IsExecuting = false;
+
+					// move the peer to the back of the ready queue so that all other ready peers are serviced first
+					if (peerQueueIter->second.Packets.empty())
+						m_peerQueues.erase(peerQueueIter);
+					else
+						m_readyPeers.push_back(peerKey);
+				}
+			}
+
+			bool tryPopReadyPacket(Key& peerKey, PendingPacket& packet) {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				if (m_readyPeers.empty()) {
+					--m_numActiveWorkers;
+					return false;
+				}
+
+				peerKey = m_readyPeers.front();
+				m_readyPeers.pop_front();
+
+				auto& peerQueue = m_peerQueues.find(peerKey)->second;
+				packet = std::move(peerQueue.Packets.front());
+				peerQueue.Packets.pop_front();
+				peerQueue.IsExecuting = true;
+
+				--m_numPendingPackets;
+				if (0 == --m_numPendingPacketsByType[packet.Type])
+					m_numPendingPacketsByType.erase(packet.Type);
+
+				return true;
+			}
+
+		private:
+			std::shared_ptr<thread::ComputeThreadPool> m_pPool; // pool is shared because readers can dispatch after it is joined
+			PacketHandlerDispatcherOptions m_options;
+
+			std::unordered_map<Key, PeerQueue, utils::ArrayHasher<Key>> m_peerQueues;
+			std::unordered_map<PacketType, size_t> m_numPendingPacketsByType;
+			std::deque<Key> m_readyPeers;
+			size_t m_numPendingPackets;
+			size_t m_numRejectedPackets;
+			uint32_t m_numActiveWorkers;
+			mutable std::mutex m_mutex;
+		};
+	}
+
+	std::shared_ptr<PacketHandlerDispatcher> CreatePacketHandlerDispatcher(
+			const std::shared_ptr<thread::ComputeThreadPool>& pPool,
+			const PacketHandlerDispatcherOptions& options) {
+		if (0 == options.MaxConcurrency || 0 == options.MaxPendingPacketsPerPeer)
+			BITXORCORE_THROW_INVALID_ARGUMENT("packet handler dispatcher requires nonzero concurrency and pending packets per peer");
+
+		return std::make_shared<DefaultPacketHandlerDispatcher>(pPool, options);
+	}
+}}
@@ -0,0 +1,72 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "PacketType.h"
+#include "bitxorcore/functions.h"
+#include "bitxorcore/types.h"
+#include <memory>
+
+namespace bitxorcore { namespace thread { class ComputeThreadPool; } }
+
+namespace bitxorcore { namespace ionet {
+
+	/// Packet handler dispatcher options.
+	struct PacketHandlerDispatcherOptions {
+		/// Maximum number of handlers that can execute concurrently.
+		uint32_t MaxConcurrency;
+
+		/// Maximum number of packets that can be pending for a single peer.
+		uint32_t MaxPendingPacketsPerPeer;
+	};
+
+	/// Dispatches expensive packet handlers to a compute pool.
+	/// \note Each peer has its own queue, which is processed in order and by at most one handler at a time.
+	///       Peers with pending packets are serviced round robin, so a peer with a deep queue cannot starve other peers.
+	class PacketHandlerDispatcher {
+	public:
+		virtual ~PacketHandlerDispatcher() = default;
+
+	public:
+		/// Gets the number of packets that are queued but not yet executing.
+		virtual size_t numPendingPackets() const = 0;
+
+		/// Gets the number of packets with \a type that are queued but not yet executing.
+		virtual size_t numPendingPackets(PacketType type) const = 0;
+
+		/// Gets the number of peers with queued or executing packets.
+		virtual size_t numActivePeers() const = 0;
+
+		/// Gets the number of packets that were rejected because a peer queue was full.
+		virtual size_t numRejectedPackets() const = 0;
+
+	public:
+		/// Queues \a handler for processing a packet with \a type received from the peer identified by \a peerKey.
+		/// Returns \c false if the packet was rejected because the peer has too many pending packets.
+		virtual bool dispatch(const Key& peerKey, PacketType type, const action& handler) = 0;
+	};
+
+	/// Creates a packet handler dispatcher that executes handlers on \a pPool and is configured with \a options.
+	std::shared_ptr<PacketHandlerDispatcher> CreatePacketHandlerDispatcher(
+			const std::shared_ptr<thread::ComputeThreadPool>& pPool,
+			const PacketHandlerDispatcherOptions& options);
+}}
@@ -22,6 +22,7 @@
 
 #include "PacketHandlers.h"
 #include "bitxorcore/utils/Casting.h"
+#include "bitxorcore/utils/StackTimer.h"
 
 namespace bitxorcore { namespace ionet {
 
@@ -96,7 +97,41 @@ namespace bitxorcore { namespace ionet {
 		return !!findDescriptor(packet);
 	}
 
+	PacketHandlerCost ServerPacketHandlers::cost(const Packet& packet) const {
+		auto rawType = utils::to_underlying_type(packet.Type);
+		if (rawType >= m_descriptors.size() || !m_descriptors[rawType].Handler)
+			return PacketHandlerCost::Light;
+
+		return m_descriptors[rawType].Cost;
+	}
+
+	std::vector<PacketHandlerStatistics> ServerPacketHandlers::statistics() const {
+		std::vector<PacketHandlerStatistics> statistics;
+		for (auto i = 0u; i < m_descriptors.size(); ++i) {
+			const auto& descriptor = m_descriptors[i];
+			if (!descriptor.Handler)
+				continue;
+
+			const auto& counters = *descriptor.pCounters;
+			statistics.push_back({
+				static_cast<PacketType>(i),
+				descriptor.Cost,
+				counters.NumInvocations,
+				counters.TotalElapsedMicros,
+				counters.MaxElapsedMicros
+			});
+		}
+
+		return statistics;
+	}
+
 	namespace {
+		void UpdateMax(std::atomic<uint64_t>& maxValue, uint64_t value) {
+			auto currentMaxValue = maxValue.load();
+			while (currentMaxValue < value && !maxValue.compare_exchange_weak(currentMaxValue, value))
+			{}
+		}
+
 		bool IsHostAllowed(const std::unordered_set<std::string>& hosts, const std::string& host) {
 			if (hosts.empty())
 				return true;
@@ -118,7 +153,14 @@ namespace bitxorcore { namespace ionet {
 		}
 
 		BITXORCORE_LOG(trace) << "processing " << packet;
+		utils::StackTimer stopwatch;
 		pDescriptor->Handler(packet, context);
+
+		auto elapsedMicros = stopwatch.micros();
+		auto& counters = *pDescriptor->pCounters;
+		++counters.NumInvocations;
+		counters.TotalElapsedMicros += elapsedMicros;
+		UpdateMax(counters.MaxElapsedMicros, elapsedMicros);
 		return true;
 	}
 
@@ -126,7 +168,7 @@ namespace bitxorcore { namespace ionet {
 		m_activeAllowedHosts = hosts;
 	}
 
-	void ServerPacketHandlers::registerHandler(PacketType type, const PacketHandler& handler) {
+	void ServerPacketHandlers::registerHandler(PacketType type, const PacketHandler& handler, PacketHandlerCost cost) {
 		auto rawType = utils::to_underlying_type(type);
 		if (rawType >= m_descriptors.size())
 			m_descriptors.resize(rawType + 1);
@@ -134,7 +176,11 @@ namespace bitxorcore { namespace ionet {
 		if (m_descriptors[rawType].Handler)
 			BITXORCORE_THROW_RUNTIME_ERROR_1("handler for type is already registered", rawType);
 
-		m_descriptors[rawType] = { handler, m_activeAllowedHosts };
+		auto pCounters = std::make_shared<PacketHandlerCounters>();
+		pCounters->NumInvocations = 0;
+		pCounters->TotalElapsedMicros = 0;
+		pCounters->MaxElapsedMicros = 0;
+		m_descriptors[rawType] = { handler, m_activeAllowedHosts, cost, pCounters };
 	}
 
 	const ServerPacketHandlers::PacketHandlerDescriptor* ServerPacketHandlers::findDescriptor(const Packet& packet) const {
@@ -27,6 +27,8 @@
 #include "bitxorcore/constants.h"
 #include "bitxorcore/functions.h"
 #include "bitxorcore/types.h"
+#include <atomic>
+#include <memory>
 #include <unordered_set>
 #include <vector>
 
@@ -68,6 +70,33 @@ namespace bitxorcore { namespace ionet {
 		std::string m_defaultHost;
 	};
 
+	/// Relative cost of executing a packet handler.
+	enum class PacketHandlerCost {
+		/// Handler is cheap and can be executed inline by the socket reader.
+		Light,
+
+		/// Handler is expensive (e.g. it reads from disk) and should be offloaded from the socket reader.
+		Heavy
+	};
+
+	/// Execution statistics for a single packet handler.
+	struct PacketHandlerStatistics {
+		/// Packet type.
+		PacketType Type;
+
+		/// Handler cost.
+		PacketHandlerCost Cost;
+
+		/// Number of times the handler was invoked.
+		uint64_t NumInvocations;
+
+		/// Total time spent executing the handler (in microseconds).
+		uint64_t TotalElapsedMicros;
+
+		/// Maximum time spent executing the handler once (in microseconds).
+		uint64_t MaxElapsedMicros;
+	};
+
 	/// Collection of packet handlers where there is at most one handler per packet type.
 	class ServerPacketHandlers {
 	public:
@@ -94,6 +123,13 @@ namespace bitxorcore { namespace ionet {
 		/// Determines if \a packet can be processed by a registered handler.
 		bool canProcess(const Packet& packet) const;
 
+		/// Gets the cost of the handler registered for \a packet or \c Light if no handler is registered.
+		PacketHandlerCost cost(const Packet& packet) const;
+
+		/// Gets execution statistics for all registered handlers ordered by packet type.
+		/// \note Statistics are shared by all copies of this collection.
+		std::vector<PacketHandlerStatistics> statistics() const;
+
 		/// Processes \a packet using the specified \a context and returns \c true if the
 		/// packet was processed.
 		bool process(const Packet& packet, ContextType& context) const;
@@ -102,13 +138,21 @@ namespace bitxorcore { namespace ionet {
 		/// Sets the \a hosts that are allowed to access subsequently registered handlers.
 		void setAllowedHosts(const std::unordered_set<std::string>& hosts);
 
-		/// Registers \a handler for the specified packet \a type.
-		void registerHandler(PacketType type, const PacketHandler& handler);
+		/// Registers \a handler with \a cost for the specified packet \a type.
+		void registerHandler(PacketType type, const PacketHandler& handler, PacketHandlerCost cost = PacketHandlerCost::Light);
 
 	private:
+		struct PacketHandlerCounters {
+			std::atomic<uint64_t> NumInvocations;
+			std::atomic<uint64_t> TotalElapsedMicros;
+			std::atomic<uint64_t> MaxElapsedMicros;
+		};
+
 		struct PacketHandlerDescriptor {
 			PacketHandler Handler;
 			std::unordered_set<std::string> AllowedHosts;
+			PacketHandlerCost Cost;
+			std::shared_ptr<PacketHandlerCounters> pCounters;
 		};
 
 	private:
@@ -68,6 +68,12 @@ namespace bitxorcore { namespace ionet {
 	/* Sub cache merkle roots have been requested. */ \
 	ENUM_VALUE(Sub_Cache_Merkle_Roots, 12) \
 	\
+	/* Short hashes of unconfirmed transactions have been announced by a peer. */ \
+	ENUM_VALUE(Push_Transaction_Inventory, 13) \
+	\
+	/* Previously announced unconfirmed transactions have been requested by a peer. */ \
+	ENUM_VALUE(Pull_Announced_Transactions, 14) \
+	\
 	/* partial transactions packets have types [0x100, 0x110) */ \
 	\
 	/* Partial aggregate transactions have been pushed by an api-node. */ \
@@ -191,7 +197,36 @@ namespace bitxorcore { namespace ionet {
 	ENUM_VALUE(Account_Restrictions_Infos, FACILITY_BASED_CODE(0x400, RestrictionAccount)) \
 	\
 	/* Token restrictions infos have been requested by a client. */ \
-	ENUM_VALUE(Token_Restrictions_Infos, FACILITY_BASED_CODE(0x400, RestrictionToken))
+	ENUM_VALUE(Token_Restrictions_Infos, FACILITY_BASED_CODE(0x400, RestrictionToken)) \
+	\
+	/* batch state path packets have types [0x500, 0x600) - ordered by facility code name */ \
+	\
+	/* Account state paths for multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Account_State_Paths, FACILITY_BASED_CODE(0x500, Core)) \
+	\
+	/* Hash lock state paths for multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Hash_Lock_State_Paths, FACILITY_BASED_CODE(0x500, LockHash)) \
+	\
+	/* Secret lock state paths for multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Secret_Lock_State_Paths, FACILITY_BASED_CODE(0x500, LockSecret)) \
+	\
+	/* Metadata state paths for multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Metadata_State_Paths, FACILITY_BASED_CODE(0x500, Metadata)) \
+	\
+	/* Token state paths for multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Token_State_Paths, FACILITY_BASED_CODE(0x500, Token)) \
+	\
+	/* Multisig state paths for multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Multisig_State_Paths, FACILITY_BASED_CODE(0x500, Multisig)) \
+	\
+	/* Namespace state paths for multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Namespace_State_Paths, FACILITY_BASED_CODE(0x500, Namespace)) \
+	\
+	/* Account restrictions state paths for multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Account_Restrictions_State_Paths, FACILITY_BASED_CODE(0x500, RestrictionAccount)) \
+	\
+	/* Token restrictions state paths for multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Token_Restrictions_State_Paths, FACILITY_BASED_CODE(0x500, RestrictionToken))
 
 #define ENUM_VALUE(LABEL, VALUE) LABEL = VALUE,
 	/// Enumeration of known packet types.
@@ -21,7 +21,11 @@
 **/
 
 #include "SocketReader.h"
+#include "PacketHandlerDispatcher.h"
 #include "PacketSocket.h"
+#include "bitxorcore/utils/MemoryUtils.h"
+#include "bitxorcore/utils/SpinLock.h"
+#include <cstring>
 
 namespace bitxorcore { namespace ionet {
 
@@ -40,14 +44,17 @@ namespace bitxorcore { namespace ionet {
 					const std::shared_ptr<PacketIo>& pWriter,
 					const ServerPacketHandlers& handlers,
 					const model::NodeIdentity& identity,
+					const std::shared_ptr<PacketHandlerDispatcher>& pHeavyHandlerDispatcher,
 					const SocketReader::ReadCallback& callback)
 					: m_pReader(pReader)
 					, m_pWriter(pWriter)
 					, m_handlers(handlers)
 					, m_identity(identity)
+					, m_pHeavyHandlerDispatcher(pHeavyHandlerDispatcher)
 					, m_callback(callback)
 					, m_numOutstandingOperations(0)
 					, m_state(operation_state::Unknown)
+					, m_numDispatchedPackets(0)
 			{}
 
 		public:
@@ -71,9 +78,39 @@ namespace bitxorcore { namespace ionet {
 				if (SocketOperationCode::Success != code)
 					return invokeCallback(code);
 
+				// once any packet has been dispatched, all subsequent packets need to be dispatched too in order to preserve
+				// the response order
+				if (m_pHeavyHandlerDispatcher && (0 != m_numDispatchedPackets || PacketHandlerCost::Heavy == m_handlers.cost(*pPacket)))
+					return dispatch(*pPacket);
+
+				process(*pPacket);
+			}
+
+			void dispatch(const Packet& packet) {
+				// packet needs to be copied because the underlying read buffer can be reused after this callback returns
+				auto pPacketCopy = utils::MakeSharedWithSize<Packet>(packet.Size);
+				std::memcpy(static_cast<void*>(pPacketCopy.get()), &packet, packet.Size);
+
+				++m_numDispatchedPackets;
+				auto pThis = shared_from_this();
+				auto isDispatched = m_pHeavyHandlerDispatcher->dispatch(m_identity.PublicKey, packet.Type, [pThis, pPacketCopy]() {
+					pThis->process(*pPacketCopy);
+
+					// any response has already been queued, so subsequent (inline) responses will be ordered after it
+					--pThis->m_numDispatchedPackets;
+				});
+
+				if (!isDispatched) {
+					--m_numDispatchedPackets;
+					BITXORCORE_LOG(warning) << m_identity << " has too many pending packets, rejecting packet of type " << packet.Type;
+					invokeCallback(SocketOperationCode::Malformed_Data);
+				}
+			}
+
+			void process(const Packet& packet) {
 				ServerPacketHandlerContext handlerContext(m_identity.PublicKey, m_identity.Host);
-				if (!m_handlers.process(*pPacket, handlerContext)) {
-					BITXORCORE_LOG(warning) << m_identity << " ignoring unknown packet of type " << pPacket->Type;
+				if (!m_handlers.process(packet, handlerContext)) {
+					BITXORCORE_LOG(warning) << m_identity << " ignoring unknown packet of type " << packet.Type;
 					return invokeCallback(SocketOperationCode::Malformed_Data);
 				}
 
@@ -95,15 +132,22 @@ namespace bitxorcore { namespace ionet {
 			}
 
 			void invokeCallback(SocketOperationCode code) {
-				--m_numOutstandingOperations;
-				updateState(code);
+				// dispatched handlers can complete outside of the underlying socket's strand, so completion detection
+				// needs to be atomic in order to trigger insufficient data exactly once
+				bool isReadComplete;
+				{
+					utils::SpinLockGuard guard(m_completionLock);
+					--m_numOutstandingOperations;
+					updateState(code);
+					isReadComplete = 0 == m_numOutstandingOperations && operation_state::Read_Done == m_state;
+				}
 
 				// save Insufficient_Data errors for last
 				if (SocketOperationCode::Insufficient_Data != code)
 					m_callback(code);
 
 				// trigger insufficient data when all sub operations have completed and none have failed
-				if (0 == m_numOutstandingOperations && operation_state::Read_Done == m_state)
+				if (isReadComplete)
 					return m_callback(SocketOperationCode::Insufficient_Data);
 			}
 
@@ -127,11 +171,14 @@ namespace bitxorcore { namespace ionet {
 			std::shared_ptr<PacketIo> m_pWriter;
 			const ServerPacketHandlers& m_handlers;
 			const model::NodeIdentity& m_identity;
+			std::shared_ptr<PacketHandlerDispatcher> m_pHeavyHandlerDispatcher;
 			SocketReader::ReadCallback m_callback;
 
 			// these need to be atomic because `isComplete` reads them outside of underlying socket's strand
 			std::atomic<size_t> m_numOutstandingOperations;
 			std::atomic<size_t> m_state;
+			std::atomic<size_t> m_numDispatchedPackets;
+			utils::SpinLock m_completionLock;
 		};
 
 		class DefaultSocketReader : public SocketReader {
@@ -140,11 +187,13 @@ namespace bitxorcore { namespace ionet {
 					const std::shared_ptr<BatchPacketReader>& pReader,
 					const std::shared_ptr<PacketIo>& pWriter,
 					const ServerPacketHandlers& handlers,
-					const model::NodeIdentity& identity)
+					const model::NodeIdentity& identity,
+					const std::shared_ptr<PacketHandlerDispatcher>& pHeavyHandlerDispatcher)
 					: m_pReader(pReader)
 					, m_pWriter(pWriter)
 					, m_handlers(handlers)
 					, m_identity(identity)
+					, m_pHeavyHandlerDispatcher(pHeavyHandlerDispatcher)
 			{}
 
 		public:
@@ -165,7 +214,13 @@ namespace bitxorcore { namespace ionet {
 			}
 
 			std::shared_ptr<PacketReadWriteOperation> makeOperation(const ReadCallback& callback) {
-				return std::make_shared<PacketReadWriteOperation>(m_pReader, m_pWriter, m_handlers, m_identity, callback);
+				return std::make_shared<PacketReadWriteOperation>(
+						m_pReader,
+						m_pWriter,
+						m_handlers,
+						m_identity,
+						m_pHeavyHandlerDispatcher,
+						callback);
 			}
 
 		private:
@@ -174,6 +229,7 @@ namespace bitxorcore { namespace ionet {
 			std::weak_ptr<PacketReadWriteOperation> m_pOperation;
 			const ServerPacketHandlers& m_handlers; // handlers are unique per process and externally owned (by PacketReaders)
 			model::NodeIdentity m_identity; // identity is copied because it is unique per socket
+			std::shared_ptr<PacketHandlerDispatcher> m_pHeavyHandlerDispatcher;
 		};
 	}
 
@@ -181,7 +237,8 @@ namespace bitxorcore { namespace ionet {
 			const std::shared_ptr<BatchPacketReader>& pReader,
 			const std::shared_ptr<PacketIo>& pWriter,
 			const ServerPacketHandlers& handlers,
-			const model::NodeIdentity& identity) {
-		return std::make_unique<DefaultSocketReader>(pReader, pWriter, handlers, identity);
+			const model::NodeIdentity& identity,
+			const std::shared_ptr<PacketHandlerDispatcher>& pHeavyHandlerDispatcher) {
+		return std::make_unique<DefaultSocketReader>(pReader, pWriter, handlers, identity, pHeavyHandlerDispatcher);
 	}
 }}
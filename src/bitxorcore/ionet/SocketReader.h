@@ -29,6 +29,7 @@
 namespace bitxorcore {
 	namespace ionet {
 		class BatchPacketReader;
+		class PacketHandlerDispatcher;
 		class PacketIo;
 	}
 }
@@ -49,9 +50,11 @@ namespace bitxorcore { namespace ionet {
 	};
 
 	/// Creates a socket packet reader around \a pReader, \a pWriter and \a handlers given a reader \a identity.
+	/// When \a pHeavyHandlerDispatcher is provided, heavy handlers are executed by it instead of inline.
 	std::unique_ptr<SocketReader> CreateSocketReader(
 			const std::shared_ptr<BatchPacketReader>& pReader,
 			const std::shared_ptr<PacketIo>& pWriter,
 			const ServerPacketHandlers& handlers,
-			const model::NodeIdentity& identity);
+			const model::NodeIdentity& identity,
+			const std::shared_ptr<PacketHandlerDispatcher>& pHeavyHandlerDispatcher = nullptr);
 }}
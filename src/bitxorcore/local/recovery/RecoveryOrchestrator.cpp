@@ -86,11 +86,11 @@ namespace bitxorcore { namespace local {
 			return std::make_unique<io::FileBlockStorage>(stagingDirectory, fileDatabaseBatchSize, io::FileBlockStorageMode::None);
 		}
 
-		void MoveSupplementalDataFiles(const config::BitxorCoreDataDirectory& dataDirectory) {
+		void MoveSupplementalDataFiles(const config::BitxorCoreDataDirectory& dataDirectory, const utils::FileSize& stateFileChunkSize) {
 			if (!std::filesystem::exists(dataDirectory.dir("state.tmp").path()))
 				return;
 
-			extensions::LocalNodeStateSerializer serializer(dataDirectory.dir("state.tmp"));
+			extensions::LocalNodeStateSerializer serializer(dataDirectory.dir("state.tmp"), stateFileChunkSize);
 			serializer.moveTo(dataDirectory.dir("state"));
 		}
 
@@ -222,7 +222,7 @@ namespace bitxorcore { namespace local {
 				}
 
 				BITXORCORE_LOG(debug) << " - moving supplemental data and block files";
-				MoveSupplementalDataFiles(m_dataDirectory);
+				MoveSupplementalDataFiles(m_dataDirectory, m_config.Node.StateFileChunkSize);
 				auto startHeight = MoveBlockFiles(
 						m_dataDirectory.spoolDir("block_sync"),
 						*m_pBlockStorage,
@@ -26,6 +26,7 @@
 #include "bitxorcore/subscribers/StateChangeInfo.h"
 #include "bitxorcore/subscribers/SubscriberOperationTypes.h"
 #include "bitxorcore/utils/Casting.h"
+#include "bitxorcore/utils/TraceRecorder.h"
 
 namespace bitxorcore { namespace local {
 
@@ -54,6 +55,7 @@ namespace bitxorcore { namespace local {
 			}
 
 			void notifyStateChange(const subscribers::StateChangeInfo& stateChangeInfo) override {
+				utils::TraceSpan span("spooling", "spool state change", stateChangeInfo.Height, utils::ShortHash());
 				write(subscribers::StateChangeOperationType::State_Change);
 
 				io::Write(*m_pOutputStream, stateChangeInfo.ScoreDelta);
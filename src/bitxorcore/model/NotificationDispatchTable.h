@@ -0,0 +1,114 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NotificationType.h"
+#include <unordered_map>
+#include <vector>
+
+namespace bitxorcore { namespace model {
+
+	/// Table that maps notification types (ignoring channel) to the ordered handlers that should process them.
+	/// \note Handlers are not owned by the table.
+	template<typename THandler>
+	class NotificationDispatchTable {
+	public:
+		/// Vector of handler pointers.
+		using Handlers = std::vector<const THandler*>;
+
+	public:
+		/// Gets the number of distinct notification types with registered handlers.
+		size_t numTypes() const {
+			return m_typedHandlers.size();
+		}
+
+		/// Gets the handlers that process all notification types.
+		const Handlers& universalHandlers() const {
+			return m_universalHandlers;
+		}
+
+		/// Gets all handlers that should process notifications with \a type in registration order.
+		const Handlers& find(NotificationType type) const {
+			auto iter = m_typedHandlers.find(ToKey(type));
+			return m_typedHandlers.cend() == iter ? m_universalHandlers : iter->second;
+		}
+
+	public:
+		/// Adds \a pHandler that processes only notifications with \a type.
+		void add(NotificationType type, const THandler* pHandler) {
+			auto key = ToKey(type);
+			auto iter = m_typedHandlers.find(key);
+			if (m_typedHandlers.cend() == iter) {
+				// all previously added universal handlers precede the new handler
+				iter = m_typedHandlers.emplace(key, m_universalHandlers).first;
+			}
+
+			iter->second.push_back(pHandler);
+		}
+
+		/// Adds \a pHandler that processes all notifications.
+		void addUniversal(const THandler* pHandler) {
+			m_universalHandlers.push_back(pHandler);
+			for (auto& pair : m_typedHandlers)
+				pair.second.push_back(pHandler);
+		}
+
+	private:
+		static constexpr uint32_t ToKey(NotificationType type) {
+			return 0x00FFFFFFu & utils::to_underlying_type(type);
+		}
+
+	private:
+		Handlers m_universalHandlers;
+		std::unordered_map<uint32_t, Handlers> m_typedHandlers;
+	};
+
+	/// Dispatch lookup that forwards all notifications to all handlers.
+	struct UniversalDispatchLookup {
+		/// Gets all \a handlers irrespective of \a notification.
+		template<typename TNotification, typename THandlers>
+		const THandlers& find(const TNotification&, const THandlers& handlers) const {
+			return handlers;
+		}
+	};
+
+	/// Dispatch lookup that forwards notifications to the handlers registered in a notification dispatch table.
+	template<typename THandler>
+	class NotificationDispatchTableLookup {
+	public:
+		/// Creates a lookup around \a dispatchTable.
+		explicit NotificationDispatchTableLookup(NotificationDispatchTable<THandler>&& dispatchTable)
+				: m_dispatchTable(std::move(dispatchTable))
+		{}
+
+	public:
+		/// Gets the handlers registered for the type of \a notification.
+		/// \note \a handlers are ignored because the dispatch table already references all handlers by type.
+		template<typename TNotification, typename THandlers>
+		const typename NotificationDispatchTable<THandler>::Handlers& find(const TNotification& notification, const THandlers&) const {
+			return m_dispatchTable.find(notification.Type);
+		}
+
+	private:
+		NotificationDispatchTable<THandler> m_dispatchTable;
+	};
+}}
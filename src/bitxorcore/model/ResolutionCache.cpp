@@ -0,0 +1,85 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ResolutionCache.h"
+
+namespace bitxorcore { namespace model {
+
+	ResolutionCache::ResolutionCache() : ResolutionCache(std::make_shared<ResolutionCacheStatistics>())
+	{}
+
+	ResolutionCache::ResolutionCache(const std::shared_ptr<ResolutionCacheStatistics>& pStatistics) : m_pStatistics(pStatistics)
+	{}
+
+	size_t ResolutionCache::size() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_tokenResolutions.size() + m_addressResolutions.size();
+	}
+
+	const ResolutionCacheStatistics& ResolutionCache::statistics() const {
+		return *m_pStatistics;
+	}
+
+	bool ResolutionCache::tryFind(UnresolvedTokenId tokenId, TokenId& resolved) {
+		return tryFindResolution(m_tokenResolutions, tokenId, resolved);
+	}
+
+	bool ResolutionCache::tryFind(const UnresolvedAddress& address, Address& resolved) {
+		return tryFindResolution(m_addressResolutions, address, resolved);
+	}
+
+	void ResolutionCache::insert(UnresolvedTokenId tokenId, TokenId resolved) {
+		utils::SpinLockGuard guard(m_lock);
+		m_tokenResolutions.emplace(tokenId, resolved);
+	}
+
+	void ResolutionCache::insert(const UnresolvedAddress& address, const Address& resolved) {
+		utils::SpinLockGuard guard(m_lock);
+		m_addressResolutions.emplace(address, resolved);
+	}
+
+	void ResolutionCache::clear() {
+		{
+			utils::SpinLockGuard guard(m_lock);
+			m_tokenResolutions.clear();
+			m_addressResolutions.clear();
+		}
+
+		++m_pStatistics->NumInvalidations;
+	}
+
+	template<typename TMap, typename TUnresolved, typename TResolved>
+	bool ResolutionCache::tryFindResolution(const TMap& map, const TUnresolved& unresolved, TResolved& resolved) {
+		{
+			utils::SpinLockGuard guard(m_lock);
+			auto iter = map.find(unresolved);
+			if (map.cend() != iter) {
+				resolved = iter->second;
+				++m_pStatistics->NumHits;
+				return true;
+			}
+		}
+
+		++m_pStatistics->NumMisses;
+		return false;
+	}
+}}
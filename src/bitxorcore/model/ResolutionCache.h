@@ -0,0 +1,98 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "bitxorcore/utils/Hashers.h"
+#include "bitxorcore/utils/SpinLock.h"
+#include "bitxorcore/types.h"
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+
+namespace bitxorcore { namespace model {
+
+	/// Resolution cache statistics.
+	struct ResolutionCacheStatistics {
+	public:
+		/// Creates zeroed statistics.
+		ResolutionCacheStatistics()
+				: NumHits(0)
+				, NumMisses(0)
+				, NumInvalidations(0)
+		{}
+
+	public:
+		/// Number of resolutions served from the cache.
+		std::atomic<uint64_t> NumHits;
+
+		/// Number of resolutions that were not found in the cache.
+		std::atomic<uint64_t> NumMisses;
+
+		/// Number of times the cache was cleared.
+		std::atomic<uint64_t> NumInvalidations;
+	};
+
+	/// Thread safe cache of (token and address) alias resolutions.
+	/// \note Cached resolutions are only valid as long as the underlying alias state does not change,
+	///       so the cache must be cleared whenever it does.
+	class ResolutionCache {
+	public:
+		/// Creates a cache with its own statistics.
+		ResolutionCache();
+
+		/// Creates a cache that updates (shared) \a pStatistics.
+		explicit ResolutionCache(const std::shared_ptr<ResolutionCacheStatistics>& pStatistics);
+
+	public:
+		/// Gets the number of cached resolutions.
+		size_t size() const;
+
+		/// Gets the cache statistics.
+		const ResolutionCacheStatistics& statistics() const;
+
+	public:
+		/// Tries to find the cached resolution of \a tokenId and stores it in \a resolved.
+		bool tryFind(UnresolvedTokenId tokenId, TokenId& resolved);
+
+		/// Tries to find the cached resolution of \a address and stores it in \a resolved.
+		bool tryFind(const UnresolvedAddress& address, Address& resolved);
+
+		/// Caches the resolution of \a tokenId to \a resolved.
+		void insert(UnresolvedTokenId tokenId, TokenId resolved);
+
+		/// Caches the resolution of \a address to \a resolved.
+		void insert(const UnresolvedAddress& address, const Address& resolved);
+
+		/// Removes all cached resolutions.
+		void clear();
+
+	private:
+		template<typename TMap, typename TUnresolved, typename TResolved>
+		bool tryFindResolution(const TMap& map, const TUnresolved& unresolved, TResolved& resolved);
+
+	private:
+		std::shared_ptr<ResolutionCacheStatistics> m_pStatistics;
+		std::unordered_map<UnresolvedTokenId, TokenId, utils::BaseValueHasher<UnresolvedTokenId>> m_tokenResolutions;
+		std::unordered_map<UnresolvedAddress, Address, utils::ArrayHasher<UnresolvedAddress>> m_addressResolutions;
+		mutable utils::SpinLock m_lock;
+	};
+}}
@@ -21,6 +21,7 @@
 **/
 
 #include "ResolverContext.h"
+#include "ResolutionCache.h"
 #include <cstring>
 
 namespace bitxorcore { namespace model {
@@ -32,15 +33,43 @@ namespace bitxorcore { namespace model {
 	{}
 
 	ResolverContext::ResolverContext(const TokenResolver& tokenResolver, const AddressResolver& addressResolver)
+			: ResolverContext(tokenResolver, addressResolver, nullptr)
+	{}
+
+	ResolverContext::ResolverContext(
+			const TokenResolver& tokenResolver,
+			const AddressResolver& addressResolver,
+			const std::shared_ptr<ResolutionCache>& pResolutionCache)
 			: m_tokenResolver(tokenResolver)
 			, m_addressResolver(addressResolver)
+			, m_pResolutionCache(pResolutionCache)
 	{}
 
+	ResolutionCache* ResolverContext::resolutionCache() const {
+		return m_pResolutionCache.get();
+	}
+
+	namespace {
+		template<typename TUnresolved, typename TResolved, typename TResolver>
+		TResolved Resolve(ResolutionCache* pResolutionCache, const TUnresolved& unresolved, const TResolver& resolver) {
+			if (!pResolutionCache)
+				return resolver(unresolved);
+
+			TResolved resolved;
+			if (pResolutionCache->tryFind(unresolved, resolved))
+				return resolved;
+
+			resolved = resolver(unresolved);
+			pResolutionCache->insert(unresolved, resolved);
+			return resolved;
+		}
+	}
+
 	TokenId ResolverContext::resolve(UnresolvedTokenId tokenId) const {
-		return m_tokenResolver(tokenId);
+		return Resolve<UnresolvedTokenId, TokenId>(m_pResolutionCache.get(), tokenId, m_tokenResolver);
 	}
 
 	Address ResolverContext::resolve(const UnresolvedAddress& address) const {
-		return m_addressResolver(address);
+		return Resolve<UnresolvedAddress, Address>(m_pResolutionCache.get(), address, m_addressResolver);
 	}
 }}
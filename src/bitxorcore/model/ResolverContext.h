@@ -23,6 +23,9 @@
 #pragma once
 #include "bitxorcore/types.h"
 #include <functional>
+#include <memory>
+
+namespace bitxorcore { namespace model { class ResolutionCache; } }
 
 namespace bitxorcore { namespace model {
 
@@ -41,6 +44,17 @@ namespace bitxorcore { namespace model {
 		/// Creates a context around \a tokenResolver and \a addressResolver.
 		ResolverContext(const TokenResolver& tokenResolver, const AddressResolver& addressResolver);
 
+		/// Creates a context around \a tokenResolver and \a addressResolver that memoizes resolutions in \a pResolutionCache.
+		/// \note \a pResolutionCache is shared by all copies of this context.
+		ResolverContext(
+				const TokenResolver& tokenResolver,
+				const AddressResolver& addressResolver,
+				const std::shared_ptr<ResolutionCache>& pResolutionCache);
+
+	public:
+		/// Gets the resolution cache used by this context or \c nullptr if resolutions are not memoized.
+		ResolutionCache* resolutionCache() const;
+
 	public:
 		/// Resolves token id (\a tokenId).
 		TokenId resolve(UnresolvedTokenId tokenId) const;
@@ -51,5 +65,6 @@ namespace bitxorcore { namespace model {
 	private:
 		TokenResolver m_tokenResolver;
 		AddressResolver m_addressResolver;
+		std::shared_ptr<ResolutionCache> m_pResolutionCache;
 	};
 }}
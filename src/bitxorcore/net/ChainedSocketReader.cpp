@@ -41,11 +41,17 @@ namespace bitxorcore { namespace net {
 					const std::shared_ptr<ionet::PacketSocket>& pPacketSocket,
 					const ionet::ServerPacketHandlers& serverHandlers,
 					const model::NodeIdentity& identity,
+					const std::shared_ptr<ionet::PacketHandlerDispatcher>& pHeavyHandlerDispatcher,
 					const ChainedSocketReader::CompletionHandler& completionHandler)
 					: m_pPacketSocket(pPacketSocket)
 					, m_identity(identity)
 					, m_completionHandler(completionHandler)
-					, m_pReader(CreateSocketReader(m_pPacketSocket, m_pPacketSocket->buffered(), serverHandlers, identity))
+					, m_pReader(CreateSocketReader(
+							m_pPacketSocket,
+							m_pPacketSocket->buffered(),
+							serverHandlers,
+							identity,
+							pHeavyHandlerDispatcher))
 			{}
 
 		public:
@@ -94,6 +100,20 @@ namespace bitxorcore { namespace net {
 			const ionet::ServerPacketHandlers& serverHandlers,
 			const model::NodeIdentity& identity,
 			const ChainedSocketReader::CompletionHandler& completionHandler) {
-		return std::make_shared<DefaultChainedSocketReader>(pPacketSocket, serverHandlers, identity, completionHandler);
+		return CreateChainedSocketReader(pPacketSocket, serverHandlers, identity, nullptr, completionHandler);
+	}
+
+	std::shared_ptr<ChainedSocketReader> CreateChainedSocketReader(
+			const std::shared_ptr<ionet::PacketSocket>& pPacketSocket,
+			const ionet::ServerPacketHandlers& serverHandlers,
+			const model::NodeIdentity& identity,
+			const std::shared_ptr<ionet::PacketHandlerDispatcher>& pHeavyHandlerDispatcher,
+			const ChainedSocketReader::CompletionHandler& completionHandler) {
+		return std::make_shared<DefaultChainedSocketReader>(
+				pPacketSocket,
+				serverHandlers,
+				identity,
+				pHeavyHandlerDispatcher,
+				completionHandler);
 	}
 }}
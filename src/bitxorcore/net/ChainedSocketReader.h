@@ -27,7 +27,10 @@
 #include <memory>
 
 namespace bitxorcore {
-	namespace ionet { class PacketSocket; }
+	namespace ionet {
+		class PacketHandlerDispatcher;
+		class PacketSocket;
+	}
 	namespace model { struct NodeIdentity; }
 }
 
@@ -65,4 +68,14 @@ namespace bitxorcore { namespace net {
 			const ionet::ServerPacketHandlers& serverHandlers,
 			const model::NodeIdentity& identity,
 			const ChainedSocketReader::CompletionHandler& completionHandler);
+
+	/// Creates a chained socket reader around \a pPacketSocket and \a serverHandlers with a custom completion
+	/// handler (\a completionHandler) given reader \a identity.
+	/// Heavy handlers are executed by \a pHeavyHandlerDispatcher (when provided) instead of inline.
+	std::shared_ptr<ChainedSocketReader> CreateChainedSocketReader(
+			const std::shared_ptr<ionet::PacketSocket>& pPacketSocket,
+			const ionet::ServerPacketHandlers& serverHandlers,
+			const model::NodeIdentity& identity,
+			const std::shared_ptr<ionet::PacketHandlerDispatcher>& pHeavyHandlerDispatcher,
+			const ChainedSocketReader::CompletionHandler& completionHandler);
 }}
@@ -221,8 +221,10 @@ namespace bitxorcore { namespace net {
 					const ionet::ServerPacketHandlers& handlers,
 					const Key& serverPublicKey,
 					const ConnectionSettings& settings,
-					uint32_t maxConnectionsPerIdentity)
+					uint32_t maxConnectionsPerIdentity,
+					const std::shared_ptr<ionet::PacketHandlerDispatcher>& pHeavyHandlerDispatcher)
 					: m_handlers(handlers)
+					, m_pHeavyHandlerDispatcher(pHeavyHandlerDispatcher)
 					, m_pClientConnector(CreateClientConnector(pool, serverPublicKey, settings, "readers"))
 					, m_readers(maxConnectionsPerIdentity, settings.NodeIdentityEqualityStrategy)
 			{}
@@ -292,18 +294,20 @@ namespace bitxorcore { namespace net {
 					const PacketSocketPointer& pSocket,
 					const model::NodeIdentity& identity,
 					uint32_t id) {
-				return CreateChainedSocketReader(pSocket, m_handlers, identity, [pThis = shared_from_this(), identity, id](auto code) {
+				auto completionHandler = [pThis = shared_from_this(), identity, id](auto code) {
 					// if the socket is closed cleanly, just remove the closed socket
 					// if the socket errored, remove all sockets with the same identity
 					if (ionet::SocketOperationCode::Closed == code)
 						pThis->m_readers.close(identity, id);
 					else
 						pThis->m_readers.close(identity);
-				});
+				};
+				return CreateChainedSocketReader(pSocket, m_handlers, identity, m_pHeavyHandlerDispatcher, completionHandler);
 			}
 
 		private:
 			ionet::ServerPacketHandlers m_handlers;
+			std::shared_ptr<ionet::PacketHandlerDispatcher> m_pHeavyHandlerDispatcher;
 			std::shared_ptr<ClientConnector> m_pClientConnector;
 			ReaderContainer m_readers;
 		};
@@ -314,7 +318,14 @@ namespace bitxorcore { namespace net {
 			const ionet::ServerPacketHandlers& handlers,
 			const Key& serverPublicKey,
 			const ConnectionSettings& settings,
-			uint32_t maxConnectionsPerIdentity) {
-		return std::make_shared<DefaultPacketReaders>(pool, handlers, serverPublicKey, settings, maxConnectionsPerIdentity);
+			uint32_t maxConnectionsPerIdentity,
+			const std::shared_ptr<ionet::PacketHandlerDispatcher>& pHeavyHandlerDispatcher) {
+		return std::make_shared<DefaultPacketReaders>(
+				pool,
+				handlers,
+				serverPublicKey,
+				settings,
+				maxConnectionsPerIdentity,
+				pHeavyHandlerDispatcher);
 	}
 }}
@@ -30,6 +30,7 @@
 
 namespace bitxorcore {
 	namespace ionet {
+		class PacketHandlerDispatcher;
 		class PacketIo;
 		class PacketSocket;
 		class PacketSocketInfo;
@@ -52,10 +53,12 @@ namespace bitxorcore { namespace net {
 
 	/// Creates a packet readers container for a server with specified \a serverPublicKey using \a pool and \a handlers,
 	/// configured with \a settings and allowing \a maxConnectionsPerIdentity.
+	/// Heavy handlers are executed by \a pHeavyHandlerDispatcher (when provided) instead of inline.
 	std::shared_ptr<PacketReaders> CreatePacketReaders(
 			thread::IoThreadPool& pool,
 			const ionet::ServerPacketHandlers& handlers,
 			const Key& serverPublicKey,
 			const ConnectionSettings& settings,
-			uint32_t maxConnectionsPerIdentity);
+			uint32_t maxConnectionsPerIdentity,
+			const std::shared_ptr<ionet::PacketHandlerDispatcher>& pHeavyHandlerDispatcher = nullptr);
 }}
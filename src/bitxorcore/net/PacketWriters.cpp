@@ -109,9 +109,12 @@ namespace bitxorcore { namespace net {
 				}
 			}
 
-			bool pickOne(WriterState& state) {
+			template<typename TPredicate>
+			bool pickOne(WriterState& state, TPredicate predicate) {
 				utils::SpinLockGuard guard(m_lock);
-				auto* ppState = m_writers.nextIf(IsStateAvailable);
+				auto* ppState = m_writers.nextIf([predicate](const auto& pState) {
+					return IsStateAvailable(pState) && predicate(*pState);
+				});
 				if (!ppState)
 					return false;
 
@@ -321,11 +324,28 @@ namespace bitxorcore { namespace net {
 
 			ionet::NodePacketIoPair pickOne(const utils::TimeSpan& ioDuration) override {
 				WriterState state;
-				if (!m_writers.pickOne(state)) {
+				if (!m_writers.pickOne(state, [](const auto&) { return true; })) {
 					BITXORCORE_LOG_THROTTLE(warning, utils::TimeSpan::FromMinutes(1).millis()) << "no packet io available for checkout";
 					return ionet::NodePacketIoPair();
 				}
 
+				return checkOut(state, ioDuration);
+			}
+
+			ionet::NodePacketIoPair pickOneByKey(const Key& identityKey, const utils::TimeSpan& ioDuration) override {
+				WriterState state;
+				if (!m_writers.pickOne(state, [&identityKey](const auto& writerState) {
+					return identityKey == writerState.Node.identity().PublicKey;
+				})) {
+					BITXORCORE_LOG(trace) << "no packet io available for checkout for " << identityKey;
+					return ionet::NodePacketIoPair();
+				}
+
+				return checkOut(state, ioDuration);
+			}
+
+		private:
+			ionet::NodePacketIoPair checkOut(const WriterState& state, const utils::TimeSpan& ioDuration) {
 				// important - capture pSocket by value in order to prevent it from being removed out from under the
 				// error handling packet io, also capture this for the same reason
 				auto errorHandler = [pThis = shared_from_this(), pSocket = state.pSocket, node = state.Node]() {
@@ -342,7 +362,6 @@ namespace bitxorcore { namespace net {
 				return ionet::NodePacketIoPair(state.Node, pPacketIo);
 			}
 
-		private:
 			ErrorHandlingPacketIo::CompletionCallback createTimedCompletionHandler(
 					const SocketPointer& pSocket,
 					const utils::TimeSpan& ioDuration,
@@ -52,6 +52,10 @@ namespace bitxorcore { namespace net {
 		virtual size_t numAvailableWriters() const = 0;
 
 	public:
+		/// Retrieves a packet io pair around an active connection to the node with \a identityKey or an empty pair
+		/// if no such connection is available. After \a ioDuration elapses, the connection will timeout.
+		virtual ionet::NodePacketIoPair pickOneByKey(const Key& identityKey, const utils::TimeSpan& ioDuration) = 0;
+
 		/// Broadcasts \a payload to all active connections.
 		virtual void broadcast(const ionet::PacketPayload& payload) = 0;
 
@@ -22,11 +22,58 @@
 
 #pragma once
 #include "ObserverTypes.h"
+#include "bitxorcore/model/NotificationDispatchTable.h"
 #include "bitxorcore/utils/NamedObject.h"
 #include <vector>
 
 namespace bitxorcore { namespace observers {
 
+	/// Aggregate notification observer that forwards each notification to the observers selected by a dispatch lookup.
+	template<typename TNotification, typename TDispatchLookup = model::UniversalDispatchLookup>
+	class DefaultAggregateNotificationObserver : public AggregateNotificationObserverT<TNotification> {
+	private:
+		using NotificationObserverPointerVector = std::vector<NotificationObserverPointerT<TNotification>>;
+
+	public:
+		/// Creates an aggregate around \a observers that uses \a dispatchLookup to select the observers of each notification.
+		explicit DefaultAggregateNotificationObserver(
+				NotificationObserverPointerVector&& observers,
+				TDispatchLookup&& dispatchLookup = TDispatchLookup())
+				: m_observers(std::move(observers))
+				, m_dispatchLookup(std::move(dispatchLookup))
+				, m_name(utils::ReduceNames(utils::ExtractNames(m_observers)))
+		{}
+
+	public:
+		const std::string& name() const override {
+			return m_name;
+		}
+
+		std::vector<std::string> names() const override {
+			return utils::ExtractNames(m_observers);
+		}
+
+		void notify(const TNotification& notification, ObserverContext& context) const override {
+			const auto& observers = m_dispatchLookup.find(notification, m_observers);
+			if (NotifyMode::Commit == context.Mode)
+				notifyAll(observers.cbegin(), observers.cend(), notification, context);
+			else
+				notifyAll(observers.crbegin(), observers.crend(), notification, context);
+		}
+
+	private:
+		template<typename TIter>
+		void notifyAll(TIter begin, TIter end, const TNotification& notification, ObserverContext& context) const {
+			for (auto iter = begin; end != iter; ++iter)
+				(*iter)->notify(notification, context);
+		}
+
+	private:
+		NotificationObserverPointerVector m_observers;
+		TDispatchLookup m_dispatchLookup;
+		std::string m_name;
+	};
+
 	/// Strongly typed aggregate notification observer builder.
 	template<typename TNotification>
 	class AggregateObserverBuilder {
@@ -43,45 +90,9 @@ namespace bitxorcore { namespace observers {
 
 		/// Builds a strongly typed notification observer.
 		AggregateNotificationObserverPointerT<TNotification> build() {
-			return std::make_unique<DefaultAggregateNotificationObserver>(std::move(m_observers));
+			return std::make_unique<DefaultAggregateNotificationObserver<TNotification>>(std::move(m_observers));
 		}
 
-	private:
-		class DefaultAggregateNotificationObserver : public AggregateNotificationObserverT<TNotification> {
-		public:
-			explicit DefaultAggregateNotificationObserver(NotificationObserverPointerVector&& observers)
-					: m_observers(std::move(observers))
-					, m_name(utils::ReduceNames(utils::ExtractNames(m_observers)))
-			{}
-
-		public:
-			const std::string& name() const override {
-				return m_name;
-			}
-
-			std::vector<std::string> names() const override {
-				return utils::ExtractNames(m_observers);
-			}
-
-			void notify(const TNotification& notification, ObserverContext& context) const override {
-				if (NotifyMode::Commit == context.Mode)
-					notifyAll(m_observers.cbegin(), m_observers.cend(), notification, context);
-				else
-					notifyAll(m_observers.crbegin(), m_observers.crend(), notification, context);
-			}
-
-		private:
-			template<typename TIter>
-			void notifyAll(TIter begin, TIter end, const TNotification& notification, ObserverContext& context) const {
-				for (auto iter = begin; end != iter; ++iter)
-					(*iter)->notify(notification, context);
-			}
-
-		private:
-			NotificationObserverPointerVector m_observers;
-			std::string m_name;
-		};
-
 	private:
 		NotificationObserverPointerVector m_observers;
 	};
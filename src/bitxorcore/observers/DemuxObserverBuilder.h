@@ -22,40 +22,40 @@
 
 #pragma once
 #include "AggregateObserverBuilder.h"
-#include "ObserverTypes.h"
-#include <functional>
-#include <vector>
 
 namespace bitxorcore { namespace observers {
 
 	/// Demultiplexing observer builder.
+	/// \note Observers are grouped by notification type when the observer is built, so each notification is only forwarded
+	///       to observers registered for its type and observers registered for all types.
 	class DemuxObserverBuilder {
 	private:
-		using NotificationObserverPredicate = predicate<const model::Notification&>;
+		using NotificationObserverPointer = NotificationObserverPointerT<model::Notification>;
+		using NotificationObserverPointerVector = std::vector<NotificationObserverPointer>;
+		using DispatchTable = model::NotificationDispatchTable<NotificationObserver>;
+		using DispatchLookup = model::NotificationDispatchTableLookup<NotificationObserver>;
 
 	public:
 		/// Adds an observer (\a pObserver) to the builder that is invoked only when matching notifications are processed.
 		template<typename TNotification>
 		DemuxObserverBuilder& add(NotificationObserverPointerT<TNotification>&& pObserver) {
-			auto predicate = [type = TNotification::Notification_Type](const auto& notification) {
-				return model::AreEqualExcludingChannel(type, notification.Type);
-			};
-			m_builder.add(std::make_unique<ConditionalObserver<TNotification>>(std::move(pObserver), predicate));
+			m_observers.push_back(std::make_unique<TypedObserver<TNotification>>(std::move(pObserver)));
+			m_dispatchTable.add(TNotification::Notification_Type, m_observers.back().get());
 			return *this;
 		}
 
 		/// Builds a demultiplexing observer.
 		AggregateNotificationObserverPointerT<model::Notification> build() {
-			return m_builder.build();
+			return std::make_unique<DefaultAggregateNotificationObserver<model::Notification, DispatchLookup>>(
+					std::move(m_observers),
+					DispatchLookup(std::move(m_dispatchTable)));
 		}
 
 	private:
 		template<typename TNotification>
-		class ConditionalObserver : public NotificationObserver {
+		class TypedObserver : public NotificationObserver {
 		public:
-			ConditionalObserver(NotificationObserverPointerT<TNotification>&& pObserver, const NotificationObserverPredicate& predicate)
-					: m_pObserver(std::move(pObserver))
-					, m_predicate(predicate)
+			explicit TypedObserver(NotificationObserverPointerT<TNotification>&& pObserver) : m_pObserver(std::move(pObserver))
 			{}
 
 		public:
@@ -64,25 +64,24 @@ namespace bitxorcore { namespace observers {
 			}
 
 			void notify(const model::Notification& notification, ObserverContext& context) const override {
-				if (!m_predicate(notification))
-					return;
-
+				// dispatch table guarantees notification type matches
 				m_pObserver->notify(static_cast<const TNotification&>(notification), context);
 			}
 
 		private:
 			NotificationObserverPointerT<TNotification> m_pObserver;
-			NotificationObserverPredicate m_predicate;
 		};
 
 	private:
-		AggregateObserverBuilder<model::Notification> m_builder;
+		NotificationObserverPointerVector m_observers;
+		DispatchTable m_dispatchTable;
 	};
 
 	/// Adds an observer (\a pObserver) to the builder that is always invoked.
 	template<>
 	inline DemuxObserverBuilder& DemuxObserverBuilder::add(NotificationObserverPointerT<model::Notification>&& pObserver) {
-		m_builder.add(std::move(pObserver));
+		m_observers.push_back(std::move(pObserver));
+		m_dispatchTable.addUniversal(m_observers.back().get());
 		return *this;
 	}
 }}
@@ -23,6 +23,7 @@
 #pragma once
 #include "ObserverContext.h"
 #include "ObserverTypes.h"
+#include "bitxorcore/model/ResolutionCache.h"
 
 namespace bitxorcore { namespace observers {
 
@@ -54,4 +55,19 @@ namespace bitxorcore { namespace observers {
 				context.StatementBuilder().addReceipt(model::ArtifactExpiryReceipt<decltype(id)>(receiptType, id));
 		});
 	}
+
+	/// Creates an observer with \a name that clears all memoized alias resolutions when a notification of type \a TNotification
+	/// is observed.
+	/// \note Alias state changing observers must be registered before this observer, so that the resolutions are cleared
+	///       after the alias state changes on commit.
+	template<typename TNotification>
+	NotificationObserverPointerT<TNotification> CreateResolutionCacheInvalidationObserver(const std::string& name) {
+		using ObserverType = FunctionalNotificationObserverT<TNotification>;
+		return std::make_unique<ObserverType>(name + "ResolutionCacheInvalidationObserver", [](const auto&, auto& context) {
+			// undecorated resolvers are used because decorated resolvers (capturing resolution statements) never memoize resolutions
+			auto* pResolutionCache = context.UndecoratedResolvers.resolutionCache();
+			if (pResolutionCache)
+				pResolutionCache->clear();
+		});
+	}
 }}
@@ -39,9 +39,13 @@ namespace bitxorcore { namespace plugins {
 			using CacheType = typename TCacheDescriptor::CacheType;
 			using CachePacketTypes = CachePacketTypesT<FacilityCode>;
 
-			pluginManager.addHandlerHook([](auto& handlers, const cache::BitxorCoreCache& cache) {
+			auto maxStatePathKeys = pluginManager.storageConfig().MaxStatePathKeysPerRequest;
+			pluginManager.addHandlerHook([maxStatePathKeys](auto& handlers, const cache::BitxorCoreCache& cache) {
 				using PacketType = StatePathRequestPacket<CachePacketTypes::State_Path, KeyType>;
 				handlers::RegisterStatePathHandler<PacketType>(handlers, cache.sub<CacheType>());
+
+				using BatchRequestTraits = BatchHandlerFactoryTraits<CachePacketTypes::State_Paths, KeyType>;
+				handlers::RegisterBatchStatePathHandler<BatchRequestTraits>(handlers, cache.sub<CacheType>(), maxStatePathKeys);
 			});
 
 			pluginManager.addDiagnosticHandlerHook([](auto& handlers, const cache::BitxorCoreCache& cache) {
@@ -57,6 +61,7 @@ namespace bitxorcore { namespace plugins {
 		struct CachePacketTypesT {
 			static constexpr auto State_Path = static_cast<ionet::PacketType>(0x200 + utils::to_underlying_type(FacilityCode));
 			static constexpr auto Diagnostic_Infos = static_cast<ionet::PacketType>(0x400 + utils::to_underlying_type(FacilityCode));
+			static constexpr auto State_Paths = static_cast<ionet::PacketType>(0x500 + utils::to_underlying_type(FacilityCode));
 		};
 
 		template<ionet::PacketType PacketType, typename TCacheKey>
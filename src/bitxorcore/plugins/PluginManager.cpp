@@ -21,6 +21,7 @@
 **/
 
 #include "PluginManager.h"
+#include "bitxorcore/cache_db/SharedRocksDatabase.h"
 #include <filesystem>
 
 namespace bitxorcore { namespace plugins {
@@ -34,6 +35,7 @@ namespace bitxorcore { namespace plugins {
 			, m_storageConfig(storageConfig)
 			, m_userConfig(userConfig)
 			, m_inflationConfig(inflationConfig)
+			, m_pResolutionCacheStatistics(std::make_shared<model::ResolutionCacheStatistics>())
 	{}
 
 	// region config
@@ -58,10 +60,26 @@ namespace bitxorcore { namespace plugins {
 		if (!m_storageConfig.PreferCacheDatabase)
 			return cache::CacheConfiguration();
 
-		return cache::CacheConfiguration(
+		auto cacheConfig = cache::CacheConfiguration(
 				(std::filesystem::path(m_storageConfig.CacheDatabaseDirectory) / name).generic_string(),
 				m_storageConfig.CacheDatabaseConfig,
 				m_config.EnableVerifiableState ? cache::PatriciaTreeStorageMode::Enabled : cache::PatriciaTreeStorageMode::Disabled);
+		if (m_storageConfig.CacheDatabaseConfig.EnableSharedDatabase) {
+			// shared database is opened lazily so that it is only created when at least one cache can be hosted by it
+			if (!m_pSharedCacheDatabase) {
+				m_pSharedCacheDatabase = std::make_shared<cache::SharedRocksDatabase>(
+						(std::filesystem::path(m_storageConfig.CacheDatabaseDirectory) / Shared_Cache_Database_Name).generic_string(),
+						m_storageConfig.CacheDatabaseConfig);
+			}
+
+			cacheConfig.SharedDatabase = m_pSharedCacheDatabase;
+		}
+
+		return cacheConfig;
+	}
+
+	std::shared_ptr<cache::SharedRocksDatabase> PluginManager::sharedCacheDatabase() const {
+		return m_pSharedCacheDatabase;
 	}
 
 	// endregion
@@ -85,7 +103,10 @@ namespace bitxorcore { namespace plugins {
 	}
 
 	cache::BitxorCoreCache PluginManager::createCache() {
-		return m_cacheBuilder.build();
+		// sub cache commits are only expensive enough to benefit from parallelization when they are flushed to cache databases
+		return m_cacheBuilder.build(
+				m_storageConfig.PreferCacheDatabase ? cache::SubCacheCommitMode::Parallel : cache::SubCacheCommitMode::Sequential,
+				m_pSharedCacheDatabase);
 	}
 
 	// endregion
@@ -223,7 +244,14 @@ namespace bitxorcore { namespace plugins {
 			return [&cache, resolver](const auto& unresolved) { return resolver(cache, unresolved); };
 		};
 
-		return model::ResolverContext(bindResolverToCache(tokenResolver), bindResolverToCache(addressResolver));
+		return model::ResolverContext(
+				bindResolverToCache(tokenResolver),
+				bindResolverToCache(addressResolver),
+				std::make_shared<model::ResolutionCache>(m_pResolutionCacheStatistics));
+	}
+
+	const model::ResolutionCacheStatistics& PluginManager::resolutionCacheStatistics() const {
+		return *m_pResolutionCacheStatistics;
 	}
 
 	// endregion
@@ -28,6 +28,7 @@
 #include "bitxorcore/ionet/PacketHandlers.h"
 #include "bitxorcore/model/BlockchainConfiguration.h"
 #include "bitxorcore/model/NotificationPublisher.h"
+#include "bitxorcore/model/ResolutionCache.h"
 #include "bitxorcore/model/TransactionPlugin.h"
 #include "bitxorcore/observers/DemuxObserverBuilder.h"
 #include "bitxorcore/observers/ObserverTypes.h"
@@ -38,6 +39,9 @@
 
 namespace bitxorcore { namespace plugins {
 
+	/// Name of the shared cache database directory within the cache database directory.
+	constexpr auto Shared_Cache_Database_Name = "shared";
+
 	/// Additional storage configuration.
 	struct StorageConfiguration {
 	public:
@@ -45,6 +49,7 @@ namespace bitxorcore { namespace plugins {
 		StorageConfiguration()
 				: PreferCacheDatabase(false)
 				, CacheDatabaseConfig() // default initialize
+				, MaxStatePathKeysPerRequest(1'000)
 		{}
 
 	public:
@@ -56,6 +61,9 @@ namespace bitxorcore { namespace plugins {
 
 		/// Cache database configuration.
 		config::NodeConfiguration::CacheDatabaseSubConfiguration CacheDatabaseConfig;
+
+		/// Maximum number of keys in a single cache state paths request.
+		uint32_t MaxStatePathKeysPerRequest;
 	};
 
 	/// Manager for registering plugins.
@@ -107,8 +115,12 @@ namespace bitxorcore { namespace plugins {
 		const config::InflationConfiguration& inflationConfig() const;
 
 		/// Gets the cache configuration for cache with \a name.
+		/// \note When enabled, the shared cache database is opened by the first call.
 		cache::CacheConfiguration cacheConfig(const std::string& name) const;
 
+		/// Gets the cache database shared by all caches or \c nullptr if it is not enabled or has not been opened.
+		std::shared_ptr<cache::SharedRocksDatabase> sharedCacheDatabase() const;
+
 		// endregion
 
 		// region transactions
@@ -210,8 +222,12 @@ namespace bitxorcore { namespace plugins {
 		void addAddressResolver(const AddressResolver& resolver);
 
 		/// Creates a resolver context given \a cache.
+		/// \note Resolutions are memoized for the lifetime of the returned context (and its copies).
 		model::ResolverContext createResolverContext(const cache::ReadOnlyBitxorCoreCache& cache) const;
 
+		/// Gets the statistics aggregated across the resolution caches of all created resolver contexts.
+		const model::ResolutionCacheStatistics& resolutionCacheStatistics() const;
+
 		// endregion
 
 		// region publisher
@@ -228,6 +244,7 @@ namespace bitxorcore { namespace plugins {
 		config::InflationConfiguration m_inflationConfig;
 		model::TransactionRegistry m_transactionRegistry;
 		cache::BitxorCoreCacheBuilder m_cacheBuilder;
+		mutable std::shared_ptr<cache::SharedRocksDatabase> m_pSharedCacheDatabase;
 
 		std::vector<HandlerHook> m_nonDiagnosticHandlerHooks;
 		std::vector<HandlerHook> m_diagnosticHandlerHooks;
@@ -239,6 +256,7 @@ namespace bitxorcore { namespace plugins {
 
 		std::vector<TokenResolver> m_tokenResolvers;
 		std::vector<AddressResolver> m_addressResolvers;
+		std::shared_ptr<model::ResolutionCacheStatistics> m_pResolutionCacheStatistics;
 	};
 }}
 
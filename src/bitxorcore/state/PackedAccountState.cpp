@@ -0,0 +1,332 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PackedAccountState.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace bitxorcore { namespace state {
+
+	// region layout
+
+	// all fixed size fields are stored in the header, which is followed by (in order):
+	// 1. tokens sorted by id
+	// 2. non-empty importance snapshots (most recent first)
+	// 3. non-empty activity buckets (most recent first)
+	// 4. supplemental public keys indicated by mask (linked, node, vrf)
+	// 5. voting public keys
+	// the order ensures that all 8-byte aligned sections precede all sections with weaker alignment requirements
+
+	struct PackedAccountState::Header {
+		bitxorcore::Address Address;
+		Height AddressHeight;
+		Key PublicKey;
+		Height PublicKeyHeight;
+		TokenId OptimizedTokenId;
+
+		uint16_t NumTokens;
+		state::AccountType AccountType;
+		AccountPublicKeys::KeyType SupplementalPublicKeysMask;
+		uint8_t NumVotingPublicKeys;
+		uint8_t NumImportanceSnapshots;
+		uint8_t NumActivityBuckets;
+	};
+
+	namespace {
+		using ImportanceSnapshot = AccountImportanceSnapshots::ImportanceSnapshot;
+		using ActivityBucket = AccountActivityBuckets::ActivityBucket;
+
+		static_assert(0 == sizeof(model::Token) % alignof(ImportanceSnapshot));
+		static_assert(0 == sizeof(ImportanceSnapshot) % alignof(ActivityBucket));
+		static_assert(0 == sizeof(ActivityBucket) % alignof(model::PinnedVotingKey));
+		static_assert(0 == Key::Size % alignof(model::PinnedVotingKey));
+
+		constexpr auto Max_Tokens = std::numeric_limits<uint16_t>::max();
+
+		constexpr AccountPublicKeys::KeyType Supplemental_Key_Types[] = {
+			AccountPublicKeys::KeyType::Linked,
+			AccountPublicKeys::KeyType::Node,
+			AccountPublicKeys::KeyType::VRF
+		};
+
+		size_t CountSupplementalPublicKeys(AccountPublicKeys::KeyType mask) {
+			return static_cast<size_t>(std::count_if(
+					std::cbegin(Supplemental_Key_Types),
+					std::cend(Supplemental_Key_Types),
+					[mask](auto keyType) { return HasFlag(keyType, mask); }));
+		}
+
+		template<typename TContainer, typename TIsEmpty>
+		uint8_t CountUntilLastNonEmpty(const TContainer& container, TIsEmpty isEmpty) {
+			uint8_t count = 0;
+			uint8_t index = 0;
+			for (const auto& value : container) {
+				++index;
+				if (!isEmpty(value))
+					count = index;
+			}
+
+			return count;
+		}
+
+		template<typename T>
+		const T* SectionAt(const uint8_t* pData, size_t offset) {
+			return reinterpret_cast<const T*>(pData + offset);
+		}
+
+		template<typename T>
+		T* SectionAt(uint8_t* pData, size_t offset) {
+			return reinterpret_cast<T*>(pData + offset);
+		}
+
+		struct SectionOffsets {
+		public:
+			template<typename THeader>
+			explicit SectionOffsets(const THeader& header)
+					: Tokens(sizeof(THeader))
+					, ImportanceSnapshots(Tokens + header.NumTokens * sizeof(model::Token))
+					, ActivityBuckets(ImportanceSnapshots + header.NumImportanceSnapshots * sizeof(ImportanceSnapshot))
+					, SupplementalPublicKeys(ActivityBuckets + header.NumActivityBuckets * sizeof(ActivityBucket))
+					, VotingPublicKeys(SupplementalPublicKeys + CountSupplementalPublicKeys(header.SupplementalPublicKeysMask) * Key::Size)
+					, Size(VotingPublicKeys + header.NumVotingPublicKeys * sizeof(model::PinnedVotingKey))
+			{}
+
+		public:
+			size_t Tokens;
+			size_t ImportanceSnapshots;
+			size_t ActivityBuckets;
+			size_t SupplementalPublicKeys;
+			size_t VotingPublicKeys;
+			size_t Size;
+		};
+	}
+
+	// endregion
+
+	// region constructor
+
+	PackedAccountState::PackedAccountState(const AccountState& accountState) {
+		if (accountState.Balances.size() > Max_Tokens)
+			BITXORCORE_THROW_INVALID_ARGUMENT_1("account state has too many tokens to be packed", accountState.Balances.size());
+
+		Header header;
+		header.Address = accountState.Address;
+		header.AddressHeight = accountState.AddressHeight;
+		header.PublicKey = accountState.PublicKey;
+		header.PublicKeyHeight = accountState.PublicKeyHeight;
+		header.OptimizedTokenId = accountState.Balances.optimizedTokenId();
+
+		header.NumTokens = static_cast<uint16_t>(accountState.Balances.size());
+		header.AccountType = accountState.AccountType;
+		header.SupplementalPublicKeysMask = accountState.SupplementalPublicKeys.mask();
+		header.NumVotingPublicKeys = static_cast<uint8_t>(accountState.SupplementalPublicKeys.voting().size());
+		header.NumImportanceSnapshots = CountUntilLastNonEmpty(accountState.ImportanceSnapshots, [](const auto& snapshot) {
+			return model::ImportanceHeight() == snapshot.Height;
+		});
+		header.NumActivityBuckets = CountUntilLastNonEmpty(accountState.ActivityBuckets, [](const auto& bucket) {
+			return model::ImportanceHeight() == bucket.StartHeight;
+		});
+
+		SectionOffsets offsets(header);
+		m_pData = std::make_unique<uint8_t[]>(offsets.Size);
+		std::memcpy(m_pData.get(), &header, sizeof(Header));
+
+		auto* pToken = SectionAt<model::Token>(m_pData.get(), offsets.Tokens);
+		for (const auto& pair : accountState.Balances)
+			*pToken++ = { pair.first, pair.second };
+
+		std::sort(SectionAt<model::Token>(m_pData.get(), offsets.Tokens), pToken, [](const auto& lhs, const auto& rhs) {
+			return lhs.TokenId < rhs.TokenId;
+		});
+
+		std::copy_n(
+				accountState.ImportanceSnapshots.begin(),
+				header.NumImportanceSnapshots,
+				SectionAt<ImportanceSnapshot>(m_pData.get(), offsets.ImportanceSnapshots));
+		std::copy_n(
+				accountState.ActivityBuckets.begin(),
+				header.NumActivityBuckets,
+				SectionAt<ActivityBucket>(m_pData.get(), offsets.ActivityBuckets));
+
+		const auto& supplementalPublicKeys = accountState.SupplementalPublicKeys;
+		auto* pKey = SectionAt<Key>(m_pData.get(), offsets.SupplementalPublicKeys);
+		if (HasFlag(AccountPublicKeys::KeyType::Linked, header.SupplementalPublicKeysMask))
+			*pKey++ = supplementalPublicKeys.linked().get();
+
+		if (HasFlag(AccountPublicKeys::KeyType::Node, header.SupplementalPublicKeysMask))
+			*pKey++ = supplementalPublicKeys.node().get();
+
+		if (HasFlag(AccountPublicKeys::KeyType::VRF, header.SupplementalPublicKeysMask))
+			*pKey++ = supplementalPublicKeys.vrf().get();
+
+		auto* pVotingPublicKey = SectionAt<model::PinnedVotingKey>(m_pData.get(), offsets.VotingPublicKeys);
+		for (auto i = 0u; i < header.NumVotingPublicKeys; ++i)
+			pVotingPublicKey[i] = supplementalPublicKeys.voting().get(i);
+	}
+
+	// endregion
+
+	// region accessors
+
+	const bitxorcore::Address& PackedAccountState::address() const {
+		return header().Address;
+	}
+
+	Height PackedAccountState::addressHeight() const {
+		return header().AddressHeight;
+	}
+
+	const Key& PackedAccountState::publicKey() const {
+		return header().PublicKey;
+	}
+
+	Height PackedAccountState::publicKeyHeight() const {
+		return header().PublicKeyHeight;
+	}
+
+	state::AccountType PackedAccountState::accountType() const {
+		return header().AccountType;
+	}
+
+	size_t PackedAccountState::allocationSize() const {
+		return SectionOffsets(header()).Size;
+	}
+
+	size_t PackedAccountState::numTokens() const {
+		return header().NumTokens;
+	}
+
+	Amount PackedAccountState::balance(TokenId tokenId) const {
+		auto* pTokensEnd = tokens() + header().NumTokens;
+		auto iter = std::lower_bound(tokens(), pTokensEnd, tokenId, [](const auto& token, auto id) {
+			return token.TokenId < id;
+		});
+
+		return pTokensEnd != iter && tokenId == iter->TokenId ? iter->Amount : Amount();
+	}
+
+	Importance PackedAccountState::currentImportance() const {
+		return 0 == header().NumImportanceSnapshots ? Importance() : importanceSnapshots()->Importance;
+	}
+
+	Importance PackedAccountState::importance(model::ImportanceHeight height) const {
+		auto* pSnapshotsEnd = importanceSnapshots() + header().NumImportanceSnapshots;
+		auto iter = std::find_if(importanceSnapshots(), pSnapshotsEnd, [height](const auto& snapshot) {
+			return snapshot.Height == height;
+		});
+
+		return pSnapshotsEnd == iter ? Importance() : iter->Importance;
+	}
+
+	AccountActivityBuckets::ActivityBucket PackedAccountState::activityBucket(model::ImportanceHeight height) const {
+		auto* pBucketsEnd = activityBuckets() + header().NumActivityBuckets;
+		auto iter = std::find_if(activityBuckets(), pBucketsEnd, [height](const auto& bucket) {
+			return bucket.StartHeight == height;
+		});
+
+		return pBucketsEnd == iter ? ActivityBucket() : *iter;
+	}
+
+	// endregion
+
+	// region unpack
+
+	AccountState PackedAccountState::unpack() const {
+		const auto& header = this->header();
+		AccountState accountState(header.Address, header.AddressHeight);
+		accountState.PublicKey = header.PublicKey;
+		accountState.PublicKeyHeight = header.PublicKeyHeight;
+		accountState.AccountType = header.AccountType;
+
+		auto& accountPublicKeys = accountState.SupplementalPublicKeys;
+		const auto* pKey = supplementalPublicKeys();
+		if (HasFlag(AccountPublicKeys::KeyType::Linked, header.SupplementalPublicKeysMask))
+			accountPublicKeys.linked().set(*pKey++);
+
+		if (HasFlag(AccountPublicKeys::KeyType::Node, header.SupplementalPublicKeysMask))
+			accountPublicKeys.node().set(*pKey++);
+
+		if (HasFlag(AccountPublicKeys::KeyType::VRF, header.SupplementalPublicKeysMask))
+			accountPublicKeys.vrf().set(*pKey++);
+
+		for (auto i = 0u; i < header.NumVotingPublicKeys; ++i)
+			accountPublicKeys.voting().add(votingPublicKeys()[i]);
+
+		// snapshots and buckets are stored most recent first, so they need to be reapplied in reverse order
+		for (auto i = header.NumImportanceSnapshots; i > 0; --i) {
+			const auto& snapshot = importanceSnapshots()[i - 1];
+			if (model::ImportanceHeight() == snapshot.Height)
+				accountState.ImportanceSnapshots.push();
+			else
+				accountState.ImportanceSnapshots.set(snapshot.Importance, snapshot.Height);
+		}
+
+		for (auto i = header.NumActivityBuckets; i > 0; --i) {
+			const auto& bucket = activityBuckets()[i - 1];
+			if (model::ImportanceHeight() == bucket.StartHeight) {
+				accountState.ActivityBuckets.push();
+				continue;
+			}
+
+			accountState.ActivityBuckets.update(bucket.StartHeight, [&bucket](auto& accountStateBucket) {
+				accountStateBucket = bucket;
+			});
+		}
+
+		accountState.Balances.optimize(header.OptimizedTokenId);
+		for (auto i = 0u; i < header.NumTokens; ++i)
+			accountState.Balances.credit(tokens()[i].TokenId, tokens()[i].Amount);
+
+		return accountState;
+	}
+
+	// endregion
+
+	// region private accessors
+
+	const PackedAccountState::Header& PackedAccountState::header() const {
+		return *SectionAt<Header>(m_pData.get(), 0);
+	}
+
+	const model::Token* PackedAccountState::tokens() const {
+		return SectionAt<model::Token>(m_pData.get(), SectionOffsets(header()).Tokens);
+	}
+
+	const AccountImportanceSnapshots::ImportanceSnapshot* PackedAccountState::importanceSnapshots() const {
+		return SectionAt<ImportanceSnapshot>(m_pData.get(), SectionOffsets(header()).ImportanceSnapshots);
+	}
+
+	const AccountActivityBuckets::ActivityBucket* PackedAccountState::activityBuckets() const {
+		return SectionAt<ActivityBucket>(m_pData.get(), SectionOffsets(header()).ActivityBuckets);
+	}
+
+	const Key* PackedAccountState::supplementalPublicKeys() const {
+		return SectionAt<Key>(m_pData.get(), SectionOffsets(header()).SupplementalPublicKeys);
+	}
+
+	const model::PinnedVotingKey* PackedAccountState::votingPublicKeys() const {
+		return SectionAt<model::PinnedVotingKey>(m_pData.get(), SectionOffsets(header()).VotingPublicKeys);
+	}
+
+	// endregion
+}}
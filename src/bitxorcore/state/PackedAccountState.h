@@ -0,0 +1,96 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "AccountState.h"
+#include "bitxorcore/utils/NonCopyable.h"
+#include <memory>
+
+namespace bitxorcore { namespace state {
+
+	/// Read-only account state that stores all account data in a single contiguous allocation.
+	/// \note Balances are stored inline as a sorted token vector and only non-empty importance snapshots and activity buckets
+	///       are stored, so this is suitable for holding many mostly read account states (e.g. during importance calculation).
+	class PackedAccountState : public utils::MoveOnly {
+	private:
+		struct Header;
+
+	public:
+		/// Creates a packed account state from \a accountState.
+		explicit PackedAccountState(const AccountState& accountState);
+
+	public:
+		/// Gets the address of the account.
+		const bitxorcore::Address& address() const;
+
+		/// Gets the height at which address has been obtained.
+		Height addressHeight() const;
+
+		/// Gets the public key of the account.
+		const Key& publicKey() const;
+
+		/// Gets the height at which public key has been obtained.
+		Height publicKeyHeight() const;
+
+		/// Gets the type of account.
+		state::AccountType accountType() const;
+
+		/// Gets the size of the underlying allocation in bytes.
+		size_t allocationSize() const;
+
+	public:
+		/// Gets the number of tokens owned.
+		size_t numTokens() const;
+
+		/// Gets the balance of the given token (\a tokenId).
+		Amount balance(TokenId tokenId) const;
+
+		/// Gets the current importance of the account.
+		Importance currentImportance() const;
+
+		/// Gets the importance of the account at \a height.
+		Importance importance(model::ImportanceHeight height) const;
+
+		/// Gets the activity bucket at \a height.
+		AccountActivityBuckets::ActivityBucket activityBucket(model::ImportanceHeight height) const;
+
+	public:
+		/// Unpacks this packed account state into a (mutable) account state.
+		AccountState unpack() const;
+
+	private:
+		const Header& header() const;
+
+		const model::Token* tokens() const;
+
+		const AccountImportanceSnapshots::ImportanceSnapshot* importanceSnapshots() const;
+
+		const AccountActivityBuckets::ActivityBucket* activityBuckets() const;
+
+		const Key* supplementalPublicKeys() const;
+
+		const model::PinnedVotingKey* votingPublicKeys() const;
+
+	private:
+		std::unique_ptr<uint8_t[]> m_pData;
+	};
+}}
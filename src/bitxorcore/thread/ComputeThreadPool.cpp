@@ -0,0 +1,277 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ComputeThreadPool.h"
+#include "IoThreadPool.h"
+#include "ThreadGroup.h"
+#include "ThreadInfo.h"
+#include "bitxorcore/utils/AtomicIncrementDecrementGuard.h"
+#include "bitxorcore/utils/Logging.h"
+#include "bitxorcore/utils/SpinLock.h"
+#include "bitxorcore/exceptions.h"
+#include <boost/asio.hpp>
+#include <condition_variable>
+#include <deque>
+
+namespace bitxorcore { namespace thread {
+
+	namespace {
+		// region WorkQueue
+
+		// owner pushes and pops at the back, thieves pop at the front
+		class WorkQueue {
+		public:
+			void push(const action& work) {
+				utils::SpinLockGuard guard(m_lock);
+				m_actions.push_back(work);
+			}
+
+			bool tryPopBack(action& work) {
+				utils::SpinLockGuard guard(m_lock);
+				if (m_actions.empty())
+					return false;
+
+				work = std::move(m_actions.back());
+				m_actions.pop_back();
+				return true;
+			}
+
+			bool tryPopFront(action& work) {
+				utils::SpinLockGuard guard(m_lock);
+				if (m_actions.empty())
+					return false;
+
+				work = std::move(m_actions.front());
+				m_actions.pop_front();
+				return true;
+			}
+
+		private:
+			utils::SpinLock m_lock;
+			std::deque<action> m_actions;
+		};
+
+		// endregion
+
+		// region DefaultComputeThreadPool
+
+		thread_local const void* t_pCurrentPool = nullptr;
+		thread_local size_t t_currentWorkerId = 0;
+
+		class DefaultComputeThreadPool : public ComputeThreadPool {
+		public:
+			DefaultComputeThreadPool(const ComputeThreadPoolOptions& options, const std::string& name)
+					: m_options(options)
+					, m_name(name)
+					, m_tag(m_name.empty() ? std::string() : " (" + m_name + ")")
+					, m_numWorkerThreads(0)
+					, m_nextQueueId(0)
+					, m_numPendingActions(0)
+					, m_isStopping(false) {
+				if (0 == m_options.NumWorkerThreads)
+					BITXORCORE_THROW_INVALID_ARGUMENT("compute thread pool must have at least one worker thread");
+
+				for (auto i = 0u; i < m_options.NumWorkerThreads; ++i)
+					m_queues.push_back(std::make_unique<WorkQueue>());
+			}
+
+			~DefaultComputeThreadPool() override {
+				join();
+			}
+
+		public:
+			uint32_t numWorkerThreads() const override {
+				return m_numWorkerThreads;
+			}
+
+			const std::string& name() const override {
+				return m_name;
+			}
+
+		public:
+			void post(const action& work) override {
+				// keep local work local in order to improve cache locality; spread external work across all queues
+				auto queueId = this == t_pCurrentPool ? t_currentWorkerId : m_nextQueueId++ % m_queues.size();
+
+				{
+					// increment before pushing so that an action is never popped before it is counted
+					std::lock_guard<std::mutex> lock(m_mutex);
+					++m_numPendingActions;
+				}
+
+				m_queues[queueId]->push(work);
+				m_condition.notify_one();
+			}
+
+			void start() override {
+				if (m_pThreads)
+					BITXORCORE_THROW_RUNTIME_ERROR_1("cannot restart running thread pool", m_numWorkerThreads);
+
+				BITXORCORE_LOG(trace) << "spawning threads" << m_tag;
+				m_pThreads = std::make_unique<ThreadGroup>();
+				for (auto i = 0u; i < m_queues.size(); ++i) {
+					m_pThreads->spawn([this, i]() {
+						thread::SetThreadName(std::to_string(i) + this->m_tag + " compute");
+						pinWorkerThread(i);
+						computeWorkerFunction(i);
+					});
+				}
+
+				// wait for the threads to be spawned
+				BITXORCORE_LOG(trace) << "waiting for threads to be spawned" << m_tag;
+				while (m_numWorkerThreads < m_queues.size()) {}
+				BITXORCORE_LOG(info) << "spawned " << m_pThreads->size() << " compute workers" << m_tag;
+			}
+
+			void join() override {
+				if (!m_pThreads)
+					return;
+
+				BITXORCORE_LOG(debug) << "waiting for " << m_numWorkerThreads << " compute pool threads to exit" << m_tag;
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					m_isStopping = true;
+				}
+
+				m_condition.notify_all();
+				m_pThreads.reset();
+				m_isStopping = false;
+				BITXORCORE_LOG(info) << "all compute pool threads exited" << m_tag;
+			}
+
+		private:
+			void pinWorkerThread(size_t workerId) {
+				if (m_options.CpuIds.empty())
+					return;
+
+				auto cpuId = m_options.CpuIds[workerId % m_options.CpuIds.size()];
+				if (!SetThreadAffinity(cpuId))
+					BITXORCORE_LOG(warning) << "unable to pin compute worker " << workerId << " to cpu " << cpuId << m_tag;
+			}
+
+			bool tryTake(size_t workerId, action& work) {
+				if (m_queues[workerId]->tryPopBack(work))
+					return true;
+
+				for (auto i = 1u; i < m_queues.size(); ++i) {
+					if (m_queues[(workerId + i) % m_queues.size()]->tryPopFront(work))
+						return true;
+				}
+
+				return false;
+			}
+
+			void computeWorkerFunction(size_t workerId) {
+				BITXORCORE_LOG(trace) << "compute worker thread started" << m_tag;
+
+				t_pCurrentPool = this;
+				t_currentWorkerId = workerId;
+				auto incrementDecrementGuard = utils::MakeIncrementDecrementGuard(m_numWorkerThreads);
+				for (;;) {
+					action work;
+					if (tryTake(workerId, work)) {
+						--m_numPendingActions;
+						work();
+						continue;
+					}
+
+					// all pending actions are drained before exiting
+					std::unique_lock<std::mutex> lock(m_mutex);
+					m_condition.wait(lock, [this]() { return 0 != m_numPendingActions || m_isStopping; });
+					if (0 == m_numPendingActions && m_isStopping)
+						break;
+				}
+
+				t_pCurrentPool = nullptr;
+				BITXORCORE_LOG(trace) << "compute worker thread finished" << m_tag;
+			}
+
+		private:
+			ComputeThreadPoolOptions m_options;
+			std::string m_name;
+			std::string m_tag;
+
+			std::vector<std::unique_ptr<WorkQueue>> m_queues;
+			std::unique_ptr<ThreadGroup> m_pThreads;
+			std::atomic<uint32_t> m_numWorkerThreads;
+			std::atomic<size_t> m_nextQueueId;
+
+			std::atomic<size_t> m_numPendingActions;
+			bool m_isStopping;
+			std::mutex m_mutex;
+			std::condition_variable m_condition;
+		};
+
+		// endregion
+
+		// region MergedComputeThreadPool
+
+		class MergedComputeThreadPool : public ComputeThreadPool {
+		public:
+			explicit MergedComputeThreadPool(IoThreadPool& ioPool)
+					: m_pIoPool(&ioPool)
+					, m_name(ioPool.name())
+			{}
+
+		public:
+			uint32_t numWorkerThreads() const override {
+				auto* pIoPool = m_pIoPool.load();
+				return pIoPool ? pIoPool->numWorkerThreads() : 0;
+			}
+
+			const std::string& name() const override {
+				return m_name;
+			}
+
+		public:
+			void post(const action& work) override {
+				auto* pIoPool = m_pIoPool.load();
+				if (!pIoPool)
+					BITXORCORE_THROW_RUNTIME_ERROR("cannot post work to joined merged compute pool");
+
+				boost::asio::post(pIoPool->ioContext(), work);
+			}
+
+			void start() override
+			{}
+
+			void join() override {
+				// posted work is drained when the io pool is joined
+				m_pIoPool = nullptr;
+			}
+
+		private:
+			std::atomic<IoThreadPool*> m_pIoPool;
+			std::string m_name;
+		};
+
+		// endregion
+	}
+
+	std::unique_ptr<ComputeThreadPool> CreateComputeThreadPool(const ComputeThreadPoolOptions& options, const char* name) {
+		return std::make_unique<DefaultComputeThreadPool>(options, name ? std::string(name) : std::string());
+	}
+
+	std::unique_ptr<ComputeThreadPool> CreateMergedComputeThreadPool(IoThreadPool& ioPool) {
+		return std::make_unique<MergedComputeThreadPool>(ioPool);
+	}
+}}
@@ -0,0 +1,77 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "bitxorcore/functions.h"
+#include <memory>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace bitxorcore { namespace thread { class IoThreadPool; } }
+
+namespace bitxorcore { namespace thread {
+
+	/// Compute thread pool options.
+	struct ComputeThreadPoolOptions {
+		/// Number of worker threads.
+		size_t NumWorkerThreads;
+
+		/// Optional cpu ids to pin worker threads to.
+		/// \note When nonempty, worker \c i is pinned to cpu <tt>CpuIds[i % CpuIds.size()]</tt>.
+		std::vector<uint32_t> CpuIds;
+	};
+
+	/// Represents a thread pool optimized for cpu-bound work.
+	/// \note Each worker owns a work queue and steals work from other workers when its own queue is empty.
+	class ComputeThreadPool {
+	public:
+		virtual ~ComputeThreadPool() = default;
+
+	public:
+		/// Gets the number of active worker threads.
+		virtual uint32_t numWorkerThreads() const = 0;
+
+		/// Gets the friendly name of this thread pool.
+		virtual const std::string& name() const = 0;
+
+	public:
+		/// Posts \a work for execution by a worker thread.
+		/// \note Work posted by a worker thread is queued on that worker's own queue.
+		virtual void post(const action& work) = 0;
+
+		/// Starts the thread pool.
+		/// \note All worker threads will be active when this function returns.
+		virtual void start() = 0;
+
+		/// Waits for all posted work to complete and all thread pool threads to exit.
+		virtual void join() = 0;
+	};
+
+	/// Creates a compute thread pool with the specified \a options.
+	/// Optional friendly \a name can be provided to tag logs.
+	std::unique_ptr<ComputeThreadPool> CreateComputeThreadPool(const ComputeThreadPoolOptions& options, const char* name = nullptr);
+
+	/// Creates a compute thread pool that posts all work to \a ioPool instead of owning worker threads.
+	/// \note The returned pool must be joined before \a ioPool is destroyed.
+	std::unique_ptr<ComputeThreadPool> CreateMergedComputeThreadPool(IoThreadPool& ioPool);
+}}
@@ -21,6 +21,7 @@
 **/
 
 #pragma once
+#include "ComputeThreadPool.h"
 #include "IoThreadPool.h"
 #include "bitxorcore/utils/Logging.h"
 #include "bitxorcore/functions.h"
@@ -32,7 +33,7 @@
 
 namespace bitxorcore { namespace thread {
 
-	/// Manages a primary thread pool with dependent service groups and secondary isolated thread pools.
+	/// Manages a primary thread pool with dependent service groups and secondary isolated (io and compute) thread pools.
 	/// \note Services are shutdown in reverse order of registration.
 	class MultiServicePool {
 	public:
@@ -216,6 +217,45 @@ namespace bitxorcore { namespace thread {
 			return pPoolRaw;
 		}
 
+		/// Creates a new compute thread pool with \a name and \a options.
+		/// \note If \a options specifies \c 0 worker threads, a default number of threads will be used.
+		/// \note When isolated pool mode is disabled, the returned pool posts all work to the main pool.
+		std::shared_ptr<thread::ComputeThreadPool> pushComputePool(const std::string& name, const ComputeThreadPoolOptions& options) {
+			class PoolServiceAdapter {
+			public:
+				explicit PoolServiceAdapter(const std::shared_ptr<thread::ComputeThreadPool>& pPool) : m_pPool(pPool)
+				{}
+
+			public:
+				void shutdown() {
+					m_pPool->join();
+					m_pPool.reset();
+				}
+
+			private:
+				std::shared_ptr<thread::ComputeThreadPool> m_pPool;
+			};
+
+			// when isolated pool mode is disabled, use the main pool for everything
+			if (IsolatedPoolMode::Disabled == m_isolatedPoolMode) {
+				std::shared_ptr<thread::ComputeThreadPool> pMergedPool = thread::CreateMergedComputeThreadPool(*m_pPool);
+				registerService(std::make_shared<PoolServiceAdapter>(pMergedPool), name + " (merged compute pool)");
+				return pMergedPool;
+			}
+
+			auto poolOptions = options;
+			if (DefaultPoolConcurrency() == poolOptions.NumWorkerThreads)
+				poolOptions.NumWorkerThreads = std::thread::hardware_concurrency();
+
+			std::shared_ptr<thread::ComputeThreadPool> pPool = thread::CreateComputeThreadPool(poolOptions, name.c_str());
+			pPool->start();
+
+			registerService(std::make_shared<PoolServiceAdapter>(pPool), name + " (compute pool)");
+
+			m_numTotalIsolatedPoolThreads += pPool->numWorkerThreads();
+			return pPool;
+		}
+
 	public:
 		/// Safely shuts down the thread pool and its dependent services.
 		void shutdown() {
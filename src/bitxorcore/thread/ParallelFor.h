@@ -21,19 +21,13 @@
 **/
 
 #pragma once
+#include "ComputeThreadPool.h"
 #include "Future.h"
 #include <boost/asio.hpp>
 
 namespace bitxorcore { namespace thread {
 
-	/// Uses \a ioContext to process \a items in \a numPartitions batches and calls \a callback for each partition.
-	/// Future is returned that is resolved when all items have been processed.
-	template<typename TItems, typename TWorkCallback>
-	thread::future<bool> ParallelForPartition(
-			boost::asio::io_context& ioContext,
-			TItems& items,
-			size_t numPartitions,
-			TWorkCallback callback) {
+	namespace detail {
 		// region ParallelContext
 
 		class ParallelContext {
@@ -81,6 +75,18 @@ namespace bitxorcore { namespace thread {
 		};
 
 		// endregion
+	}
+
+	/// Uses \a ioContext to process \a items in \a numPartitions batches and calls \a callback for each partition.
+	/// Future is returned that is resolved when all items have been processed.
+	template<typename TItems, typename TWorkCallback>
+	thread::future<bool> ParallelForPartition(
+			boost::asio::io_context& ioContext,
+			TItems& items,
+			size_t numPartitions,
+			TWorkCallback callback) {
+		using detail::DecrementGuard;
+		using detail::ParallelContext;
 
 		auto pParallelContext = std::make_shared<ParallelContext>();
 		DecrementGuard mainOperationGuard(*pParallelContext);
@@ -127,4 +133,69 @@ namespace bitxorcore { namespace thread {
 			}
 		});
 	}
+
+	/// Number of chunks per worker thread used by compute pool algorithms in order to balance unevenly expensive items.
+	constexpr size_t Compute_Chunks_Per_Worker = 4;
+
+	/// Uses \a pool to process \a items in dynamically claimed chunks and calls \a callback for each chunk.
+	/// Future is returned that is resolved when all items have been processed.
+	/// \note The number of chunks depends on the number of items and worker threads, so \a callback cannot assume
+	///       one chunk per worker thread.
+	template<typename TItems, typename TWorkCallback>
+	thread::future<bool> ParallelForPartition(ComputeThreadPool& pool, TItems& items, TWorkCallback callback) {
+		using detail::DecrementGuard;
+		using detail::ParallelContext;
+
+		auto pParallelContext = std::make_shared<ParallelContext>();
+		DecrementGuard mainOperationGuard(*pParallelContext);
+
+		auto numTotalItems = items.size();
+		if (0 == numTotalItems)
+			return pParallelContext->future();
+
+		auto numWorkers = std::max<size_t>(1, pool.numWorkerThreads());
+		auto chunkSize = (numTotalItems + numWorkers * Compute_Chunks_Per_Worker - 1) / (numWorkers * Compute_Chunks_Per_Worker);
+		auto numChunks = (numTotalItems + chunkSize - 1) / chunkSize;
+
+		// each posted task repeatedly claims the next unprocessed chunk, so a task that is slowed down (e.g. by expensive items)
+		// claims fewer chunks instead of delaying the completion of all items
+		auto pNextChunkIndex = std::make_shared<std::atomic<size_t>>(0);
+		auto itItemsBegin = items.begin();
+		using DifferenceType = typename std::iterator_traits<decltype(itItemsBegin)>::difference_type;
+		for (auto i = 0u; i < std::min(numWorkers, numChunks); ++i) {
+			// each task captures pParallelContext by value, which keeps that object alive
+			pParallelContext->incrementOutstandingOperations();
+			pool.post([callback, pParallelContext, pNextChunkIndex, itItemsBegin, numTotalItems, numChunks, chunkSize]() {
+				DecrementGuard threadOperationGuard(*pParallelContext);
+				for (;;) {
+					auto chunkIndex = (*pNextChunkIndex)++;
+					if (chunkIndex >= numChunks)
+						break;
+
+					auto startIndex = chunkIndex * chunkSize;
+					auto itBegin = itItemsBegin;
+					std::advance(itBegin, static_cast<DifferenceType>(startIndex));
+					auto itEnd = itBegin;
+					std::advance(itEnd, static_cast<DifferenceType>(std::min(chunkSize, numTotalItems - startIndex)));
+					callback(itBegin, itEnd, startIndex, chunkIndex);
+				}
+			});
+		}
+
+		return pParallelContext->future();
+	}
+
+	/// Uses \a pool to process \a items in dynamically claimed chunks and calls \a callback for each item.
+	/// Future is returned that is resolved when all items have been processed.
+	/// \note When \a callback returns \c false, processing of the remaining items in the same chunk is skipped.
+	template<typename TItems, typename TWorkCallback>
+	thread::future<bool> ParallelFor(ComputeThreadPool& pool, TItems& items, TWorkCallback callback) {
+		return ParallelForPartition(pool, items, [callback](auto itBegin, auto itEnd, auto startIndex, auto) {
+			auto i = 0u;
+			for (auto iter = itBegin; itEnd != iter; ++iter, ++i) {
+				if (!callback(*iter, startIndex + i))
+					break;
+			}
+		});
+	}
 }}
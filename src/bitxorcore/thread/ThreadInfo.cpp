@@ -82,6 +82,21 @@ namespace bitxorcore { namespace thread {
 #else
 		// musl libc (from alpine) defines __GNU_SOURCE__ but it only has pthread_setname_np
 		return std::string();
+#endif
+	}
+
+	bool SetThreadAffinity(uint32_t cpuId) {
+#if defined(__GLIBC__)
+		if (cpuId >= CPU_SETSIZE)
+			return false;
+
+		cpu_set_t cpuSet;
+		CPU_ZERO(&cpuSet);
+		CPU_SET(cpuId, &cpuSet);
+		return 0 == pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet);
+#else
+		// affinity is only a hint, so it is not supported on platforms without pthread_setaffinity_np
+		return false;
 #endif
 	}
 }}
@@ -22,6 +22,7 @@
 
 #pragma once
 #include <string>
+#include <stdint.h>
 
 namespace bitxorcore { namespace thread {
 
@@ -34,4 +35,8 @@ namespace bitxorcore { namespace thread {
 
 	/// Gets a thread name in a platform-dependent way.
 	std::string GetThreadName();
+
+	/// Pins the current thread to the cpu with id \a cpuId in a platform-dependent way.
+	/// Returns \c true if the thread was pinned.
+	bool SetThreadAffinity(uint32_t cpuId);
 }}
@@ -59,6 +59,11 @@ namespace bitxorcore { namespace tree {
 			return m_tree.lookup(key, nodePath);
 		}
 
+		/// Tries to find the values associated with \a keys in the tree and stores proofs of existence or not in \a nodes.
+		std::vector<std::pair<Hash256, bool>> lookupAll(const std::vector<KeyType>& keys, std::vector<TreeNode>& nodes) const {
+			return m_tree.lookupAll(keys, nodes);
+		}
+
 	public:
 		/// Gets a delta based on the same data source as this tree.
 		std::shared_ptr<DeltaType> rebase() {
@@ -253,6 +253,64 @@ namespace bitxorcore { namespace tree {
 			return std::make_pair(Hash256(), false);
 		}
 
+	public:
+		/// Tries to find the values associated with \a keys in the tree and stores proofs of existence or not in \a nodes.
+		/// \note Keys sharing a prefix share the traversal of that prefix, so each visited node is loaded and added to \a nodes once.
+		std::vector<std::pair<Hash256, bool>> lookupAll(const std::vector<KeyType>& keys, std::vector<TreeNode>& nodes) const {
+			std::vector<KeyPathIndexPair> keyPaths;
+			keyPaths.reserve(keys.size());
+			for (auto i = 0u; i < keys.size(); ++i)
+				keyPaths.push_back({ TreeNodePath(TEncoder::EncodeKey(keys[i])), i });
+
+			std::vector<std::pair<Hash256, bool>> results(keys.size(), LookupNotFoundResult());
+			lookupAll(m_rootNode, keyPaths, results, nodes);
+			return results;
+		}
+
+	private:
+		struct KeyPathIndexPair {
+			TreeNodePath Path;
+			size_t Index;
+		};
+
+		void lookupAll(
+				const TreeNode& node,
+				const std::vector<KeyPathIndexPair>& keyPaths,
+				std::vector<std::pair<Hash256, bool>>& results,
+				std::vector<TreeNode>& nodes) const {
+			// if the node is empty or there are no keys, there is nothing to do
+			if (node.empty() || keyPaths.empty())
+				return;
+
+			nodes.push_back(node.copy());
+			if (!node.isBranch()) {
+				// if the node is a leaf, it can only match the keys with a fully matching path
+				for (const auto& keyPath : keyPaths) {
+					if (FindFirstDifferenceIndex(node.path(), keyPath.Path) == keyPath.Path.size())
+						results[keyPath.Index] = std::make_pair(node.asLeafNode().value(), true);
+				}
+
+				return;
+			}
+
+			// group the keys by the branch link connecting with them
+			const auto& branchNode = node.asBranchNode();
+			std::array<std::vector<KeyPathIndexPair>, BranchTreeNode::Max_Links> linkedKeyPaths;
+			for (const auto& keyPath : keyPaths) {
+				auto differenceIndex = FindFirstDifferenceIndex(node.path(), keyPath.Path);
+				auto nodeLinkIndex = keyPath.Path.nibbleAt(differenceIndex);
+				linkedKeyPaths[nodeLinkIndex].push_back({ keyPath.Path.subpath(differenceIndex + 1), keyPath.Index });
+			}
+
+			// load each linked node at most once and continue the lookup of all keys connecting with it
+			for (auto i = 0u; i < BranchTreeNode::Max_Links; ++i) {
+				if (linkedKeyPaths[i].empty())
+					continue;
+
+				lookupAll(getLinkedNode(branchNode, i), linkedKeyPaths[i], results, nodes);
+			}
+		}
+
 		// endregion
 
 		// region tryLoad + setRoot + clear
@@ -0,0 +1,166 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NonCopyable.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace bitxorcore { namespace utils {
+
+	namespace detail {
+		/// Gets the reader slot index assigned to the calling thread.
+		inline size_t GetEpochReaderSlotIndex() {
+			static std::atomic<size_t> nextIndex(0);
+			thread_local size_t index = nextIndex++;
+			return index;
+		}
+	}
+
+	/// Immutable value snapshot that can be read without acquiring a shared lock (epoch / rcu style).
+	/// \note
+	/// - readers announce themselves in one of many cache line aligned slots (chosen per thread), so concurrent readers
+	///   on different threads do not contend on the same counter
+	/// - publishing a new value swaps the snapshot pointer and then waits until all readers that could still observe
+	///   the previous snapshot have released it, so readers must not hold a reader guard across a publish on the same thread
+	/// - publishers are serialized
+	template<typename TValue>
+	class EpochSnapshot {
+	private:
+		static constexpr size_t Num_Reader_Slots = 64;
+		static constexpr uint32_t Num_Yield_Attempts = 100;
+
+		struct alignas(64) ReaderSlot {
+			std::atomic<uint64_t> Counters[2];
+		};
+
+	public:
+		// region ReaderGuard
+
+		/// RAII reader guard that keeps a snapshot alive.
+		class ReaderGuard : public MoveOnly {
+		public:
+			/// Creates a guard around \a value and reader \a counter.
+			ReaderGuard(const TValue& value, std::atomic<uint64_t>& counter)
+					: m_pValue(&value)
+					, m_pCounter(&counter)
+			{}
+
+			/// Move constructor.
+			ReaderGuard(ReaderGuard&& rhs) : m_pValue(rhs.m_pValue), m_pCounter(rhs.m_pCounter) {
+				rhs.m_pCounter = nullptr;
+			}
+
+			/// Releases the snapshot.
+			~ReaderGuard() {
+				if (m_pCounter)
+					m_pCounter->fetch_sub(1, std::memory_order_release);
+			}
+
+		public:
+			/// Gets a const reference to the snapshot value.
+			const TValue& operator*() const {
+				return *m_pValue;
+			}
+
+			/// Gets a const pointer to the snapshot value.
+			const TValue* operator->() const {
+				return m_pValue;
+			}
+
+		private:
+			const TValue* m_pValue;
+			std::atomic<uint64_t>* m_pCounter;
+		};
+
+		// endregion
+
+	public:
+		/// Creates a snapshot around \a value.
+		explicit EpochSnapshot(TValue&& value = TValue())
+				: m_pCurrent(new TValue(std::move(value)))
+				, m_epoch(0) {
+			for (auto& slot : m_slots) {
+				slot.Counters[0] = 0;
+				slot.Counters[1] = 0;
+			}
+		}
+
+		/// Destroys the snapshot.
+		~EpochSnapshot() {
+			delete m_pCurrent.load();
+		}
+
+	public:
+		/// Acquires a reader guard around the current snapshot.
+		ReaderGuard read() const {
+			auto& slot = m_slots[detail::GetEpochReaderSlotIndex() % Num_Reader_Slots];
+			auto& counter = slot.Counters[m_epoch.load() & 1];
+
+			// the counter increment is sequentially consistent, so either a publisher sees this reader when scanning
+			// or this reader sees the pointer swapped in by that publisher
+			counter.fetch_add(1);
+			return ReaderGuard(*m_pCurrent.load(), counter);
+		}
+
+		/// Gets a copy of the current snapshot value.
+		TValue get() const {
+			return *read();
+		}
+
+		/// Publishes \a value as the new snapshot and waits for all readers of the previous snapshot to complete.
+		void publish(TValue&& value) {
+			std::unique_ptr<TValue> pNewValue(new TValue(std::move(value)));
+
+			std::lock_guard<std::mutex> guard(m_publishMutex);
+			std::unique_ptr<TValue> pOldValue(m_pCurrent.exchange(pNewValue.release()));
+
+			// any reader of the old snapshot incremented one of the two counters before the exchange above, so drain both;
+			// flip the epoch before draining each counter so that new readers use the other one and cannot starve the publisher
+			for (auto i = 0u; i < 2; ++i) {
+				auto drainIndex = m_epoch.fetch_add(1) & 1;
+				for (const auto& slot : m_slots)
+					WaitForZero(slot.Counters[drainIndex]);
+			}
+		}
+
+	private:
+		static void WaitForZero(const std::atomic<uint64_t>& counter) {
+			// yield first and then back off to sleeping so that preempted readers get a chance to complete
+			for (auto numAttempts = 0u; 0 != counter.load(); ++numAttempts) {
+				if (numAttempts < Num_Yield_Attempts)
+					std::this_thread::yield();
+				else
+					std::this_thread::sleep_for(std::chrono::microseconds(100));
+			}
+		}
+
+	private:
+		std::atomic<TValue*> m_pCurrent;
+		std::atomic<uint64_t> m_epoch;
+		mutable ReaderSlot m_slots[Num_Reader_Slots];
+		std::mutex m_publishMutex;
+	};
+}}
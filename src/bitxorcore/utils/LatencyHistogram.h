@@ -0,0 +1,95 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace bitxorcore { namespace utils {
+
+	/// Point in time view of a latency histogram.
+	struct LatencyHistogramSnapshot {
+		/// Number of samples in each bucket (not cumulative).
+		std::vector<uint64_t> BucketCounts;
+
+		/// Total number of samples.
+		uint64_t Count = 0;
+
+		/// Sum of all samples (in microseconds).
+		uint64_t SumMicros = 0;
+	};
+
+	/// Lock free histogram of latencies with fixed exponential buckets.
+	/// \note Bucket i contains samples with latencies no greater than 4^i microseconds; the last bucket is unbounded.
+	class LatencyHistogram {
+	public:
+		/// Number of bounded buckets.
+		static constexpr size_t Num_Bounded_Buckets = 13;
+
+		/// Total number of buckets.
+		static constexpr size_t Num_Buckets = Num_Bounded_Buckets + 1;
+
+	public:
+		/// Creates an empty histogram.
+		LatencyHistogram() : m_sumMicros(0) {
+			for (auto& count : m_bucketCounts)
+				count = 0;
+		}
+
+	public:
+		/// Gets the (inclusive) upper bound of the bucket at \a index (in microseconds).
+		static constexpr uint64_t BucketUpperBound(size_t index) {
+			return 1ull << (2 * index);
+		}
+
+	public:
+		/// Records a sample with latency \a micros.
+		void record(uint64_t micros) {
+			auto index = 0u;
+			while (index < Num_Bounded_Buckets && micros > BucketUpperBound(index))
+				++index;
+
+			m_bucketCounts[index].fetch_add(1, std::memory_order_relaxed);
+			m_sumMicros.fetch_add(micros, std::memory_order_relaxed);
+		}
+
+		/// Gets a snapshot of the histogram.
+		/// \note Concurrent records might only be partially reflected.
+		LatencyHistogramSnapshot snapshot() const {
+			LatencyHistogramSnapshot snapshot;
+			for (const auto& count : m_bucketCounts) {
+				snapshot.BucketCounts.push_back(count.load(std::memory_order_relaxed));
+				snapshot.Count += snapshot.BucketCounts.back();
+			}
+
+			snapshot.SumMicros = m_sumMicros.load(std::memory_order_relaxed);
+			return snapshot;
+		}
+
+	private:
+		std::array<std::atomic<uint64_t>, Num_Buckets> m_bucketCounts;
+		std::atomic<uint64_t> m_sumMicros;
+	};
+}}
@@ -42,6 +42,12 @@ namespace bitxorcore { namespace utils {
 			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsedDuration).count());
 		}
 
+		/// Gets the number of elapsed microseconds since this logger was created.
+		uint64_t micros() const {
+			auto elapsedDuration = Clock::now() - m_start;
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsedDuration).count());
+		}
+
 	private:
 		Clock::time_point m_start;
 	};
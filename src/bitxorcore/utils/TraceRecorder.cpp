@@ -0,0 +1,314 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "TraceRecorder.h"
+#include "HexFormatter.h"
+#include "SpinLock.h"
+#include "bitxorcore/exceptions.h"
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <ostream>
+
+namespace bitxorcore { namespace utils {
+
+	namespace {
+		class InstalledTraceRecorderHolder {
+		public:
+			InstalledTraceRecorderHolder() : m_pRawRecorder(nullptr)
+			{}
+
+		public:
+			std::shared_ptr<TraceRecorder> get() const {
+				// only acquire the lock when tracing is enabled
+				if (!m_pRawRecorder.load(std::memory_order_acquire))
+					return nullptr;
+
+				std::lock_guard<SpinLock> guard(m_lock);
+				return m_pRecorder;
+			}
+
+			void set(const std::shared_ptr<TraceRecorder>& pRecorder) {
+				auto pPreviousRecorder = pRecorder;
+				{
+					std::lock_guard<SpinLock> guard(m_lock);
+					std::swap(m_pRecorder, pPreviousRecorder);
+					m_pRawRecorder.store(m_pRecorder.get(), std::memory_order_release);
+				}
+
+				// previous recorder is released outside of the lock
+			}
+
+			void reset(const TraceRecorder& recorder) {
+				std::shared_ptr<TraceRecorder> pPreviousRecorder;
+				{
+					std::lock_guard<SpinLock> guard(m_lock);
+					if (&recorder != m_pRecorder.get())
+						return;
+
+					std::swap(m_pRecorder, pPreviousRecorder);
+					m_pRawRecorder.store(nullptr, std::memory_order_release);
+				}
+
+				// previous recorder is released outside of the lock
+			}
+
+		private:
+			std::atomic<TraceRecorder*> m_pRawRecorder;
+			std::shared_ptr<TraceRecorder> m_pRecorder;
+			mutable SpinLock m_lock;
+		};
+
+		InstalledTraceRecorderHolder& InstalledTraceRecorder() {
+			static InstalledTraceRecorderHolder holder;
+			return holder;
+		}
+
+		uint64_t NextRecorderId() {
+			static std::atomic<uint64_t> nextId(1);
+			return nextId++;
+		}
+
+		bool Overlaps(const TraceEvent& event, uint64_t startMicros, uint64_t endMicros) {
+			return event.StartMicros <= endMicros && startMicros <= event.StartMicros + event.DurationMicros;
+		}
+	}
+
+	// region ThreadBuffer
+
+	/// Single producer ring buffer of events recorded by a single thread.
+	/// \note Each slot is guarded by a sequence number so that readers can detect (and skip) slots that are being overwritten.
+	class TraceRecorder::ThreadBuffer {
+	private:
+		struct Slot {
+			std::atomic<uint64_t> Sequence = 0;
+			std::atomic<const char*> Category = nullptr;
+			std::atomic<const char*> Name = nullptr;
+			std::atomic<uint64_t> StartMicros = 0;
+			std::atomic<uint64_t> DurationMicros = 0;
+			std::atomic<uint64_t> Height = 0;
+			std::atomic<uint32_t> Hash = 0;
+		};
+
+	public:
+		ThreadBuffer(uint32_t id, const std::string& name, size_t capacity)
+				: m_thread{ id, name }
+				, m_slots(capacity)
+				, m_numEvents(0)
+		{}
+
+	public:
+		const TraceThread& thread() const {
+			return m_thread;
+		}
+
+	public:
+		void push(const TraceEvent& event) {
+			// only the owning thread writes, so the event index can be read without synchronization
+			auto index = m_numEvents.load(std::memory_order_relaxed);
+			auto& slot = m_slots[index % m_slots.size()];
+
+			slot.Sequence.store(2 * index + 1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+
+			slot.Category.store(event.Category, std::memory_order_relaxed);
+			slot.Name.store(event.Name, std::memory_order_relaxed);
+			slot.StartMicros.store(event.StartMicros, std::memory_order_relaxed);
+			slot.DurationMicros.store(event.DurationMicros, std::memory_order_relaxed);
+			slot.Height.store(event.Height.unwrap(), std::memory_order_relaxed);
+			slot.Hash.store(event.Hash.unwrap(), std::memory_order_relaxed);
+
+			slot.Sequence.store(2 * index + 2, std::memory_order_release);
+			m_numEvents.store(index + 1, std::memory_order_release);
+		}
+
+		void collect(std::vector<TraceEvent>& events, uint64_t startMicros, uint64_t endMicros) const {
+			auto numEvents = m_numEvents.load(std::memory_order_acquire);
+			auto firstIndex = numEvents > m_slots.size() ? numEvents - m_slots.size() : 0;
+			// collect most recent events first because enclosing spans are recorded after the spans they contain
+			for (auto index = numEvents; index-- > firstIndex;) {
+				const auto& slot = m_slots[index % m_slots.size()];
+
+				auto sequence = slot.Sequence.load(std::memory_order_acquire);
+				TraceEvent event{
+					slot.Category.load(std::memory_order_relaxed),
+					slot.Name.load(std::memory_order_relaxed),
+					slot.StartMicros.load(std::memory_order_relaxed),
+					slot.DurationMicros.load(std::memory_order_relaxed),
+					bitxorcore::Height(slot.Height.load(std::memory_order_relaxed)),
+					ShortHash(slot.Hash.load(std::memory_order_relaxed)),
+					m_thread.Id
+				};
+				std::atomic_thread_fence(std::memory_order_acquire);
+
+				// skip the event if it was overwritten while being read
+				if (2 * index + 2 != sequence || sequence != slot.Sequence.load(std::memory_order_relaxed))
+					continue;
+
+				if (Overlaps(event, startMicros, endMicros))
+					events.push_back(event);
+			}
+		}
+
+	private:
+		TraceThread m_thread;
+		std::vector<Slot> m_slots;
+		std::atomic<uint64_t> m_numEvents;
+	};
+
+	// endregion
+
+	// region TraceRecorder
+
+	TraceRecorder::TraceRecorder(size_t maxEventsPerThread, const supplier<std::string>& threadNameSupplier)
+			: m_id(NextRecorderId())
+			, m_maxEventsPerThread(maxEventsPerThread)
+			, m_threadNameSupplier(threadNameSupplier)
+			, m_start(Clock::now()) {
+		if (0 == m_maxEventsPerThread)
+			BITXORCORE_THROW_INVALID_ARGUMENT("trace recorder must retain at least one event per thread");
+	}
+
+	TraceRecorder::~TraceRecorder() = default;
+
+	uint64_t TraceRecorder::nowMicros() const {
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - m_start).count());
+	}
+
+	void TraceRecorder::record(const TraceEvent& event) {
+		threadBuffer().push(event);
+	}
+
+	TraceSnapshot TraceRecorder::snapshot() const {
+		return snapshot(0, std::numeric_limits<uint64_t>::max());
+	}
+
+	TraceSnapshot TraceRecorder::snapshot(uint64_t startMicros, uint64_t endMicros) const {
+		TraceSnapshot snapshot;
+		{
+			std::lock_guard<std::mutex> guard(m_mutex);
+			for (const auto& pThreadBuffer : m_threadBuffers) {
+				snapshot.Threads.push_back(pThreadBuffer->thread());
+				pThreadBuffer->collect(snapshot.Events, startMicros, endMicros);
+			}
+		}
+
+		// order enclosing spans before the spans they contain when both start at the same time
+		// (when durations are equal too, stable sorting preserves the most recent first collection order)
+		std::stable_sort(snapshot.Events.begin(), snapshot.Events.end(), [](const auto& lhs, const auto& rhs) {
+			return lhs.StartMicros != rhs.StartMicros ? lhs.StartMicros < rhs.StartMicros : lhs.DurationMicros > rhs.DurationMicros;
+		});
+		return snapshot;
+	}
+
+	TraceRecorder::ThreadBuffer& TraceRecorder::threadBuffer() {
+		// cache the buffer of the calling thread so that the lock is only acquired by the first event recorded by each thread
+		// (recorder ids are never reused, so a cached buffer can never belong to a different recorder)
+		thread_local uint64_t t_recorderId = 0;
+		thread_local ThreadBuffer* t_pThreadBuffer = nullptr;
+		if (m_id != t_recorderId) {
+			auto threadName = m_threadNameSupplier();
+
+			std::lock_guard<std::mutex> guard(m_mutex);
+			auto threadId = static_cast<uint32_t>(m_threadBuffers.size() + 1);
+			m_threadBuffers.push_back(std::make_unique<ThreadBuffer>(threadId, threadName, m_maxEventsPerThread));
+
+			t_recorderId = m_id;
+			t_pThreadBuffer = m_threadBuffers.back().get();
+		}
+
+		return *t_pThreadBuffer;
+	}
+
+	// endregion
+
+	void InstallTraceRecorder(const std::shared_ptr<TraceRecorder>& pRecorder) {
+		InstalledTraceRecorder().set(pRecorder);
+	}
+
+	void UninstallTraceRecorder(const TraceRecorder& recorder) {
+		InstalledTraceRecorder().reset(recorder);
+	}
+
+	std::shared_ptr<TraceRecorder> GetInstalledTraceRecorder() {
+		return InstalledTraceRecorder().get();
+	}
+
+	// region WriteChromeTrace
+
+	namespace {
+		void WriteJsonString(std::ostream& output, const std::string& str) {
+			output << '"';
+			for (auto ch : str) {
+				if ('"' == ch || '\\' == ch)
+					output << '\\' << ch;
+				else if (static_cast<unsigned char>(ch) < 0x20)
+					output << "\\u00" << HexFormat(static_cast<uint8_t>(ch));
+				else
+					output << ch;
+			}
+
+			output << '"';
+		}
+	}
+
+	void WriteChromeTrace(std::ostream& output, const TraceSnapshot& snapshot) {
+		// all timestamps are in microseconds, which is the default unit of the format
+		output << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+		auto isFirst = true;
+		auto writeSeparator = [&output, &isFirst]() {
+			output << (isFirst ? "\n" : ",\n");
+			isFirst = false;
+		};
+
+		for (const auto& thread : snapshot.Threads) {
+			writeSeparator();
+			output << "{\"ph\":\"M\",\"pid\":1,\"tid\":" << thread.Id << ",\"name\":\"thread_name\",\"args\":{\"name\":";
+			WriteJsonString(output, thread.Name);
+			output << "}}";
+		}
+
+		for (const auto& event : snapshot.Events) {
+			writeSeparator();
+			output << "{\"ph\":\"X\",\"pid\":1,\"tid\":" << event.ThreadId << ",\"cat\":";
+			WriteJsonString(output, event.Category);
+			output << ",\"name\":";
+			WriteJsonString(output, event.Name);
+			output << ",\"ts\":" << event.StartMicros << ",\"dur\":" << event.DurationMicros;
+
+			if (Height() != event.Height) {
+				// format the short hash in memory order so that it matches the prefix of the full block hash
+				const auto* pHashData = reinterpret_cast<const uint8_t*>(&event.Hash);
+				output
+						<< ",\"args\":{\"height\":" << event.Height
+						<< ",\"hash\":\"" << HexFormat(pHashData, pHashData + sizeof(ShortHash)) << "\"}";
+			}
+
+			output << "}";
+		}
+
+		output << "\n]}\n";
+	}
+
+	// endregion
+}}
@@ -0,0 +1,208 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "ShortHash.h"
+#include "bitxorcore/functions.h"
+#include "bitxorcore/types.h"
+#include <chrono>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace bitxorcore { namespace utils {
+
+	/// Completed trace span.
+	struct TraceEvent {
+		/// Span category.
+		/// \note This must point to a string with static storage duration.
+		const char* Category;
+
+		/// Span name.
+		/// \note This must point to a string with static storage duration.
+		const char* Name;
+
+		/// Start time (in microseconds) relative to the creation of the recorder.
+		uint64_t StartMicros;
+
+		/// Duration (in microseconds).
+		uint64_t DurationMicros;
+
+		/// Height of the associated block (zero if the span is not associated with a block).
+		bitxorcore::Height Height;
+
+		/// Short hash of the associated block (zero if the span is not associated with a block).
+		ShortHash Hash;
+
+		/// Id of the recording thread.
+		uint32_t ThreadId;
+	};
+
+	/// Thread that recorded trace events.
+	struct TraceThread {
+		/// Thread id.
+		uint32_t Id;
+
+		/// Thread name.
+		std::string Name;
+	};
+
+	/// Trace events recorded by all threads.
+	struct TraceSnapshot {
+		/// Recording threads.
+		std::vector<TraceThread> Threads;
+
+		/// Recorded events ordered by start time.
+		std::vector<TraceEvent> Events;
+	};
+
+	/// Records trace spans into per thread ring buffers.
+	/// \note Each thread only writes to its own buffer without locking, so recording never blocks.
+	///       Once a buffer is full, the oldest events of that thread are overwritten.
+	class TraceRecorder {
+	private:
+		using Clock = std::chrono::steady_clock;
+		class ThreadBuffer;
+
+	public:
+		/// Creates a recorder that keeps the most recent \a maxEventsPerThread events of each thread
+		/// and names recording threads with \a threadNameSupplier.
+		TraceRecorder(size_t maxEventsPerThread, const supplier<std::string>& threadNameSupplier);
+
+		/// Destroys the recorder.
+		~TraceRecorder();
+
+	public:
+		/// Gets the number of microseconds elapsed since the recorder was created.
+		uint64_t nowMicros() const;
+
+		/// Records \a event in the buffer of the calling thread.
+		/// \note The thread id of \a event is ignored.
+		void record(const TraceEvent& event);
+
+		/// Gets all retained events.
+		TraceSnapshot snapshot() const;
+
+		/// Gets all retained events that overlap the interval [\a startMicros, \a endMicros].
+		TraceSnapshot snapshot(uint64_t startMicros, uint64_t endMicros) const;
+
+	private:
+		ThreadBuffer& threadBuffer();
+
+	private:
+		uint64_t m_id;
+		size_t m_maxEventsPerThread;
+		supplier<std::string> m_threadNameSupplier;
+		Clock::time_point m_start;
+
+		mutable std::mutex m_mutex;
+		std::vector<std::unique_ptr<ThreadBuffer>> m_threadBuffers;
+	};
+
+	/// Installs \a pRecorder as the recorder used by all trace spans.
+	/// \note The installed recorder is kept alive until it is uninstalled and all spans recording into it are destroyed.
+	void InstallTraceRecorder(const std::shared_ptr<TraceRecorder>& pRecorder);
+
+	/// Uninstalls \a recorder if it is installed.
+	void UninstallTraceRecorder(const TraceRecorder& recorder);
+
+	/// Gets the installed trace recorder or \c nullptr if tracing is disabled.
+	std::shared_ptr<TraceRecorder> GetInstalledTraceRecorder();
+
+	/// RAII class that records its lifetime as a span with the installed trace recorder.
+	/// \note When tracing is disabled, a span only costs a single atomic load.
+	class TraceSpan {
+	public:
+		/// Creates a span with \a category and \a name.
+		TraceSpan(const char* category, const char* name) : TraceSpan(category, name, Height(), ShortHash())
+		{}
+
+		/// Creates a span with \a category and \a name for the block with \a height and short \a hash.
+		TraceSpan(const char* category, const char* name, Height height, ShortHash hash)
+				: m_pRecorder(GetInstalledTraceRecorder())
+				, m_event{ category, name, m_pRecorder ? m_pRecorder->nowMicros() : 0, 0, height, hash, 0 }
+		{}
+
+		/// Destroys the span and records it.
+		~TraceSpan() {
+			if (!m_pRecorder)
+				return;
+
+			m_event.DurationMicros = m_pRecorder->nowMicros() - m_event.StartMicros;
+			m_pRecorder->record(m_event);
+		}
+
+	public:
+		/// Returns \c true if the span will be recorded.
+		bool isRecording() const {
+			return !!m_pRecorder;
+		}
+
+		/// Associates the span with the block with \a height and short \a hash.
+		void setBlock(Height height, ShortHash hash) {
+			m_event.Height = height;
+			m_event.Hash = hash;
+		}
+
+	public:
+		TraceSpan(const TraceSpan&) = delete;
+		TraceSpan& operator=(const TraceSpan&) = delete;
+
+	private:
+		std::shared_ptr<TraceRecorder> m_pRecorder;
+		TraceEvent m_event;
+	};
+
+	/// RAII class that records an operation and its consecutive steps as trace spans with the installed trace recorder.
+	/// \note Each step ends when the next step starts or when the operation ends.
+	class TraceSteps {
+	public:
+		/// Creates an operation with \a category and \a name for the block with \a height and short \a hash.
+		TraceSteps(const char* category, const char* name, Height height, ShortHash hash)
+				: m_operationSpan(category, name, height, hash)
+				, m_category(category)
+		{}
+
+	public:
+		/// Ends the current step and starts a new step with \a name.
+		void step(const char* name) {
+			if (!m_operationSpan.isRecording())
+				return;
+
+			m_stepSpan.reset();
+			m_stepSpan.emplace(m_category, name);
+		}
+
+	private:
+		// step span must be destroyed (and recorded) before operation span
+		TraceSpan m_operationSpan;
+		const char* m_category;
+		std::optional<TraceSpan> m_stepSpan;
+	};
+
+	/// Writes \a snapshot to \a output in chrome trace event (json) format.
+	/// \note This format can be loaded by chrome://tracing and perfetto.
+	void WriteChromeTrace(std::ostream& output, const TraceSnapshot& snapshot);
+}}
@@ -23,11 +23,67 @@
 #pragma once
 #include "AggregateValidationResult.h"
 #include "ValidatorTypes.h"
+#include "bitxorcore/model/NotificationDispatchTable.h"
 #include "bitxorcore/utils/NamedObject.h"
 #include <vector>
 
 namespace bitxorcore { namespace validators {
 
+	/// Aggregate notification validator that forwards each notification to the validators selected by a dispatch lookup.
+	template<typename TNotification, typename TDispatchLookup, typename... TArgs>
+	class DefaultAggregateNotificationValidator : public AggregateNotificationValidatorT<TNotification, TArgs...> {
+	private:
+		using NotificationValidatorPointer = std::unique_ptr<const NotificationValidatorT<TNotification, TArgs...>>;
+		using NotificationValidatorPointerVector = std::vector<NotificationValidatorPointer>;
+
+	public:
+		/// Creates an aggregate around \a validators that uses \a dispatchLookup to select the validators of each notification
+		/// and ignores suppressed failures according to \a isSuppressedFailure.
+		DefaultAggregateNotificationValidator(
+				NotificationValidatorPointerVector&& validators,
+				TDispatchLookup&& dispatchLookup,
+				const ValidationResultPredicate& isSuppressedFailure)
+				: m_validators(std::move(validators))
+				, m_dispatchLookup(std::move(dispatchLookup))
+				, m_isSuppressedFailure(isSuppressedFailure)
+				, m_name(utils::ReduceNames(utils::ExtractNames(m_validators)))
+		{}
+
+	public:
+		const std::string& name() const override {
+			return m_name;
+		}
+
+		std::vector<std::string> names() const override {
+			return utils::ExtractNames(m_validators);
+		}
+
+		ValidationResult validate(const TNotification& notification, TArgs&&... args) const override {
+			auto aggregateResult = ValidationResult::Success;
+			for (const auto& pValidator : m_dispatchLookup.find(notification, m_validators)) {
+				auto result = pValidator->validate(notification, std::forward<TArgs>(args)...);
+
+				// ignore suppressed failures
+				if (m_isSuppressedFailure(result))
+					continue;
+
+				// exit on other failures
+				if (IsValidationResultFailure(result))
+					return result;
+
+				AggregateValidationResult(aggregateResult, result);
+			}
+
+			return aggregateResult;
+		}
+
+	private:
+		NotificationValidatorPointerVector m_validators;
+		TDispatchLookup m_dispatchLookup;
+		ValidationResultPredicate m_isSuppressedFailure;
+		std::string m_name;
+	};
+
 	/// Strongly typed aggregate notification validator builder.
 	template<typename TNotification, typename... TArgs>
 	class AggregateValidatorBuilder {
@@ -35,6 +91,7 @@ namespace bitxorcore { namespace validators {
 		using NotificationValidatorPointer = std::unique_ptr<const NotificationValidatorT<TNotification, TArgs...>>;
 		using NotificationValidatorPointerVector = std::vector<NotificationValidatorPointer>;
 		using AggregateValidatorPointer = std::unique_ptr<const AggregateNotificationValidatorT<TNotification, TArgs...>>;
+		using AggregateValidator = DefaultAggregateNotificationValidator<TNotification, model::UniversalDispatchLookup, TArgs...>;
 
 	public:
 		/// Adds \a pValidator to the builder and allows chaining.
@@ -45,54 +102,9 @@ namespace bitxorcore { namespace validators {
 
 		/// Builds a strongly typed notification validator that ignores suppressed failures according to \a isSuppressedFailure.
 		AggregateValidatorPointer build(const ValidationResultPredicate& isSuppressedFailure) {
-			return std::make_unique<DefaultAggregateNotificationValidator>(std::move(m_validators), isSuppressedFailure);
+			return std::make_unique<AggregateValidator>(std::move(m_validators), model::UniversalDispatchLookup(), isSuppressedFailure);
 		}
 
-	private:
-		class DefaultAggregateNotificationValidator : public AggregateNotificationValidatorT<TNotification, TArgs...> {
-		public:
-			DefaultAggregateNotificationValidator(
-					NotificationValidatorPointerVector&& validators,
-					const ValidationResultPredicate& isSuppressedFailure)
-					: m_validators(std::move(validators))
-					, m_isSuppressedFailure(isSuppressedFailure)
-					, m_name(utils::ReduceNames(utils::ExtractNames(m_validators)))
-			{}
-
-		public:
-			const std::string& name() const override {
-				return m_name;
-			}
-
-			std::vector<std::string> names() const override {
-				return utils::ExtractNames(m_validators);
-			}
-
-			ValidationResult validate(const TNotification& notification, TArgs&&... args) const override {
-				auto aggregateResult = ValidationResult::Success;
-				for (const auto& pValidator : m_validators) {
-					auto result = pValidator->validate(notification, std::forward<TArgs>(args)...);
-
-					// ignore suppressed failures
-					if (m_isSuppressedFailure(result))
-						continue;
-
-					// exit on other failures
-					if (IsValidationResultFailure(result))
-						return result;
-
-					AggregateValidationResult(aggregateResult, result);
-				}
-
-				return aggregateResult;
-			}
-
-		private:
-			NotificationValidatorPointerVector m_validators;
-			ValidationResultPredicate m_isSuppressedFailure;
-			std::string m_name;
-		};
-
 	private:
 		NotificationValidatorPointerVector m_validators;
 	};
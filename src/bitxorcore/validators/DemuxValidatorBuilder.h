@@ -22,33 +22,36 @@
 
 #pragma once
 #include "AggregateValidatorBuilder.h"
-#include "ValidatorTypes.h"
-#include <functional>
-#include <vector>
 
 namespace bitxorcore { namespace validators {
 
 	/// Demultiplexing validator builder.
+	/// \note Validators are grouped by notification type when the validator is built, so each notification is only forwarded
+	///       to validators registered for its type and validators registered for all types.
 	template<typename... TArgs>
 	class DemuxValidatorBuilderT {
 	private:
 		template<typename TNotification>
 		using NotificationValidatorPointerT = std::unique_ptr<const NotificationValidatorT<TNotification, TArgs...>>;
-		using NotificationValidatorPredicate = predicate<const model::Notification&>;
+		using NotificationValidator = NotificationValidatorT<model::Notification, TArgs...>;
+		using NotificationValidatorPointer = NotificationValidatorPointerT<model::Notification>;
+		using NotificationValidatorPointerVector = std::vector<NotificationValidatorPointer>;
 		using AggregateValidatorPointer = std::unique_ptr<const AggregateNotificationValidatorT<model::Notification, TArgs...>>;
+		using DispatchTable = model::NotificationDispatchTable<NotificationValidator>;
+		using DispatchLookup = model::NotificationDispatchTableLookup<NotificationValidator>;
+		using AggregateValidator = DefaultAggregateNotificationValidator<model::Notification, DispatchLookup, TArgs...>;
 
 	public:
 		/// Adds a validator (\a pValidator) to the builder that is invoked only when matching notifications are processed.
 		template<typename TNotification>
 		DemuxValidatorBuilderT& add(NotificationValidatorPointerT<TNotification>&& pValidator) {
 			if constexpr (!std::is_same_v<model::Notification, TNotification>) {
-				auto predicate = [type = TNotification::Notification_Type](const auto& notification) {
-					return model::AreEqualExcludingChannel(type, notification.Type);
-				};
-				m_builder.add(std::make_unique<ConditionalValidator<TNotification>>(std::move(pValidator), predicate));
+				m_validators.push_back(std::make_unique<TypedValidator<TNotification>>(std::move(pValidator)));
+				m_dispatchTable.add(TNotification::Notification_Type, m_validators.back().get());
 				return *this;
 			} else {
-				m_builder.add(std::move(pValidator));
+				m_validators.push_back(std::move(pValidator));
+				m_dispatchTable.addUniversal(m_validators.back().get());
 				return *this;
 			}
 		}
@@ -60,18 +63,17 @@ namespace bitxorcore { namespace validators {
 
 		/// Builds a demultiplexing validator that ignores suppressed failures according to \a isSuppressedFailure.
 		AggregateValidatorPointer build(const ValidationResultPredicate& isSuppressedFailure) {
-			return m_builder.build(isSuppressedFailure);
+			return std::make_unique<AggregateValidator>(
+					std::move(m_validators),
+					DispatchLookup(std::move(m_dispatchTable)),
+					isSuppressedFailure);
 		}
 
 	private:
 		template<typename TNotification>
-		class ConditionalValidator : public NotificationValidatorT<model::Notification, TArgs...> {
+		class TypedValidator : public NotificationValidator {
 		public:
-			ConditionalValidator(
-					NotificationValidatorPointerT<TNotification>&& pValidator,
-					const NotificationValidatorPredicate& predicate)
-					: m_pValidator(std::move(pValidator))
-					, m_predicate(predicate)
+			explicit TypedValidator(NotificationValidatorPointerT<TNotification>&& pValidator) : m_pValidator(std::move(pValidator))
 			{}
 
 		public:
@@ -80,18 +82,16 @@ namespace bitxorcore { namespace validators {
 			}
 
 			ValidationResult validate(const model::Notification& notification, TArgs&&... args) const override {
-				if (!m_predicate(notification))
-					return ValidationResult::Success;
-
+				// dispatch table guarantees notification type matches
 				return m_pValidator->validate(static_cast<const TNotification&>(notification), std::forward<TArgs>(args)...);
 			}
 
 		private:
 			NotificationValidatorPointerT<TNotification> m_pValidator;
-			NotificationValidatorPredicate m_predicate;
 		};
 
 	private:
-		AggregateValidatorBuilder<model::Notification, TArgs...> m_builder;
+		NotificationValidatorPointerVector m_validators;
+		DispatchTable m_dispatchTable;
 	};
 }}
@@ -23,10 +23,9 @@
 #include "ParallelValidationPolicy.h"
 #include "AggregateValidationResult.h"
 #include "bitxorcore/thread/FutureUtils.h"
-#include "bitxorcore/thread/IoThreadPool.h"
+#include "bitxorcore/thread/ComputeThreadPool.h"
 #include "bitxorcore/thread/ParallelFor.h"
 #include "bitxorcore/utils/Logging.h"
-#include <boost/asio/io_context.hpp>
 #include <algorithm>
 
 namespace bitxorcore { namespace validators {
@@ -125,7 +124,9 @@ namespace bitxorcore { namespace validators {
 
 		class DefaultParallelValidationPolicy final : public ParallelValidationPolicy {
 		public:
-			DefaultParallelValidationPolicy(thread::IoThreadPool& pool, const std::shared_ptr<const StatelessEntityValidator>& pValidator)
+			DefaultParallelValidationPolicy(
+					thread::ComputeThreadPool& pool,
+					const std::shared_ptr<const StatelessEntityValidator>& pValidator)
 					: m_pool(pool)
 					, m_pValidator(pValidator) {
 				BITXORCORE_LOG(trace) << "DefaultParallelValidationPolicy created with " << m_pool.numWorkerThreads() << " worker threads";
@@ -145,7 +146,7 @@ namespace bitxorcore { namespace validators {
 				};
 
 				return thread::compose(
-						thread::ParallelFor(m_pool.ioContext(), pWork->entityInfos(), m_pool.numWorkerThreads(), workProcessItemCallback),
+						thread::ParallelFor(m_pool, pWork->entityInfos(), workProcessItemCallback),
 						workCompleteCallback);
 			}
 
@@ -159,13 +160,13 @@ namespace bitxorcore { namespace validators {
 			}
 
 		private:
-			thread::IoThreadPool& m_pool;
+			thread::ComputeThreadPool& m_pool;
 			std::shared_ptr<const StatelessEntityValidator> m_pValidator;
 		};
 	}
 
 	std::shared_ptr<const ParallelValidationPolicy> CreateParallelValidationPolicy(
-			thread::IoThreadPool& pool,
+			thread::ComputeThreadPool& pool,
 			const std::shared_ptr<const StatelessEntityValidator>& pValidator) {
 		return std::make_shared<const DefaultParallelValidationPolicy>(pool, pValidator);
 	}
@@ -24,7 +24,7 @@
 #include "ValidatorTypes.h"
 #include "bitxorcore/thread/Future.h"
 
-namespace bitxorcore { namespace thread { class IoThreadPool; } }
+namespace bitxorcore { namespace thread { class ComputeThreadPool; } }
 
 namespace bitxorcore { namespace validators {
 
@@ -43,6 +43,6 @@ namespace bitxorcore { namespace validators {
 
 	/// Creates a parallel validation policy using \a pool for parallelization and \a pValidator for validation.
 	std::shared_ptr<const ParallelValidationPolicy> CreateParallelValidationPolicy(
-			thread::IoThreadPool& pool,
+			thread::ComputeThreadPool& pool,
 			const std::shared_ptr<const StatelessEntityValidator>& pValidator);
 }}
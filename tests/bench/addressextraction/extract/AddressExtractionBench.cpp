@@ -0,0 +1,140 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "addressextraction/src/AddressExtractor.h"
+#include "bitxorcore/model/BlockStatement.h"
+#include "bitxorcore/model/Elements.h"
+#include "bitxorcore/model/NotificationSubscriber.h"
+#include "bitxorcore/utils/MemoryUtils.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace bitxorcore { namespace addressextraction {
+
+	namespace {
+		constexpr auto Num_Transactions = 6000u;
+		constexpr auto Num_Aliased_Addresses = 100u;
+
+		// publishes signer and recipient public keys (requiring address derivation) and one aliased address per transaction
+		class BenchNotificationPublisher : public model::NotificationPublisher {
+		public:
+			explicit BenchNotificationPublisher(const std::vector<UnresolvedAddress>& aliasedAddresses)
+					: m_aliasedAddresses(aliasedAddresses)
+			{}
+
+		public:
+			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& sub) const override {
+				const auto& transaction = static_cast<const model::Transaction&>(entityInfo.entity());
+				sub.notify(model::AccountPublicKeyNotification(transaction.SignerPublicKey));
+
+				const auto& recipientPublicKey = reinterpret_cast<const Key&>(transaction.Signature);
+				sub.notify(model::AccountPublicKeyNotification(recipientPublicKey));
+
+				sub.notify(model::AccountAddressNotification(m_aliasedAddresses[GetAliasIndex(transaction)]));
+			}
+
+		public:
+			static size_t GetAliasIndex(const model::Transaction& transaction) {
+				return transaction.Deadline.unwrap() % Num_Aliased_Addresses;
+			}
+
+		private:
+			const std::vector<UnresolvedAddress>& m_aliasedAddresses;
+		};
+
+		class BenchContext {
+		public:
+			explicit BenchContext(size_t numWorkerThreads)
+					: m_aliasedAddresses(Num_Aliased_Addresses)
+					, m_extractor(std::make_unique<BenchNotificationPublisher>(m_aliasedAddresses), numWorkerThreads)
+					, m_pBlockStatement(std::make_shared<model::BlockStatement>()) {
+				for (auto& address : m_aliasedAddresses)
+					bench::FillWithRandomData(address);
+
+				for (auto i = 0u; i < Num_Transactions; ++i) {
+					auto pTransaction = utils::MakeUniqueWithSize<model::Transaction>(sizeof(model::Transaction));
+					bench::FillWithRandomData({ reinterpret_cast<uint8_t*>(pTransaction.get()), sizeof(model::Transaction) });
+					pTransaction->Size = sizeof(model::Transaction);
+					m_transactions.push_back(std::move(pTransaction));
+				}
+
+				// every transaction resolves its aliased address
+				auto& addressResolutionStatements = m_pBlockStatement->AddressResolutionStatements;
+				for (auto i = 0u; i < Num_Transactions; ++i) {
+					const auto& aliasedAddress = m_aliasedAddresses[BenchNotificationPublisher::GetAliasIndex(*m_transactions[i])];
+					auto resolutionStatement = model::AddressResolutionStatement(aliasedAddress);
+					auto iter = addressResolutionStatements.emplace(aliasedAddress, std::move(resolutionStatement)).first;
+
+					Address resolvedAddress;
+					bench::FillWithRandomData(resolvedAddress);
+					iter->second.addResolution(resolvedAddress, { i + 1, 0 });
+				}
+			}
+
+		public:
+			model::BlockElement createBlockElement() const {
+				model::BlockElement blockElement(m_block);
+				blockElement.OptionalStatement = m_pBlockStatement;
+				for (const auto& pTransaction : m_transactions)
+					blockElement.Transactions.push_back(model::TransactionElement(*pTransaction));
+
+				return blockElement;
+			}
+
+			void extract(model::BlockElement& blockElement) const {
+				m_extractor.extract(blockElement);
+			}
+
+		private:
+			std::vector<UnresolvedAddress> m_aliasedAddresses;
+			AddressExtractor m_extractor;
+
+			model::Block m_block;
+			std::vector<std::unique_ptr<model::Transaction>> m_transactions;
+			std::shared_ptr<model::BlockStatement> m_pBlockStatement;
+		};
+
+		void BenchmarkExtractBlockAddresses(benchmark::State& state) {
+			BenchContext context(static_cast<size_t>(state.range(0)));
+
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto blockElement = context.createBlockElement();
+				state.ResumeTiming();
+
+				context.extract(blockElement);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Transactions * state.iterations()));
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	benchmark::RegisterBenchmark("BenchmarkExtractBlockAddresses", bitxorcore::addressextraction::BenchmarkExtractBlockAddresses)
+			->UseRealTime()
+			->Arg(1)
+			->Arg(2)
+			->Arg(4)
+			->Arg(8);
+}
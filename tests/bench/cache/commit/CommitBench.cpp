@@ -0,0 +1,173 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/cache/BitxorCoreCache.h"
+#include "bitxorcore/cache_core/AccountStateCache.h"
+#include "bitxorcore/cache_core/AccountStateCacheSubCachePlugin.h"
+#include "bitxorcore/cache_db/SharedRocksDatabase.h"
+#include "bitxorcore/utils/StackTimer.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <utility>
+
+namespace bitxorcore { namespace cache {
+
+	namespace {
+		constexpr auto Num_Sub_Caches = 8u;
+		constexpr auto Bench_Directory = "bench_commit_data";
+
+		// each account state sub cache is registered at a distinct index, so it needs an alias type with a matching id
+		template<size_t CacheId>
+		struct IndexedAccountStateCache {
+			static constexpr size_t Id = CacheId;
+			using CacheDeltaType = AccountStateCacheDelta;
+		};
+
+		enum class DatabaseMode { Separate, Shared };
+
+		class BenchContext {
+		public:
+			BenchContext(SubCacheCommitMode commitMode, DatabaseMode databaseMode) {
+				std::filesystem::remove_all(Bench_Directory);
+
+				std::shared_ptr<SharedRocksDatabase> pSharedDatabase;
+				if (DatabaseMode::Shared == databaseMode) {
+					auto directory = (std::filesystem::path(Bench_Directory) / "shared").generic_string();
+					pSharedDatabase = std::make_shared<SharedRocksDatabase>(
+							directory,
+							config::NodeConfiguration::CacheDatabaseSubConfiguration());
+				}
+
+				AccountStateCacheTypes::Options options;
+				options.NetworkIdentifier = model::NetworkIdentifier::Testnet;
+				options.ImportanceGrouping = 1;
+				options.VotingSetGrouping = 1;
+
+				std::vector<std::unique_ptr<SubCachePlugin>> subCaches;
+				for (auto i = 0u; i < Num_Sub_Caches; ++i) {
+					auto directory = (std::filesystem::path(Bench_Directory) / std::to_string(i)).generic_string();
+					std::filesystem::create_directories(directory);
+
+					auto cacheConfig = CacheConfiguration(directory, PatriciaTreeStorageMode::Disabled);
+					cacheConfig.SharedDatabase = pSharedDatabase;
+					subCaches.push_back(std::make_unique<AccountStateCacheSubCachePlugin>(cacheConfig, options));
+				}
+
+				m_pCache = std::make_unique<BitxorCoreCache>(std::move(subCaches), commitMode, pSharedDatabase);
+			}
+
+			~BenchContext() {
+				m_pCache.reset();
+				std::filesystem::remove_all(Bench_Directory);
+			}
+
+		public:
+			BitxorCoreCache& cache() {
+				return *m_pCache;
+			}
+
+		private:
+			std::unique_ptr<BitxorCoreCache> m_pCache;
+		};
+
+		template<size_t CacheId>
+		void AddAccounts(BitxorCoreCacheDelta& delta, size_t numAccounts, Height height) {
+			auto& accountStateCacheDelta = delta.sub<IndexedAccountStateCache<CacheId>>();
+			for (auto i = 0u; i < numAccounts; ++i) {
+				Address address;
+				bench::FillWithRandomData(address);
+				accountStateCacheDelta.addAccount(address, height);
+			}
+		}
+
+		template<size_t... CacheIds>
+		void AddAccountsToAll(BitxorCoreCacheDelta& delta, size_t numAccounts, Height height, std::index_sequence<CacheIds...>) {
+			(AddAccounts<CacheIds>(delta, numAccounts, height), ...);
+		}
+
+		// state.range(0) is number of accounts added to each sub cache per commit
+
+		template<SubCacheCommitMode CommitMode, DatabaseMode Mode>
+		void BenchmarkCommit(benchmark::State& state) {
+			auto numAccounts = static_cast<size_t>(state.range(0));
+			BenchContext context(CommitMode, Mode);
+
+			uint64_t totalCommitMicros = 0;
+			uint64_t maxCommitMicros = 0;
+			Height height;
+			for (auto _ : state) {
+				state.PauseTiming();
+				height = height + Height(1);
+				auto delta = context.cache().createDelta();
+				AddAccountsToAll(delta, numAccounts, height, std::make_index_sequence<Num_Sub_Caches>());
+				state.ResumeTiming();
+
+				utils::StackTimer stopwatch;
+				context.cache().commit(height);
+				auto commitMicros = stopwatch.micros();
+				totalCommitMicros += commitMicros;
+				maxCommitMicros = std::max(maxCommitMicros, commitMicros);
+			}
+
+			state.counters["commit_avg_us"] = static_cast<double>(totalCommitMicros) / static_cast<double>(state.iterations());
+			state.counters["commit_max_us"] = static_cast<double>(maxCommitMicros);
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace bitxorcore::cache;
+
+	benchmark::RegisterBenchmark(
+			"BenchmarkCommit<Sequential, Separate>",
+			BenchmarkCommit<SubCacheCommitMode::Sequential, DatabaseMode::Separate>)
+			->UseRealTime()
+			->Arg(10)
+			->Arg(100)
+			->Arg(1'000);
+
+	benchmark::RegisterBenchmark(
+			"BenchmarkCommit<Parallel, Separate>",
+			BenchmarkCommit<SubCacheCommitMode::Parallel, DatabaseMode::Separate>)
+			->UseRealTime()
+			->Arg(10)
+			->Arg(100)
+			->Arg(1'000);
+
+	benchmark::RegisterBenchmark(
+			"BenchmarkCommit<Sequential, Shared>",
+			BenchmarkCommit<SubCacheCommitMode::Sequential, DatabaseMode::Shared>)
+			->UseRealTime()
+			->Arg(10)
+			->Arg(100)
+			->Arg(1'000);
+
+	benchmark::RegisterBenchmark(
+			"BenchmarkCommit<Parallel, Shared>",
+			BenchmarkCommit<SubCacheCommitMode::Parallel, DatabaseMode::Shared>)
+			->UseRealTime()
+			->Arg(10)
+			->Arg(100)
+			->Arg(1'000);
+}
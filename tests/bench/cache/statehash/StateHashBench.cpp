@@ -0,0 +1,158 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/cache/CachePatriciaTree.h"
+#include "bitxorcore/tree/BasePatriciaTree.h"
+#include "bitxorcore/utils/StackTimer.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+
+namespace bitxorcore { namespace cache {
+
+	namespace {
+		constexpr auto Num_Tree_Values = 1'000'000u;
+		constexpr auto Num_Values_Per_Fill_Commit = 100'000u;
+		constexpr auto Bench_Directory = "bench_statehash_data";
+
+		struct HashEncoder {
+			using KeyType = Hash256;
+			using ValueType = Hash256;
+
+			static const KeyType& EncodeKey(const KeyType& key) {
+				return key;
+			}
+
+			static const Hash256& EncodeValue(const ValueType& value) {
+				return value;
+			}
+		};
+
+		using DatabasePatriciaTree = tree::BasePatriciaTree<HashEncoder, PatriciaTreeRdbDataSource>;
+
+		Hash256 GenerateRandomHash() {
+			Hash256 hash;
+			bench::FillWithRandomData(hash);
+			return hash;
+		}
+
+		class BenchContext {
+		public:
+			explicit BenchContext(size_t maxCachedNodes)
+					: m_database(CreateDatabase())
+					, m_tree(true, *m_database, 1, maxCachedNodes) {
+				// fill the tree in multiple commits so that the database contains intermediate roots too
+				for (auto i = 0u; i < Num_Tree_Values / Num_Values_Per_Fill_Commit; ++i) {
+					auto pDeltaTree = m_tree.rebase();
+					for (auto j = 0u; j < Num_Values_Per_Fill_Commit; ++j) {
+						m_keys.push_back(GenerateRandomHash());
+						pDeltaTree->set(m_keys.back(), GenerateRandomHash());
+					}
+
+					m_tree.commit();
+				}
+			}
+
+			~BenchContext() {
+				m_database.reset();
+				std::filesystem::remove_all(Bench_Directory);
+			}
+
+		public:
+			const std::vector<Hash256>& keys() const {
+				return m_keys;
+			}
+
+			CachePatriciaTree<DatabasePatriciaTree>& tree() {
+				return m_tree;
+			}
+
+		private:
+			static std::unique_ptr<CacheDatabase> CreateDatabase() {
+				std::filesystem::remove_all(Bench_Directory);
+				std::filesystem::create_directories(Bench_Directory);
+
+				auto settings = CacheDatabaseSettings(Bench_Directory, { "default", "patricia_tree" }, FilterPruningMode::Disabled);
+				return std::make_unique<CacheDatabase>(settings);
+			}
+
+		private:
+			std::unique_ptr<CacheDatabase> m_database;
+			CachePatriciaTree<DatabasePatriciaTree> m_tree;
+			std::vector<Hash256> m_keys;
+		};
+
+		// state.range(0) is number of accounts modified per block
+		// state.range(1) is maximum number of cached (unpinned) nodes
+
+		void BenchmarkStateHash(benchmark::State& state) {
+			auto numModifiedAccounts = static_cast<size_t>(state.range(0));
+			BenchContext context(static_cast<size_t>(state.range(1)));
+
+			uint64_t totalHashMicros = 0;
+			for (auto _ : state) {
+				state.PauseTiming();
+				std::vector<Hash256> modifiedKeys;
+				for (auto i = 0u; i < numModifiedAccounts; ++i)
+					modifiedKeys.push_back(context.keys()[bench::Random() % context.keys().size()]);
+
+				auto pDeltaTree = context.tree().rebase();
+				state.ResumeTiming();
+
+				// state hash calculation consists of updating all modified accounts and calculating the new root
+				utils::StackTimer stopwatch;
+				for (const auto& key : modifiedKeys)
+					pDeltaTree->set(key, GenerateRandomHash());
+
+				benchmark::DoNotOptimize(pDeltaTree->root());
+				totalHashMicros += stopwatch.micros();
+
+				// commit so that the next iteration is based on a new root (and a new pinned generation)
+				state.PauseTiming();
+				context.tree().commit();
+				state.ResumeTiming();
+			}
+
+			state.counters["hash_avg_us"] = static_cast<double>(totalHashMicros) / static_cast<double>(state.iterations());
+
+			const auto* pNodeCache = context.tree().nodeCache();
+			if (!pNodeCache)
+				return;
+
+			const auto& statistics = pNodeCache->statistics();
+			auto numHits = static_cast<double>(statistics.NumHits);
+			auto numMisses = static_cast<double>(statistics.NumMisses);
+			state.counters["cache_hit_ratio"] = numHits / std::max(1.0, numHits + numMisses);
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace bitxorcore::cache;
+
+	// zero disables the node cache
+	benchmark::RegisterBenchmark("BenchmarkStateHash", BenchmarkStateHash)
+			->UseRealTime()
+			->Unit(benchmark::kMillisecond)
+			->ArgsProduct({ { 100, 1'000, 10'000 }, { 0, 10'000, 100'000 } });
+}
@@ -0,0 +1,110 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/deltaset/BaseSetCommitPolicy.h"
+#include "bitxorcore/deltaset/BaseSetDefaultTraits.h"
+#include "bitxorcore/state/AccountState.h"
+#include "bitxorcore/utils/Hashers.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <unordered_map>
+
+namespace bitxorcore { namespace deltaset {
+
+	namespace {
+		constexpr auto Num_Tokens_Per_Account = 10u;
+
+		using AccountStateMap = std::unordered_map<Address, state::AccountState, utils::ArrayHasher<Address>>;
+		using AccountStateKeyTraits = MapKeyTraits<AccountStateMap>;
+
+		AccountStateMap CreateAccountStates(size_t numAccounts) {
+			AccountStateMap accountStates;
+			accountStates.reserve(numAccounts);
+			for (auto i = 0u; i < numAccounts; ++i) {
+				Address address;
+				bench::FillWithRandomData(address);
+
+				auto& accountState = accountStates.emplace(address, state::AccountState(address, Height(1))).first->second;
+				for (auto j = 0u; j < Num_Tokens_Per_Account; ++j)
+					accountState.Balances.credit(TokenId(j + 1), Amount(bench::Random()));
+			}
+
+			return accountStates;
+		}
+
+		AccountStateMap CreateModifiedCopies(const AccountStateMap& accountStates) {
+			// emulate a delta that touched every account in the original set
+			AccountStateMap copiedAccountStates;
+			copiedAccountStates.reserve(accountStates.size());
+			for (const auto& pair : accountStates)
+				copiedAccountStates.emplace(pair.first, pair.second).first->second.Balances.credit(TokenId(1), Amount(1));
+
+			return copiedAccountStates;
+		}
+
+		// state.range(0) is number of modified accounts committed per iteration
+
+		template<bool UseMovableDeltas>
+		void BenchmarkCommitModifiedAccounts(benchmark::State& state) {
+			auto numAccounts = static_cast<size_t>(state.range(0));
+
+			AccountStateMap added;
+			AccountStateMap removed;
+			for (auto _ : state) {
+				// use fresh sets in each iteration so that allocator state does not carry over between commits
+				state.PauseTiming();
+				auto accountStates = CreateAccountStates(numAccounts);
+				auto copied = CreateModifiedCopies(accountStates);
+				state.ResumeTiming();
+
+				if constexpr (UseMovableDeltas)
+					UpdateSet<AccountStateKeyTraits>(accountStates, MovableDeltaElements<AccountStateMap>(added, removed, copied));
+				else
+					UpdateSet<AccountStateKeyTraits>(accountStates, DeltaElements<AccountStateMap>(added, removed, copied));
+
+				// commit resets the delta, so destruction of the (possibly moved from) copies is included
+				copied.clear();
+
+				state.PauseTiming();
+				accountStates.clear();
+				state.ResumeTiming();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace bitxorcore::deltaset;
+
+	benchmark::RegisterBenchmark("BenchmarkCommitModifiedAccounts<Copy>", BenchmarkCommitModifiedAccounts<false>)
+			->Arg(10'000)
+			->Arg(100'000)
+			->Unit(benchmark::kMillisecond);
+
+	benchmark::RegisterBenchmark("BenchmarkCommitModifiedAccounts<Move>", BenchmarkCommitModifiedAccounts<true>)
+			->Arg(10'000)
+			->Arg(100'000)
+			->Unit(benchmark::kMillisecond);
+}
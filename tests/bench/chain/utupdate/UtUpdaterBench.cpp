@@ -0,0 +1,237 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/chain/UtUpdater.h"
+#include "bitxorcore/cache/BitxorCoreCache.h"
+#include "bitxorcore/cache_core/AccountStateCache.h"
+#include "bitxorcore/cache_core/AccountStateCacheSubCachePlugin.h"
+#include "bitxorcore/cache_tx/MemoryUtCache.h"
+#include "bitxorcore/model/Address.h"
+#include "bitxorcore/model/NotificationSubscriber.h"
+#include "bitxorcore/observers/DemuxObserverBuilder.h"
+#include "bitxorcore/utils/MemoryUtils.h"
+#include "bitxorcore/validators/DemuxValidatorBuilder.h"
+#include "plugins/coresystem/src/observers/Observers.h"
+#include "plugins/coresystem/src/validators/Validators.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <cstring>
+
+namespace bitxorcore { namespace chain {
+
+	namespace {
+		constexpr auto Network_Identifier = model::NetworkIdentifier::Testnet;
+		constexpr auto Currency_Token_Id = TokenId(1234);
+		constexpr auto Chain_Height = Height(100);
+		constexpr auto Num_Block_Transactions = 100u;
+		constexpr auto Num_Stateful_Validators = 8u;
+		constexpr auto Transaction_Size = static_cast<uint32_t>(sizeof(model::Transaction) + Address::Size);
+
+		enum class RevalidationMode { Full, Incremental };
+
+		// region TransferNotificationPublisher
+
+		// publishes a single balance transfer from the signer to the recipient address stored after the transaction header
+		class TransferNotificationPublisher : public model::NotificationPublisher {
+		public:
+			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& sub) const override {
+				const auto& transaction = static_cast<const model::Transaction&>(entityInfo.entity());
+				auto sender = model::PublicKeyToAddress(transaction.SignerPublicKey, Network_Identifier);
+				sub.notify(model::BalanceTransferNotification(
+						sender,
+						GetRecipient(transaction),
+						UnresolvedTokenId(Currency_Token_Id.unwrap()),
+						Amount(1)));
+			}
+
+		public:
+			static Address GetRecipient(const model::Transaction& transaction) {
+				Address recipient;
+				std::memcpy(recipient.data(), reinterpret_cast<const uint8_t*>(&transaction + 1), Address::Size);
+				return recipient;
+			}
+		};
+
+		// endregion
+
+		// region BenchContext
+
+		class BenchContext {
+		public:
+			explicit BenchContext(size_t numTransactions)
+					: m_cache(CreateBitxorCoreCache())
+					, m_transactionsCache(cache::MemoryCacheOptions(
+							utils::FileSize(),
+							utils::FileSize::FromBytes(2 * numTransactions * Transaction_Size))) {
+				seedAccounts(numTransactions);
+
+				auto executionConfig = CreateExecutionConfiguration();
+				m_pUpdater = std::make_unique<UtUpdater>(
+						m_transactionsCache,
+						m_cache,
+						BlockFeeMultiplier(),
+						executionConfig,
+						[]() { return Timestamp(1); },
+						[](const auto&, const auto&, auto) {},
+						[](const auto&, const auto&) { return false; });
+
+				// every account signs a single transaction to a random recipient
+				std::vector<model::TransactionInfo> transactionInfos;
+				for (const auto& signer : m_signers)
+					transactionInfos.push_back(createTransactionInfo(signer, m_addresses[bench::Random() % m_addresses.size()]));
+
+				m_pUpdater->update(transactionInfos);
+				m_affectedAddresses = simulateBlock();
+			}
+
+		public:
+			size_t numUnconfirmedTransactions() const {
+				return m_transactionsCache.view().size();
+			}
+
+			void update(RevalidationMode mode) {
+				// no transactions are confirmed, so all unconfirmed transactions are reapplied by every update
+				utils::HashPointerSet confirmedTransactionHashes;
+				if (RevalidationMode::Incremental == mode)
+					m_pUpdater->update(confirmedTransactionHashes, {}, m_affectedAddresses);
+				else
+					m_pUpdater->update(confirmedTransactionHashes, {});
+			}
+
+		private:
+			static cache::BitxorCoreCache CreateBitxorCoreCache() {
+				cache::AccountStateCacheTypes::Options options;
+				options.NetworkIdentifier = Network_Identifier;
+				options.ImportanceGrouping = 1;
+				options.VotingSetGrouping = 1;
+
+				std::vector<std::unique_ptr<cache::SubCachePlugin>> subCaches(cache::AccountStateCache::Id + 1);
+				subCaches[cache::AccountStateCache::Id] = std::make_unique<cache::AccountStateCacheSubCachePlugin>(
+						cache::CacheConfiguration(),
+						options);
+				return cache::BitxorCoreCache(std::move(subCaches));
+			}
+
+			static ExecutionConfiguration CreateExecutionConfiguration() {
+				ExecutionConfiguration executionConfig;
+				executionConfig.Network.Identifier = Network_Identifier;
+				executionConfig.ResolverContextFactory = [](const auto&) { return model::ResolverContext(); };
+				executionConfig.pObserver = observers::DemuxObserverBuilder()
+						.add(observers::CreateBalanceTransferObserver())
+						.build();
+
+				// simulate the chain of stateful validators (balance, restrictions, multisig, ...) that checks every transfer
+				validators::stateful::DemuxValidatorBuilder validatorBuilder;
+				for (auto i = 0u; i < Num_Stateful_Validators; ++i)
+					validatorBuilder.add(validators::CreateBalanceTransferValidator());
+
+				executionConfig.pValidator = validatorBuilder.build([](auto) { return false; });
+				executionConfig.pNotificationPublisher = std::make_shared<TransferNotificationPublisher>();
+				return executionConfig;
+			}
+
+		private:
+			void seedAccounts(size_t count) {
+				auto delta = m_cache.createDelta();
+				auto& accountStateCacheDelta = delta.sub<cache::AccountStateCache>();
+				for (auto i = 0u; i < count; ++i) {
+					Key signer;
+					bench::FillWithRandomData(signer);
+					m_signers.push_back(signer);
+					m_addresses.push_back(model::PublicKeyToAddress(signer, Network_Identifier));
+
+					accountStateCacheDelta.addAccount(signer, Height(1));
+					accountStateCacheDelta.find(signer).get().Balances.credit(Currency_Token_Id, Amount(1'000'000));
+				}
+
+				m_cache.commit(Chain_Height);
+			}
+
+			model::TransactionInfo createTransactionInfo(const Key& signer, const Address& recipient) const {
+				auto pTransaction = utils::MakeSharedWithSize<model::Transaction>(Transaction_Size);
+				std::memset(static_cast<void*>(pTransaction.get()), 0, Transaction_Size);
+				pTransaction->Size = Transaction_Size;
+				pTransaction->SignerPublicKey = signer;
+				pTransaction->Deadline = Timestamp(std::numeric_limits<Timestamp::ValueType>::max());
+				std::memcpy(reinterpret_cast<uint8_t*>(pTransaction.get() + 1), recipient.data(), Address::Size);
+
+				auto pExtractedAddresses = std::make_shared<model::UnresolvedAddressSet>();
+				pExtractedAddresses->insert(model::PublicKeyToAddress(signer, Network_Identifier).copyTo<UnresolvedAddress>());
+				pExtractedAddresses->insert(recipient.copyTo<UnresolvedAddress>());
+
+				model::TransactionInfo transactionInfo(std::move(pTransaction));
+				bench::FillWithRandomData(transactionInfo.EntityHash);
+				transactionInfo.OptionalExtractedAddresses = std::move(pExtractedAddresses);
+				return transactionInfo;
+			}
+
+			AffectedAddresses simulateBlock() const {
+				// a block with transactions from random accounts that are not in the unconfirmed transactions cache
+				AffectedAddresses affectedAddresses;
+				for (auto i = 0u; i < Num_Block_Transactions; ++i) {
+					const auto& sender = m_addresses[bench::Random() % m_addresses.size()];
+					const auto& recipient = m_addresses[bench::Random() % m_addresses.size()];
+					affectedAddresses.Transactions.insert(sender.copyTo<UnresolvedAddress>());
+					affectedAddresses.Transactions.insert(recipient.copyTo<UnresolvedAddress>());
+					affectedAddresses.Accounts.insert(sender);
+					affectedAddresses.Accounts.insert(recipient);
+				}
+
+				return affectedAddresses;
+			}
+
+		private:
+			cache::BitxorCoreCache m_cache;
+			cache::MemoryUtCacheProxy m_transactionsCache;
+			std::vector<Key> m_signers;
+			std::vector<Address> m_addresses;
+			std::unique_ptr<UtUpdater> m_pUpdater;
+			AffectedAddresses m_affectedAddresses;
+		};
+
+		// endregion
+
+		void BenchmarkPostBlockUpdate(benchmark::State& state, RevalidationMode mode) {
+			// Arrange:
+			BenchContext context(static_cast<size_t>(state.range(0)));
+
+			// Act:
+			for (auto _ : state)
+				context.update(mode);
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * context.numUnconfirmedTransactions()));
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using bitxorcore::chain::RevalidationMode;
+
+	for (auto mode : { RevalidationMode::Full, RevalidationMode::Incremental }) {
+		auto name = std::string("BenchmarkPostBlockUpdate") + (RevalidationMode::Full == mode ? "Full" : "Incremental");
+		benchmark::RegisterBenchmark(name.c_str(), bitxorcore::chain::BenchmarkPostBlockUpdate, mode)
+				->Arg(10'000)
+				->Arg(100'000)
+				->Unit(benchmark::kMillisecond);
+	}
+}
@@ -0,0 +1,121 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/consumers/RecentHashCache.h"
+#include "bitxorcore/consumers/ShardedRecentHashCache.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <thread>
+#include <vector>
+
+namespace bitxorcore { namespace consumers {
+
+	namespace {
+		constexpr auto Num_Hashes_Per_Iteration = 20'000u;
+		constexpr auto Num_Shards = 16u;
+
+		// short durations so that hashes expire (and are pruned) while the benchmark is running
+		constexpr auto Options = HashCheckOptions(1'000, 100, 1'000'000);
+
+		// every hundredth call advances time by 1ms so that concurrent adds observe a moving clock
+		chain::TimeSupplier CreateTimeSupplier(std::atomic<uint64_t>& numCalls) {
+			return [&numCalls]() { return Timestamp(++numCalls / 100); };
+		}
+
+		std::vector<Hash256> GenerateHashes() {
+			std::vector<Hash256> hashes(Num_Hashes_Per_Iteration);
+			for (auto& hash : hashes)
+				bench::FillWithRandomData(hash);
+
+			return hashes;
+		}
+
+		struct SynchronizedTraits {
+			static auto Create(const chain::TimeSupplier& timeSupplier) {
+				return std::make_unique<SynchronizedRecentHashCache>(timeSupplier, Options);
+			}
+		};
+
+		struct ShardedTraits {
+			static auto Create(const chain::TimeSupplier& timeSupplier) {
+				return std::make_unique<ShardedRecentHashCache>(timeSupplier, Options, Num_Shards);
+			}
+		};
+
+		template<typename TTraits>
+		void BenchmarkConcurrentAdd(benchmark::State& state) {
+			// simulate many peers pushing (mostly) the same transactions by having every thread add all hashes
+			auto numThreads = static_cast<size_t>(state.range(0));
+			auto hashes = GenerateHashes();
+			uint64_t numUnknown = 0;
+
+			for (auto _ : state) {
+				std::atomic<uint64_t> numCalls(0);
+				auto pCache = TTraits::Create(CreateTimeSupplier(numCalls));
+				std::vector<uint64_t> unknownCounts(numThreads);
+
+				std::vector<std::thread> threads;
+				for (auto i = 0u; i < numThreads; ++i) {
+					threads.emplace_back([&cache = *pCache, &hashes, &unknownCount = unknownCounts[i], i]() {
+						// start each thread at a different offset in order to mix hits and misses
+						auto offset = i * hashes.size() / 16;
+						for (auto j = 0u; j < hashes.size(); ++j) {
+							if (cache.add(hashes[(offset + j) % hashes.size()]))
+								++unknownCount;
+						}
+					});
+				}
+
+				for (auto& thread : threads)
+					thread.join();
+
+				for (auto unknownCount : unknownCounts)
+					numUnknown += unknownCount;
+			}
+
+			auto numAdds = static_cast<double>(numThreads * hashes.size() * state.iterations());
+			state.counters["adds"] = benchmark::Counter(numAdds, benchmark::Counter::kIsRate);
+			state.counters["unknown_pct"] = 100.0 * static_cast<double>(numUnknown) / numAdds;
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace bitxorcore::consumers;
+
+	benchmark::RegisterBenchmark("BenchmarkConcurrentAdd<SynchronizedRecentHashCache>", BenchmarkConcurrentAdd<SynchronizedTraits>)
+			->UseRealTime()
+			->Arg(1)
+			->Arg(2)
+			->Arg(4)
+			->Arg(8)
+			->Arg(16);
+
+	benchmark::RegisterBenchmark("BenchmarkConcurrentAdd<ShardedRecentHashCache>", BenchmarkConcurrentAdd<ShardedTraits>)
+			->UseRealTime()
+			->Arg(1)
+			->Arg(2)
+			->Arg(4)
+			->Arg(8)
+			->Arg(16);
+}
@@ -0,0 +1,141 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "sdk/src/extensions/MemoryStream.h"
+#include "bitxorcore/crypto_voting/BmPrivateKeyTree.h"
+#include "bitxorcore/utils/Logging.h"
+#include "bitxorcore/utils/RandomGenerator.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+
+namespace bitxorcore { namespace crypto {
+
+	namespace {
+		constexpr auto Data_Size = 120;
+		constexpr auto Num_Voters = 128u;
+		constexpr auto Num_Messages_Per_Voter = 2u;
+		constexpr auto Key_Identifier = BmKeyIdentifier{ 7 };
+
+		RandomFiller CreateRandomFiller() {
+			return [](auto* pOut, auto count) {
+				utils::HighEntropyRandomGenerator().fill(pOut, count);
+			};
+		}
+
+		// each voter signs a prevote and a precommit with the same key identifier,
+		// so the second message shares its root and bottom binding with the first
+		class VotingRound {
+		public:
+			VotingRound() {
+				std::vector<uint8_t> storage;
+				extensions::MemoryStream stream(storage);
+				for (auto i = 0u; i < Num_Voters; ++i) {
+					stream.seek(0);
+					auto keyPair = VotingKeyPair::FromPrivate(VotingPrivateKey::Generate(bench::RandomByte));
+					auto tree = BmPrivateKeyTree::Create(std::move(keyPair), stream, { Key_Identifier, Key_Identifier });
+					for (auto j = 0u; j < Num_Messages_Per_Voter; ++j) {
+						m_buffers.emplace_back(Data_Size);
+						bench::FillWithRandomData(m_buffers.back());
+						m_signatures.push_back(tree.sign(Key_Identifier, m_buffers.back()));
+					}
+				}
+
+				for (auto i = 0u; i < m_signatures.size(); ++i)
+					m_signatureInputs.push_back({ m_signatures[i], Key_Identifier, m_buffers[i] });
+			}
+
+		public:
+			const std::vector<BmTreeSignatureInput>& signatureInputs() const {
+				return m_signatureInputs;
+			}
+
+		private:
+			std::vector<std::vector<uint8_t>> m_buffers;
+			std::vector<BmTreeSignature> m_signatures;
+			std::vector<BmTreeSignatureInput> m_signatureInputs;
+		};
+
+		void SetBytesProcessed(benchmark::State& state) {
+			state.SetBytesProcessed(static_cast<int64_t>(Data_Size * Num_Voters * Num_Messages_Per_Voter * state.iterations()));
+		}
+
+		void LogFailures(size_t numFailures, const char* name) {
+			if (0 != numFailures)
+				BITXORCORE_LOG(warning) << numFailures << " calls to " << name << " failed";
+		}
+
+		void BenchmarkVerify(benchmark::State& state) {
+			auto numFailures = 0u;
+			VotingRound round;
+
+			for (auto _ : state) {
+				for (const auto& input : round.signatureInputs()) {
+					if (!Verify(input.Signature, input.KeyIdentifier, input.Buffer))
+						++numFailures;
+				}
+			}
+
+			SetBytesProcessed(state);
+			LogFailures(numFailures, "Verify");
+		}
+
+		void BenchmarkVerifyCached(benchmark::State& state) {
+			auto numFailures = 0u;
+			VotingRound round;
+
+			for (auto _ : state) {
+				// each iteration simulates a new round, so start with an empty cache
+				BmVerificationCache verificationCache(Num_Voters * Num_Messages_Per_Voter);
+				for (const auto& input : round.signatureInputs()) {
+					if (!Verify(input.Signature, input.KeyIdentifier, input.Buffer, verificationCache))
+						++numFailures;
+				}
+			}
+
+			SetBytesProcessed(state);
+			LogFailures(numFailures, "Verify (cached)");
+		}
+
+		void BenchmarkVerifyMulti(benchmark::State& state) {
+			auto numFailures = 0u;
+			VotingRound round;
+			const auto& signatureInputs = round.signatureInputs();
+
+			for (auto _ : state) {
+				BmVerificationCache verificationCache(Num_Voters * Num_Messages_Per_Voter);
+				auto results = VerifyMulti(CreateRandomFiller(), signatureInputs.data(), signatureInputs.size(), verificationCache);
+				numFailures += static_cast<uint32_t>(std::count(results.cbegin(), results.cend(), false));
+			}
+
+			SetBytesProcessed(state);
+			LogFailures(numFailures, "VerifyMulti");
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	benchmark::RegisterBenchmark("BenchmarkVerify", bitxorcore::crypto::BenchmarkVerify)->UseRealTime();
+	benchmark::RegisterBenchmark("BenchmarkVerifyCached", bitxorcore::crypto::BenchmarkVerifyCached)->UseRealTime();
+	benchmark::RegisterBenchmark("BenchmarkVerifyMulti", bitxorcore::crypto::BenchmarkVerifyMulti)->UseRealTime();
+}
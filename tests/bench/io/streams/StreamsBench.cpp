@@ -0,0 +1,106 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "bitxorcore/io/BufferInputStreamAdapter.h"
+#include "bitxorcore/io/ChecksummedChunkStream.h"
+#include "bitxorcore/io/StringOutputStream.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace bitxorcore { namespace io {
+
+	namespace {
+		constexpr auto Data_Size = 64 * 1024 * 1024;
+
+		std::vector<uint8_t> GenerateRandomData() {
+			std::vector<uint8_t> data(Data_Size);
+			bench::FillWithRandomData(data);
+			return data;
+		}
+
+		std::vector<uint8_t> Write(const std::vector<uint8_t>& data, uint32_t chunkSize) {
+			StringOutputStream output(Data_Size);
+			if (0 == chunkSize) {
+				output.write(data);
+				output.flush();
+			} else {
+				ChecksummedChunkOutputStream chunkedOutput(output, chunkSize);
+				chunkedOutput.write(data);
+				chunkedOutput.flush();
+			}
+
+			const auto& str = output.str();
+			return std::vector<uint8_t>(str.cbegin(), str.cend());
+		}
+
+		void Read(const std::vector<uint8_t>& buffer, std::vector<uint8_t>& data, uint32_t chunkSize) {
+			BufferInputStreamAdapter<std::vector<uint8_t>> input(buffer);
+			if (0 == chunkSize) {
+				input.read(data);
+			} else {
+				ChecksummedChunkInputStream chunkedInput(input);
+				chunkedInput.read(data);
+			}
+		}
+
+		// state.range(0) is chunk size (0 for unchunked)
+
+		void BenchmarkWrite(benchmark::State& state) {
+			auto chunkSize = static_cast<uint32_t>(state.range(0));
+			auto data = GenerateRandomData();
+
+			size_t outputSize = 0;
+			for (auto _ : state)
+				outputSize = Write(data, chunkSize).size();
+
+			state.SetBytesProcessed(static_cast<int64_t>(Data_Size * state.iterations()));
+			state.counters["output_size"] = static_cast<double>(outputSize);
+		}
+
+		void BenchmarkRead(benchmark::State& state) {
+			auto chunkSize = static_cast<uint32_t>(state.range(0));
+			auto data = GenerateRandomData();
+			auto buffer = Write(data, chunkSize);
+
+			for (auto _ : state)
+				Read(buffer, data, chunkSize);
+
+			state.SetBytesProcessed(static_cast<int64_t>(Data_Size * state.iterations()));
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	for (auto* pBenchmark : {
+		benchmark::RegisterBenchmark("BenchmarkWrite", bitxorcore::io::BenchmarkWrite),
+		benchmark::RegisterBenchmark("BenchmarkRead", bitxorcore::io::BenchmarkRead)
+	}) {
+		pBenchmark
+				->UseRealTime()
+				->Arg(0)
+				->Arg(64 * 1024)
+				->Arg(1024 * 1024)
+				->Arg(16 * 1024 * 1024);
+	}
+}
@@ -0,0 +1,222 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/model/ResolutionCache.h"
+#include "bitxorcore/model/ResolverContext.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <map>
+
+namespace bitxorcore { namespace model {
+
+	namespace {
+		constexpr uint64_t Namespace_Flag = 1ull << 63;
+		constexpr auto Num_Namespaces = 100'000u;
+		constexpr auto Num_Aliased_Recipients = 32u;
+		constexpr auto Aliased_Recipient_Percentage = 90u;
+
+		// approximate number of times a transfer recipient and token are resolved by validators, observers and receipts
+		constexpr auto Num_Address_Resolutions_Per_Transfer = 5u;
+		constexpr auto Num_Token_Resolutions_Per_Transfer = 4u;
+
+		enum class ResolutionCacheMode { Disabled, Enabled };
+
+		// region namespace state
+
+		// emulates the namespace cache lookups performed by the namespace plugin alias resolvers with a single ordered map lookup,
+		// which is cheaper than a real namespace cache lookup, so measured savings are a lower bound
+		class NamespaceState {
+		public:
+			NamespaceState() {
+				for (auto i = 0u; i < Num_Namespaces; ++i) {
+					Address address;
+					bench::FillWithRandomData(address);
+					m_addressAliases.emplace(Namespace_Flag | bench::Random(), address);
+					m_tokenAliases.emplace(Namespace_Flag | bench::Random(), TokenId(bench::Random()));
+				}
+
+				m_currencyTokenAlias = m_tokenAliases.cbegin()->first;
+			}
+
+		public:
+			UnresolvedTokenId currencyTokenAlias() const {
+				return UnresolvedTokenId(m_currencyTokenAlias);
+			}
+
+			std::vector<UnresolvedAddress> addressAliases(size_t count) const {
+				std::vector<UnresolvedAddress> aliases;
+				for (auto iter = m_addressAliases.cbegin(); aliases.size() < count; ++iter) {
+					UnresolvedAddress alias{};
+					alias[0] = 1;
+					std::memcpy(alias.data() + 1, &iter->first, sizeof(uint64_t));
+					aliases.push_back(alias);
+				}
+
+				return aliases;
+			}
+
+		public:
+			ResolverContext createResolverContext(ResolutionCacheMode mode) const {
+				// mirror PluginManager resolver chain (bypass resolver followed by namespace resolver)
+				using TokenResolver = std::function<bool (UnresolvedTokenId, TokenId&)>;
+				using AddressResolver = std::function<bool (const UnresolvedAddress&, Address&)>;
+				std::vector<TokenResolver> tokenResolvers{
+					[](auto unresolved, auto& resolved) {
+						if (0 != (Namespace_Flag & unresolved.unwrap()))
+							return false;
+
+						resolved = TokenId(unresolved.unwrap());
+						return true;
+					},
+					[this](auto unresolved, auto& resolved) {
+						auto iter = m_tokenAliases.find(unresolved.unwrap());
+						if (m_tokenAliases.cend() == iter)
+							return false;
+
+						resolved = iter->second;
+						return true;
+					}
+				};
+				std::vector<AddressResolver> addressResolvers{
+					[](const auto& unresolved, auto& resolved) {
+						if (0 != (1 & unresolved[0]))
+							return false;
+
+						resolved = unresolved.template copyTo<Address>();
+						return true;
+					},
+					[this](const auto& unresolved, auto& resolved) {
+						uint64_t namespaceId;
+						std::memcpy(static_cast<void*>(&namespaceId), unresolved.data() + 1, sizeof(uint64_t));
+						auto iter = m_addressAliases.find(namespaceId);
+						if (m_addressAliases.cend() == iter)
+							return false;
+
+						resolved = iter->second;
+						return true;
+					}
+				};
+
+				auto tokenResolver = [tokenResolvers](auto unresolved) {
+					TokenId resolved;
+					for (const auto& resolver : tokenResolvers) {
+						if (resolver(unresolved, resolved))
+							return resolved;
+					}
+
+					return ResolverContext().resolve(unresolved);
+				};
+				auto addressResolver = [addressResolvers](const auto& unresolved) {
+					Address resolved;
+					for (const auto& resolver : addressResolvers) {
+						if (resolver(unresolved, resolved))
+							return resolved;
+					}
+
+					return ResolverContext().resolve(unresolved);
+				};
+
+				return ResolverContext(
+						tokenResolver,
+						addressResolver,
+						ResolutionCacheMode::Enabled == mode ? std::make_shared<ResolutionCache>() : nullptr);
+			}
+
+		private:
+			std::map<uint64_t, Address> m_addressAliases;
+			std::map<uint64_t, TokenId> m_tokenAliases;
+			uint64_t m_currencyTokenAlias;
+		};
+
+		// endregion
+
+		std::vector<UnresolvedAddress> GenerateRecipients(const NamespaceState& namespaceState, size_t numTransfers) {
+			auto aliases = namespaceState.addressAliases(Num_Aliased_Recipients);
+
+			std::vector<UnresolvedAddress> recipients;
+			for (auto i = 0u; i < numTransfers; ++i) {
+				if (bench::Random() % 100 < Aliased_Recipient_Percentage) {
+					recipients.push_back(aliases[bench::Random() % aliases.size()]);
+				} else {
+					UnresolvedAddress recipient;
+					bench::FillWithRandomData(recipient);
+					recipient[0] = 0;
+					recipients.push_back(recipient);
+				}
+			}
+
+			return recipients;
+		}
+
+		// state.range(0) is number of transfers in block
+
+		template<ResolutionCacheMode Mode>
+		void BenchmarkResolveBlock(benchmark::State& state) {
+			NamespaceState namespaceState;
+			auto recipients = GenerateRecipients(namespaceState, static_cast<size_t>(state.range(0)));
+			auto currencyTokenAlias = namespaceState.currencyTokenAlias();
+
+			uint64_t numHits = 0;
+			uint64_t numMisses = 0;
+			for (auto _ : state) {
+				// resolver context is created once per block execution
+				auto resolverContext = namespaceState.createResolverContext(Mode);
+
+				for (const auto& recipient : recipients) {
+					for (auto i = 0u; i < Num_Address_Resolutions_Per_Transfer; ++i)
+						benchmark::DoNotOptimize(resolverContext.resolve(recipient));
+
+					for (auto i = 0u; i < Num_Token_Resolutions_Per_Transfer; ++i)
+						benchmark::DoNotOptimize(resolverContext.resolve(currencyTokenAlias));
+				}
+
+				if (resolverContext.resolutionCache()) {
+					numHits += resolverContext.resolutionCache()->statistics().NumHits;
+					numMisses += resolverContext.resolutionCache()->statistics().NumMisses;
+				}
+			}
+
+			state.counters["transfers"] = benchmark::Counter(
+					static_cast<double>(recipients.size() * static_cast<size_t>(state.iterations())),
+					benchmark::Counter::kIsRate);
+
+			if (0 != numHits + numMisses)
+				state.counters["hit%"] = 100.0 * static_cast<double>(numHits) / static_cast<double>(numHits + numMisses);
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace bitxorcore::model;
+
+	benchmark::RegisterBenchmark("BenchmarkResolveBlock<Disabled>", BenchmarkResolveBlock<ResolutionCacheMode::Disabled>)
+			->Arg(100)
+			->Arg(1'000)
+			->Arg(6'000);
+
+	benchmark::RegisterBenchmark("BenchmarkResolveBlock<Enabled>", BenchmarkResolveBlock<ResolutionCacheMode::Enabled>)
+			->Arg(100)
+			->Arg(1'000)
+			->Arg(6'000);
+}
@@ -0,0 +1,192 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "partialtransaction/src/chain/PtUpdater.h"
+#include "partialtransaction/src/chain/PtValidator.h"
+#include "plugins/txes/aggregate/src/model/AggregateTransaction.h"
+#include "bitxorcore/cache_tx/MemoryPtCache.h"
+#include "bitxorcore/model/WeakCosignedTransactionInfo.h"
+#include "bitxorcore/thread/FutureUtils.h"
+#include "bitxorcore/thread/IoThreadPool.h"
+#include "bitxorcore/utils/MemoryUtils.h"
+#include "bitxorcore/utils/RandomGenerator.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <thread>
+
+namespace bitxorcore { namespace chain {
+
+	namespace {
+		// accepts all partial transactions and completes them when all cosignatories have cosigned
+		class AllCosignatoriesPtValidator : public PtValidator {
+		public:
+			explicit AllCosignatoriesPtValidator(size_t numCosignatories) : m_numCosignatories(numCosignatories)
+			{}
+
+		public:
+			Result<bool> validatePartial(const model::WeakEntityInfoT<model::Transaction>&) const override {
+				return { validators::ValidationResult::Success, true };
+			}
+
+			Result<CosignatoriesValidationResult> validateCosignatories(
+					const model::WeakCosignedTransactionInfo& transactionInfo) const override {
+				auto isComplete = transactionInfo.cosignatures().size() >= m_numCosignatories;
+				return {
+					validators::ValidationResult::Success,
+					isComplete ? CosignatoriesValidationResult::Success : CosignatoriesValidationResult::Missing
+				};
+			}
+
+		private:
+			size_t m_numCosignatories;
+		};
+
+		std::shared_ptr<model::Transaction> CreateAggregateBondedTransaction() {
+			constexpr auto Transaction_Size = sizeof(model::AggregateTransaction);
+			auto pTransaction = utils::MakeSharedWithSize<model::AggregateTransaction>(Transaction_Size);
+			std::memset(static_cast<void*>(pTransaction.get()), 0, Transaction_Size);
+			pTransaction->Size = static_cast<uint32_t>(Transaction_Size);
+			pTransaction->Type = model::Entity_Type_Aggregate_Bonded;
+			bench::FillWithRandomData(pTransaction->SignerPublicKey);
+			return pTransaction;
+		}
+
+		std::vector<model::DetachedCosignature> CreateCosignatures(const Hash256& aggregateHash, size_t numCosignatures) {
+			std::vector<model::DetachedCosignature> cosignatures;
+			for (auto i = 0u; i < numCosignatures; ++i) {
+				auto keyPair = crypto::KeyPair::FromPrivate(crypto::PrivateKey::Generate(bench::RandomByte));
+
+				Signature signature;
+				crypto::Sign(keyPair, aggregateHash, signature);
+				cosignatures.emplace_back(keyPair.publicKey(), signature, aggregateHash);
+			}
+
+			return cosignatures;
+		}
+
+		class BenchContext {
+		public:
+			explicit BenchContext(size_t numCosignatures)
+					: m_transactionsCache(cache::MemoryCacheOptions(utils::FileSize::FromMegabytes(1), utils::FileSize::FromMegabytes(16)))
+					, m_pPool(thread::CreateIoThreadPool(std::thread::hardware_concurrency(), "bench"))
+					, m_numCompletedTransactions(0) {
+				m_pPool->start();
+				m_pUpdater = std::make_unique<PtUpdater>(
+						m_transactionsCache,
+						std::make_unique<AllCosignatoriesPtValidator>(numCosignatures),
+						[this](auto&&) { ++m_numCompletedTransactions; },
+						[](const auto&, const auto&, auto) {},
+						[](auto* pOut, auto count) {
+							utils::HighEntropyRandomGenerator().fill(pOut, count);
+						},
+						*m_pPool);
+
+				m_transactionInfo = model::TransactionInfo(CreateAggregateBondedTransaction());
+				bench::FillWithRandomData(m_transactionInfo.EntityHash);
+				m_cosignatures = CreateCosignatures(m_transactionInfo.EntityHash, numCosignatures);
+			}
+
+			~BenchContext() {
+				m_pUpdater.reset();
+				m_pPool->join();
+			}
+
+		public:
+			const std::vector<model::DetachedCosignature>& cosignatures() const {
+				return m_cosignatures;
+			}
+
+			size_t numCompletedTransactions() const {
+				return m_numCompletedTransactions;
+			}
+
+			PtUpdater& updater() {
+				return *m_pUpdater;
+			}
+
+		public:
+			void addTransaction() {
+				m_pUpdater->update(m_transactionInfo).get();
+			}
+
+		private:
+			cache::MemoryPtCacheProxy m_transactionsCache;
+			std::unique_ptr<thread::IoThreadPool> m_pPool;
+			std::atomic<size_t> m_numCompletedTransactions;
+			std::unique_ptr<PtUpdater> m_pUpdater;
+			model::TransactionInfo m_transactionInfo;
+			std::vector<model::DetachedCosignature> m_cosignatures;
+		};
+
+		// state.range(0) is number of cosignatures pushed for a single aggregate
+
+		void BenchmarkIndividualCosignatureIngestion(benchmark::State& state) {
+			BenchContext context(static_cast<size_t>(state.range(0)));
+			for (auto _ : state) {
+				state.PauseTiming();
+				context.addTransaction();
+				state.ResumeTiming();
+
+				std::vector<thread::future<CosignatureUpdateResult>> futures;
+				for (const auto& cosignature : context.cosignatures())
+					futures.push_back(context.updater().update(cosignature));
+
+				thread::get_all(std::move(futures));
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(context.cosignatures().size() * state.iterations()));
+			state.counters["completed"] = static_cast<double>(context.numCompletedTransactions());
+		}
+
+		void BenchmarkBatchCosignatureIngestion(benchmark::State& state) {
+			BenchContext context(static_cast<size_t>(state.range(0)));
+			for (auto _ : state) {
+				state.PauseTiming();
+				context.addTransaction();
+				state.ResumeTiming();
+
+				context.updater().update(context.cosignatures()).get();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(context.cosignatures().size() * state.iterations()));
+			state.counters["completed"] = static_cast<double>(context.numCompletedTransactions());
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace bitxorcore::chain;
+
+	benchmark::RegisterBenchmark("BenchmarkIndividualCosignatureIngestion", BenchmarkIndividualCosignatureIngestion)
+			->UseRealTime()
+			->Arg(32)
+			->Arg(256)
+			->Arg(1'024);
+
+	benchmark::RegisterBenchmark("BenchmarkBatchCosignatureIngestion", BenchmarkBatchCosignatureIngestion)
+			->UseRealTime()
+			->Arg(32)
+			->Arg(256)
+			->Arg(1'024);
+}
@@ -0,0 +1,343 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/cache/BitxorCoreCache.h"
+#include "bitxorcore/model/Notifications.h"
+#include "bitxorcore/observers/AggregateObserverBuilder.h"
+#include "bitxorcore/observers/DemuxObserverBuilder.h"
+#include "bitxorcore/validators/AggregateValidatorBuilder.h"
+#include "bitxorcore/validators/DemuxValidatorBuilder.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <array>
+#include <utility>
+
+namespace bitxorcore { namespace plugins {
+
+	namespace {
+		// notification types are split into types published by all transactions (e.g. signature, balance debit)
+		// and types published only by transactions of a single plugin
+		constexpr auto Num_Common_Notification_Types = 8u;
+		constexpr auto Num_Plugins = 10u;
+		constexpr auto Num_Notification_Types_Per_Plugin = 4u;
+		constexpr auto Num_Notification_Types = Num_Common_Notification_Types + Num_Plugins * Num_Notification_Types_Per_Plugin;
+
+		constexpr auto Num_Observers_Per_Notification_Type = 2u;
+		constexpr auto Num_Validators_Per_Notification_Type = 3u;
+		constexpr auto Num_Universal_Observers = 3u;
+		constexpr auto Num_Universal_Validators = 2u;
+
+		// region notifications
+
+		template<uint16_t Code>
+		struct BenchNotification : public model::Notification {
+		public:
+			static constexpr auto Notification_Type = model::MakeNotificationType(
+					model::NotificationChannel::All,
+					model::FacilityCode::Core,
+					static_cast<uint16_t>(0x8000 | Code));
+
+		public:
+			BenchNotification() : Notification(Notification_Type, sizeof(BenchNotification))
+			{}
+		};
+
+		using NotificationPointer = std::unique_ptr<model::Notification>;
+		using NotificationFactory = NotificationPointer (*)();
+
+		template<uint16_t... Codes>
+		constexpr std::array<NotificationFactory, sizeof...(Codes)> CreateNotificationFactories(
+				std::integer_sequence<uint16_t, Codes...>) {
+			return { { []() -> NotificationPointer { return std::make_unique<BenchNotification<Codes>>(); }... } };
+		}
+
+		// simulates notifications published by a block with \a numTransactions transactions of random plugins
+		std::vector<NotificationPointer> GenerateBlockNotifications(size_t numTransactions) {
+			auto factories = CreateNotificationFactories(std::make_integer_sequence<uint16_t, Num_Notification_Types>());
+
+			std::vector<NotificationPointer> notifications;
+			for (auto i = 0u; i < numTransactions; ++i) {
+				for (auto j = 0u; j < Num_Common_Notification_Types; ++j)
+					notifications.push_back(factories[j]());
+
+				auto pluginId = bench::Random() % Num_Plugins;
+				for (auto j = 0u; j < Num_Notification_Types_Per_Plugin; ++j)
+					notifications.push_back(factories[Num_Common_Notification_Types + pluginId * Num_Notification_Types_Per_Plugin + j]());
+			}
+
+			return notifications;
+		}
+
+		// endregion
+
+		// region observers / validators
+
+		template<typename TNotification>
+		class CountingObserver : public observers::NotificationObserverT<TNotification> {
+		public:
+			explicit CountingObserver(uint64_t& counter)
+					: m_name("CountingObserver")
+					, m_counter(counter)
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			void notify(const TNotification&, observers::ObserverContext&) const override {
+				++m_counter;
+			}
+
+		private:
+			std::string m_name;
+			uint64_t& m_counter;
+		};
+
+		template<typename TNotification>
+		class CountingValidator : public validators::stateless::NotificationValidatorT<TNotification> {
+		public:
+			explicit CountingValidator(uint64_t& counter)
+					: m_name("CountingValidator")
+					, m_counter(counter)
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			validators::ValidationResult validate(const TNotification&) const override {
+				++m_counter;
+				return validators::ValidationResult::Success;
+			}
+
+		private:
+			std::string m_name;
+			uint64_t& m_counter;
+		};
+
+		// endregion
+
+		// region linear demux (reference)
+
+		// reference implementation that wraps every typed observer and validator in a predicate
+		// and forwards every notification to all of them
+
+		template<typename TNotification>
+		bool IsMatchingNotification(const model::Notification& notification) {
+			return model::AreEqualExcludingChannel(TNotification::Notification_Type, notification.Type);
+		}
+
+		template<typename TNotification>
+		class ConditionalObserver : public observers::NotificationObserver {
+		public:
+			explicit ConditionalObserver(observers::NotificationObserverPointerT<TNotification>&& pObserver)
+					: m_pObserver(std::move(pObserver))
+					, m_predicate(IsMatchingNotification<TNotification>)
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_pObserver->name();
+			}
+
+			void notify(const model::Notification& notification, observers::ObserverContext& context) const override {
+				if (m_predicate(notification))
+					m_pObserver->notify(static_cast<const TNotification&>(notification), context);
+			}
+
+		private:
+			observers::NotificationObserverPointerT<TNotification> m_pObserver;
+			predicate<const model::Notification&> m_predicate;
+		};
+
+		template<typename TNotification>
+		class ConditionalValidator : public validators::stateless::NotificationValidator {
+		public:
+			explicit ConditionalValidator(validators::stateless::NotificationValidatorPointerT<TNotification>&& pValidator)
+					: m_pValidator(std::move(pValidator))
+					, m_predicate(IsMatchingNotification<TNotification>)
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_pValidator->name();
+			}
+
+			validators::ValidationResult validate(const model::Notification& notification) const override {
+				return m_predicate(notification)
+						? m_pValidator->validate(static_cast<const TNotification&>(notification))
+						: validators::ValidationResult::Success;
+			}
+
+		private:
+			validators::stateless::NotificationValidatorPointerT<TNotification> m_pValidator;
+			predicate<const model::Notification&> m_predicate;
+		};
+
+		class LinearDemuxBuilders {
+		public:
+			template<typename TNotification>
+			void addObserver(observers::NotificationObserverPointerT<TNotification>&& pObserver) {
+				if constexpr (std::is_same_v<model::Notification, TNotification>)
+					m_observerBuilder.add(std::move(pObserver));
+				else
+					m_observerBuilder.add(std::make_unique<ConditionalObserver<TNotification>>(std::move(pObserver)));
+			}
+
+			template<typename TNotification>
+			void addValidator(validators::stateless::NotificationValidatorPointerT<TNotification>&& pValidator) {
+				if constexpr (std::is_same_v<model::Notification, TNotification>)
+					m_validatorBuilder.add(std::move(pValidator));
+				else
+					m_validatorBuilder.add(std::make_unique<ConditionalValidator<TNotification>>(std::move(pValidator)));
+			}
+
+		public:
+			auto buildObserver() {
+				return m_observerBuilder.build();
+			}
+
+			auto buildValidator() {
+				return m_validatorBuilder.build([](auto) { return false; });
+			}
+
+		private:
+			observers::AggregateObserverBuilder<model::Notification> m_observerBuilder;
+			validators::AggregateValidatorBuilder<model::Notification> m_validatorBuilder;
+		};
+
+		// endregion
+
+		// region table demux
+
+		class TableDemuxBuilders {
+		public:
+			template<typename TNotification>
+			void addObserver(observers::NotificationObserverPointerT<TNotification>&& pObserver) {
+				m_observerBuilder.add(std::move(pObserver));
+			}
+
+			template<typename TNotification>
+			void addValidator(validators::stateless::NotificationValidatorPointerT<TNotification>&& pValidator) {
+				m_validatorBuilder.add(std::move(pValidator));
+			}
+
+		public:
+			auto buildObserver() {
+				return m_observerBuilder.build();
+			}
+
+			auto buildValidator() {
+				return m_validatorBuilder.build([](auto) { return false; });
+			}
+
+		private:
+			observers::DemuxObserverBuilder m_observerBuilder;
+			validators::stateless::DemuxValidatorBuilder m_validatorBuilder;
+		};
+
+		// endregion
+
+		// region registration
+
+		struct Counters {
+			uint64_t NumObserverCalls = 0;
+			uint64_t NumValidatorCalls = 0;
+		};
+
+		template<typename TNotification, typename TBuilders>
+		void AddHandlers(TBuilders& builders, Counters& counters, size_t numObservers, size_t numValidators) {
+			for (auto i = 0u; i < numObservers; ++i)
+				builders.template addObserver<TNotification>(std::make_unique<CountingObserver<TNotification>>(counters.NumObserverCalls));
+
+			for (auto i = 0u; i < numValidators; ++i) {
+				builders.template addValidator<TNotification>(
+						std::make_unique<CountingValidator<TNotification>>(counters.NumValidatorCalls));
+			}
+		}
+
+		template<typename TBuilders, uint16_t... Codes>
+		void AddAllHandlers(TBuilders& builders, Counters& counters, std::integer_sequence<uint16_t, Codes...>) {
+			// mirror plugin manager registration where some handlers process all notifications
+			AddHandlers<model::Notification>(builders, counters, Num_Universal_Observers, Num_Universal_Validators);
+			(AddHandlers<BenchNotification<Codes>>(
+					builders,
+					counters,
+					Num_Observers_Per_Notification_Type,
+					Num_Validators_Per_Notification_Type), ...);
+		}
+
+		// endregion
+
+		// state.range(0) is number of transactions in block
+
+		template<typename TBuilders>
+		void BenchmarkBlockExecution(benchmark::State& state) {
+			Counters counters;
+			TBuilders builders;
+			AddAllHandlers(builders, counters, std::make_integer_sequence<uint16_t, Num_Notification_Types>());
+			auto pValidator = builders.buildValidator();
+			auto pObserver = builders.buildObserver();
+
+			auto notifications = GenerateBlockNotifications(static_cast<size_t>(state.range(0)));
+
+			cache::BitxorCoreCache cache({});
+			auto cacheDelta = cache.createDelta();
+			auto observerState = observers::ObserverState(cacheDelta);
+			auto context = observers::ObserverContext(
+					model::NotificationContext(Height(1), model::ResolverContext()),
+					observerState,
+					observers::NotifyMode::Commit);
+
+			for (auto _ : state) {
+				// validate all notifications before observing any of them, like block execution
+				for (const auto& pNotification : notifications)
+					benchmark::DoNotOptimize(pValidator->validate(*pNotification));
+
+				for (const auto& pNotification : notifications)
+					pObserver->notify(*pNotification, context);
+			}
+
+			auto numNotifications = static_cast<double>(notifications.size() * static_cast<size_t>(state.iterations()));
+			state.counters["notifications"] = benchmark::Counter(numNotifications, benchmark::Counter::kIsRate);
+			state.counters["observer_calls"] = static_cast<double>(counters.NumObserverCalls) / static_cast<double>(state.iterations());
+			state.counters["validator_calls"] = static_cast<double>(counters.NumValidatorCalls) / static_cast<double>(state.iterations());
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace bitxorcore::plugins;
+
+	benchmark::RegisterBenchmark("BenchmarkBlockExecution<Linear>", BenchmarkBlockExecution<LinearDemuxBuilders>)
+			->Arg(100)
+			->Arg(1'000)
+			->Arg(6'000);
+
+	benchmark::RegisterBenchmark("BenchmarkBlockExecution<Table>", BenchmarkBlockExecution<TableDemuxBuilders>)
+			->Arg(100)
+			->Arg(1'000)
+			->Arg(6'000);
+}
@@ -0,0 +1,210 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/cache/MultisigCache.h"
+#include "src/cache/MultisigCacheStorage.h"
+#include "src/cache/MultisigCacheUtils.h"
+#include "src/validators/Validators.h"
+#include "bitxorcore/cache/BitxorCoreCache.h"
+#include "bitxorcore/cache/ReadOnlyBitxorCoreCache.h"
+#include "bitxorcore/cache/SubCachePluginAdapter.h"
+#include "bitxorcore/validators/ValidatorContext.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace bitxorcore { namespace validators {
+
+	namespace {
+		constexpr auto Num_Trees = 100u;
+		constexpr auto Num_Aggregates_Per_Block = 1'000u;
+		constexpr uint8_t Max_Multisig_Depth = 0xFF;
+
+		enum class MemoMode { Disabled, Enabled };
+
+		// region multisig forest
+
+		struct MultisigTree {
+			Address Root;
+			std::vector<Address> DeepestMultisigs;
+		};
+
+		Address GenerateRandomAddress() {
+			Address address;
+			bench::FillWithRandomData(address);
+			return address;
+		}
+
+		state::MultisigEntry& GetOrCreateEntry(cache::MultisigCacheDelta& multisigCache, const Address& address) {
+			if (!multisigCache.contains(address))
+				multisigCache.insert(state::MultisigEntry(address));
+
+			return multisigCache.find(address).get();
+		}
+
+		void AddCosignatory(cache::MultisigCacheDelta& multisigCache, const Address& multisig, const Address& cosignatory) {
+			GetOrCreateEntry(multisigCache, multisig).cosignatoryAddresses().insert(cosignatory);
+			GetOrCreateEntry(multisigCache, cosignatory).multisigAddresses().insert(multisig);
+		}
+
+		// creates a custodian tree with \a depth multisig levels where every multisig account has \a fanout cosignatories
+		MultisigTree AddTree(cache::MultisigCacheDelta& multisigCache, size_t depth, size_t fanout) {
+			MultisigTree tree;
+			tree.Root = GenerateRandomAddress();
+
+			std::vector<Address> currentLevel{ tree.Root };
+			for (auto level = 0u; level < depth; ++level) {
+				std::vector<Address> nextLevel;
+				for (const auto& multisig : currentLevel) {
+					for (auto i = 0u; i < fanout; ++i) {
+						nextLevel.push_back(GenerateRandomAddress());
+						AddCosignatory(multisigCache, multisig, nextLevel.back());
+					}
+				}
+
+				if (depth - 1 == level)
+					tree.DeepestMultisigs = currentLevel;
+
+				currentLevel = std::move(nextLevel);
+			}
+
+			return tree;
+		}
+
+		cache::BitxorCoreCache CreateCache() {
+			std::vector<std::unique_ptr<cache::SubCachePlugin>> subCaches(cache::MultisigCache::Id + 1);
+			using PluginAdapter = cache::SubCachePluginAdapter<cache::MultisigCache, cache::MultisigCacheStorage>;
+			subCaches[cache::MultisigCache::Id] = std::make_unique<PluginAdapter>(
+					std::make_unique<cache::MultisigCache>(cache::CacheConfiguration()));
+			return cache::BitxorCoreCache(std::move(subCaches));
+		}
+
+		std::vector<MultisigTree> AddForest(cache::BitxorCoreCache& cache, size_t depth, size_t fanout) {
+			std::vector<MultisigTree> trees;
+			auto cacheDelta = cache.createDelta();
+			auto& multisigCache = cacheDelta.sub<cache::MultisigCache>();
+			for (auto i = 0u; i < Num_Trees; ++i)
+				trees.push_back(AddTree(multisigCache, depth, fanout));
+
+			cache.commit(Height(1));
+			return trees;
+		}
+
+		// endregion
+
+		// region aggregate validation
+
+		struct AggregateValidationInputs {
+			const MultisigTree* pSignerTree;
+			Address Top;
+			Address Bottom;
+		};
+
+		std::vector<AggregateValidationInputs> GenerateBlockInputs(const std::vector<MultisigTree>& trees) {
+			std::vector<AggregateValidationInputs> inputs;
+			for (auto i = 0u; i < Num_Aggregates_Per_Block; ++i) {
+				// custodians repeatedly sign on behalf of a small number of trees
+				const auto& signerTree = trees[bench::Random() % trees.size()];
+				const auto& attachedTree = trees[bench::Random() % trees.size()];
+				const auto& top = signerTree.DeepestMultisigs[bench::Random() % signerTree.DeepestMultisigs.size()];
+				inputs.push_back({ &signerTree, top, attachedTree.Root });
+			}
+
+			return inputs;
+		}
+
+		// emulates the eligible cosignatories check for an aggregate signed on behalf of \a multisig
+		size_t CountEligibleCosignatories(const cache::MultisigCache::CacheReadOnlyType& multisigCache, const Address& multisig) {
+			size_t numEligible = 0;
+			for (const auto& address : cache::FindDescendantClosure(multisigCache, multisig)->Addresses) {
+				auto multisigIter = multisigCache.find(address);
+				if (!multisigIter.tryGet() || multisigIter.get().cosignatoryAddresses().empty())
+					++numEligible;
+			}
+
+			return numEligible;
+		}
+
+		// state.range(0) is multisig depth of each tree
+		// state.range(1) is number of cosignatories of each multisig account
+
+		template<MemoMode Mode>
+		void BenchmarkAggregateValidation(benchmark::State& state) {
+			auto cache = CreateCache();
+			auto trees = AddForest(cache, static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1)));
+			auto inputs = GenerateBlockInputs(trees);
+
+			auto pValidator = CreateMultisigLoopAndLevelValidator(Max_Multisig_Depth);
+			model::ResolverContext resolvers;
+			model::NetworkInfo network;
+
+			uint64_t numHits = 0;
+			uint64_t numMisses = 0;
+			for (auto _ : state) {
+				// closures are memoized per block delta, so the memo is recreated for each block
+				auto cacheDelta = cache.createDelta();
+				auto cacheView = cache.createView();
+				auto readOnlyCache = MemoMode::Enabled == Mode ? cacheDelta.toReadOnly() : cacheView.toReadOnly();
+				auto context = ValidatorContext(model::NotificationContext(Height(2), resolvers), Timestamp(), network, readOnlyCache);
+				const auto& multisigCache = readOnlyCache.sub<cache::MultisigCache>();
+
+				for (const auto& input : inputs) {
+					benchmark::DoNotOptimize(CountEligibleCosignatories(multisigCache, input.pSignerTree->Root));
+
+					auto notification = model::MultisigNewCosignatoryNotification(input.Top, input.Bottom.copyTo<UnresolvedAddress>());
+					benchmark::DoNotOptimize(pValidator->validate(notification, context));
+				}
+
+				if (multisigCache.graphCache()) {
+					numHits += multisigCache.graphCache()->statistics().NumHits;
+					numMisses += multisigCache.graphCache()->statistics().NumMisses;
+				}
+			}
+
+			state.counters["aggregates"] = benchmark::Counter(
+					static_cast<double>(inputs.size() * static_cast<size_t>(state.iterations())),
+					benchmark::Counter::kIsRate);
+
+			if (0 != numHits + numMisses)
+				state.counters["hit%"] = 100.0 * static_cast<double>(numHits) / static_cast<double>(numHits + numMisses);
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace bitxorcore::validators;
+
+	// wide (few levels with many cosignatories) and deep (many levels with few cosignatories) custodian trees
+	benchmark::RegisterBenchmark("BenchmarkAggregateValidation<Disabled>", BenchmarkAggregateValidation<MemoMode::Disabled>)
+			->Args({ 1, 32 })
+			->Args({ 2, 16 })
+			->Args({ 3, 6 })
+			->Args({ 6, 2 });
+
+	benchmark::RegisterBenchmark("BenchmarkAggregateValidation<Enabled>", BenchmarkAggregateValidation<MemoMode::Enabled>)
+			->Args({ 1, 32 })
+			->Args({ 2, 16 })
+			->Args({ 3, 6 })
+			->Args({ 6, 2 });
+}
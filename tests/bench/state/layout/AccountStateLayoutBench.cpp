@@ -0,0 +1,219 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/state/PackedAccountState.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+// region allocation tracking
+
+// all allocations are prefixed with their size so that the number of live heap bytes can be tracked
+// (allocator bookkeeping overhead is not included, so reported footprints are lower bounds)
+
+namespace {
+	constexpr size_t Allocation_Prefix_Size = alignof(std::max_align_t);
+
+	std::atomic<size_t> g_numLiveBytes;
+	std::atomic<size_t> g_numLiveAllocations;
+}
+
+void* operator new(size_t size) {
+	auto* pAllocation = static_cast<uint8_t*>(std::malloc(size + Allocation_Prefix_Size));
+	if (!pAllocation)
+		throw std::bad_alloc();
+
+	*reinterpret_cast<size_t*>(pAllocation) = size;
+	g_numLiveBytes += size;
+	++g_numLiveAllocations;
+	return pAllocation + Allocation_Prefix_Size;
+}
+
+void operator delete(void* pData) noexcept {
+	if (!pData)
+		return;
+
+	auto* pAllocation = static_cast<uint8_t*>(pData) - Allocation_Prefix_Size;
+	g_numLiveBytes -= *reinterpret_cast<size_t*>(pAllocation);
+	--g_numLiveAllocations;
+	std::free(pAllocation);
+}
+
+void operator delete(void* pData, size_t) noexcept {
+	operator delete(pData);
+}
+
+// endregion
+
+namespace bitxorcore { namespace state {
+
+	namespace {
+		constexpr auto Harvesting_Token_Id = TokenId(1);
+		constexpr auto High_Value_Account_Interval = 100u;
+
+		// region account generation
+
+		AccountState CreateAccountState(size_t index) {
+			Address address;
+			bench::FillWithRandomData(address);
+
+			AccountState accountState(address, Height(1));
+			accountState.Balances.optimize(Harvesting_Token_Id);
+
+			// most accounts own a few tokens, some accounts are high value and have importance information
+			auto numTokens = 1 + index % 3;
+			for (auto i = 0u; i < numTokens; ++i)
+				accountState.Balances.credit(TokenId(Harvesting_Token_Id.unwrap() + i), Amount(bench::Random() % 1'000'000 + 1));
+
+			if (0 != index % High_Value_Account_Interval)
+				return accountState;
+
+			for (auto i = 0u; i < Importance_History_Size; ++i)
+				accountState.ImportanceSnapshots.set(Importance(bench::Random() % 1'000'000), model::ImportanceHeight(i + 1));
+
+			for (auto i = 0u; i < Activity_Bucket_History_Size; ++i) {
+				accountState.ActivityBuckets.update(model::ImportanceHeight(i + 1), [](auto& bucket) {
+					bucket.TotalFeesPaid = Amount(bench::Random() % 1'000);
+					bucket.BeneficiaryCount = 1;
+				});
+			}
+
+			return accountState;
+		}
+
+		struct RegularLayoutTraits {
+			using ValueType = AccountState;
+
+			static ValueType Create(size_t index) {
+				return CreateAccountState(index);
+			}
+
+			static Amount GetHarvestingBalance(const ValueType& accountState) {
+				return accountState.Balances.get(Harvesting_Token_Id);
+			}
+
+			static Importance GetCurrentImportance(const ValueType& accountState) {
+				return accountState.ImportanceSnapshots.current();
+			}
+		};
+
+		struct PackedLayoutTraits {
+			using ValueType = PackedAccountState;
+
+			static ValueType Create(size_t index) {
+				return PackedAccountState(CreateAccountState(index));
+			}
+
+			static Amount GetHarvestingBalance(const ValueType& accountState) {
+				return accountState.balance(Harvesting_Token_Id);
+			}
+
+			static Importance GetCurrentImportance(const ValueType& accountState) {
+				return accountState.currentImportance();
+			}
+		};
+
+		template<typename TTraits>
+		std::vector<typename TTraits::ValueType> CreateAccountStates(size_t numAccounts) {
+			std::vector<typename TTraits::ValueType> accountStates;
+			accountStates.reserve(numAccounts);
+			for (auto i = 0u; i < numAccounts; ++i)
+				accountStates.push_back(TTraits::Create(i));
+
+			return accountStates;
+		}
+
+		// endregion
+
+		// state.range(0) is number of accounts
+
+		template<typename TTraits>
+		void BenchmarkMemoryFootprint(benchmark::State& state) {
+			auto numAccounts = static_cast<size_t>(state.range(0));
+
+			size_t numBytes = 0;
+			size_t numAllocations = 0;
+			for (auto _ : state) {
+				auto numLiveBytes = g_numLiveBytes.load();
+				auto numLiveAllocations = g_numLiveAllocations.load();
+
+				auto accountStates = CreateAccountStates<TTraits>(numAccounts);
+				numBytes = g_numLiveBytes - numLiveBytes;
+				numAllocations = g_numLiveAllocations - numLiveAllocations;
+
+				benchmark::DoNotOptimize(accountStates.data());
+			}
+
+			state.counters["bytes_per_account"] = static_cast<double>(numBytes) / static_cast<double>(numAccounts);
+			state.counters["allocations_per_account"] = static_cast<double>(numAllocations) / static_cast<double>(numAccounts);
+			state.counters["total_mb"] = static_cast<double>(numBytes) / (1024.0 * 1024.0);
+		}
+
+		template<typename TTraits>
+		void BenchmarkIterate(benchmark::State& state) {
+			auto accountStates = CreateAccountStates<TTraits>(static_cast<size_t>(state.range(0)));
+
+			for (auto _ : state) {
+				// emulate the account scan performed by importance calculation
+				Amount totalBalance;
+				Importance totalImportance;
+				for (const auto& accountState : accountStates) {
+					totalBalance = totalBalance + TTraits::GetHarvestingBalance(accountState);
+					totalImportance = totalImportance + TTraits::GetCurrentImportance(accountState);
+				}
+
+				benchmark::DoNotOptimize(totalBalance);
+				benchmark::DoNotOptimize(totalImportance);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace bitxorcore::state;
+
+	benchmark::RegisterBenchmark("BenchmarkMemoryFootprint<Regular>", BenchmarkMemoryFootprint<RegularLayoutTraits>)
+			->Iterations(1)
+			->Arg(1'000'000)
+			->Arg(10'000'000)
+			->Unit(benchmark::kMillisecond);
+
+	benchmark::RegisterBenchmark("BenchmarkMemoryFootprint<Packed>", BenchmarkMemoryFootprint<PackedLayoutTraits>)
+			->Iterations(1)
+			->Arg(1'000'000)
+			->Arg(10'000'000)
+			->Unit(benchmark::kMillisecond);
+
+	benchmark::RegisterBenchmark("BenchmarkIterate<Regular>", BenchmarkIterate<RegularLayoutTraits>)
+			->Arg(1'000'000)
+			->Unit(benchmark::kMillisecond);
+
+	benchmark::RegisterBenchmark("BenchmarkIterate<Packed>", BenchmarkIterate<PackedLayoutTraits>)
+			->Arg(1'000'000)
+			->Unit(benchmark::kMillisecond);
+}
@@ -0,0 +1,140 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "sync/src/TransactionSpamThrottle.h"
+#include "bitxorcore/cache/BitxorCoreCache.h"
+#include "bitxorcore/cache/ReadOnlyBitxorCoreCache.h"
+#include "bitxorcore/cache_core/AccountStateCache.h"
+#include "bitxorcore/cache_core/AccountStateCacheSubCachePlugin.h"
+#include "bitxorcore/cache_tx/MemoryUtCache.h"
+#include "bitxorcore/model/EntityInfo.h"
+#include "bitxorcore/utils/MemoryUtils.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <cstring>
+
+namespace bitxorcore { namespace sync {
+
+	namespace {
+		constexpr auto Importance_Grouping = 100u;
+		constexpr auto Max_Transactions_Per_Block = 1'000u;
+		constexpr auto Transaction_Size = sizeof(model::Transaction);
+
+		cache::BitxorCoreCache CreateBitxorCoreCache() {
+			cache::AccountStateCacheTypes::Options options;
+			options.NetworkIdentifier = model::NetworkIdentifier::Testnet;
+			options.ImportanceGrouping = Importance_Grouping;
+			options.VotingSetGrouping = 1;
+
+			std::vector<std::unique_ptr<cache::SubCachePlugin>> subCaches(cache::AccountStateCache::Id + 1);
+			subCaches[cache::AccountStateCache::Id] = std::make_unique<cache::AccountStateCacheSubCachePlugin>(
+					cache::CacheConfiguration(),
+					options);
+			return cache::BitxorCoreCache(std::move(subCaches));
+		}
+
+		Key GenerateRandomKey() {
+			Key key;
+			bench::FillWithRandomData(key);
+			return key;
+		}
+
+		std::vector<Key> SeedAccounts(cache::BitxorCoreCache& bitxorcoreCache, size_t count) {
+			std::vector<Key> publicKeys;
+			auto delta = bitxorcoreCache.createDelta();
+			auto& accountStateCacheDelta = delta.sub<cache::AccountStateCache>();
+			for (auto i = 0u; i < count; ++i) {
+				publicKeys.push_back(GenerateRandomKey());
+				accountStateCacheDelta.addAccount(publicKeys.back(), Height(1));
+				auto& accountState = accountStateCacheDelta.find(publicKeys.back()).get();
+				accountState.ImportanceSnapshots.set(Importance(bench::Random() % 1'000), model::ImportanceHeight(1));
+			}
+
+			bitxorcoreCache.commit(Height(1));
+			return publicKeys;
+		}
+
+		model::TransactionInfo CreateTransactionInfo(const Key& signer) {
+			auto pTransaction = utils::MakeSharedWithSize<model::Transaction>(Transaction_Size);
+			std::memset(static_cast<void*>(pTransaction.get()), 0, Transaction_Size);
+			pTransaction->Size = static_cast<uint32_t>(Transaction_Size);
+			pTransaction->SignerPublicKey = signer;
+			pTransaction->MaxFee = Amount(bench::Random() % 1'000);
+
+			model::TransactionInfo transactionInfo(std::move(pTransaction));
+			bench::FillWithRandomData(transactionInfo.EntityHash);
+			return transactionInfo;
+		}
+
+		void BenchmarkSpamFromManySigners(benchmark::State& state) {
+			// Arrange: every transaction passes through the importance-weighted path because the cache holds more
+			//          transactions than fit in a single block
+			auto numSigners = static_cast<size_t>(state.range(0));
+			auto bitxorcoreCache = CreateBitxorCoreCache();
+			auto signers = SeedAccounts(bitxorcoreCache, numSigners);
+			auto cacheView = bitxorcoreCache.createView();
+			auto readOnlyCache = cacheView.toReadOnly();
+
+			auto maxCacheSize = utils::FileSize::FromBytes(100 * Max_Transactions_Per_Block * Transaction_Size);
+			cache::MemoryUtCacheProxy transactionsCache(cache::MemoryCacheOptions(utils::FileSize(), maxCacheSize));
+			auto modifier = transactionsCache.modifier();
+			for (auto i = 0u; i < Max_Transactions_Per_Block; ++i)
+				modifier.add(CreateTransactionInfo(signers[i % numSigners]));
+
+			std::vector<model::TransactionInfo> transactionInfos;
+			for (auto i = 0u; i < 10'000; ++i)
+				transactionInfos.push_back(CreateTransactionInfo(signers[bench::Random() % numSigners]));
+
+			SpamThrottleConfiguration config(Amount(1'000), Importance(1'000'000), maxCacheSize, Max_Transactions_Per_Block);
+			SpamThrottleStatistics statistics;
+			auto throttle = CreateTransactionSpamThrottle(config, [](const auto&) { return false; }, statistics);
+			chain::UtUpdater::ThrottleContext throttleContext{
+				chain::UtUpdater::TransactionSource::New,
+				Height(2),
+				0,
+				readOnlyCache,
+				modifier
+			};
+
+			// Act:
+			size_t index = 0;
+			for (auto _ : state) {
+				benchmark::DoNotOptimize(throttle(transactionInfos[index], throttleContext));
+				index = (index + 1) % transactionInfos.size();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+			state.counters["hit%"] = 100.0 * static_cast<double>(statistics.NumImportanceCacheHits)
+					/ static_cast<double>(statistics.NumImportanceCacheHits + statistics.NumImportanceCacheMisses);
+			state.counters["throttled%"] = 100.0 * static_cast<double>(statistics.NumThrottled)
+					/ static_cast<double>(state.iterations());
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	benchmark::RegisterBenchmark("BenchmarkSpamFromManySigners", bitxorcore::sync::BenchmarkSpamFromManySigners)
+			->Arg(100)
+			->Arg(10'000)
+			->Arg(100'000);
+}
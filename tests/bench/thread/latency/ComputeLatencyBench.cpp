@@ -0,0 +1,227 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/crypto/Signer.h"
+#include "bitxorcore/thread/ComputeThreadPool.h"
+#include "bitxorcore/thread/IoThreadPool.h"
+#include "bitxorcore/thread/ParallelFor.h"
+#include "bitxorcore/utils/Logging.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <boost/asio.hpp>
+#include <chrono>
+
+namespace bitxorcore { namespace thread {
+
+	namespace {
+		constexpr auto Num_Signatures = 4096;
+		constexpr auto Data_Size = 279;
+
+		// region VerifyItem
+
+		struct VerifyItem {
+			Key PublicKey;
+			std::vector<uint8_t> Data;
+			bitxorcore::Signature Signature;
+		};
+
+		std::vector<VerifyItem> CreateVerifyItems() {
+			std::vector<VerifyItem> items(Num_Signatures);
+			for (auto& item : items) {
+				auto keyPair = crypto::KeyPair::FromPrivate(crypto::PrivateKey::Generate(bench::RandomByte));
+				item.PublicKey = keyPair.publicKey();
+				item.Data.resize(Data_Size);
+				bench::FillWithRandomData(item.Data);
+				crypto::Sign(keyPair, item.Data, item.Signature);
+			}
+
+			return items;
+		}
+
+		// endregion
+
+		// region EchoServer
+
+		// echoes every byte received on a single loopback connection using io pool threads
+		class EchoServer {
+		public:
+			explicit EchoServer(boost::asio::io_context& ioContext)
+					: m_acceptor(ioContext, boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0))
+					, m_socket(ioContext)
+			{}
+
+		public:
+			unsigned short port() const {
+				return m_acceptor.local_endpoint().port();
+			}
+
+		public:
+			void start() {
+				m_acceptor.async_accept(m_socket, [this](const auto& ec) {
+					if (!ec)
+						this->read();
+				});
+			}
+
+			void stop() {
+				boost::system::error_code ec;
+				m_socket.close(ec);
+				m_acceptor.close(ec);
+			}
+
+		private:
+			void read() {
+				m_socket.async_read_some(boost::asio::buffer(&m_byte, 1), [this](const auto& ec, auto) {
+					if (ec)
+						return;
+
+					boost::asio::async_write(m_socket, boost::asio::buffer(&m_byte, 1), [this](const auto& writeEc, auto) {
+						if (!writeEc)
+							this->read();
+					});
+				});
+			}
+
+		private:
+			boost::asio::ip::tcp::acceptor m_acceptor;
+			boost::asio::ip::tcp::socket m_socket;
+			uint8_t m_byte;
+		};
+
+		// endregion
+
+		// region traits
+
+		struct SharedIoPoolTraits {
+			static auto Verify(
+					IoThreadPool& ioPool,
+					ComputeThreadPool&,
+					const std::vector<VerifyItem>& items,
+					std::atomic<size_t>& numFailures) {
+				return ParallelFor(ioPool.ioContext(), items, ioPool.numWorkerThreads(), [&numFailures](const auto& item, auto) {
+					if (!crypto::Verify(item.PublicKey, item.Data, item.Signature))
+						++numFailures;
+
+					return true;
+				});
+			}
+		};
+
+		struct ComputePoolTraits {
+			static auto Verify(
+					IoThreadPool&,
+					ComputeThreadPool& computePool,
+					const std::vector<VerifyItem>& items,
+					std::atomic<size_t>& numFailures) {
+				return ParallelFor(computePool, items, [&numFailures](const auto& item, auto) {
+					if (!crypto::Verify(item.PublicKey, item.Data, item.Signature))
+						++numFailures;
+
+					return true;
+				});
+			}
+		};
+
+		// endregion
+
+		template<typename TTraits>
+		void BenchmarkRoundTripLatencyDuringVerification(benchmark::State& state) {
+			// Arrange: the io pool and the compute pool have the same number of threads
+			auto numThreads = static_cast<size_t>(state.range(0));
+			auto items = CreateVerifyItems();
+
+			auto pIoPool = CreateIoThreadPool(numThreads, "io");
+			auto pComputePool = CreateComputeThreadPool({ numThreads, {} }, "compute");
+			pIoPool->start();
+			pComputePool->start();
+
+			EchoServer server(pIoPool->ioContext());
+			server.start();
+
+			boost::asio::io_context clientIoContext;
+			boost::asio::ip::tcp::socket client(clientIoContext);
+			client.connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), server.port()));
+			client.set_option(boost::asio::ip::tcp::no_delay(true));
+
+			// Act: measure round trips while a large range of signatures is being verified
+			using Clock = std::chrono::steady_clock;
+			std::atomic<size_t> numFailures(0);
+			size_t numRoundTrips = 0;
+			Clock::duration totalRoundTripDuration(0);
+			Clock::duration maxRoundTripDuration(0);
+			for (auto _ : state) {
+				auto verifyFuture = TTraits::Verify(*pIoPool, *pComputePool, items, numFailures);
+				while (!verifyFuture.is_ready()) {
+					uint8_t byte = 0x5A;
+					auto start = Clock::now();
+					boost::asio::write(client, boost::asio::buffer(&byte, 1));
+					boost::asio::read(client, boost::asio::buffer(&byte, 1));
+					auto roundTripDuration = Clock::now() - start;
+
+					++numRoundTrips;
+					totalRoundTripDuration += roundTripDuration;
+					maxRoundTripDuration = std::max(maxRoundTripDuration, roundTripDuration);
+				}
+
+				verifyFuture.get();
+			}
+
+			// Assert:
+			auto toMicros = [](auto duration) {
+				return static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+			};
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Signatures * state.iterations()));
+			state.counters["round_trips"] = benchmark::Counter(static_cast<double>(numRoundTrips), benchmark::Counter::kAvgIterations);
+			state.counters["avg_rtt_us"] = 0 == numRoundTrips ? 0 : toMicros(totalRoundTripDuration) / static_cast<double>(numRoundTrips);
+			state.counters["max_rtt_us"] = toMicros(maxRoundTripDuration);
+			if (0 != numFailures)
+				BITXORCORE_LOG(warning) << numFailures << " signatures could not be verified";
+
+			boost::system::error_code ec;
+			client.close(ec);
+			boost::asio::post(pIoPool->ioContext(), [&server]() { server.stop(); });
+			pIoPool->join();
+			pComputePool->join();
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace bitxorcore::thread;
+
+	benchmark::RegisterBenchmark("BenchmarkRoundTripLatencyDuringVerification_SharedIoPool", BenchmarkRoundTripLatencyDuringVerification<
+			SharedIoPoolTraits>)
+			->UseRealTime()
+			->Unit(benchmark::kMillisecond)
+			->Arg(1)
+			->Arg(2)
+			->Arg(4);
+
+	benchmark::RegisterBenchmark("BenchmarkRoundTripLatencyDuringVerification_ComputePool", BenchmarkRoundTripLatencyDuringVerification<
+			ComputePoolTraits>)
+			->UseRealTime()
+			->Unit(benchmark::kMillisecond)
+			->Arg(1)
+			->Arg(2)
+			->Arg(4);
+}
@@ -0,0 +1,191 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/tree/PatriciaTree.h"
+#include "bitxorcore/tree/PatriciaTreeSerializer.h"
+#include "bitxorcore/utils/Hashers.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <unordered_map>
+
+namespace bitxorcore { namespace tree {
+
+	namespace {
+		constexpr auto Num_Tree_Values = 1'000'000u;
+
+		struct HashEncoder {
+			using KeyType = Hash256;
+			using ValueType = Hash256;
+
+			static const KeyType& EncodeKey(const KeyType& key) {
+				return key;
+			}
+
+			static const Hash256& EncodeValue(const ValueType& value) {
+				return value;
+			}
+		};
+
+		// stores serialized nodes and deserializes them on every access, like PatriciaTreeRdbDataSource
+		class SerializedMemoryDataSource {
+		public:
+			TreeNode get(const Hash256& hash) const {
+				auto iter = m_nodes.find(hash);
+				if (m_nodes.cend() == iter)
+					return TreeNode();
+
+				const auto& serializedNode = iter->second;
+				return PatriciaTreeSerializer::DeserializeValue({
+					reinterpret_cast<const uint8_t*>(serializedNode.data()),
+					serializedNode.size()
+				});
+			}
+
+		public:
+			void set(const LeafTreeNode& node) {
+				m_nodes.emplace(node.hash(), PatriciaTreeSerializer::SerializeValue(TreeNode(node)));
+			}
+
+			void set(const BranchTreeNode& node) {
+				m_nodes.emplace(node.hash(), PatriciaTreeSerializer::SerializeValue(TreeNode(node)));
+			}
+
+		private:
+			std::unordered_map<Hash256, std::string, utils::ArrayHasher<Hash256>> m_nodes;
+		};
+
+		using SerializedPatriciaTree = PatriciaTree<HashEncoder, SerializedMemoryDataSource>;
+
+		Hash256 GenerateRandomHash() {
+			Hash256 hash;
+			bench::FillWithRandomData(hash);
+			return hash;
+		}
+
+		class TreeContext {
+		public:
+			TreeContext() {
+				SerializedPatriciaTree tree(m_dataSource);
+				m_keys.reserve(Num_Tree_Values);
+				for (auto i = 0u; i < Num_Tree_Values; ++i) {
+					m_keys.push_back(GenerateRandomHash());
+					tree.set(m_keys.back(), GenerateRandomHash());
+				}
+
+				tree.saveAll();
+				m_rootHash = tree.root();
+			}
+
+		public:
+			SerializedPatriciaTree loadTree() {
+				// load the tree from its root hash so that all lookups are served by the data source
+				SerializedPatriciaTree tree(m_dataSource);
+				tree.tryLoad(m_rootHash);
+				return tree;
+			}
+
+			std::vector<Hash256> sampleKeys(size_t numKeys) const {
+				std::vector<Hash256> keys;
+				for (auto i = 0u; i < numKeys; ++i)
+					keys.push_back(m_keys[bench::Random() % m_keys.size()]);
+
+				return keys;
+			}
+
+		private:
+			SerializedMemoryDataSource m_dataSource;
+			std::vector<Hash256> m_keys;
+			Hash256 m_rootHash;
+		};
+
+		TreeContext& GetTreeContext() {
+			static TreeContext context;
+			return context;
+		}
+
+		// state.range(0) is number of keys looked up per iteration
+
+		void BenchmarkLookupEach(benchmark::State& state) {
+			auto& context = GetTreeContext();
+			auto tree = context.loadTree();
+
+			size_t numNodes = 0;
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto keys = context.sampleKeys(static_cast<size_t>(state.range(0)));
+				state.ResumeTiming();
+
+				std::vector<std::vector<TreeNode>> nodePaths(keys.size());
+				for (auto i = 0u; i < keys.size(); ++i) {
+					tree.lookup(keys[i], nodePaths[i]);
+					numNodes += nodePaths[i].size();
+				}
+
+				benchmark::DoNotOptimize(nodePaths);
+			}
+
+			state.counters["nodes/iteration"] = static_cast<double>(numNodes) / static_cast<double>(state.iterations());
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+		}
+
+		void BenchmarkLookupAll(benchmark::State& state) {
+			auto& context = GetTreeContext();
+			auto tree = context.loadTree();
+
+			size_t numNodes = 0;
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto keys = context.sampleKeys(static_cast<size_t>(state.range(0)));
+				state.ResumeTiming();
+
+				std::vector<TreeNode> nodes;
+				auto results = tree.lookupAll(keys, nodes);
+				numNodes += nodes.size();
+
+				benchmark::DoNotOptimize(results);
+				benchmark::DoNotOptimize(nodes);
+			}
+
+			state.counters["nodes/iteration"] = static_cast<double>(numNodes) / static_cast<double>(state.iterations());
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace bitxorcore::tree;
+
+	benchmark::RegisterBenchmark("BenchmarkLookupEach", BenchmarkLookupEach)
+			->Arg(1)
+			->Arg(100)
+			->Arg(1'000)
+			->Arg(10'000)
+			->Unit(benchmark::kMicrosecond);
+
+	benchmark::RegisterBenchmark("BenchmarkLookupAll", BenchmarkLookupAll)
+			->Arg(1)
+			->Arg(100)
+			->Arg(1'000)
+			->Arg(10'000)
+			->Unit(benchmark::kMicrosecond);
+}
@@ -0,0 +1,150 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/utils/EpochSnapshot.h"
+#include "bitxorcore/utils/SpinReaderWriterLock.h"
+#include "bitxorcore/utils/StackTimer.h"
+#include <benchmark/benchmark.h>
+#include <thread>
+#include <vector>
+
+namespace bitxorcore { namespace utils {
+
+	namespace {
+		constexpr auto Num_Writes_Per_Iteration = 1'000u;
+
+		// value is a pair so that torn reads would be detectable
+		struct Value {
+			uint64_t First = 0;
+			uint64_t Second = 0;
+		};
+
+		class SpinReaderWriterLockStore {
+		public:
+			template<typename TConsumer>
+			void read(TConsumer consumer) const {
+				auto readLock = m_lock.acquireReader();
+				consumer(m_value);
+			}
+
+			void write(uint64_t seed) {
+				auto writeLock = m_lock.acquireWriter();
+				m_value = Value{ seed, seed };
+			}
+
+		private:
+			Value m_value;
+			mutable SpinReaderWriterLock m_lock;
+		};
+
+		class EpochSnapshotStore {
+		public:
+			template<typename TConsumer>
+			void read(TConsumer consumer) const {
+				auto readGuard = m_snapshot.read();
+				consumer(*readGuard);
+			}
+
+			void write(uint64_t seed) {
+				m_snapshot.publish(Value{ seed, seed });
+			}
+
+		private:
+			EpochSnapshot<Value> m_snapshot;
+		};
+
+		template<typename TStore>
+		void BenchmarkContention(benchmark::State& state) {
+			auto numReaders = static_cast<size_t>(state.range(0));
+			uint64_t numReads = 0;
+			uint64_t numTornReads = 0;
+			uint64_t totalWriteMicros = 0;
+			uint64_t maxWriteMicros = 0;
+
+			for (auto _ : state) {
+				TStore store;
+				std::atomic_bool isDone(false);
+				std::vector<uint64_t> readCounts(numReaders);
+				std::vector<uint64_t> tornReadCounts(numReaders);
+
+				// spawn readers
+				std::vector<std::thread> readers;
+				for (auto i = 0u; i < numReaders; ++i) {
+					readers.emplace_back([&store, &isDone, &readCount = readCounts[i], &tornReadCount = tornReadCounts[i]]() {
+						while (!isDone) {
+							store.read([&tornReadCount](const auto& value) {
+								if (value.First != value.Second)
+									++tornReadCount;
+							});
+							++readCount;
+						}
+					});
+				}
+
+				// write from a single writer while readers are running
+				for (auto i = 1u; i <= Num_Writes_Per_Iteration; ++i) {
+					StackTimer stopwatch;
+					store.write(i);
+					auto writeMicros = stopwatch.micros();
+					totalWriteMicros += writeMicros;
+					maxWriteMicros = std::max(maxWriteMicros, writeMicros);
+				}
+
+				isDone = true;
+				for (auto& reader : readers)
+					reader.join();
+
+				for (auto i = 0u; i < numReaders; ++i) {
+					numReads += readCounts[i];
+					numTornReads += tornReadCounts[i];
+				}
+			}
+
+			auto numWrites = static_cast<double>(Num_Writes_Per_Iteration * state.iterations());
+			state.counters["reads"] = benchmark::Counter(static_cast<double>(numReads), benchmark::Counter::kIsRate);
+			state.counters["torn"] = static_cast<double>(numTornReads);
+			state.counters["write_avg_us"] = static_cast<double>(totalWriteMicros) / numWrites;
+			state.counters["write_max_us"] = static_cast<double>(maxWriteMicros);
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace bitxorcore::utils;
+
+	benchmark::RegisterBenchmark("BenchmarkContention<SpinReaderWriterLock>", BenchmarkContention<SpinReaderWriterLockStore>)
+			->UseRealTime()
+			->Arg(1)
+			->Arg(2)
+			->Arg(4)
+			->Arg(8)
+			->Arg(16);
+
+	benchmark::RegisterBenchmark("BenchmarkContention<EpochSnapshot>", BenchmarkContention<EpochSnapshotStore>)
+			->UseRealTime()
+			->Arg(1)
+			->Arg(2)
+			->Arg(4)
+			->Arg(8)
+			->Arg(16);
+}
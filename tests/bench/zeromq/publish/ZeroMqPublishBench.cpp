@@ -0,0 +1,156 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "zeromq/src/PublisherUtils.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace bitxorcore { namespace zeromq {
+
+	namespace {
+		constexpr auto Transaction_Size = 1024u;
+		constexpr auto Max_Addresses = 100u;
+		constexpr auto Endpoint = "inproc://bench.zeromq.publish";
+
+		// PUB socket connected to a local SUB socket that is subscribed to all messages
+		class PublishContext {
+		public:
+			PublishContext()
+					: m_publisher(m_context, ZMQ_PUB)
+					, m_subscriber(m_context, ZMQ_SUB)
+					, m_transaction(Transaction_Size) {
+				m_publisher.set(zmq::sockopt::linger, 0);
+				m_subscriber.set(zmq::sockopt::linger, 0);
+				m_publisher.bind(Endpoint);
+				m_subscriber.connect(Endpoint);
+				m_subscriber.set(zmq::sockopt::subscribe, "");
+
+				bench::FillWithRandomData(m_transaction);
+				for (auto i = 0u; i < Max_Addresses; ++i) {
+					UnresolvedAddress address;
+					bench::FillWithRandomData(address);
+					m_addresses.push_back(address);
+				}
+			}
+
+		public:
+			const std::vector<uint8_t>& transaction() const {
+				return m_transaction;
+			}
+
+			const std::vector<UnresolvedAddress>& addresses() const {
+				return m_addresses;
+			}
+
+		public:
+			void send(std::vector<zmq::multipart_t>& messages) {
+				for (auto& message : messages)
+					message.send(m_publisher);
+			}
+
+			size_t receive(size_t numMessages) {
+				size_t numBytes = 0;
+				for (auto i = 0u; i < numMessages; ++i) {
+					zmq::multipart_t message;
+					message.recv(m_subscriber);
+					for (const auto& frame : message)
+						numBytes += frame.size();
+				}
+
+				return numBytes;
+			}
+
+		private:
+			zmq::context_t m_context;
+			zmq::socket_t m_publisher;
+			zmq::socket_t m_subscriber;
+			std::vector<uint8_t> m_transaction;
+			std::vector<UnresolvedAddress> m_addresses;
+		};
+
+		struct CopiedTraits {
+			// transaction is copied into every message
+			static size_t AddTransactionFrames(std::vector<zmq::multipart_t>& messages, const std::vector<uint8_t>& transaction) {
+				for (auto& message : messages)
+					message.addmem(transaction.data(), transaction.size());
+
+				return messages.size() * transaction.size();
+			}
+		};
+
+		struct SharedTraits {
+			// transaction is copied once and shared by all messages
+			static size_t AddTransactionFrames(std::vector<zmq::multipart_t>& messages, const std::vector<uint8_t>& transaction) {
+				auto pTransaction = std::make_shared<std::vector<uint8_t>>(transaction);
+				auto pSharedTransaction = std::shared_ptr<const void>(pTransaction, pTransaction->data());
+				for (auto& message : messages)
+					message.add(CreateSharedFrame(pSharedTransaction, transaction.size()));
+
+				return transaction.size();
+			}
+		};
+
+		template<typename TTraits>
+		void BenchmarkPublish(benchmark::State& state) {
+			PublishContext context;
+			auto numAddresses = static_cast<size_t>(state.range(0));
+
+			size_t numMessages = 0;
+			size_t numBytesReceived = 0;
+			size_t numBytesCopied = 0;
+			for (auto _ : state) {
+				std::vector<zmq::multipart_t> messages(numAddresses);
+				for (auto i = 0u; i < numAddresses; ++i) {
+					auto topic = CreateTopic(TransactionMarker::Transaction_Marker, context.addresses()[i]);
+					messages[i].addmem(topic.data(), topic.size());
+				}
+
+				numBytesCopied += TTraits::AddTransactionFrames(messages, context.transaction());
+
+				context.send(messages);
+				numBytesReceived += context.receive(numAddresses);
+				numMessages += numAddresses;
+			}
+
+			state.SetBytesProcessed(static_cast<int64_t>(numBytesReceived));
+			state.counters["messages"] = benchmark::Counter(static_cast<double>(numMessages), benchmark::Counter::kIsRate);
+			state.counters["bytes_copied"] = benchmark::Counter(static_cast<double>(numBytesCopied), benchmark::Counter::kAvgIterations);
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	benchmark::RegisterBenchmark("BenchmarkPublishCopied", bitxorcore::zeromq::BenchmarkPublish<bitxorcore::zeromq::CopiedTraits>)
+			->UseRealTime()
+			->Arg(1)
+			->Arg(10)
+			->Arg(50)
+			->Arg(100);
+
+	benchmark::RegisterBenchmark("BenchmarkPublishShared", bitxorcore::zeromq::BenchmarkPublish<bitxorcore::zeromq::SharedTraits>)
+			->UseRealTime()
+			->Arg(1)
+			->Arg(10)
+			->Arg(50)
+			->Arg(100);
+}
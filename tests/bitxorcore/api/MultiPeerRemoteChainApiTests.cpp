@@ -0,0 +1,455 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/api/MultiPeerRemoteChainApi.h"
+#include "bitxorcore/model/EntityHasher.h"
+#include "bitxorcore/utils/MemoryUtils.h"
+#include "bitxorcore/utils/StackTimer.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/EntityTestUtils.h"
+#include "tests/test/nodeps/Waits.h"
+#include "tests/TestHarness.h"
+#include <thread>
+
+namespace bitxorcore { namespace api {
+
+#define TEST_CLASS MultiPeerRemoteChainApiTests
+
+	namespace {
+		constexpr auto Chain_Height = Height(100);
+
+		using Chain = std::vector<std::shared_ptr<const model::Block>>;
+
+		std::shared_ptr<const Chain> CreateChain() {
+			auto pChain = std::make_shared<Chain>();
+			for (auto height = Height(1); height <= Chain_Height; height = height + Height(1)) {
+				auto pBlock = test::GenerateBlockWithTransactions(0, height);
+				if (!pChain->empty())
+					pBlock->PreviousBlockHash = model::CalculateHash(*pChain->back());
+
+				pChain->push_back(std::move(pBlock));
+			}
+
+			return pChain;
+		}
+
+		std::shared_ptr<const Chain> CreateTamperedChain(const Chain& chain, Height height) {
+			// change the block at height without fixing the link of the following block
+			auto pChain = std::make_shared<Chain>(chain);
+			auto& pBlock = (*pChain)[(height - Height(1)).unwrap()];
+			auto pTamperedBlock = utils::UniqueToShared(test::CopyEntity(*pBlock));
+			pTamperedBlock->Timestamp = pTamperedBlock->Timestamp + Timestamp(1);
+			pBlock = pTamperedBlock;
+			return pChain;
+		}
+
+		// region MockChainPeer
+
+		class MockChainPeer : public RemoteChainApi {
+		public:
+			MockChainPeer(const std::shared_ptr<const Chain>& pChain, uint32_t delayMillis, uint32_t maxBlocksPerResponse)
+					: RemoteChainApi({ test::GenerateRandomByteArray<Key>(), "mock-chain-peer" })
+					, m_pChain(pChain)
+					, m_delayMillis(delayMillis)
+					, m_maxBlocksPerResponse(maxBlocksPerResponse)
+					, m_shouldFail(false)
+					, m_numOtherRequests(0)
+			{}
+
+		public:
+			void setFailure() {
+				m_shouldFail = true;
+			}
+
+			size_t numOtherRequests() const {
+				return m_numOtherRequests;
+			}
+
+			const std::vector<std::pair<Height, BlocksFromOptions>>& blocksFromRequests() const {
+				return m_blocksFromRequests;
+			}
+
+		public:
+			thread::future<ChainStatistics> chainStatistics() const override {
+				++m_numOtherRequests;
+				auto chainStatistics = ChainStatistics();
+				chainStatistics.Height = Chain_Height;
+				return thread::make_ready_future(std::move(chainStatistics));
+			}
+
+			thread::future<model::HashRange> hashesFrom(Height height, uint32_t maxHashes) const override {
+				++m_numOtherRequests;
+				std::vector<Hash256> hashes;
+				for (auto i = 0u; i < maxHashes && height + Height(i) <= Chain_Height; ++i)
+					hashes.push_back(model::CalculateHash(*(*m_pChain)[(height + Height(i) - Height(1)).unwrap()]));
+
+				auto hashRange = model::HashRange::CopyFixed(reinterpret_cast<const uint8_t*>(hashes.data()), hashes.size());
+				return thread::make_ready_future(std::move(hashRange));
+			}
+
+			thread::future<std::shared_ptr<const model::Block>> blockLast() const override {
+				++m_numOtherRequests;
+				return thread::make_ready_future(std::shared_ptr<const model::Block>(m_pChain->back()));
+			}
+
+			thread::future<std::shared_ptr<const model::Block>> blockAt(Height height) const override {
+				++m_numOtherRequests;
+				return thread::make_ready_future(std::shared_ptr<const model::Block>((*m_pChain)[(height - Height(1)).unwrap()]));
+			}
+
+			thread::future<model::BlockRange> blocksFrom(Height height, const BlocksFromOptions& options) const override {
+				m_blocksFromRequests.emplace_back(height, options);
+				if (m_shouldFail)
+					return thread::make_exceptional_future<model::BlockRange>(bitxorcore_runtime_error("blocks from error has been set"));
+
+				std::vector<const model::Block*> blocks;
+				auto numBlocks = std::min(options.NumBlocks, m_maxBlocksPerResponse);
+				for (auto i = 0u; i < numBlocks && height + Height(i) <= Chain_Height; ++i)
+					blocks.push_back((*m_pChain)[(height + Height(i) - Height(1)).unwrap()].get());
+
+				auto range = test::CreateEntityRange(blocks);
+				if (0 == m_delayMillis)
+					return thread::make_ready_future(std::move(range));
+
+				// simulate a slow peer by delaying the response
+				thread::promise<model::BlockRange> promise;
+				auto future = promise.get_future();
+				std::thread([promise = std::move(promise), range = std::move(range), delayMillis = m_delayMillis]() mutable {
+					test::Sleep(delayMillis);
+					promise.set_value(std::move(range));
+				}).detach();
+				return future;
+			}
+
+		private:
+			std::shared_ptr<const Chain> m_pChain;
+			uint32_t m_delayMillis;
+			uint32_t m_maxBlocksPerResponse;
+			bool m_shouldFail;
+			mutable size_t m_numOtherRequests;
+			mutable std::vector<std::pair<Height, BlocksFromOptions>> m_blocksFromRequests;
+		};
+
+		// endregion
+
+		// region TestContext
+
+		struct PeerDescriptor {
+			uint32_t DelayMillis;
+			uint32_t MaxBlocksPerResponse;
+			bool IsForked = false;
+			Height TamperedHeight = Height(0);
+		};
+
+		class TestContext {
+		public:
+			explicit TestContext(const std::vector<PeerDescriptor>& peerDescriptors) {
+				auto pChain = CreateChain();
+				auto pForkedChain = CreateChain();
+
+				std::vector<std::unique_ptr<RemoteChainApi>> remoteApis;
+				for (const auto& descriptor : peerDescriptors) {
+					auto pPeerChain = descriptor.IsForked ? pForkedChain : pChain;
+					if (Height(0) != descriptor.TamperedHeight)
+						pPeerChain = CreateTamperedChain(*pChain, descriptor.TamperedHeight);
+
+					auto pPeer = std::make_unique<MockChainPeer>(pPeerChain, descriptor.DelayMillis, descriptor.MaxBlocksPerResponse);
+					m_peers.push_back(pPeer.get());
+					remoteApis.push_back(std::move(pPeer));
+				}
+
+				m_pChain = pChain;
+				m_pApi = CreateMultiPeerRemoteChainApi(std::move(remoteApis), [pResults = m_pSecondaryResults](const auto& result) {
+					pResults->push_back(result);
+				});
+			}
+
+		public:
+			MockChainPeer& peer(size_t index) {
+				return *m_peers[index];
+			}
+
+			const RemoteChainApi& api() const {
+				return *m_pApi;
+			}
+
+			void destroyApi() {
+				m_pApi.reset();
+			}
+
+		public:
+			void assertBlocks(const model::BlockRange& range, Height startHeight, size_t numExpectedBlocks) const {
+				ASSERT_EQ(numExpectedBlocks, range.size());
+
+				auto height = startHeight;
+				for (const auto& block : range) {
+					EXPECT_EQ(*(*m_pChain)[(height - Height(1)).unwrap()], block) << "block at " << height;
+					height = height + Height(1);
+				}
+			}
+
+			void assertSecondaryResults(const std::vector<ionet::NodeInteractionResultCode>& expectedCodes) const {
+				ASSERT_EQ(expectedCodes.size(), m_pSecondaryResults->size());
+
+				for (auto i = 0u; i < expectedCodes.size(); ++i) {
+					const auto& result = (*m_pSecondaryResults)[i];
+					EXPECT_EQ(m_peers[i + 1]->remoteIdentity().PublicKey, result.Identity.PublicKey) << "result " << i;
+					EXPECT_EQ(expectedCodes[i], result.Code) << "result " << i;
+				}
+			}
+
+		private:
+			std::shared_ptr<const Chain> m_pChain;
+			std::vector<MockChainPeer*> m_peers;
+			std::shared_ptr<std::vector<ionet::NodeInteractionResult>> m_pSecondaryResults
+					= std::make_shared<std::vector<ionet::NodeInteractionResult>>();
+			std::unique_ptr<RemoteChainApi> m_pApi;
+		};
+
+		void AssertBlocksFromRequests(
+				const MockChainPeer& peer,
+				const std::vector<std::pair<Height, uint32_t>>& expectedRequests,
+				uint32_t expectedNumBytes) {
+			const auto& requests = peer.blocksFromRequests();
+			ASSERT_EQ(expectedRequests.size(), requests.size());
+
+			for (auto i = 0u; i < requests.size(); ++i) {
+				EXPECT_EQ(expectedRequests[i].first, requests[i].first) << "request " << i;
+				EXPECT_EQ(expectedRequests[i].second, requests[i].second.NumBlocks) << "request " << i;
+				EXPECT_EQ(expectedNumBytes, requests[i].second.NumBytes) << "request " << i;
+			}
+		}
+
+		// endregion
+	}
+
+	// region create
+
+	TEST(TEST_CLASS, CannotCreateApiAroundZeroApis) {
+		EXPECT_THROW(CreateMultiPeerRemoteChainApi({}, [](const auto&) {}), bitxorcore_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, RemoteIdentityIsPrimaryIdentity) {
+		// Act:
+		TestContext context({ { 0, 10 }, { 0, 10 } });
+
+		// Assert:
+		EXPECT_EQ(context.peer(0).remoteIdentity().PublicKey, context.api().remoteIdentity().PublicKey);
+		EXPECT_EQ(context.peer(0).remoteIdentity().Host, context.api().remoteIdentity().Host);
+	}
+
+	// endregion
+
+	// region non blocks-from requests
+
+	TEST(TEST_CLASS, NonBlocksFromRequestsAreOnlyForwardedToPrimary) {
+		// Arrange:
+		TestContext context({ { 0, 10 }, { 0, 10 }, { 0, 10 } });
+
+		// Act:
+		auto chainStatistics = context.api().chainStatistics().get();
+		context.api().hashesFrom(Height(12), 5).get();
+		auto pLastBlock = context.api().blockLast().get();
+		auto pBlock = context.api().blockAt(Height(12)).get();
+
+		// Assert:
+		EXPECT_EQ(Chain_Height, chainStatistics.Height);
+		EXPECT_EQ(Chain_Height, pLastBlock->Height);
+		EXPECT_EQ(Height(12), pBlock->Height);
+
+		EXPECT_EQ(4u, context.peer(0).numOtherRequests());
+		EXPECT_EQ(0u, context.peer(1).numOtherRequests());
+		EXPECT_EQ(0u, context.peer(2).numOtherRequests());
+	}
+
+	// endregion
+
+	// region blocks-from
+
+	TEST(TEST_CLASS, BlocksFromIsForwardedUnchangedWhenThereIsSinglePeer) {
+		// Arrange:
+		TestContext context({ { 0, 10 } });
+
+		// Act:
+		auto range = context.api().blocksFrom(Height(11), { 10, 3000 }).get();
+
+		// Assert:
+		context.assertBlocks(range, Height(11), 10);
+		AssertBlocksFromRequests(context.peer(0), { { Height(11), 10 } }, 3000);
+	}
+
+	TEST(TEST_CLASS, BlocksFromDownloadsDisjointRangesFromAllPeers) {
+		// Arrange:
+		TestContext context({ { 0, 10 }, { 0, 10 }, { 0, 10 } });
+
+		// Act:
+		auto range = context.api().blocksFrom(Height(11), { 10, 3000 }).get();
+
+		// Assert: the byte budget is split between all peers
+		context.assertBlocks(range, Height(11), 30);
+		AssertBlocksFromRequests(context.peer(0), { { Height(11), 10 } }, 1000);
+		AssertBlocksFromRequests(context.peer(1), { { Height(21), 10 } }, 1000);
+		AssertBlocksFromRequests(context.peer(2), { { Height(31), 10 } }, 1000);
+
+		// - primary is additionally asked for hashes of secondary ranges and secondary interactions are reported
+		EXPECT_EQ(2u, context.peer(0).numOtherRequests());
+		context.assertSecondaryResults({ ionet::NodeInteractionResultCode::Success, ionet::NodeInteractionResultCode::Success });
+	}
+
+	TEST(TEST_CLASS, BlocksFromDownloadsFromPeersOfVaryingSpeedInParallel) {
+		test::RunNonDeterministicTest("parallel blocks from", []() {
+			// Arrange: the secondary peers are slower than the primary
+			TestContext context({ { 50, 10 }, { 150, 10 }, { 100, 10 } });
+
+			// Act:
+			utils::StackTimer stopwatch;
+			auto range = context.api().blocksFrom(Height(11), { 10, 3000 }).get();
+			auto elapsedMillis = stopwatch.millis();
+
+			// Assert: blocks are reassembled in order and downloads overlapped
+			context.assertBlocks(range, Height(11), 30);
+			return elapsedMillis < 300;
+		});
+	}
+
+	TEST(TEST_CLASS, BlocksFromStopsAtEndOfRemoteChain) {
+		// Arrange:
+		TestContext context({ { 0, 10 }, { 0, 10 }, { 0, 10 } });
+
+		// Act:
+		auto range = context.api().blocksFrom(Height(85), { 10, 3000 }).get();
+
+		// Assert: the last peer returns an empty range
+		context.assertBlocks(range, Height(85), 16);
+		AssertBlocksFromRequests(context.peer(2), { { Height(105), 10 } }, 1000);
+	}
+
+	TEST(TEST_CLASS, BlocksFromReturnsEmptyRangeWhenPrimaryReturnsNoBlocks) {
+		// Arrange:
+		TestContext context({ { 0, 10 }, { 0, 10 } });
+
+		// Act:
+		auto range = context.api().blocksFrom(Height(101), { 10, 3000 }).get();
+
+		// Assert:
+		EXPECT_TRUE(range.empty());
+		context.assertSecondaryResults({});
+	}
+
+	TEST(TEST_CLASS, BlocksFromPropagatesPrimaryFailure) {
+		// Arrange:
+		TestContext context({ { 0, 10 }, { 0, 10 } });
+		context.peer(0).setFailure();
+
+		// Act + Assert:
+		EXPECT_THROW(context.api().blocksFrom(Height(11), { 10, 3000 }).get(), bitxorcore_runtime_error);
+	}
+
+	TEST(TEST_CLASS, BlocksFromIgnoresBlocksAfterFailingSecondaryPeer) {
+		// Arrange:
+		TestContext context({ { 0, 10 }, { 0, 10 }, { 0, 10 } });
+		context.peer(1).setFailure();
+
+		// Act:
+		auto range = context.api().blocksFrom(Height(11), { 10, 3000 }).get();
+
+		// Assert: blocks from the last peer cannot be linked without the blocks of the failed peer
+		context.assertBlocks(range, Height(11), 10);
+		context.assertSecondaryResults({ ionet::NodeInteractionResultCode::Failure, ionet::NodeInteractionResultCode::Neutral });
+	}
+
+	TEST(TEST_CLASS, BlocksFromIgnoresBlocksAfterForkedSecondaryPeer) {
+		// Arrange:
+		TestContext context({ { 0, 10 }, { 0, 10 }, { 0, 10, true }, { 0, 10 } });
+
+		// Act:
+		auto range = context.api().blocksFrom(Height(11), { 10, 4000 }).get();
+
+		// Assert: forked peer is not blamed because it might be on a different valid fork
+		context.assertBlocks(range, Height(11), 20);
+		context.assertSecondaryResults({
+			ionet::NodeInteractionResultCode::Success,
+			ionet::NodeInteractionResultCode::Neutral,
+			ionet::NodeInteractionResultCode::Neutral
+		});
+	}
+
+	TEST(TEST_CLASS, BlocksFromIgnoresBlocksNotVouchedForByPrimary) {
+		// Arrange: the last block returned by the second peer links but differs from the block known to the primary
+		TestContext context({ { 0, 10 }, { 0, 10, false, Height(30) }, { 0, 10 } });
+
+		// Act:
+		auto range = context.api().blocksFrom(Height(11), { 10, 3000 }).get();
+
+		// Assert:
+		context.assertBlocks(range, Height(11), 10);
+		context.assertSecondaryResults({ ionet::NodeInteractionResultCode::Neutral, ionet::NodeInteractionResultCode::Neutral });
+	}
+
+	TEST(TEST_CLASS, BlocksFromIgnoresBlocksAfterSecondaryPeerWithShortResponse) {
+		// Arrange:
+		TestContext context({ { 0, 10 }, { 0, 5 }, { 0, 10 } });
+
+		// Act:
+		auto range = context.api().blocksFrom(Height(11), { 10, 3000 }).get();
+
+		// Assert: blocks from the last peer do not start where the short response ended
+		context.assertBlocks(range, Height(11), 15);
+	}
+
+	TEST(TEST_CLASS, BlocksFromAdaptsRangeSizeToPrimaryResponseSize) {
+		// Arrange: the primary peer returns at most four blocks
+		TestContext context({ { 0, 4 }, { 0, 10 }, { 0, 10 } });
+
+		// Act:
+		auto range1 = context.api().blocksFrom(Height(11), { 10, 3000 }).get();
+		auto range2 = context.api().blocksFrom(Height(15), { 10, 3000 }).get();
+		auto range3 = context.api().blocksFrom(Height(27), { 10, 3000 }).get();
+
+		// Assert:
+		// - first request: ranges of secondary peers do not link to the short primary range
+		// - second request: ranges are resized to the primary response size and all link
+		// - third request: full primary response causes the range size to be reset
+		context.assertBlocks(range1, Height(11), 4);
+		context.assertBlocks(range2, Height(15), 12);
+		context.assertBlocks(range3, Height(27), 4);
+
+		AssertBlocksFromRequests(context.peer(0), { { Height(11), 10 }, { Height(15), 4 }, { Height(27), 10 } }, 1000);
+		AssertBlocksFromRequests(context.peer(1), { { Height(21), 10 }, { Height(19), 4 }, { Height(37), 10 } }, 1000);
+		AssertBlocksFromRequests(context.peer(2), { { Height(31), 10 }, { Height(23), 4 }, { Height(47), 10 } }, 1000);
+	}
+
+	TEST(TEST_CLASS, BlocksFromCanCompleteAfterApiIsDestroyed) {
+		// Arrange:
+		TestContext context({ { 50, 10 }, { 50, 10 } });
+		auto rangeFuture = context.api().blocksFrom(Height(11), { 10, 2000 });
+
+		// Act:
+		context.destroyApi();
+		auto range = rangeFuture.get();
+
+		// Assert:
+		context.assertBlocks(range, Height(11), 20);
+	}
+
+	// endregion
+}}
@@ -229,6 +229,19 @@ namespace bitxorcore { namespace api {
 				return Create(packetIo, model::NodeIdentity());
 			}
 		};
+
+		struct MeasuredRemoteChainApiTraits {
+			static auto Create(ionet::PacketIo& packetIo, const model::NodeIdentity& remoteIdentity) {
+				auto apiFactory = [](auto& io, const auto& identity, const auto& registry) {
+					return CreateMeasuredRemoteChainApi(io, identity, registry, [](const auto&, const auto&) {});
+				};
+				return test::CreateLifetimeExtendedApi(apiFactory, packetIo, remoteIdentity, model::TransactionRegistry());
+			}
+
+			static auto Create(ionet::PacketIo& packetIo) {
+				return Create(packetIo, model::NodeIdentity());
+			}
+		};
 	}
 
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteChainApiBlockless, ChainStatistics)
@@ -240,4 +253,94 @@ namespace bitxorcore { namespace api {
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteChainApi, BlockLast)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteChainApi, BlockAt)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteChainApi, BlocksFrom)
+
+	DEFINE_REMOTE_API_TESTS(MeasuredRemoteChainApi)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(MeasuredRemoteChainApi, ChainStatistics)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(MeasuredRemoteChainApi, HashesFrom)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(MeasuredRemoteChainApi, BlockLast)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(MeasuredRemoteChainApi, BlockAt)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(MeasuredRemoteChainApi, BlocksFrom)
+
+	// region request observer
+
+	namespace {
+		using MeasurementPairs = std::vector<std::pair<model::NodeIdentity, RemoteRequestMeasurement>>;
+
+		template<typename TTraits>
+		void RunMeasuredRequest(
+				const std::shared_ptr<ionet::Packet>& pResponsePacket,
+				ionet::SocketOperationCode readCode,
+				MeasurementPairs& measurements) {
+			// Arrange:
+			auto pPacketIo = std::make_shared<mocks::MockPacketIo>();
+			pPacketIo->queueWrite(ionet::SocketOperationCode::Success);
+			pPacketIo->queueRead(readCode, [pResponsePacket](const auto*) { return pResponsePacket; });
+
+			auto remoteIdentity = model::NodeIdentity{ test::GenerateRandomByteArray<Key>(), "11.22.33.44" };
+			model::TransactionRegistry registry;
+			auto pApi = CreateMeasuredRemoteChainApi(*pPacketIo, remoteIdentity, registry, [&measurements](
+					const auto& identity,
+					const auto& measurement) {
+				measurements.emplace_back(identity, measurement);
+			});
+
+			// Act:
+			try {
+				TTraits::Invoke(*pApi).get();
+			} catch (const bitxorcore_api_error&) {
+			}
+
+			// Assert: the observer is always passed the identity of the remote node
+			for (const auto& pair : measurements) {
+				EXPECT_EQ(remoteIdentity.PublicKey, pair.first.PublicKey);
+				EXPECT_EQ(remoteIdentity.Host, pair.first.Host);
+			}
+		}
+	}
+
+	TEST(MeasuredRemoteChainApiTests, ObserverIsNotifiedAboutSuccessfulLatencyDominatedRequest) {
+		// Arrange:
+		MeasurementPairs measurements;
+
+		// Act:
+		RunMeasuredRequest<ChainStatisticsTraits>(
+				ChainStatisticsTraits::CreateValidResponsePacket(),
+				ionet::SocketOperationCode::Success,
+				measurements);
+
+		// Assert: small responses do not report a size
+		ASSERT_EQ(1u, measurements.size());
+		EXPECT_EQ(0u, measurements[0].second.NumBytes);
+	}
+
+	TEST(MeasuredRemoteChainApiTests, ObserverIsNotifiedAboutSuccessfulBlocksFromRequestWithResponseSize) {
+		// Arrange:
+		MeasurementPairs measurements;
+
+		// Act:
+		RunMeasuredRequest<BlocksFromTraits>(
+				BlocksFromTraits::CreateValidResponsePacket(),
+				ionet::SocketOperationCode::Success,
+				measurements);
+
+		// Assert:
+		ASSERT_EQ(1u, measurements.size());
+		EXPECT_EQ(3u * Block_Header_Size, measurements[0].second.NumBytes);
+	}
+
+	TEST(MeasuredRemoteChainApiTests, ObserverIsNotNotifiedAboutFailedRequest) {
+		// Arrange:
+		MeasurementPairs measurements;
+
+		// Act:
+		RunMeasuredRequest<BlocksFromTraits>(
+				BlocksFromTraits::CreateValidResponsePacket(),
+				ionet::SocketOperationCode::Read_Error,
+				measurements);
+
+		// Assert:
+		EXPECT_TRUE(measurements.empty());
+	}
+
+	// endregion
 }}
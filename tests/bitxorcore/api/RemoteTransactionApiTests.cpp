@@ -113,6 +113,33 @@ namespace bitxorcore { namespace api {
 			}
 		};
 
+		struct AnnouncedUtTraits : public UtTraits {
+			static constexpr uint32_t Request_Data_Size = 3 * sizeof(utils::ShortHash);
+
+			static auto Invoke(const RemoteTransactionApi& api) {
+				return api.announcedTransactions(KnownShortHashes());
+			}
+
+			static auto CreateValidResponsePacket() {
+				auto pResponsePacket = CreatePacketWithTransactions(3);
+				pResponsePacket->Type = ionet::PacketType::Pull_Announced_Transactions;
+				return pResponsePacket;
+			}
+
+			static auto CreateMalformedResponsePacket() {
+				// the packet is malformed because it contains a partial transaction
+				auto pResponsePacket = CreateValidResponsePacket();
+				--pResponsePacket->Size;
+				return pResponsePacket;
+			}
+
+			static void ValidateRequest(const ionet::Packet& packet) {
+				EXPECT_EQ(ionet::PacketType::Pull_Announced_Transactions, packet.Type);
+				ASSERT_EQ(sizeof(ionet::Packet) + Request_Data_Size, packet.Size);
+				EXPECT_EQ_MEMORY(packet.Data(), KnownShortHashValues().data(), Request_Data_Size);
+			}
+		};
+
 		struct RemoteTransactionApiTraits {
 			static auto Create(ionet::PacketIo& packetIo, const model::NodeIdentity& remoteIdentity) {
 				auto registry = mocks::CreateDefaultTransactionRegistry();
@@ -127,4 +154,5 @@ namespace bitxorcore { namespace api {
 
 	DEFINE_REMOTE_API_TESTS(RemoteTransactionApi)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteTransactionApi, Ut)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteTransactionApi, AnnouncedUt)
 }}
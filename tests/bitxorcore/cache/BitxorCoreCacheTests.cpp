@@ -24,13 +24,20 @@
 #include "bitxorcore/cache/CacheStorage.h"
 #include "bitxorcore/cache/BitxorCoreCacheBuilder.h"
 #include "bitxorcore/cache/ReadOnlyBitxorCoreCache.h"
+#include "bitxorcore/cache_db/RocksDatabase.h"
+#include "bitxorcore/cache_db/RocksInclude.h"
+#include "bitxorcore/cache_db/SharedRocksDatabase.h"
 #include "bitxorcore/crypto/Hashes.h"
 #include "bitxorcore/state/BitxorCoreState.h"
 #include "tests/test/cache/CacheBasicTests.h"
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/StateTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
+#include "tests/test/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
+#include <mutex>
+#include <set>
+#include <thread>
 
 namespace bitxorcore { namespace cache {
 
@@ -57,12 +64,12 @@ namespace bitxorcore { namespace cache {
 			builder.add<test::SimpleCacheStorageTraits>(std::make_unique<test::SimpleCacheT<CacheId>>(viewMode));
 		}
 
-		BitxorCoreCache CreateSimpleBitxorCoreCache() {
+		BitxorCoreCache CreateSimpleBitxorCoreCache(SubCacheCommitMode commitMode = SubCacheCommitMode::Sequential) {
 			BitxorCoreCacheBuilder builder;
 			AddSubCacheWithId<2>(builder);
 			AddSubCacheWithId<6>(builder);
 			AddSubCacheWithId<4>(builder);
-			return builder.build();
+			return builder.build(commitMode);
 		}
 	}
 
@@ -287,6 +294,33 @@ namespace bitxorcore { namespace cache {
 
 	// endregion
 
+	// region hasChanges
+
+	TEST(TEST_CLASS, HasChangesReturnsFalseForUnregisteredSubCaches) {
+		// Arrange:
+		auto cache = CreateSimpleBitxorCoreCache();
+		auto delta = cache.createDelta();
+
+		// Act + Assert:
+		EXPECT_FALSE(delta.hasChanges(3));
+		EXPECT_FALSE(delta.hasChanges(5));
+		EXPECT_FALSE(delta.hasChanges(7));
+		EXPECT_FALSE(delta.hasChanges(100));
+	}
+
+	TEST(TEST_CLASS, HasChangesForwardsToRegisteredSubCaches) {
+		// Arrange: simple cache delta always returns (non-empty) delta elements
+		auto cache = CreateSimpleBitxorCoreCache();
+		auto delta = cache.createDelta();
+
+		// Act + Assert:
+		EXPECT_TRUE(delta.hasChanges(2));
+		EXPECT_TRUE(delta.hasChanges(4));
+		EXPECT_TRUE(delta.hasChanges(6));
+	}
+
+	// endregion
+
 	// region commit
 
 	namespace {
@@ -300,9 +334,15 @@ namespace bitxorcore { namespace cache {
 		}
 	}
 
-	TEST(TEST_CLASS, CommitDelegatesToSubCaches_View) {
+#define COMMIT_MODE_TEST(TEST_NAME) \
+	template<SubCacheCommitMode CommitMode> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Sequential) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<SubCacheCommitMode::Sequential>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Parallel) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<SubCacheCommitMode::Parallel>(); } \
+	template<SubCacheCommitMode CommitMode> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	COMMIT_MODE_TEST(CommitDelegatesToSubCaches_View) {
 		// Arrange:
-		auto cache = CreateSimpleBitxorCoreCache();
+		auto cache = CreateSimpleBitxorCoreCache(CommitMode);
 
 		// Act:
 		CommitChangeToAllSubCaches(cache);
@@ -312,9 +352,9 @@ namespace bitxorcore { namespace cache {
 		AssertSubCacheSizes(view, 1);
 	}
 
-	TEST(TEST_CLASS, CommitDelegatesToSubCaches_Delta) {
+	COMMIT_MODE_TEST(CommitDelegatesToSubCaches_Delta) {
 		// Arrange:
-		auto cache = CreateSimpleBitxorCoreCache();
+		auto cache = CreateSimpleBitxorCoreCache(CommitMode);
 
 		// Act:
 		CommitChangeToAllSubCaches(cache);
@@ -324,6 +364,155 @@ namespace bitxorcore { namespace cache {
 		AssertSubCacheSizes(delta, 1);
 	}
 
+	namespace {
+		class CommitHookSubCachePlugin : public SubCachePlugin {
+		public:
+			using CommitHook = consumer<SubCachePlugin&>;
+
+		public:
+			CommitHookSubCachePlugin(std::unique_ptr<SubCachePlugin>&& pSubCachePlugin, const CommitHook& commitHook)
+					: m_pSubCachePlugin(std::move(pSubCachePlugin))
+					, m_commitHook(commitHook)
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_pSubCachePlugin->name();
+			}
+
+			size_t id() const override {
+				return m_pSubCachePlugin->id();
+			}
+
+		public:
+			std::unique_ptr<const SubCacheView> createView() const override {
+				return m_pSubCachePlugin->createView();
+			}
+
+			std::unique_ptr<SubCacheView> createDelta() override {
+				return m_pSubCachePlugin->createDelta();
+			}
+
+			std::unique_ptr<DetachedSubCacheView> createDetachedDelta() const override {
+				return m_pSubCachePlugin->createDetachedDelta();
+			}
+
+			void commit() override {
+				m_commitHook(*m_pSubCachePlugin);
+			}
+
+		public:
+			const void* get() const override {
+				return m_pSubCachePlugin->get();
+			}
+
+		public:
+			std::unique_ptr<CacheStorage> createStorage() override {
+				return m_pSubCachePlugin->createStorage();
+			}
+
+			std::unique_ptr<CacheChangesStorage> createChangesStorage() const override {
+				return m_pSubCachePlugin->createChangesStorage();
+			}
+
+		private:
+			std::unique_ptr<SubCachePlugin> m_pSubCachePlugin;
+			CommitHook m_commitHook;
+		};
+
+		template<size_t CacheId>
+		std::unique_ptr<SubCachePlugin> CreateCommitHookSubCachePlugin(const CommitHookSubCachePlugin::CommitHook& commitHook) {
+			using SubCachePluginType = SubCachePluginAdapter<test::SimpleCacheT<CacheId>, test::SimpleCacheStorageTraits>;
+			auto pSubCachePlugin = std::make_unique<SubCachePluginType>(std::make_unique<test::SimpleCacheT<CacheId>>());
+			return std::make_unique<CommitHookSubCachePlugin>(std::move(pSubCachePlugin), commitHook);
+		}
+
+		template<size_t CacheId>
+		std::unique_ptr<SubCachePlugin> CreateCommitFailingSubCachePlugin() {
+			return CreateCommitHookSubCachePlugin<CacheId>([](const auto&) {
+				BITXORCORE_THROW_RUNTIME_ERROR("sub cache commit failed");
+			});
+		}
+	}
+
+	COMMIT_MODE_TEST(CommitPropagatesSubCacheCommitFailure) {
+		// Arrange: fail commit of the middle sub cache
+		BitxorCoreCacheBuilder builder;
+		AddSubCacheWithId<2>(builder);
+		AddSubCacheWithId<6>(builder);
+		builder.add(CreateCommitFailingSubCachePlugin<4>());
+		auto cache = builder.build(CommitMode);
+
+		{
+			auto delta = cache.createDelta();
+			IncrementAllSubCaches(delta);
+
+			// Act + Assert:
+			EXPECT_THROW(cache.commit(Height(123)), bitxorcore_runtime_error);
+		}
+
+		// Assert: sub caches preceding the failure are always committed but cache height is unchanged
+		auto view = cache.createView();
+		EXPECT_EQ(1u, view.sub<test::SimpleCacheT<2>>().size());
+		EXPECT_EQ(0u, view.sub<test::SimpleCacheT<4>>().size());
+		EXPECT_EQ(Height(), view.height());
+	}
+
+	TEST(TEST_CLASS, CommitCommitsAllSubCachesBeforePropagatingFailure_Parallel) {
+		// Arrange: fail commit of the first sub cache
+		BitxorCoreCacheBuilder builder;
+		builder.add(CreateCommitFailingSubCachePlugin<2>());
+		AddSubCacheWithId<4>(builder);
+		AddSubCacheWithId<6>(builder);
+		auto cache = builder.build(SubCacheCommitMode::Parallel);
+
+		{
+			auto delta = cache.createDelta();
+			IncrementAllSubCaches(delta);
+
+			// Act + Assert:
+			EXPECT_THROW(cache.commit(Height(123)), bitxorcore_runtime_error);
+		}
+
+		// Assert: all other sub caches were committed
+		auto view = cache.createView();
+		EXPECT_EQ(0u, view.sub<test::SimpleCacheT<2>>().size());
+		EXPECT_EQ(1u, view.sub<test::SimpleCacheT<4>>().size());
+		EXPECT_EQ(1u, view.sub<test::SimpleCacheT<6>>().size());
+		EXPECT_EQ(Height(), view.height());
+	}
+
+	TEST(TEST_CLASS, CommitReusesCommitThreadsAcrossCommits_Parallel) {
+		// Arrange: record the threads committing each sub cache
+		std::mutex mutex;
+		std::set<std::thread::id> commitThreadIds;
+		auto commitHook = [&mutex, &commitThreadIds](auto& subCachePlugin) {
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				commitThreadIds.insert(std::this_thread::get_id());
+			}
+
+			subCachePlugin.commit();
+		};
+
+		BitxorCoreCacheBuilder builder;
+		builder.add(CreateCommitHookSubCachePlugin<2>(commitHook));
+		builder.add(CreateCommitHookSubCachePlugin<4>(commitHook));
+		builder.add(CreateCommitHookSubCachePlugin<6>(commitHook));
+		auto cache = builder.build(SubCacheCommitMode::Parallel);
+
+		// Act: commit multiple times
+		for (auto i = 0u; i < 5; ++i)
+			CommitChangeToAllSubCaches(cache);
+
+		// Assert: all commits were performed by (at most) one worker per sub cache, none of which is the calling thread
+		EXPECT_GE(3u, commitThreadIds.size());
+		EXPECT_EQ(commitThreadIds.cend(), commitThreadIds.find(std::this_thread::get_id()));
+
+		auto view = cache.createView();
+		AssertSubCacheSizes(view, 5);
+	}
+
 	TEST(TEST_CLASS, CommitOfSubCacheInvalidatesDetachedDelta) {
 		// Arrange:
 		auto cache = CreateSimpleBitxorCoreCache();
@@ -411,9 +600,9 @@ namespace bitxorcore { namespace cache {
 		EXPECT_EQ(Height(0), cache.createDetachableDelta().height());
 	}
 
-	TEST(TEST_CLASS, CommitUpdatesCacheHeight) {
+	COMMIT_MODE_TEST(CommitUpdatesCacheHeight) {
 		// Arrange:
-		auto cache = CreateSimpleBitxorCoreCache();
+		auto cache = CreateSimpleBitxorCoreCache(CommitMode);
 		{
 			// Act:
 			auto delta = cache.createDelta();
@@ -425,6 +614,33 @@ namespace bitxorcore { namespace cache {
 		EXPECT_EQ(Height(123), cache.createDetachableDelta().height());
 	}
 
+	TEST(TEST_CLASS, CommitCommitsSharedDatabase) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto databaseConfig = config::NodeConfiguration::CacheDatabaseSubConfiguration();
+		auto pSharedDatabase = std::make_shared<SharedRocksDatabase>(dbDirGuard.name(), databaseConfig);
+		RocksDatabase database(RocksDatabaseSettings("alpha", databaseConfig, { "default" }, FilterPruningMode::Disabled, pSharedDatabase));
+
+		BitxorCoreCacheBuilder builder;
+		AddSubCacheWithId<2>(builder);
+		auto cache = builder.build(SubCacheCommitMode::Sequential, pSharedDatabase);
+
+		database.put(0, "hello", "amazing");
+
+		// Sanity:
+		EXPECT_EQ(1u, pSharedDatabase->numPendingWrites());
+
+		{
+			// Act:
+			auto delta = cache.createDelta();
+			cache.commit(Height(123));
+		}
+
+		// Assert:
+		EXPECT_EQ(0u, pSharedDatabase->numPendingWrites());
+		EXPECT_EQ(Height(123), cache.createView().height());
+	}
+
 	// endregion
 
 	// region dependent state
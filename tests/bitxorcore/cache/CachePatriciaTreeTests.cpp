@@ -242,4 +242,71 @@ namespace bitxorcore { namespace cache {
 	}
 
 	// endregion
+
+	// region enabled - node cache
+
+	TEST(TEST_CLASS, Enabled_NodeCacheIsNotCreatedWhenMaxCachedNodesIsZero) {
+		// Arrange:
+		CacheDatabaseHolder holder;
+
+		// Act:
+		CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1, 0);
+
+		// Assert:
+		EXPECT_FALSE(!!tree.nodeCache());
+	}
+
+	TEST(TEST_CLASS, Enabled_NodeCacheIsCreatedWhenMaxCachedNodesIsNonzero) {
+		// Arrange:
+		CacheDatabaseHolder holder;
+
+		// Act:
+		CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1, 100);
+
+		// Assert:
+		ASSERT_TRUE(!!tree.nodeCache());
+		EXPECT_EQ(0u, tree.nodeCache()->size());
+		EXPECT_EQ(0u, tree.nodeCache()->numPinnedNodes());
+	}
+
+	TEST(TEST_CLASS, Enabled_CommitPinsTopLevelsOfNewRoot) {
+		// Arrange:
+		CacheDatabaseHolder holder;
+		CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1, 100);
+
+		// Act:
+		auto pDeltaTree = tree.rebase();
+		pDeltaTree->set(0x01'23'4A'B6, "alpha");
+		pDeltaTree->set(0x01'23'4A'99, "beta");
+		tree.commit();
+
+		// Assert: only the root branch node is pinned because leaf nodes are never cached
+		const auto* pNodeCache = tree.nodeCache();
+		ASSERT_TRUE(!!pNodeCache);
+		EXPECT_EQ(1u, pNodeCache->numPinnedNodes());
+		EXPECT_EQ(1u, pNodeCache->generation());
+	}
+
+	TEST(TEST_CLASS, Enabled_InitializationPinsTopLevelsOfRootInDb) {
+		// Arrange: commit a tree with a branch root
+		CacheDatabaseHolder holder;
+		{
+			CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1);
+			auto pDeltaTree = tree.rebase();
+			pDeltaTree->set(0x01'23'4A'B6, "alpha");
+			pDeltaTree->set(0x01'23'4A'99, "beta");
+			tree.commit();
+		}
+
+		// Act:
+		CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1, 100);
+
+		// Assert:
+		const auto* pNodeCache = tree.nodeCache();
+		ASSERT_TRUE(!!pNodeCache);
+		EXPECT_EQ(1u, pNodeCache->numPinnedNodes());
+		EXPECT_EQ(1u, pNodeCache->generation());
+	}
+
+	// endregion
 }}
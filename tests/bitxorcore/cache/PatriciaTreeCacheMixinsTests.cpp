@@ -160,6 +160,56 @@ namespace bitxorcore { namespace cache {
 
 	// endregion
 
+	// region PatriciaTreeMixin - tryLookupAll
+
+	TEST(TEST_CLASS, ViewMixin_LookupAllReturnsFalseWhenTreeIsNullptr) {
+		// Arrange:
+		auto mixin = PatriciaTreeMixin<MemoryPatriciaTree>(nullptr);
+
+		// Act:
+		std::vector<tree::TreeNode> nodes;
+		auto results = mixin.tryLookupAll({ 0x64'6F'67'65, 0x64'6F'67'64 }, nodes);
+
+		// Assert:
+		ASSERT_EQ(2u, results.size());
+		for (const auto& result : results) {
+			EXPECT_FALSE(result.second);
+			EXPECT_EQ(Hash256(), result.first);
+		}
+
+		EXPECT_TRUE(nodes.empty());
+	}
+
+	TEST(TEST_CLASS, ViewMixin_LookupAllForwardsToUnderlyingTreeWhenTreeIsValid) {
+		// Arrange:
+		tree::MemoryDataSource dataSource;
+		MemoryPatriciaTree tree(dataSource);
+		test::SeedTreeWithFourNodes(tree);
+
+		auto mixin = PatriciaTreeMixin<MemoryPatriciaTree>(&tree);
+
+		// Act:
+		std::vector<tree::TreeNode> nodes;
+		auto results = mixin.tryLookupAll({ 0x64'6F'67'65, 0x64'6F'67'64 }, nodes);
+
+		// Assert:
+		ASSERT_EQ(2u, results.size());
+		EXPECT_TRUE(results[0].second);
+		EXPECT_NE(Hash256(), results[0].first);
+		EXPECT_FALSE(results[1].second);
+		EXPECT_EQ(Hash256(), results[1].first);
+
+		// - both keys share the same path, which ends at leaf `0x64'6F'67'65`
+		ASSERT_EQ(4u, nodes.size());
+		EXPECT_TRUE(nodes.back().isLeaf());
+
+		const auto& nodesLeaf = nodes.back().asLeafNode();
+		EXPECT_EQ(tree::TreeNodePath(0x64'6F'67'65).subpath(7), nodesLeaf.path());
+		EXPECT_EQ(nodesLeaf.value(), results[0].first);
+	}
+
+	// endregion
+
 	// region PatriciaTreeDeltaMixin - supportsMerkleRoot
 
 	TEST(TEST_CLASS, DeltaMixin_SupportsReturnsFalseWhenTreeIsNullptr) {
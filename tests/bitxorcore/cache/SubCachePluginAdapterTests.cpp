@@ -481,6 +481,39 @@ namespace bitxorcore { namespace cache {
 
 	// endregion
 
+	// region hasChanges
+
+	TEST(TEST_CLASS, HasChangesReturnsFalseForView) {
+		// Arrange:
+		SimpleCachePluginAdapter adapter(CreateSimpleCacheWithValue(5));
+		auto pView = adapter.createView();
+
+		// Act + Assert:
+		EXPECT_FALSE(pView->hasChanges());
+	}
+
+	TEST(TEST_CLASS, HasChangesReturnsTrueForDeltaWithDeltaElements) {
+		// Arrange: simple cache delta always returns (non-empty) delta elements
+		SimpleCachePluginAdapter adapter(CreateSimpleCacheWithValue(5));
+		auto pDelta = adapter.createDelta();
+
+		// Act + Assert:
+		EXPECT_TRUE(pDelta->hasChanges());
+	}
+
+	TEST(TEST_CLASS, HasChangesReturnsTrueForDetachedDeltaWithDeltaElements) {
+		// Arrange: simple cache delta always returns (non-empty) delta elements
+		SimpleCachePluginAdapter adapter(CreateSimpleCacheWithValue(5));
+		auto pDetachedDelta = adapter.createDetachedDelta();
+		auto pDelta = pDetachedDelta->tryLock();
+
+		// Act + Assert:
+		ASSERT_TRUE(!!pDelta);
+		EXPECT_TRUE(pDelta->hasChanges());
+	}
+
+	// endregion
+
 	// region createDetachedDelta
 
 	TEST(TEST_CLASS, CanAccessDetachedDelta) {
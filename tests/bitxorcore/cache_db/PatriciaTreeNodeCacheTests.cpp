@@ -0,0 +1,332 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/cache_db/PatriciaTreeNodeCache.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace bitxorcore { namespace cache {
+
+#define TEST_CLASS PatriciaTreeNodeCacheTests
+
+	namespace {
+		tree::BranchTreeNode CreateBranchNode(uint32_t pathValue, const std::vector<std::pair<size_t, Hash256>>& links) {
+			auto node = tree::BranchTreeNode(tree::TreeNodePath(pathValue));
+			for (const auto& link : links)
+				node.setLink(link.second, link.first);
+
+			return node;
+		}
+
+		tree::BranchTreeNode CreateRandomBranchNode() {
+			return CreateBranchNode(static_cast<uint32_t>(test::Random()), { { 2, test::GenerateRandomByteArray<Hash256>() } });
+		}
+
+		void AssertStatistics(const PatriciaTreeNodeCache& cache, uint64_t numHits, uint64_t numMisses, uint64_t numEvictions) {
+			const auto& statistics = cache.statistics();
+			EXPECT_EQ(numHits, statistics.NumHits);
+			EXPECT_EQ(numMisses, statistics.NumMisses);
+			EXPECT_EQ(numEvictions, statistics.NumEvictions);
+		}
+
+		void AssertCached(
+				PatriciaTreeNodeCache& cache,
+				const std::vector<tree::BranchTreeNode>& nodes,
+				const std::vector<bool>& expectedFlags) {
+			for (auto i = 0u; i < nodes.size(); ++i) {
+				auto node = cache.find(nodes[i].hash());
+				EXPECT_EQ(expectedFlags[i], !node.empty()) << "node " << i;
+				if (!node.empty())
+					EXPECT_EQ(nodes[i].hash(), node.hash()) << "node " << i;
+			}
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyCache) {
+		// Act:
+		PatriciaTreeNodeCache cache(10, 2);
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_EQ(0u, cache.numPinnedNodes());
+		EXPECT_EQ(0u, cache.generation());
+		AssertStatistics(cache, 0, 0, 0);
+	}
+
+	// endregion
+
+	// region find / insert
+
+	TEST(TEST_CLASS, FindReturnsEmptyNodeWhenNodeIsNotCached) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(10, 2);
+		cache.insert(CreateRandomBranchNode());
+
+		// Act:
+		auto node = cache.find(test::GenerateRandomByteArray<Hash256>());
+
+		// Assert:
+		EXPECT_TRUE(node.empty());
+		AssertStatistics(cache, 0, 1, 0);
+	}
+
+	TEST(TEST_CLASS, FindReturnsCopyOfCachedNode) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(10, 2);
+		auto branchNode = CreateRandomBranchNode();
+		cache.insert(branchNode);
+
+		// Act:
+		auto node = cache.find(branchNode.hash());
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		ASSERT_TRUE(node.isBranch());
+		EXPECT_EQ(branchNode.hash(), node.hash());
+		EXPECT_EQ(branchNode.path(), node.path());
+		EXPECT_EQ(branchNode.link(2), node.asBranchNode().link(2));
+		AssertStatistics(cache, 1, 0, 0);
+	}
+
+	TEST(TEST_CLASS, InsertOfCachedNodeHasNoEffect) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(10, 2);
+		auto branchNode = CreateRandomBranchNode();
+		cache.insert(branchNode);
+
+		// Act:
+		cache.insert(branchNode);
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		AssertStatistics(cache, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, LeastRecentlyInsertedNodeIsEvictedWhenCacheIsFull) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(3, 2);
+		std::vector<tree::BranchTreeNode> nodes;
+		for (auto i = 0u; i < 4; ++i)
+			nodes.push_back(CreateRandomBranchNode());
+
+		// Act:
+		for (const auto& node : nodes)
+			cache.insert(node);
+
+		// Assert:
+		EXPECT_EQ(3u, cache.size());
+		AssertCached(cache, nodes, { false, true, true, true });
+		AssertStatistics(cache, 3, 1, 1);
+	}
+
+	TEST(TEST_CLASS, FindMarksNodeAsRecentlyUsed) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(3, 2);
+		std::vector<tree::BranchTreeNode> nodes;
+		for (auto i = 0u; i < 4; ++i)
+			nodes.push_back(CreateRandomBranchNode());
+
+		for (auto i = 0u; i < 3; ++i)
+			cache.insert(nodes[i]);
+
+		// Act: use first node before inserting fourth node
+		cache.find(nodes[0].hash());
+		cache.insert(nodes[3]);
+
+		// Assert: second node is least recently used
+		EXPECT_EQ(3u, cache.size());
+		AssertCached(cache, nodes, { true, false, true, true });
+		AssertStatistics(cache, 4, 1, 1);
+	}
+
+	// endregion
+
+	// region pin
+
+	namespace {
+		// root (branch) -> { child1 (branch) -> { grandchild (branch) -> leaf1, leaf2 }, child2 (branch) -> leaf1, leaf3 }
+		class TestTree {
+		public:
+			TestTree()
+					: m_numLoads(0)
+					, Leaf1(tree::TreeNodePath(0x12u), test::GenerateRandomByteArray<Hash256>())
+					, Leaf2(tree::TreeNodePath(0x34u), test::GenerateRandomByteArray<Hash256>())
+					, Leaf3(tree::TreeNodePath(0x56u), test::GenerateRandomByteArray<Hash256>())
+					, Grandchild(CreateBranchNode(0x78, { { 0, Leaf1.hash() } }))
+					, Child1(CreateBranchNode(0x9A, { { 0, Grandchild.hash() }, { 1, Leaf2.hash() } }))
+					, Child2(CreateBranchNode(0xBC, { { 3, Leaf1.hash() }, { 7, Leaf3.hash() } }))
+					, Root(CreateBranchNode(0xDE, { { 4, Child1.hash() }, { 9, Child2.hash() } })) {
+				for (const auto& node : { tree::TreeNode(Leaf1), tree::TreeNode(Leaf2), tree::TreeNode(Leaf3) })
+					m_nodes.emplace(node.hash(), node.copy());
+
+				for (const auto& node : { Grandchild, Child1, Child2, Root })
+					m_nodes.emplace(node.hash(), tree::TreeNode(node));
+			}
+
+		public:
+			size_t numLoads() const {
+				return m_numLoads;
+			}
+
+			PatriciaTreeNodeCache::NodeLoader loader() {
+				return [this](const auto& hash) {
+					++m_numLoads;
+					auto iter = m_nodes.find(hash);
+					return m_nodes.cend() == iter ? tree::TreeNode() : iter->second.copy();
+				};
+			}
+
+		private:
+			size_t m_numLoads;
+			std::unordered_map<Hash256, tree::TreeNode, utils::ArrayHasher<Hash256>> m_nodes;
+
+		public:
+			tree::LeafTreeNode Leaf1;
+			tree::LeafTreeNode Leaf2;
+			tree::LeafTreeNode Leaf3;
+			tree::BranchTreeNode Grandchild;
+			tree::BranchTreeNode Child1;
+			tree::BranchTreeNode Child2;
+			tree::BranchTreeNode Root;
+		};
+	}
+
+	TEST(TEST_CLASS, PinWithZeroRootHashDoesNotPinAnyNodes) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(10, 2);
+		TestTree testTree;
+
+		// Act:
+		cache.pin(Hash256(), testTree.loader());
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_EQ(0u, cache.numPinnedNodes());
+		EXPECT_EQ(1u, cache.generation());
+		EXPECT_EQ(0u, testTree.numLoads());
+	}
+
+	TEST(TEST_CLASS, PinLoadsAndPinsBranchNodesInTopLevels) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(10, 2);
+		TestTree testTree;
+
+		// Act:
+		cache.pin(testTree.Root.hash(), testTree.loader());
+
+		// Assert: root and its children are pinned
+		EXPECT_EQ(3u, cache.size());
+		EXPECT_EQ(3u, cache.numPinnedNodes());
+		EXPECT_EQ(1u, cache.generation());
+		EXPECT_EQ(3u, testTree.numLoads());
+		AssertCached(cache, { testTree.Root, testTree.Child1, testTree.Child2, testTree.Grandchild }, { true, true, true, false });
+	}
+
+	TEST(TEST_CLASS, PinDoesNotPinLeafNodes) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(10, 4);
+		TestTree testTree;
+
+		// Act:
+		cache.pin(testTree.Root.hash(), testTree.loader());
+
+		// Assert: all branch nodes are pinned and all leaf nodes are loaded (leaf1 twice)
+		EXPECT_EQ(4u, cache.size());
+		EXPECT_EQ(4u, cache.numPinnedNodes());
+		EXPECT_EQ(8u, testTree.numLoads());
+		AssertCached(cache, { testTree.Root, testTree.Child1, testTree.Child2, testTree.Grandchild }, { true, true, true, true });
+	}
+
+	TEST(TEST_CLASS, PinDoesNotLoadCachedNodes) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(10, 2);
+		TestTree testTree;
+		cache.insert(testTree.Root);
+		cache.insert(testTree.Child2);
+
+		// Act:
+		cache.pin(testTree.Root.hash(), testTree.loader());
+
+		// Assert:
+		EXPECT_EQ(3u, cache.size());
+		EXPECT_EQ(3u, cache.numPinnedNodes());
+		EXPECT_EQ(1u, testTree.numLoads());
+		AssertStatistics(cache, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, PinnedNodesAreNotEvicted) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(1, 2);
+		TestTree testTree;
+		cache.pin(testTree.Root.hash(), testTree.loader());
+
+		// Act:
+		auto branchNode1 = CreateRandomBranchNode();
+		auto branchNode2 = CreateRandomBranchNode();
+		cache.insert(branchNode1);
+		cache.insert(branchNode2);
+
+		// Assert: only unpinned nodes count towards capacity
+		EXPECT_EQ(4u, cache.size());
+		EXPECT_EQ(3u, cache.numPinnedNodes());
+		auto expectedNodes = std::vector<tree::BranchTreeNode>{ testTree.Root, testTree.Child1, testTree.Child2, branchNode1, branchNode2 };
+		AssertCached(cache, expectedNodes, { true, true, true, false, true });
+	}
+
+	TEST(TEST_CLASS, PinUnpinsNodesPinnedByPreviousGeneration) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(10, 2);
+		TestTree testTree;
+		cache.pin(testTree.Root.hash(), testTree.loader());
+
+		// Act: pin subtree rooted at child1
+		cache.pin(testTree.Child1.hash(), testTree.loader());
+
+		// Assert: child1 and grandchild are pinned and previously pinned nodes are still cached
+		EXPECT_EQ(4u, cache.size());
+		EXPECT_EQ(2u, cache.numPinnedNodes());
+		EXPECT_EQ(2u, cache.generation());
+		AssertCached(cache, { testTree.Root, testTree.Child1, testTree.Child2, testTree.Grandchild }, { true, true, true, true });
+	}
+
+	TEST(TEST_CLASS, NodesUnpinnedByNewGenerationAreEvictedFirst) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(3, 2);
+		TestTree testTree;
+		auto branchNode = CreateRandomBranchNode();
+		cache.insert(branchNode);
+		cache.pin(testTree.Root.hash(), testTree.loader());
+
+		// Act: pin subtree rooted at child1, which unpins root and child2
+		cache.pin(testTree.Child1.hash(), testTree.loader());
+		cache.insert(CreateRandomBranchNode());
+
+		// Assert: superseded child2 is evicted before the less recently inserted branch node
+		EXPECT_EQ(5u, cache.size());
+		AssertCached(cache, { testTree.Root, testTree.Child2, branchNode }, { true, false, true });
+		AssertStatistics(cache, 2, 1, 1);
+	}
+
+	// endregion
+}}
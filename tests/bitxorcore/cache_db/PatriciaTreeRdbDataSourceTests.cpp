@@ -36,14 +36,21 @@ namespace bitxorcore { namespace cache {
 
 		class RocksDataSourceWrapper {
 		public:
-			RocksDataSourceWrapper()
+			RocksDataSourceWrapper() : RocksDataSourceWrapper(0)
+			{}
+
+			explicit RocksDataSourceWrapper(size_t maxCachedNodes)
 					: m_db(DefaultSettings(m_dbDirGuard.name()))
 					, m_container(m_db, 0)
-					, m_dataSource(m_container) {
+					, m_dataSource(m_container, maxCachedNodes, 2) {
 				m_container.setSize(0);
 			}
 
 		public:
+			const PatriciaTreeNodeCache* nodeCache() const {
+				return m_dataSource.nodeCache();
+			}
+
 			size_t size() {
 				return m_dataSource.size();
 			}
@@ -69,10 +76,72 @@ namespace bitxorcore { namespace cache {
 			PatriciaTreeRdbDataSource m_dataSource;
 		};
 
+		class CachingRocksDataSourceWrapper : public RocksDataSourceWrapper {
+		public:
+			CachingRocksDataSourceWrapper() : RocksDataSourceWrapper(100)
+			{}
+		};
+
 		struct RocksDataSourceTraits {
 			using DataSourceType = RocksDataSourceWrapper;
 		};
+
+		struct CachingRocksDataSourceTraits {
+			using DataSourceType = CachingRocksDataSourceWrapper;
+		};
 	}
 
 	DEFINE_PATRICIA_TREE_DATA_SOURCE_TESTS(RocksDataSourceTraits)
+
+	// region node cache
+
+	TEST(TEST_CLASS, NodeCacheIsNotCreatedWhenMaxCachedNodesIsZero) {
+		// Act:
+		RocksDataSourceWrapper dataSource;
+
+		// Assert:
+		EXPECT_FALSE(!!dataSource.nodeCache());
+	}
+
+	TEST(TEST_CLASS, SetCachesBranchNode) {
+		// Arrange:
+		CachingRocksDataSourceWrapper dataSource;
+		auto node = tree::BranchTreeNode(tree::TreeNodePath(0x64'6F'67'00));
+		node.setLink(test::GenerateRandomByteArray<Hash256>(), 4);
+
+		// Act:
+		dataSource.set(node);
+		auto foundNode = dataSource.get(node.hash());
+
+		// Assert:
+		ASSERT_TRUE(!!dataSource.nodeCache());
+		EXPECT_EQ(1u, dataSource.nodeCache()->size());
+		EXPECT_EQ(1u, dataSource.nodeCache()->statistics().NumHits);
+		EXPECT_EQ(0u, dataSource.nodeCache()->statistics().NumMisses);
+		EXPECT_EQ(node.hash(), foundNode.hash());
+	}
+
+	TEST(TEST_CLASS, SetDoesNotCacheLeafNode) {
+		// Arrange:
+		CachingRocksDataSourceWrapper dataSource;
+		auto node = tree::LeafTreeNode(tree::TreeNodePath(0x64'6F'67'00), test::GenerateRandomByteArray<Hash256>());
+
+		// Act:
+		dataSource.set(node);
+		auto foundNode = dataSource.get(node.hash());
+
+		// Assert: leaf is loaded from the database
+		ASSERT_TRUE(!!dataSource.nodeCache());
+		EXPECT_EQ(0u, dataSource.nodeCache()->size());
+		EXPECT_EQ(0u, dataSource.nodeCache()->statistics().NumHits);
+		EXPECT_EQ(1u, dataSource.nodeCache()->statistics().NumMisses);
+		EXPECT_EQ(node.hash(), foundNode.hash());
+	}
+
+	// endregion
+
+#undef TEST_CLASS
+#define TEST_CLASS PatriciaTreeRdbDataSourceCachingTests
+
+	DEFINE_PATRICIA_TREE_DATA_SOURCE_TESTS(CachingRocksDataSourceTraits)
 }}
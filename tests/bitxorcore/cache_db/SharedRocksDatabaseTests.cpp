@@ -0,0 +1,452 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/cache_db/SharedRocksDatabase.h"
+#include "bitxorcore/cache_db/RocksDatabase.h"
+#include "bitxorcore/cache_db/RocksInclude.h"
+#include "tests/bitxorcore/cache_db/test/RdbTestUtils.h"
+#include "tests/bitxorcore/cache_db/test/SliceTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <algorithm>
+#include <thread>
+
+namespace bitxorcore { namespace cache {
+
+#define TEST_CLASS SharedRocksDatabaseTests
+
+	namespace {
+		auto CreateSharedDatabase(const std::string& directory) {
+			return std::make_shared<SharedRocksDatabase>(directory, config::NodeConfiguration::CacheDatabaseSubConfiguration());
+		}
+
+		auto CreateHostedSettings(
+				const std::string& name,
+				const std::vector<std::string>& columnNames,
+				const std::shared_ptr<SharedRocksDatabase>& pSharedDatabase,
+				FilterPruningMode pruningMode = FilterPruningMode::Disabled) {
+			return RocksDatabaseSettings(
+					name,
+					config::NodeConfiguration::CacheDatabaseSubConfiguration(),
+					columnNames,
+					pruningMode,
+					pSharedDatabase);
+		}
+
+		void AssertValue(RocksDatabase& database, size_t columnId, const std::string& key, const std::string& value) {
+			RdbDataIterator iter;
+			database.get(columnId, key, iter);
+			test::AssertIteratorValue(value, iter);
+		}
+
+		void AssertNoValue(RocksDatabase& database, size_t columnId, const std::string& key) {
+			RdbDataIterator iter;
+			database.get(columnId, key, iter);
+			EXPECT_EQ(RdbDataIterator::End(), iter) << key;
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateSharedDatabase) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+
+		// Act:
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+
+		// Assert:
+		EXPECT_EQ(dbDirGuard.name(), pSharedDatabase->databaseDirectory());
+		EXPECT_EQ(std::vector<std::string>({ "default" }), pSharedDatabase->columnFamilyNames());
+		EXPECT_EQ(0u, pSharedDatabase->numPendingWrites());
+	}
+
+	TEST(TEST_CLASS, CanReopenSharedDatabaseWithExistingColumnFamilies) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		{
+			auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+			RocksDatabase database(CreateHostedSettings("alpha", { "default", "beta" }, pSharedDatabase));
+		}
+
+		// Act:
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+		auto columnFamilyNames = pSharedDatabase->columnFamilyNames();
+		std::sort(columnFamilyNames.begin(), columnFamilyNames.end());
+
+		// Assert:
+		EXPECT_EQ(std::vector<std::string>({ "alpha.beta", "alpha.default", "default" }), columnFamilyNames);
+	}
+
+	TEST(TEST_CLASS, ColumnFamilyNameIsPrefixed) {
+		EXPECT_EQ("AccountStateCache.default", SharedRocksDatabase::ColumnFamilyName("AccountStateCache", "default"));
+		EXPECT_EQ("alpha.patricia_tree", SharedRocksDatabase::ColumnFamilyName("alpha", "patricia_tree"));
+	}
+
+	// endregion
+
+	// region acquireColumnFamilies / releaseColumnFamilies
+
+	TEST(TEST_CLASS, CannotAcquireEmptyColumnFamilies) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+
+		// Act + Assert:
+		EXPECT_THROW(pSharedDatabase->acquireColumnFamilies("alpha", {}, FilterPruningMode::Disabled), bitxorcore_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanAcquireColumnFamilies) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+
+		// Act:
+		auto handles = pSharedDatabase->acquireColumnFamilies("alpha", { "default", "beta" }, FilterPruningMode::Disabled);
+
+		// Assert:
+		ASSERT_EQ(2u, handles.size());
+		EXPECT_EQ("alpha.default", handles[0]->GetName());
+		EXPECT_EQ("alpha.beta", handles[1]->GetName());
+		EXPECT_EQ(3u, pSharedDatabase->columnFamilyNames().size());
+	}
+
+	TEST(TEST_CLASS, CannotAcquireColumnFamilyThatIsAlreadyAcquired) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+		pSharedDatabase->acquireColumnFamilies("alpha", { "default", "beta" }, FilterPruningMode::Disabled);
+
+		// Act + Assert:
+		EXPECT_THROW(
+				pSharedDatabase->acquireColumnFamilies("alpha", { "gamma", "beta" }, FilterPruningMode::Disabled),
+				bitxorcore_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanAcquireColumnFamiliesWithSameNamesAndDifferentPrefixes) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+		auto handles1 = pSharedDatabase->acquireColumnFamilies("alpha", { "default" }, FilterPruningMode::Disabled);
+
+		// Act:
+		auto handles2 = pSharedDatabase->acquireColumnFamilies("beta", { "default" }, FilterPruningMode::Disabled);
+
+		// Assert:
+		EXPECT_NE(handles1[0]->GetID(), handles2[0]->GetID());
+	}
+
+	TEST(TEST_CLASS, CanReacquireReleasedColumnFamilies) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+		auto handles1 = pSharedDatabase->acquireColumnFamilies("alpha", { "default" }, FilterPruningMode::Disabled);
+		pSharedDatabase->releaseColumnFamilies(handles1);
+
+		// Act:
+		auto handles2 = pSharedDatabase->acquireColumnFamilies("alpha", { "default" }, FilterPruningMode::Disabled);
+
+		// Assert: existing handle is reused
+		EXPECT_EQ(handles1, handles2);
+	}
+
+	// endregion
+
+	// region hosted databases - read / write
+
+	TEST(TEST_CLASS, PendingWritesAreVisibleToReads) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+		RocksDatabase database(CreateHostedSettings("alpha", { "default" }, pSharedDatabase));
+
+		// Act:
+		database.put(0, "hello", "amazing");
+		database.put(0, "world", "awesome");
+		database.del(0, "world");
+		database.flush();
+
+		// Assert:
+		EXPECT_EQ(3u, pSharedDatabase->numPendingWrites());
+		AssertValue(database, 0, "hello", "amazing");
+		AssertNoValue(database, 0, "world");
+	}
+
+	TEST(TEST_CLASS, HostedDatabasesAreIsolated) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+		RocksDatabase database1(CreateHostedSettings("alpha", { "default", "beta" }, pSharedDatabase));
+		RocksDatabase database2(CreateHostedSettings("gamma", { "default" }, pSharedDatabase));
+
+		// Act:
+		database1.put(0, "hello", "amazing");
+		database1.put(1, "hello", "awesome");
+		database2.put(0, "hello", "incredible");
+
+		// Assert:
+		AssertValue(database1, 0, "hello", "amazing");
+		AssertValue(database1, 1, "hello", "awesome");
+		AssertValue(database2, 0, "hello", "incredible");
+	}
+
+	TEST(TEST_CLASS, FlushDoesNotWritePendingWrites) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+		{
+			RocksDatabase database(CreateHostedSettings("alpha", { "default" }, pSharedDatabase));
+			database.put(0, "hello", "amazing");
+
+			// Act:
+			database.flush();
+		}
+
+		// Assert: writes are still pending
+		EXPECT_EQ(1u, pSharedDatabase->numPendingWrites());
+	}
+
+	TEST(TEST_CLASS, CommitWritesAllPendingWritesAtomically) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		{
+			auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+			RocksDatabase database1(CreateHostedSettings("alpha", { "default" }, pSharedDatabase));
+			RocksDatabase database2(CreateHostedSettings("gamma", { "default" }, pSharedDatabase));
+			database1.put(0, "hello", "amazing");
+			database2.put(0, "world", "awesome");
+
+			// Act:
+			pSharedDatabase->commit();
+
+			// Assert:
+			EXPECT_EQ(0u, pSharedDatabase->numPendingWrites());
+		}
+
+		// - reopen the database and check all writes were persisted
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+		RocksDatabase database1(CreateHostedSettings("alpha", { "default" }, pSharedDatabase));
+		RocksDatabase database2(CreateHostedSettings("gamma", { "default" }, pSharedDatabase));
+		AssertValue(database1, 0, "hello", "amazing");
+		AssertValue(database2, 0, "world", "awesome");
+		AssertNoValue(database1, 0, "world");
+	}
+
+	TEST(TEST_CLASS, DestructionCommitsPendingWrites) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		{
+			auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+			RocksDatabase database(CreateHostedSettings("alpha", { "default" }, pSharedDatabase));
+
+			// Act:
+			database.put(0, "hello", "amazing");
+		}
+
+		// Assert:
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+		RocksDatabase database(CreateHostedSettings("alpha", { "default" }, pSharedDatabase));
+		AssertValue(database, 0, "hello", "amazing");
+	}
+
+	TEST(TEST_CLASS, HostedDatabaseWritesAreNotFlushedWhenBatchIsFull) {
+		// Arrange: use a tiny batch size
+		test::TempDirectoryGuard dbDirGuard;
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+		auto config = config::NodeConfiguration::CacheDatabaseSubConfiguration();
+		config.MaxWriteBatchSize = utils::FileSize::FromBytes(1);
+		RocksDatabase database(RocksDatabaseSettings("alpha", config, { "default" }, FilterPruningMode::Disabled, pSharedDatabase));
+
+		// Act:
+		for (auto i = 0u; i < 10; ++i)
+			database.put(0, std::to_string(i), "value");
+
+		// Assert: nothing was written
+		EXPECT_EQ(10u, pSharedDatabase->numPendingWrites());
+	}
+
+	TEST(TEST_CLASS, ColumnFamilyBatchIsNotWrittenWhenMaxWriteBatchSizeIsExceeded) {
+		// Arrange: use a small batch size for the shared database
+		test::TempDirectoryGuard dbDirGuard;
+		auto config = config::NodeConfiguration::CacheDatabaseSubConfiguration();
+		config.MaxWriteBatchSize = utils::FileSize::FromBytes(100);
+		auto pSharedDatabase = std::make_shared<SharedRocksDatabase>(dbDirGuard.name(), config);
+		RocksDatabase database1(CreateHostedSettings("alpha", { "default" }, pSharedDatabase));
+		RocksDatabase database2(CreateHostedSettings("gamma", { "default" }, pSharedDatabase));
+		database2.put(0, "hello", "amazing");
+
+		// Act: exceed batch size in first column family
+		for (auto i = 0u; i < 10; ++i)
+			database1.put(0, std::to_string(i), std::string(20, 'x'));
+
+		// Assert: nothing was written early, so the block is still committed atomically
+		EXPECT_EQ(11u, pSharedDatabase->numPendingWrites());
+		for (auto i = 0u; i < 10; ++i)
+			AssertValue(database1, 0, std::to_string(i), std::string(20, 'x'));
+
+		AssertValue(database2, 0, "hello", "amazing");
+	}
+
+	TEST(TEST_CLASS, CanWriteToDifferentColumnFamiliesConcurrently) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+		std::vector<std::unique_ptr<RocksDatabase>> databases;
+		for (auto i = 0u; i < 4; ++i)
+			databases.push_back(std::make_unique<RocksDatabase>(CreateHostedSettings(std::to_string(i), { "default" }, pSharedDatabase)));
+
+		// Act:
+		std::vector<std::thread> threads;
+		for (const auto& pDatabase : databases) {
+			threads.emplace_back([&database = *pDatabase]() {
+				for (auto i = 0u; i < 100; ++i)
+					database.put(0, std::to_string(i), "value");
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		// Assert:
+		EXPECT_EQ(400u, pSharedDatabase->numPendingWrites());
+		for (const auto& pDatabase : databases) {
+			for (auto i = 0u; i < 100; ++i)
+				AssertValue(*pDatabase, 0, std::to_string(i), "value");
+		}
+	}
+
+	// endregion
+
+	// region statistics
+
+	TEST(TEST_CLASS, StatisticsAreInitiallyZero) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+
+		// Act:
+		auto statistics = pSharedDatabase->statistics();
+
+		// Assert:
+		EXPECT_EQ(0u, statistics.NumEstimatedKeys);
+		EXPECT_EQ(0u, statistics.LiveSstFilesSize);
+		EXPECT_EQ(0u, statistics.NumBlockCacheHits);
+		EXPECT_EQ(0u, statistics.NumBlockCacheMisses);
+		EXPECT_EQ(0u, statistics.NumBytesRead);
+		EXPECT_EQ(0u, statistics.NumBytesWritten);
+	}
+
+	namespace {
+		SharedRocksDatabaseStatistics CommitAndGetStatistics(bool enableStatistics) {
+			test::TempDirectoryGuard dbDirGuard;
+			auto config = config::NodeConfiguration::CacheDatabaseSubConfiguration();
+			config.EnableStatistics = enableStatistics;
+			auto pSharedDatabase = std::make_shared<SharedRocksDatabase>(dbDirGuard.name(), config);
+			RocksDatabase database(CreateHostedSettings("alpha", { "default" }, pSharedDatabase));
+			for (auto i = 0u; i < 10; ++i)
+				database.put(0, std::to_string(i), "value");
+
+			pSharedDatabase->commit();
+			return pSharedDatabase->statistics();
+		}
+	}
+
+	TEST(TEST_CLASS, StatisticsReflectCommittedWrites) {
+		// Act:
+		auto statistics = CommitAndGetStatistics(false);
+
+		// Assert: tickers are not collected
+		EXPECT_EQ(10u, statistics.NumEstimatedKeys);
+		EXPECT_LT(0u, statistics.MemtablesSize);
+		EXPECT_EQ(0u, statistics.NumBytesWritten);
+	}
+
+	TEST(TEST_CLASS, StatisticsIncludeTickersWhenDatabaseStatisticsAreEnabled) {
+		// Act:
+		auto statistics = CommitAndGetStatistics(true);
+
+		// Assert:
+		EXPECT_EQ(10u, statistics.NumEstimatedKeys);
+		EXPECT_LT(0u, statistics.MemtablesSize);
+		EXPECT_LT(0u, statistics.NumBytesWritten);
+	}
+
+	// endregion
+
+	// region hosted databases - prune
+
+	namespace {
+		void SeedEvenKeys(RocksDatabase& database, SharedRocksDatabase& sharedDatabase) {
+			// create 120 even keys (0 - 238)
+			for (auto i = 0u; i < 240; i += 2) {
+				auto key = static_cast<uint64_t>(i);
+				database.put(0, test::ToSlice(key), test::EvenKeyToValue(key));
+			}
+
+			sharedDatabase.commit();
+		}
+
+		bool HasEvenKey(RocksDatabase& database, uint64_t key) {
+			RdbDataIterator iter;
+			database.get(0, test::ToSlice(key), iter);
+			if (RdbDataIterator::End() == iter)
+				return false;
+
+			test::AssertIteratorValue(test::EvenKeyToValue(key), iter);
+			return true;
+		}
+	}
+
+	TEST(TEST_CLASS, PruneRemovesCommittedValuesBelowBoundary) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+		RocksDatabase database(CreateHostedSettings("alpha", { "default" }, pSharedDatabase, FilterPruningMode::Enabled));
+		SeedEvenKeys(database, *pSharedDatabase);
+
+		// Act:
+		auto numPruned = database.prune(0, 200);
+
+		// Assert:
+		EXPECT_EQ(100u, numPruned);
+		for (auto i = 0u; i < 240; i += 2)
+			EXPECT_EQ(i >= 200, HasEvenKey(database, i)) << i;
+	}
+
+	TEST(TEST_CLASS, PruneIsNoOpWhenPruningIsDisabled) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pSharedDatabase = CreateSharedDatabase(dbDirGuard.name());
+		RocksDatabase database(CreateHostedSettings("alpha", { "default" }, pSharedDatabase));
+		SeedEvenKeys(database, *pSharedDatabase);
+
+		// Act:
+		auto numPruned = database.prune(0, 200);
+
+		// Assert:
+		EXPECT_EQ(0u, numPruned);
+		for (auto i = 0u; i < 240; i += 2)
+			EXPECT_TRUE(HasEvenKey(database, i)) << i;
+	}
+
+	// endregion
+}}
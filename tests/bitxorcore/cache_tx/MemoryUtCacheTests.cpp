@@ -661,6 +661,46 @@ namespace bitxorcore { namespace cache {
 
 	// endregion
 
+	// region findTransactions
+
+	TEST(TEST_CLASS, FindTransactionsReturnsTransactionsWithMatchingShortHashes) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		test::AddAll(cache, transactionInfos);
+
+		utils::ShortHashesSet shortHashes;
+		shortHashes.insert(utils::ToShortHash(transactionInfos[1].EntityHash));
+		shortHashes.insert(utils::ToShortHash(transactionInfos[3].EntityHash));
+		shortHashes.insert(utils::ToShortHash(test::GenerateRandomByteArray<Hash256>()));
+
+		// Act:
+		auto transactions = cache.view().findTransactions(shortHashes);
+
+		// Assert:
+		AssertDeadlines(transactions, { 2, 4 });
+	}
+
+	TEST(TEST_CLASS, FindTransactionsReturnsTransactionsWithTotalSizeOfAtMostMaxResponseSize) {
+		// Arrange:
+		auto transactionSize = test::GetDefaultRandomTransactionSize();
+		MemoryUtCache cache(MemoryCacheOptions(utils::FileSize::FromBytes(2 * transactionSize), utils::FileSize::FromKilobytes(1)));
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		test::AddAll(cache, transactionInfos);
+
+		utils::ShortHashesSet shortHashes;
+		for (const auto& transactionInfo : transactionInfos)
+			shortHashes.insert(utils::ToShortHash(transactionInfo.EntityHash));
+
+		// Act:
+		auto transactions = cache.view().findTransactions(shortHashes);
+
+		// Assert:
+		AssertDeadlines(transactions, { 1, 2 });
+	}
+
+	// endregion
+
 	// region max size
 
 	TEST(TEST_CLASS, CacheCanUseMaximumMemory) {
@@ -230,4 +230,39 @@ namespace bitxorcore { namespace chain {
 	}
 
 	// endregion
+
+	// region shared resolver context
+
+	TEST(TEST_CLASS, ValidatorAndObserverContextsShareResolverContext) {
+		// Arrange:
+		TestContext context;
+		auto cacheDelta = context.Cache.createDelta();
+		context.Builder.setCache(cacheDelta);
+
+		// Act:
+		auto validatorContext = context.Builder.buildValidatorContext();
+		auto observerContext = context.Builder.buildObserverContext();
+
+		// Assert: resolver context factory is only called once
+		EXPECT_EQ(1u, context.ResolverCallPairs.first);
+		EXPECT_EQ(1u, context.ResolverCallPairs.second);
+	}
+
+	TEST(TEST_CLASS, SettingCacheRecreatesResolverContext) {
+		// Arrange:
+		TestContext context;
+		auto cacheDelta = context.Cache.createDelta();
+		context.Builder.setCache(cacheDelta);
+		context.Builder.buildValidatorContext();
+
+		// Act:
+		context.Builder.setCache(cacheDelta);
+		context.Builder.buildValidatorContext();
+
+		// Assert:
+		EXPECT_EQ(2u, context.ResolverCallPairs.first);
+		EXPECT_EQ(2u, context.ResolverCallPairs.second);
+	}
+
+	// endregion
 }}
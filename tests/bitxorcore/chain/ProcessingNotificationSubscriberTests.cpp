@@ -335,6 +335,44 @@ namespace bitxorcore { namespace chain {
 
 	// endregion
 
+	// region disableValidation
+
+	TEST(TEST_CLASS, NotificationIsOnlyPassedToObserverWhenValidationIsDisabled) {
+		// Arrange:
+		TestContext context;
+		context.setValidationResult(ValidationResult::Failure);
+		auto notification = test::CreateNotification(Notification_Type_All);
+
+		// Act: process two notifications
+		context.sub().disableValidation();
+		context.sub().notify(notification);
+		context.sub().notify(notification);
+
+		// Assert: validator is bypassed, so failure is never raised
+		EXPECT_EQ(ValidationResult::Success, context.sub().result());
+		context.assertValidatorCalls({});
+		context.assertObserverCalls({ Notification_Type_All, Notification_Type_All });
+	}
+
+	TEST(TEST_CLASS, CanDisableValidationAfterProcessingNotification) {
+		// Arrange:
+		TestContext context;
+		auto notification1 = test::CreateNotification(Notification_Type_All);
+		auto notification2 = test::CreateNotification(Notification_Type_Validator);
+
+		// Act: process two notifications
+		context.sub().notify(notification1);
+		context.sub().disableValidation();
+		context.sub().notify(notification2);
+
+		// Assert: only first notification is validated
+		EXPECT_EQ(ValidationResult::Success, context.sub().result());
+		context.assertValidatorCalls({ Notification_Type_All });
+		context.assertObserverCalls({ Notification_Type_All });
+	}
+
+	// endregion
+
 	// region undo
 
 	TEST(TEST_CLASS, CannotUndoWhenUndoIsNotEnabled) {
@@ -123,4 +123,173 @@ namespace bitxorcore { namespace chain {
 		EXPECT_EQ(1u, capture.NumActionCalls);
 		EXPECT_EQ(Default_Action_Api_Id, capture.ActionApiId);
 	}
+
+	// region processSync - multiple peers
+
+	namespace {
+		class MultiNodePacketIoPicker : public net::PacketIoPicker {
+		public:
+			explicit MultiNodePacketIoPicker(size_t numNodes) {
+				for (auto i = 0u; i < numNodes; ++i) {
+					auto identity = model::NodeIdentity{ test::GenerateRandomByteArray<Key>(), "host" + std::to_string(i) };
+					m_pairs.emplace_back(ionet::Node(identity), std::make_shared<mocks::MockPacketIo>());
+				}
+			}
+
+		public:
+			const std::vector<ionet::NodePacketIoPair>& pairs() const {
+				return m_pairs;
+			}
+
+			const std::vector<utils::TimeSpan>& pickOneDurations() const {
+				return m_ioDurations;
+			}
+
+		public:
+			ionet::NodePacketIoPair pickOne(const utils::TimeSpan& ioDuration) override {
+				m_ioDurations.push_back(ioDuration);
+				return m_ioDurations.size() > m_pairs.size() ? ionet::NodePacketIoPair() : m_pairs[m_ioDurations.size() - 1];
+			}
+
+		private:
+			std::vector<ionet::NodePacketIoPair> m_pairs;
+			std::vector<utils::TimeSpan> m_ioDurations;
+		};
+
+		struct MultiProcessSyncParamsCapture {
+			size_t NumFactoryCalls = 0;
+			std::vector<std::string> FactoryHosts;
+			std::vector<long> PickedIoUseCounts;
+			const model::TransactionRegistry* pFactoryTransactionRegistry = nullptr;
+
+			size_t NumActionCalls = 0;
+			int ActionApiId = 0;
+		};
+
+		auto ProcessMultiSyncAndCapture(
+				RemoteApiForwarder& forwarder,
+				const MultiNodePacketIoPicker& picker,
+				const std::vector<uint32_t>& scores,
+				MultiProcessSyncParamsCapture& capture) {
+			return forwarder.processSync(
+				[&capture](const auto& apiId) {
+					++capture.NumActionCalls;
+					capture.ActionApiId = apiId;
+					return thread::make_ready_future(ionet::NodeInteractionResultCode::Success);
+				},
+				[&picker, &capture](const auto& packetIoPairs, const auto& registry) {
+					++capture.NumFactoryCalls;
+					for (const auto& packetIoPair : packetIoPairs)
+						capture.FactoryHosts.push_back(packetIoPair.node().identity().Host);
+
+					for (const auto& packetIoPair : picker.pairs())
+						capture.PickedIoUseCounts.push_back(packetIoPair.io().use_count());
+
+					capture.pFactoryTransactionRegistry = &registry;
+					return std::make_unique<int>(Default_Action_Api_Id);
+				},
+				2,
+				[&scores](const auto& node) {
+					return scores[static_cast<size_t>(std::stoul(node.identity().Host.substr(4)))];
+				});
+		}
+	}
+
+	TEST(TEST_CLASS, MultiPeer_ActionIsSkippedWhenNoPeerIsAvailable) {
+		// Arrange:
+		MultiNodePacketIoPicker picker(0);
+		model::TransactionRegistry registry;
+		RemoteApiForwarder forwarder(picker, registry, utils::TimeSpan::FromSeconds(4), "test");
+
+		// Act:
+		MultiProcessSyncParamsCapture capture;
+		auto result = ProcessMultiSyncAndCapture(forwarder, picker, {}, capture).get();
+
+		// Assert:
+		EXPECT_EQ(Key(), result.Identity.PublicKey);
+		EXPECT_EQ(ionet::NodeInteractionResultCode::None, result.Code);
+
+		// - pick one was called
+		ASSERT_EQ(1u, picker.pickOneDurations().size());
+		EXPECT_EQ(utils::TimeSpan::FromSeconds(4), picker.pickOneDurations()[0]);
+
+		// - other calls were bypassed
+		EXPECT_EQ(0u, capture.NumFactoryCalls);
+		EXPECT_EQ(0u, capture.NumActionCalls);
+	}
+
+	TEST(TEST_CLASS, MultiPeer_ActionIsInvokedWithSinglePeerWhenOnlyOnePeerIsAvailable) {
+		// Arrange:
+		MultiNodePacketIoPicker picker(1);
+		model::TransactionRegistry registry;
+		RemoteApiForwarder forwarder(picker, registry, utils::TimeSpan::FromSeconds(4), "test");
+
+		// Act:
+		MultiProcessSyncParamsCapture capture;
+		auto result = ProcessMultiSyncAndCapture(forwarder, picker, { 100 }, capture).get();
+
+		// Assert:
+		EXPECT_EQ(picker.pairs()[0].node().identity().PublicKey, result.Identity.PublicKey);
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, result.Code);
+
+		// - pick one was called until no more peers were available
+		EXPECT_EQ(2u, picker.pickOneDurations().size());
+
+		// - factory and action were called
+		EXPECT_EQ(1u, capture.NumFactoryCalls);
+		EXPECT_EQ(std::vector<std::string>({ "host0" }), capture.FactoryHosts);
+		EXPECT_EQ(&registry, capture.pFactoryTransactionRegistry);
+		EXPECT_EQ(1u, capture.NumActionCalls);
+		EXPECT_EQ(Default_Action_Api_Id, capture.ActionApiId);
+	}
+
+	TEST(TEST_CLASS, MultiPeer_ActionIsInvokedWithHighestScoringPeers) {
+		// Arrange: only first four peers are picked (twice the number of max peers)
+		MultiNodePacketIoPicker picker(5);
+		model::TransactionRegistry registry;
+		RemoteApiForwarder forwarder(picker, registry, utils::TimeSpan::FromSeconds(4), "test");
+
+		// Act:
+		MultiProcessSyncParamsCapture capture;
+		auto result = ProcessMultiSyncAndCapture(forwarder, picker, { 300, 200, 900, 500, 1000 }, capture).get();
+
+		// Assert: result is attributed to the highest scoring peer
+		EXPECT_EQ(picker.pairs()[2].node().identity().PublicKey, result.Identity.PublicKey);
+		EXPECT_EQ("host2", result.Identity.Host);
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, result.Code);
+
+		// - four peers were picked
+		ASSERT_EQ(4u, picker.pickOneDurations().size());
+		for (const auto& duration : picker.pickOneDurations())
+			EXPECT_EQ(utils::TimeSpan::FromSeconds(4), duration);
+
+		// - factory was called with highest scoring peers ordered by score
+		EXPECT_EQ(1u, capture.NumFactoryCalls);
+		EXPECT_EQ(std::vector<std::string>({ "host2", "host3" }), capture.FactoryHosts);
+		EXPECT_EQ(&registry, capture.pFactoryTransactionRegistry);
+
+		// - other peers were released before the factory was called
+		EXPECT_EQ(std::vector<long>({ 1, 1, 2, 2, 1 }), capture.PickedIoUseCounts);
+
+		// - action was called
+		EXPECT_EQ(1u, capture.NumActionCalls);
+		EXPECT_EQ(Default_Action_Api_Id, capture.ActionApiId);
+	}
+
+	TEST(TEST_CLASS, MultiPeer_PeersWithEqualScoresArePreferredInPickOrder) {
+		// Arrange:
+		MultiNodePacketIoPicker picker(4);
+		model::TransactionRegistry registry;
+		RemoteApiForwarder forwarder(picker, registry, utils::TimeSpan::FromSeconds(4), "test");
+
+		// Act:
+		MultiProcessSyncParamsCapture capture;
+		auto result = ProcessMultiSyncAndCapture(forwarder, picker, { 100, 500, 100, 500 }, capture).get();
+
+		// Assert:
+		EXPECT_EQ("host1", result.Identity.Host);
+		EXPECT_EQ(std::vector<std::string>({ "host1", "host3" }), capture.FactoryHosts);
+	}
+
+	// endregion
 }}
@@ -28,6 +28,8 @@
 #include "bitxorcore/model/FeeUtils.h"
 #include "bitxorcore/model/TransactionStatus.h"
 #include "tests/test/cache/UtTestUtils.h"
+#include "tests/test/core/AddressTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/TransactionTestUtils.h"
 #include "tests/test/other/MockExecutionConfiguration.h"
 #include "tests/test/other/mocks/MockUtChangeSubscriber.h"
@@ -106,6 +108,7 @@ namespace bitxorcore { namespace chain {
 					: TransactionInfo(transactionInfo.copy())
 					, TransactionSource(context.TransactionSource)
 					, CacheHeight(context.CacheHeight)
+					, CacheGeneration(context.CacheGeneration)
 					, IsPassedMarkedCache(test::IsMarkedCache(context.UnconfirmedBitxorCoreCache))
 					, UtCacheSize(context.TransactionsCache.size())
 			{}
@@ -114,6 +117,7 @@ namespace bitxorcore { namespace chain {
 			model::TransactionInfo TransactionInfo;
 			UtUpdater::TransactionSource TransactionSource;
 			Height CacheHeight;
+			uint64_t CacheGeneration;
 			bool IsPassedMarkedCache;
 			size_t UtCacheSize;
 		};
@@ -124,29 +128,44 @@ namespace bitxorcore { namespace chain {
 		public:
 			explicit UpdaterTestContext(
 					ThrottleMode throttleMode = ThrottleMode::Off,
-					BlockFeeMultiplier minFeeMultiplier = BlockFeeMultiplier())
+					BlockFeeMultiplier minFeeMultiplier = BlockFeeMultiplier(),
+					thread::IoThreadPool* pPrefilterPool = nullptr)
 					: m_cache(CreateCacheWithDefaultHeight())
 					, m_pUtChangeSubscriber(std::make_unique<mocks::MockUtChangeSubscriber>())
 					, m_utChangeSubscriber(*m_pUtChangeSubscriber)
 					, m_transactionsCache(
-							cache::MemoryCacheOptions(utils::FileSize(), utils::FileSize::FromKilobytes(2)),
+							cache::MemoryCacheOptions(utils::FileSize(), utils::FileSize::FromMegabytes(1)),
 							cache::CreateAggregateUtCache,
-							std::move(m_pUtChangeSubscriber))
-					, m_updater(
-							m_transactionsCache,
-							m_cache,
-							minFeeMultiplier,
-							m_executionConfig.Config,
-							[]() { return Default_Time; },
-							[this](const auto& transaction, const auto& hash, auto result) {
-								// notice that transaction.Deadline is used as transaction marker
-								m_failedTransactionStatuses.emplace_back(hash, transaction.Deadline, utils::to_underlying_type(result));
-							},
-							[this, throttleMode](const auto& transactionInfo, const auto& context) {
-								m_throttleParams.emplace_back(transactionInfo, context);
-								return ThrottleMode::Even == throttleMode && (0 == transactionInfo.pEntity->Deadline.unwrap() % 2);
-							})
-			{}
+							std::move(m_pUtChangeSubscriber)) {
+				auto failedTransactionSink = [this](const auto& transaction, const auto& hash, auto result) {
+					// notice that transaction.Deadline is used as transaction marker
+					m_failedTransactionStatuses.emplace_back(hash, transaction.Deadline, utils::to_underlying_type(result));
+				};
+				auto throttle = [this, throttleMode](const auto& transactionInfo, const auto& context) {
+					m_throttleParams.emplace_back(transactionInfo, context);
+					return ThrottleMode::Even == throttleMode && (0 == transactionInfo.pEntity->Deadline.unwrap() % 2);
+				};
+				auto timeSupplier = []() { return Default_Time; };
+
+				m_pUpdater = pPrefilterPool
+						? std::make_unique<UtUpdater>(
+								m_transactionsCache,
+								m_cache,
+								minFeeMultiplier,
+								m_executionConfig.Config,
+								timeSupplier,
+								failedTransactionSink,
+								throttle,
+								*pPrefilterPool)
+						: std::make_unique<UtUpdater>(
+								m_transactionsCache,
+								m_cache,
+								minFeeMultiplier,
+								m_executionConfig.Config,
+								timeSupplier,
+								failedTransactionSink,
+								throttle);
+			}
 
 		public:
 			cache::MemoryUtCacheProxy& transactionsCache() {
@@ -154,7 +173,11 @@ namespace bitxorcore { namespace chain {
 			}
 
 			UtUpdater& updater() {
-				return m_updater;
+				return *m_pUpdater;
+			}
+
+			const std::vector<ThrottleParams>& throttleParams() const {
+				return m_throttleParams;
 			}
 
 			void setValidationResult(ValidationResult result, const Hash256& hash, size_t id) {
@@ -468,7 +491,7 @@ namespace bitxorcore { namespace chain {
 			std::unique_ptr<mocks::MockUtChangeSubscriber> m_pUtChangeSubscriber;
 			mocks::MockUtChangeSubscriber& m_utChangeSubscriber;
 			cache::MemoryUtCacheProxy m_transactionsCache;
-			UtUpdater m_updater;
+			std::unique_ptr<UtUpdater> m_pUpdater;
 
 			std::unordered_set<size_t> m_partialUndoFailureIndexes;
 			std::vector<model::TransactionStatus> m_failedTransactionStatuses;
@@ -914,6 +937,63 @@ namespace bitxorcore { namespace chain {
 		context.assertSubscriberCalls(GenerateRawDeadlines(4));
 	}
 
+	TEST(TEST_CLASS, NewTransactionsDuplicatedWithinBatchAreOnlyExecutedOnce) {
+		// Arrange: prepare 4 new transactions and duplicate the second one
+		UpdaterTestContext context;
+		auto transactionData = CreateTransactionData(4);
+		auto duplicateInfo = transactionData.UtInfos[1].copy();
+		transactionData.UtInfos.insert(transactionData.UtInfos.begin() + 3, std::move(duplicateInfo));
+
+		// Act:
+		auto updateResults = context.updater().update(transactionData.UtInfos);
+
+		// Assert: the duplicate was filtered out before being throttled
+		NewTransactionsTraits::CheckResults(updateResults, { New, New, New, Neutral, New });
+
+		EXPECT_EQ(4u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), transactionData.Hashes);
+
+		context.assertContexts(UtUpdater::TransactionSource::New);
+		context.assertEntityInfos(transactionData.EntityInfos);
+
+		context.assertSubscriberCalls(GenerateRawDeadlines(4));
+	}
+
+	TEST(TEST_CLASS, LargeNewTransactionBatchesCanBePrefilteredInParallel) {
+		// Arrange: prepare enough transactions to trigger parallel prefiltering
+		constexpr auto Num_Transactions = 2000u;
+		auto pPool = test::CreateStartedIoThreadPool(4);
+		UpdaterTestContext context(ThrottleMode::Off, BlockFeeMultiplier(20), pPool.get());
+		auto transactionData = CreateTransactionData(Num_Transactions);
+
+		// - set fee multiples so that every third transaction has an insufficient fee
+		std::vector<size_t> expectedIndexes;
+		std::vector<UtUpdateResult::UpdateType> expectedResults;
+		for (auto i = 0u; i < Num_Transactions; ++i) {
+			auto isFeeSufficient = 0 != i % 3;
+			auto multiplier = BlockFeeMultiplier(isFeeSufficient ? 20 : 19);
+			auto& utInfo = transactionData.UtInfos[i];
+			const_cast<Amount&>(utInfo.pEntity->MaxFee) = model::CalculateTransactionFee(multiplier, *utInfo.pEntity);
+
+			expectedResults.push_back(isFeeSufficient ? New : Neutral);
+			if (isFeeSufficient)
+				expectedIndexes.push_back(i);
+		}
+
+		// Act:
+		auto updateResults = context.updater().update(transactionData.UtInfos);
+
+		// Assert: results are mapped back to the original transactions
+		NewTransactionsTraits::CheckResults(updateResults, expectedResults);
+
+		EXPECT_EQ(expectedIndexes.size(), context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(transactionData.Hashes, expectedIndexes));
+
+		// - all candidates were executed in order
+		context.assertContexts(UtUpdater::TransactionSource::New);
+		context.assertEntityInfos(Select(transactionData.EntityInfos, expectedIndexes));
+	}
+
 	// endregion
 
 	// region update (block disruptor)
@@ -951,6 +1031,29 @@ namespace bitxorcore { namespace chain {
 		context.assertSubscriberCalls(GenerateRawDeadlines(4));
 	}
 
+	TEST(TEST_CLASS, RebaseChangesCacheGenerationPassedToThrottle) {
+		// Arrange:
+		UpdaterTestContext context;
+		auto transactionData1 = CreateTransactionData(2);
+		auto transactionData2 = CreateTransactionData(1, 2);
+
+		// Act: add new transactions, rebase (reapplying the existing transactions) and add more new transactions
+		context.updater().update(transactionData1.UtInfos);
+		context.updater().update({}, {});
+		context.updater().update(transactionData2.UtInfos);
+
+		// Assert: generation only changed with rebase
+		const auto& throttleParams = context.throttleParams();
+		ASSERT_EQ(5u, throttleParams.size());
+
+		auto generation = throttleParams[0].CacheGeneration;
+		EXPECT_EQ(generation, throttleParams[1].CacheGeneration);
+		EXPECT_NE(generation, throttleParams[2].CacheGeneration);
+
+		for (auto i = 3u; i < throttleParams.size(); ++i)
+			EXPECT_EQ(throttleParams[2].CacheGeneration, throttleParams[i].CacheGeneration) << "throttle at " << i;
+	}
+
 	NON_SUCCESS_VALIDATION_TRAITS_BASED_TEST(OriginalTransactionsThatFailValidationDoNotGetAddedToCache) {
 		// Arrange: initialize the UT cache with 6 transactions
 		UpdaterTestContext context;
@@ -1099,4 +1202,193 @@ namespace bitxorcore { namespace chain {
 	}
 
 	// endregion
+
+	// region update (block disruptor + affected addresses)
+
+	namespace {
+		// deadlines are offset so that transactions are not expired relative to Default_Time
+		constexpr size_t Unexpired_Start = 40;
+
+		std::vector<UnresolvedAddress> GenerateRandomUnresolvedAddresses(size_t count) {
+			std::vector<UnresolvedAddress> addresses;
+			for (auto i = 0u; i < count; ++i)
+				addresses.push_back(test::GenerateRandomUnresolvedAddress());
+
+			return addresses;
+		}
+
+		void SetExtractedAddresses(TransactionData& data, const std::vector<model::UnresolvedAddressSet>& addressSets) {
+			for (auto i = 0u; i < addressSets.size(); ++i)
+				data.UtInfos[i].OptionalExtractedAddresses = std::make_shared<model::UnresolvedAddressSet>(addressSets[i]);
+		}
+
+		void SetDistinctExtractedAddresses(TransactionData& data) {
+			for (auto& utInfo : data.UtInfos)
+				utInfo.OptionalExtractedAddresses = test::GenerateRandomUnresolvedAddressSetPointer(1);
+		}
+
+		std::vector<size_t> DuplicateIds(const std::vector<size_t>& ids) {
+			// MockNotificationPublisher publishes two notifications per entity
+			std::vector<size_t> result;
+			for (auto id : ids) {
+				result.push_back(id);
+				result.push_back(id);
+			}
+
+			return result;
+		}
+	}
+
+	TEST(TEST_CLASS, UnaffectedExistingTransactionsAreReappliedWithoutRevalidation) {
+		// Arrange: initialize the UT cache with 4 transactions with distinct addresses
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(4, Unexpired_Start);
+		SetDistinctExtractedAddresses(originalTransactionData);
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+		context.resetSubscriber();
+
+		// Act: none of the addresses are affected
+		context.updater().update({}, {}, AffectedAddresses());
+
+		// Assert: all transactions were observed but none were validated
+		EXPECT_EQ(4u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), originalTransactionData.Hashes);
+
+		context.assertContexts(CreateRevertedAndExistingSources(0, 4), std::vector<size_t>());
+		context.assertEntityInfos(originalTransactionData.EntityInfos, {}, DuplicateIds({ 0, 1, 2, 3 }));
+	}
+
+	TEST(TEST_CLASS, AffectedExistingTransactionsAreRevalidated) {
+		// Arrange: initialize the UT cache with 4 transactions with distinct addresses
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(4, Unexpired_Start);
+		SetDistinctExtractedAddresses(originalTransactionData);
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+		context.resetSubscriber();
+
+		// - affect the second transaction via a confirmed transaction and the fourth via an account state change
+		AffectedAddresses affectedAddresses;
+		affectedAddresses.Transactions.insert(*originalTransactionData.UtInfos[1].OptionalExtractedAddresses->cbegin());
+		affectedAddresses.Accounts.insert(originalTransactionData.UtInfos[3].OptionalExtractedAddresses->cbegin()->copyTo<Address>());
+
+		// Act:
+		context.updater().update({}, {}, affectedAddresses);
+
+		// Assert: all transactions were observed but only affected transactions were validated
+		EXPECT_EQ(4u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), originalTransactionData.Hashes);
+
+		context.assertContexts(CreateRevertedAndExistingSources(0, 4), { 2, 3, 6, 7 });
+		context.assertEntityInfos(originalTransactionData.EntityInfos, DuplicateIds({ 1, 3 }), DuplicateIds({ 0, 1, 2, 3 }));
+	}
+
+	TEST(TEST_CLASS, RevalidatedExistingTransactionsTriggerRevalidationOfDependentTransactions) {
+		// Arrange: initialize the UT cache with 4 transactions where the second and third share an address
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(4, Unexpired_Start);
+		auto addresses = GenerateRandomUnresolvedAddresses(5);
+		SetExtractedAddresses(originalTransactionData, {
+			{ addresses[0] }, { addresses[1], addresses[2] }, { addresses[2] }, { addresses[3], addresses[4] }
+		});
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+		context.resetSubscriber();
+
+		AffectedAddresses affectedAddresses;
+		affectedAddresses.Transactions.insert(addresses[1]);
+
+		// Act:
+		context.updater().update({}, {}, affectedAddresses);
+
+		// Assert: the third transaction was revalidated because it depends on the (revalidated) second transaction
+		EXPECT_EQ(4u, context.transactionsCache().view().size());
+		context.assertContexts(CreateRevertedAndExistingSources(0, 4), { 2, 3, 4, 5 });
+		context.assertEntityInfos(originalTransactionData.EntityInfos, DuplicateIds({ 1, 2 }), DuplicateIds({ 0, 1, 2, 3 }));
+	}
+
+	TEST(TEST_CLASS, ExistingTransactionWithoutExtractedAddressesTriggersRevalidationOfAllSubsequentTransactions) {
+		// Arrange: initialize the UT cache with 4 transactions where the second has unknown addresses
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(4, Unexpired_Start);
+		SetDistinctExtractedAddresses(originalTransactionData);
+		originalTransactionData.UtInfos[1].OptionalExtractedAddresses.reset();
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+		context.resetSubscriber();
+
+		// Act:
+		context.updater().update({}, {}, AffectedAddresses());
+
+		// Assert:
+		EXPECT_EQ(4u, context.transactionsCache().view().size());
+		context.assertContexts(CreateRevertedAndExistingSources(0, 4), { 2, 3, 4, 5, 6, 7 });
+		context.assertEntityInfos(originalTransactionData.EntityInfos, DuplicateIds({ 1, 2, 3 }), DuplicateIds({ 0, 1, 2, 3 }));
+	}
+
+	TEST(TEST_CLASS, ExpiredExistingTransactionsAreRevalidated) {
+		// Arrange: initialize the UT cache with 4 transactions with distinct addresses
+		//          where the first two have deadlines (900, 961) before Default_Time
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(4, 30);
+		SetDistinctExtractedAddresses(originalTransactionData);
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+		context.resetSubscriber();
+
+		// Act:
+		context.updater().update({}, {}, AffectedAddresses());
+
+		// Assert: only expired transactions were validated
+		EXPECT_EQ(4u, context.transactionsCache().view().size());
+		context.assertContexts(CreateRevertedAndExistingSources(0, 4), { 0, 1, 2, 3 });
+		context.assertEntityInfos(originalTransactionData.EntityInfos, DuplicateIds({ 0, 1 }), DuplicateIds({ 0, 1, 2, 3 }));
+	}
+
+	TEST(TEST_CLASS, RevertedTransactionsTriggerRevalidationOfDependentExistingTransactions) {
+		// Arrange: initialize the UT cache with 2 transactions where the second shares an address with the reverted transaction
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(2, Unexpired_Start + 1);
+		auto addresses = GenerateRandomUnresolvedAddresses(2);
+		SetExtractedAddresses(originalTransactionData, { { addresses[0] }, { addresses[1] } });
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+		context.resetSubscriber();
+
+		// - prepare 1 reverted transaction
+		auto transactionData = CreateTransactionData(1, Unexpired_Start);
+		SetExtractedAddresses(transactionData, { { addresses[1] } });
+
+		// Act:
+		context.updater().update({}, transactionData.UtInfos, AffectedAddresses());
+
+		// Assert: reverted transaction is always validated
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		context.assertContexts(CreateRevertedAndExistingSources(1, 2), { 0, 1, 4, 5 });
+		context.assertEntityInfos(
+				ConcatContainers(transactionData.EntityInfos, originalTransactionData.EntityInfos),
+				DuplicateIds({ 0, 2 }),
+				DuplicateIds({ 0, 1, 2 }));
+	}
+
+	TEST(TEST_CLASS, CommittedExistingTransactionsTriggerRevalidationOfDependentTransactions) {
+		// Arrange: initialize the UT cache with 4 transactions where the second and third share an address
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(4, Unexpired_Start);
+		const auto& originalHashes = originalTransactionData.Hashes;
+		auto addresses = GenerateRandomUnresolvedAddresses(4);
+		SetExtractedAddresses(originalTransactionData, { { addresses[0] }, { addresses[1] }, { addresses[1] }, { addresses[3] } });
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+		context.resetSubscriber();
+
+		// Act: confirm the second transaction
+		context.updater().update({ &originalHashes[1] }, {}, AffectedAddresses());
+
+		// Assert: the third transaction was revalidated because it depends on the (confirmed) second transaction
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(originalHashes, { 0, 2, 3 }));
+
+		context.assertContexts(CreateRevertedAndExistingSources(0, 3), { 2, 3 });
+		context.assertEntityInfos(
+				Select(originalTransactionData.EntityInfos, { 0, 2, 3 }),
+				DuplicateIds({ 1 }),
+				DuplicateIds({ 0, 1, 2 }));
+	}
+
+	// endregion
 }}
@@ -32,7 +32,8 @@ namespace bitxorcore { namespace mocks {
 	public:
 		enum class EntryPoint {
 			None,
-			Unconfirmed_Transactions
+			Unconfirmed_Transactions,
+			Announced_Transactions
 		};
 
 		struct UtRequest {
@@ -60,6 +61,11 @@ namespace bitxorcore { namespace mocks {
 			return m_utRequests;
 		}
 
+		/// Gets a vector of short hashes that were passed to the announced transactions requests.
+		const auto& announcedUtRequests() const {
+			return m_announcedUtRequests;
+		}
+
 	public:
 		/// Gets the configured unconfirmed transactions and throws if the error entry point is set to Unconfirmed_Transactions.
 		/// \note The \a minDeadline, \a minFeeMultiplier and \a knownShortHashes parameters are captured.
@@ -74,6 +80,16 @@ namespace bitxorcore { namespace mocks {
 			return thread::make_ready_future(model::TransactionRange::CopyRange(m_transactionRange));
 		}
 
+		/// Gets the configured unconfirmed transactions and throws if the error entry point is set to Announced_Transactions.
+		/// \note The \a announcedShortHashes parameter is captured.
+		thread::future<model::TransactionRange> announcedTransactions(model::ShortHashRange&& announcedShortHashes) const override {
+			m_announcedUtRequests.push_back(std::move(announcedShortHashes));
+			if (shouldRaiseException(EntryPoint::Announced_Transactions))
+				return CreateFutureException<model::TransactionRange>("announced transactions error has been set");
+
+			return thread::make_ready_future(model::TransactionRange::CopyRange(m_transactionRange));
+		}
+
 	private:
 		bool shouldRaiseException(EntryPoint entryPoint) const {
 			return m_errorEntryPoint == entryPoint;
@@ -88,5 +104,6 @@ namespace bitxorcore { namespace mocks {
 		model::TransactionRange m_transactionRange;
 		EntryPoint m_errorEntryPoint;
 		mutable std::vector<UtRequest> m_utRequests;
+		mutable std::vector<model::ShortHashRange> m_announcedUtRequests;
 	};
 }}
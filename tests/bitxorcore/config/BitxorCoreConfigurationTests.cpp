@@ -112,10 +112,15 @@ namespace bitxorcore { namespace config {
 
 			EXPECT_FALSE(config.EnableAddressReuse);
 			EXPECT_FALSE(config.EnableSingleThreadPool);
+			EXPECT_EQ(0u, config.ComputeThreadPoolSize);
+			EXPECT_TRUE(config.ComputeThreadPoolCpuAffinity.empty());
+			EXPECT_EQ(0u, config.HeavyPacketHandlerPoolSize);
+			EXPECT_EQ(16u, config.MaxPendingHeavyPacketsPerPeer);
 			EXPECT_TRUE(config.EnableCacheDatabaseStorage);
 			EXPECT_TRUE(config.EnableAutoSyncCleanup);
 
 			EXPECT_EQ(100u, config.FileDatabaseBatchSize);
+			EXPECT_EQ(utils::FileSize(), config.StateFileChunkSize);
 
 			EXPECT_TRUE(config.EnableTransactionSpamThrottling);
 			EXPECT_EQ(Amount(10'000'000), config.TransactionSpamThrottlingMaxBoostFee);
@@ -123,6 +128,7 @@ namespace bitxorcore { namespace config {
 			EXPECT_EQ(84u, config.MaxHashesPerSyncAttempt);
 			EXPECT_EQ(42u, config.MaxBlocksPerSyncAttempt);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(100), config.MaxChainBytesPerSyncAttempt);
+			EXPECT_EQ(1u, config.MaxParallelSyncPeers);
 
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(10), config.ShortLivedCacheTransactionDuration);
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(100), config.ShortLivedCacheBlockDuration);
@@ -134,6 +140,9 @@ namespace bitxorcore { namespace config {
 			EXPECT_EQ(model::TransactionSelectionStrategy::Oldest, config.TransactionSelectionStrategy);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(5), config.UnconfirmedTransactionsCacheMaxResponseSize);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(20), config.UnconfirmedTransactionsCacheMaxSize);
+			EXPECT_FALSE(config.EnableIncrementalUtRevalidation);
+			EXPECT_FALSE(config.EnableTransactionInventoryGossip);
+			EXPECT_EQ(100'000u, config.TransactionInventoryMaxSize);
 
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(10), config.ConnectTimeout);
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(60), config.SyncTimeout);
@@ -141,6 +150,7 @@ namespace bitxorcore { namespace config {
 			EXPECT_EQ(utils::FileSize::FromKilobytes(512), config.SocketWorkingBufferSize);
 			EXPECT_EQ(100u, config.SocketWorkingBufferSensitivity);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(150), config.MaxPacketDataSize);
+			EXPECT_EQ(1'000u, config.MaxStatePathKeysPerRequest);
 
 			EXPECT_EQ(4096u, config.BlockDisruptorSlotCount);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(300), config.BlockDisruptorMaxMemorySize);
@@ -153,6 +163,11 @@ namespace bitxorcore { namespace config {
 			EXPECT_TRUE(config.EnableDispatcherAbortWhenFull);
 			EXPECT_TRUE(config.EnableDispatcherInputAuditing);
 
+			EXPECT_FALSE(config.EnableDispatcherTracing);
+			EXPECT_EQ(10'000u, config.DispatcherTraceMaxEventsPerThread);
+			EXPECT_EQ(utils::TimeSpan::FromSeconds(5), config.DispatcherTraceSlowBlockThreshold);
+			EXPECT_EQ(100u, config.DispatcherTraceMaxFiles);
+
 			EXPECT_EQ(5'000u, config.MaxTrackedNodes);
 
 			EXPECT_EQ(ionet::GetCurrentServerVersion(), config.MinPartnerNodeVersion);
@@ -163,6 +178,7 @@ namespace bitxorcore { namespace config {
 			EXPECT_EQ("0.0.0.0", config.ListenInterface);
 
 			EXPECT_FALSE(config.CacheDatabase.EnableStatistics);
+			EXPECT_FALSE(config.CacheDatabase.EnableSharedDatabase);
 			EXPECT_EQ(0u, config.CacheDatabase.MaxOpenFiles);
 			EXPECT_EQ(0u, config.CacheDatabase.MaxBackgroundThreads);
 			EXPECT_EQ(0u, config.CacheDatabase.MaxSubcompactionThreads);
@@ -170,6 +186,7 @@ namespace bitxorcore { namespace config {
 			EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.MemtableMemoryBudget);
 
 			EXPECT_EQ(utils::FileSize::FromMegabytes(5), config.CacheDatabase.MaxWriteBatchSize);
+			EXPECT_EQ(10'000u, config.CacheDatabase.PatriciaTreeNodeCacheSize);
 
 			EXPECT_EQ("", config.Local.Host);
 			EXPECT_EQ("", config.Local.FriendlyName);
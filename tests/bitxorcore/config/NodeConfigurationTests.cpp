@@ -42,10 +42,15 @@ namespace bitxorcore { namespace config {
 
 							{ "enableAddressReuse", "true" },
 							{ "enableSingleThreadPool", "true" },
+							{ "computeThreadPoolSize", "6" },
+							{ "computeThreadPoolCpuAffinity", "2,3,5" },
+							{ "heavyPacketHandlerPoolSize", "5" },
+							{ "maxPendingHeavyPacketsPerPeer", "12" },
 							{ "enableCacheDatabaseStorage", "true" },
 							{ "enableAutoSyncCleanup", "true" },
 
 							{ "fileDatabaseBatchSize", "888" },
+							{ "stateFileChunkSize", "321KB" },
 
 							{ "enableTransactionSpamThrottling", "true" },
 							{ "transactionSpamThrottlingMaxBoostFee", "54'123" },
@@ -53,6 +58,7 @@ namespace bitxorcore { namespace config {
 							{ "maxHashesPerSyncAttempt", "74" },
 							{ "maxBlocksPerSyncAttempt", "50" },
 							{ "maxChainBytesPerSyncAttempt", "2MB" },
+							{ "maxParallelSyncPeers", "3" },
 
 							{ "shortLivedCacheTransactionDuration", "17h" },
 							{ "shortLivedCacheBlockDuration", "23m" },
@@ -64,6 +70,9 @@ namespace bitxorcore { namespace config {
 							{ "transactionSelectionStrategy", "maximize-fee" },
 							{ "unconfirmedTransactionsCacheMaxResponseSize", "234KB" },
 							{ "unconfirmedTransactionsCacheMaxSize", "98MB" },
+							{ "enableIncrementalUtRevalidation", "true" },
+							{ "enableTransactionInventoryGossip", "true" },
+							{ "transactionInventoryMaxSize", "12'345" },
 
 							{ "connectTimeout", "4m" },
 							{ "syncTimeout", "5m" },
@@ -71,6 +80,7 @@ namespace bitxorcore { namespace config {
 							{ "socketWorkingBufferSize", "128KB" },
 							{ "socketWorkingBufferSensitivity", "6225" },
 							{ "maxPacketDataSize", "10MB" },
+							{ "maxStatePathKeysPerRequest", "321" },
 
 							{ "blockDisruptorSlotCount", "1000" },
 							{ "blockDisruptorMaxMemorySize", "15MB" },
@@ -83,6 +93,11 @@ namespace bitxorcore { namespace config {
 							{ "enableDispatcherAbortWhenFull", "true" },
 							{ "enableDispatcherInputAuditing", "true" },
 
+							{ "enableDispatcherTracing", "true" },
+							{ "dispatcherTraceMaxEventsPerThread", "4321" },
+							{ "dispatcherTraceSlowBlockThreshold", "7s" },
+							{ "dispatcherTraceMaxFiles", "13" },
+
 							{ "maxTrackedNodes", "222" },
 
 							{ "minPartnerNodeVersion", "3.3.3.3" },
@@ -97,13 +112,15 @@ namespace bitxorcore { namespace config {
 						"cache_database",
 						{
 							{ "enableStatistics", "true" },
+							{ "enableSharedDatabase", "true" },
 							{ "maxOpenFiles", "1111" },
 							{ "maxBackgroundThreads", "19" },
 							{ "maxSubcompactionThreads", "11" },
 							{ "blockCacheSize", "111MB" },
 							{ "memtableMemoryBudget", "45MB" },
 
-							{ "maxWriteBatchSize", "17KB" }
+							{ "maxWriteBatchSize", "17KB" },
+							{ "patriciaTreeNodeCacheSize", "2345" }
 						}
 					},
 					{
@@ -164,10 +181,15 @@ namespace bitxorcore { namespace config {
 
 				EXPECT_FALSE(config.EnableAddressReuse);
 				EXPECT_FALSE(config.EnableSingleThreadPool);
+				EXPECT_EQ(0u, config.ComputeThreadPoolSize);
+				EXPECT_TRUE(config.ComputeThreadPoolCpuAffinity.empty());
+				EXPECT_EQ(0u, config.HeavyPacketHandlerPoolSize);
+				EXPECT_EQ(0u, config.MaxPendingHeavyPacketsPerPeer);
 				EXPECT_FALSE(config.EnableCacheDatabaseStorage);
 				EXPECT_FALSE(config.EnableAutoSyncCleanup);
 
 				EXPECT_EQ(0u, config.FileDatabaseBatchSize);
+				EXPECT_EQ(utils::FileSize(), config.StateFileChunkSize);
 
 				EXPECT_FALSE(config.EnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(), config.TransactionSpamThrottlingMaxBoostFee);
@@ -175,6 +197,7 @@ namespace bitxorcore { namespace config {
 				EXPECT_EQ(0u, config.MaxHashesPerSyncAttempt);
 				EXPECT_EQ(0u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(0u, config.MaxParallelSyncPeers);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheBlockDuration);
@@ -186,6 +209,9 @@ namespace bitxorcore { namespace config {
 				EXPECT_EQ(model::TransactionSelectionStrategy::Oldest, config.TransactionSelectionStrategy);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.UnconfirmedTransactionsCacheMaxResponseSize);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.UnconfirmedTransactionsCacheMaxSize);
+				EXPECT_FALSE(config.EnableIncrementalUtRevalidation);
+				EXPECT_FALSE(config.EnableTransactionInventoryGossip);
+				EXPECT_EQ(0u, config.TransactionInventoryMaxSize);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.SyncTimeout);
@@ -193,6 +219,7 @@ namespace bitxorcore { namespace config {
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.SocketWorkingBufferSize);
 				EXPECT_EQ(0u, config.SocketWorkingBufferSensitivity);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxPacketDataSize);
+				EXPECT_EQ(0u, config.MaxStatePathKeysPerRequest);
 
 				EXPECT_EQ(0u, config.BlockDisruptorSlotCount);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.BlockDisruptorMaxMemorySize);
@@ -205,6 +232,11 @@ namespace bitxorcore { namespace config {
 				EXPECT_FALSE(config.EnableDispatcherAbortWhenFull);
 				EXPECT_FALSE(config.EnableDispatcherInputAuditing);
 
+				EXPECT_FALSE(config.EnableDispatcherTracing);
+				EXPECT_EQ(0u, config.DispatcherTraceMaxEventsPerThread);
+				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.DispatcherTraceSlowBlockThreshold);
+				EXPECT_EQ(0u, config.DispatcherTraceMaxFiles);
+
 				EXPECT_EQ(0u, config.MaxTrackedNodes);
 
 				EXPECT_EQ(ionet::NodeVersion(), config.MinPartnerNodeVersion);
@@ -215,6 +247,7 @@ namespace bitxorcore { namespace config {
 				EXPECT_EQ("", config.ListenInterface);
 
 				EXPECT_FALSE(config.CacheDatabase.EnableStatistics);
+				EXPECT_FALSE(config.CacheDatabase.EnableSharedDatabase);
 				EXPECT_EQ(0u, config.CacheDatabase.MaxOpenFiles);
 				EXPECT_EQ(0u, config.CacheDatabase.MaxBackgroundThreads);
 				EXPECT_EQ(0u, config.CacheDatabase.MaxSubcompactionThreads);
@@ -222,6 +255,7 @@ namespace bitxorcore { namespace config {
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.MemtableMemoryBudget);
 
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.MaxWriteBatchSize);
+				EXPECT_EQ(0u, config.CacheDatabase.PatriciaTreeNodeCacheSize);
 
 				EXPECT_EQ("", config.Local.Host);
 				EXPECT_EQ("", config.Local.FriendlyName);
@@ -259,10 +293,15 @@ namespace bitxorcore { namespace config {
 
 				EXPECT_TRUE(config.EnableAddressReuse);
 				EXPECT_TRUE(config.EnableSingleThreadPool);
+				EXPECT_EQ(6u, config.ComputeThreadPoolSize);
+				EXPECT_EQ(std::unordered_set<std::string>({ "2", "3", "5" }), config.ComputeThreadPoolCpuAffinity);
+				EXPECT_EQ(5u, config.HeavyPacketHandlerPoolSize);
+				EXPECT_EQ(12u, config.MaxPendingHeavyPacketsPerPeer);
 				EXPECT_TRUE(config.EnableCacheDatabaseStorage);
 				EXPECT_TRUE(config.EnableAutoSyncCleanup);
 
 				EXPECT_EQ(888u, config.FileDatabaseBatchSize);
+				EXPECT_EQ(utils::FileSize::FromKilobytes(321), config.StateFileChunkSize);
 
 				EXPECT_TRUE(config.EnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(54'123), config.TransactionSpamThrottlingMaxBoostFee);
@@ -270,6 +309,7 @@ namespace bitxorcore { namespace config {
 				EXPECT_EQ(74u, config.MaxHashesPerSyncAttempt);
 				EXPECT_EQ(50u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(2), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(3u, config.MaxParallelSyncPeers);
 
 				EXPECT_EQ(utils::TimeSpan::FromHours(17), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(23), config.ShortLivedCacheBlockDuration);
@@ -281,6 +321,9 @@ namespace bitxorcore { namespace config {
 				EXPECT_EQ(model::TransactionSelectionStrategy::Maximize_Fee, config.TransactionSelectionStrategy);
 				EXPECT_EQ(utils::FileSize::FromKilobytes(234), config.UnconfirmedTransactionsCacheMaxResponseSize);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(98), config.UnconfirmedTransactionsCacheMaxSize);
+				EXPECT_TRUE(config.EnableIncrementalUtRevalidation);
+				EXPECT_TRUE(config.EnableTransactionInventoryGossip);
+				EXPECT_EQ(12'345u, config.TransactionInventoryMaxSize);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(4), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(5), config.SyncTimeout);
@@ -288,6 +331,7 @@ namespace bitxorcore { namespace config {
 				EXPECT_EQ(utils::FileSize::FromKilobytes(128), config.SocketWorkingBufferSize);
 				EXPECT_EQ(6225u, config.SocketWorkingBufferSensitivity);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(10), config.MaxPacketDataSize);
+				EXPECT_EQ(321u, config.MaxStatePathKeysPerRequest);
 
 				EXPECT_EQ(1000u, config.BlockDisruptorSlotCount);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(15), config.BlockDisruptorMaxMemorySize);
@@ -300,6 +344,11 @@ namespace bitxorcore { namespace config {
 				EXPECT_TRUE(config.EnableDispatcherAbortWhenFull);
 				EXPECT_TRUE(config.EnableDispatcherInputAuditing);
 
+				EXPECT_TRUE(config.EnableDispatcherTracing);
+				EXPECT_EQ(4321u, config.DispatcherTraceMaxEventsPerThread);
+				EXPECT_EQ(utils::TimeSpan::FromSeconds(7), config.DispatcherTraceSlowBlockThreshold);
+				EXPECT_EQ(13u, config.DispatcherTraceMaxFiles);
+
 				EXPECT_EQ(222u, config.MaxTrackedNodes);
 
 				EXPECT_EQ(ionet::NodeVersion(0x03030303), config.MinPartnerNodeVersion);
@@ -310,6 +359,7 @@ namespace bitxorcore { namespace config {
 				EXPECT_EQ("2.4.8.16", config.ListenInterface);
 
 				EXPECT_TRUE(config.CacheDatabase.EnableStatistics);
+				EXPECT_TRUE(config.CacheDatabase.EnableSharedDatabase);
 				EXPECT_EQ(1111u, config.CacheDatabase.MaxOpenFiles);
 				EXPECT_EQ(19u, config.CacheDatabase.MaxBackgroundThreads);
 				EXPECT_EQ(11u, config.CacheDatabase.MaxSubcompactionThreads);
@@ -317,6 +367,7 @@ namespace bitxorcore { namespace config {
 				EXPECT_EQ(utils::FileSize::FromMegabytes(45), config.CacheDatabase.MemtableMemoryBudget);
 
 				EXPECT_EQ(utils::FileSize::FromKilobytes(17), config.CacheDatabase.MaxWriteBatchSize);
+				EXPECT_EQ(2345u, config.CacheDatabase.PatriciaTreeNodeCacheSize);
 
 				EXPECT_EQ("alice.com", config.Local.Host);
 				EXPECT_EQ("a GREAT node", config.Local.FriendlyName);
@@ -173,7 +173,7 @@ namespace bitxorcore { namespace consumers {
 								GenerationHashSeed,
 								descriptors,
 								alwaysVerifiableIndexes))
-						, pPool(test::CreateStartedIoThreadPool())
+						, pPool(test::CreateStartedComputeThreadPool())
 						, Consumer(CreateBlockBatchSignatureConsumer(
 								GenerationHashSeed,
 								CreateRandomFiller(),
@@ -185,7 +185,7 @@ namespace bitxorcore { namespace consumers {
 			public:
 				bitxorcore::GenerationHashSeed GenerationHashSeed;
 				std::shared_ptr<MockSignatureNotificationPublisher> pPublisher;
-				std::unique_ptr<thread::IoThreadPool> pPool;
+				std::unique_ptr<thread::ComputeThreadPool> pPool;
 
 				disruptor::ConstBlockConsumer Consumer;
 			};
@@ -284,7 +284,7 @@ namespace bitxorcore { namespace consumers {
 								GenerationHashSeed,
 								descriptors,
 								alwaysVerifiableIndexes))
-						, pPool(test::CreateStartedIoThreadPool())
+						, pPool(test::CreateStartedComputeThreadPool())
 						, Consumer(CreateTransactionBatchSignatureConsumer(
 								GenerationHashSeed,
 								CreateRandomFiller(),
@@ -299,7 +299,7 @@ namespace bitxorcore { namespace consumers {
 			public:
 				bitxorcore::GenerationHashSeed GenerationHashSeed;
 				std::shared_ptr<MockSignatureNotificationPublisher> pPublisher;
-				std::unique_ptr<thread::IoThreadPool> pPool;
+				std::unique_ptr<thread::ComputeThreadPool> pPool;
 
 				std::vector<model::TransactionStatus> FailedTransactionStatuses;
 				disruptor::TransactionConsumer Consumer;
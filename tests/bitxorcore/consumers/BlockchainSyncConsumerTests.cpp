@@ -23,13 +23,16 @@
 #include "bitxorcore/consumers/BlockConsumers.h"
 #include "bitxorcore/cache_core/AccountStateCache.h"
 #include "bitxorcore/cache_core/BlockStatisticCache.h"
+#include "bitxorcore/chain/UtUpdater.h"
 #include "bitxorcore/io/BlockStorageCache.h"
+#include "bitxorcore/model/BlockStatement.h"
 #include "bitxorcore/model/BlockchainConfiguration.h"
 #include "bitxorcore/model/ChainScore.h"
 #include "tests/bitxorcore/consumers/test/ConsumerInputFactory.h"
 #include "tests/bitxorcore/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/cache/UnsupportedSubCachePlugin.h"
+#include "tests/test/core/AddressTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/EntityTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryBlockStorage.h"
@@ -282,14 +285,21 @@ namespace bitxorcore { namespace consumers {
 
 		struct TransactionsChangeParams {
 		public:
-			TransactionsChangeParams(const HashSet& addedTransactionHashes, const std::vector<Hash256>& revertedTransactionHashes)
+			TransactionsChangeParams(
+					const HashSet& addedTransactionHashes,
+					const std::vector<Hash256>& revertedTransactionHashes,
+					const chain::AffectedAddresses* pAffectedAddresses)
 					: AddedTransactionHashes(addedTransactionHashes)
 					, RevertedTransactionHashes(revertedTransactionHashes)
+					, HasAffectedAddresses(!!pAffectedAddresses)
+					, AffectedAddresses(pAffectedAddresses ? *pAffectedAddresses : chain::AffectedAddresses())
 			{}
 
 		public:
 			const HashSet AddedTransactionHashes;
 			const std::vector<Hash256> RevertedTransactionHashes;
+			const bool HasAffectedAddresses;
+			const chain::AffectedAddresses AffectedAddresses;
 		};
 
 		class MockTransactionsChange : public test::ParamsCapture<TransactionsChangeParams> {
@@ -297,7 +307,8 @@ namespace bitxorcore { namespace consumers {
 			void operator()(const TransactionsChangeInfo& changeInfo) const {
 				TransactionsChangeParams params(
 						CopyHashes(changeInfo.AddedTransactionHashes),
-						CopyHashes(changeInfo.RevertedTransactionInfos));
+						CopyHashes(changeInfo.RevertedTransactionInfos),
+						changeInfo.OptionalAffectedAddresses);
 				const_cast<MockTransactionsChange*>(this)->push(std::move(params));
 			}
 
@@ -374,13 +385,14 @@ namespace bitxorcore { namespace consumers {
 			};
 
 		public:
-			static cache::BitxorCoreCache Create(PruneIdentifiers& pruneIdentifiers) {
+			static cache::BitxorCoreCache Create(PruneIdentifiers& pruneIdentifiers, const bool& hasTokenChanges) {
 				auto config = model::BlockchainConfiguration::Uninitialized();
 				config.VotingSetGrouping = 1;
 
-				std::vector<std::unique_ptr<cache::SubCachePlugin>> subCaches(3);
+				std::vector<std::unique_ptr<cache::SubCachePlugin>> subCaches(TokenCacheSubCachePlugin::Id + 1);
 				test::CoreSystemCacheFactory::CreateSubCaches(config, subCaches);
 				subCaches[PruneAwareCacheSubCachePlugin::Id] = std::make_unique<PruneAwareCacheSubCachePlugin>(pruneIdentifiers);
+				subCaches[TokenCacheSubCachePlugin::Id] = std::make_unique<TokenCacheSubCachePlugin>(hasTokenChanges);
 
 				auto cache = cache::BitxorCoreCache(std::move(subCaches));
 				test::AddMarkerAccount(cache);
@@ -430,6 +442,51 @@ namespace bitxorcore { namespace consumers {
 			private:
 				PruneIdentifiers& m_pruneIdentifiers;
 			};
+
+			class TokenCacheSubCacheView : public test::UnsupportedSubCacheView {
+			public:
+				explicit TokenCacheSubCacheView(const bool& hasChanges) : m_hasChanges(hasChanges)
+				{}
+
+			public:
+				void prune(Height) override
+				{}
+
+				void prune(Timestamp) override
+				{}
+
+				bool hasChanges() const override {
+					return m_hasChanges;
+				}
+
+			private:
+				const bool& m_hasChanges;
+			};
+
+			class TokenCacheSubCachePlugin : public test::UnsupportedSubCachePlugin<TokenCacheSubCachePlugin> {
+			public:
+				static constexpr size_t Id = utils::to_underlying_type(cache::CacheId::Token);
+				static constexpr auto Name = "TokenCache";
+
+			public:
+				explicit TokenCacheSubCachePlugin(const bool& hasChanges) : m_hasChanges(hasChanges)
+				{}
+
+			public:
+				std::unique_ptr<const cache::SubCacheView> createView() const override {
+					return std::make_unique<TokenCacheSubCacheView>(m_hasChanges);
+				}
+
+				std::unique_ptr<cache::SubCacheView> createDelta() override {
+					return std::make_unique<TokenCacheSubCacheView>(m_hasChanges);
+				}
+
+				void commit() override
+				{}
+
+			private:
+				const bool& m_hasChanges;
+			};
 		};
 
 		// endregion
@@ -445,7 +502,8 @@ namespace bitxorcore { namespace consumers {
 			{}
 
 			ConsumerTestContext(std::unique_ptr<io::BlockStorage>&& pStorage, std::unique_ptr<io::PrunableBlockStorage>&& pStagingStorage)
-					: Cache(BitxorCoreCacheFactory::Create(CachePruneIdentifiers))
+					: HasTokenChanges(false)
+					, Cache(BitxorCoreCacheFactory::Create(CachePruneIdentifiers, HasTokenChanges))
 					, Storage(std::move(pStorage), std::move(pStagingStorage))
 					, LocalFinalizedHeightHashPair{ Height(1), Hash256() }
 					, NetworkFinalizedHeightHashPair{ Height(1), Hash256() } {
@@ -489,6 +547,7 @@ namespace bitxorcore { namespace consumers {
 
 		public:
 			BitxorCoreCacheFactory::PruneIdentifiers CachePruneIdentifiers;
+			bool HasTokenChanges; // stand-in for changes to the (unregistered) token cache
 			cache::BitxorCoreCache Cache;
 			io::BlockStorageCache Storage;
 			model::HeightHashPair LocalFinalizedHeightHashPair;
@@ -1163,12 +1222,42 @@ namespace bitxorcore { namespace consumers {
 				return m_addedHashes;
 			}
 
+		public:
+			const model::UnresolvedAddressSet& addresses() const {
+				return m_addedAddresses;
+			}
+
 		public:
 			void addRandom(size_t elementIndex, size_t numTransactions) {
 				for (auto i = 0u; i < numTransactions; ++i)
 					add(elementIndex, test::GenerateRandomTransaction(), test::GenerateRandomByteArray<Hash256>());
 			}
 
+			void addRandomWithExtractedAddresses(size_t elementIndex, size_t numTransactions) {
+				for (auto i = 0u; i < numTransactions; ++i) {
+					add(elementIndex, test::GenerateRandomTransaction(), test::GenerateRandomByteArray<Hash256>());
+
+					auto pAddresses = test::GenerateRandomUnresolvedAddressSetPointer(2);
+					m_addedAddresses.insert(pAddresses->cbegin(), pAddresses->cend());
+					m_input.blocks()[elementIndex].Transactions.back().OptionalExtractedAddresses = pAddresses;
+				}
+			}
+
+			void addStatements(model::ReceiptType receiptType) {
+				for (auto& element : m_input.blocks()) {
+					model::Receipt receipt;
+					receipt.Size = sizeof(model::Receipt);
+					receipt.Version = 1;
+					receipt.Type = receiptType;
+
+					auto pStatement = std::make_shared<model::BlockStatement>();
+					model::TransactionStatement transactionStatement(model::ReceiptSource(0, 0));
+					transactionStatement.addReceipt(receipt);
+					pStatement->TransactionStatements.emplace(model::ReceiptSource(0, 0), std::move(transactionStatement));
+					element.OptionalStatement = pStatement;
+				}
+			}
+
 			void addFromStorage(size_t elementIndex, const io::BlockStorageCache& storage, Height height, size_t txIndex) {
 				auto pBlockElement = storage.view().loadBlockElement(height);
 
@@ -1195,6 +1284,7 @@ namespace bitxorcore { namespace consumers {
 		private:
 			ConsumerInput& m_input;
 			std::vector<Hash256> m_addedHashes;
+			model::UnresolvedAddressSet m_addedAddresses;
 			std::vector<std::shared_ptr<model::Transaction>> m_transactions;
 		};
 
@@ -1243,6 +1333,115 @@ namespace bitxorcore { namespace consumers {
 		AssertHashesAreEqual(builder.hashes(), txChangeParams.AddedTransactionHashes);
 
 		EXPECT_TRUE(txChangeParams.RevertedTransactionHashes.empty());
+
+		// - affected addresses are unknown because transactions are missing extracted addresses
+		EXPECT_FALSE(txChangeParams.HasAffectedAddresses);
+	}
+
+	namespace {
+		constexpr auto Balance_Transfer_Receipt_Type = model::MakeReceiptType(
+				model::BasicReceiptType::BalanceTransfer,
+				model::FacilityCode::Core,
+				1);
+		constexpr auto Namespace_Expiry_Receipt_Type = model::MakeReceiptType(
+				model::BasicReceiptType::ArtifactExpiry,
+				model::FacilityCode::Namespace,
+				1);
+
+		template<typename TPrepareInput, typename TAssertParams>
+		void AssertCanSyncCompatibleChainsWithExtractedAddresses(TPrepareInput prepareInput, TAssertParams assertParams) {
+			// Arrange: create a local storage with blocks 1-7 and a remote storage with blocks 8-11
+			ConsumerTestContext context;
+			context.seedStorage(Height(7));
+			auto input = CreateInput(Height(8), 4);
+
+			// - add transactions with extracted addresses to the input
+			InputTransactionBuilder builder(input);
+			builder.addRandomWithExtractedAddresses(0, 1);
+			builder.addRandomWithExtractedAddresses(2, 3);
+			prepareInput(builder, context);
+
+			// Act:
+			auto result = context.Consumer(input);
+
+			// Assert:
+			test::AssertContinued(result);
+
+			// - the change notification had 4 added and 0 reverted
+			ASSERT_EQ(1u, context.TransactionsChange.params().size());
+			const auto& txChangeParams = context.TransactionsChange.params()[0];
+
+			EXPECT_EQ(4u, txChangeParams.AddedTransactionHashes.size());
+			EXPECT_TRUE(txChangeParams.RevertedTransactionHashes.empty());
+			assertParams(txChangeParams, builder, context);
+		}
+	}
+
+	TEST(TEST_CLASS, CanSyncCompatibleChains_TransactionNotificationWithAffectedAddresses) {
+		AssertCanSyncCompatibleChainsWithExtractedAddresses(
+				[](auto& builder, const auto&) { builder.addStatements(Balance_Transfer_Receipt_Type); },
+				[](const auto& txChangeParams, const auto& builder, const auto& context) {
+					// Assert: affected addresses include all extracted addresses and the account added by the processor
+					ASSERT_TRUE(txChangeParams.HasAffectedAddresses);
+					EXPECT_EQ(builder.addresses(), txChangeParams.AffectedAddresses.Transactions);
+
+					auto accountStateCacheView = context.Cache.template sub<cache::AccountStateCache>().createView();
+					const auto& sentinelAddress = accountStateCacheView->find(Sentinel_Processor_Public_Key).get().Address;
+					EXPECT_CONTAINS(txChangeParams.AffectedAddresses.Accounts, sentinelAddress);
+				});
+	}
+
+	TEST(TEST_CLASS, CanSyncCompatibleChains_TransactionNotificationWithoutAffectedAddressesWhenStatementsAreMissing) {
+		AssertCanSyncCompatibleChainsWithExtractedAddresses(
+				[](const auto&, const auto&) {},
+				[](const auto& txChangeParams, const auto&, const auto&) {
+					// Assert: affected addresses are unknown because expiries cannot be detected
+					EXPECT_FALSE(txChangeParams.HasAffectedAddresses);
+				});
+	}
+
+	TEST(TEST_CLASS, CanSyncCompatibleChains_TransactionNotificationWithoutAffectedAddressesWhenNamespaceExpires) {
+		AssertCanSyncCompatibleChainsWithExtractedAddresses(
+				[](auto& builder, const auto&) { builder.addStatements(Namespace_Expiry_Receipt_Type); },
+				[](const auto& txChangeParams, const auto&, const auto&) {
+					// Assert: affected addresses are unknown because transactions of other accounts can depend on the expired namespace
+					EXPECT_FALSE(txChangeParams.HasAffectedAddresses);
+				});
+	}
+
+	TEST(TEST_CLASS, CanSyncCompatibleChains_TransactionNotificationWithoutAffectedAddressesWhenTokenStateChanges) {
+		AssertCanSyncCompatibleChainsWithExtractedAddresses(
+				[](auto& builder, auto& context) {
+					builder.addStatements(Balance_Transfer_Receipt_Type);
+					context.HasTokenChanges = true;
+				},
+				[](const auto& txChangeParams, const auto&, const auto&) {
+					// Assert: affected addresses are unknown because token state is not indexed by account
+					EXPECT_FALSE(txChangeParams.HasAffectedAddresses);
+				});
+	}
+
+	TEST(TEST_CLASS, CanSyncIncompatibleChains_TransactionNotificationWithoutAffectedAddresses) {
+		// Arrange: create a local storage with blocks 1-7 and a remote storage with blocks 5-8
+		ConsumerTestContext context;
+		context.seedStorage(Height(7), 3);
+		auto input = CreateInput(Height(5), 4);
+
+		// - add transactions with extracted addresses and statements to the input
+		InputTransactionBuilder builder(input);
+		builder.addRandomWithExtractedAddresses(0, 1);
+		builder.addRandomWithExtractedAddresses(2, 3);
+		builder.addStatements(Balance_Transfer_Receipt_Type);
+
+		// Act:
+		auto result = context.Consumer(input);
+
+		// Assert:
+		test::AssertContinued(result);
+
+		// - affected addresses are unknown because rolled back blocks can revert expiries
+		ASSERT_EQ(1u, context.TransactionsChange.params().size());
+		EXPECT_FALSE(context.TransactionsChange.params()[0].HasAffectedAddresses);
 	}
 
 	TEST(TEST_CLASS, CanSyncIncompatibleChains_TransactionNotification) {
@@ -0,0 +1,414 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/consumers/ShardedRecentHashCache.h"
+#include "bitxorcore/thread/ThreadGroup.h"
+#include "tests/test/nodeps/TimeSupplier.h"
+#include "tests/TestHarness.h"
+#include <cstring>
+
+namespace bitxorcore { namespace consumers {
+
+#define TEST_CLASS ShardedRecentHashCacheTests
+
+	namespace {
+		constexpr auto Default_Options = HashCheckOptions(600'000, 60'000, 1'000);
+		constexpr auto Num_Default_Shards = 4u;
+		constexpr auto CreateTimeSupplier = test::CreateTimeSupplierFromSeconds;
+
+		chain::TimeSupplier DefaultTimeSupplier() {
+			return []() { return Timestamp(1); };
+		}
+
+		ShardedRecentHashCache CreateDefaultCache() {
+			return ShardedRecentHashCache(DefaultTimeSupplier(), Default_Options, Num_Default_Shards);
+		}
+
+		Hash256 GenerateRandomHashInShard(uint64_t shardIndex) {
+			// shard is selected by the last eight bytes of a hash
+			auto hash = test::GenerateRandomByteArray<Hash256>();
+			std::memcpy(&hash[Hash256::Size - sizeof(uint64_t)], &shardIndex, sizeof(uint64_t));
+			return hash;
+		}
+
+		void AssertStatistics(const ShardedRecentHashCache& cache, uint64_t numHits, uint64_t numMisses, uint64_t numPruned) {
+			const auto& statistics = cache.statistics();
+			EXPECT_EQ(numHits, statistics.NumHits);
+			EXPECT_EQ(numMisses, statistics.NumMisses);
+			EXPECT_EQ(numPruned, statistics.NumPruned);
+		}
+	}
+
+	// region ctor
+
+	TEST(TEST_CLASS, CacheIsInitiallyEmpty) {
+		// Act:
+		auto cache = CreateDefaultCache();
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		AssertStatistics(cache, 0, 0, 0);
+	}
+
+	// endregion
+
+	// region add
+
+	TEST(TEST_CLASS, CanAddSingleUnknownHash) {
+		// Arrange:
+		auto cache = CreateDefaultCache();
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+
+		// Act:
+		auto result = cache.add(hash);
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_TRUE(cache.contains(hash));
+		EXPECT_TRUE(result);
+		AssertStatistics(cache, 0, 1, 0);
+	}
+
+	TEST(TEST_CLASS, CanAddMultipleUnknownHashesToAllShards) {
+		// Arrange:
+		constexpr auto Num_Hashes = 2 * Num_Default_Shards;
+		auto cache = CreateDefaultCache();
+		std::vector<Hash256> hashes;
+		for (auto i = 0u; i < Num_Hashes; ++i)
+			hashes.push_back(GenerateRandomHashInShard(i));
+
+		std::vector<bool> results;
+
+		// Act:
+		for (const auto& hash : hashes)
+			results.push_back(cache.add(hash));
+
+		// Assert:
+		EXPECT_EQ(Num_Hashes, results.size());
+		EXPECT_EQ(Num_Hashes, cache.size());
+		AssertStatistics(cache, 0, Num_Hashes, 0);
+
+		for (auto i = 0u; i < Num_Hashes; ++i) {
+			auto message = "hash at index " + std::to_string(i);
+			EXPECT_TRUE(results[i]) << message;
+			EXPECT_TRUE(cache.contains(hashes[i])) << message;
+		}
+	}
+
+	TEST(TEST_CLASS, HashIsNotAddedWhenItIsAlreadyKnown) {
+		// Arrange:
+		auto cache = CreateDefaultCache();
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+		cache.add(hash);
+
+		// Act:
+		auto result = cache.add(hash);
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_FALSE(result);
+		AssertStatistics(cache, 1, 1, 0);
+	}
+
+	// endregion
+
+	// region add - expiry
+
+	TEST(TEST_CLASS, HashIsNotEvictedFromCacheBeforeBucketExpires) {
+		// Arrange:
+		ShardedRecentHashCache cache(CreateTimeSupplier({ 59, 659 }), Default_Options, 1);
+		auto hash1 = test::GenerateRandomByteArray<Hash256>();
+		auto hash2 = test::GenerateRandomByteArray<Hash256>();
+
+		// Act:
+		auto result1 = cache.add(hash1); // t59 - bucket [0, 60) expires after t659.999
+		auto result2 = cache.add(hash2); // t659
+
+		// Assert:
+		EXPECT_EQ(2u, cache.size());
+		EXPECT_TRUE(result1);
+		EXPECT_TRUE(result2);
+		EXPECT_TRUE(cache.contains(hash1));
+		EXPECT_TRUE(cache.contains(hash2));
+		AssertStatistics(cache, 0, 2, 0);
+	}
+
+	TEST(TEST_CLASS, HashIsEvictedFromCacheWhenBucketExpires) {
+		// Arrange:
+		ShardedRecentHashCache cache(CreateTimeSupplier({ 11, 660 }), Default_Options, 1);
+		auto hash1 = test::GenerateRandomByteArray<Hash256>();
+		auto hash2 = test::GenerateRandomByteArray<Hash256>();
+
+		// Act:
+		auto result1 = cache.add(hash1); // t11 - bucket [0, 60) expires after t659.999
+		auto result2 = cache.add(hash2); // t660
+
+		// Assert: size is 1 because hash1 was removed
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_TRUE(result1);
+		EXPECT_TRUE(result2);
+		EXPECT_FALSE(cache.contains(hash1));
+		EXPECT_TRUE(cache.contains(hash2));
+		AssertStatistics(cache, 0, 2, 1);
+	}
+
+	TEST(TEST_CLASS, ExpiredHashIsUnknown) {
+		// Arrange:
+		ShardedRecentHashCache cache(CreateTimeSupplier({ 11, 660 }), Default_Options, 1);
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+
+		// Act:
+		auto result1 = cache.add(hash); // t11
+		auto result2 = cache.add(hash); // t660 - hash expires before it is checked
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_TRUE(result1);
+		EXPECT_TRUE(result2);
+		EXPECT_TRUE(cache.contains(hash));
+		AssertStatistics(cache, 0, 2, 1);
+	}
+
+	TEST(TEST_CLASS, KnownHashExtendsItsLifetime) {
+		// Arrange:
+		ShardedRecentHashCache cache(CreateTimeSupplier({ 11, 400, 700 }), Default_Options, 1);
+		auto hash1 = test::GenerateRandomByteArray<Hash256>();
+		auto hash2 = test::GenerateRandomByteArray<Hash256>();
+
+		// Act:
+		auto result1 = cache.add(hash1); // t11
+		auto result2 = cache.add(hash1); // t400 - moves hash1 into bucket [360, 420)
+		auto result3 = cache.add(hash2); // t700 - expires bucket [0, 60), which no longer owns hash1
+
+		// Assert:
+		EXPECT_EQ(2u, cache.size());
+		EXPECT_TRUE(result1);
+		EXPECT_FALSE(result2);
+		EXPECT_TRUE(result3);
+		EXPECT_TRUE(cache.contains(hash1));
+		EXPECT_TRUE(cache.contains(hash2));
+		AssertStatistics(cache, 1, 2, 0);
+	}
+
+	TEST(TEST_CLASS, SinglePruneCanEvictMultipleBuckets) {
+		// Arrange: create five hashes
+		constexpr auto Num_Hashes = 5u;
+		ShardedRecentHashCache cache(CreateTimeSupplier({ 11, 61, 62, 130, 300, 780 }), Default_Options, 1);
+		auto hashes = test::GenerateRandomDataVector<Hash256>(Num_Hashes);
+
+		// - cache the hashes at t11, t61, t62, t130, t300
+		for (const auto& hash : hashes)
+			cache.add(hash);
+
+		// Act:
+		auto result = cache.add(test::GenerateRandomByteArray<Hash256>()); // t780 - evicts buckets [0, 60), [60, 120), [120, 180)
+
+		// Assert: 4 hashes were pruned
+		EXPECT_EQ(2u, cache.size());
+		EXPECT_TRUE(result);
+		EXPECT_TRUE(cache.contains(hashes[4]));
+		for (auto i : { 0u, 1u, 2u, 3u })
+			EXPECT_FALSE(cache.contains(hashes[i])) << "hash at index " << i;
+
+		AssertStatistics(cache, 0, Num_Hashes + 1, 4);
+	}
+
+	TEST(TEST_CLASS, PruneOnlyAffectsShardOfAddedHash) {
+		// Arrange:
+		ShardedRecentHashCache cache(CreateTimeSupplier({ 11, 11, 700 }), Default_Options, 2);
+		auto hash1 = GenerateRandomHashInShard(0);
+		auto hash2 = GenerateRandomHashInShard(1);
+		cache.add(hash1); // t11
+		cache.add(hash2); // t11
+
+		// Act:
+		cache.add(GenerateRandomHashInShard(0)); // t700
+
+		// Assert: only the expired hash in the first shard was removed
+		EXPECT_EQ(2u, cache.size());
+		EXPECT_FALSE(cache.contains(hash1));
+		EXPECT_TRUE(cache.contains(hash2));
+		AssertStatistics(cache, 0, 3, 1);
+	}
+
+	TEST(TEST_CLASS, TimeGoingBackwardsDoesNotCorruptBuckets) {
+		// Arrange:
+		ShardedRecentHashCache cache(CreateTimeSupplier({ 400, 11, 800 }), Default_Options, 1);
+		auto hash1 = test::GenerateRandomByteArray<Hash256>();
+		auto hash2 = test::GenerateRandomByteArray<Hash256>();
+
+		// Act:
+		cache.add(hash1); // t400
+		cache.add(hash2); // t11 - added to the most recent bucket [360, 420)
+		auto result = cache.add(hash1); // t800
+
+		// Assert: neither hash expired
+		EXPECT_EQ(2u, cache.size());
+		EXPECT_FALSE(result);
+		EXPECT_TRUE(cache.contains(hash1));
+		EXPECT_TRUE(cache.contains(hash2));
+	}
+
+	// endregion
+
+	// region contains
+
+	TEST(TEST_CLASS, ContainsReturnsTrueWhenHashIsKnown) {
+		// Arrange:
+		auto cache = CreateDefaultCache();
+		auto hash1 = test::GenerateRandomByteArray<Hash256>();
+		auto hash2 = test::GenerateRandomByteArray<Hash256>();
+		cache.add(hash1);
+		cache.add(hash2);
+
+		// Assert:
+		EXPECT_EQ(2u, cache.size());
+		EXPECT_TRUE(cache.contains(hash1));
+		EXPECT_TRUE(cache.contains(hash2));
+	}
+
+	TEST(TEST_CLASS, ContainsReturnsFalseWhenHashIsUnknown) {
+		// Arrange:
+		auto cache = CreateDefaultCache();
+		for (auto i = 0u; i < 10; ++i)
+			cache.add(test::GenerateRandomByteArray<Hash256>());
+
+		// Assert:
+		for (auto i = 0u; i < 5; ++i)
+			EXPECT_FALSE(cache.contains(test::GenerateRandomByteArray<Hash256>()));
+	}
+
+	TEST(TEST_CLASS, ContainsDoesNotChangeStatistics) {
+		// Arrange:
+		auto cache = CreateDefaultCache();
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+		cache.add(hash);
+
+		// Act:
+		cache.contains(hash);
+		cache.contains(test::GenerateRandomByteArray<Hash256>());
+
+		// Assert:
+		AssertStatistics(cache, 0, 1, 0);
+	}
+
+	// endregion
+
+	// region full cache
+
+	namespace {
+		constexpr auto Max_Cache_Size = 5u;
+		constexpr auto Max_Cache_Size_Options = HashCheckOptions(600'000, 60'000, Max_Cache_Size);
+
+		void FillCache(ShardedRecentHashCache& cache, const std::vector<Hash256>& hashes) {
+			for (const auto& hash : hashes)
+				cache.add(hash);
+		}
+	}
+
+	TEST(TEST_CLASS, CannotAddUnknownHashWhenShardIsFull) {
+		// Arrange:
+		ShardedRecentHashCache cache(DefaultTimeSupplier(), Max_Cache_Size_Options, 1);
+		auto hashes = test::GenerateRandomDataVector<Hash256>(Max_Cache_Size);
+		FillCache(cache, hashes);
+
+		// Sanity:
+		EXPECT_EQ(Max_Cache_Size, cache.size());
+
+		// Act: try to add another hash
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+		auto result = cache.add(hash);
+
+		// Assert: hash is unknown but hash was not added
+		EXPECT_EQ(Max_Cache_Size, cache.size());
+		EXPECT_TRUE(result);
+		EXPECT_FALSE(cache.contains(hash));
+		AssertStatistics(cache, 0, Max_Cache_Size + 1, 0);
+	}
+
+	TEST(TEST_CLASS, CanAddUnknownHashWhenShardIsFullButAtLeastOneHashIsEvicted) {
+		// Arrange:
+		ShardedRecentHashCache cache(CreateTimeSupplier({ 11, 61, 62, 63, 64, 660 }), Max_Cache_Size_Options, 1);
+		auto hashes = test::GenerateRandomDataVector<Hash256>(Max_Cache_Size);
+		FillCache(cache, hashes); // t11, t61..t64
+
+		// Act: try to add another hash
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+		auto result = cache.add(hash); // t660 - evicts hashes[0]
+
+		// Assert: hash is unknown and was added
+		EXPECT_EQ(Max_Cache_Size, cache.size());
+		EXPECT_TRUE(result);
+		EXPECT_TRUE(cache.contains(hash));
+		EXPECT_FALSE(cache.contains(hashes[0]));
+	}
+
+	TEST(TEST_CLASS, MaxCacheSizeIsSplitAcrossShards) {
+		// Arrange: each of the two shards can hold three hashes
+		ShardedRecentHashCache cache(DefaultTimeSupplier(), Max_Cache_Size_Options, 2);
+		std::vector<Hash256> hashes;
+		for (auto i = 0u; i < 4; ++i)
+			hashes.push_back(GenerateRandomHashInShard(0));
+
+		// Act:
+		FillCache(cache, hashes);
+		auto result = cache.add(GenerateRandomHashInShard(1));
+
+		// Assert: the last hash in the first shard was not added but the second shard still has capacity
+		EXPECT_EQ(4u, cache.size());
+		EXPECT_TRUE(result);
+		EXPECT_FALSE(cache.contains(hashes[3]));
+	}
+
+	// endregion
+
+	// region concurrency
+
+	TEST(TEST_CLASS, CanAddHashesConcurrently) {
+		// Arrange:
+		constexpr auto Num_Hashes = 500u;
+		auto numThreads = 2 * test::GetNumDefaultPoolThreads();
+		auto cache = CreateDefaultCache();
+		auto hashes = test::GenerateRandomDataVector<Hash256>(Num_Hashes);
+		std::atomic<uint32_t> numUnknown(0);
+
+		// Act: every thread adds all hashes
+		thread::ThreadGroup threads;
+		for (auto i = 0u; i < numThreads; ++i) {
+			threads.spawn([&cache, &hashes, &numUnknown]() {
+				for (const auto& hash : hashes) {
+					if (cache.add(hash))
+						++numUnknown;
+				}
+			});
+		}
+
+		threads.join();
+
+		// Assert: each hash was unknown exactly once
+		EXPECT_EQ(Num_Hashes, cache.size());
+		EXPECT_EQ(Num_Hashes, numUnknown);
+		AssertStatistics(cache, (numThreads - 1) * Num_Hashes, Num_Hashes, 0);
+	}
+
+	// endregion
+}}
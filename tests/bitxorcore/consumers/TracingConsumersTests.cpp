@@ -0,0 +1,342 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/consumers/TracingConsumers.h"
+#include "bitxorcore/utils/TraceRecorder.h"
+#include "tests/bitxorcore/consumers/test/ConsumerInputFactory.h"
+#include "tests/bitxorcore/consumers/test/ConsumerTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+using bitxorcore::disruptor::ConsumerInput;
+using bitxorcore::disruptor::ConsumerResult;
+using bitxorcore::disruptor::ConsumerResultSeverity;
+using bitxorcore::disruptor::InputSource;
+
+namespace bitxorcore { namespace consumers {
+
+#define TEST_CLASS TracingConsumersTests
+
+	namespace {
+		constexpr auto Custom_Completion_Code = static_cast<disruptor::CompletionCode>(123);
+
+		std::shared_ptr<utils::TraceRecorder> CreateTraceRecorder() {
+			return std::make_shared<utils::TraceRecorder>(100, []() { return std::string("tracing"); });
+		}
+
+		class TraceRecorderInstallationGuard {
+		public:
+			explicit TraceRecorderInstallationGuard(const std::shared_ptr<utils::TraceRecorder>& pRecorder) : m_recorder(*pRecorder) {
+				utils::InstallTraceRecorder(pRecorder);
+			}
+
+			~TraceRecorderInstallationGuard() {
+				utils::UninstallTraceRecorder(m_recorder);
+			}
+
+		private:
+			const utils::TraceRecorder& m_recorder;
+		};
+
+		ConsumerInput CreateInputWithBlocks(size_t numBlocks) {
+			auto input = test::CreateConsumerInputWithBlocks(numBlocks, InputSource::Remote_Pull);
+			for (auto i = 0u; i < numBlocks; ++i) {
+				const_cast<model::Block&>(input.blocks()[i].Block).Height = Height(10 + i);
+				input.blocks()[i].EntityHash = test::GenerateRandomByteArray<Hash256>();
+			}
+
+			return input;
+		}
+
+		void AssertBlockSpan(const utils::TraceEvent& event, const char* expectedName, const model::BlockElement& expectedElement) {
+			EXPECT_EQ(std::string("dispatcher"), event.Category);
+			EXPECT_EQ(std::string(expectedName), event.Name);
+			EXPECT_EQ(expectedElement.Block.Height, event.Height);
+			EXPECT_EQ(utils::ToShortHash(expectedElement.EntityHash), event.Hash);
+		}
+
+		// region traits
+
+		struct BlockConsumerTraits {
+			static auto CreateTracingConsumer(const char* name, uint32_t& numCalls) {
+				return CreateTracingBlockConsumer(name, [&numCalls](const auto&) {
+					++numCalls;
+					return ConsumerResult::Abort(Custom_Completion_Code, ConsumerResultSeverity::Neutral);
+				});
+			}
+
+			static auto Invoke(const disruptor::BlockConsumer& consumer, ConsumerInput& input) {
+				return consumer(input.blocks());
+			}
+		};
+
+		struct DisruptorConsumerTraits {
+			static auto CreateTracingConsumer(const char* name, uint32_t& numCalls) {
+				return CreateTracingDisruptorConsumer(name, [&numCalls](const auto&) {
+					++numCalls;
+					return ConsumerResult::Abort(Custom_Completion_Code, ConsumerResultSeverity::Neutral);
+				});
+			}
+
+			static auto Invoke(const disruptor::DisruptorConsumer& consumer, ConsumerInput& input) {
+				return consumer(input);
+			}
+		};
+
+		// endregion
+	}
+
+#define TRACING_CONSUMER_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Block) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BlockConsumerTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Disruptor) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<DisruptorConsumerTraits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	// region tracing consumers
+
+	TRACING_CONSUMER_TEST(TracingConsumerDelegatesToConsumerWhenNoRecorderIsInstalled) {
+		// Arrange:
+		auto pRecorder = CreateTraceRecorder();
+		auto numCalls = 0u;
+		auto consumer = TTraits::CreateTracingConsumer("alpha", numCalls);
+		auto input = CreateInputWithBlocks(3);
+
+		// Act:
+		auto result = TTraits::Invoke(consumer, input);
+
+		// Assert:
+		EXPECT_EQ(1u, numCalls);
+		test::AssertAborted(result, static_cast<validators::ValidationResult>(Custom_Completion_Code), ConsumerResultSeverity::Neutral);
+		EXPECT_TRUE(pRecorder->snapshot().Events.empty());
+	}
+
+	TRACING_CONSUMER_TEST(TracingConsumerRecordsSpanWhenRecorderIsInstalled) {
+		// Arrange:
+		auto pRecorder = CreateTraceRecorder();
+		TraceRecorderInstallationGuard installationGuard(pRecorder);
+
+		auto numCalls = 0u;
+		auto consumer = TTraits::CreateTracingConsumer("alpha", numCalls);
+		auto input = CreateInputWithBlocks(3);
+
+		// Act:
+		auto result = TTraits::Invoke(consumer, input);
+
+		// Assert:
+		EXPECT_EQ(1u, numCalls);
+		test::AssertAborted(result, static_cast<validators::ValidationResult>(Custom_Completion_Code), ConsumerResultSeverity::Neutral);
+
+		auto events = pRecorder->snapshot().Events;
+		ASSERT_EQ(1u, events.size());
+		AssertBlockSpan(events[0], "alpha", input.blocks()[2]);
+	}
+
+	TEST(TEST_CLASS, TracingDisruptorConsumerRecordsSpanWithoutBlockForTransactionInput) {
+		// Arrange:
+		auto pRecorder = CreateTraceRecorder();
+		TraceRecorderInstallationGuard installationGuard(pRecorder);
+
+		auto numCalls = 0u;
+		auto consumer = DisruptorConsumerTraits::CreateTracingConsumer("alpha", numCalls);
+		auto input = test::CreateConsumerInputWithTransactions(3, InputSource::Remote_Pull);
+
+		// Act:
+		consumer(input);
+
+		// Assert:
+		EXPECT_EQ(1u, numCalls);
+
+		auto events = pRecorder->snapshot().Events;
+		ASSERT_EQ(1u, events.size());
+		EXPECT_EQ(std::string("alpha"), events[0].Name);
+		EXPECT_EQ(Height(), events[0].Height);
+		EXPECT_EQ(utils::ShortHash(), events[0].Hash);
+	}
+
+	// endregion
+
+	// region SlowBlockTraceDumper
+
+	namespace {
+		std::vector<std::filesystem::path> ListFiles(const std::string& directory) {
+			std::vector<std::filesystem::path> filenames;
+			for (const auto& entry : std::filesystem::directory_iterator(directory))
+				filenames.push_back(entry.path());
+
+			return filenames;
+		}
+
+		constexpr auto Max_Trace_Files = 3u;
+
+		template<typename TAction>
+		void RunDumperTest(const utils::TimeSpan& threshold, size_t maxFiles, TAction action) {
+			// Arrange:
+			test::TempDirectoryGuard tempDirectoryGuard;
+			auto pRecorder = CreateTraceRecorder();
+			TraceRecorderInstallationGuard installationGuard(pRecorder);
+			SlowBlockTraceDumper dumper(pRecorder, tempDirectoryGuard.name(), threshold, maxFiles);
+
+			// Act + Assert:
+			action(dumper, tempDirectoryGuard.name());
+		}
+
+		void ProcessSlowly(SlowBlockTraceDumper& dumper, const ConsumerInput& input) {
+			dumper.start();
+			{
+				utils::TraceSpan span("dispatcher", "slow");
+				test::Sleep(5);
+			}
+
+			dumper.complete(input);
+		}
+	}
+
+	TEST(TEST_CLASS, DumperIgnoresCompletionWithoutStart) {
+		RunDumperTest(utils::TimeSpan(), Max_Trace_Files, [](auto& dumper, const auto& traceDirectory) {
+			// Act:
+			dumper.complete(CreateInputWithBlocks(3));
+
+			// Assert:
+			EXPECT_EQ(0u, dumper.numDumps());
+			EXPECT_TRUE(ListFiles(traceDirectory).empty());
+		});
+	}
+
+	TEST(TEST_CLASS, DumperDoesNotDumpFastInput) {
+		RunDumperTest(utils::TimeSpan::FromHours(1), Max_Trace_Files, [](auto& dumper, const auto& traceDirectory) {
+			// Act:
+			ProcessSlowly(dumper, CreateInputWithBlocks(3));
+
+			// Assert:
+			EXPECT_EQ(0u, dumper.numDumps());
+			EXPECT_TRUE(ListFiles(traceDirectory).empty());
+		});
+	}
+
+	TEST(TEST_CLASS, DumperDoesNotDumpSlowInputWithoutBlocks) {
+		RunDumperTest(utils::TimeSpan(), Max_Trace_Files, [](auto& dumper, const auto& traceDirectory) {
+			// Act:
+			ProcessSlowly(dumper, test::CreateConsumerInputWithTransactions(3, InputSource::Remote_Pull));
+
+			// Assert:
+			EXPECT_EQ(0u, dumper.numDumps());
+			EXPECT_TRUE(ListFiles(traceDirectory).empty());
+		});
+	}
+
+	TEST(TEST_CLASS, DumperDumpsSlowInput) {
+		RunDumperTest(utils::TimeSpan(), Max_Trace_Files, [](auto& dumper, const auto& traceDirectory) {
+			// Act:
+			ProcessSlowly(dumper, CreateInputWithBlocks(3));
+
+			// Assert:
+			EXPECT_EQ(1u, dumper.numDumps());
+
+			auto filenames = ListFiles(traceDirectory);
+			ASSERT_EQ(1u, filenames.size());
+			EXPECT_EQ(0u, filenames[0].filename().generic_string().find("12_"));
+			EXPECT_EQ(".json", filenames[0].extension().generic_string());
+
+			std::ifstream input(filenames[0].generic_string());
+			std::string contents((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+			EXPECT_EQ(0u, contents.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+			EXPECT_NE(std::string::npos, contents.find("\"name\":\"slow\""));
+		});
+	}
+
+	TEST(TEST_CLASS, DumperMatchesCompletionsWithStartsInOrder) {
+		RunDumperTest(utils::TimeSpan::FromMilliseconds(50), Max_Trace_Files, [](auto& dumper, const auto&) {
+			// Arrange: start two inputs, the first of which is slow
+			dumper.start();
+			test::Sleep(60);
+			dumper.start();
+
+			// Act:
+			dumper.complete(CreateInputWithBlocks(3));
+			dumper.complete(CreateInputWithBlocks(3));
+
+			// Assert: only the first input was dumped
+			EXPECT_EQ(1u, dumper.numDumps());
+		});
+	}
+
+	TEST(TEST_CLASS, DumperDoesNotDumpSlowInputWhenMaxFilesIsZero) {
+		RunDumperTest(utils::TimeSpan(), 0, [](auto& dumper, const auto& traceDirectory) {
+			// Act:
+			ProcessSlowly(dumper, CreateInputWithBlocks(3));
+
+			// Assert:
+			EXPECT_EQ(0u, dumper.numDumps());
+			EXPECT_TRUE(ListFiles(traceDirectory).empty());
+		});
+	}
+
+	TEST(TEST_CLASS, DumperDeletesOldestTraceFilesWhenMaxFilesIsExceeded) {
+		RunDumperTest(utils::TimeSpan(), Max_Trace_Files, [](auto& dumper, const auto& traceDirectory) {
+			// Act: dump traces for inputs ending at heights 10 - 14
+			for (auto i = 1u; i <= Max_Trace_Files + 2; ++i)
+				ProcessSlowly(dumper, CreateInputWithBlocks(i));
+
+			// Assert: only the most recent traces are kept
+			EXPECT_EQ(Max_Trace_Files + 2, dumper.numDumps());
+
+			std::vector<std::string> prefixes;
+			for (const auto& filename : ListFiles(traceDirectory))
+				prefixes.push_back(filename.filename().generic_string().substr(0, 3));
+
+			std::sort(prefixes.begin(), prefixes.end());
+			EXPECT_EQ(std::vector<std::string>({ "12_", "13_", "14_" }), prefixes);
+		});
+	}
+
+	TEST(TEST_CLASS, DumperDeletesOldestPreexistingTraceFilesWhenMaxFilesIsExceeded) {
+		// Arrange:
+		test::TempDirectoryGuard tempDirectoryGuard;
+		auto traceDirectory = std::filesystem::path(tempDirectoryGuard.name());
+
+		// - create trace files from a previous run (and a file that is not a trace)
+		for (const auto* filename : { "1_111.json", "2_222.json", "3_333.json", "notes.txt" }) {
+			std::ofstream((traceDirectory / filename).generic_string()) << "{}";
+			test::Sleep(5); // ensure distinct write times
+		}
+
+		auto pRecorder = CreateTraceRecorder();
+		TraceRecorderInstallationGuard installationGuard(pRecorder);
+		SlowBlockTraceDumper dumper(pRecorder, tempDirectoryGuard.name(), utils::TimeSpan(), Max_Trace_Files);
+
+		// Act:
+		ProcessSlowly(dumper, CreateInputWithBlocks(1));
+
+		// Assert: the oldest trace file was deleted
+		EXPECT_FALSE(std::filesystem::exists(traceDirectory / "1_111.json"));
+		EXPECT_TRUE(std::filesystem::exists(traceDirectory / "2_222.json"));
+		EXPECT_TRUE(std::filesystem::exists(traceDirectory / "3_333.json"));
+		EXPECT_TRUE(std::filesystem::exists(traceDirectory / "notes.txt"));
+		EXPECT_EQ(4u, ListFiles(tempDirectoryGuard.name()).size());
+	}
+
+	// endregion
+}}
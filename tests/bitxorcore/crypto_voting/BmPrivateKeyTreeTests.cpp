@@ -419,4 +419,219 @@ namespace bitxorcore { namespace crypto {
 	}
 
 	// endregion
+
+	// region verify - cache
+
+	namespace {
+		constexpr auto Verification_Key = BmKeyIdentifier{ 75 };
+
+		BmTreeSignature SignRandomMessage(TestContext& context, std::vector<uint8_t>& message) {
+			message = test::GenerateRandomVector(20);
+			return context.tree().sign(Verification_Key, message);
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyWithCacheSucceedsAndCachesValidSignature) {
+		// Arrange:
+		TestContext context;
+		std::vector<uint8_t> message;
+		auto signature = SignRandomMessage(context, message);
+		BmVerificationCache cache(100);
+
+		// Act:
+		auto result = Verify(signature, Verification_Key, message, cache);
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_TRUE(cache.containsBinding(signature.Root.ParentPublicKey, signature.Bottom.ParentPublicKey, Verification_Key));
+		EXPECT_EQ(1u, cache.numBindings());
+		EXPECT_EQ(1u, cache.numSignatures());
+	}
+
+	TEST(TEST_CLASS, VerifyWithCacheFailsAndDoesNotCacheInvalidSignature) {
+		// Arrange:
+		TestContext context;
+		std::vector<uint8_t> message;
+		auto signature = SignRandomMessage(context, message);
+		signature.Root.Signature[0] ^= 0xFF;
+		BmVerificationCache cache(100);
+
+		// Act:
+		auto result = Verify(signature, Verification_Key, message, cache);
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(0u, cache.numBindings());
+		EXPECT_EQ(0u, cache.numSignatures());
+	}
+
+	TEST(TEST_CLASS, VerifyWithCacheReusesCachedBindingForDifferentMessage) {
+		// Arrange:
+		TestContext context;
+		std::vector<uint8_t> message1;
+		std::vector<uint8_t> message2;
+		auto signature1 = SignRandomMessage(context, message1);
+		auto signature2 = SignRandomMessage(context, message2);
+		BmVerificationCache cache(100);
+		Verify(signature1, Verification_Key, message1, cache);
+
+		// - corrupt the root signature, which is only checked when binding is not cached
+		signature2.Root.Signature[0] ^= 0xFF;
+
+		// Act:
+		auto result = Verify(signature2, Verification_Key, message2, cache);
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(1u, cache.numBindings());
+		EXPECT_EQ(2u, cache.numSignatures());
+	}
+
+	TEST(TEST_CLASS, VerifyWithCacheDoesNotReuseCachedBindingForInvalidMessageSignature) {
+		// Arrange:
+		TestContext context;
+		std::vector<uint8_t> message;
+		auto signature = SignRandomMessage(context, message);
+		BmVerificationCache cache(100);
+		Verify(signature, Verification_Key, message, cache);
+
+		// Act:
+		message[0] ^= 0xFF;
+		auto result = Verify(signature, Verification_Key, message, cache);
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(1u, cache.numSignatures());
+	}
+
+	TEST(TEST_CLASS, VerifyWithCacheDoesNotReuseCachedBindingForDifferentKeyIdentifier) {
+		// Arrange:
+		TestContext context;
+		std::vector<uint8_t> message;
+		auto signature = SignRandomMessage(context, message);
+		BmVerificationCache cache(100);
+		Verify(signature, Verification_Key, message, cache);
+
+		// Act:
+		auto result = Verify(signature, BmKeyIdentifier{ Verification_Key.KeyId + 1 }, message, cache);
+
+		// Assert:
+		EXPECT_FALSE(result);
+	}
+
+	// endregion
+
+	// region verify multi
+
+	namespace {
+		struct SignedMessage {
+			std::vector<uint8_t> Message;
+			BmTreeSignature Signature;
+		};
+
+		std::vector<SignedMessage> SignRandomMessages(size_t numTrees, size_t numMessagesPerTree) {
+			std::vector<SignedMessage> signedMessages;
+			for (auto i = 0u; i < numTrees; ++i) {
+				TestContext context;
+				for (auto j = 0u; j < numMessagesPerTree; ++j) {
+					signedMessages.push_back(SignedMessage());
+					signedMessages.back().Signature = SignRandomMessage(context, signedMessages.back().Message);
+				}
+			}
+
+			return signedMessages;
+		}
+
+		RandomFiller CreateRandomFiller() {
+			return [](auto* pOut, auto count) {
+				// can use low entropy source for tests
+				utils::LowEntropyRandomGenerator().fill(pOut, count);
+			};
+		}
+
+		std::vector<bool> VerifyMultiSignedMessages(const std::vector<SignedMessage>& signedMessages, BmVerificationCache& cache) {
+			std::vector<BmTreeSignatureInput> inputs;
+			for (const auto& signedMessage : signedMessages)
+				inputs.push_back({ signedMessage.Signature, Verification_Key, signedMessage.Message });
+
+			return VerifyMulti(CreateRandomFiller(), inputs.data(), inputs.size(), cache);
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsWhenNoSignaturesAreProvided) {
+		// Arrange:
+		BmVerificationCache cache(100);
+
+		// Act:
+		auto results = VerifyMulti(CreateRandomFiller(), nullptr, 0, cache);
+
+		// Assert:
+		EXPECT_TRUE(results.empty());
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsWhenAllSignaturesAreValid) {
+		// Arrange:
+		auto signedMessages = SignRandomMessages(3, 2);
+		BmVerificationCache cache(100);
+
+		// Act:
+		auto results = VerifyMultiSignedMessages(signedMessages, cache);
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>(6, true), results);
+		EXPECT_EQ(3u, cache.numBindings());
+		EXPECT_EQ(6u, cache.numSignatures());
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsOnlyInvalidSignatures) {
+		// Arrange:
+		auto signedMessages = SignRandomMessages(3, 2);
+		signedMessages[1].Signature.Root.Signature[0] ^= 0xFF;
+		signedMessages[4].Message[0] ^= 0xFF;
+		BmVerificationCache cache(100);
+
+		// Act:
+		auto results = VerifyMultiSignedMessages(signedMessages, cache);
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>({ true, false, true, true, false, true }), results);
+		EXPECT_EQ(3u, cache.numBindings());
+		EXPECT_EQ(4u, cache.numSignatures());
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSkipsCachedComponents) {
+		// Arrange:
+		auto signedMessages = SignRandomMessages(2, 2);
+		BmVerificationCache cache(100);
+		VerifyMultiSignedMessages({ signedMessages[0], signedMessages[2] }, cache);
+
+		// - corrupt the root signatures, which are only checked when bindings are not cached
+		for (auto& signedMessage : signedMessages)
+			signedMessage.Signature.Root.Signature[0] ^= 0xFF;
+
+		// Act:
+		auto results = VerifyMultiSignedMessages(signedMessages, cache);
+
+		// Assert: only the bottom signatures were verified
+		EXPECT_EQ(std::vector<bool>(4, true), results);
+		EXPECT_EQ(2u, cache.numBindings());
+		EXPECT_EQ(6u, cache.numSignatures());
+	}
+
+	TEST(TEST_CLASS, VerifyMultiIsConsistentWithVerify) {
+		// Arrange:
+		auto signedMessages = SignRandomMessages(4, 1);
+		signedMessages[2].Signature.Bottom.Signature[0] ^= 0xFF;
+		BmVerificationCache cache(100);
+
+		// Act:
+		auto results = VerifyMultiSignedMessages(signedMessages, cache);
+
+		// Assert:
+		ASSERT_EQ(signedMessages.size(), results.size());
+		for (auto i = 0u; i < signedMessages.size(); ++i)
+			EXPECT_EQ(Verify(signedMessages[i].Signature, Verification_Key, signedMessages[i].Message), results[i]) << i;
+	}
+
+	// endregion
 }}
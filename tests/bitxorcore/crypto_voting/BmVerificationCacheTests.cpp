@@ -0,0 +1,248 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/crypto_voting/BmVerificationCache.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace bitxorcore { namespace crypto {
+
+#define TEST_CLASS BmVerificationCacheTests
+
+	namespace {
+		struct Binding {
+			VotingKey RootPublicKey;
+			VotingKey BottomPublicKey;
+		};
+
+		Binding GenerateRandomBinding() {
+			return { test::GenerateRandomByteArray<VotingKey>(), test::GenerateRandomByteArray<VotingKey>() };
+		}
+
+		bool ContainsBinding(const BmVerificationCache& cache, const Binding& binding, uint64_t keyId) {
+			return cache.containsBinding(binding.RootPublicKey, binding.BottomPublicKey, { keyId });
+		}
+
+		void AddBinding(BmVerificationCache& cache, const Binding& binding, uint64_t keyId) {
+			cache.addBinding(binding.RootPublicKey, binding.BottomPublicKey, { keyId });
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyCache) {
+		// Act:
+		BmVerificationCache cache(10);
+
+		// Assert:
+		EXPECT_EQ(0u, cache.numBindings());
+		EXPECT_EQ(0u, cache.numSignatures());
+	}
+
+	// endregion
+
+	// region bindings
+
+	TEST(TEST_CLASS, CanAddBinding) {
+		// Arrange:
+		BmVerificationCache cache(10);
+		auto binding = GenerateRandomBinding();
+
+		// Act:
+		AddBinding(cache, binding, 5);
+
+		// Assert:
+		EXPECT_EQ(1u, cache.numBindings());
+		EXPECT_TRUE(ContainsBinding(cache, binding, 5));
+	}
+
+	TEST(TEST_CLASS, BindingIsOnlyFoundForMatchingKeysAndKeyIdentifier) {
+		// Arrange:
+		BmVerificationCache cache(10);
+		auto binding = GenerateRandomBinding();
+		AddBinding(cache, binding, 5);
+
+		// Act + Assert:
+		EXPECT_TRUE(ContainsBinding(cache, binding, 5));
+		EXPECT_FALSE(ContainsBinding(cache, binding, 4));
+		EXPECT_FALSE(ContainsBinding(cache, binding, 6));
+		EXPECT_FALSE(ContainsBinding(cache, { binding.RootPublicKey, test::GenerateRandomByteArray<VotingKey>() }, 5));
+		EXPECT_FALSE(ContainsBinding(cache, { test::GenerateRandomByteArray<VotingKey>(), binding.BottomPublicKey }, 5));
+		EXPECT_FALSE(ContainsBinding(cache, { binding.BottomPublicKey, binding.RootPublicKey }, 5));
+	}
+
+	TEST(TEST_CLASS, AddingSameBindingMultipleTimesHasNoEffect) {
+		// Arrange:
+		BmVerificationCache cache(10);
+		auto binding = GenerateRandomBinding();
+
+		// Act:
+		for (auto i = 0u; i < 3; ++i)
+			AddBinding(cache, binding, 5);
+
+		// Assert:
+		EXPECT_EQ(1u, cache.numBindings());
+	}
+
+	TEST(TEST_CLASS, BindingsAreNotAddedWhenKeyIdentifierIsFull) {
+		// Arrange:
+		BmVerificationCache cache(3);
+		std::vector<Binding> bindings;
+		for (auto i = 0u; i < 5; ++i)
+			bindings.push_back(GenerateRandomBinding());
+
+		// Act:
+		for (const auto& binding : bindings)
+			AddBinding(cache, binding, 5);
+
+		// - other key identifiers have separate limits
+		AddBinding(cache, bindings[4], 6);
+
+		// Assert:
+		EXPECT_EQ(4u, cache.numBindings());
+		for (auto i = 0u; i < 5; ++i)
+			EXPECT_EQ(i < 3, ContainsBinding(cache, bindings[i], 5)) << i;
+
+		EXPECT_TRUE(ContainsBinding(cache, bindings[4], 6));
+	}
+
+	// endregion
+
+	// region signatures
+
+	TEST(TEST_CLASS, CanAddSignature) {
+		// Arrange:
+		BmVerificationCache cache(10);
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+
+		// Act:
+		cache.addSignature(hash, { 5 });
+
+		// Assert:
+		EXPECT_EQ(1u, cache.numSignatures());
+		EXPECT_TRUE(cache.containsSignature(hash, { 5 }));
+		EXPECT_FALSE(cache.containsSignature(hash, { 6 }));
+		EXPECT_FALSE(cache.containsSignature(test::GenerateRandomByteArray<Hash256>(), { 5 }));
+	}
+
+	TEST(TEST_CLASS, SignaturesAreClearedWhenKeyIdentifierIsFull) {
+		// Arrange:
+		BmVerificationCache cache(3);
+		auto hashes = test::GenerateRandomDataVector<Hash256>(4);
+		for (auto i = 0u; i < 3; ++i)
+			cache.addSignature(hashes[i], { 5 });
+
+		// Act:
+		cache.addSignature(hashes[3], { 5 });
+
+		// Assert:
+		EXPECT_EQ(1u, cache.numSignatures());
+		for (auto i = 0u; i < 3; ++i)
+			EXPECT_FALSE(cache.containsSignature(hashes[i], { 5 })) << i;
+
+		EXPECT_TRUE(cache.containsSignature(hashes[3], { 5 }));
+	}
+
+	// endregion
+
+	// region key identifier retention
+
+	TEST(TEST_CLASS, OnlyMostRecentlyUpdatedKeyIdentifiersAreRetained) {
+		// Arrange:
+		BmVerificationCache cache(10);
+		std::vector<Binding> bindings;
+		for (auto i = 0u; i < 3; ++i)
+			bindings.push_back(GenerateRandomBinding());
+
+		// Act:
+		AddBinding(cache, bindings[0], 5);
+		AddBinding(cache, bindings[1], 6);
+		AddBinding(cache, bindings[2], 7);
+
+		// Assert:
+		EXPECT_EQ(2u, cache.numBindings());
+		EXPECT_FALSE(ContainsBinding(cache, bindings[0], 5));
+		EXPECT_TRUE(ContainsBinding(cache, bindings[1], 6));
+		EXPECT_TRUE(ContainsBinding(cache, bindings[2], 7));
+	}
+
+	TEST(TEST_CLASS, LeastRecentlyUpdatedKeyIdentifierIsEvicted) {
+		// Arrange:
+		BmVerificationCache cache(10);
+		std::vector<Binding> bindings;
+		for (auto i = 0u; i < 4; ++i)
+			bindings.push_back(GenerateRandomBinding());
+
+		AddBinding(cache, bindings[0], 5);
+		AddBinding(cache, bindings[1], 6);
+		AddBinding(cache, bindings[2], 5);
+
+		// Act:
+		AddBinding(cache, bindings[3], 7);
+
+		// Assert: key identifier 6 was updated least recently
+		EXPECT_EQ(3u, cache.numBindings());
+		EXPECT_TRUE(ContainsBinding(cache, bindings[0], 5));
+		EXPECT_FALSE(ContainsBinding(cache, bindings[1], 6));
+		EXPECT_TRUE(ContainsBinding(cache, bindings[2], 5));
+		EXPECT_TRUE(ContainsBinding(cache, bindings[3], 7));
+	}
+
+	TEST(TEST_CLASS, ComponentsForKeyIdentifierOlderThanRetainedKeyIdentifiersAreCached) {
+		// Arrange:
+		BmVerificationCache cache(10);
+		auto binding = GenerateRandomBinding();
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+		auto binding6 = GenerateRandomBinding();
+		auto binding7 = GenerateRandomBinding();
+		AddBinding(cache, binding6, 6);
+		AddBinding(cache, binding7, 7);
+
+		// Act:
+		AddBinding(cache, binding, 5);
+		cache.addSignature(hash, { 5 });
+
+		// Assert: key identifier 6 was evicted because it was updated least recently
+		EXPECT_EQ(2u, cache.numBindings());
+		EXPECT_EQ(1u, cache.numSignatures());
+		EXPECT_TRUE(ContainsBinding(cache, binding, 5));
+		EXPECT_TRUE(cache.containsSignature(hash, { 5 }));
+		EXPECT_FALSE(ContainsBinding(cache, binding6, 6));
+		EXPECT_TRUE(ContainsBinding(cache, binding7, 7));
+	}
+
+	TEST(TEST_CLASS, ComponentsForOlderRetainedKeyIdentifierCanBeAdded) {
+		// Arrange:
+		BmVerificationCache cache(10);
+		auto binding = GenerateRandomBinding();
+		AddBinding(cache, GenerateRandomBinding(), 7);
+
+		// Act:
+		AddBinding(cache, binding, 5);
+
+		// Assert:
+		EXPECT_EQ(2u, cache.numBindings());
+		EXPECT_TRUE(ContainsBinding(cache, binding, 5));
+	}
+
+	// endregion
+}}
@@ -24,6 +24,7 @@
 #include "tests/test/other/DeltaElementsTestUtils.h"
 #include "tests/test/other/UpdateSetTests.h"
 #include "tests/TestHarness.h"
+#include <unordered_set>
 
 namespace bitxorcore { namespace deltaset {
 
@@ -31,12 +32,14 @@ namespace bitxorcore { namespace deltaset {
 
 	namespace {
 		using Types = test::DeltaElementsTestUtils::Types;
+		using ElementType = Types::MemoryMapType::mapped_type;
 
-		struct MemoryStorageTraits {
+		template<typename TStorageMap, bool UseMovableDeltas>
+		struct MemoryStorageTraitsT {
 		public:
 			struct TestContext : public test::DeltaElementsTestUtils::Wrapper<Types::MemoryMapType> {
 			public:
-				Types::StorageMapType Set;
+				TStorageMap Set;
 
 			public:
 				TestContext() {
@@ -45,23 +48,112 @@ namespace bitxorcore { namespace deltaset {
 					AddElement(Set, "ccc", 3);
 					AddElement(Set, "ddd", 2);
 				}
+
+			public:
+				auto deltas() {
+					if constexpr (UseMovableDeltas)
+						return MovableDeltaElements<Types::MemoryMapType>(Added, Removed, Copied);
+					else
+						return test::DeltaElementsTestUtils::Wrapper<Types::MemoryMapType>::deltas();
+				}
 			};
 
 		public:
-			using CommitPolicy = BaseSetCommitPolicy<Types::StorageTraits>;
+			using CommitPolicy = BaseSetCommitPolicy<
+				MapStorageTraits<TStorageMap, test::TestElementToKeyConverter<ElementType>, Types::MemoryMapType>>;
 
 			template<typename TMap>
 			static void AddElement(TMap& map, const std::string& name, unsigned int value, size_t dummy = 0) {
 				map.emplace(std::make_pair(name, value), test::MutableTestElement(name, value)).first->second.Dummy = dummy;
 			}
 
-			static bool Contains(const Types::StorageMapType& map, const std::string& name, unsigned int value, size_t dummy = 0) {
+			static bool Contains(const TStorageMap& map, const std::string& name, unsigned int value, size_t dummy = 0) {
 				auto iter = map.find(std::make_pair(name, value));
 				return map.cend() != iter && dummy == iter->second.Dummy;
 			}
 		};
+
+		using MemoryStorageTraits = MemoryStorageTraitsT<Types::StorageMapType, false>;
+		using MovableMemoryStorageTraits = MemoryStorageTraitsT<Types::StorageMapType, true>;
+		using MovableSameTypeMemoryStorageTraits = MemoryStorageTraitsT<Types::MemoryMapType, true>;
 	}
 
 	DEFINE_UPDATE_SET_TESTS(MemoryStorageTraits)
 	DEFINE_MEMORY_ONLY_UPDATE_SET_TESTS(MemoryStorageTraits)
+
+#undef TEST_CLASS
+#define TEST_CLASS BaseSetCommitPolicyMovableTests
+
+	DEFINE_UPDATE_SET_TESTS(MovableMemoryStorageTraits)
+	DEFINE_MEMORY_ONLY_UPDATE_SET_TESTS(MovableMemoryStorageTraits)
+
+#undef TEST_CLASS
+#define TEST_CLASS BaseSetCommitPolicyMovableSameTypeTests
+
+	DEFINE_UPDATE_SET_TESTS(MovableSameTypeMemoryStorageTraits)
+	DEFINE_MEMORY_ONLY_UPDATE_SET_TESTS(MovableSameTypeMemoryStorageTraits)
+
+	// region movable deltas - no copies
+
+	namespace {
+		using MoveOnlyMap = std::unordered_map<uint32_t, std::unique_ptr<uint32_t>>;
+		using NodeSet = std::unordered_set<std::string>;
+
+		void AddMoveOnlyElement(MoveOnlyMap& map, uint32_t key, uint32_t value) {
+			map.emplace(key, std::make_unique<uint32_t>(value));
+		}
+	}
+
+	TEST(TEST_CLASS, MovableDeltasSupportMoveOnlyMapValues) {
+		// Arrange:
+		MoveOnlyMap set, added, removed, copied;
+		AddMoveOnlyElement(set, 1, 10);
+		AddMoveOnlyElement(set, 2, 20);
+		AddMoveOnlyElement(set, 3, 30);
+
+		AddMoveOnlyElement(added, 4, 40);
+		AddMoveOnlyElement(copied, 2, 22);
+		AddMoveOnlyElement(removed, 3, 30);
+
+		const auto* pAddedValue = added.find(4)->second.get();
+		const auto* pCopiedValue = copied.find(2)->second.get();
+		const auto* pOriginalNode = &*set.find(2);
+
+		// Act:
+		UpdateSet<MapKeyTraits<MoveOnlyMap>>(set, MovableDeltaElements<MoveOnlyMap>(added, removed, copied));
+
+		// Assert: values were moved and the copied value was assigned to the original node
+		ASSERT_EQ(3u, set.size());
+		EXPECT_EQ(10u, *set.find(1)->second);
+		EXPECT_EQ(22u, *set.find(2)->second);
+		EXPECT_EQ(40u, *set.find(4)->second);
+
+		EXPECT_EQ(pAddedValue, set.find(4)->second.get());
+		EXPECT_EQ(pCopiedValue, set.find(2)->second.get());
+		EXPECT_EQ(pOriginalNode, &*set.find(2));
+	}
+
+	TEST(TEST_CLASS, MovableDeltasSpliceSetNodesWhenSetTypesMatch) {
+		// Arrange:
+		NodeSet set{ "aaa", "ccc", "ddd" };
+		NodeSet added{ "bbb" };
+		NodeSet removed{ "ddd" };
+		NodeSet copied{ "ccc" };
+
+		const auto* pAddedElement = &*added.find("bbb");
+		const auto* pCopiedElement = &*copied.find("ccc");
+
+		// Act:
+		UpdateSet<SetKeyTraits<NodeSet>>(set, MovableDeltaElements<NodeSet>(added, removed, copied));
+
+		// Assert: added and copied nodes were moved into the original set
+		EXPECT_EQ(NodeSet({ "aaa", "bbb", "ccc" }), set);
+		EXPECT_EQ(pAddedElement, &*set.find("bbb"));
+		EXPECT_EQ(pCopiedElement, &*set.find("ccc"));
+
+		EXPECT_TRUE(added.empty());
+		EXPECT_TRUE(copied.empty());
+	}
+
+	// endregion
 }}
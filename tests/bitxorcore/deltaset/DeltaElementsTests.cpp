@@ -63,4 +63,43 @@ namespace bitxorcore { namespace deltaset {
 	TEST(TEST_CLASS, HasChangesReturnsTrueWhenAllSetsHaveChanges) {
 		AssertHasChanges({ 1 }, { 1 }, { 1 });
 	}
+
+	// region MovableDeltaElements
+
+	TEST(TEST_CLASS, MovableHasChangesReturnsFalseWhenThereAreNoChanges) {
+		// Arrange:
+		std::set<int> added, removed, copied;
+		MovableDeltaElements<std::set<int>> elements(added, removed, copied);
+
+		// Assert:
+		EXPECT_FALSE(elements.HasChanges());
+	}
+
+	TEST(TEST_CLASS, MovableHasChangesReturnsTrueWhenAnySetHasChanges) {
+		for (auto i = 0u; i < 3; ++i) {
+			// Arrange:
+			std::set<int> sets[3];
+			sets[i].insert(1);
+			MovableDeltaElements<std::set<int>> elements(sets[0], sets[1], sets[2]);
+
+			// Assert:
+			EXPECT_TRUE(elements.HasChanges()) << i;
+		}
+	}
+
+	TEST(TEST_CLASS, MovableCanCreateConstViewAroundSameSets) {
+		// Arrange:
+		std::set<int> added{ 1 }, removed{ 2 }, copied{ 3 };
+		MovableDeltaElements<std::set<int>> elements(added, removed, copied);
+
+		// Act:
+		auto constElements = elements.asConst();
+
+		// Assert:
+		EXPECT_EQ(&added, &constElements.Added);
+		EXPECT_EQ(&removed, &constElements.Removed);
+		EXPECT_EQ(&copied, &constElements.Copied);
+	}
+
+	// endregion
 }}
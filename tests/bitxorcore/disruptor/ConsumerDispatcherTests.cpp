@@ -250,6 +250,49 @@ namespace bitxorcore { namespace disruptor {
 
 	// endregion
 
+	// region consumerLatencies
+
+	TEST(TEST_CLASS, ConsumerLatenciesAreInitiallyEmpty) {
+		// Act:
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, { CreateNoOpConsumer(), CreateNoOpConsumer() });
+
+		// Assert:
+		for (auto i = 0u; i < dispatcher.size(); ++i) {
+			auto snapshot = dispatcher.consumerLatencies(i).snapshot();
+			EXPECT_EQ(0u, snapshot.Count) << "consumer " << i;
+			EXPECT_EQ(0u, snapshot.SumMicros) << "consumer " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, ConsumerLatenciesAreRecordedForEachProcessedElement) {
+		// Arrange:
+		auto ranges = test::PrepareRanges(4);
+		auto slowConsumer = [](const auto&) {
+			test::Sleep(5);
+			return ConsumerResult::Continue();
+		};
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, { slowConsumer, CreateNoOpConsumer() });
+
+		// Act:
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_VALUE_EXPR(4u, dispatcher.numAddedElements());
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		auto slowSnapshot = dispatcher.consumerLatencies(0).snapshot();
+		auto fastSnapshot = dispatcher.consumerLatencies(1).snapshot();
+
+		// Assert: each consumer processed each element exactly once
+		EXPECT_EQ(4u, slowSnapshot.Count);
+		EXPECT_EQ(4u, fastSnapshot.Count);
+
+		// - all samples of the slow consumer should be in buckets with bounds of at least 5ms
+		EXPECT_LE(4u * 5'000, slowSnapshot.SumMicros);
+		for (auto i = 0u; utils::LatencyHistogram::BucketUpperBound(i) < 5'000; ++i)
+			EXPECT_EQ(0u, slowSnapshot.BucketCounts[i]) << "bucket " << i;
+	}
+
+	// endregion
+
 	// region process + consume (no inspect)
 
 	namespace {
@@ -31,6 +31,7 @@
 #include "bitxorcore/consumers/BlockchainSyncHandlers.h"
 #include "bitxorcore/extensions/LocalNodeChainScore.h"
 #include "bitxorcore/io/IndexFile.h"
+#include "bitxorcore/io/RawFile.h"
 #include "bitxorcore/model/Address.h"
 #include "bitxorcore/model/BlockchainConfiguration.h"
 #include "tests/test/cache/CacheTestUtils.h"
@@ -106,22 +107,29 @@ namespace bitxorcore { namespace extensions {
 			return supplementalData;
 		}
 
-		void PrepareAndSaveCompleteState(const config::BitxorCoreDirectory& directory, cache::BitxorCoreCache& cache) {
+		void PrepareAndSaveCompleteState(
+				const config::BitxorCoreDirectory& directory,
+				cache::BitxorCoreCache& cache,
+				const utils::FileSize& chunkSize) {
 			// Arrange:
 			auto supplementalData = CreateDeterministicSupplementalData();
 			RandomSeedCache(cache, supplementalData.State);
 
-			LocalNodeStateSerializer serializer(directory);
+			LocalNodeStateSerializer serializer(directory, chunkSize);
 			serializer.save(cache, supplementalData.ChainScore);
 		}
 
+		void PrepareAndSaveCompleteState(const config::BitxorCoreDirectory& directory, cache::BitxorCoreCache& cache) {
+			PrepareAndSaveCompleteState(directory, cache, utils::FileSize());
+		}
+
 		void PrepareAndSaveSummaryState(const config::BitxorCoreDirectory& directory, cache::BitxorCoreCache& cache) {
 			// Arrange:
 			auto supplementalData = CreateDeterministicSupplementalData();
 			RandomSeedCache(cache, supplementalData.State);
 
 			auto storages = const_cast<const cache::BitxorCoreCache&>(cache).storages();
-			LocalNodeStateSerializer serializer(directory);
+			LocalNodeStateSerializer serializer(directory, utils::FileSize());
 			serializer.save(cache.createDelta(), storages, supplementalData.ChainScore, Height(54321));
 		}
 
@@ -273,7 +281,7 @@ namespace bitxorcore { namespace extensions {
 
 	namespace {
 		template<typename TPrepare>
-		void RunSaveAndLoadCompleteStateTest(TPrepare prepare) {
+		void RunSaveAndLoadCompleteStateTest(TPrepare prepare, const utils::FileSize& chunkSize) {
 			// Arrange: seed and save the cache state with rocks disabled
 			test::TempDirectoryGuard tempDir;
 			auto stateDirectory = config::BitxorCoreDirectory(tempDir.name() + "/zstate");
@@ -284,7 +292,7 @@ namespace bitxorcore { namespace extensions {
 			prepare(stateDirectory);
 
 			// Act: save the state
-			PrepareAndSaveCompleteState(stateDirectory, originalCache);
+			PrepareAndSaveCompleteState(stateDirectory, originalCache, chunkSize);
 
 			// Act: load the state
 			test::LocalNodeTestState loadedState(
@@ -309,11 +317,45 @@ namespace bitxorcore { namespace extensions {
 	}
 
 	TEST(TEST_CLASS, CanSaveAndLoadCompleteState_DirectoryDoesNotExist) {
-		RunSaveAndLoadCompleteStateTest(PrepareNonexistentDirectory);
+		RunSaveAndLoadCompleteStateTest(PrepareNonexistentDirectory, utils::FileSize());
 	}
 
 	TEST(TEST_CLASS, CanSaveAndLoadCompleteState_DirectoryExists) {
-		RunSaveAndLoadCompleteStateTest(PrepareEmptyDirectory);
+		RunSaveAndLoadCompleteStateTest(PrepareEmptyDirectory, utils::FileSize());
+	}
+
+	TEST(TEST_CLASS, CanSaveAndLoadCompleteState_Chunked) {
+		RunSaveAndLoadCompleteStateTest(PrepareEmptyDirectory, utils::FileSize::FromBytes(100));
+	}
+
+	TEST(TEST_CLASS, CannotLoadCompleteStateWithCorruptChunk) {
+		// Arrange: seed and save the cache state in chunks
+		test::TempDirectoryGuard tempDir;
+		auto stateDirectory = config::BitxorCoreDirectory(tempDir.name() + "/zstate");
+		auto blockchainConfig = model::BlockchainConfiguration::Uninitialized();
+		auto originalCache = test::CoreSystemCacheFactory::Create(blockchainConfig);
+		PrepareAndSaveCompleteState(stateDirectory, originalCache, utils::FileSize::FromBytes(100));
+
+		// - corrupt the last byte of the account state cache file
+		{
+			io::RawFile file(stateDirectory.file("AccountStateCache.dat"), io::OpenMode::Read_Append);
+			file.seek(file.size() - 1);
+
+			uint8_t byte;
+			file.read({ &byte, 1 });
+			byte ^= 0xFF;
+			file.seek(file.size() - 1);
+			file.write({ &byte, 1 });
+		}
+
+		test::LocalNodeTestState loadedState(
+				blockchainConfig,
+				stateDirectory.str(),
+				test::CoreSystemCacheFactory::Create(blockchainConfig));
+		auto pluginManager = test::CreatePluginManager();
+
+		// Act + Assert:
+		EXPECT_THROW(LoadStateFromDirectory(stateDirectory, loadedState.ref(), pluginManager), bitxorcore_file_io_error);
 	}
 
 	// endregion
@@ -402,7 +444,7 @@ namespace bitxorcore { namespace extensions {
 			prepare(stateDirectory2);
 
 			// Act:
-			LocalNodeStateSerializer serializer(stateDirectory);
+			LocalNodeStateSerializer serializer(stateDirectory, utils::FileSize());
 			serializer.moveTo(stateDirectory2);
 
 			// Assert:
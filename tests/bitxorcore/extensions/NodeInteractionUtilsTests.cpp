@@ -21,6 +21,7 @@
 **/
 
 #include "bitxorcore/extensions/NodeInteractionUtils.h"
+#include "bitxorcore/api/RemoteChainApi.h"
 #include "bitxorcore/ionet/NodeContainer.h"
 #include "bitxorcore/ionet/NodeInteractionResult.h"
 #include "tests/test/net/NodeTestUtils.h"
@@ -81,4 +82,73 @@ namespace bitxorcore { namespace extensions {
 			EXPECT_EQ(0u, interactions.NumFailures);
 		});
 	}
+
+	// region RecordTransferMeasurement
+
+	namespace {
+		template<typename TAssert>
+		void AssertRecord(const api::RemoteRequestMeasurement& measurement, TAssert assertFunc) {
+			// Arrange:
+			auto identity = model::NodeIdentity{ test::GenerateRandomByteArray<Key>(), "11.22.33.44" };
+			ionet::NodeContainer container;
+			container.modifier().add(test::CreateNamedNode(identity, "Alice"), ionet::NodeSource::Static);
+
+			// Act:
+			RecordTransferMeasurement(container, identity, measurement);
+
+			// Assert:
+			assertFunc(container.view().getNodeInfo(identity).transferStatistics());
+		}
+	}
+
+	TEST(TEST_CLASS, RoundTripIsRecordedForMeasurementWithoutSize) {
+		// Act:
+		AssertRecord({ 1234, 0 }, [](const auto& transferStatistics) {
+			EXPECT_EQ(1u, transferStatistics.NumRoundTripSamples);
+			EXPECT_EQ(1234u, transferStatistics.RoundTripMicros);
+			EXPECT_EQ(0u, transferStatistics.NumThroughputSamples);
+		});
+	}
+
+	TEST(TEST_CLASS, ThroughputIsRecordedForMeasurementWithSize) {
+		// Act:
+		AssertRecord({ 500'000, 1000 }, [](const auto& transferStatistics) {
+			EXPECT_EQ(0u, transferStatistics.NumRoundTripSamples);
+			EXPECT_EQ(1u, transferStatistics.NumThroughputSamples);
+			EXPECT_EQ(2000u, transferStatistics.BytesPerSecond);
+		});
+	}
+
+	// endregion
+
+	// region GetNodeTransferWeight
+
+	TEST(TEST_CLASS, UnknownNodeHasNeutralTransferWeight) {
+		// Arrange:
+		auto identity = model::NodeIdentity{ test::GenerateRandomByteArray<Key>(), "11.22.33.44" };
+		ionet::NodeContainer container;
+
+		// Act:
+		auto weight = GetNodeTransferWeight(container, test::CreateNamedNode(identity, "Alice"));
+
+		// Assert:
+		EXPECT_EQ(5'000u, weight);
+	}
+
+	TEST(TEST_CLASS, KnownNodeHasTransferWeightBasedOnTransferStatistics) {
+		// Arrange:
+		auto identity = model::NodeIdentity{ test::GenerateRandomByteArray<Key>(), "11.22.33.44" };
+		auto node = test::CreateNamedNode(identity, "Alice");
+		ionet::NodeContainer container;
+		container.modifier().add(node, ionet::NodeSource::Static);
+		container.modifier().recordThroughput(identity, 800'000, 1'000'000);
+
+		// Act:
+		auto weight = GetNodeTransferWeight(container, node);
+
+		// Assert:
+		EXPECT_EQ(8'000u, weight);
+	}
+
+	// endregion
 }}
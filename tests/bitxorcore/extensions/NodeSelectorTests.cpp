@@ -183,6 +183,48 @@ namespace bitxorcore { namespace extensions {
 
 	// endregion
 
+	// region CalculateTransferWeight
+
+	namespace {
+		ionet::NodeTransferStatistics CreateTransferStatistics(uint64_t roundTripMicros, uint64_t bytesPerSecond) {
+			ionet::NodeTransferStatistics transferStatistics;
+			transferStatistics.NumRoundTripSamples = 0 == roundTripMicros ? 0 : 1;
+			transferStatistics.RoundTripMicros = roundTripMicros;
+			transferStatistics.NumThroughputSamples = 0 == bytesPerSecond ? 0 : 1;
+			transferStatistics.BytesPerSecond = bytesPerSecond;
+			return transferStatistics;
+		}
+	}
+
+	TEST(TEST_CLASS, UnmeasuredNodeIsGivenNeutralTransferWeight) {
+		EXPECT_EQ(5'000u, CalculateTransferWeight(ionet::NodeTransferStatistics()));
+	}
+
+	TEST(TEST_CLASS, NodeIsGivenTransferWeightAccordingToThroughputFormula) {
+		EXPECT_EQ(500u, CalculateTransferWeight(CreateTransferStatistics(0, 1'000)));
+		EXPECT_EQ(500u, CalculateTransferWeight(CreateTransferStatistics(0, 50'000)));
+		EXPECT_EQ(1'200u, CalculateTransferWeight(CreateTransferStatistics(0, 120'000)));
+		EXPECT_EQ(5'000u, CalculateTransferWeight(CreateTransferStatistics(0, 500'000)));
+		EXPECT_EQ(10'000u, CalculateTransferWeight(CreateTransferStatistics(0, 1'000'000)));
+		EXPECT_EQ(10'000u, CalculateTransferWeight(CreateTransferStatistics(0, 100'000'000)));
+	}
+
+	TEST(TEST_CLASS, NodeIsGivenTransferWeightAccordingToRoundTripFormulaWhenThroughputIsUnmeasured) {
+		EXPECT_EQ(10'000u, CalculateTransferWeight(CreateTransferStatistics(1'000, 0)));
+		EXPECT_EQ(10'000u, CalculateTransferWeight(CreateTransferStatistics(50'000, 0)));
+		EXPECT_EQ(5'000u, CalculateTransferWeight(CreateTransferStatistics(100'000, 0)));
+		EXPECT_EQ(1'000u, CalculateTransferWeight(CreateTransferStatistics(500'000, 0)));
+		EXPECT_EQ(500u, CalculateTransferWeight(CreateTransferStatistics(1'000'000, 0)));
+		EXPECT_EQ(500u, CalculateTransferWeight(CreateTransferStatistics(10'000'000, 0)));
+	}
+
+	TEST(TEST_CLASS, ThroughputTakesPrecedenceOverRoundTripWhenCalculatingTransferWeight) {
+		EXPECT_EQ(2'000u, CalculateTransferWeight(CreateTransferStatistics(1'000, 200'000)));
+		EXPECT_EQ(9'000u, CalculateTransferWeight(CreateTransferStatistics(1'000'000, 900'000)));
+	}
+
+	// endregion
+
 	// region WeightPolicyGenerator
 
 	TEST(TEST_CLASS, WeightPolicyGeneratorGeneratedValuesAreAccordinglyBalancedBetweenInteractionsAndImportance) {
@@ -627,6 +669,8 @@ namespace bitxorcore { namespace extensions {
 			ionet::NodeSource Source2;
 			ionet::ConnectionState ConnectionState1;
 			ionet::ConnectionState ConnectionState2;
+			uint64_t BytesPerSecond1 = 0;
+			uint64_t BytesPerSecond2 = 0;
 		};
 
 		std::pair<uint32_t, uint32_t> RunManyPairwiseSelections(const NodeInfos& nodeInfos) {
@@ -642,6 +686,12 @@ namespace bitxorcore { namespace extensions {
 				test::AddNodeInteractions(modifier, node1.identity(), interactions1.NumSuccesses, interactions1.NumFailures);
 				auto& interactions2 = nodeInfos.Interactions2;
 				test::AddNodeInteractions(modifier, node2.identity(), interactions2.NumSuccesses, interactions2.NumFailures);
+
+				if (0 != nodeInfos.BytesPerSecond1)
+					modifier.recordThroughput(node1.identity(), nodeInfos.BytesPerSecond1, 1'000'000);
+
+				if (0 != nodeInfos.BytesPerSecond2)
+					modifier.recordThroughput(node2.identity(), nodeInfos.BytesPerSecond2, 1'000'000);
 			}
 
 			// Act: run a lot of selections
@@ -730,6 +780,32 @@ namespace bitxorcore { namespace extensions {
 		});
 	}
 
+	TEST(TEST_CLASS, FastNodeHasHigherPriorityThanUnmeasuredNode) {
+		// Arrange: transfer weights 5000 / 10000
+		auto interactions1 = ionet::NodeInteractions();
+		auto interactions2 = ionet::NodeInteractions();
+		NodeInfos nodeInfos(interactions1, interactions2);
+		nodeInfos.BytesPerSecond2 = 2'000'000;
+
+		// Assert:
+		RunNonDeterministicPairwiseSelectionTest(nodeInfos, [](const auto& counts) {
+			return counts.first < counts.second && counts.second < 5 * counts.first;
+		});
+	}
+
+	TEST(TEST_CLASS, SlowNodeHasLowerPriorityThanUnmeasuredNode) {
+		// Arrange: transfer weights 5000 / 500
+		auto interactions1 = ionet::NodeInteractions();
+		auto interactions2 = ionet::NodeInteractions();
+		NodeInfos nodeInfos(interactions1, interactions2);
+		nodeInfos.BytesPerSecond2 = 10'000;
+
+		// Assert:
+		RunNonDeterministicPairwiseSelectionTest(nodeInfos, [](const auto& counts) {
+			return counts.second < counts.first;
+		});
+	}
+
 	TEST(TEST_CLASS, BannedStaticNodeHasLowerPriorityThanNonBannedStaticNode) {
 		// Arrange:
 		auto interactions1 = ionet::NodeInteractions();
@@ -37,6 +37,7 @@ namespace bitxorcore { namespace extensions {
 		test::MutableBitxorCoreConfiguration config;
 		config.Node.EnableCacheDatabaseStorage = true;
 		config.Node.CacheDatabase.MaxWriteBatchSize = utils::FileSize::FromKilobytes(123);
+		config.Node.MaxStatePathKeysPerRequest = 456;
 		config.User.DataDirectory = "foo_bar";
 
 		// Act:
@@ -46,6 +47,7 @@ namespace bitxorcore { namespace extensions {
 		EXPECT_TRUE(storageConfig.PreferCacheDatabase);
 		EXPECT_EQ("foo_bar/statedb", storageConfig.CacheDatabaseDirectory);
 		EXPECT_EQ(utils::FileSize::FromKilobytes(123), storageConfig.CacheDatabaseConfig.MaxWriteBatchSize);
+		EXPECT_EQ(456u, storageConfig.MaxStatePathKeysPerRequest);
 	}
 
 	namespace {
@@ -253,4 +253,60 @@ namespace bitxorcore { namespace extensions {
 	TEST(TEST_CLASS, NodeInteractionsAreNotUpdatedOnNoneInteraction) {
 		AssertNodeInteractionsAreNotUpdated(ionet::NodeInteractionResultCode::None);
 	}
+
+	// region CreateMultiPeerSynchronizerTaskCallback
+
+	TEST(TEST_CLASS, MultiPeerCallback_ActionIsCalledWithMultiplePeersAndNodeInteractionsAreUpdated) {
+		// Arrange: writers return the same node repeatedly
+		test::ServiceTestState testState;
+		const_cast<utils::TimeSpan&>(testState.config().Node.SyncTimeout) = utils::TimeSpan::FromSeconds(Default_Timeout_Seconds);
+
+		auto nodeIdentity = model::NodeIdentity{ test::GenerateRandomByteArray<Key>(), "11.22.33.44" };
+		auto pPacketIo = std::make_shared<mocks::MockPacketIo>();
+		mocks::PickOneAwareMockPacketWriters writers;
+		writers.setPacketIo(pPacketIo);
+		writers.setNodeIdentity(nodeIdentity);
+		testState.state().nodes().modifier().add(ionet::Node(nodeIdentity), ionet::NodeSource::Dynamic);
+
+		auto numActionCalls = 0u;
+		auto synchronizer = chain::RemoteNodeSynchronizer<int>([&numActionCalls](const auto& apiId) {
+			++numActionCalls;
+			EXPECT_EQ(Default_Action_Api_Id, apiId);
+			return thread::make_ready_future(ionet::NodeInteractionResultCode::Success);
+		});
+
+		std::vector<size_t> factoryNumPeers;
+		auto remoteApiFactory = [&factoryNumPeers, &pPacketIo](const auto& packetIoPairs, const auto&) {
+			factoryNumPeers.push_back(packetIoPairs.size());
+			for (const auto& packetIoPair : packetIoPairs)
+				EXPECT_EQ(pPacketIo, packetIoPair.io());
+
+			return std::make_unique<int>(Default_Action_Api_Id);
+		};
+
+		// Act:
+		auto callback = CreateMultiPeerSynchronizerTaskCallback(
+				std::move(synchronizer),
+				remoteApiFactory,
+				writers,
+				testState.state(),
+				"test",
+				3);
+		auto result = callback().get();
+
+		// Assert:
+		EXPECT_EQ(thread::TaskResult::Continue, result);
+
+		// - twice the number of peers were picked and the best three were passed to the factory
+		ASSERT_EQ(6u, writers.numPickOneCalls());
+		EXPECT_EQ(Default_Timeout_Seconds, writers.pickOneDurations()[0].seconds());
+		EXPECT_EQ(std::vector<size_t>({ 3 }), factoryNumPeers);
+		EXPECT_EQ(1u, numActionCalls);
+
+		// - the interaction was attributed to the primary peer
+		auto interactions = testState.state().nodes().view().getNodeInfo(nodeIdentity).interactions(Timestamp());
+		test::AssertNodeInteractions(1, 0, interactions);
+	}
+
+	// endregion
 }}
@@ -69,9 +69,15 @@ namespace bitxorcore { namespace handlers {
 
 		class MockCacheView {
 		public:
-			MockCacheView(bool result, const StatePath& path)
+			MockCacheView(
+					bool result,
+					bool hasNodePerKey,
+					const StatePath& path,
+					std::vector<std::vector<uint64_t>>& lookupAllKeys)
 					: m_result(result)
+					, m_hasNodePerKey(hasNodePerKey)
 					, m_path(path)
+					, m_lookupAllKeys(lookupAllKeys)
 			{}
 
 		public:
@@ -82,20 +88,38 @@ namespace bitxorcore { namespace handlers {
 				return std::make_pair(Hash256(), m_result);
 			}
 
+			auto tryLookupAll(const std::vector<uint64_t>& keys, StatePath& nodes) const {
+				m_lookupAllKeys.push_back(keys);
+				auto numNodes = m_hasNodePerKey ? std::min(keys.size(), m_path.size()) : m_path.size();
+				for (auto i = 0u; i < numNodes; ++i)
+					nodes.push_back(m_path[i].copy());
+
+				return std::vector<std::pair<Hash256, bool>>(keys.size(), std::make_pair(Hash256(), m_result));
+			}
+
 		private:
 			const bool m_result;
+			const bool m_hasNodePerKey;
 			const StatePath& m_path;
+			std::vector<std::vector<uint64_t>>& m_lookupAllKeys;
 		};
 
 		class MockCache {
 		public:
-			MockCache() : m_lookupResult(false)
+			MockCache()
+					: m_lookupResult(false)
+					, m_hasNodePerKey(false)
 			{}
 
 		public:
 			auto createView() const {
 				auto readLock = m_lock.acquireReader();
-				return cache::LockedCacheView<MockCacheView>(MockCacheView(m_lookupResult, m_path), std::move(readLock));
+				auto view = MockCacheView(m_lookupResult, m_hasNodePerKey, m_path, m_lookupAllKeys);
+				return cache::LockedCacheView<MockCacheView>(std::move(view), std::move(readLock));
+			}
+
+			const auto& lookupAllKeys() const {
+				return m_lookupAllKeys;
 			}
 
 		public:
@@ -108,10 +132,21 @@ namespace bitxorcore { namespace handlers {
 				return SerializePath(m_path);
 			}
 
+			void setNodePerKey() {
+				// each key adds one node, so the nodes of the first N keys are the first N nodes of the path
+				m_hasNodePerKey = true;
+			}
+
+			const auto& path() const {
+				return m_path;
+			}
+
 		private:
 			mutable utils::SpinReaderWriterLock m_lock;
 			bool m_lookupResult;
+			bool m_hasNodePerKey;
 			StatePath m_path;
+			mutable std::vector<std::vector<uint64_t>> m_lookupAllKeys;
 		};
 
 		// endregion
@@ -157,6 +192,22 @@ namespace bitxorcore { namespace handlers {
 			}
 		};
 
+		struct BatchStatePathRequestTraits {
+			static constexpr ionet::PacketType Packet_Type = Mock_Packet_Type;
+
+			using RequestStructureType = TestPayloadType;
+		};
+
+		struct BatchStatePathHandlerFactoryTraits : public StatePathHandlerFactoryTraits {
+		public:
+			static constexpr uint32_t Max_Keys = 5;
+
+		public:
+			static void RegisterHandler(ionet::ServerPacketHandlers& handlers, const MockCache& cache) {
+				RegisterBatchStatePathHandler<BatchStatePathRequestTraits>(handlers, cache, Max_Keys);
+			}
+		};
+
 		// endregion
 
 		// region base tests
@@ -174,17 +225,24 @@ namespace bitxorcore { namespace handlers {
 			StatePathHandlerFactoryTraits,
 			CacheHandlerTraits<StatePathHandlerFactoryTraits>>;
 
+		using BasicBatchHandlerTests = test::BasicBatchHandlerTests<
+			BatchStatePathHandlerFactoryTraits,
+			CacheHandlerTraits<BatchStatePathHandlerFactoryTraits>>;
+
 		// endregion
 
 		// region valid packet tests
 
-		template<typename TArrange, typename TAssertResponse>
-		void AssertPacketIsAccepted(TArrange arrange, TAssertResponse assertResponse) {
+		template<typename TTraits, typename TArrange, typename TAssertResponse>
+		void AssertPacketIsAccepted(
+				ionet::ServerPacketHandlers&& handlers,
+				uint32_t numKeys,
+				TArrange arrange,
+				TAssertResponse assertResponse) {
 			// Arrange:
-			StatePathHandlerFactoryTraits::TestContext testContext;
-			ionet::ServerPacketHandlers handlers;
-			StatePathHandlerFactoryTraits::RegisterHandler(handlers, testContext.getCache());
-			auto pPacket = test::CreateRandomPacket(Payload_Size, Mock_Packet_Type);
+			typename TTraits::TestContext testContext;
+			TTraits::RegisterHandler(handlers, testContext.getCache());
+			auto pPacket = test::CreateRandomPacket(numKeys * Payload_Size, Mock_Packet_Type);
 			arrange(testContext);
 
 			// Act:
@@ -193,7 +251,20 @@ namespace bitxorcore { namespace handlers {
 
 			// Assert: the handler was called and has the correct header
 			ASSERT_TRUE(handlerContext.hasResponse());
-			assertResponse(handlerContext);
+			assertResponse(testContext, *pPacket, handlerContext);
+		}
+
+		template<typename TTraits, typename TArrange, typename TAssertResponse>
+		void AssertPacketIsAccepted(uint32_t numKeys, TArrange arrange, TAssertResponse assertResponse) {
+			AssertPacketIsAccepted<TTraits>(ionet::ServerPacketHandlers(), numKeys, arrange, assertResponse);
+		}
+
+		template<typename TArrange, typename TAssertResponse>
+		void AssertPacketIsAccepted(TArrange arrange, TAssertResponse assertResponse) {
+			auto assertResponseAdapter = [assertResponse](const auto&, const auto&, const auto& handlerContext) {
+				assertResponse(handlerContext);
+			};
+			AssertPacketIsAccepted<StatePathHandlerFactoryTraits>(1, arrange, assertResponseAdapter);
 		}
 
 		void AssertReturnedValue(const std::vector<uint8_t>& expectedResult, const ionet::PacketPayload& payload) {
@@ -254,4 +325,117 @@ namespace bitxorcore { namespace handlers {
 					AssertReturnedValue(expectedResponse, handlerContext.response());
 				});
 	}
+
+	// region batch
+
+#define MAKE_BASIC_BATCH_STATE_PATH_HANDLER_TEST(NAME) TEST(TEST_CLASS, Batch_##NAME) { BasicBatchHandlerTests::Assert##NAME(); }
+
+	MAKE_BASIC_BATCH_STATE_PATH_HANDLER_TEST(TooSmallPacketIsRejected)
+	MAKE_BASIC_BATCH_STATE_PATH_HANDLER_TEST(PacketWithWrongTypeIsRejected)
+	MAKE_BASIC_BATCH_STATE_PATH_HANDLER_TEST(PacketWithInvalidPayloadIsRejected)
+	MAKE_BASIC_BATCH_STATE_PATH_HANDLER_TEST(PacketWithTooSmallPayloadIsRejected)
+	MAKE_BASIC_BATCH_STATE_PATH_HANDLER_TEST(PacketWithNoPayloadIsRejected)
+
+	namespace {
+		void AssertForwardedKeys(const ionet::Packet& packet, size_t numKeys, const std::vector<uint64_t>& keys) {
+			ASSERT_EQ(numKeys, keys.size());
+			EXPECT_EQ_MEMORY(packet.Data(), keys.data(), numKeys * Payload_Size);
+		}
+
+		void AssertForwardedKeys(const MockCache& cache, const ionet::Packet& packet, size_t numKeys) {
+			ASSERT_EQ(1u, cache.lookupAllKeys().size());
+			AssertForwardedKeys(packet, numKeys, cache.lookupAllKeys()[0]);
+		}
+	}
+
+	TEST(TEST_CLASS, Batch_PacketWithTooManyKeysIsRejected) {
+		// Arrange:
+		BatchStatePathHandlerFactoryTraits::TestContext testContext;
+		ionet::ServerPacketHandlers handlers;
+		BatchStatePathHandlerFactoryTraits::RegisterHandler(handlers, testContext.getCache());
+		testContext.getCache().setLookupResult(true, 10);
+
+		auto numKeys = BatchStatePathHandlerFactoryTraits::Max_Keys + 1;
+		auto pPacket = test::CreateRandomPacket(numKeys * Payload_Size, Mock_Packet_Type);
+
+		// Act:
+		ionet::ServerPacketHandlerContext handlerContext;
+		EXPECT_TRUE(handlers.process(*pPacket, handlerContext));
+
+		// Assert: cache was not queried and there is no response
+		EXPECT_TRUE(testContext.getCache().lookupAllKeys().empty());
+		EXPECT_FALSE(handlerContext.hasResponse());
+	}
+
+	TEST(TEST_CLASS, Batch_ValidPacketIsAcceptedWhenCacheIsEmpty) {
+		// Assert: no element in cache, so response packet only contains header
+		AssertPacketIsAccepted<BatchStatePathHandlerFactoryTraits>(
+				3,
+				[](const auto&) {},
+				[](const auto& testContext, const auto& packet, const auto& handlerContext) {
+					AssertForwardedKeys(testContext.getCache(), packet, 3);
+					test::AssertPacketHeader(handlerContext, sizeof(ionet::PacketHeader), Mock_Packet_Type);
+				});
+	}
+
+	TEST(TEST_CLASS, Batch_ProofsAreReturnedForAllKeys) {
+		// Arrange:
+		std::vector<uint8_t> expectedResponse;
+
+		AssertPacketIsAccepted<BatchStatePathHandlerFactoryTraits>(
+				5,
+				[&expectedResponse](auto& testContext) {
+					// - make tryLookupAll return (deduplicated) proofs
+					expectedResponse = testContext.getCache().setLookupResult(true, 10);
+				},
+				[&expectedResponse](const auto& testContext, const auto& packet, const auto& handlerContext) {
+					// Assert: all keys were forwarded to the cache in a single lookup
+					AssertForwardedKeys(testContext.getCache(), packet, 5);
+
+					// - response packet contains serialized nodes
+					test::AssertPacketHeader(handlerContext, sizeof(ionet::PacketHeader) + expectedResponse.size(), Mock_Packet_Type);
+					AssertReturnedValue(expectedResponse, handlerContext.response());
+				});
+	}
+
+	TEST(TEST_CLASS, Batch_ProofsAreReturnedForLongestFittingKeyPrefixWhenResponseIsTooLarge) {
+		// Arrange:
+		std::vector<uint8_t> expectedResponse;
+
+		// - path alternates between leaf and branch nodes with fixed serialized sizes, so only the nodes of the first three keys
+		//   (leaf, branch, leaf) fit when the fourth (branch) node is one byte too large
+		auto leafNodeSize = tree::PatriciaTreeSerializer::SerializeValue(tree::TreeNode(CreateRandomLeafNode())).size();
+		auto branchNodeSize = tree::PatriciaTreeSerializer::SerializeValue(tree::TreeNode(CreateRandomBranchNode())).size();
+		auto maxPacketDataSize = static_cast<uint32_t>(2 * leafNodeSize + 2 * branchNodeSize - 1);
+
+		AssertPacketIsAccepted<BatchStatePathHandlerFactoryTraits>(
+				ionet::ServerPacketHandlers(maxPacketDataSize),
+				5,
+				[&expectedResponse](auto& testContext) {
+					// - make tryLookupAll return one node per key
+					testContext.getCache().setLookupResult(true, 10);
+					testContext.getCache().setNodePerKey();
+
+					std::vector<tree::TreeNode> fittingPath;
+					for (auto i = 0u; i < 3; ++i)
+						fittingPath.push_back(testContext.getCache().path()[i].copy());
+
+					expectedResponse = SerializePath(fittingPath);
+				},
+				[&expectedResponse](const auto& testContext, const auto& packet, const auto& handlerContext) {
+					// Assert: all keys were looked up before the longest fitting prefix was bisected (5 > 2 < 3 < 4 > 3)
+					const auto& lookupAllKeys = testContext.getCache().lookupAllKeys();
+					ASSERT_EQ(4u, lookupAllKeys.size());
+					AssertForwardedKeys(packet, 5, lookupAllKeys[0]);
+					AssertForwardedKeys(packet, 2, lookupAllKeys[1]);
+					AssertForwardedKeys(packet, 3, lookupAllKeys[2]);
+					AssertForwardedKeys(packet, 4, lookupAllKeys[3]);
+
+					// - response packet contains serialized nodes of first three keys
+					test::AssertPacketHeader(handlerContext, sizeof(ionet::PacketHeader) + expectedResponse.size(), Mock_Packet_Type);
+					AssertReturnedValue(expectedResponse, handlerContext.response());
+				});
+	}
+
+	// endregion
 }}
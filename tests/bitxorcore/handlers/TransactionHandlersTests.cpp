@@ -168,4 +168,124 @@ namespace bitxorcore { namespace handlers {
 			test::PullEntitiesHandlerAssertAdapter<PullTransactionsRequestResponseTraits>::AssertFunc)
 
 	// endregion
+
+	// region PushTransactionInventoryHandler
+
+	namespace {
+		struct PushTransactionInventoryTraits {
+			static constexpr auto Packet_Type = ionet::PacketType::Push_Transaction_Inventory;
+			static constexpr auto Data_Size = sizeof(model::TransactionInventoryEntry);
+
+			static constexpr size_t AdditionalPacketSize(size_t) {
+				return 0u;
+			}
+
+			static void PreparePacket(ionet::ByteBuffer&, size_t)
+			{}
+
+			static auto CreateRegistry() {
+				// note that int is used as a placeholder transaction registy
+				// because a real one is not needed by RegisterPushTransactionInventoryHandler
+				return 7;
+			}
+
+			static auto RegisterHandler(ionet::ServerPacketHandlers& handlers, int, const TransactionInventoryRangeHandler& rangeHandler) {
+				return RegisterPushTransactionInventoryHandler(handlers, rangeHandler);
+			}
+		};
+	}
+
+	DEFINE_PUSH_HANDLER_TESTS(TEST_CLASS, PushTransactionInventory)
+
+	// endregion
+
+	// region PullAnnouncedTransactionsHandler
+
+	namespace {
+		auto CreatePullAnnouncedTransactionsPacket(const std::vector<utils::ShortHash>& shortHashes) {
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(utils::checked_cast<size_t, uint32_t>(
+					shortHashes.size() * sizeof(utils::ShortHash)));
+			pPacket->Type = ionet::PacketType::Pull_Announced_Transactions;
+			std::memcpy(pPacket->Data(), shortHashes.data(), shortHashes.size() * sizeof(utils::ShortHash));
+			return pPacket;
+		}
+	}
+
+	TEST(TEST_CLASS, PullAnnouncedTransactionsHandler_DoesNotRespondToEmptyRequest) {
+		// Arrange:
+		ionet::ServerPacketHandlers handlers;
+		auto numRetrieverCalls = 0u;
+		RegisterPullAnnouncedTransactionsHandler(handlers, [&numRetrieverCalls](const auto&) {
+			++numRetrieverCalls;
+			return UnconfirmedTransactions();
+		});
+
+		auto pPacket = CreatePullAnnouncedTransactionsPacket({});
+
+		// Act:
+		ionet::ServerPacketHandlerContext handlerContext;
+		EXPECT_TRUE(handlers.process(*pPacket, handlerContext));
+
+		// Assert:
+		EXPECT_EQ(0u, numRetrieverCalls);
+		test::AssertNoResponse(handlerContext);
+	}
+
+	TEST(TEST_CLASS, PullAnnouncedTransactionsHandler_DoesNotRespondToMalformedRequest) {
+		// Arrange:
+		ionet::ServerPacketHandlers handlers;
+		auto numRetrieverCalls = 0u;
+		RegisterPullAnnouncedTransactionsHandler(handlers, [&numRetrieverCalls](const auto&) {
+			++numRetrieverCalls;
+			return UnconfirmedTransactions();
+		});
+
+		auto pPacket = CreatePullAnnouncedTransactionsPacket({ utils::ShortHash(1), utils::ShortHash(2) });
+		--pPacket->Size;
+
+		// Act:
+		ionet::ServerPacketHandlerContext handlerContext;
+		EXPECT_TRUE(handlers.process(*pPacket, handlerContext));
+
+		// Assert:
+		EXPECT_EQ(0u, numRetrieverCalls);
+		test::AssertNoResponse(handlerContext);
+	}
+
+	TEST(TEST_CLASS, PullAnnouncedTransactionsHandler_RespondsWithTransactionsMatchingRequestedShortHashes) {
+		// Arrange:
+		ionet::ServerPacketHandlers handlers;
+		UnconfirmedTransactions transactions;
+		for (uint16_t i = 0u; i < 3; ++i)
+			transactions.push_back(mocks::CreateMockTransaction(static_cast<uint16_t>(i + 1)));
+
+		std::vector<utils::ShortHashesSet> retrieverShortHashes;
+		RegisterPullAnnouncedTransactionsHandler(handlers, [&transactions, &retrieverShortHashes](const auto& shortHashes) {
+			retrieverShortHashes.push_back(shortHashes);
+			return transactions;
+		});
+
+		auto pPacket = CreatePullAnnouncedTransactionsPacket({ utils::ShortHash(1), utils::ShortHash(5), utils::ShortHash(1) });
+
+		// Act:
+		ionet::ServerPacketHandlerContext handlerContext;
+		EXPECT_TRUE(handlers.process(*pPacket, handlerContext));
+
+		// Assert: requested short hashes are deduplicated
+		ASSERT_EQ(1u, retrieverShortHashes.size());
+		EXPECT_EQ(utils::ShortHashesSet({ utils::ShortHash(1), utils::ShortHash(5) }), retrieverShortHashes[0]);
+
+		// - all retrieved transactions are written to the response
+		test::AssertPacketHeader(
+				handlerContext,
+				sizeof(ionet::PacketHeader) + test::TotalSize(transactions),
+				ionet::PacketType::Pull_Announced_Transactions);
+
+		const auto& buffers = handlerContext.response().buffers();
+		ASSERT_EQ(transactions.size(), buffers.size());
+		for (auto i = 0u; i < transactions.size(); ++i)
+			EXPECT_EQ(*transactions[i], reinterpret_cast<const model::Transaction&>(*buffers[i].pData)) << "transaction at " << i;
+	}
+
+	// endregion
 }}
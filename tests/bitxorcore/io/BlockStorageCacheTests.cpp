@@ -132,6 +132,31 @@ namespace bitxorcore { namespace io {
 		EXPECT_EQ(Height(Delegation_Chain_Size), height);
 	}
 
+	TEST(TEST_CLASS, LockFreeChainHeightDelegatesToStorage) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(Delegation_Chain_Size), mocks::CreateMemoryBlockStorage(0));
+
+		// Act:
+		auto height = cache.chainHeight();
+
+		// Assert:
+		EXPECT_EQ(Height(Delegation_Chain_Size), height);
+	}
+
+	TEST(TEST_CLASS, LockFreeChainHeightDoesNotRequireStorageLock) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(Delegation_Chain_Size), mocks::CreateMemoryBlockStorage(0));
+		auto modifier = cache.modifier();
+
+		// Act: access height while the writer lock is held
+		auto height = cache.chainHeight();
+		auto pLastBlockElement = cache.lastBlockElement();
+
+		// Assert:
+		EXPECT_EQ(Height(Delegation_Chain_Size), height);
+		EXPECT_EQ(Height(Delegation_Chain_Size), pLastBlockElement->Block.Height);
+	}
+
 	// endregion
 
 	// region loadHashesFrom
@@ -484,6 +509,10 @@ namespace bitxorcore { namespace io {
 		// Assert:
 		EXPECT_EQ(Height(9), cache.view().chainHeight());
 		test::AssertEqual(newBlockElement, *cache.view().loadBlockElement(Height(9)));
+
+		// - lock free accessors are updated
+		EXPECT_EQ(Height(9), cache.chainHeight());
+		test::AssertEqual(newBlockElement, *cache.lastBlockElement());
 	}
 
 	// endregion
@@ -0,0 +1,229 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "bitxorcore/io/ChecksummedChunkStream.h"
+#include "bitxorcore/io/PodIoUtils.h"
+#include "tests/bitxorcore/io/test/StreamTests.h"
+#include "tests/test/core/mocks/MockMemoryStream.h"
+#include "tests/TestHarness.h"
+
+namespace bitxorcore { namespace io {
+
+#define TEST_CLASS ChecksummedChunkStreamTests
+
+	namespace {
+		constexpr uint32_t Test_Chunk_Size = 100;
+		constexpr size_t Chunk_Header_Size = sizeof(uint32_t) + sizeof(uint8_t) + Hash256::Size;
+
+		std::vector<uint8_t> WriteChunked(const std::vector<uint8_t>& data, uint32_t chunkSize = Test_Chunk_Size) {
+			std::vector<uint8_t> buffer;
+			mocks::MockMemoryStream underlyingOutput(buffer);
+			ChecksummedChunkOutputStream output(underlyingOutput, chunkSize);
+			output.write(data);
+			output.flush();
+			return buffer;
+		}
+
+		std::vector<uint8_t> ReadChunked(std::vector<uint8_t>& buffer, size_t size) {
+			mocks::MockMemoryStream underlyingInput(buffer);
+			ChecksummedChunkInputStream input(underlyingInput);
+
+			std::vector<uint8_t> data(size);
+			input.read(data);
+			return data;
+		}
+	}
+
+	// region basic stream tests
+
+	namespace {
+		class ChunkedStreamContext {
+		public:
+			explicit ChunkedStreamContext(const char*)
+			{}
+
+			auto outputStream() {
+				m_pUnderlyingOutput = std::make_unique<mocks::MockMemoryStream>(m_buffer);
+				return std::make_unique<ChecksummedChunkOutputStream>(*m_pUnderlyingOutput, Test_Chunk_Size);
+			}
+
+			auto inputStream() {
+				m_pUnderlyingInput = std::make_unique<mocks::MockMemoryStream>(m_buffer);
+				return std::make_unique<ChecksummedChunkInputStream>(*m_pUnderlyingInput);
+			}
+
+		private:
+			std::vector<uint8_t> m_buffer;
+			std::unique_ptr<mocks::MockMemoryStream> m_pUnderlyingOutput;
+			std::unique_ptr<mocks::MockMemoryStream> m_pUnderlyingInput;
+		};
+	}
+
+	DEFINE_STREAM_TESTS(ChunkedStreamContext)
+
+	// endregion
+
+	// region output
+
+	TEST(TEST_CLASS, CannotCreateOutputStreamWithZeroChunkSize) {
+		// Arrange:
+		std::vector<uint8_t> buffer;
+		mocks::MockMemoryStream underlyingOutput(buffer);
+
+		// Act + Assert:
+		EXPECT_THROW(ChecksummedChunkOutputStream(underlyingOutput, 0), bitxorcore_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, OutputStreamWritesHeaderOnConstruction) {
+		// Arrange:
+		std::vector<uint8_t> buffer;
+		mocks::MockMemoryStream underlyingOutput(buffer);
+
+		// Act:
+		ChecksummedChunkOutputStream output(underlyingOutput, Test_Chunk_Size);
+
+		// Assert:
+		ASSERT_EQ(sizeof(uint64_t), buffer.size());
+		EXPECT_EQ(Checksummed_Chunk_Stream_Magic, reinterpret_cast<const uint64_t&>(buffer[0]));
+		EXPECT_EQ(0u, output.numChunks());
+	}
+
+	TEST(TEST_CLASS, OutputStreamSplitsDataIntoChunks) {
+		// Arrange:
+		auto data = test::GenerateRandomVector(2 * Test_Chunk_Size + 17);
+		std::vector<uint8_t> buffer;
+		mocks::MockMemoryStream underlyingOutput(buffer);
+		ChecksummedChunkOutputStream output(underlyingOutput, Test_Chunk_Size);
+
+		// Act:
+		output.write(data);
+		output.flush();
+
+		// Assert: two full chunks and one partial chunk are written
+		EXPECT_EQ(3u, output.numChunks());
+		EXPECT_EQ(1u, underlyingOutput.numFlushes());
+		EXPECT_EQ(sizeof(uint64_t) + 3 * Chunk_Header_Size + data.size(), buffer.size());
+	}
+
+	TEST(TEST_CLASS, OutputStreamFlushWithoutPendingDataDoesNotWriteChunk) {
+		// Arrange:
+		std::vector<uint8_t> buffer;
+		mocks::MockMemoryStream underlyingOutput(buffer);
+		ChecksummedChunkOutputStream output(underlyingOutput, Test_Chunk_Size);
+		output.write(test::GenerateRandomVector(Test_Chunk_Size));
+
+		// Act:
+		output.flush();
+
+		// Assert:
+		EXPECT_EQ(1u, output.numChunks());
+		EXPECT_EQ(sizeof(uint64_t) + Chunk_Header_Size + Test_Chunk_Size, buffer.size());
+	}
+
+	// endregion
+
+	// region input
+
+	TEST(TEST_CLASS, CannotCreateInputStreamAroundUnchunkedData) {
+		// Arrange: unchunked state files are prefixed with an entry count
+		std::vector<uint8_t> buffer;
+		mocks::MockMemoryStream underlyingStream(buffer);
+		Write64(underlyingStream, 12345);
+		underlyingStream.seek(0);
+
+		// Act + Assert:
+		EXPECT_THROW(ChecksummedChunkInputStream input(underlyingStream), bitxorcore_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CanRoundtripDataSpanningManyChunks) {
+		// Arrange:
+		auto data = test::GenerateRandomVector(10 * Test_Chunk_Size + 3);
+		auto buffer = WriteChunked(data);
+
+		// Act:
+		auto result = ReadChunked(buffer, data.size());
+
+		// Assert:
+		EXPECT_EQ(data, result);
+	}
+
+	TEST(TEST_CLASS, CannotReadTruncatedChunk) {
+		// Arrange: remove last byte of last chunk
+		auto data = test::GenerateRandomVector(3 * Test_Chunk_Size);
+		auto buffer = WriteChunked(data);
+		buffer.pop_back();
+
+		// Act + Assert:
+		EXPECT_THROW(ReadChunked(buffer, data.size()), bitxorcore_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CannotReadTruncatedStream) {
+		// Arrange: remove entire last chunk
+		auto data = test::GenerateRandomVector(3 * Test_Chunk_Size);
+		auto buffer = WriteChunked(data);
+		buffer.resize(buffer.size() - Chunk_Header_Size - Test_Chunk_Size);
+
+		// Act + Assert:
+		EXPECT_THROW(ReadChunked(buffer, data.size()), bitxorcore_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CannotReadCorruptChunkData) {
+		// Arrange: corrupt a byte in the second chunk
+		auto data = test::GenerateRandomVector(3 * Test_Chunk_Size);
+		auto buffer = WriteChunked(data);
+		buffer[sizeof(uint64_t) + 2 * Chunk_Header_Size + Test_Chunk_Size + 5] ^= 0xFF;
+
+		// Act + Assert:
+		EXPECT_THROW(ReadChunked(buffer, data.size()), bitxorcore_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CannotReadChunkWithUnsupportedCompression) {
+		// Arrange: change the compression of the first chunk
+		auto data = test::GenerateRandomVector(Test_Chunk_Size);
+		auto buffer = WriteChunked(data);
+		buffer[sizeof(uint64_t) + sizeof(uint32_t)] = 0xFF;
+
+		// Act + Assert:
+		EXPECT_THROW(ReadChunked(buffer, data.size()), bitxorcore_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CanReadValidChunksPrecedingCorruptChunk) {
+		// Arrange: corrupt a byte in the last chunk
+		auto data = test::GenerateRandomVector(3 * Test_Chunk_Size);
+		auto buffer = WriteChunked(data);
+		buffer.back() ^= 0xFF;
+
+		mocks::MockMemoryStream underlyingInput(buffer);
+		ChecksummedChunkInputStream input(underlyingInput);
+
+		// Act:
+		std::vector<uint8_t> result(2 * Test_Chunk_Size);
+		input.read(result);
+
+		// Assert:
+		EXPECT_EQ_MEMORY(data.data(), result.data(), result.size());
+		EXPECT_THROW(input.read(result), bitxorcore_file_io_error);
+	}
+
+	// endregion
+}}
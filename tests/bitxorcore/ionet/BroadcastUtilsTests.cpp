@@ -21,6 +21,7 @@
 **/
 
 #include "bitxorcore/ionet/BroadcastUtils.h"
+#include "bitxorcore/model/TransactionInventoryEntry.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/PacketPayloadTestUtils.h"
 #include "tests/test/core/TransactionTestUtils.h"
@@ -196,4 +197,46 @@ namespace bitxorcore { namespace ionet {
 	}
 
 	// endregion
+
+	// region transaction inventory
+
+	TEST(TEST_CLASS, CanCreateTransactionInventoryPayload_None) {
+		// Arrange:
+		std::vector<model::TransactionInfo> transactionInfos;
+
+		// Act:
+		auto payload = CreateTransactionInventoryPayload(transactionInfos);
+
+		// Assert:
+		test::AssertPacketHeader(payload, sizeof(PacketHeader), PacketType::Push_Transaction_Inventory);
+		EXPECT_TRUE(payload.buffers().empty());
+	}
+
+	TEST(TEST_CLASS, CanCreateTransactionInventoryPayload_Multiple) {
+		// Arrange:
+		std::vector<model::TransactionInfo> transactionInfos;
+		for (auto i = 0u; i < 3; ++i) {
+			transactionInfos.push_back(CreateRandomTransactionInfo());
+			transactionInfos.back().EntityHash = test::GenerateRandomByteArray<Hash256>();
+		}
+
+		// Act:
+		auto payload = CreateTransactionInventoryPayload(transactionInfos);
+
+		// Assert: only short hashes and sizes are announced
+		auto expectedPayloadSize = 3 * sizeof(model::TransactionInventoryEntry);
+		test::AssertPacketHeader(payload, sizeof(PacketHeader) + expectedPayloadSize, PacketType::Push_Transaction_Inventory);
+		ASSERT_EQ(1u, payload.buffers().size());
+
+		const auto& buffer = payload.buffers()[0];
+		ASSERT_EQ(expectedPayloadSize, buffer.Size);
+
+		const auto* pEntry = reinterpret_cast<const model::TransactionInventoryEntry*>(buffer.pData);
+		for (auto i = 0u; i < transactionInfos.size(); ++i, ++pEntry) {
+			EXPECT_EQ(utils::ToShortHash(transactionInfos[i].EntityHash), pEntry->ShortHash) << "entry at " << i;
+			EXPECT_EQ(transactionInfos[i].pEntity->Size, pEntry->Size) << "entry at " << i;
+		}
+	}
+
+	// endregion
 }}
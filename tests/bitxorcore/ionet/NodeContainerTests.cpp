@@ -1165,6 +1165,49 @@ namespace bitxorcore { namespace ionet {
 
 	// endregion
 
+	// region recordRoundTrip / recordThroughput
+
+	TEST(TEST_CLASS, NoTransferStatisticsRecordedWhenNodeIsNotFound) {
+		// Arrange:
+		auto identity = ToIdentity(test::GenerateRandomByteArray<Key>());
+		NodeContainer container;
+
+		// Act:
+		{
+			auto modifier = container.modifier();
+			modifier.recordRoundTrip(identity, 1000);
+			modifier.recordThroughput(identity, 1000, 1000);
+		}
+
+		// Assert: no node was added to the container
+		EXPECT_FALSE(container.view().contains(identity));
+	}
+
+	TEST(TEST_CLASS, CanRecordTransferStatistics) {
+		// Arrange:
+		auto identity = ToIdentity(test::GenerateRandomByteArray<Key>());
+		NodeContainer container;
+		Add(container, identity, "bob", NodeSource::Dynamic);
+
+		// Act:
+		{
+			auto modifier = container.modifier();
+			modifier.recordRoundTrip(identity, 1000);
+			modifier.recordRoundTrip(identity, 3000);
+			modifier.recordThroughput(identity, 1000, 500'000);
+		}
+
+		// Assert:
+		auto view = container.view();
+		const auto& transferStatistics = view.getNodeInfo(identity).transferStatistics();
+		EXPECT_EQ(2u, transferStatistics.NumRoundTripSamples);
+		EXPECT_EQ(1500u, transferStatistics.RoundTripMicros);
+		EXPECT_EQ(1u, transferStatistics.NumThroughputSamples);
+		EXPECT_EQ(2000u, transferStatistics.BytesPerSecond);
+	}
+
+	// endregion
+
 	// region banning
 
 	namespace {
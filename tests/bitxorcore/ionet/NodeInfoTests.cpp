@@ -48,6 +48,14 @@ namespace bitxorcore { namespace ionet {
 		test::AssertZeroed(connectionState);
 	}
 
+	TEST(TEST_CLASS, CanCreateZeroedTransferStatistics) {
+		// Act:
+		NodeTransferStatistics transferStatistics;
+
+		// Assert:
+		test::AssertZeroed(transferStatistics);
+	}
+
 	TEST(TEST_CLASS, CanCreateNodeInfo) {
 		// Act:
 		NodeInfo nodeInfo(NodeSource::Static);
@@ -61,6 +69,7 @@ namespace bitxorcore { namespace ionet {
 
 		EXPECT_EQ(0u, nodeInfo.numConnectionStates());
 		EXPECT_TRUE(nodeInfo.services().empty());
+		test::AssertZeroed(nodeInfo.transferStatistics());
 	}
 
 	TEST(TEST_CLASS, CanSetSource) {
@@ -355,4 +364,81 @@ namespace bitxorcore { namespace ionet {
 	}
 
 	// endregion
+
+	// region recordRoundTrip / recordThroughput
+
+	TEST(TEST_CLASS, FirstRoundTripSampleIsUsedAsIs) {
+		// Arrange:
+		NodeInfo nodeInfo(NodeSource::Static);
+
+		// Act:
+		nodeInfo.recordRoundTrip(1234);
+
+		// Assert:
+		const auto& transferStatistics = nodeInfo.transferStatistics();
+		EXPECT_EQ(1u, transferStatistics.NumRoundTripSamples);
+		EXPECT_EQ(1234u, transferStatistics.RoundTripMicros);
+		EXPECT_EQ(0u, transferStatistics.NumThroughputSamples);
+		EXPECT_EQ(0u, transferStatistics.BytesPerSecond);
+	}
+
+	TEST(TEST_CLASS, SubsequentRoundTripSamplesAreSmoothed) {
+		// Arrange:
+		NodeInfo nodeInfo(NodeSource::Static);
+		nodeInfo.recordRoundTrip(1000);
+
+		// Act:
+		nodeInfo.recordRoundTrip(2000);
+		nodeInfo.recordRoundTrip(200);
+
+		// Assert: (3 * 1000 + 2000) / 4 = 1250, (3 * 1250 + 200) / 4 = 987
+		const auto& transferStatistics = nodeInfo.transferStatistics();
+		EXPECT_EQ(3u, transferStatistics.NumRoundTripSamples);
+		EXPECT_EQ(987u, transferStatistics.RoundTripMicros);
+		EXPECT_EQ(0u, transferStatistics.NumThroughputSamples);
+	}
+
+	TEST(TEST_CLASS, FirstThroughputSampleIsUsedAsIs) {
+		// Arrange:
+		NodeInfo nodeInfo(NodeSource::Static);
+
+		// Act: 5000 bytes in 250ms
+		nodeInfo.recordThroughput(5000, 250'000);
+
+		// Assert:
+		const auto& transferStatistics = nodeInfo.transferStatistics();
+		EXPECT_EQ(0u, transferStatistics.NumRoundTripSamples);
+		EXPECT_EQ(0u, transferStatistics.RoundTripMicros);
+		EXPECT_EQ(1u, transferStatistics.NumThroughputSamples);
+		EXPECT_EQ(20'000u, transferStatistics.BytesPerSecond);
+	}
+
+	TEST(TEST_CLASS, SubsequentThroughputSamplesAreSmoothed) {
+		// Arrange:
+		NodeInfo nodeInfo(NodeSource::Static);
+		nodeInfo.recordThroughput(5000, 250'000);
+
+		// Act: 100'000 bytes/s
+		nodeInfo.recordThroughput(50'000, 500'000);
+
+		// Assert: (3 * 20'000 + 100'000) / 4 = 40'000
+		const auto& transferStatistics = nodeInfo.transferStatistics();
+		EXPECT_EQ(2u, transferStatistics.NumThroughputSamples);
+		EXPECT_EQ(40'000u, transferStatistics.BytesPerSecond);
+	}
+
+	TEST(TEST_CLASS, ThroughputSampleWithZeroElapsedTimeIsTreatedAsOneMicrosecond) {
+		// Arrange:
+		NodeInfo nodeInfo(NodeSource::Static);
+
+		// Act:
+		nodeInfo.recordThroughput(7, 0);
+
+		// Assert:
+		const auto& transferStatistics = nodeInfo.transferStatistics();
+		EXPECT_EQ(1u, transferStatistics.NumThroughputSamples);
+		EXPECT_EQ(7'000'000u, transferStatistics.BytesPerSecond);
+	}
+
+	// endregion
 }}
@@ -0,0 +1,350 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/ionet/PacketHandlerDispatcher.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/nodeps/Waits.h"
+#include "tests/TestHarness.h"
+#include <mutex>
+#include <thread>
+
+namespace bitxorcore { namespace ionet {
+
+#define TEST_CLASS PacketHandlerDispatcherTests
+
+	namespace {
+		constexpr auto Gate_Packet_Type = static_cast<PacketType>(1);
+
+		Key CreatePeerKey(uint8_t id) {
+			Key key;
+			key[0] = id;
+			return key;
+		}
+
+		// region TestContext
+
+		class TestContext {
+		public:
+			TestContext(uint32_t numThreads, uint32_t maxConcurrency, uint32_t maxPendingPacketsPerPeer)
+					: m_pPool(test::CreateStartedComputeThreadPool(numThreads))
+					, m_pDispatcher(CreatePacketHandlerDispatcher(m_pPool, { maxConcurrency, maxPendingPacketsPerPeer }))
+					, m_isGateOpen(false)
+					, m_numCompletedPackets(0)
+			{}
+
+			~TestContext() {
+				openGate();
+				m_pPool->join();
+			}
+
+		public:
+			auto& dispatcher() {
+				return *m_pDispatcher;
+			}
+
+			size_t numCompletedPackets() const {
+				return m_numCompletedPackets;
+			}
+
+			std::vector<std::pair<uint8_t, uint32_t>> executions() const {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				return m_executions;
+			}
+
+		public:
+			// dispatches a packet from \a peerId that blocks its worker until the gate is opened
+			void dispatchGate(uint8_t peerId) {
+				m_pDispatcher->dispatch(CreatePeerKey(peerId), Gate_Packet_Type, [this]() {
+					while (!m_isGateOpen)
+						test::Pause();
+
+					++m_numCompletedPackets;
+				});
+
+				// wait for the gate packet to start executing
+				WAIT_FOR_ZERO_EXPR(m_pDispatcher->numPendingPackets());
+			}
+
+			void openGate() {
+				m_isGateOpen = true;
+			}
+
+			// dispatches a packet from \a peerId that records (\a peerId, \a sequence) when it is executed
+			bool dispatch(uint8_t peerId, uint32_t sequence, PacketType type = static_cast<PacketType>(2), const action& work = action()) {
+				return m_pDispatcher->dispatch(CreatePeerKey(peerId), type, [this, peerId, sequence, work]() {
+					if (work)
+						work();
+
+					{
+						std::lock_guard<std::mutex> guard(m_mutex);
+						m_executions.emplace_back(peerId, sequence);
+					}
+
+					++m_numCompletedPackets;
+				});
+			}
+
+		private:
+			std::shared_ptr<thread::ComputeThreadPool> m_pPool;
+			std::shared_ptr<PacketHandlerDispatcher> m_pDispatcher;
+			std::atomic_bool m_isGateOpen;
+			std::atomic<size_t> m_numCompletedPackets;
+
+			std::vector<std::pair<uint8_t, uint32_t>> m_executions;
+			mutable std::mutex m_mutex;
+		};
+
+		// endregion
+
+		void AssertEmpty(PacketHandlerDispatcher& dispatcher) {
+			EXPECT_EQ(0u, dispatcher.numPendingPackets());
+			EXPECT_EQ(0u, dispatcher.numPendingPackets(Gate_Packet_Type));
+			EXPECT_EQ(0u, dispatcher.numActivePeers());
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CannotCreateDispatcherWithZeroConcurrency) {
+		// Arrange:
+		std::shared_ptr<thread::ComputeThreadPool> pPool = test::CreateStartedComputeThreadPool(1);
+
+		// Act + Assert:
+		EXPECT_THROW(CreatePacketHandlerDispatcher(pPool, { 0, 10 }), bitxorcore_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CannotCreateDispatcherWithZeroMaxPendingPacketsPerPeer) {
+		// Arrange:
+		std::shared_ptr<thread::ComputeThreadPool> pPool = test::CreateStartedComputeThreadPool(1);
+
+		// Act + Assert:
+		EXPECT_THROW(CreatePacketHandlerDispatcher(pPool, { 1, 0 }), bitxorcore_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, DispatcherIsInitiallyEmpty) {
+		// Act:
+		TestContext context(1, 1, 10);
+
+		// Assert:
+		AssertEmpty(context.dispatcher());
+		EXPECT_EQ(0u, context.dispatcher().numRejectedPackets());
+	}
+
+	// endregion
+
+	// region dispatch
+
+	TEST(TEST_CLASS, CanDispatchSingleHandler) {
+		// Arrange:
+		TestContext context(2, 2, 10);
+
+		// Act:
+		auto isDispatched = context.dispatch(7, 0);
+		WAIT_FOR_ONE_EXPR(context.numCompletedPackets());
+
+		// Assert:
+		EXPECT_TRUE(isDispatched);
+		auto executions = context.executions();
+		ASSERT_EQ(1u, executions.size());
+		EXPECT_EQ(7u, executions[0].first);
+		EXPECT_EQ(0u, executions[0].second);
+
+		WAIT_FOR_ZERO_EXPR(context.dispatcher().numActivePeers());
+		AssertEmpty(context.dispatcher());
+	}
+
+	TEST(TEST_CLASS, PendingPacketsAreCountedByType) {
+		// Arrange: block the only worker
+		TestContext context(1, 1, 10);
+		context.dispatchGate(1);
+
+		// Act: queue packets from multiple peers
+		context.dispatch(1, 0, static_cast<PacketType>(7));
+		context.dispatch(2, 0, static_cast<PacketType>(7));
+		context.dispatch(2, 1, static_cast<PacketType>(9));
+
+		// Assert:
+		EXPECT_EQ(3u, context.dispatcher().numPendingPackets());
+		EXPECT_EQ(0u, context.dispatcher().numPendingPackets(Gate_Packet_Type));
+		EXPECT_EQ(2u, context.dispatcher().numPendingPackets(static_cast<PacketType>(7)));
+		EXPECT_EQ(1u, context.dispatcher().numPendingPackets(static_cast<PacketType>(9)));
+		EXPECT_EQ(2u, context.dispatcher().numActivePeers());
+
+		// Act: unblock the worker
+		context.openGate();
+		WAIT_FOR_VALUE_EXPR(4u, context.numCompletedPackets());
+		WAIT_FOR_ZERO_EXPR(context.dispatcher().numActivePeers());
+
+		// Assert:
+		AssertEmpty(context.dispatcher());
+		EXPECT_EQ(0u, context.dispatcher().numPendingPackets(static_cast<PacketType>(7)));
+	}
+
+	TEST(TEST_CLASS, PacketsAreRejectedWhenPeerQueueIsFull) {
+		// Arrange: block the only worker with a packet from peer 1
+		TestContext context(1, 1, 2);
+		context.dispatchGate(1);
+
+		// Act: executing packets don't count against the limit
+		auto isDispatched1 = context.dispatch(1, 0);
+		auto isDispatched2 = context.dispatch(1, 1);
+		auto isDispatched3 = context.dispatch(1, 2);
+		auto isDispatched4 = context.dispatch(2, 0);
+
+		// Assert:
+		EXPECT_TRUE(isDispatched1);
+		EXPECT_TRUE(isDispatched2);
+		EXPECT_FALSE(isDispatched3);
+		EXPECT_TRUE(isDispatched4);
+
+		EXPECT_EQ(3u, context.dispatcher().numPendingPackets());
+		EXPECT_EQ(1u, context.dispatcher().numRejectedPackets());
+
+		// Act: unblock the worker
+		context.openGate();
+		WAIT_FOR_VALUE_EXPR(4u, context.numCompletedPackets());
+
+		// Assert: rejected packet was never executed
+		EXPECT_EQ(3u, context.executions().size());
+	}
+
+	// endregion
+
+	// region scheduling
+
+	TEST(TEST_CLASS, PeersAreServicedRoundRobin) {
+		// Arrange: block the only worker
+		TestContext context(1, 1, 10);
+		context.dispatchGate(0);
+
+		// - queue all packets from one peer before queueing packets from the next peer
+		for (uint8_t peerId = 1; peerId <= 3; ++peerId) {
+			for (auto i = 0u; i < 3; ++i)
+				context.dispatch(peerId, i);
+		}
+
+		// Act:
+		context.openGate();
+		WAIT_FOR_VALUE_EXPR(10u, context.numCompletedPackets());
+
+		// Assert: peers are interleaved
+		std::vector<std::pair<uint8_t, uint32_t>> expectedExecutions{
+			{ 1, 0 }, { 2, 0 }, { 3, 0 },
+			{ 1, 1 }, { 2, 1 }, { 3, 1 },
+			{ 1, 2 }, { 2, 2 }, { 3, 2 }
+		};
+		EXPECT_EQ(expectedExecutions, context.executions());
+	}
+
+	TEST(TEST_CLASS, BusyPeerIsServicedAfterAllOtherReadyPeers) {
+		// Arrange: block the only worker with a packet from peer 1
+		TestContext context(1, 1, 10);
+		context.dispatchGate(1);
+
+		// - queue packets from the busy peer before queueing packets from other peers
+		for (auto i = 0u; i < 3; ++i)
+			context.dispatch(1, i);
+
+		context.dispatch(2, 0);
+		context.dispatch(3, 0);
+
+		// Act:
+		context.openGate();
+		WAIT_FOR_VALUE_EXPR(6u, context.numCompletedPackets());
+
+		// Assert: other peers are not starved by the busy peer
+		std::vector<std::pair<uint8_t, uint32_t>> expectedExecutions{ { 2, 0 }, { 3, 0 }, { 1, 0 }, { 1, 1 }, { 1, 2 } };
+		EXPECT_EQ(expectedExecutions, context.executions());
+	}
+
+	TEST(TEST_CLASS, ConcurrencyIsBounded) {
+		// Arrange: pool has more threads than the dispatcher is allowed to use
+		TestContext context(4, 2, 10);
+		std::atomic<uint32_t> numExecuting(0);
+		std::atomic<uint32_t> maxExecuting(0);
+		auto work = [&numExecuting, &maxExecuting]() {
+			auto currentNumExecuting = ++numExecuting;
+			auto currentMaxExecuting = maxExecuting.load();
+			while (currentMaxExecuting < currentNumExecuting) {
+				if (maxExecuting.compare_exchange_weak(currentMaxExecuting, currentNumExecuting))
+					break;
+			}
+
+			test::Sleep(2);
+			--numExecuting;
+		};
+
+		// Act:
+		for (uint8_t peerId = 0; peerId < 8; ++peerId) {
+			for (auto i = 0u; i < 4; ++i)
+				context.dispatch(peerId, i, static_cast<PacketType>(2), work);
+		}
+
+		WAIT_FOR_VALUE_EXPR(32u, context.numCompletedPackets());
+
+		// Assert:
+		EXPECT_LE(1u, maxExecuting);
+		EXPECT_GE(2u, maxExecuting);
+	}
+
+	TEST(TEST_CLASS, ManySimulatedPeersAreProcessedInOrderWithoutConcurrentExecutionPerPeer) {
+		// Arrange:
+		constexpr uint8_t Num_Peers = 64;
+		constexpr uint32_t Num_Packets_Per_Peer = 16;
+		TestContext context(4, 4, Num_Packets_Per_Peer);
+
+		std::vector<std::atomic<uint32_t>> numExecutingByPeer(Num_Peers);
+		std::atomic<uint32_t> numConcurrentExecutionViolations(0);
+
+		// Act: interleave dispatches across peers, as would happen when reading from many sockets
+		for (auto i = 0u; i < Num_Packets_Per_Peer; ++i) {
+			for (uint8_t peerId = 0; peerId < Num_Peers; ++peerId) {
+				auto work = [&numExecutingByPeer, &numConcurrentExecutionViolations, peerId]() {
+					if (1 != ++numExecutingByPeer[peerId])
+						++numConcurrentExecutionViolations;
+
+					std::this_thread::yield();
+					--numExecutingByPeer[peerId];
+				};
+				EXPECT_TRUE(context.dispatch(peerId, i, static_cast<PacketType>(2 + peerId % 3), work));
+			}
+		}
+
+		WAIT_FOR_VALUE_EXPR(static_cast<size_t>(Num_Peers * Num_Packets_Per_Peer), context.numCompletedPackets());
+
+		// Assert: all packets were executed and each peer's packets were executed in order
+		auto executions = context.executions();
+		ASSERT_EQ(Num_Peers * Num_Packets_Per_Peer, executions.size());
+
+		std::vector<uint32_t> nextSequenceByPeer(Num_Peers, 0);
+		for (const auto& execution : executions)
+			EXPECT_EQ(nextSequenceByPeer[execution.first]++, execution.second) << "peer " << static_cast<uint16_t>(execution.first);
+
+		EXPECT_EQ(0u, numConcurrentExecutionViolations);
+
+		WAIT_FOR_ZERO_EXPR(context.dispatcher().numActivePeers());
+		AssertEmpty(context.dispatcher());
+		EXPECT_EQ(0u, context.dispatcher().numRejectedPackets());
+	}
+
+	// endregion
+}}
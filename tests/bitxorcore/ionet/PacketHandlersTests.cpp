@@ -239,6 +239,131 @@ namespace bitxorcore { namespace ionet {
 
 	// endregion
 
+	// region cost
+
+	namespace {
+		PacketHandlerCost GetCost(const PacketHandlers& handlers, uint32_t type) {
+			Packet packet;
+			packet.Type = static_cast<PacketType>(type);
+			return handlers.cost(packet);
+		}
+	}
+
+	TEST(TEST_CLASS, HandlersAreLightByDefault) {
+		// Arrange:
+		PacketHandlers handlers;
+		RegisterHandler(handlers, 2);
+
+		// Act + Assert:
+		EXPECT_EQ(PacketHandlerCost::Light, GetCost(handlers, 2));
+	}
+
+	TEST(TEST_CLASS, CanAddHeavyHandlers) {
+		// Arrange:
+		PacketHandlers handlers;
+		RegisterHandler(handlers, 2);
+		handlers.registerHandler(static_cast<PacketType>(3), [](const auto&, const auto&) {}, PacketHandlerCost::Heavy);
+		handlers.registerHandler(static_cast<PacketType>(5), [](const auto&, const auto&) {}, PacketHandlerCost::Light);
+
+		// Act + Assert:
+		EXPECT_EQ(3u, handlers.size());
+		EXPECT_EQ(PacketHandlerCost::Light, GetCost(handlers, 2));
+		EXPECT_EQ(PacketHandlerCost::Heavy, GetCost(handlers, 3));
+		EXPECT_EQ(PacketHandlerCost::Light, GetCost(handlers, 5));
+	}
+
+	TEST(TEST_CLASS, CostOfUnknownHandlerIsLight) {
+		// Arrange:
+		PacketHandlers handlers;
+		handlers.registerHandler(static_cast<PacketType>(3), [](const auto&, const auto&) {}, PacketHandlerCost::Heavy);
+
+		// Act + Assert:
+		EXPECT_EQ(PacketHandlerCost::Light, GetCost(handlers, 2));
+		EXPECT_EQ(PacketHandlerCost::Light, GetCost(handlers, 4));
+		EXPECT_EQ(PacketHandlerCost::Light, GetCost(handlers, 100));
+	}
+
+	// endregion
+
+	// region statistics
+
+	TEST(TEST_CLASS, StatisticsAreInitiallyZero) {
+		// Arrange:
+		PacketHandlers handlers;
+		RegisterHandler(handlers, 5);
+		handlers.registerHandler(static_cast<PacketType>(2), [](const auto&, const auto&) {}, PacketHandlerCost::Heavy);
+
+		// Act:
+		auto statistics = handlers.statistics();
+
+		// Assert: statistics are ordered by type
+		ASSERT_EQ(2u, statistics.size());
+		EXPECT_EQ(static_cast<PacketType>(2), statistics[0].Type);
+		EXPECT_EQ(PacketHandlerCost::Heavy, statistics[0].Cost);
+		EXPECT_EQ(static_cast<PacketType>(5), statistics[1].Type);
+		EXPECT_EQ(PacketHandlerCost::Light, statistics[1].Cost);
+
+		for (const auto& handlerStatistics : statistics) {
+			EXPECT_EQ(0u, handlerStatistics.NumInvocations);
+			EXPECT_EQ(0u, handlerStatistics.TotalElapsedMicros);
+			EXPECT_EQ(0u, handlerStatistics.MaxElapsedMicros);
+		}
+	}
+
+	TEST(TEST_CLASS, StatisticsAreUpdatedByProcess) {
+		// Arrange: handler for type 3 takes at least 5ms
+		PacketHandlers handlers;
+		RegisterHandler(handlers, 2);
+		handlers.registerHandler(static_cast<PacketType>(3), [](const auto&, const auto&) {
+			test::Sleep(5);
+		});
+
+		// Act:
+		for (auto type : { 2u, 3u, 2u, 4u })
+			ProcessPacket(handlers, type);
+
+		auto statistics = handlers.statistics();
+
+		// Assert: only processed packets are counted
+		ASSERT_EQ(2u, statistics.size());
+		EXPECT_EQ(2u, statistics[0].NumInvocations);
+
+		EXPECT_EQ(1u, statistics[1].NumInvocations);
+		EXPECT_LE(5'000u, statistics[1].TotalElapsedMicros);
+		EXPECT_EQ(statistics[1].TotalElapsedMicros, statistics[1].MaxElapsedMicros);
+	}
+
+	TEST(TEST_CLASS, StatisticsAreNotUpdatedWhenHostIsRejected) {
+		// Arrange:
+		PacketHandlers handlers;
+		handlers.setAllowedHosts({ "bxor.ninja" });
+		RegisterHandler(handlers, 2);
+
+		// Act:
+		ProcessPacket(handlers, 2, "foo.bar");
+		ProcessPacket(handlers, 2, "bxor.ninja");
+
+		// Assert:
+		EXPECT_EQ(1u, handlers.statistics()[0].NumInvocations);
+	}
+
+	TEST(TEST_CLASS, StatisticsAreSharedByCopies) {
+		// Arrange:
+		PacketHandlers handlers;
+		RegisterHandler(handlers, 2);
+		auto handlersCopy = handlers;
+
+		// Act:
+		ProcessPacket(handlersCopy, 2);
+		ProcessPacket(handlersCopy, 2);
+
+		// Assert:
+		EXPECT_EQ(2u, handlers.statistics()[0].NumInvocations);
+		EXPECT_EQ(2u, handlersCopy.statistics()[0].NumInvocations);
+	}
+
+	// endregion
+
 	// region canProcess
 
 	TEST(TEST_CLASS, CanProcessPacketTypeReturnsTrueForPacketWithRegisteredHandler) {
@@ -23,8 +23,10 @@
 #include "bitxorcore/ionet/SocketReader.h"
 #include "bitxorcore/ionet/BufferedPacketIo.h"
 #include "bitxorcore/ionet/IoTypes.h"
+#include "bitxorcore/ionet/PacketHandlerDispatcher.h"
 #include "bitxorcore/ionet/PacketSocket.h"
 #include "bitxorcore/thread/IoThreadPool.h"
+#include "bitxorcore/thread/ThreadInfo.h"
 #include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/net/ClientSocket.h"
 #include "tests/test/net/SocketTestUtils.h"
@@ -58,7 +60,16 @@ namespace bitxorcore { namespace ionet {
 					const std::shared_ptr<PacketSocket>& pSocket,
 					const ServerPacketHandlers& handlers) {
 				auto pBufferedIo = pSocket->buffered();
-				return ionet::CreateSocketReader(pSocket, pBufferedIo, handlers, { m_clientPublicKey, m_clientHost });
+				return ionet::CreateSocketReader(
+						pSocket,
+						pBufferedIo,
+						handlers,
+						{ m_clientPublicKey, m_clientHost },
+						m_pHeavyHandlerDispatcher);
+			}
+
+			void setHeavyHandlerDispatcher(const std::shared_ptr<PacketHandlerDispatcher>& pHeavyHandlerDispatcher) {
+				m_pHeavyHandlerDispatcher = pHeavyHandlerDispatcher;
 			}
 
 			template<typename TContinuation>
@@ -112,6 +123,7 @@ namespace bitxorcore { namespace ionet {
 			std::unique_ptr<thread::IoThreadPool> m_pPool;
 			Key m_clientPublicKey;
 			std::string m_clientHost;
+			std::shared_ptr<PacketHandlerDispatcher> m_pHeavyHandlerDispatcher;
 		};
 
 		// creates server packet handlers that have a noop registered for the default packet type
@@ -548,4 +560,178 @@ namespace bitxorcore { namespace ionet {
 		EXPECT_EQ(clientPublicKey, contextClientIdentity.PublicKey);
 		EXPECT_EQ(clientHost, contextClientIdentity.Host);
 	}
+
+	// region heavy handlers
+
+	namespace {
+		constexpr auto Heavy_Packet_Type = static_cast<PacketType>(1);
+		constexpr auto Light_Packet_Type = static_cast<PacketType>(2);
+
+		void SetPacketTypeAt(ByteBuffer& buffer, size_t offset, PacketType type) {
+			reinterpret_cast<Packet&>(buffer[offset]).Type = type;
+		}
+
+		bool IsComputeThread() {
+			return std::string::npos != thread::GetThreadName().find("compute");
+		}
+	}
+
+	TEST(TEST_CLASS, HeavyHandlersAreExecutedByDispatcherAndResponsesArePreservedInOrder) {
+		// Arrange: send a buffer containing three packets (heavy, light, heavy)
+		auto sendBuffer = test::GenerateRandomPacketBuffer(100, { 0x14, 0x11, 0x32, 0x19 });
+		SetPacketTypeAt(sendBuffer, 0, Heavy_Packet_Type);
+		SetPacketTypeAt(sendBuffer, 0x14, Light_Packet_Type);
+		SetPacketTypeAt(sendBuffer, 0x14 + 0x11, Heavy_Packet_Type);
+		std::vector<ByteBuffer> sendBuffers{ sendBuffer };
+
+		// - set up handlers that respond with a handler id and the received packet size
+		//   (the heavy handler is slow so that the light response would be written first if it wasn't ordered)
+		std::atomic<size_t> numPacketsHandledOnComputeThread(0);
+		auto createHandler = [&numPacketsHandledOnComputeThread](uint8_t handlerId, long sleepMillis) {
+			return [&numPacketsHandledOnComputeThread, handlerId, sleepMillis](const auto& packet, auto& context) {
+				test::Sleep(sleepMillis);
+				if (IsComputeThread())
+					++numPacketsHandledOnComputeThread;
+
+				RespondWithBytes(context, { handlerId, static_cast<uint8_t>(packet.Size) });
+			};
+		};
+
+		ServerPacketHandlers handlers;
+		handlers.registerHandler(Heavy_Packet_Type, createHandler(1, 20), PacketHandlerCost::Heavy);
+		handlers.registerHandler(Light_Packet_Type, createHandler(2, 0));
+
+		std::shared_ptr<thread::ComputeThreadPool> pHeavyHandlerPool = test::CreateStartedComputeThreadPool(2);
+		ReaderFactory factory;
+		factory.setHeavyHandlerDispatcher(CreatePacketHandlerDispatcher(pHeavyHandlerPool, { 2, 10 }));
+
+		// Act: "server" - reads packets from the socket using the reader
+		//      "client" - writes sendBuffers to the socket and reads the response data into responseBytes
+		SocketReadResult readResult;
+		std::vector<uint8_t> responseBytes(3 * sizeof(Packet) + 6);
+		std::unique_ptr<SocketReader> pReader;
+		factory.startReader(handlers, readResult, [&pReader](auto&& pStartedReader) {
+			pReader = std::move(pStartedReader);
+		});
+		test::CreateClientSocket(factory.ioContext())->connect().then([&sendBuffers, &responseBytes](auto&& socketFuture) {
+			auto* pClientSocket = socketFuture.get();
+			pClientSocket->write(sendBuffers).then([pClientSocket, &responseBytes](auto) {
+				pClientSocket->read(responseBytes);
+			});
+		});
+
+		// - wait for the test to complete
+		factory.join();
+		pHeavyHandlerPool->join();
+
+		// Assert: all packets (including the light one queued behind a heavy one) were handled by the dispatcher
+		AssertSocketReadSuccess(readResult, 3, 13);
+		EXPECT_EQ(3u, numPacketsHandledOnComputeThread);
+
+		auto expectedClientBytes = std::vector<uint8_t>{
+			// packet 1
+			0x0A, 0x00, 0x00, 0x00, // size
+			0x00, 0x00, 0x00, 0x00, // type
+			0x01, 0x14, // payload
+			// packet 2
+			0x0A, 0x00, 0x00, 0x00, // size
+			0x00, 0x00, 0x00, 0x00, // type
+			0x02, 0x11, // payload
+			// packet 3
+			0x0A, 0x00, 0x00, 0x00, // size
+			0x00, 0x00, 0x00, 0x00, // type
+			0x01, 0x32 // payload
+		};
+		EXPECT_EQ(expectedClientBytes, responseBytes);
+	}
+
+	TEST(TEST_CLASS, LightHandlersAreExecutedInlineWhenNoPacketsAreDispatched) {
+		// Arrange: send a buffer containing two light packets
+		auto sendBuffer = test::GenerateRandomPacketBuffer(100, { 20, 17, 70 });
+		SetPacketTypeAt(sendBuffer, 0, Light_Packet_Type);
+		SetPacketTypeAt(sendBuffer, 20, Light_Packet_Type);
+		std::vector<ByteBuffer> sendBuffers{ sendBuffer };
+
+		std::atomic<size_t> numPacketsHandled(0);
+		std::atomic<size_t> numPacketsHandledOnComputeThread(0);
+		ServerPacketHandlers handlers;
+		handlers.registerHandler(Heavy_Packet_Type, [](const auto&, const auto&) {}, PacketHandlerCost::Heavy);
+		handlers.registerHandler(Light_Packet_Type, [&numPacketsHandled, &numPacketsHandledOnComputeThread](const auto&, const auto&) {
+			if (IsComputeThread())
+				++numPacketsHandledOnComputeThread;
+
+			++numPacketsHandled;
+		});
+
+		std::shared_ptr<thread::ComputeThreadPool> pHeavyHandlerPool = test::CreateStartedComputeThreadPool(2);
+		ReaderFactory factory;
+		factory.setHeavyHandlerDispatcher(CreatePacketHandlerDispatcher(pHeavyHandlerPool, { 2, 10 }));
+
+		// Act:
+		SocketReadResult readResult;
+		std::unique_ptr<SocketReader> pReader;
+		factory.startReader(handlers, readResult, [&pReader](auto&& pStartedReader) {
+			pReader = std::move(pStartedReader);
+		});
+		auto pClientSocket = test::AddClientWriteBuffersTask(factory.ioContext(), sendBuffers);
+
+		// - wait for the test to complete
+		factory.join();
+
+		// Assert:
+		AssertSocketReadSuccess(readResult, 2, 63);
+		EXPECT_EQ(2u, numPacketsHandled);
+		EXPECT_EQ(0u, numPacketsHandledOnComputeThread);
+	}
+
+	TEST(TEST_CLASS, ReadFailsWhenDispatcherRejectsPacket) {
+		// Arrange: send a buffer containing two heavy packets
+		auto sendBuffer = test::GenerateRandomPacketBuffer(100, { 20, 17, 70 });
+		SetPacketTypeAt(sendBuffer, 0, Heavy_Packet_Type);
+		SetPacketTypeAt(sendBuffer, 20, Heavy_Packet_Type);
+		std::vector<ByteBuffer> sendBuffers{ sendBuffer };
+
+		std::atomic<size_t> numPacketsHandled(0);
+		ServerPacketHandlers handlers;
+		handlers.registerHandler(Heavy_Packet_Type, [&numPacketsHandled](const auto&, const auto&) {
+			++numPacketsHandled;
+		}, PacketHandlerCost::Heavy);
+
+		// - block the only dispatcher worker with a packet from the same peer, which only allows a single pending packet
+		auto clientPublicKey = test::GenerateRandomByteArray<Key>();
+		std::shared_ptr<thread::ComputeThreadPool> pHeavyHandlerPool = test::CreateStartedComputeThreadPool(1);
+		auto pDispatcher = CreatePacketHandlerDispatcher(pHeavyHandlerPool, { 1, 1 });
+
+		std::atomic_bool isBlockerReleased(false);
+		pDispatcher->dispatch(clientPublicKey, Heavy_Packet_Type, [&isBlockerReleased]() {
+			while (!isBlockerReleased)
+				test::Pause();
+		});
+		WAIT_FOR_ZERO_EXPR(pDispatcher->numPendingPackets());
+
+		ReaderFactory factory(clientPublicKey, "alice.com");
+		factory.setHeavyHandlerDispatcher(pDispatcher);
+
+		// Act:
+		SocketReadResult readResult;
+		std::unique_ptr<SocketReader> pReader;
+		factory.startReader(handlers, readResult, [&pReader](auto&& pStartedReader) {
+			pReader = std::move(pStartedReader);
+		});
+		auto pClientSocket = test::AddClientWriteBuffersTask(factory.ioContext(), sendBuffers);
+
+		// - wait for the second packet to be rejected and then release the blocker
+		WAIT_FOR_ONE_EXPR(pDispatcher->numRejectedPackets());
+		isBlockerReleased = true;
+		WAIT_FOR_ONE(numPacketsHandled);
+		pHeavyHandlerPool->join();
+		factory.join();
+
+		// Assert: the rejection was reported as malformed data and only the first packet was handled
+		ASSERT_FALSE(readResult.CompletionCodes.empty());
+		EXPECT_EQ(SocketOperationCode::Malformed_Data, readResult.CompletionCodes[0]);
+		EXPECT_EQ(1u, numPacketsHandled);
+	}
+
+	// endregion
 }}
@@ -138,7 +138,7 @@ namespace bitxorcore { namespace local {
 			RandomSeedCache(state.ref().Cache, cacheHeight, supplementalData.State);
 
 			// - save state
-			extensions::LocalNodeStateSerializer serializer(config::BitxorCoreDirectory(directory.str()));
+			extensions::LocalNodeStateSerializer serializer(config::BitxorCoreDirectory(directory.str()), utils::FileSize());
 			if (shouldUseCacheDatabase) {
 				auto storages = const_cast<const cache::BitxorCoreCache&>(state.ref().Cache).storages();
 				auto cacheDelta = state.ref().Cache.createDelta();
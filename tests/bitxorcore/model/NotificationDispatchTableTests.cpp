@@ -0,0 +1,149 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/model/NotificationDispatchTable.h"
+#include "bitxorcore/model/Notifications.h"
+#include "tests/TestHarness.h"
+
+namespace bitxorcore { namespace model {
+
+#define TEST_CLASS NotificationDispatchTableTests
+
+	namespace {
+		using DispatchTable = NotificationDispatchTable<int>;
+
+		constexpr auto Type_Alpha = static_cast<NotificationType>(0x01001234);
+		constexpr auto Type_Beta = static_cast<NotificationType>(0x02005678);
+		constexpr auto Type_Gamma = static_cast<NotificationType>(0xFF00ABCD);
+
+		std::vector<int> ToValues(const DispatchTable::Handlers& handlers) {
+			std::vector<int> values;
+			for (const auto* pHandler : handlers)
+				values.push_back(*pHandler);
+
+			return values;
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreateEmptyTable) {
+		// Act:
+		DispatchTable table;
+
+		// Assert:
+		EXPECT_EQ(0u, table.numTypes());
+		EXPECT_TRUE(table.universalHandlers().empty());
+		EXPECT_TRUE(table.find(Type_Alpha).empty());
+	}
+
+	TEST(TEST_CLASS, FindReturnsOnlyHandlersRegisteredForType) {
+		// Arrange:
+		std::vector<int> handlers{ 1, 2, 3, 4 };
+		DispatchTable table;
+		table.add(Type_Alpha, &handlers[0]);
+		table.add(Type_Beta, &handlers[1]);
+		table.add(Type_Alpha, &handlers[2]);
+		table.add(Type_Beta, &handlers[3]);
+
+		// Act + Assert:
+		EXPECT_EQ(2u, table.numTypes());
+		EXPECT_EQ(std::vector<int>({ 1, 3 }), ToValues(table.find(Type_Alpha)));
+		EXPECT_EQ(std::vector<int>({ 2, 4 }), ToValues(table.find(Type_Beta)));
+		EXPECT_TRUE(table.find(Type_Gamma).empty());
+	}
+
+	TEST(TEST_CLASS, FindIgnoresChannel) {
+		// Arrange:
+		std::vector<int> handlers{ 1, 2 };
+		DispatchTable table;
+		table.add(Type_Alpha, &handlers[0]);
+		table.add(static_cast<NotificationType>(0x00001234), &handlers[1]);
+
+		// Act + Assert:
+		EXPECT_EQ(1u, table.numTypes());
+		EXPECT_EQ(std::vector<int>({ 1, 2 }), ToValues(table.find(static_cast<NotificationType>(0xFF001234))));
+		EXPECT_EQ(std::vector<int>({ 1, 2 }), ToValues(table.find(static_cast<NotificationType>(0x00001234))));
+	}
+
+	TEST(TEST_CLASS, FindReturnsUniversalHandlersForUnknownType) {
+		// Arrange:
+		std::vector<int> handlers{ 1, 2, 3 };
+		DispatchTable table;
+		table.addUniversal(&handlers[0]);
+		table.add(Type_Alpha, &handlers[1]);
+		table.addUniversal(&handlers[2]);
+
+		// Act + Assert:
+		EXPECT_EQ(std::vector<int>({ 1, 3 }), ToValues(table.universalHandlers()));
+		EXPECT_EQ(std::vector<int>({ 1, 3 }), ToValues(table.find(Type_Gamma)));
+	}
+
+	TEST(TEST_CLASS, FindPreservesRegistrationOrderAcrossTypedAndUniversalHandlers) {
+		// Arrange:
+		std::vector<int> handlers{ 1, 2, 3, 4, 5, 6 };
+		DispatchTable table;
+		table.add(Type_Alpha, &handlers[0]);
+		table.addUniversal(&handlers[1]);
+		table.add(Type_Beta, &handlers[2]);
+		table.add(Type_Alpha, &handlers[3]);
+		table.addUniversal(&handlers[4]);
+		table.add(Type_Gamma, &handlers[5]);
+
+		// Act + Assert: universal handlers registered before a type's first handler are included
+		EXPECT_EQ(3u, table.numTypes());
+		EXPECT_EQ(std::vector<int>({ 1, 2, 4, 5 }), ToValues(table.find(Type_Alpha)));
+		EXPECT_EQ(std::vector<int>({ 2, 3, 5 }), ToValues(table.find(Type_Beta)));
+		EXPECT_EQ(std::vector<int>({ 2, 5, 6 }), ToValues(table.find(Type_Gamma)));
+	}
+	// region lookups
+
+	TEST(TEST_CLASS, UniversalDispatchLookupReturnsAllHandlers) {
+		// Arrange:
+		std::vector<int> handlers{ 1, 2, 3 };
+		UniversalDispatchLookup lookup;
+
+		// Act:
+		const auto& foundHandlers = lookup.find(Notification(Type_Alpha, sizeof(Notification)), handlers);
+
+		// Assert:
+		EXPECT_EQ(&handlers, &foundHandlers);
+	}
+
+	TEST(TEST_CLASS, NotificationDispatchTableLookupReturnsHandlersRegisteredForNotificationType) {
+		// Arrange:
+		std::vector<int> handlers{ 1, 2, 3 };
+		DispatchTable table;
+		table.add(Type_Alpha, &handlers[0]);
+		table.add(Type_Beta, &handlers[1]);
+		table.addUniversal(&handlers[2]);
+		NotificationDispatchTableLookup<int> lookup(std::move(table));
+
+		// Act:
+		const auto& alphaHandlers = lookup.find(Notification(Type_Alpha, sizeof(Notification)), handlers);
+		const auto& gammaHandlers = lookup.find(Notification(Type_Gamma, sizeof(Notification)), handlers);
+
+		// Assert:
+		EXPECT_EQ(std::vector<int>({ 1, 3 }), ToValues(alphaHandlers));
+		EXPECT_EQ(std::vector<int>({ 3 }), ToValues(gammaHandlers));
+	}
+
+	// endregion
+}}
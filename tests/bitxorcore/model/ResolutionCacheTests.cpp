@@ -0,0 +1,152 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/model/ResolutionCache.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace bitxorcore { namespace model {
+
+#define TEST_CLASS ResolutionCacheTests
+
+	namespace {
+		void AssertStatistics(const ResolutionCache& cache, uint64_t numHits, uint64_t numMisses, uint64_t numInvalidations) {
+			const auto& statistics = cache.statistics();
+			EXPECT_EQ(numHits, statistics.NumHits);
+			EXPECT_EQ(numMisses, statistics.NumMisses);
+			EXPECT_EQ(numInvalidations, statistics.NumInvalidations);
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreateEmptyCache) {
+		// Act:
+		ResolutionCache cache;
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		AssertStatistics(cache, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, TryFindFailsWhenTokenResolutionIsNotCached) {
+		// Arrange:
+		ResolutionCache cache;
+		cache.insert(UnresolvedTokenId(123), TokenId(234));
+
+		// Act:
+		TokenId resolved(999);
+		auto isFound = cache.tryFind(UnresolvedTokenId(124), resolved);
+
+		// Assert:
+		EXPECT_FALSE(isFound);
+		EXPECT_EQ(TokenId(999), resolved);
+		AssertStatistics(cache, 0, 1, 0);
+	}
+
+	TEST(TEST_CLASS, TryFindSucceedsWhenTokenResolutionIsCached) {
+		// Arrange:
+		ResolutionCache cache;
+		cache.insert(UnresolvedTokenId(123), TokenId(234));
+
+		// Act:
+		TokenId resolved;
+		auto isFound = cache.tryFind(UnresolvedTokenId(123), resolved);
+
+		// Assert:
+		EXPECT_TRUE(isFound);
+		EXPECT_EQ(TokenId(234), resolved);
+		EXPECT_EQ(1u, cache.size());
+		AssertStatistics(cache, 1, 0, 0);
+	}
+
+	TEST(TEST_CLASS, TryFindFailsWhenAddressResolutionIsNotCached) {
+		// Arrange:
+		ResolutionCache cache;
+		cache.insert(test::GenerateRandomByteArray<UnresolvedAddress>(), test::GenerateRandomByteArray<Address>());
+
+		// Act:
+		Address resolved;
+		auto isFound = cache.tryFind(test::GenerateRandomByteArray<UnresolvedAddress>(), resolved);
+
+		// Assert:
+		EXPECT_FALSE(isFound);
+		AssertStatistics(cache, 0, 1, 0);
+	}
+
+	TEST(TEST_CLASS, TryFindSucceedsWhenAddressResolutionIsCached) {
+		// Arrange:
+		auto unresolvedAddress = test::GenerateRandomByteArray<UnresolvedAddress>();
+		auto address = test::GenerateRandomByteArray<Address>();
+
+		ResolutionCache cache;
+		cache.insert(unresolvedAddress, address);
+
+		// Act:
+		Address resolved;
+		auto isFound = cache.tryFind(unresolvedAddress, resolved);
+
+		// Assert:
+		EXPECT_TRUE(isFound);
+		EXPECT_EQ(address, resolved);
+		EXPECT_EQ(1u, cache.size());
+		AssertStatistics(cache, 1, 0, 0);
+	}
+
+	TEST(TEST_CLASS, ClearRemovesAllResolutions) {
+		// Arrange:
+		auto unresolvedAddress = test::GenerateRandomByteArray<UnresolvedAddress>();
+
+		ResolutionCache cache;
+		cache.insert(UnresolvedTokenId(123), TokenId(234));
+		cache.insert(unresolvedAddress, test::GenerateRandomByteArray<Address>());
+
+		// Act:
+		cache.clear();
+
+		// Assert:
+		TokenId resolvedTokenId;
+		Address resolvedAddress;
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_FALSE(cache.tryFind(UnresolvedTokenId(123), resolvedTokenId));
+		EXPECT_FALSE(cache.tryFind(unresolvedAddress, resolvedAddress));
+		AssertStatistics(cache, 0, 2, 1);
+	}
+
+	TEST(TEST_CLASS, CachesCanShareStatistics) {
+		// Arrange:
+		auto pStatistics = std::make_shared<ResolutionCacheStatistics>();
+		ResolutionCache cache1(pStatistics);
+		ResolutionCache cache2(pStatistics);
+		cache1.insert(UnresolvedTokenId(123), TokenId(234));
+
+		// Act:
+		TokenId resolved;
+		cache1.tryFind(UnresolvedTokenId(123), resolved);
+		cache2.tryFind(UnresolvedTokenId(123), resolved);
+		cache2.tryFind(UnresolvedTokenId(123), resolved);
+		cache2.clear();
+
+		// Assert: resolutions are not shared but statistics are
+		EXPECT_EQ(1u, cache1.size());
+		EXPECT_EQ(&cache1.statistics(), &cache2.statistics());
+		AssertStatistics(cache1, 1, 2, 1);
+	}
+}}
@@ -21,6 +21,7 @@
 **/
 
 #include "bitxorcore/model/ResolverContext.h"
+#include "bitxorcore/model/ResolutionCache.h"
 #include "tests/TestHarness.h"
 
 namespace bitxorcore { namespace model {
@@ -74,4 +75,111 @@ namespace bitxorcore { namespace model {
 		// Assert:
 		EXPECT_EQ(Address{ { 124 } }, result);
 	}
+
+	// region resolution cache
+
+	namespace {
+		struct ResolverCallCounts {
+			size_t NumTokenResolverCalls = 0;
+			size_t NumAddressResolverCalls = 0;
+		};
+
+		ResolverContext CreateCountingResolverContext(
+				ResolverCallCounts& counts,
+				const std::shared_ptr<ResolutionCache>& pResolutionCache) {
+			return ResolverContext(
+					[&counts](auto tokenId) {
+						++counts.NumTokenResolverCalls;
+						return TokenId(tokenId.unwrap() + 1);
+					},
+					[&counts](const auto& address) {
+						++counts.NumAddressResolverCalls;
+						return Address{ { static_cast<uint8_t>(address[0] + 1) } };
+					},
+					pResolutionCache);
+		}
+	}
+
+	TEST(TEST_CLASS, ResolutionCacheIsNotPresentByDefault) {
+		// Act:
+		ResolverContext context1;
+		ResolverContext context2([](auto) { return TokenId(); }, [](const auto&) { return Address(); });
+
+		// Assert:
+		EXPECT_FALSE(!!context1.resolutionCache());
+		EXPECT_FALSE(!!context2.resolutionCache());
+	}
+
+	TEST(TEST_CLASS, ResolutionsAreNotMemoizedWithoutResolutionCache) {
+		// Arrange:
+		ResolverCallCounts counts;
+		auto context = CreateCountingResolverContext(counts, nullptr);
+
+		// Act:
+		for (auto i = 0u; i < 3; ++i) {
+			EXPECT_EQ(TokenId(124), context.resolve(UnresolvedTokenId(123)));
+			EXPECT_EQ(Address{ { 124 } }, context.resolve(UnresolvedAddress{ { { 123 } } }));
+		}
+
+		// Assert:
+		EXPECT_EQ(3u, counts.NumTokenResolverCalls);
+		EXPECT_EQ(3u, counts.NumAddressResolverCalls);
+	}
+
+	TEST(TEST_CLASS, ResolutionsAreMemoizedWithResolutionCache) {
+		// Arrange:
+		ResolverCallCounts counts;
+		auto pResolutionCache = std::make_shared<ResolutionCache>();
+		auto context = CreateCountingResolverContext(counts, pResolutionCache);
+
+		// Act:
+		for (auto i = 0u; i < 3; ++i) {
+			EXPECT_EQ(TokenId(124), context.resolve(UnresolvedTokenId(123)));
+			EXPECT_EQ(TokenId(126), context.resolve(UnresolvedTokenId(125)));
+			EXPECT_EQ(Address{ { 124 } }, context.resolve(UnresolvedAddress{ { { 123 } } }));
+		}
+
+		// Assert:
+		EXPECT_EQ(pResolutionCache.get(), context.resolutionCache());
+		EXPECT_EQ(2u, counts.NumTokenResolverCalls);
+		EXPECT_EQ(1u, counts.NumAddressResolverCalls);
+		EXPECT_EQ(3u, pResolutionCache->size());
+		EXPECT_EQ(6u, pResolutionCache->statistics().NumHits);
+		EXPECT_EQ(3u, pResolutionCache->statistics().NumMisses);
+	}
+
+	TEST(TEST_CLASS, ResolutionsAreResolvedAgainAfterResolutionCacheIsCleared) {
+		// Arrange:
+		ResolverCallCounts counts;
+		auto pResolutionCache = std::make_shared<ResolutionCache>();
+		auto context = CreateCountingResolverContext(counts, pResolutionCache);
+		context.resolve(UnresolvedTokenId(123));
+		context.resolve(UnresolvedAddress{ { { 123 } } });
+
+		// Act:
+		context.resolutionCache()->clear();
+		context.resolve(UnresolvedTokenId(123));
+		context.resolve(UnresolvedAddress{ { { 123 } } });
+
+		// Assert:
+		EXPECT_EQ(2u, counts.NumTokenResolverCalls);
+		EXPECT_EQ(2u, counts.NumAddressResolverCalls);
+	}
+
+	TEST(TEST_CLASS, CopiesShareResolutionCache) {
+		// Arrange:
+		ResolverCallCounts counts;
+		auto context = CreateCountingResolverContext(counts, std::make_shared<ResolutionCache>());
+		auto contextCopy = context;
+
+		// Act:
+		context.resolve(UnresolvedTokenId(123));
+		contextCopy.resolve(UnresolvedTokenId(123));
+
+		// Assert:
+		EXPECT_EQ(context.resolutionCache(), contextCopy.resolutionCache());
+		EXPECT_EQ(1u, counts.NumTokenResolverCalls);
+	}
+
+	// endregion
 }}
@@ -21,14 +21,17 @@
 **/
 
 #include "bitxorcore/net/PacketReaders.h"
+#include "bitxorcore/ionet/PacketHandlerDispatcher.h"
 #include "bitxorcore/ionet/PacketSocket.h"
 #include "bitxorcore/ionet/SocketReader.h"
 #include "bitxorcore/thread/IoThreadPool.h"
+#include "bitxorcore/thread/ThreadInfo.h"
 #include "tests/bitxorcore/net/test/ConnectionContainerTestUtils.h"
 #include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/net/NodeTestUtils.h"
 #include "tests/test/net/SocketTestUtils.h"
 #include "tests/test/nodeps/KeyTestUtils.h"
+#include <map>
 #include <unordered_map>
 
 namespace bitxorcore { namespace net {
@@ -57,12 +60,19 @@ namespace bitxorcore { namespace net {
 					const ionet::ServerPacketHandlers& handlers,
 					uint32_t numClientPublicKeys,
 					uint32_t maxConnectionsPerIdentity,
-					const ConnectionSettings& connectionSettings = ConnectionSettings())
+					const ConnectionSettings& connectionSettings = ConnectionSettings(),
+					const std::shared_ptr<ionet::PacketHandlerDispatcher>& pHeavyHandlerDispatcher = nullptr)
 					: ServerPublicKey(test::GenerateRandomByteArray<Key>())
 					, pPool(test::CreateStartedIoThreadPool())
 					, IoContext(pPool->ioContext())
 					, Handlers(handlers)
-					, pReaders(CreatePacketReaders(*pPool, Handlers, ServerPublicKey, connectionSettings, maxConnectionsPerIdentity)) {
+					, pReaders(CreatePacketReaders(
+							*pPool,
+							Handlers,
+							ServerPublicKey,
+							connectionSettings,
+							maxConnectionsPerIdentity,
+							pHeavyHandlerDispatcher)) {
 				for (auto i = 0u; i < numClientPublicKeys; ++i) {
 					ClientPublicKeys.push_back(test::GenerateRandomByteArray<Key>());
 					Hosts.push_back(std::to_string(i));
@@ -444,6 +454,125 @@ namespace bitxorcore { namespace net {
 
 	// endregion
 
+	// region heavy handlers
+
+	namespace {
+		constexpr auto Light_Packet_Type = static_cast<ionet::PacketType>(0x99);
+
+		ionet::ByteBuffer SendTaggedPacket(ionet::PacketIo& io, ionet::PacketType type, uint8_t tag) {
+			auto sendBuffer = test::GenerateRandomPacketBuffer(62);
+			reinterpret_cast<ionet::Packet&>(sendBuffer[0]).Type = type;
+			sendBuffer[Tag_Index] = tag;
+
+			io.write(test::BufferToPacketPayload(sendBuffer), [](auto) {});
+			return sendBuffer;
+		}
+
+		bool IsComputeThread() {
+			return std::string::npos != thread::GetThreadName().find("compute");
+		}
+	}
+
+	TEST(TEST_CLASS, ManySimulatedPeersAreServedByHeavyHandlersInOrder) {
+		// Arrange: set up a heavy handler that records the tags received from each peer
+		constexpr uint32_t Num_Peers = 16;
+		constexpr uint32_t Num_Packets_Per_Peer = 4;
+		std::mutex mutex;
+		std::map<Key, std::vector<uint8_t>> peerTags;
+		std::atomic<size_t> numPacketsRead(0);
+		std::atomic<size_t> numPacketsReadOnComputeThread(0);
+
+		ionet::ServerPacketHandlers handlers;
+		handlers.registerHandler(test::Default_Packet_Type, [&](const auto& packet, const auto& context) {
+			test::Sleep(1);
+
+			{
+				std::lock_guard<std::mutex> guard(mutex);
+				peerTags[context.key()].push_back(reinterpret_cast<const uint8_t*>(&packet)[Tag_Index]);
+			}
+
+			if (IsComputeThread())
+				++numPacketsReadOnComputeThread;
+
+			++numPacketsRead;
+		}, ionet::PacketHandlerCost::Heavy);
+
+		std::shared_ptr<thread::ComputeThreadPool> pHeavyHandlerPool = test::CreateStartedComputeThreadPool(2);
+		auto pDispatcher = ionet::CreatePacketHandlerDispatcher(pHeavyHandlerPool, { 2, Num_Packets_Per_Peer });
+
+		// - connect all peers
+		PacketReadersTestContext context(handlers, Num_Peers, 1, ConnectionSettings(), pDispatcher);
+		auto state = SetupMultiConnectionTest(context);
+
+		// Act: interleave packets across all peers
+		for (auto i = 0u; i < Num_Packets_Per_Peer; ++i) {
+			for (const auto& pSocket : state.ClientSockets)
+				SendTaggedPacket(*pSocket, test::Default_Packet_Type, static_cast<uint8_t>(i));
+		}
+
+		// - wait for all packets to be read
+		WAIT_FOR_VALUE(Num_Peers * Num_Packets_Per_Peer, numPacketsRead);
+
+		// Assert: all packets were handled by the heavy handler pool and each peer's packets were handled in order
+		EXPECT_EQ(Num_Peers * Num_Packets_Per_Peer, numPacketsReadOnComputeThread);
+		EXPECT_EQ(0u, pDispatcher->numRejectedPackets());
+		EXPECT_EQ(Num_Peers * Num_Packets_Per_Peer, context.Handlers.statistics()[0].NumInvocations);
+
+		ASSERT_EQ(Num_Peers, peerTags.size());
+		for (const auto& clientPublicKey : context.ClientPublicKeys)
+			EXPECT_EQ(std::vector<uint8_t>({ 0, 1, 2, 3 }), peerTags[clientPublicKey]) << clientPublicKey;
+
+		pHeavyHandlerPool->join();
+	}
+
+	TEST(TEST_CLASS, LightHandlersAreNotBlockedByHeavyHandlers) {
+		// Arrange: set up a heavy handler that blocks until released and a light handler
+		std::atomic_bool isHeavyHandlerReleased(false);
+		std::atomic<size_t> numHeavyPacketsRead(0);
+		std::atomic<size_t> numLightPacketsRead(0);
+
+		ionet::ServerPacketHandlers handlers;
+		handlers.registerHandler(test::Default_Packet_Type, [&](const auto&, const auto&) {
+			while (!isHeavyHandlerReleased)
+				test::Pause();
+
+			++numHeavyPacketsRead;
+		}, ionet::PacketHandlerCost::Heavy);
+		handlers.registerHandler(Light_Packet_Type, [&](const auto&, const auto&) {
+			++numLightPacketsRead;
+		});
+
+		std::shared_ptr<thread::ComputeThreadPool> pHeavyHandlerPool = test::CreateStartedComputeThreadPool(1);
+		auto pDispatcher = ionet::CreatePacketHandlerDispatcher(pHeavyHandlerPool, { 1, 10 });
+
+		PacketReadersTestContext context(handlers, 3, 1, ConnectionSettings(), pDispatcher);
+		auto state = SetupMultiConnectionTest(context);
+
+		// Act: first two peers send heavy packets, which saturate the heavy handler pool
+		for (auto i = 0u; i < 3; ++i) {
+			SendTaggedPacket(*state.ClientSockets[0], test::Default_Packet_Type, static_cast<uint8_t>(i));
+			SendTaggedPacket(*state.ClientSockets[1], test::Default_Packet_Type, static_cast<uint8_t>(i));
+		}
+
+		// - wait for one heavy packet to be executing and one to be queued behind it
+		WAIT_FOR_ONE_EXPR(pDispatcher->numPendingPackets());
+
+		// - last peer sends a light packet
+		SendTaggedPacket(*state.ClientSockets[2], Light_Packet_Type, 0);
+
+		// Assert: light packet is processed even though heavy packets are blocked
+		WAIT_FOR_ONE(numLightPacketsRead);
+		EXPECT_EQ(0u, numHeavyPacketsRead);
+		EXPECT_EQ(2u, pDispatcher->numActivePeers());
+
+		// Act: release the heavy handlers
+		isHeavyHandlerReleased = true;
+		WAIT_FOR_VALUE(6u, numHeavyPacketsRead);
+		pHeavyHandlerPool->join();
+	}
+
+	// endregion
+
 	// region read error
 
 	TEST(TEST_CLASS, ReadErrorDisconnectsConnectedSocket) {
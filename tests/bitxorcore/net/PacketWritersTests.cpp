@@ -1148,6 +1148,34 @@ namespace bitxorcore { namespace net {
 		});
 	}
 
+	TEST(TEST_CLASS, PickOneByKeyReturnsConnectionToNodeWithKey) {
+		// Act:
+		PacketWritersTestContext context;
+		RunConnectedSocketTest(context, [&](auto, const auto&) {
+			// - pick a pair
+			auto packetIoPair = context.pWriters->pickOneByKey(context.ClientPublicKeys[0], Default_Timeout);
+
+			// Assert:
+			ASSERT_TRUE(!!packetIoPair);
+			EXPECT_TRUE(!!packetIoPair.io());
+			EXPECT_EQ(context.ClientPublicKeys[0], packetIoPair.node().identity().PublicKey);
+			EXPECT_EQ(0u, context.pWriters->numAvailableWriters());
+		});
+	}
+
+	TEST(TEST_CLASS, PickOneByKeyReturnsNullWhenNodeWithKeyIsNotConnected) {
+		// Act:
+		PacketWritersTestContext context;
+		RunConnectedSocketTest(context, [&](auto, const auto&) {
+			// - pick a pair
+			auto packetIoPair = context.pWriters->pickOneByKey(test::GenerateRandomByteArray<Key>(), Default_Timeout);
+
+			// Assert:
+			EXPECT_FALSE(!!packetIoPair);
+			EXPECT_EQ(1u, context.pWriters->numAvailableWriters());
+		});
+	}
+
 	namespace {
 		void AssertSingleConnection(
 				model::NodeIdentityEqualityStrategy equalityStrategy,
@@ -246,5 +246,62 @@ namespace bitxorcore { namespace observers {
 		});
 	}
 
+	namespace {
+		void AssertObserversAreNotifiedInRegistrationOrder(NotifyMode mode, const Breadcrumbs& expectedSelectedNames) {
+			// Arrange:
+			Breadcrumbs breadcrumbs;
+			DemuxObserverBuilder builder;
+
+			cache::BitxorCoreCache cache({});
+			auto cacheDelta = cache.createDelta();
+			auto context = test::CreateObserverContext(cacheDelta, Height(123), mode);
+
+			builder
+				.add(CreateBreadcrumbObserver(breadcrumbs, "alpha"))
+				.add(CreateBreadcrumbObserver<model::AccountAddressNotification>(breadcrumbs, "beta"))
+				.add(CreateBreadcrumbObserver<model::AccountPublicKeyNotification>(breadcrumbs, "gamma"))
+				.add(CreateBreadcrumbObserver(breadcrumbs, "delta"))
+				.add(CreateBreadcrumbObserver<model::AccountPublicKeyNotification>(breadcrumbs, "epsilon"));
+			auto pObserver = builder.build();
+
+			// Act:
+			test::ObserveNotification<model::Notification>(*pObserver, model::AccountPublicKeyNotification(Key()), context);
+
+			// Assert:
+			EXPECT_EQ(expectedSelectedNames, breadcrumbs);
+		}
+	}
+
+	TEST(TEST_CLASS, DemuxObserverNotifiesTypedAndUniversalObserversInRegistrationOrderOnCommit) {
+		AssertObserversAreNotifiedInRegistrationOrder(NotifyMode::Commit, { "alpha", "gamma", "delta", "epsilon" });
+	}
+
+	TEST(TEST_CLASS, DemuxObserverNotifiesTypedAndUniversalObserversInReverseRegistrationOrderOnRollback) {
+		AssertObserversAreNotifiedInRegistrationOrder(NotifyMode::Rollback, { "epsilon", "delta", "gamma", "alpha" });
+	}
+
+	TEST(TEST_CLASS, DemuxObserverNotifiesOnlyUniversalObserversForUnregisteredType) {
+		// Arrange:
+		Breadcrumbs breadcrumbs;
+		DemuxObserverBuilder builder;
+
+		cache::BitxorCoreCache cache({});
+		auto cacheDelta = cache.createDelta();
+		auto context = test::CreateObserverContext(cacheDelta, Height(123), NotifyMode::Commit);
+
+		builder
+			.add(CreateBreadcrumbObserver(breadcrumbs, "alpha"))
+			.add(CreateBreadcrumbObserver<model::AccountPublicKeyNotification>(breadcrumbs, "beta"))
+			.add(CreateBreadcrumbObserver(breadcrumbs, "gamma"));
+		auto pObserver = builder.build();
+
+		// Act:
+		test::ObserveNotification<model::Notification>(*pObserver, model::AccountAddressNotification(UnresolvedAddress()), context);
+
+		// Assert:
+		Breadcrumbs expectedSelectedNames{ "alpha", "gamma" };
+		EXPECT_EQ(expectedSelectedNames, breadcrumbs);
+	}
+
 	// endregion
 }}
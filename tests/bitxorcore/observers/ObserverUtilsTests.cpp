@@ -271,4 +271,70 @@ namespace bitxorcore { namespace observers {
 	}
 
 	// endregion
+
+	// region ResolutionCacheInvalidationObserver
+
+	namespace {
+		void AssertResolutionCacheInvalidation(NotifyMode mode, bool hasStatementBuilder) {
+			// Arrange:
+			auto pObserver = CreateResolutionCacheInvalidationObserver<model::BlockNotification>("Foo");
+
+			auto pResolutionCache = std::make_shared<model::ResolutionCache>();
+			auto resolverContext = model::ResolverContext(
+					[](auto tokenId) { return TokenId(tokenId.unwrap()); },
+					[](const auto& address) { return address.template copyTo<Address>(); },
+					pResolutionCache);
+			resolverContext.resolve(UnresolvedTokenId(123));
+
+			auto cache = CreateSimpleBitxorCoreCache();
+			auto cacheDelta = cache.createDelta();
+			model::BlockStatementBuilder statementBuilder;
+			auto observerState = hasStatementBuilder ? ObserverState(cacheDelta, statementBuilder) : ObserverState(cacheDelta);
+			ObserverContext context(model::NotificationContext(Height(11), resolverContext), observerState, mode);
+
+			// Sanity:
+			EXPECT_EQ(1u, pResolutionCache->size());
+
+			// Act:
+			NotifyBlock(*pObserver, context);
+
+			// Assert:
+			EXPECT_EQ(0u, pResolutionCache->size());
+			EXPECT_EQ(1u, pResolutionCache->statistics().NumInvalidations);
+		}
+	}
+
+	TEST(TEST_CLASS, ResolutionCacheInvalidationObserverIsCreatedWithCorrectName) {
+		// Act:
+		auto pObserver = CreateResolutionCacheInvalidationObserver<model::BlockNotification>("Foo");
+
+		// Assert:
+		EXPECT_EQ("FooResolutionCacheInvalidationObserver", pObserver->name());
+	}
+
+	TEST(TEST_CLASS, ResolutionCacheInvalidationObserverClearsResolutionCache_Commit) {
+		AssertResolutionCacheInvalidation(NotifyMode::Commit, false);
+	}
+
+	TEST(TEST_CLASS, ResolutionCacheInvalidationObserverClearsResolutionCache_Rollback) {
+		AssertResolutionCacheInvalidation(NotifyMode::Rollback, false);
+	}
+
+	TEST(TEST_CLASS, ResolutionCacheInvalidationObserverClearsResolutionCache_WithStatementBuilder) {
+		AssertResolutionCacheInvalidation(NotifyMode::Commit, true);
+	}
+
+	TEST(TEST_CLASS, ResolutionCacheInvalidationObserverIgnoresResolverContextWithoutResolutionCache) {
+		// Arrange:
+		auto pObserver = CreateResolutionCacheInvalidationObserver<model::BlockNotification>("Foo");
+
+		auto cache = CreateSimpleBitxorCoreCache();
+		auto cacheDelta = cache.createDelta();
+		ObserverContext context(CreateNotificationContext(Height(11)), ObserverState(cacheDelta), NotifyMode::Commit);
+
+		// Act + Assert:
+		EXPECT_NO_THROW(NotifyBlock(*pObserver, context));
+	}
+
+	// endregion
 }}
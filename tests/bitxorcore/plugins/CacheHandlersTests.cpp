@@ -68,8 +68,9 @@ namespace bitxorcore { namespace plugins {
 			pluginManager.addHandlers(packetHandlers, cache);
 
 			// Assert:
-			EXPECT_EQ(1u, packetHandlers.size());
+			EXPECT_EQ(2u, packetHandlers.size());
 			EXPECT_TRUE(packetHandlers.canProcess(static_cast<ionet::PacketType>(0x200 + 123)));
+			EXPECT_TRUE(packetHandlers.canProcess(static_cast<ionet::PacketType>(0x500 + 123)));
 		});
 	}
 
@@ -23,13 +23,16 @@
 #include "bitxorcore/plugins/PluginManager.h"
 #include "sdk/src/extensions/ConversionExtensions.h"
 #include "bitxorcore/cache/BitxorCoreCache.h"
+#include "bitxorcore/cache_db/SharedRocksDatabase.h"
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/mocks/MockNotificationSubscriber.h"
 #include "tests/test/core/mocks/MockTransaction.h"
+#include "tests/test/nodeps/Filesystem.h"
 #include "tests/test/nodeps/NumericTestUtils.h"
 #include "tests/test/plugins/PluginManagerFactory.h"
 #include "tests/test/plugins/ValidatorTestUtils.h"
 #include "tests/TestHarness.h"
+#include <filesystem>
 
 namespace bitxorcore { namespace plugins {
 
@@ -45,6 +48,7 @@ namespace bitxorcore { namespace plugins {
 		EXPECT_FALSE(config.PreferCacheDatabase);
 		EXPECT_TRUE(config.CacheDatabaseDirectory.empty());
 		EXPECT_EQ(utils::FileSize::FromKilobytes(0), config.CacheDatabaseConfig.MaxWriteBatchSize);
+		EXPECT_EQ(1'000u, config.MaxStatePathKeysPerRequest);
 	}
 
 	TEST(TEST_CLASS, CanCreateManager) {
@@ -99,6 +103,71 @@ namespace bitxorcore { namespace plugins {
 		// Assert: cache configuration is constructed appropriately
 		assertCacheConfiguration(manager.cacheConfig("foo"), "abc/foo");
 		assertCacheConfiguration(manager.cacheConfig("bar"), "abc/bar");
+		EXPECT_FALSE(!!manager.cacheConfig("foo").SharedDatabase);
+	}
+
+	TEST(TEST_CLASS, CanCreateCacheConfigurationWithSharedDatabase) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto storageConfig = StorageConfiguration();
+		storageConfig.PreferCacheDatabase = true;
+		storageConfig.CacheDatabaseDirectory = dbDirGuard.name();
+		storageConfig.CacheDatabaseConfig.EnableSharedDatabase = true;
+
+		// Act:
+		PluginManager manager(
+				model::BlockchainConfiguration::Uninitialized(),
+				storageConfig,
+				config::UserConfiguration::Uninitialized(),
+				config::InflationConfiguration::Uninitialized());
+		auto cacheConfig1 = manager.cacheConfig("foo");
+		auto cacheConfig2 = manager.cacheConfig("bar");
+
+		// Assert: all cache configurations reference the same shared database
+		ASSERT_TRUE(!!cacheConfig1.SharedDatabase);
+		EXPECT_EQ(cacheConfig1.SharedDatabase, cacheConfig2.SharedDatabase);
+		EXPECT_EQ(dbDirGuard.name() + "/shared", cacheConfig1.SharedDatabase->databaseDirectory());
+		EXPECT_EQ(cacheConfig1.SharedDatabase, manager.sharedCacheDatabase());
+	}
+
+	TEST(TEST_CLASS, SharedDatabaseIsNotCreatedUntilCacheConfigurationIsRequested) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto storageConfig = StorageConfiguration();
+		storageConfig.PreferCacheDatabase = true;
+		storageConfig.CacheDatabaseDirectory = dbDirGuard.name();
+		storageConfig.CacheDatabaseConfig.EnableSharedDatabase = true;
+
+		// Act:
+		PluginManager manager(
+				model::BlockchainConfiguration::Uninitialized(),
+				storageConfig,
+				config::UserConfiguration::Uninitialized(),
+				config::InflationConfiguration::Uninitialized());
+		auto cache = manager.createCache();
+
+		// Assert:
+		EXPECT_FALSE(!!manager.sharedCacheDatabase());
+		EXPECT_FALSE(std::filesystem::exists(dbDirGuard.name() + "/shared"));
+	}
+
+	TEST(TEST_CLASS, SharedDatabaseIsNotCreatedWhenCacheDatabaseIsNotPreferred) {
+		// Arrange:
+		auto storageConfig = StorageConfiguration();
+		storageConfig.CacheDatabaseConfig.EnableSharedDatabase = true;
+
+		// Act:
+		PluginManager manager(
+				model::BlockchainConfiguration::Uninitialized(),
+				storageConfig,
+				config::UserConfiguration::Uninitialized(),
+				config::InflationConfiguration::Uninitialized());
+		auto cacheConfig = manager.cacheConfig("foo");
+
+		// Assert:
+		EXPECT_FALSE(cacheConfig.ShouldUseCacheDatabase);
+		EXPECT_FALSE(!!cacheConfig.SharedDatabase);
+		EXPECT_FALSE(!!manager.sharedCacheDatabase());
 	}
 
 	// endregion
@@ -628,6 +697,62 @@ namespace bitxorcore { namespace plugins {
 		EXPECT_EQ(TTraits::CreateResolved(123 + 2 + 1), result);
 	}
 
+	RESOLVER_TRAITS_BASED_TEST(CreatedResolverContextMemoizesResolutions) {
+		// Arrange:
+		auto manager = test::CreatePluginManager();
+		TTraits::AddResolver(manager, 1, true);
+
+		AddSubCachePluginWithId<2>(manager);
+		auto cache = manager.createCache();
+		auto cacheDelta = cache.createDelta();
+		auto readOnlyCache = cacheDelta.toReadOnly();
+		auto resolverContext = manager.createResolverContext(readOnlyCache);
+
+		// Act:
+		auto result1 = resolverContext.resolve(TTraits::CreateUnresolved(123));
+		auto result2 = resolverContext.resolve(TTraits::CreateUnresolved(123));
+		auto result3 = resolverContext.resolve(TTraits::CreateUnresolved(124));
+
+		// Assert:
+		EXPECT_EQ(TTraits::CreateResolved(123 + 1), result1);
+		EXPECT_EQ(TTraits::CreateResolved(123 + 1), result2);
+		EXPECT_EQ(TTraits::CreateResolved(124 + 1), result3);
+
+		ASSERT_TRUE(!!resolverContext.resolutionCache());
+		EXPECT_EQ(2u, resolverContext.resolutionCache()->size());
+
+		const auto& statistics = manager.resolutionCacheStatistics();
+		EXPECT_EQ(1u, statistics.NumHits);
+		EXPECT_EQ(2u, statistics.NumMisses);
+		EXPECT_EQ(0u, statistics.NumInvalidations);
+	}
+
+	TEST(TEST_CLASS, CreatedResolverContextsHaveIndependentResolutionCachesButSharedStatistics) {
+		// Arrange:
+		auto manager = test::CreatePluginManager();
+		auto cache = manager.createCache();
+		auto cacheDelta = cache.createDelta();
+		auto readOnlyCache = cacheDelta.toReadOnly();
+		auto resolverContext1 = manager.createResolverContext(readOnlyCache);
+		auto resolverContext2 = manager.createResolverContext(readOnlyCache);
+
+		// Act:
+		resolverContext1.resolve(UnresolvedTokenId(123));
+		resolverContext1.resolve(UnresolvedTokenId(123));
+		resolverContext2.resolve(UnresolvedTokenId(123));
+		resolverContext2.resolutionCache()->clear();
+
+		// Assert:
+		EXPECT_NE(resolverContext1.resolutionCache(), resolverContext2.resolutionCache());
+		EXPECT_EQ(1u, resolverContext1.resolutionCache()->size());
+		EXPECT_EQ(0u, resolverContext2.resolutionCache()->size());
+
+		const auto& statistics = manager.resolutionCacheStatistics();
+		EXPECT_EQ(1u, statistics.NumHits);
+		EXPECT_EQ(2u, statistics.NumMisses);
+		EXPECT_EQ(1u, statistics.NumInvalidations);
+	}
+
 	// endregion
 
 	// region notification publisher
@@ -0,0 +1,252 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/state/PackedAccountState.h"
+#include "tests/test/core/AccountStateTestUtils.h"
+#include "tests/test/core/AddressTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace bitxorcore { namespace state {
+
+#define TEST_CLASS PackedAccountStateTests
+
+	namespace {
+		// address + address height + public key + public key height + optimized token id + counts (padded)
+		constexpr size_t Header_Size = Address::Size + sizeof(Height) + Key::Size + sizeof(Height) + sizeof(TokenId) + 8;
+
+		AccountState CreateAccountState() {
+			AccountState accountState(test::GenerateRandomAddress(), Height(123));
+			accountState.PublicKey = test::GenerateRandomByteArray<Key>();
+			accountState.PublicKeyHeight = Height(234);
+			accountState.AccountType = AccountType::Main;
+			return accountState;
+		}
+
+		AccountState CreateHighValueAccountState(size_t numTokens) {
+			auto accountState = CreateAccountState();
+			test::RandomFillAccountData(11, accountState, numTokens);
+			return accountState;
+		}
+
+		void AssertRoundtrip(const AccountState& accountState) {
+			// Act:
+			PackedAccountState packedAccountState(accountState);
+			auto unpackedAccountState = packedAccountState.unpack();
+
+			// Assert:
+			test::AssertEqual(accountState, unpackedAccountState);
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanPackAccountStateWithoutOptionalData) {
+		// Arrange:
+		auto accountState = CreateAccountState();
+
+		// Act:
+		PackedAccountState packedAccountState(accountState);
+
+		// Assert:
+		EXPECT_EQ(accountState.Address, packedAccountState.address());
+		EXPECT_EQ(Height(123), packedAccountState.addressHeight());
+		EXPECT_EQ(accountState.PublicKey, packedAccountState.publicKey());
+		EXPECT_EQ(Height(234), packedAccountState.publicKeyHeight());
+		EXPECT_EQ(AccountType::Main, packedAccountState.accountType());
+
+		EXPECT_EQ(0u, packedAccountState.numTokens());
+		EXPECT_EQ(Importance(), packedAccountState.currentImportance());
+		EXPECT_EQ(Header_Size, packedAccountState.allocationSize());
+	}
+
+	TEST(TEST_CLASS, CanPackAccountStateWithAllData) {
+		// Arrange:
+		auto accountState = CreateHighValueAccountState(7);
+		test::SetRandomSupplementalPublicKeys(accountState, AccountPublicKeys::KeyType::All, 2);
+
+		// Act:
+		PackedAccountState packedAccountState(accountState);
+
+		// Assert:
+		EXPECT_EQ(accountState.Address, packedAccountState.address());
+		EXPECT_EQ(7u, packedAccountState.numTokens());
+		EXPECT_EQ(accountState.ImportanceSnapshots.current(), packedAccountState.currentImportance());
+
+		auto expectedSize = Header_Size
+				+ 7 * sizeof(model::Token)
+				+ Importance_History_Size * sizeof(AccountImportanceSnapshots::ImportanceSnapshot)
+				+ Activity_Bucket_History_Size * sizeof(AccountActivityBuckets::ActivityBucket)
+				+ 3 * Key::Size
+				+ 2 * sizeof(model::PinnedVotingKey);
+		EXPECT_EQ(expectedSize, packedAccountState.allocationSize());
+	}
+
+	TEST(TEST_CLASS, PackingOmitsTrailingEmptySnapshotsAndBuckets) {
+		// Arrange:
+		auto accountState = CreateAccountState();
+		accountState.ImportanceSnapshots.set(Importance(111), model::ImportanceHeight(100));
+		accountState.ActivityBuckets.update(model::ImportanceHeight(100), [](auto& bucket) { bucket.RawScore = 5; });
+		accountState.ActivityBuckets.update(model::ImportanceHeight(200), [](auto& bucket) { bucket.RawScore = 6; });
+
+		// Act:
+		PackedAccountState packedAccountState(accountState);
+
+		// Assert:
+		auto expectedSize = Header_Size
+				+ sizeof(AccountImportanceSnapshots::ImportanceSnapshot)
+				+ 2 * sizeof(AccountActivityBuckets::ActivityBucket);
+		EXPECT_EQ(expectedSize, packedAccountState.allocationSize());
+	}
+
+	TEST(TEST_CLASS, CannotPackAccountStateWithTooManyTokens) {
+		// Arrange:
+		auto accountState = CreateAccountState();
+		for (auto i = 0u; i <= std::numeric_limits<uint16_t>::max(); ++i)
+			accountState.Balances.credit(TokenId(i + 1), Amount(1));
+
+		// Act + Assert:
+		EXPECT_THROW(PackedAccountState packedAccountState(accountState), bitxorcore_invalid_argument);
+	}
+
+	// endregion
+
+	// region balance
+
+	TEST(TEST_CLASS, BalanceReturnsAmountForOwnedTokens) {
+		// Arrange:
+		auto accountState = CreateAccountState();
+		accountState.Balances.optimize(TokenId(500));
+		for (auto id : { 900u, 500u, 100u, 700u, 300u, 800u, 200u })
+			accountState.Balances.credit(TokenId(id), Amount(id * 2));
+
+		// Act:
+		PackedAccountState packedAccountState(accountState);
+
+		// Assert:
+		EXPECT_EQ(7u, packedAccountState.numTokens());
+		for (auto id : { 100u, 200u, 300u, 500u, 700u, 800u, 900u })
+			EXPECT_EQ(Amount(id * 2), packedAccountState.balance(TokenId(id))) << id;
+	}
+
+	TEST(TEST_CLASS, BalanceReturnsZeroForUnknownTokens) {
+		// Arrange:
+		auto accountState = CreateAccountState();
+		for (auto id : { 300u, 100u, 200u })
+			accountState.Balances.credit(TokenId(id), Amount(id));
+
+		// Act:
+		PackedAccountState packedAccountState(accountState);
+
+		// Assert:
+		for (auto id : { 0u, 50u, 150u, 250u, 350u })
+			EXPECT_EQ(Amount(), packedAccountState.balance(TokenId(id))) << id;
+	}
+
+	// endregion
+
+	// region importance / activity
+
+	TEST(TEST_CLASS, ImportanceAndActivityBucketAccessorsMatchAccountState) {
+		// Arrange:
+		auto accountState = CreateHighValueAccountState(3);
+
+		// Act:
+		PackedAccountState packedAccountState(accountState);
+
+		// Assert:
+		for (const auto& snapshot : accountState.ImportanceSnapshots)
+			EXPECT_EQ(snapshot.Importance, packedAccountState.importance(snapshot.Height)) << snapshot.Height;
+
+		for (const auto& bucket : accountState.ActivityBuckets) {
+			auto packedBucket = packedAccountState.activityBucket(bucket.StartHeight);
+			EXPECT_EQ(bucket.StartHeight, packedBucket.StartHeight);
+			EXPECT_EQ(bucket.TotalFeesPaid, packedBucket.TotalFeesPaid) << bucket.StartHeight;
+			EXPECT_EQ(bucket.BeneficiaryCount, packedBucket.BeneficiaryCount) << bucket.StartHeight;
+			EXPECT_EQ(bucket.RawScore, packedBucket.RawScore) << bucket.StartHeight;
+		}
+	}
+
+	TEST(TEST_CLASS, ImportanceAndActivityBucketAccessorsReturnDefaultsForUnknownHeights) {
+		// Arrange:
+		auto accountState = CreateHighValueAccountState(3);
+
+		// Act:
+		PackedAccountState packedAccountState(accountState);
+
+		// Assert:
+		auto unknownHeight = model::ImportanceHeight(1'000'000);
+		EXPECT_EQ(Importance(), packedAccountState.importance(unknownHeight));
+		EXPECT_EQ(model::ImportanceHeight(), packedAccountState.activityBucket(unknownHeight).StartHeight);
+		EXPECT_EQ(0u, packedAccountState.activityBucket(unknownHeight).RawScore);
+	}
+
+	// endregion
+
+	// region unpack
+
+	TEST(TEST_CLASS, CanRoundtripAccountStateWithoutOptionalData) {
+		AssertRoundtrip(CreateAccountState());
+	}
+
+	TEST(TEST_CLASS, CanRoundtripAccountStateWithTokens) {
+		// Arrange:
+		auto accountState = CreateAccountState();
+		accountState.Balances.optimize(TokenId(22));
+		for (auto id : { 33u, 11u, 22u })
+			accountState.Balances.credit(TokenId(id), Amount(id));
+
+		// Act + Assert:
+		AssertRoundtrip(accountState);
+	}
+
+	TEST(TEST_CLASS, CanRoundtripHighValueAccountState) {
+		AssertRoundtrip(CreateHighValueAccountState(10));
+	}
+
+	TEST(TEST_CLASS, CanRoundtripAccountStateWithSupplementalPublicKeys) {
+		for (auto mask : { AccountPublicKeys::KeyType::Linked, AccountPublicKeys::KeyType::Node | AccountPublicKeys::KeyType::VRF }) {
+			// Arrange:
+			auto accountState = CreateAccountState();
+			test::SetRandomSupplementalPublicKeys(accountState, mask, 3);
+
+			// Act + Assert:
+			AssertRoundtrip(accountState);
+		}
+	}
+
+	TEST(TEST_CLASS, CanRoundtripAccountStateWithEmptySnapshotsAndBucketsBetweenNonEmptyOnes) {
+		// Arrange:
+		auto accountState = CreateAccountState();
+		accountState.ImportanceSnapshots.set(Importance(111), model::ImportanceHeight(100));
+		accountState.ImportanceSnapshots.push();
+		accountState.ImportanceSnapshots.set(Importance(222), model::ImportanceHeight(300));
+
+		accountState.ActivityBuckets.update(model::ImportanceHeight(100), [](auto& bucket) { bucket.RawScore = 5; });
+		accountState.ActivityBuckets.push();
+		accountState.ActivityBuckets.update(model::ImportanceHeight(300), [](auto& bucket) { bucket.RawScore = 6; });
+
+		// Act + Assert:
+		AssertRoundtrip(accountState);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,314 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/thread/ComputeThreadPool.h"
+#include "bitxorcore/thread/IoThreadPool.h"
+#include "bitxorcore/thread/ThreadInfo.h"
+#include "tests/test/nodeps/Waits.h"
+#include "tests/TestHarness.h"
+#include <set>
+#include <thread>
+
+namespace bitxorcore { namespace thread {
+
+#define TEST_CLASS ComputeThreadPoolTests
+
+	namespace {
+		const uint32_t Num_Default_Threads = test::GetNumDefaultPoolThreads();
+
+		auto CreateDefaultComputeThreadPool() {
+			return CreateComputeThreadPool({ Num_Default_Threads, {} });
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateThreadPoolWithDefaultName) {
+		// Act: set up a pool with a default name
+		auto pPool = CreateDefaultComputeThreadPool();
+
+		// Assert:
+		EXPECT_EQ("", pPool->name());
+	}
+
+	TEST(TEST_CLASS, CanCreateThreadPoolWithCustomName) {
+		// Act: set up a pool with a custom name
+		auto pPool = CreateComputeThreadPool({ Num_Default_Threads, {} }, "Crazy Amazing");
+
+		// Assert:
+		EXPECT_EQ("Crazy Amazing", pPool->name());
+	}
+
+	TEST(TEST_CLASS, CannotCreateThreadPoolWithoutWorkerThreads) {
+		// Act + Assert:
+		EXPECT_THROW(CreateComputeThreadPool({ 0, {} }), bitxorcore_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, ConstructorDoesNotCreateAnyThreads) {
+		// Act: set up a pool
+		auto pPool = CreateDefaultComputeThreadPool();
+
+		// Assert:
+		EXPECT_EQ(0u, pPool->numWorkerThreads());
+	}
+
+	// endregion
+
+	// region start / join
+
+	TEST(TEST_CLASS, StartSpawnsSpecifiedNumberOfWorkerThreads) {
+		// Act: set up a pool
+		auto pPool = CreateDefaultComputeThreadPool();
+		pPool->start();
+
+		// Assert: all threads have been spawned
+		EXPECT_EQ(Num_Default_Threads, pPool->numWorkerThreads());
+	}
+
+	TEST(TEST_CLASS, JoinDestroysAllWorkerThreads) {
+		// Arrange: set up a pool
+		auto pPool = CreateDefaultComputeThreadPool();
+		pPool->start();
+
+		// Act: stop the pool
+		pPool->join();
+
+		// Assert: all threads have been stopped
+		EXPECT_EQ(0u, pPool->numWorkerThreads());
+	}
+
+	TEST(TEST_CLASS, JoinIsIdempotent) {
+		// Arrange: set up a pool
+		auto pPool = CreateDefaultComputeThreadPool();
+		pPool->start();
+
+		// Act: stop the pool
+		for (auto i = 0; i < 3; ++i)
+			pPool->join();
+
+		// Assert: all threads have been stopped
+		EXPECT_EQ(0u, pPool->numWorkerThreads());
+	}
+
+	TEST(TEST_CLASS, PoolCanBeRestarted) {
+		// Arrange: set up a pool
+		auto pPool = CreateDefaultComputeThreadPool();
+		pPool->start();
+
+		// Act: restart the pool
+		pPool->join();
+		pPool->start();
+
+		// Assert: all threads have been spawned
+		EXPECT_EQ(Num_Default_Threads, pPool->numWorkerThreads());
+	}
+
+	TEST(TEST_CLASS, PoolCannotBeRestartedWhenRunning) {
+		// Arrange: set up a pool
+		auto pPool = CreateDefaultComputeThreadPool();
+		pPool->start();
+
+		// Act + Assert: restart the pool
+		EXPECT_THROW(pPool->start(), bitxorcore_runtime_error);
+	}
+
+	TEST(TEST_CLASS, JoinCompletesAllPostedWork) {
+		// Arrange: set up a pool
+		auto pPool = CreateDefaultComputeThreadPool();
+		pPool->start();
+
+		// - post 100 work items on the pool
+		std::atomic<uint32_t> numHandlerCalls(0);
+		for (auto i = 0u; i < 100; ++i)
+			pPool->post([&numHandlerCalls]() { ++numHandlerCalls; });
+
+		// Act: stop the pool
+		pPool->join();
+
+		// Assert: the pool should have executed 100 work items
+		EXPECT_EQ(100u, numHandlerCalls);
+	}
+
+	TEST(TEST_CLASS, WorkPostedBeforeStartIsExecutedAfterStart) {
+		// Arrange: set up a pool and post work before starting it
+		auto pPool = CreateDefaultComputeThreadPool();
+		std::atomic<uint32_t> numHandlerCalls(0);
+		for (auto i = 0u; i < 10; ++i)
+			pPool->post([&numHandlerCalls]() { ++numHandlerCalls; });
+
+		// Sanity:
+		EXPECT_EQ(0u, numHandlerCalls);
+
+		// Act:
+		pPool->start();
+		pPool->join();
+
+		// Assert:
+		EXPECT_EQ(10u, numHandlerCalls);
+	}
+
+	// endregion
+
+	// region post
+
+	TEST(TEST_CLASS, WorkIsDistributedAcrossWorkerThreads) {
+		// Arrange: set up a pool
+		auto pPool = CreateDefaultComputeThreadPool();
+		pPool->start();
+
+		// Act: post one blocking work item per worker thread
+		std::atomic<uint32_t> numHandlerCalls(0);
+		std::mutex mutex;
+		std::set<std::thread::id> threadIds;
+		for (auto i = 0u; i < Num_Default_Threads; ++i) {
+			pPool->post([&numHandlerCalls, &mutex, &threadIds]() {
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					threadIds.insert(std::this_thread::get_id());
+				}
+
+				++numHandlerCalls;
+				WAIT_FOR_VALUE(Num_Default_Threads, numHandlerCalls);
+			});
+		}
+
+		pPool->join();
+
+		// Assert: every work item was executed by a different worker thread
+		EXPECT_EQ(Num_Default_Threads, numHandlerCalls);
+		EXPECT_EQ(Num_Default_Threads, threadIds.size());
+	}
+
+	TEST(TEST_CLASS, IdleWorkerThreadsStealWorkPostedByBlockedWorkerThread) {
+		// Arrange: set up a pool
+		auto pPool = CreateDefaultComputeThreadPool();
+		pPool->start();
+
+		// Act: post work from a worker thread (which is queued locally) and block that worker until the work completes
+		std::atomic<uint32_t> numChildHandlerCalls(0);
+		std::atomic<std::thread::id> parentThreadId;
+		std::atomic<uint32_t> numChildHandlerCallsOnParentThread(0);
+		pPool->post([&pPool, &numChildHandlerCalls, &parentThreadId, &numChildHandlerCallsOnParentThread]() {
+			parentThreadId = std::this_thread::get_id();
+			for (auto i = 0u; i < 10; ++i) {
+				pPool->post([&numChildHandlerCalls, &parentThreadId, &numChildHandlerCallsOnParentThread]() {
+					if (parentThreadId.load() == std::this_thread::get_id())
+						++numChildHandlerCallsOnParentThread;
+
+					++numChildHandlerCalls;
+				});
+			}
+
+			WAIT_FOR_VALUE(10u, numChildHandlerCalls);
+		});
+
+		pPool->join();
+
+		// Assert: all child work was stolen by other worker threads
+		EXPECT_EQ(10u, numChildHandlerCalls);
+		EXPECT_EQ(0u, numChildHandlerCallsOnParentThread);
+	}
+
+	TEST(TEST_CLASS, WorkerThreadsAreNamed) {
+		// Arrange: set up a pool
+		auto pPool = CreateComputeThreadPool({ 1, {} }, "foo");
+		pPool->start();
+
+		// Act:
+		std::string threadName;
+		pPool->post([&threadName]() { threadName = GetThreadName(); });
+		pPool->join();
+
+		// Assert:
+		EXPECT_EQ(std::string("0 (foo) compute").substr(0, GetMaxThreadNameLength()), threadName);
+	}
+
+	TEST(TEST_CLASS, PoolCanBeStartedWhenCpuAffinityCannotBeSet) {
+		// Arrange: set up a pool with an unknown cpu
+		auto pPool = CreateComputeThreadPool({ 2, { 1'000'000 } });
+
+		// Act:
+		pPool->start();
+		std::atomic<uint32_t> numHandlerCalls(0);
+		pPool->post([&numHandlerCalls]() { ++numHandlerCalls; });
+		pPool->join();
+
+		// Assert: the pool is usable
+		EXPECT_EQ(1u, numHandlerCalls);
+	}
+
+	// endregion
+
+	// region merged
+
+	TEST(TEST_CLASS, MergedPoolForwardsPropertiesOfIoPool) {
+		// Arrange:
+		auto pIoPool = CreateIoThreadPool(Num_Default_Threads, "Crazy Amazing");
+		pIoPool->start();
+
+		// Act:
+		auto pPool = CreateMergedComputeThreadPool(*pIoPool);
+
+		// Assert:
+		EXPECT_EQ(Num_Default_Threads, pPool->numWorkerThreads());
+		EXPECT_EQ("Crazy Amazing", pPool->name());
+
+		pIoPool->join();
+	}
+
+	TEST(TEST_CLASS, MergedPoolExecutesWorkOnIoPool) {
+		// Arrange:
+		auto pIoPool = CreateIoThreadPool(Num_Default_Threads);
+		pIoPool->start();
+		auto pPool = CreateMergedComputeThreadPool(*pIoPool);
+
+		// - post 100 work items on the merged pool
+		std::atomic<uint32_t> numHandlerCalls(0);
+		for (auto i = 0u; i < 100; ++i)
+			pPool->post([&numHandlerCalls]() { ++numHandlerCalls; });
+
+		// Act: stop the io pool
+		pPool->join();
+		pIoPool->join();
+
+		// Assert: the io pool should have executed 100 work items
+		EXPECT_EQ(100u, numHandlerCalls);
+	}
+
+	TEST(TEST_CLASS, MergedPoolIsDetachedFromIoPoolByJoin) {
+		// Arrange:
+		auto pIoPool = CreateIoThreadPool(Num_Default_Threads);
+		pIoPool->start();
+		auto pPool = CreateMergedComputeThreadPool(*pIoPool);
+
+		// Act:
+		pPool->join();
+
+		// Assert:
+		EXPECT_EQ(0u, pPool->numWorkerThreads());
+		EXPECT_THROW(pPool->post([]() {}), bitxorcore_runtime_error);
+
+		pIoPool->join();
+	}
+
+	// endregion
+}}
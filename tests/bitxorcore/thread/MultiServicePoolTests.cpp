@@ -265,6 +265,95 @@ namespace bitxorcore { namespace thread {
 
 	// endregion
 
+	// region pushComputePool
+
+	namespace {
+		void AssertCanAddSingleComputePool(
+				MultiServicePool::IsolatedPoolMode isolatedPoolMode,
+				size_t numWorkerThreads,
+				size_t expectedNumWorkerThreads) {
+			// Arrange:
+			MultiServicePool pool("foo", 3, isolatedPoolMode);
+
+			// Act:
+			auto pComputePool = pool.pushComputePool("pool", { numWorkerThreads, {} });
+
+			// Assert:
+			EXPECT_EQ(3u + expectedNumWorkerThreads, pool.numWorkerThreads());
+			EXPECT_EQ(0u, pool.numServiceGroups());
+			EXPECT_EQ(1u, pool.numServices());
+
+			EXPECT_EQ(expectedNumWorkerThreads, pComputePool->numWorkerThreads());
+			EXPECT_EQ("pool", pComputePool->name());
+		}
+	}
+
+	TEST(TEST_CLASS, CanAddSingleComputePoolWithCustomNumberOfThreads) {
+		AssertCanAddSingleComputePool(MultiServicePool::IsolatedPoolMode::Enabled, 2, 2);
+	}
+
+	TEST(TEST_CLASS, CanAddSingleComputePoolWithDefaultNumberOfThreads) {
+		AssertCanAddSingleComputePool(
+				MultiServicePool::IsolatedPoolMode::Enabled,
+				MultiServicePool::DefaultPoolConcurrency(),
+				std::thread::hardware_concurrency());
+	}
+
+	TEST(TEST_CLASS, CanAddSingleMergedComputePoolWhenIsolatedPoolModeIsDisabled) {
+		// Arrange:
+		MultiServicePool pool("foo", 3, MultiServicePool::IsolatedPoolMode::Disabled);
+
+		// Act:
+		auto pComputePool = pool.pushComputePool("pool", { 2, {} });
+
+		// Assert: no new threads were spawned
+		EXPECT_EQ(3u, pool.numWorkerThreads());
+		EXPECT_EQ(0u, pool.numServiceGroups());
+		EXPECT_EQ(1u, pool.numServices());
+
+		// - the returned pool is backed by the main pool
+		EXPECT_EQ(3u, pComputePool->numWorkerThreads());
+		EXPECT_EQ("foo", pComputePool->name());
+	}
+
+	TEST(TEST_CLASS, MergedComputePoolExecutesWorkOnMainPool) {
+		// Arrange:
+		MultiServicePool pool("foo", 3, MultiServicePool::IsolatedPoolMode::Disabled);
+		auto pComputePool = pool.pushComputePool("pool", { 2, {} });
+
+		std::atomic<uint32_t> numHandlerCalls(0);
+		for (auto i = 0u; i < 10; ++i)
+			pComputePool->post([&numHandlerCalls]() { ++numHandlerCalls; });
+
+		// Act:
+		pool.shutdown();
+
+		// Assert: all posted work completed and the merged pool was detached from the main pool
+		EXPECT_EQ(10u, numHandlerCalls);
+		EXPECT_EQ(0u, pComputePool->numWorkerThreads());
+		EXPECT_EQ(0u, pool.numWorkerThreads());
+	}
+
+	TEST(TEST_CLASS, ShutdownJoinsComputePool) {
+		// Arrange:
+		MultiServicePool pool("foo", 3);
+		auto pComputePool = pool.pushComputePool("pool", { 2, {} });
+
+		std::atomic<uint32_t> numHandlerCalls(0);
+		for (auto i = 0u; i < 10; ++i)
+			pComputePool->post([&numHandlerCalls]() { ++numHandlerCalls; });
+
+		// Act:
+		pool.shutdown();
+
+		// Assert: all posted work completed and the compute pool threads were stopped
+		EXPECT_EQ(10u, numHandlerCalls);
+		EXPECT_EQ(0u, pComputePool->numWorkerThreads());
+		EXPECT_EQ(0u, pool.numWorkerThreads());
+	}
+
+	// endregion
+
 	// region pushServiceGroup / pushIsolatedPool
 
 	TEST(TEST_CLASS, CanAddMultipleServices) {
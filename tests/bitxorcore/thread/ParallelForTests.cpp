@@ -427,4 +427,184 @@ namespace bitxorcore { namespace thread {
 	}
 
 	// endregion
+
+	// region ParallelFor[Partition] compute pool
+
+	namespace {
+		template<typename TContainer>
+		struct ComputeTestContext {
+		public:
+			explicit ComputeTestContext(size_t numItemsAdjustment = 0)
+					: pPool(test::CreateStartedComputeThreadPool())
+					, NumThreads(pPool->numWorkerThreads())
+					, NumItems(NumThreads * 5 + numItemsAdjustment)
+					, ItemsSum((NumItems * (NumItems + 1)) / 2) {
+				auto seedItems = CreateIncrementingValues(NumItems);
+				std::copy(seedItems.cbegin(), seedItems.cend(), std::back_inserter(Items));
+			}
+
+		public:
+			size_t maxChunks() const {
+				return NumThreads * Compute_Chunks_Per_Worker;
+			}
+
+		public:
+			std::unique_ptr<thread::ComputeThreadPool> pPool;
+			size_t NumThreads;
+			size_t NumItems;
+			size_t ItemsSum;
+			TContainer Items;
+		};
+	}
+
+	CONTAINER_TEST(CanProcessMultipleChunksConcurrently_Compute_ZeroItems) {
+		// Arrange:
+		ComputeTestContext<typename TTraits::ContainerType> context;
+		auto items = typename TTraits::ContainerType();
+
+		// Act:
+		std::atomic<size_t> counter(0);
+		ParallelForPartition(*context.pPool, items, [&counter](auto, auto, auto, auto) {
+			++counter;
+		}).get();
+
+		// Assert: the partition callback was not called
+		EXPECT_EQ(0u, counter);
+	}
+
+	CONTAINER_TEST(CanProcessMultipleChunksConcurrently_Compute_OneItem) {
+		// Arrange:
+		ComputeTestContext<typename TTraits::ContainerType> context;
+		auto items = typename TTraits::ContainerType{ 7 };
+
+		// Act:
+		PartitionAggregateCapture capture(1, 1);
+		ParallelForPartition(*context.pPool, items, CreatePartitionAggregate(capture)).get();
+
+		// Assert: the callback was only called once (since there is only one item and one chunk)
+		EXPECT_EQ(7u, capture.Sum);
+		EXPECT_EQ(std::vector<uint8_t>(1, 1), capture.IndexFlags);
+		EXPECT_EQ(std::vector<uint8_t>(1, 1), capture.BatchIndexFlags);
+	}
+
+	namespace {
+		template<typename TTraits>
+		void AssertCanProcessMultipleChunksConcurrently(int numItemsAdjustment) {
+			// Arrange:
+			ComputeTestContext<typename TTraits::ContainerType> context(static_cast<size_t>(numItemsAdjustment));
+			auto chunkSize = (context.NumItems + context.maxChunks() - 1) / context.maxChunks();
+			auto numExpectedChunks = (context.NumItems + chunkSize - 1) / chunkSize;
+
+			// Act:
+			PartitionAggregateCapture capture(context.Items.size(), context.maxChunks());
+			ParallelForPartition(*context.pPool, context.Items, CreatePartitionAggregate(capture)).get();
+
+			// Assert: each chunk was processed once
+			EXPECT_EQ(context.ItemsSum, capture.Sum);
+			EXPECT_EQ(std::vector<uint8_t>(context.Items.size(), 1), capture.IndexFlags);
+
+			auto expectedBatchIndexFlags = std::vector<uint8_t>(context.maxChunks(), 0);
+			std::fill(expectedBatchIndexFlags.begin(), expectedBatchIndexFlags.begin() + static_cast<int>(numExpectedChunks), 1);
+			EXPECT_EQ(expectedBatchIndexFlags, capture.BatchIndexFlags);
+		}
+	}
+
+	CONTAINER_TEST(CanProcessMultipleChunksConcurrently_Compute_MinusOne) {
+		AssertCanProcessMultipleChunksConcurrently<TTraits>(-1);
+	}
+
+	CONTAINER_TEST(CanProcessMultipleChunksConcurrently_Compute) {
+		AssertCanProcessMultipleChunksConcurrently<TTraits>(0);
+	}
+
+	CONTAINER_TEST(CanProcessMultipleChunksConcurrently_Compute_PlusOne) {
+		AssertCanProcessMultipleChunksConcurrently<TTraits>(1);
+	}
+
+	CONTAINER_TEST(CanProcessMultipleItemsConcurrently_Compute) {
+		// Arrange:
+		ComputeTestContext<typename TTraits::ContainerType> context;
+
+		// Act:
+		std::atomic<size_t> sum(0);
+		std::vector<uint8_t> indexFlags(context.NumItems, 0);
+		ParallelFor(*context.pPool, context.Items, CreateItemAggregate(sum, indexFlags)).get();
+
+		// Assert:
+		EXPECT_EQ(context.ItemsSum, sum);
+		EXPECT_EQ(std::vector<uint8_t>(context.NumItems, 1), indexFlags);
+	}
+
+	CONTAINER_TEST(CanModifyMultipleItemsConcurrently_Compute) {
+		// Arrange:
+		ComputeTestContext<typename TTraits::ContainerType> context;
+
+		// Act:
+		ParallelFor(*context.pPool, context.Items, [](auto& value, auto) {
+			value = value * value + 1;
+			return true;
+		}).get();
+
+		// Assert: all values should have been modified
+		auto i = 1u;
+		for (auto value : context.Items) {
+			EXPECT_EQ(i * i + 1u, value) << "item at " << i;
+			++i;
+		}
+	}
+
+	CONTAINER_TEST(CorrectIndexesAreAssociatedWithItems_Compute) {
+		// Arrange:
+		ComputeTestContext<typename TTraits::ContainerType> context;
+
+		// Act: capture all values by their index
+		std::vector<uint32_t> capturedValues(context.NumItems, 0);
+		ParallelFor(*context.pPool, context.Items, [&capturedValues](auto value, auto index) {
+			// Sanity: fail if any index is too large
+			EXPECT_GT(capturedValues.size(), index) << "unexpected index " << index;
+			if (capturedValues.size() <= index)
+				return false;
+
+			capturedValues[index] = value;
+			return true;
+		}).get();
+
+		// Assert: values start at 1
+		for (auto i = 0u; i < capturedValues.size(); ++i)
+			EXPECT_EQ(i + 1, capturedValues[i]) << "i " << i;
+	}
+
+	TEST(TEST_CLASS, SlowChunkDoesNotDelayRemainingChunks_Compute) {
+		// Arrange:
+		auto pPool = test::CreateStartedComputeThreadPool(2);
+		auto items = CreateIncrementingValues(2 * Compute_Chunks_Per_Worker * 10);
+
+		// Act: block the first chunk until all other items have been processed
+		std::atomic<size_t> numItemsProcessed(0);
+		std::atomic<size_t> numSlowThreadChunks(0);
+		std::atomic<std::thread::id> slowThreadId;
+		auto numTotalItems = items.size();
+		ParallelForPartition(*pPool, items, [numTotalItems, &numItemsProcessed, &numSlowThreadChunks, &slowThreadId](
+				auto itBegin,
+				auto itEnd,
+				auto,
+				auto chunkIndex) {
+			auto numItems = static_cast<size_t>(std::distance(itBegin, itEnd));
+			if (0 == chunkIndex) {
+				slowThreadId = std::this_thread::get_id();
+				WAIT_FOR_VALUE_EXPR(numTotalItems - numItems, numItemsProcessed.load());
+			}
+
+			if (slowThreadId.load() == std::this_thread::get_id())
+				++numSlowThreadChunks;
+
+			numItemsProcessed += numItems;
+		}).get();
+
+		// Assert: all items were processed and the other worker claimed all chunks while the slow chunk was blocked
+		EXPECT_EQ(numTotalItems, numItemsProcessed);
+		EXPECT_EQ(1u, numSlowThreadChunks);
+	}
+
+	// endregion
 }}
@@ -53,4 +53,16 @@ namespace bitxorcore { namespace thread {
 		// Assert: the long thread name is truncated
 		EXPECT_EQ(std::string(GetMaxThreadNameLength(), 'a'), threadName);
 	}
+
+	TEST(TEST_CLASS, CannotSetThreadAffinityToUnknownCpu) {
+		// Arrange:
+		auto result = true;
+		std::thread([&result] {
+			// Act:
+			result = SetThreadAffinity(1'000'000);
+		}).join();
+
+		// Assert:
+		EXPECT_FALSE(result);
+	}
 }}
@@ -162,6 +162,32 @@ namespace bitxorcore { namespace tree {
 		EXPECT_NE(nodePathLeaf.value(), result.first);
 	}
 
+	TEST(TEST_CLASS, LookupAllForwardsToUnderlyingTree) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryBasePatriciaTree tree(dataSource);
+		SeedTreeWithFourNodes(tree);
+
+		// Act:
+		std::vector<TreeNode> nodes;
+		auto results = tree.lookupAll({ 0x64'6F'67'65, 0x64'6F'67'64 }, nodes);
+
+		// Assert:
+		ASSERT_EQ(2u, results.size());
+		EXPECT_TRUE(results[0].second);
+		EXPECT_NE(Hash256(), results[0].first);
+		EXPECT_FALSE(results[1].second);
+		EXPECT_EQ(Hash256(), results[1].first);
+
+		// - both keys share the same path, which ends at leaf `0x64'6F'67'65`
+		ASSERT_EQ(4u, nodes.size());
+		EXPECT_TRUE(nodes.back().isLeaf());
+
+		const auto& nodesLeaf = nodes.back().asLeafNode();
+		EXPECT_EQ(TreeNodePath(0x64'6F'67'65).subpath(7), nodesLeaf.path());
+		EXPECT_EQ(nodesLeaf.value(), results[0].first);
+	}
+
 	// endregion
 
 	// region loading
@@ -0,0 +1,167 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/utils/EpochSnapshot.h"
+#include "bitxorcore/thread/ThreadGroup.h"
+#include "tests/test/nodeps/LockTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace bitxorcore { namespace utils {
+
+#define TEST_CLASS EpochSnapshotTests
+
+	// region basic
+
+	TEST(TEST_CLASS, CanCreateSnapshotWithDefaultValue) {
+		// Act:
+		EpochSnapshot<uint32_t> snapshot;
+
+		// Assert:
+		EXPECT_EQ(0u, snapshot.get());
+		EXPECT_EQ(0u, *snapshot.read());
+	}
+
+	TEST(TEST_CLASS, CanCreateSnapshotWithCustomValue) {
+		// Act:
+		EpochSnapshot<std::string> snapshot("alpha");
+
+		// Assert:
+		EXPECT_EQ("alpha", snapshot.get());
+		EXPECT_EQ(5u, snapshot.read()->size());
+	}
+
+	TEST(TEST_CLASS, CanPublishNewValue) {
+		// Arrange:
+		EpochSnapshot<std::string> snapshot("alpha");
+
+		// Act:
+		snapshot.publish("beta");
+
+		// Assert:
+		EXPECT_EQ("beta", snapshot.get());
+	}
+
+	TEST(TEST_CLASS, CanPublishNewValueAfterReaderIsMoved) {
+		// Arrange:
+		EpochSnapshot<std::string> snapshot("alpha");
+		{
+			auto readGuard = snapshot.read();
+			auto readGuard2 = std::move(readGuard);
+
+			// Sanity:
+			EXPECT_EQ("alpha", *readGuard2);
+		}
+
+		// Act:
+		snapshot.publish("beta");
+
+		// Assert:
+		EXPECT_EQ("beta", snapshot.get());
+	}
+
+	TEST(TEST_CLASS, MultipleReadersCanBeActiveOnSameThread) {
+		// Arrange:
+		EpochSnapshot<std::string> snapshot("alpha");
+
+		// Act:
+		auto readGuard1 = snapshot.read();
+		auto readGuard2 = snapshot.read();
+
+		// Assert:
+		EXPECT_EQ("alpha", *readGuard1);
+		EXPECT_EQ("alpha", *readGuard2);
+		EXPECT_EQ(&*readGuard1, &*readGuard2);
+	}
+
+	// endregion
+
+	// region reader / publisher semantics
+
+	TEST(TEST_CLASS, ReaderKeepsSnapshotAliveAndBlocksPublisher) {
+		// Arrange:
+		EpochSnapshot<std::string> snapshot("alpha");
+		std::atomic_bool isPublished(false);
+		thread::ThreadGroup threads;
+
+		// Act: acquire a reader and then publish from another thread
+		{
+			auto readGuard = snapshot.read();
+			threads.spawn([&snapshot, &isPublished] {
+				snapshot.publish("beta");
+				isPublished = true;
+			});
+
+			// - wait for the publisher to swap the snapshot (new readers see the new value)
+			WAIT_FOR_EXPR("beta" == snapshot.get());
+			test::Pause();
+
+			// Assert: the publisher is blocked and the reader still sees the old value
+			EXPECT_FALSE(isPublished);
+			EXPECT_EQ("alpha", *readGuard);
+		}
+
+		threads.join();
+
+		// Assert: the publisher completed after the reader was released
+		EXPECT_TRUE(isPublished);
+		EXPECT_EQ("beta", snapshot.get());
+	}
+
+	TEST(TEST_CLASS, ReadersAlwaysObserveConsistentSnapshots) {
+		// Arrange: snapshot value is a pair of identical values
+		using ValuePair = std::pair<std::string, std::string>;
+		EpochSnapshot<ValuePair> snapshot(ValuePair("0", "0"));
+		std::atomic_bool isDone(false);
+		std::atomic<uint32_t> numMismatches(0);
+		std::atomic<uint64_t> numReads(0);
+		thread::ThreadGroup threads;
+
+		// Act: spawn readers that check the values while a single publisher updates them
+		for (auto i = 0u; i < test::Num_Default_Lock_Threads; ++i) {
+			threads.spawn([&snapshot, &isDone, &numMismatches, &numReads] {
+				while (!isDone) {
+					auto readGuard = snapshot.read();
+					if (readGuard->first != readGuard->second)
+						++numMismatches;
+
+					++numReads;
+					std::this_thread::yield();
+				}
+			});
+		}
+
+		for (auto i = 1u; i <= 1000; ++i) {
+			auto value = std::to_string(i);
+			snapshot.publish(ValuePair(value, value));
+		}
+
+		isDone = true;
+		threads.join();
+
+		// Assert:
+		EXPECT_EQ(0u, numMismatches);
+		EXPECT_LT(0u, numReads);
+		EXPECT_EQ(ValuePair("1000", "1000"), snapshot.get());
+	}
+
+	// endregion
+}}
@@ -0,0 +1,120 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/utils/LatencyHistogram.h"
+#include "bitxorcore/thread/ThreadGroup.h"
+#include "tests/test/nodeps/LockTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace bitxorcore { namespace utils {
+
+#define TEST_CLASS LatencyHistogramTests
+
+	namespace {
+		std::vector<uint64_t> CreateBucketCounts(const std::vector<std::pair<size_t, uint64_t>>& indexCountPairs) {
+			std::vector<uint64_t> bucketCounts(LatencyHistogram::Num_Buckets, 0);
+			for (const auto& pair : indexCountPairs)
+				bucketCounts[pair.first] = pair.second;
+
+			return bucketCounts;
+		}
+	}
+
+	TEST(TEST_CLASS, BucketUpperBoundsAreExponential) {
+		// Assert:
+		EXPECT_EQ(1u, LatencyHistogram::BucketUpperBound(0));
+		EXPECT_EQ(4u, LatencyHistogram::BucketUpperBound(1));
+		EXPECT_EQ(16u, LatencyHistogram::BucketUpperBound(2));
+		EXPECT_EQ(1024u, LatencyHistogram::BucketUpperBound(5));
+		EXPECT_EQ(16'777'216u, LatencyHistogram::BucketUpperBound(LatencyHistogram::Num_Bounded_Buckets - 1));
+	}
+
+	TEST(TEST_CLASS, CanCreateEmptyHistogram) {
+		// Act:
+		LatencyHistogram histogram;
+		auto snapshot = histogram.snapshot();
+
+		// Assert:
+		EXPECT_EQ(CreateBucketCounts({}), snapshot.BucketCounts);
+		EXPECT_EQ(0u, snapshot.Count);
+		EXPECT_EQ(0u, snapshot.SumMicros);
+	}
+
+	TEST(TEST_CLASS, CanRecordSamplesInBoundedBuckets) {
+		// Arrange:
+		LatencyHistogram histogram;
+
+		// Act:
+		for (auto micros : { 0u, 1u, 2u, 4u, 5u, 16u, 1000u, 1024u, 1025u })
+			histogram.record(micros);
+
+		auto snapshot = histogram.snapshot();
+
+		// Assert:
+		EXPECT_EQ(CreateBucketCounts({ { 0, 2 }, { 1, 2 }, { 2, 2 }, { 5, 2 }, { 6, 1 } }), snapshot.BucketCounts);
+		EXPECT_EQ(9u, snapshot.Count);
+		EXPECT_EQ(3077u, snapshot.SumMicros);
+	}
+
+	TEST(TEST_CLASS, CanRecordSamplesInUnboundedBucket) {
+		// Arrange:
+		LatencyHistogram histogram;
+		auto maxBound = LatencyHistogram::BucketUpperBound(LatencyHistogram::Num_Bounded_Buckets - 1);
+
+		// Act:
+		histogram.record(maxBound);
+		histogram.record(maxBound + 1);
+		histogram.record(maxBound * 10);
+
+		auto snapshot = histogram.snapshot();
+
+		// Assert:
+		auto numBoundedBuckets = LatencyHistogram::Num_Bounded_Buckets;
+		EXPECT_EQ(CreateBucketCounts({ { numBoundedBuckets - 1, 1 }, { numBoundedBuckets, 2 } }), snapshot.BucketCounts);
+		EXPECT_EQ(3u, snapshot.Count);
+		EXPECT_EQ(maxBound * 12 + 1, snapshot.SumMicros);
+	}
+
+	TEST(TEST_CLASS, CanRecordSamplesConcurrently) {
+		// Arrange:
+		constexpr auto Num_Samples_Per_Thread = 1000u;
+		LatencyHistogram histogram;
+
+		// Act:
+		thread::ThreadGroup threads;
+		for (auto i = 0u; i < test::Num_Default_Lock_Threads; ++i) {
+			threads.spawn([&histogram]() {
+				for (auto j = 0u; j < Num_Samples_Per_Thread; ++j)
+					histogram.record(j % 2 ? 3 : 20);
+			});
+		}
+
+		threads.join();
+		auto snapshot = histogram.snapshot();
+
+		// Assert:
+		auto numSamples = test::Num_Default_Lock_Threads * Num_Samples_Per_Thread;
+		EXPECT_EQ(CreateBucketCounts({ { 1, numSamples / 2 }, { 3, numSamples / 2 } }), snapshot.BucketCounts);
+		EXPECT_EQ(numSamples, snapshot.Count);
+		EXPECT_EQ(numSamples / 2 * 23, snapshot.SumMicros);
+	}
+}}
@@ -56,6 +56,20 @@ namespace bitxorcore { namespace utils {
 		EXPECT_LE(elapsedMillis1, elapsedMillis2);
 	}
 
+	TEST(TEST_CLASS, ElapsedMicrosIsConsistentWithElapsedMillis) {
+		// Arrange:
+		StackTimer stackTimer;
+
+		// Act:
+		test::Sleep(5);
+		auto elapsedMillis = stackTimer.millis();
+		auto elapsedMicros = stackTimer.micros();
+
+		// Assert:
+		EXPECT_LE(5'000u, elapsedMicros);
+		EXPECT_LE(elapsedMillis * 1'000, elapsedMicros);
+	}
+
 	namespace {
 		constexpr auto Sleep_Millis = 5u;
 		constexpr auto Epsilon_Millis = 1u;
@@ -0,0 +1,539 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "bitxorcore/utils/TraceRecorder.h"
+#include "bitxorcore/thread/ThreadGroup.h"
+#include "tests/test/nodeps/Waits.h"
+#include "tests/TestHarness.h"
+#include <sstream>
+
+namespace bitxorcore { namespace utils {
+
+#define TEST_CLASS TraceRecorderTests
+
+	namespace {
+		constexpr auto Test_Category = "test";
+
+		supplier<std::string> CreateThreadNameSupplier(const std::string& name) {
+			return [name]() { return name; };
+		}
+
+		TraceEvent CreateEvent(const char* name, uint64_t startMicros, uint64_t durationMicros) {
+			return TraceEvent{ Test_Category, name, startMicros, durationMicros, Height(), ShortHash(), 0 };
+		}
+
+		std::vector<std::string> GetNames(const std::vector<TraceEvent>& events) {
+			std::vector<std::string> names;
+			for (const auto& event : events)
+				names.push_back(event.Name);
+
+			return names;
+		}
+
+		void AssertEvent(const TraceEvent& expected, uint32_t expectedThreadId, const TraceEvent& actual) {
+			EXPECT_EQ(std::string(expected.Category), actual.Category);
+			EXPECT_EQ(std::string(expected.Name), actual.Name);
+			EXPECT_EQ(expected.StartMicros, actual.StartMicros);
+			EXPECT_EQ(expected.DurationMicros, actual.DurationMicros);
+			EXPECT_EQ(expected.Height, actual.Height);
+			EXPECT_EQ(expected.Hash, actual.Hash);
+			EXPECT_EQ(expectedThreadId, actual.ThreadId);
+		}
+	}
+
+	// region constructor / nowMicros
+
+	TEST(TEST_CLASS, CannotCreateRecorderRetainingNoEvents) {
+		EXPECT_THROW(TraceRecorder(0, CreateThreadNameSupplier("alpha")), bitxorcore_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanCreateRecorder) {
+		// Act:
+		TraceRecorder recorder(10, CreateThreadNameSupplier("alpha"));
+		auto snapshot = recorder.snapshot();
+
+		// Assert:
+		EXPECT_TRUE(snapshot.Threads.empty());
+		EXPECT_TRUE(snapshot.Events.empty());
+	}
+
+	TEST(TEST_CLASS, NowMicrosIsRelativeToRecorderCreation) {
+		// Arrange:
+		TraceRecorder recorder(10, CreateThreadNameSupplier("alpha"));
+		auto micros1 = recorder.nowMicros();
+
+		// Act:
+		test::Sleep(5);
+		auto micros2 = recorder.nowMicros();
+
+		// Assert:
+		EXPECT_GT(1'000'000u, micros1);
+		EXPECT_LE(micros1 + 5'000, micros2);
+	}
+
+	// endregion
+
+	// region record / snapshot
+
+	TEST(TEST_CLASS, CanRecordSingleEvent) {
+		// Arrange:
+		TraceRecorder recorder(10, CreateThreadNameSupplier("alpha"));
+		auto event = TraceEvent{ "category", "name", 123, 456, Height(7), ShortHash(0x12345678), 999 };
+
+		// Act:
+		recorder.record(event);
+		auto snapshot = recorder.snapshot();
+
+		// Assert: the thread id of the event is replaced
+		ASSERT_EQ(1u, snapshot.Threads.size());
+		EXPECT_EQ(1u, snapshot.Threads[0].Id);
+		EXPECT_EQ("alpha", snapshot.Threads[0].Name);
+
+		ASSERT_EQ(1u, snapshot.Events.size());
+		AssertEvent(event, 1, snapshot.Events[0]);
+	}
+
+	TEST(TEST_CLASS, SnapshotEventsAreOrderedByStartTime) {
+		// Arrange:
+		TraceRecorder recorder(10, CreateThreadNameSupplier("alpha"));
+
+		// Act: spans are recorded when they complete, so outer spans are recorded after inner spans
+		recorder.record(CreateEvent("inner", 20, 10));
+		recorder.record(CreateEvent("outer", 10, 40));
+		recorder.record(CreateEvent("next", 60, 5));
+		auto snapshot = recorder.snapshot();
+
+		// Assert:
+		EXPECT_EQ(1u, snapshot.Threads.size());
+		EXPECT_EQ(std::vector<std::string>({ "outer", "inner", "next" }), GetNames(snapshot.Events));
+	}
+
+	TEST(TEST_CLASS, RecorderRetainsOnlyMostRecentEventsOfEachThread) {
+		// Arrange:
+		TraceRecorder recorder(3, CreateThreadNameSupplier("alpha"));
+
+		// Act:
+		for (const auto* name : { "a", "b", "c", "d", "e" })
+			recorder.record(CreateEvent(name, static_cast<uint64_t>(name[0]), 1));
+
+		auto snapshot = recorder.snapshot();
+
+		// Assert:
+		EXPECT_EQ(std::vector<std::string>({ "c", "d", "e" }), GetNames(snapshot.Events));
+	}
+
+	TEST(TEST_CLASS, CanRecordEventsFromMultipleThreads) {
+		// Arrange:
+		std::atomic<uint32_t> numThreadNames(0);
+		TraceRecorder recorder(3, [&numThreadNames]() { return "thread " + std::to_string(++numThreadNames); });
+
+		// Act: each thread records more events than are retained
+		thread::ThreadGroup threads;
+		for (auto i = 0u; i < 4; ++i) {
+			threads.spawn([&recorder, i]() {
+				for (auto j = 0u; j < 5; ++j)
+					recorder.record(CreateEvent("event", i * 100 + j, 1));
+			});
+		}
+
+		threads.join();
+		auto snapshot = recorder.snapshot();
+
+		// Assert: each thread has its own buffer
+		ASSERT_EQ(4u, snapshot.Threads.size());
+		std::set<std::string> threadNames;
+		for (auto i = 0u; i < snapshot.Threads.size(); ++i) {
+			EXPECT_EQ(i + 1, snapshot.Threads[i].Id);
+			threadNames.insert(snapshot.Threads[i].Name);
+		}
+
+		EXPECT_EQ(std::set<std::string>({ "thread 1", "thread 2", "thread 3", "thread 4" }), threadNames);
+
+		// - only the last three events of each thread are retained
+		ASSERT_EQ(12u, snapshot.Events.size());
+		std::map<uint32_t, std::vector<uint64_t>> threadIdToOffsets;
+		for (const auto& event : snapshot.Events)
+			threadIdToOffsets[event.ThreadId].push_back(event.StartMicros % 100);
+
+		EXPECT_EQ(4u, threadIdToOffsets.size());
+		for (const auto& pair : threadIdToOffsets)
+			EXPECT_EQ(std::vector<uint64_t>({ 2, 3, 4 }), pair.second) << "thread " << pair.first;
+	}
+
+	TEST(TEST_CLASS, SnapshotCanBeRestrictedToEventsOverlappingInterval) {
+		// Arrange:
+		TraceRecorder recorder(10, CreateThreadNameSupplier("alpha"));
+		recorder.record(CreateEvent("before", 10, 5)); // [10, 15]
+		recorder.record(CreateEvent("start", 15, 10)); // [15, 25]
+		recorder.record(CreateEvent("inside", 30, 10)); // [30, 40]
+		recorder.record(CreateEvent("around", 5, 100)); // [5, 105]
+		recorder.record(CreateEvent("end", 50, 10)); // [50, 60]
+		recorder.record(CreateEvent("after", 51, 10)); // [51, 61]
+
+		// Act:
+		auto snapshot = recorder.snapshot(20, 50);
+
+		// Assert: thread is included even though some of its events are filtered out
+		EXPECT_EQ(1u, snapshot.Threads.size());
+		EXPECT_EQ(std::vector<std::string>({ "around", "start", "inside", "end" }), GetNames(snapshot.Events));
+	}
+
+	TEST(TEST_CLASS, SnapshotNeverContainsPartiallyOverwrittenEvents) {
+		// Arrange:
+		TraceRecorder recorder(4, CreateThreadNameSupplier("alpha"));
+		std::atomic_bool isDone(false);
+
+		// Act: each event has identical start time, duration and height
+		thread::ThreadGroup threads;
+		threads.spawn([&recorder, &isDone]() {
+			for (auto i = 1u; i <= 50'000; ++i)
+				recorder.record(TraceEvent{ Test_Category, "event", i, i, Height(i), ShortHash(i), 0 });
+
+			isDone = true;
+		});
+
+		auto numSnapshots = 0u;
+		auto numInconsistentEvents = 0u;
+		while (!isDone) {
+			for (const auto& event : recorder.snapshot().Events) {
+				if (event.StartMicros != event.DurationMicros || Height(event.StartMicros) != event.Height)
+					++numInconsistentEvents;
+			}
+
+			++numSnapshots;
+			std::this_thread::yield();
+		}
+
+		threads.join();
+
+		// Assert:
+		EXPECT_LT(0u, numSnapshots);
+		EXPECT_EQ(0u, numInconsistentEvents);
+	}
+
+	// endregion
+
+	// region install / uninstall
+
+	TEST(TEST_CLASS, NoRecorderIsInstalledByDefault) {
+		EXPECT_FALSE(!!GetInstalledTraceRecorder());
+	}
+
+	TEST(TEST_CLASS, CanInstallAndUninstallRecorder) {
+		// Arrange:
+		auto pRecorder = std::make_shared<TraceRecorder>(10, CreateThreadNameSupplier("alpha"));
+
+		// Act + Assert:
+		InstallTraceRecorder(pRecorder);
+		EXPECT_EQ(pRecorder, GetInstalledTraceRecorder());
+
+		UninstallTraceRecorder(*pRecorder);
+		EXPECT_FALSE(!!GetInstalledTraceRecorder());
+	}
+
+	TEST(TEST_CLASS, UninstallDoesNotUninstallOtherRecorder) {
+		// Arrange:
+		auto pRecorder1 = std::make_shared<TraceRecorder>(10, CreateThreadNameSupplier("alpha"));
+		auto pRecorder2 = std::make_shared<TraceRecorder>(10, CreateThreadNameSupplier("alpha"));
+		InstallTraceRecorder(pRecorder1);
+
+		// Act:
+		UninstallTraceRecorder(*pRecorder2);
+
+		// Assert:
+		EXPECT_EQ(pRecorder1, GetInstalledTraceRecorder());
+		UninstallTraceRecorder(*pRecorder1);
+	}
+
+	TEST(TEST_CLASS, InstalledRecorderIsKeptAliveUntilUninstalled) {
+		// Arrange:
+		auto pRecorder = std::make_shared<TraceRecorder>(10, CreateThreadNameSupplier("alpha"));
+		std::weak_ptr<TraceRecorder> pWeakRecorder = pRecorder;
+		InstallTraceRecorder(pRecorder);
+
+		// Act:
+		pRecorder.reset();
+
+		// Assert:
+		EXPECT_FALSE(pWeakRecorder.expired());
+
+		UninstallTraceRecorder(*pWeakRecorder.lock());
+		EXPECT_TRUE(pWeakRecorder.expired());
+	}
+
+	TEST(TEST_CLASS, UninstalledRecorderIsKeptAliveBySpans) {
+		// Arrange:
+		auto pRecorder = std::make_shared<TraceRecorder>(10, CreateThreadNameSupplier("alpha"));
+		std::weak_ptr<TraceRecorder> pWeakRecorder = pRecorder;
+		InstallTraceRecorder(pRecorder);
+
+		{
+			TraceSpan span(Test_Category, "span");
+
+			// Act: uninstall and release the recorder while the span is recording
+			UninstallTraceRecorder(*pRecorder);
+			pRecorder.reset();
+
+			// Assert:
+			EXPECT_TRUE(span.isRecording());
+			EXPECT_FALSE(pWeakRecorder.expired());
+		}
+
+		// - recorder is destroyed with the last span recording into it
+		EXPECT_TRUE(pWeakRecorder.expired());
+	}
+
+	// endregion
+
+	// region TraceSpan
+
+	TEST(TEST_CLASS, SpanIsNotRecordedWhenNoRecorderIsInstalled) {
+		// Arrange:
+		auto pRecorder = std::make_shared<TraceRecorder>(10, CreateThreadNameSupplier("alpha"));
+
+		// Act:
+		{
+			TraceSpan span(Test_Category, "span");
+		}
+
+		// Assert:
+		EXPECT_TRUE(pRecorder->snapshot().Events.empty());
+	}
+
+	TEST(TEST_CLASS, SpanIsRecordedWhenRecorderIsInstalled) {
+		// Arrange:
+		auto pRecorder = std::make_shared<TraceRecorder>(10, CreateThreadNameSupplier("alpha"));
+		InstallTraceRecorder(pRecorder);
+
+		// Act:
+		{
+			TraceSpan span(Test_Category, "span");
+			test::Sleep(5);
+		}
+
+		auto events = pRecorder->snapshot().Events;
+		UninstallTraceRecorder(*pRecorder);
+
+		// Assert:
+		ASSERT_EQ(1u, events.size());
+		EXPECT_EQ(std::string(Test_Category), events[0].Category);
+		EXPECT_EQ(std::string("span"), events[0].Name);
+		EXPECT_LE(5'000u, events[0].DurationMicros);
+		EXPECT_EQ(Height(), events[0].Height);
+		EXPECT_EQ(ShortHash(), events[0].Hash);
+	}
+
+	TEST(TEST_CLASS, BlockSpanIsRecordedWhenRecorderIsInstalled) {
+		// Arrange:
+		auto pRecorder = std::make_shared<TraceRecorder>(10, CreateThreadNameSupplier("alpha"));
+		InstallTraceRecorder(pRecorder);
+
+		// Act:
+		{
+			TraceSpan outerSpan(Test_Category, "outer", Height(123), ShortHash(0xABCD));
+			TraceSpan innerSpan(Test_Category, "inner");
+		}
+
+		auto events = pRecorder->snapshot().Events;
+		UninstallTraceRecorder(*pRecorder);
+
+		// Assert:
+		ASSERT_EQ(2u, events.size());
+		EXPECT_EQ(std::string("outer"), events[0].Name);
+		EXPECT_EQ(Height(123), events[0].Height);
+		EXPECT_EQ(ShortHash(0xABCD), events[0].Hash);
+
+		EXPECT_EQ(std::string("inner"), events[1].Name);
+		EXPECT_LE(events[0].StartMicros, events[1].StartMicros);
+		EXPECT_GE(events[0].StartMicros + events[0].DurationMicros, events[1].StartMicros + events[1].DurationMicros);
+	}
+
+	TEST(TEST_CLASS, SpanIsRecordingOnlyWhenRecorderIsInstalled) {
+		// Arrange:
+		auto pRecorder = std::make_shared<TraceRecorder>(10, CreateThreadNameSupplier("alpha"));
+
+		// Act:
+		TraceSpan span1(Test_Category, "span");
+		InstallTraceRecorder(pRecorder);
+		TraceSpan span2(Test_Category, "span");
+		UninstallTraceRecorder(*pRecorder);
+
+		// Assert: recorder is captured when span is created
+		EXPECT_FALSE(span1.isRecording());
+		EXPECT_TRUE(span2.isRecording());
+	}
+
+	TEST(TEST_CLASS, SpanCanBeAssociatedWithBlockAfterCreation) {
+		// Arrange:
+		auto pRecorder = std::make_shared<TraceRecorder>(10, CreateThreadNameSupplier("alpha"));
+		InstallTraceRecorder(pRecorder);
+
+		// Act:
+		{
+			TraceSpan span(Test_Category, "span");
+			span.setBlock(Height(123), ShortHash(0xABCD));
+		}
+
+		auto events = pRecorder->snapshot().Events;
+		UninstallTraceRecorder(*pRecorder);
+
+		// Assert:
+		ASSERT_EQ(1u, events.size());
+		EXPECT_EQ(Height(123), events[0].Height);
+		EXPECT_EQ(ShortHash(0xABCD), events[0].Hash);
+	}
+
+	// endregion
+
+	// region TraceSteps
+
+	TEST(TEST_CLASS, StepsAreNotRecordedWhenNoRecorderIsInstalled) {
+		// Arrange:
+		auto pRecorder = std::make_shared<TraceRecorder>(10, CreateThreadNameSupplier("alpha"));
+
+		// Act:
+		{
+			TraceSteps steps(Test_Category, "operation", Height(123), ShortHash(0xABCD));
+			steps.step("alpha");
+			steps.step("beta");
+		}
+
+		// Assert:
+		EXPECT_TRUE(pRecorder->snapshot().Events.empty());
+	}
+
+	TEST(TEST_CLASS, OperationWithoutStepsIsRecordedWhenRecorderIsInstalled) {
+		// Arrange:
+		auto pRecorder = std::make_shared<TraceRecorder>(10, CreateThreadNameSupplier("alpha"));
+		InstallTraceRecorder(pRecorder);
+
+		// Act:
+		{
+			TraceSteps steps(Test_Category, "operation", Height(123), ShortHash(0xABCD));
+		}
+
+		auto events = pRecorder->snapshot().Events;
+		UninstallTraceRecorder(*pRecorder);
+
+		// Assert:
+		ASSERT_EQ(1u, events.size());
+		EXPECT_EQ(std::string("operation"), events[0].Name);
+		EXPECT_EQ(Height(123), events[0].Height);
+		EXPECT_EQ(ShortHash(0xABCD), events[0].Hash);
+	}
+
+	TEST(TEST_CLASS, OperationWithStepsIsRecordedWhenRecorderIsInstalled) {
+		// Arrange:
+		auto pRecorder = std::make_shared<TraceRecorder>(10, CreateThreadNameSupplier("alpha"));
+		InstallTraceRecorder(pRecorder);
+
+		// Act:
+		{
+			TraceSteps steps(Test_Category, "operation", Height(123), ShortHash(0xABCD));
+			steps.step("alpha");
+			test::Sleep(2);
+			steps.step("beta");
+			test::Sleep(2);
+			steps.step("gamma");
+		}
+
+		auto events = pRecorder->snapshot().Events;
+		UninstallTraceRecorder(*pRecorder);
+
+		// Assert: steps are consecutive and contained in operation
+		ASSERT_EQ(4u, events.size());
+		EXPECT_EQ(std::vector<std::string>({ "operation", "alpha", "beta", "gamma" }), GetNames(events));
+		for (auto i = 1u; i < events.size(); ++i) {
+			EXPECT_EQ(std::string(Test_Category), events[i].Category) << i;
+			EXPECT_LE(events[0].StartMicros, events[i].StartMicros) << i;
+			EXPECT_GE(events[0].StartMicros + events[0].DurationMicros, events[i].StartMicros + events[i].DurationMicros) << i;
+
+			if (i > 1) {
+				EXPECT_LE(events[i - 1].StartMicros + events[i - 1].DurationMicros, events[i].StartMicros) << i;
+			}
+		}
+
+		EXPECT_LE(2'000u, events[1].DurationMicros);
+		EXPECT_LE(2'000u, events[2].DurationMicros);
+	}
+
+	// endregion
+
+	// region WriteChromeTrace
+
+	namespace {
+		std::string WriteChromeTrace(const TraceSnapshot& snapshot) {
+			std::ostringstream out;
+			utils::WriteChromeTrace(out, snapshot);
+			return out.str();
+		}
+	}
+
+	TEST(TEST_CLASS, CanWriteEmptyChromeTrace) {
+		// Act:
+		auto trace = WriteChromeTrace(TraceSnapshot());
+
+		// Assert:
+		EXPECT_EQ("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n]}\n", trace);
+	}
+
+	TEST(TEST_CLASS, CanWriteChromeTraceWithThreadsAndEvents) {
+		// Arrange:
+		TraceSnapshot snapshot;
+		snapshot.Threads.push_back({ 1, "block dispatcher" });
+		snapshot.Threads.push_back({ 2, "commit" });
+		snapshot.Events.push_back({ "dispatcher", "hash calculator", 10, 20, Height(), ShortHash(), 1 });
+		snapshot.Events.push_back({ "cache", "commit", 35, 7, Height(12), ShortHash(0x44332211), 2 });
+
+		// Act:
+		auto trace = WriteChromeTrace(snapshot);
+
+		// Assert: block hash is formatted in memory (hash) order
+		EXPECT_EQ(
+				"{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+				"{\"ph\":\"M\",\"pid\":1,\"tid\":1,\"name\":\"thread_name\",\"args\":{\"name\":\"block dispatcher\"}},\n"
+				"{\"ph\":\"M\",\"pid\":1,\"tid\":2,\"name\":\"thread_name\",\"args\":{\"name\":\"commit\"}},\n"
+				"{\"ph\":\"X\",\"pid\":1,\"tid\":1,\"cat\":\"dispatcher\",\"name\":\"hash calculator\",\"ts\":10,\"dur\":20},\n"
+				"{\"ph\":\"X\",\"pid\":1,\"tid\":2,\"cat\":\"cache\",\"name\":\"commit\",\"ts\":35,\"dur\":7,"
+						"\"args\":{\"height\":12,\"hash\":\"11223344\"}}\n"
+				"]}\n",
+				trace);
+	}
+
+	TEST(TEST_CLASS, ChromeTraceStringsAreEscaped) {
+		// Arrange:
+		TraceSnapshot snapshot;
+		snapshot.Threads.push_back({ 1, "a\"b\\c\nd" });
+
+		// Act:
+		auto trace = WriteChromeTrace(snapshot);
+
+		// Assert:
+		EXPECT_EQ(
+				"{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+				"{\"ph\":\"M\",\"pid\":1,\"tid\":1,\"name\":\"thread_name\",\"args\":{\"name\":\"a\\\"b\\\\c\\u000Ad\"}}\n"
+				"]}\n",
+				trace);
+	}
+
+	// endregion
+}}
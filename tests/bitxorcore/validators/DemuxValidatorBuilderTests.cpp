@@ -251,5 +251,44 @@ namespace bitxorcore { namespace validators {
 		});
 	}
 
+	TEST(TEST_CLASS, CanDispatchToTypedAndUniversalValidatorsInRegistrationOrder) {
+		// Arrange:
+		Breadcrumbs breadcrumbs;
+		stateful::DemuxValidatorBuilder builder;
+
+		auto cache = test::CreateEmptyBitxorCoreCache();
+
+		builder
+			.add(CreateBreadcrumbValidator(breadcrumbs, "alpha"))
+			.add(CreateBreadcrumbValidator<model::AccountAddressNotification>(breadcrumbs, "beta"))
+			.add(CreateBreadcrumbValidator<model::AccountPublicKeyNotification>(breadcrumbs, "gamma"))
+			.add(CreateBreadcrumbValidator(breadcrumbs, "delta"))
+			.add(CreateBreadcrumbValidator<model::AccountPublicKeyNotification>(breadcrumbs, "epsilon"));
+		auto pValidator = builder.build([](auto) { return false; });
+
+		// Act:
+		auto result1 = test::ValidateNotification<model::Notification>(*pValidator, model::AccountPublicKeyNotification(Key()), cache);
+		auto result2 = test::ValidateNotification<model::Notification>(
+				*pValidator,
+				model::AccountAddressNotification(UnresolvedAddress()),
+				cache);
+		auto result3 = test::ValidateNotification<model::Notification>(*pValidator, test::TaggedNotification(7), cache);
+
+		// Assert:
+		EXPECT_EQ(ValidationResult::Success, result1);
+		EXPECT_EQ(ValidationResult::Success, result2);
+		EXPECT_EQ(ValidationResult::Success, result3);
+
+		// - public key notification: typed validators for that type and all universal validators
+		// - address notification: typed validator for that type and all universal validators
+		// - tagged notification: only universal validators
+		Breadcrumbs expectedSelectedNames{
+			"alpha", "gamma", "delta", "epsilon",
+			"alpha", "beta", "delta",
+			"alpha", "delta"
+		};
+		EXPECT_EQ(expectedSelectedNames, breadcrumbs);
+	}
+
 	// endregion
 }}
@@ -25,7 +25,9 @@
 #include "bitxorcore/chain/UtUpdater.h"
 #include "bitxorcore/extensions/ExecutionConfigurationFactory.h"
 #include "bitxorcore/thread/ThreadGroup.h"
+#include "bitxorcore/utils/StackTimer.h"
 #include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/TransactionInfoTestUtils.h"
 #include "tests/test/local/LocalTestUtils.h"
 #include "tests/test/local/RealTransactionFactory.h"
@@ -48,11 +50,12 @@ namespace bitxorcore { namespace chain {
 
 		class UpdaterTestContext {
 		public:
-			UpdaterTestContext()
+			explicit UpdaterTestContext(size_t maxTransactions = GetNumIterations())
 					: m_pPluginManager(CreatePluginManager())
+					, m_pPrefilterPool(test::CreateStartedIoThreadPool())
 					, m_transactionsCache(cache::MemoryCacheOptions(
 							utils::FileSize::FromKilobytes(1),
-							utils::FileSize::FromBytes(test::GetTransferTransactionSize() * GetNumIterations() * 2)))
+							utils::FileSize::FromBytes(test::GetTransferTransactionSize() * maxTransactions * 2)))
 					, m_cache(CreateBitxorCoreCache())
 					, m_updater(
 							m_transactionsCache,
@@ -61,7 +64,8 @@ namespace bitxorcore { namespace chain {
 							extensions::CreateExecutionConfiguration(*m_pPluginManager),
 							[]() { return Default_Time; },
 							[](const auto&, const auto&, auto) {},
-							[](const auto&, const auto&) { return false; })
+							[](const auto&, const auto&) { return false; },
+							*m_pPrefilterPool)
 			{}
 
 		public:
@@ -92,12 +96,22 @@ namespace bitxorcore { namespace chain {
 
 		private:
 			std::shared_ptr<plugins::PluginManager> m_pPluginManager;
+			std::unique_ptr<thread::IoThreadPool> m_pPrefilterPool;
 			cache::MemoryUtCache m_transactionsCache;
 			cache::BitxorCoreCache m_cache;
 			UtUpdater m_updater;
 		};
 
 		// endregion
+
+		void SeedAccount(cache::BitxorCoreCache& cache, const Key& publicKey, Amount balance) {
+			auto tokenId = test::Default_Currency_Token_Id;
+			auto cacheDelta = cache.createDelta();
+			auto& accountStateCacheDelta = cacheDelta.sub<cache::AccountStateCache>();
+			accountStateCacheDelta.addAccount(publicKey, Height(1));
+			accountStateCacheDelta.find(publicKey).get().Balances.credit(tokenId, balance);
+			cache.commit(Height(1));
+		}
 	}
 
 	NO_STRESS_TEST(TEST_CLASS, UtUpdaterUpdateOverloadsAreThreadSafe) {
@@ -106,14 +120,7 @@ namespace bitxorcore { namespace chain {
 
 		// - seed an account with an initial balance of N
 		auto senderKeyPair = test::GenerateKeyPair();
-		{
-			auto tokenId = test::Default_Currency_Token_Id;
-			auto cacheDelta = context.cache().createDelta();
-			auto& accountStateCacheDelta = cacheDelta.sub<cache::AccountStateCache>();
-			accountStateCacheDelta.addAccount(senderKeyPair.publicKey(), Height(1));
-			accountStateCacheDelta.find(senderKeyPair.publicKey()).get().Balances.credit(tokenId, Amount(GetNumIterations()));
-			context.cache().commit(Height(1));
-		}
+		SeedAccount(context.cache(), senderKeyPair.publicKey(), Amount(GetNumIterations()));
 
 		// Act:
 		// - simulate tx dispatcher processing N elements of 1 tx transfering 1 unit each
@@ -145,4 +152,66 @@ namespace bitxorcore { namespace chain {
 		// Assert: all transactions are in the UT cache
 		EXPECT_EQ(GetNumIterations(), context.transactionsCache().view().size());
 	}
+
+	namespace {
+		constexpr uint64_t Flood_Transactions_Per_Second = 50'000;
+		constexpr size_t Flood_Batch_Size = 1'000;
+
+		size_t GetNumFloodTransactions() {
+			return test::GetStressIterationCount() ? 5 * Flood_Transactions_Per_Second : Flood_Transactions_Per_Second;
+		}
+
+		std::vector<std::vector<model::TransactionInfo>> CreateFloodBatches(const crypto::KeyPair& senderKeyPair) {
+			auto recipient = test::GenerateRandomByteArray<Key>();
+			std::vector<std::vector<model::TransactionInfo>> batches;
+			for (auto i = 0u; i < GetNumFloodTransactions(); ++i) {
+				if (0 == i % Flood_Batch_Size)
+					batches.emplace_back();
+
+				auto pTransaction = test::CreateTransferTransaction(senderKeyPair, recipient, Amount(1));
+				pTransaction->MaxFee = Amount(0);
+				pTransaction->Deadline = Default_Time + Timestamp(1);
+				batches.back().emplace_back(std::move(pTransaction), test::GenerateRandomByteArray<Hash256>());
+			}
+
+			return batches;
+		}
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, UtUpdaterCanAbsorbTransactionFlood) {
+		// Arrange:
+		auto numTransactions = GetNumFloodTransactions();
+		UpdaterTestContext context(numTransactions);
+
+		// - seed an account with an initial balance of N
+		auto senderKeyPair = test::GenerateKeyPair();
+		SeedAccount(context.cache(), senderKeyPair.publicKey(), Amount(numTransactions));
+
+		// - prepare N transactions in batches as they would be forwarded by the transaction dispatcher
+		auto batches = CreateFloodBatches(senderKeyPair);
+
+		// Act: push batches at the target rate
+		//      (throughput is only logged because it depends on the hardware running the test)
+		auto batchBudgetMillis = Flood_Batch_Size * 1000 / Flood_Transactions_Per_Second;
+		size_t numOverBudgetBatches = 0;
+		utils::StackTimer timer;
+		for (const auto& batch : batches) {
+			utils::StackTimer batchTimer;
+			context.updater().update(batch);
+
+			auto batchElapsedMillis = batchTimer.millis();
+			if (batchElapsedMillis < batchBudgetMillis)
+				std::this_thread::sleep_for(std::chrono::milliseconds(batchBudgetMillis - batchElapsedMillis));
+			else
+				++numOverBudgetBatches;
+		}
+
+		auto elapsedMillis = timer.millis();
+		BITXORCORE_LOG(info)
+				<< "pushed " << numTransactions << " transactions in " << elapsedMillis << "ms ("
+				<< numOverBudgetBatches << " of " << batches.size() << " batches exceeded " << batchBudgetMillis << "ms budget)";
+
+		// Assert: all transactions are in the UT cache
+		EXPECT_EQ(numTransactions, context.transactionsCache().view().size());
+	}
 }}
@@ -154,6 +154,12 @@ namespace bitxorcore { namespace test {
 			return std::make_pair(Hash256(), false);
 		}
 
+		/// Tries to find the values associated with (keys) in the tree and stores proofs of existence or not in (nodes).
+		/// \note This is just a placeholder and not implemented.
+		std::vector<std::pair<Hash256, bool>> tryLookupAll(const std::vector<uint64_t>& keys, std::vector<tree::TreeNode>&) const {
+			return std::vector<std::pair<Hash256, bool>>(keys.size(), std::make_pair(Hash256(), false));
+		}
+
 	private:
 		SimpleCacheViewMode m_mode;
 		const Hash256& m_merkleRoot;
@@ -79,6 +79,11 @@ namespace bitxorcore { namespace test {
 		const void* asReadOnly() const override {
 			BITXORCORE_THROW_RUNTIME_ERROR("asReadOnly is not supported");
 		}
+
+		[[noreturn]]
+		bool hasChanges() const override {
+			BITXORCORE_THROW_RUNTIME_ERROR("hasChanges is not supported");
+		}
 	};
 
 	// endregion
@@ -33,4 +33,14 @@ namespace bitxorcore { namespace test {
 		pPool->start();
 		return pPool;
 	}
+
+	std::unique_ptr<thread::ComputeThreadPool> CreateStartedComputeThreadPool(const char* name) {
+		return CreateStartedComputeThreadPool(GetNumDefaultPoolThreads(), name);
+	}
+
+	std::unique_ptr<thread::ComputeThreadPool> CreateStartedComputeThreadPool(uint32_t numThreads, const char* name) {
+		auto pPool = thread::CreateComputeThreadPool({ numThreads, {} }, name);
+		pPool->start();
+		return pPool;
+	}
 }}
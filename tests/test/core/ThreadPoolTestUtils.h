@@ -21,6 +21,7 @@
 **/
 
 #pragma once
+#include "bitxorcore/thread/ComputeThreadPool.h"
 #include "bitxorcore/thread/IoThreadPool.h"
 #include "tests/TestHarness.h"
 #include <memory>
@@ -33,4 +34,10 @@ namespace bitxorcore { namespace test {
 
 	/// Creates an auto started thread pool with \a numThreads threads and \a name.
 	std::unique_ptr<thread::IoThreadPool> CreateStartedIoThreadPool(uint32_t numThreads, const char* name = nullptr);
+
+	/// Creates an auto started compute thread pool with a default number of threads and \a name.
+	std::unique_ptr<thread::ComputeThreadPool> CreateStartedComputeThreadPool(const char* name = nullptr);
+
+	/// Creates an auto started compute thread pool with \a numThreads threads and \a name.
+	std::unique_ptr<thread::ComputeThreadPool> CreateStartedComputeThreadPool(uint32_t numThreads, const char* name = nullptr);
 }}
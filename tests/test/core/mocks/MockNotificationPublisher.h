@@ -22,6 +22,7 @@
 
 #pragma once
 #include "bitxorcore/model/NotificationPublisher.h"
+#include <atomic>
 
 namespace bitxorcore { namespace mocks {
 
@@ -44,6 +45,6 @@ namespace bitxorcore { namespace mocks {
 		}
 
 	private:
-		mutable size_t m_numPublishCalls;
+		mutable std::atomic<size_t> m_numPublishCalls;
 	};
 }}
@@ -52,11 +52,15 @@ namespace bitxorcore { namespace test {
 
 			config.EnableAddressReuse = true;
 
+			config.HeavyPacketHandlerPoolSize = 2;
+			config.MaxPendingHeavyPacketsPerPeer = 16;
+
 			config.FileDatabaseBatchSize = File_Database_Batch_Size;
 
 			config.MaxHashesPerSyncAttempt = 4 * 100;
 			config.MaxBlocksPerSyncAttempt = 2 * 100;
 			config.MaxChainBytesPerSyncAttempt = utils::FileSize::FromKilobytes(8 * 512);
+			config.MaxParallelSyncPeers = 1;
 
 			config.ShortLivedCacheMaxSize = 10;
 
@@ -70,6 +74,7 @@ namespace bitxorcore { namespace test {
 
 			config.SocketWorkingBufferSize = utils::FileSize::FromKilobytes(4);
 			config.MaxPacketDataSize = utils::FileSize::FromMegabytes(100);
+			config.MaxStatePathKeysPerRequest = 1'000;
 
 			config.BlockDisruptorSlotCount = 4 * 1024;
 			config.BlockDisruptorMaxMemorySize = utils::FileSize::FromMegabytes(100);
@@ -84,7 +84,7 @@ namespace bitxorcore { namespace test {
 
 			// Assert:
 			EXPECT_EQ(Traits::Num_Expected_Services, context.locator().numServices());
-			EXPECT_EQ(1u, context.locator().counters().size());
+			EXPECT_EQ(Traits::Num_Expected_Counters, context.locator().counters().size());
 
 			EXPECT_TRUE(!!Traits::GetWriters(context.locator()));
 			EXPECT_EQ(0u, context.counter(Traits::Counter_Name));
@@ -100,7 +100,7 @@ namespace bitxorcore { namespace test {
 
 			// Assert:
 			EXPECT_EQ(Traits::Num_Expected_Services, context.locator().numServices());
-			EXPECT_EQ(1u, context.locator().counters().size());
+			EXPECT_EQ(Traits::Num_Expected_Counters, context.locator().counters().size());
 
 			EXPECT_FALSE(!!Traits::GetWriters(context.locator()));
 			EXPECT_EQ(extensions::ServiceLocator::Sentinel_Counter_Value, context.counter(Traits::Counter_Name));
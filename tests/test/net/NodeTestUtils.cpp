@@ -127,6 +127,14 @@ namespace bitxorcore { namespace test {
 		EXPECT_EQ(0u, connectionState.BanAge);
 	}
 
+	void AssertZeroed(const ionet::NodeTransferStatistics& transferStatistics) {
+		// Assert:
+		EXPECT_EQ(0u, transferStatistics.NumRoundTripSamples);
+		EXPECT_EQ(0u, transferStatistics.RoundTripMicros);
+		EXPECT_EQ(0u, transferStatistics.NumThroughputSamples);
+		EXPECT_EQ(0u, transferStatistics.BytesPerSecond);
+	}
+
 	void AssertNodeInteractions(
 			uint32_t expectedNumSuccesses,
 			uint32_t expectedNumFailures,
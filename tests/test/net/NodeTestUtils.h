@@ -128,6 +128,9 @@ namespace bitxorcore { namespace test {
 	/// Asserts that \a connectionState is zeroed.
 	void AssertZeroed(const ionet::ConnectionState& connectionState);
 
+	/// Asserts that all fields of \a transferStatistics are zero.
+	void AssertZeroed(const ionet::NodeTransferStatistics& transferStatistics);
+
 	/// Asserts \a interactions has \a expectedNumSuccesses and \a expectedNumFailures;
 	/// \a message is used to output additional information.
 	void AssertNodeInteractions(
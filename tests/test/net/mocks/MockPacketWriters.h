@@ -111,6 +111,10 @@ namespace bitxorcore { namespace mocks {
 			BITXORCORE_THROW_RUNTIME_ERROR("not implemented in mock");
 		}
 
+		ionet::NodePacketIoPair pickOneByKey(const Key&, const utils::TimeSpan&) override {
+			BITXORCORE_THROW_RUNTIME_ERROR("not implemented in mock");
+		}
+
 		void shutdown() override {
 			BITXORCORE_THROW_RUNTIME_ERROR("not implemented in mock");
 		}
@@ -187,6 +191,14 @@ namespace bitxorcore { namespace mocks {
 			return pair;
 		}
 
+		ionet::NodePacketIoPair pickOneByKey(const Key& identityKey, const utils::TimeSpan& ioDuration) override {
+			// only the configured node is connected
+			if (identityKey != m_nodeIdentity.PublicKey)
+				return ionet::NodePacketIoPair();
+
+			return pickOne(ioDuration);
+		}
+
 	private:
 		SetPacketIoBehavior m_setPacketIoBehavior;
 		std::vector<utils::TimeSpan> m_ioDurations;
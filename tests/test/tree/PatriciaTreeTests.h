@@ -24,6 +24,7 @@
 #include "PassThroughEncoder.h"
 #include "bitxorcore/tree/DataSourceVerbosity.h"
 #include "bitxorcore/tree/PatriciaTree.h"
+#include "bitxorcore/utils/Hashers.h"
 #include "tests/TestHarness.h"
 #include <unordered_map>
 #include <unordered_set>
@@ -1400,6 +1401,89 @@ namespace bitxorcore { namespace test {
 
 		// endregion
 
+		// region lookupAll
+
+	private:
+		template<typename TTree>
+		static void AssertLookupAllMatchesLookup(const TTree& tree, const std::vector<uint32_t>& keys, size_t expectedNumNodes) {
+			// Act:
+			std::vector<tree::TreeNode> nodes;
+			auto results = tree.lookupAll(keys, nodes);
+
+			// Assert: each node is returned once
+			EXPECT_EQ(expectedNumNodes, nodes.size());
+
+			std::unordered_set<Hash256, utils::ArrayHasher<Hash256>> nodeHashes;
+			for (const auto& node : nodes)
+				EXPECT_TRUE(nodeHashes.insert(node.hash()).second) << "duplicate node " << node.hash();
+
+			// - each result matches the result of an individual lookup and all nodes of its proof are present
+			ASSERT_EQ(keys.size(), results.size());
+			for (auto i = 0u; i < keys.size(); ++i) {
+				std::vector<tree::TreeNode> nodePath;
+				auto result = tree.lookup(keys[i], nodePath);
+
+				EXPECT_EQ(result, results[i]) << keys[i];
+				for (const auto& node : nodePath)
+					EXPECT_CONTAINS(nodeHashes, node.hash());
+			}
+		}
+
+	public:
+		static void AssertLookupAllReturnsNoNodesWhenTreeIsEmpty() {
+			// Arrange:
+			TestContext context;
+
+			// Act + Assert:
+			AssertLookupAllMatchesLookup(context.tree(), { 0x64'6F'67'00, 0x64'6F'67'65 }, 0);
+		}
+
+		static void AssertLookupAllReturnsNoNodesWhenNoKeysAreSpecified() {
+			// Arrange:
+			TestContext context;
+			context.tree().set(0x64'6F'67'00, "alpha");
+
+			// Act + Assert:
+			AssertLookupAllMatchesLookup(context.tree(), {}, 0);
+		}
+
+		static void AssertLookupAllSharesNodesAcrossFoundKeys() {
+			// Arrange:
+			TestContext context;
+			context.tree().set(0x64'6F'00'00, "verb");
+			context.tree().set(0x64'6F'67'00, "puppy");
+			context.tree().set(0x64'6F'67'65, "coin");
+			context.tree().set(0x68'6F'72'73, "stallion");
+
+			// Act + Assert: individual proofs contain 13 nodes but only 7 are distinct
+			AssertLookupAllMatchesLookup(context.tree(), { 0x64'6F'67'65, 0x64'6F'00'00, 0x68'6F'72'73, 0x64'6F'67'00 }, 7);
+		}
+
+		static void AssertLookupAllSharesNodesAcrossFoundAndNotFoundKeys() {
+			// Arrange:
+			TestContext context;
+			context.tree().set(0x64'6F'00'00, "verb");
+			context.tree().set(0x64'6F'67'00, "puppy");
+			context.tree().set(0x64'6F'67'65, "coin");
+			context.tree().set(0x68'6F'72'73, "stallion");
+
+			// Act + Assert: unknown keys diverge at root, at leaf `verb` and at branch `67`
+			AssertLookupAllMatchesLookup(context.tree(), { 0x54'6F'67'00, 0x64'6F'00'01, 0x64'6F'67'44, 0x64'6F'67'65 }, 5);
+		}
+
+		static void AssertLookupAllSupportsDuplicateKeys() {
+			// Arrange:
+			TestContext context;
+			context.tree().set(0x65'43'22'10, "alpha");
+			context.tree().set(0x65'43'42'10, "beta");
+			context.tree().set(0x47'95'92'10, "gamma");
+
+			// Act + Assert:
+			AssertLookupAllMatchesLookup(context.tree(), { 0x65'43'42'10, 0x47'95'92'10, 0x65'43'42'10 }, 4);
+		}
+
+		// endregion
+
 		// region any order tests
 
 	private:
@@ -1702,6 +1786,12 @@ namespace bitxorcore { namespace test {
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, LookupSucceedsWhenKeyIsTreeRoot) \
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, LookupSucceedsWhenKeyIsInTree) \
 	\
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, LookupAllReturnsNoNodesWhenTreeIsEmpty) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, LookupAllReturnsNoNodesWhenNoKeysAreSpecified) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, LookupAllSharesNodesAcrossFoundKeys) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, LookupAllSharesNodesAcrossFoundAndNotFoundKeys) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, LookupAllSupportsDuplicateKeys) \
+	\
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanCreatePuppyTreeWithRootExtensionNode_AnyOrder) \
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanUndoPuppyTreeWithRootExtensionNode_AnyOrder) \
 	\
@@ -0,0 +1,242 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-2021, Jaguar0625, gimre, BloodyRookie.
+*** Copyright (c) 2022-present, Kriptxor Corp, Microsula S.A.
+*** All rights reserved.
+***
+*** This file is part of BitxorCore.
+***
+*** BitxorCore is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** BitxorCore is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with BitxorCore. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "tools/ToolMain.h"
+#include "tools/ToolConfigurationUtils.h"
+#include "bitxorcore/cache_db/RocksInclude.h"
+#include "bitxorcore/cache_db/SharedRocksDatabase.h"
+#include "bitxorcore/plugins/PluginManager.h"
+#include <algorithm>
+#include <filesystem>
+
+namespace bitxorcore { namespace tools { namespace statedbmerge {
+
+	namespace {
+		// region database utils
+
+		struct SourceDatabase {
+			std::string Name;
+			std::string Directory;
+			std::vector<std::string> ColumnFamilyNames;
+		};
+
+		[[noreturn]]
+		void ThrowDatabaseError(const char* message, const std::string& directory, const rocksdb::Status& status) {
+			BITXORCORE_THROW_RUNTIME_ERROR_2(message, directory, status.ToString());
+		}
+
+		class DatabaseHandle {
+		public:
+			DatabaseHandle(
+					const rocksdb::Options& dbOptions,
+					const std::string& directory,
+					const std::vector<std::string>& columnFamilyNames,
+					const rocksdb::ColumnFamilyOptions& columnFamilyOptions,
+					bool isReadOnly) {
+				std::vector<rocksdb::ColumnFamilyDescriptor> columnFamilies;
+				for (const auto& columnFamilyName : columnFamilyNames)
+					columnFamilies.push_back(rocksdb::ColumnFamilyDescriptor(columnFamilyName, columnFamilyOptions));
+
+				rocksdb::DB* pDb;
+				auto status = isReadOnly
+						? rocksdb::DB::OpenForReadOnly(dbOptions, directory, columnFamilies, &m_handles, &pDb)
+						: rocksdb::DB::Open(dbOptions, directory, columnFamilies, &m_handles, &pDb);
+				m_pDb.reset(pDb);
+				if (!status.ok())
+					ThrowDatabaseError("couldn't open database", directory, status);
+			}
+
+			~DatabaseHandle() {
+				for (auto* pHandle : m_handles)
+					m_pDb->DestroyColumnFamilyHandle(pHandle);
+			}
+
+		public:
+			rocksdb::DB& db() {
+				return *m_pDb;
+			}
+
+			rocksdb::ColumnFamilyHandle* handle(size_t index) const {
+				return m_handles[index];
+			}
+
+		private:
+			std::unique_ptr<rocksdb::DB> m_pDb;
+			std::vector<rocksdb::ColumnFamilyHandle*> m_handles;
+		};
+
+		std::vector<SourceDatabase> FindSourceDatabases(const std::filesystem::path& cacheDatabaseDirectory) {
+			std::vector<SourceDatabase> sourceDatabases;
+			for (const auto& entry : std::filesystem::directory_iterator(cacheDatabaseDirectory)) {
+				auto name = entry.path().filename().generic_string();
+				if (!entry.is_directory() || plugins::Shared_Cache_Database_Name == name)
+					continue;
+
+				std::vector<std::string> columnFamilyNames;
+				auto directory = entry.path().generic_string();
+				auto status = rocksdb::DB::ListColumnFamilies(rocksdb::DBOptions(), directory, &columnFamilyNames);
+				if (!status.ok()) {
+					BITXORCORE_LOG(warning) << "skipping " << directory << " that does not contain a database: " << status.ToString();
+					continue;
+				}
+
+				sourceDatabases.push_back({ name, directory, columnFamilyNames });
+			}
+
+			std::sort(sourceDatabases.begin(), sourceDatabases.end(), [](const auto& lhs, const auto& rhs) {
+				return lhs.Name < rhs.Name;
+			});
+			return sourceDatabases;
+		}
+
+		// endregion
+
+		// region MergeContext
+
+		class MergeContext {
+		public:
+			MergeContext(DatabaseHandle& destination, size_t maxWriteBatchSize)
+					: m_destination(destination)
+					, m_maxWriteBatchSize(maxWriteBatchSize)
+					, m_numEntries(0)
+			{}
+
+		public:
+			size_t numEntries() const {
+				return m_numEntries;
+			}
+
+		public:
+			void copy(rocksdb::DB& sourceDb, rocksdb::ColumnFamilyHandle* pSourceHandle, rocksdb::ColumnFamilyHandle* pDestinationHandle) {
+				std::unique_ptr<rocksdb::Iterator> pIterator(sourceDb.NewIterator(rocksdb::ReadOptions(), pSourceHandle));
+				for (pIterator->SeekToFirst(); pIterator->Valid(); pIterator->Next()) {
+					m_writeBatch.Put(pDestinationHandle, pIterator->key(), pIterator->value());
+					++m_numEntries;
+
+					if (m_writeBatch.GetDataSize() >= m_maxWriteBatchSize)
+						write(false);
+				}
+
+				if (!pIterator->status().ok())
+					BITXORCORE_THROW_RUNTIME_ERROR_1("error iterating over source database", pIterator->status().ToString());
+			}
+
+			void finish() {
+				// sync once at the end because a failed merge is restarted from scratch
+				write(true);
+			}
+
+		private:
+			void write(bool sync) {
+				rocksdb::WriteOptions writeOptions;
+				writeOptions.sync = sync;
+				auto status = m_destination.db().Write(writeOptions, &m_writeBatch);
+				if (!status.ok())
+					BITXORCORE_THROW_RUNTIME_ERROR_1("could not store batch in shared db", status.ToString());
+
+				m_writeBatch.Clear();
+			}
+
+		private:
+			DatabaseHandle& m_destination;
+			size_t m_maxWriteBatchSize;
+			size_t m_numEntries;
+			rocksdb::WriteBatch m_writeBatch;
+		};
+
+		// endregion
+
+		class StateDatabaseMergeTool : public Tool {
+		public:
+			std::string name() const override {
+				return "State Database Merge Tool";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder, OptionsPositional&) override {
+				AddResourcesOption(optionsBuilder);
+			}
+
+			int run(const Options& options) override {
+				auto config = LoadConfiguration(GetResourcesOptionValue(options));
+				const auto& databaseConfig = config.Node.CacheDatabase;
+
+				auto cacheDatabaseDirectory = std::filesystem::path(config.User.DataDirectory) / "statedb";
+				auto sharedDatabaseDirectory = cacheDatabaseDirectory / plugins::Shared_Cache_Database_Name;
+				if (!std::filesystem::is_directory(cacheDatabaseDirectory))
+					BITXORCORE_THROW_INVALID_ARGUMENT_1("cache database directory does not exist", cacheDatabaseDirectory.generic_string());
+
+				if (std::filesystem::exists(sharedDatabaseDirectory))
+					BITXORCORE_THROW_INVALID_ARGUMENT_1("shared database already exists", sharedDatabaseDirectory.generic_string());
+
+				// 1. find all per cache databases and the shared column families that will host them
+				auto sourceDatabases = FindSourceDatabases(cacheDatabaseDirectory);
+				std::vector<std::string> sharedColumnFamilyNames{ rocksdb::kDefaultColumnFamilyName };
+				for (const auto& sourceDatabase : sourceDatabases) {
+					for (const auto& columnFamilyName : sourceDatabase.ColumnFamilyNames) {
+						auto sharedColumnFamilyName = cache::SharedRocksDatabase::ColumnFamilyName(sourceDatabase.Name, columnFamilyName);
+						sharedColumnFamilyNames.push_back(sharedColumnFamilyName);
+					}
+				}
+
+				// 2. create the shared database
+				std::filesystem::create_directories(sharedDatabaseDirectory);
+				auto columnFamilyOptions = cache::detail::CreateColumnFamilyOptions(databaseConfig, nullptr);
+				DatabaseHandle destination(
+						cache::detail::CreateDatabaseOptions(databaseConfig),
+						sharedDatabaseDirectory.generic_string(),
+						sharedColumnFamilyNames,
+						columnFamilyOptions,
+						false);
+
+				// 3. copy all column families
+				MergeContext context(destination, databaseConfig.MaxWriteBatchSize.bytes());
+				auto destinationIndex = 1u; // skip default column family
+				for (const auto& sourceDatabase : sourceDatabases) {
+					DatabaseHandle source(rocksdb::Options(), sourceDatabase.Directory, sourceDatabase.ColumnFamilyNames, {}, true);
+
+					auto numEntriesBefore = context.numEntries();
+					for (auto i = 0u; i < sourceDatabase.ColumnFamilyNames.size(); ++i)
+						context.copy(source.db(), source.handle(i), destination.handle(destinationIndex++));
+
+					BITXORCORE_LOG(info)
+							<< "merged " << (context.numEntries() - numEntriesBefore) << " entries from "
+							<< sourceDatabase.ColumnFamilyNames.size() << " column families of " << sourceDatabase.Name;
+				}
+
+				context.finish();
+
+				BITXORCORE_LOG(info)
+						<< "merged " << context.numEntries() << " entries from " << sourceDatabases.size()
+						<< " databases into " << sharedDatabaseDirectory.generic_string();
+				BITXORCORE_LOG(important)
+						<< "set enableSharedDatabase = true in the cache_database section of config-node.properties; "
+						<< "per cache databases are no longer used and can be removed after verifying the node starts";
+				return 0;
+			}
+		};
+	}
+}}}
+
+int main(int argc, const char** argv) {
+	bitxorcore::tools::statedbmerge::StateDatabaseMergeTool tool;
+	return bitxorcore::tools::ToolMain(argc, argv, tool);
+}